@@ -0,0 +1,263 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_bench.hpp"
+#include "volk_file_importer.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#if !defined(_WIN32)
+  #include <sys/resource.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+// Load time and peak RSS of VolkFileImporter with the host pointer import against the staged upload path, for one
+// file in a warm page cache. Each load runs in a child process so that the peak RSS of one doesn't hide the other.
+// The driver pins imported pages by touching them, keeps device local memory off the host, and completes a staged
+// batch as soon as it is submitted after a fixed CPU time.
+
+#if !defined(_WIN32)
+
+namespace {
+
+constexpr size_t kFileSize = size_t(256) << 20;
+constexpr VkDeviceSize kRingSize = VolkUploadQueue::kDefaultRingSize;
+constexpr VkDeviceSize kImportAlignment = 4096;
+constexpr std::chrono::microseconds kSubmitTime(20);
+
+constexpr uint32_t kHostMemoryType = 0;
+constexpr uint32_t kDeviceMemoryType = 1;
+
+bool importSupported = true;
+std::vector<uint8_t> ringMemory;
+VkDeviceSize lastBufferSize = 0;
+uint64_t nextHandle = 1;
+uint64_t submittedValue = 0;
+volatile uint8_t pinnedSum = 0;
+
+template <typename Handle>
+Handle makeHandle() {
+  return reinterpret_cast<Handle>(static_cast<uintptr_t>(nextHandle++));
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties2(VkPhysicalDevice, VkPhysicalDeviceProperties2* pProperties) {
+  auto hostProperties = static_cast<VkPhysicalDeviceExternalMemoryHostPropertiesEXT*>(pProperties->pNext);
+  hostProperties->minImportedHostPointerAlignment = importSupported ? kImportAlignment : 0;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties* pProperties) {
+  *pProperties = {};
+  pProperties->memoryTypeCount = 2;
+  pProperties->memoryTypes[kHostMemoryType].propertyFlags =
+    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+  pProperties->memoryTypes[kDeviceMemoryType].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getMemoryHostPointerProperties(VkDevice, VkExternalMemoryHandleTypeFlagBits,
+                                                              const void*,
+                                                              VkMemoryHostPointerPropertiesEXT* pProperties) {
+  pProperties->memoryTypeBits = 1u << kHostMemoryType;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createBuffer(VkDevice, const VkBufferCreateInfo* pCreateInfo,
+                                            const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+  lastBufferSize = pCreateInfo->size;
+  *pBuffer = makeHandle<VkBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements(VkDevice, VkBuffer, VkMemoryRequirements* pRequirements) {
+  pRequirements->size = lastBufferSize;
+  pRequirements->alignment = 256;
+  pRequirements->memoryTypeBits = (1u << kHostMemoryType) | (1u << kDeviceMemoryType);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo* pAllocateInfo,
+                                              const VkAllocationCallbacks*, VkDeviceMemory* pMemory) {
+  if (pAllocateInfo->pNext) {
+    // Pinning faults in every page of the imported range.
+    auto importInfo = static_cast<const VkImportMemoryHostPointerInfoEXT*>(pAllocateInfo->pNext);
+    auto const* pages = static_cast<const uint8_t*>(importInfo->pHostPointer);
+    uint8_t sum = 0;
+    for (VkDeviceSize offset = 0; offset < pAllocateInfo->allocationSize; offset += kImportAlignment) {
+      sum = static_cast<uint8_t>(sum + pages[offset]);
+    }
+    pinnedSum = sum;
+  } else if (pAllocateInfo->memoryTypeIndex == kHostMemoryType) {
+    ringMemory.assign(static_cast<size_t>(pAllocateInfo->allocationSize), 0);
+  }
+  *pMemory = makeHandle<VkDeviceMemory>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory(VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL mapMemory(VkDevice, VkDeviceMemory, VkDeviceSize, VkDeviceSize, VkMemoryMapFlags,
+                                         void** ppData) {
+  *ppData = ringMemory.data();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createCommandPool(VkDevice, const VkCommandPoolCreateInfo*,
+                                                 const VkAllocationCallbacks*, VkCommandPool* pCommandPool) {
+  *pCommandPool = makeHandle<VkCommandPool>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*,
+                                               VkSemaphore* pSemaphore) {
+  *pSemaphore = makeHandle<VkSemaphore>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL freeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroyCommandPool(VkDevice, VkCommandPool, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo*,
+                                                      VkCommandBuffer* pCommandBuffers) {
+  *pCommandBuffers = makeHandle<VkCommandBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer(VkCommandBuffer, VkCommandBufferResetFlags) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer(VkCommandBuffer, const VkCommandBufferBeginInfo*) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL endCommandBuffer(VkCommandBuffer) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer(VkCommandBuffer, VkBuffer, VkBuffer, uint32_t, const VkBufferCopy*) {}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer, const VkDependencyInfo*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL queueSubmit2(VkQueue, uint32_t, const VkSubmitInfo2* pSubmits, VkFence) {
+  VolkBenchTimer::spin(kSubmitTime);
+  submittedValue = pSubmits->pSignalSemaphoreInfos->value;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreCounterValue(VkDevice, VkSemaphore, uint64_t* pValue) {
+  *pValue = submittedValue;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores(VkDevice, const VkSemaphoreWaitInfo*, uint64_t) {
+  return VK_SUCCESS;
+}
+
+long getPeakRss() {
+  rusage usage = {};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss; // KiB
+}
+
+int load(char const* path) {
+  Volk volk;
+  volk.vkGetPhysicalDeviceProperties2 = getPhysicalDeviceProperties2;
+  volk.vkGetPhysicalDeviceMemoryProperties = getPhysicalDeviceMemoryProperties;
+  volk.vkGetMemoryHostPointerPropertiesEXT = getMemoryHostPointerProperties;
+  volk.vkCreateBuffer = createBuffer;
+  volk.vkGetBufferMemoryRequirements = getBufferMemoryRequirements;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkBindBufferMemory = bindBufferMemory;
+  volk.vkMapMemory = mapMemory;
+  volk.vkCreateCommandPool = createCommandPool;
+  volk.vkCreateSemaphore = createSemaphore;
+  volk.vkDestroyBuffer = destroyBuffer;
+  volk.vkFreeMemory = freeMemory;
+  volk.vkDestroyCommandPool = destroyCommandPool;
+  volk.vkDestroySemaphore = destroySemaphore;
+  volk.vkAllocateCommandBuffers = allocateCommandBuffers;
+  volk.vkResetCommandBuffer = resetCommandBuffer;
+  volk.vkBeginCommandBuffer = beginCommandBuffer;
+  volk.vkEndCommandBuffer = endCommandBuffer;
+  volk.vkCmdCopyBuffer = cmdCopyBuffer;
+  volk.vkCmdPipelineBarrier2 = cmdPipelineBarrier2;
+  volk.vkQueueSubmit2 = queueSubmit2;
+  volk.vkGetSemaphoreCounterValue = getSemaphoreCounterValue;
+  volk.vkWaitSemaphores = waitSemaphores;
+
+  // The ring is resident in both cases and isn't counted.
+  VolkUploadQueue queue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0, kRingSize);
+  VolkFileImporter importer(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, queue);
+  VolkFileImporter::Buffer buffer;
+  auto const startRss = getPeakRss();
+  VolkBenchTimer timer;
+  auto result = importer.load(path, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, &buffer);
+  if (result == VK_SUCCESS && buffer.value != 0) {
+    result = queue.wait(buffer.value);
+  }
+  auto const seconds = timer.getSeconds();
+  auto const peakRss = getPeakRss() - startRss;
+  importer.unload(buffer);
+  if (result != VK_SUCCESS) {
+    fprintf(stderr, "load failed: %d\n", result);
+    return EXIT_FAILURE;
+  }
+
+  printf("%-8s %8.1f ms, %8.0f MB/s, peak RSS +%6ld MiB\n", importSupported ? "imported" : "staged", seconds * 1e3,
+         double(kFileSize) / seconds / 1e6, peakRss >> 10);
+  return EXIT_SUCCESS;
+}
+
+bool measure(char const* path, bool import) {
+  fflush(stdout);
+  auto const pid = fork();
+  if (pid == 0) {
+    importSupported = import;
+    auto const exitCode = load(path);
+    fflush(stdout);
+    _exit(exitCode);
+  }
+  int status = 0;
+  return pid > 0 && waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main() {
+  char path[] = "/tmp/volk_bench_file_importer_XXXXXX";
+  auto const fd = mkstemp(path);
+  if (fd < 0) {
+    perror("mkstemp");
+    return EXIT_FAILURE;
+  }
+  std::vector<uint8_t> chunk(size_t(1) << 20);
+  for (size_t i = 0; i < chunk.size(); ++i) {
+    chunk[i] = static_cast<uint8_t>(i * 31);
+  }
+  bool ok = true;
+  for (size_t written = 0; ok && written < kFileSize; written += chunk.size()) {
+    ok = write(fd, chunk.data(), chunk.size()) == static_cast<ssize_t>(chunk.size());
+  }
+  close(fd);
+
+  printf("%zu MiB file, %llu MiB ring, submit %lld us\n", kFileSize >> 20,
+         static_cast<unsigned long long>(kRingSize >> 20), static_cast<long long>(kSubmitTime.count()));
+  // The file was just written, so both loads start from a warm page cache.
+  ok = ok && measure(path, false) && measure(path, true);
+  unlink(path);
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+int main() {
+  printf("bench_file_importer needs a POSIX system\n");
+  return 0;
+}
+
+#endif
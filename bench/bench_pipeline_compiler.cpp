@@ -0,0 +1,80 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_bench.hpp"
+#include "volk_pipeline_compiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+// Compile throughput of VolkPipelineCompiler against a driver spending a fixed CPU time per pipeline.
+// Half of the requests are duplicates, which must be served without compiling.
+
+namespace {
+
+constexpr uint32_t kUniquePipelines = 2048;
+constexpr std::chrono::microseconds kCompileTime(200);
+
+std::atomic<uint64_t> nextPipeline = 0;
+
+VKAPI_ATTR VkResult VKAPI_CALL createPipelineCache(VkDevice, const VkPipelineCacheCreateInfo*,
+                                                   const VkAllocationCallbacks*, VkPipelineCache* pPipelineCache) {
+  *pPipelineCache = reinterpret_cast<VkPipelineCache>(uint64_t(1));
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyPipelineCache(VkDevice, VkPipelineCache, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL createComputePipelines(VkDevice, VkPipelineCache, uint32_t createInfoCount,
+                                                      const VkComputePipelineCreateInfo*, const VkAllocationCallbacks*,
+                                                      VkPipeline* pPipelines) {
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    VolkBenchTimer::spin(kCompileTime);
+    pPipelines[i] = reinterpret_cast<VkPipeline>(++nextPipeline);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyPipeline(VkDevice, VkPipeline, const VkAllocationCallbacks*) {}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreatePipelineCache = createPipelineCache;
+  volk.vkDestroyPipelineCache = destroyPipelineCache;
+  volk.vkCreateComputePipelines = createComputePipelines;
+  volk.vkDestroyPipeline = destroyPipeline;
+
+  std::vector<VkComputePipelineCreateInfo> infos(kUniquePipelines * 2);
+  for (uint32_t i = 0; i < infos.size(); ++i) {
+    auto& info = infos[i];
+    info = {};
+    info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+    info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    info.stage.module = reinterpret_cast<VkShaderModule>(uint64_t(i % kUniquePipelines + 1));
+    info.stage.pName = "main";
+  }
+
+  printf("%u requests, %u unique, %lld us per compilation\n", uint32_t(infos.size()), kUniquePipelines,
+         static_cast<long long>(kCompileTime.count()));
+  uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  for (uint32_t threads = 1; threads <= maxThreads; threads *= 2) {
+    nextPipeline = 0;
+    VolkBenchTimer timer;
+    {
+      VolkPipelineCompiler compiler(volk, VK_NULL_HANDLE, threads);
+      for (auto const& info : infos) {
+        (void)compiler.compile(info, VolkPipelineCompiler::Priority::Prefetch);
+      }
+      compiler.wait();
+    }
+    double seconds = timer.getSeconds();
+    printf("threads %2u: %8.0f requests/s, %u compiled\n", threads, double(infos.size()) / seconds,
+           uint32_t(nextPipeline.load()));
+  }
+  return 0;
+}
@@ -0,0 +1,143 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_bench.hpp"
+#include "volk_sync_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+// Per-frame fence and semaphore turnover through VolkSyncPool against creating and destroying them every frame,
+// with a driver spending a fixed CPU time per object creation, destruction and reset call.
+
+namespace {
+
+constexpr uint32_t kFrames = 2000;
+constexpr uint32_t kObjectsPerFrame = 16;
+constexpr std::chrono::microseconds kCreateTime(2);
+constexpr std::chrono::microseconds kDestroyTime(1);
+constexpr std::chrono::microseconds kResetTime(1);
+
+std::atomic<uint64_t> nextHandle = 0;
+std::atomic<uint64_t> createCount = 0;
+
+template <typename Handle>
+Handle createHandle() {
+  VolkBenchTimer::spin(kCreateTime);
+  ++createCount;
+  return reinterpret_cast<Handle>(++nextHandle);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createFence(VkDevice, const VkFenceCreateInfo*, const VkAllocationCallbacks*,
+                                           VkFence* pFence) {
+  *pFence = createHandle<VkFence>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*,
+                                               VkSemaphore* pSemaphore) {
+  *pSemaphore = createHandle<VkSemaphore>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createEvent(VkDevice, const VkEventCreateInfo*, const VkAllocationCallbacks*,
+                                           VkEvent* pEvent) {
+  *pEvent = createHandle<VkEvent>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyFence(VkDevice, VkFence, const VkAllocationCallbacks*) {
+  VolkBenchTimer::spin(kDestroyTime);
+}
+
+VKAPI_ATTR void VKAPI_CALL destroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*) {
+  VolkBenchTimer::spin(kDestroyTime);
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyEvent(VkDevice, VkEvent, const VkAllocationCallbacks*) {
+  VolkBenchTimer::spin(kDestroyTime);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetFences(VkDevice, uint32_t, const VkFence*) {
+  VolkBenchTimer::spin(kResetTime);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetEvent(VkDevice, VkEvent) {
+  VolkBenchTimer::spin(kResetTime);
+  return VK_SUCCESS;
+}
+
+void runCreateDestroy(Volk& volk) {
+  VkFence fences[kObjectsPerFrame];
+  VkSemaphore semaphores[kObjectsPerFrame];
+  for (uint32_t frame = 0; frame < kFrames; ++frame) {
+    for (uint32_t i = 0; i < kObjectsPerFrame; ++i) {
+      (void)volk.vkCreateFence(VK_NULL_HANDLE, nullptr, nullptr, &fences[i]);
+      (void)volk.vkCreateSemaphore(VK_NULL_HANDLE, nullptr, nullptr, &semaphores[i]);
+    }
+    for (uint32_t i = 0; i < kObjectsPerFrame; ++i) {
+      volk.vkDestroyFence(VK_NULL_HANDLE, fences[i], nullptr);
+      volk.vkDestroySemaphore(VK_NULL_HANDLE, semaphores[i], nullptr);
+    }
+  }
+}
+
+void runPool(VolkSyncPool& pool) {
+  VkFence fences[kObjectsPerFrame];
+  VkSemaphore semaphores[kObjectsPerFrame];
+  for (uint32_t frame = 0; frame < kFrames; ++frame) {
+    for (uint32_t i = 0; i < kObjectsPerFrame; ++i) {
+      fences[i] = pool.acquireFence();
+      semaphores[i] = pool.acquireSemaphore();
+    }
+    for (uint32_t i = 0; i < kObjectsPerFrame; ++i) {
+      pool.releaseFence(fences[i]);
+      pool.releaseSemaphore(semaphores[i]);
+    }
+  }
+}
+
+template <typename Function>
+void measure(char const* name, uint32_t threadCount, Function&& function) {
+  createCount = 0;
+  VolkBenchTimer timer;
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < threadCount; ++i) {
+    threads.emplace_back(function);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  double seconds = timer.getSeconds();
+  double objects = double(threadCount) * kFrames * kObjectsPerFrame * 2;
+  printf("%-16s threads %2u: %10.0f objects/s, %llu created\n", name, threadCount, objects / seconds,
+         static_cast<unsigned long long>(createCount.load()));
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreateFence = createFence;
+  volk.vkCreateSemaphore = createSemaphore;
+  volk.vkCreateEvent = createEvent;
+  volk.vkDestroyFence = destroyFence;
+  volk.vkDestroySemaphore = destroySemaphore;
+  volk.vkDestroyEvent = destroyEvent;
+  volk.vkResetFences = resetFences;
+  volk.vkResetEvent = resetEvent;
+
+  printf("%u frames of %u fences and %u semaphores per thread, create %lld us, destroy %lld us, reset %lld us\n",
+         kFrames, kObjectsPerFrame, kObjectsPerFrame, static_cast<long long>(kCreateTime.count()),
+         static_cast<long long>(kDestroyTime.count()), static_cast<long long>(kResetTime.count()));
+  uint32_t maxThreads = std::max(1u, std::thread::hardware_concurrency());
+  for (uint32_t threads = 1; threads <= maxThreads; threads *= 2) {
+    measure("create/destroy", threads, [&volk] { runCreateDestroy(volk); });
+    VolkSyncPool pool(volk, VK_NULL_HANDLE);
+    measure("VolkSyncPool", threads, [&pool] { runPool(pool); });
+  }
+  return 0;
+}
@@ -0,0 +1,209 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_bench.hpp"
+#include "volk_upload_queue.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Upload throughput of VolkUploadQueue for several upload sizes, against a plain memcpy of the same data into a
+// host buffer. The driver spends a fixed CPU time per submission and the transfer queue completes a batch as soon as
+// it is submitted, so the numbers show the staging and batching cost of the helper. Each size is also uploaded by
+// several producer threads sharing one queue, which shows the contention on its lock.
+
+namespace {
+
+constexpr VkDeviceSize kRingSize = VolkUploadQueue::kDefaultRingSize;
+constexpr uint64_t kBytesPerRun = 1ull << 30;
+constexpr std::chrono::microseconds kSubmitTime(20);
+
+std::vector<uint8_t> ringMemory;
+VkDeviceSize lastBufferSize = 0;
+std::atomic<uint64_t> nextHandle = 1;
+std::atomic<uint64_t> submittedValue = 0;
+
+template <typename Handle>
+Handle makeHandle() {
+  return reinterpret_cast<Handle>(static_cast<uintptr_t>(nextHandle++));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createBuffer(VkDevice, const VkBufferCreateInfo* pCreateInfo,
+                                            const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+  lastBufferSize = pCreateInfo->size;
+  *pBuffer = makeHandle<VkBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements(VkDevice, VkBuffer, VkMemoryRequirements* pRequirements) {
+  pRequirements->size = lastBufferSize;
+  pRequirements->alignment = 256;
+  pRequirements->memoryTypeBits = 1;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties* pProperties) {
+  *pProperties = {};
+  pProperties->memoryTypeCount = 1;
+  pProperties->memoryTypes[0].propertyFlags =
+    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo* pAllocateInfo,
+                                              const VkAllocationCallbacks*, VkDeviceMemory* pMemory) {
+  ringMemory.assign(static_cast<size_t>(pAllocateInfo->allocationSize), 0);
+  *pMemory = makeHandle<VkDeviceMemory>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory(VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL mapMemory(VkDevice, VkDeviceMemory, VkDeviceSize, VkDeviceSize, VkMemoryMapFlags,
+                                         void** ppData) {
+  *ppData = ringMemory.data();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createCommandPool(VkDevice, const VkCommandPoolCreateInfo*,
+                                                 const VkAllocationCallbacks*, VkCommandPool* pCommandPool) {
+  *pCommandPool = makeHandle<VkCommandPool>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*,
+                                               VkSemaphore* pSemaphore) {
+  *pSemaphore = makeHandle<VkSemaphore>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL freeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroyCommandPool(VkDevice, VkCommandPool, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo*,
+                                                      VkCommandBuffer* pCommandBuffers) {
+  *pCommandBuffers = makeHandle<VkCommandBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer(VkCommandBuffer, VkCommandBufferResetFlags) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer(VkCommandBuffer, const VkCommandBufferBeginInfo*) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL endCommandBuffer(VkCommandBuffer) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer(VkCommandBuffer, VkBuffer, VkBuffer, uint32_t, const VkBufferCopy*) {}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer, const VkDependencyInfo*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL queueSubmit2(VkQueue, uint32_t, const VkSubmitInfo2* pSubmits, VkFence) {
+  VolkBenchTimer::spin(kSubmitTime);
+  submittedValue = pSubmits->pSignalSemaphoreInfos->value;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreCounterValue(VkDevice, VkSemaphore, uint64_t* pValue) {
+  *pValue = submittedValue;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores(VkDevice, const VkSemaphoreWaitInfo*, uint64_t) {
+  return VK_SUCCESS;
+}
+
+void report(char const* name, uint32_t threadCount, VkDeviceSize uploadSize, double seconds, uint64_t batches) {
+  printf("%-16s threads %2u upload %9llu bytes: %8.0f MB/s, %llu batches\n", name, threadCount,
+         static_cast<unsigned long long>(uploadSize), double(kBytesPerRun) / seconds / 1e6,
+         static_cast<unsigned long long>(batches));
+}
+
+void measureMemcpy(const std::vector<uint8_t>& data, VkDeviceSize uploadSize) {
+  std::vector<uint8_t> destination(static_cast<size_t>(kRingSize));
+  VolkBenchTimer timer;
+  VkDeviceSize offset = 0;
+  for (uint64_t done = 0; done < kBytesPerRun; done += uploadSize) {
+    if (offset + uploadSize > kRingSize) {
+      offset = 0;
+    }
+    std::memcpy(destination.data() + offset, data.data(), static_cast<size_t>(uploadSize));
+    offset += uploadSize;
+  }
+  auto const seconds = timer.getSeconds();
+  volatile uint8_t sink = destination[static_cast<size_t>(offset - 1)];
+  (void)sink;
+  report("memcpy", 1, uploadSize, seconds, 0);
+}
+
+void measureUploadQueue(Volk& volk, const std::vector<uint8_t>& data, VkDeviceSize uploadSize, uint32_t threadCount) {
+  VolkUploadQueue queue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0, kRingSize);
+  auto const buffer = makeHandle<VkBuffer>();
+  VolkBenchTimer timer;
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < threadCount; ++i) {
+    threads.emplace_back([&] {
+      for (uint64_t done = 0; done < kBytesPerRun / threadCount; done += uploadSize) {
+        (void)queue.uploadBuffer(buffer, 0, data.data(), uploadSize);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  (void)queue.flush();
+  auto const seconds = timer.getSeconds();
+  report("VolkUploadQueue", threadCount, uploadSize, seconds, queue.getStats().batches);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreateBuffer = createBuffer;
+  volk.vkGetBufferMemoryRequirements = getBufferMemoryRequirements;
+  volk.vkGetPhysicalDeviceMemoryProperties = getPhysicalDeviceMemoryProperties;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkBindBufferMemory = bindBufferMemory;
+  volk.vkMapMemory = mapMemory;
+  volk.vkCreateCommandPool = createCommandPool;
+  volk.vkCreateSemaphore = createSemaphore;
+  volk.vkDestroyBuffer = destroyBuffer;
+  volk.vkFreeMemory = freeMemory;
+  volk.vkDestroyCommandPool = destroyCommandPool;
+  volk.vkDestroySemaphore = destroySemaphore;
+  volk.vkAllocateCommandBuffers = allocateCommandBuffers;
+  volk.vkResetCommandBuffer = resetCommandBuffer;
+  volk.vkBeginCommandBuffer = beginCommandBuffer;
+  volk.vkEndCommandBuffer = endCommandBuffer;
+  volk.vkCmdCopyBuffer = cmdCopyBuffer;
+  volk.vkCmdPipelineBarrier2 = cmdPipelineBarrier2;
+  volk.vkQueueSubmit2 = queueSubmit2;
+  volk.vkGetSemaphoreCounterValue = getSemaphoreCounterValue;
+  volk.vkWaitSemaphores = waitSemaphores;
+
+  printf("%llu MiB per run through a %llu MiB ring, submit %lld us\n",
+         static_cast<unsigned long long>(kBytesPerRun >> 20), static_cast<unsigned long long>(kRingSize >> 20),
+         static_cast<long long>(kSubmitTime.count()));
+  // At least four producers, so the lock is contended even when they have to share cores.
+  uint32_t maxThreads = std::max(4u, std::thread::hardware_concurrency());
+  for (VkDeviceSize uploadSize : {VkDeviceSize(4) << 10, VkDeviceSize(64) << 10, VkDeviceSize(1) << 20,
+                                  VkDeviceSize(16) << 20}) {
+    std::vector<uint8_t> data(static_cast<size_t>(uploadSize), 0x5a);
+    measureMemcpy(data, uploadSize);
+    for (uint32_t threads = 1; threads <= maxThreads; threads *= 2) {
+      measureUploadQueue(volk, data, uploadSize, threads);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,26 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include <chrono>
+
+/**
+ * Wall clock timer of the benchmarks.
+ */
+class VolkBenchTimer final {
+public:
+  [[nodiscard]] double getSeconds() const noexcept {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+  }
+
+  /**
+   * Busy-wait, standing in for the CPU time a driver spends in a call.
+   */
+  static void spin(std::chrono::microseconds duration) noexcept {
+    auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+  }
+
+private:
+  std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now();
+};
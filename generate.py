@@ -14,6 +14,39 @@ cmdversions = {
   "vkCmdSetExclusiveScissorEnableNV": 2
 }
 
+# Members of VulkanMemoryAllocator's VmaVulkanFunctions; VMA names them after the commands it calls.
+vmafunctions = [
+  "vkGetInstanceProcAddr",
+  "vkGetDeviceProcAddr",
+  "vkGetPhysicalDeviceProperties",
+  "vkGetPhysicalDeviceMemoryProperties",
+  "vkAllocateMemory",
+  "vkFreeMemory",
+  "vkMapMemory",
+  "vkUnmapMemory",
+  "vkFlushMappedMemoryRanges",
+  "vkInvalidateMappedMemoryRanges",
+  "vkBindBufferMemory",
+  "vkBindImageMemory",
+  "vkGetBufferMemoryRequirements",
+  "vkGetImageMemoryRequirements",
+  "vkCreateBuffer",
+  "vkDestroyBuffer",
+  "vkCreateImage",
+  "vkDestroyImage",
+  "vkCmdCopyBuffer",
+  "vkGetBufferMemoryRequirements2KHR",
+  "vkGetImageMemoryRequirements2KHR",
+  "vkBindBufferMemory2KHR",
+  "vkBindImageMemory2KHR",
+  "vkGetPhysicalDeviceMemoryProperties2KHR",
+  "vkGetDeviceBufferMemoryRequirements",
+  "vkGetDeviceImageMemoryRequirements",
+  "vkGetMemoryWin32HandleKHR"
+]
+
+# Commands recorded by VolkDeferredCommands; their parameters must be values, fixed-size arrays or arrays with a len
+# attribute whose element structures have no pointers except pNext.
 def parse_xml(path):
   file = urllib.request.urlopen(path) if path.startswith("http") else open(path, 'r')
   with file:
@@ -45,6 +78,311 @@ def patch_file(path, blocks):
     for line in result:
       file.write(line)
 
+def generate_vma_functions(command_groups, command_aliases):
+  # command_aliases maps a command to the promoted command it aliases. A VMA member gets the promoted command if it
+  # is loaded and one of its aliases otherwise.
+  command_to_group = {}
+  for (group, cmdnames) in command_groups.items():
+    for name in cmdnames:
+      command_to_group[name] = group
+
+  block = ''
+  for member in vmafunctions:
+    core = command_aliases.get(member, member)
+    candidates = [core] + sorted([name for (name, alias) in command_aliases.items() if alias == core])
+    candidates = [name for name in candidates if name in command_to_group]
+    if not candidates:
+      continue
+
+    block += '  if constexpr (requires { functions.' + member + '; }) {\n'
+    if len(candidates) > 1:
+      block += '    functions.' + member + ' = nullptr;\n'
+    for (index, name) in enumerate(candidates):
+      group = command_to_group[name]
+      block += '#if ' + group + '\n'
+      if index == 0:
+        block += '    functions.' + member + ' = ' + name + ';\n'
+      else:
+        block += '    if (!functions.' + member + ') {\n'
+        block += '      functions.' + member + ' = ' + name + ';\n'
+        block += '    }\n'
+      block += '#endif /* ' + group + ' */\n'
+    block += '  }\n'
+  return block
+
+def generate_table_blocks(command_groups):
+  # VolkCppTable (volk_export.h) mirrors the function pointer members of Volk: commands which aren't compiled in are
+  # replaced with padding, so that its layout only depends on the header version.
+  blocks = {'EXPORT_FUNCTION_POINTERS': '', 'EXPORT_TABLE': '', 'IMPORT_TABLE': ''}
+  padding = 0
+  for (group, cmdnames) in command_groups.items():
+    if not cmdnames:
+      continue
+    for key in blocks:
+      blocks[key] += '#if ' + group + '\n'
+    for name in sorted(cmdnames):
+      blocks['EXPORT_FUNCTION_POINTERS'] += '  PFN_' + name + ' ' + name + ';\n'
+      blocks['EXPORT_TABLE'] += '  pTable->' + name + ' = ' + name + ';\n'
+      blocks['IMPORT_TABLE'] += '  ' + name + ' = table.' + name + ';\n'
+    blocks['EXPORT_FUNCTION_POINTERS'] += '#else\n'
+    if len(cmdnames) == 1:
+      blocks['EXPORT_FUNCTION_POINTERS'] += f'  PFN_vkVoidFunction padding{padding};\n'
+    else:
+      blocks['EXPORT_FUNCTION_POINTERS'] += f'  PFN_vkVoidFunction padding{padding}[{len(cmdnames)}];\n'
+    padding += 1
+    for key in blocks:
+      blocks[key] += '#endif /* ' + group + ' */\n'
+  return blocks
+
+def wrap_call(prefix, args, suffix, indent):
+  # Break argument lists after a comma so that lines stay within 120 columns, aligning with the opening parenthesis.
+  lines = [indent + prefix + '(']
+  align = ' ' * len(lines[0])
+  for (index, arg) in enumerate(args):
+    text = arg + (', ' if index + 1 < len(args) else ')' + suffix)
+    if len(lines[-1]) + len(text.rstrip()) > 120 and not lines[-1].endswith('('):
+      lines[-1] = lines[-1].rstrip()
+      lines.append(align)
+    lines[-1] += text
+  return '\n'.join(lines) + '\n'
+
+def member_decl(node):
+  # Declaration text of a <param> or <member>, without its <comment>
+  parts = [node.text or '']
+  for child in node:
+    if child.tag != 'comment':
+      parts.append(''.join(child.itertext()))
+    parts.append(child.tail or '')
+  return ' '.join(''.join(parts).split())
+
+def generate_deferred_blocks(command_groups, feature_groups, commands, structs, type_versions):
+  # VolkDeferredCommands records every command of a Vulkan version whose parameters it can copy into its stream: value
+  # parameters are stored in a per-command structure, arrays and single structures are copied, deeply for structures
+  # with pointer members or a pNext chain. Chains are copied with a switch over the sType of the core structures that
+  # extend a recorded structure. Pointers without a length, or whose validity depends on other members, can't be
+  # copied, and commands which need them aren't recorded.
+  blocks = {'DEFERRED_DECLARATIONS': '', 'DEFERRED_COPY_DECLARATIONS': '', 'DEFERRED_OPS': '', 'DEFERRED_STRUCTS': '',
+            'DEFERRED_COPY': '', 'DEFERRED_RECORD': '', 'DEFERRED_REPLAY': ''}
+  copies = OrderedDict() # structure name -> statements of its copyMembers(), None if it can't be copied
+
+  def copy_pointer(owner, node, decl, siblings):
+    # Call copying the array or single structure a const pointer refers to, as (function, arguments), or None
+    name = node.findtext('name')
+    type = node.findtext('type')
+    if not decl.startswith('const ') or decl.count('*') != 1:
+      return None
+    # Arrays sharing a length without validity checks are alternatives, only one of which may be valid (e.g. the
+    # descriptor infos of VkWriteDescriptorSet).
+    if node.get('noautovalidity') == 'true' and any(other is not node and other.get('len') == node.get('len') and
+                                                    other.get('noautovalidity') == 'true' for other in siblings):
+      return None
+    length = node.get('len')
+    if length:
+      length = length.split(',')[0]
+      if not re.fullmatch(r'[A-Za-z_]\w*', length):
+        return None
+      count = owner + length
+    else:
+      count = owner + name + ' ? 1 : 0'
+    if type == 'void':
+      if not length:
+        return None
+      return ('copy', ['static_cast<const uint8_t*>(' + owner + name + ')', 'static_cast<size_t>(' + count + ')'])
+    if type in structs:
+      statements = struct_copies(type)
+      if statements is None:
+        return None
+      return ('copyStructs' if statements else 'copy', [owner + name, count])
+    return ('copy', [owner + name, count])
+
+  def struct_copies(name):
+    if name in copies:
+      return copies[name]
+    copies[name] = []
+    statements = []
+    members = structs[name].findall('member')
+    members = [member for member in members if 'vulkan' in member.get('api', 'vulkan').split(',')]
+    for member in members:
+      mname = member.findtext('name')
+      mtype = member.findtext('type')
+      decl = member_decl(member)
+      if mname == 'pNext':
+        statements.append('  value.pNext = copyChain(value.pNext);\n')
+      elif '*' in decl:
+        call = copy_pointer('value.', member, decl, members)
+        if call is None:
+          statements = None
+          break
+        statements.append(wrap_call('value.' + mname + ' = ' + call[0], call[1], ';', '  '))
+      elif mtype in structs:
+        nested = struct_copies(mtype)
+        if nested is None or (nested and '[' in decl):
+          statements = None
+          break
+        if nested:
+          statements.append('  copyMembers(value.' + mname + ');\n')
+    copies[name] = statements
+    return statements
+
+  for (group, cmdnames) in command_groups.items():
+    if group not in feature_groups:
+      continue
+    for key in ('DEFERRED_DECLARATIONS', 'DEFERRED_OPS', 'DEFERRED_STRUCTS', 'DEFERRED_RECORD', 'DEFERRED_REPLAY'):
+      blocks[key] += '#if ' + group + '\n'
+    for name in sorted(cmdnames):
+      if not name.startswith('vkCmd'):
+        continue
+      op = name[len('vkCmd'):]
+      params = [param for param in commands[name].findall('param') if 'vulkan' in param.get('api', 'vulkan').split(',')]
+      decls = [member_decl(param) for param in params]
+      fields = []
+      assigns = []
+      for (param, decl) in zip(params[1:], decls[1:]):
+        pname = param.findtext('name')
+        if '*' not in decl:
+          fields.append(decl.replace('const ', ''))
+          if '[' in decl:
+            assigns.append('    std::memcpy(cmd->' + pname + ', ' + pname + ', sizeof(cmd->' + pname + '));\n')
+          else:
+            assigns.append('    cmd->' + pname + ' = ' + pname + ';\n')
+          continue
+        call = copy_pointer('', param, decl, params)
+        if call is None:
+          fields = None
+          break
+        fields.append(decl)
+        assigns.append(wrap_call('cmd->' + pname + ' = ' + call[0], call[1], ';', '    '))
+      if fields is None:
+        continue
+
+      blocks['DEFERRED_DECLARATIONS'] += wrap_call('void ' + name, decls, ' noexcept;', '  ')
+      blocks['DEFERRED_OPS'] += '  ' + op + ',\n'
+
+      # The command buffer parameter is ignored while recording.
+      record = 'void VolkDeferredCommands::' + name
+      blocks['DEFERRED_RECORD'] += wrap_call(record, [decls[0].split()[0]] + decls[1:], ' noexcept {', '')
+      if not fields:
+        blocks['DEFERRED_RECORD'] += '  (void)allocate(Op::' + op + ', 0);\n}\n\n'
+        blocks['DEFERRED_REPLAY'] += '      case Op::' + op + ':\n'
+        blocks['DEFERRED_REPLAY'] += '        volk.' + name + '(commandBuffer);\n'
+        blocks['DEFERRED_REPLAY'] += '        break;\n'
+        continue
+
+      blocks['DEFERRED_STRUCTS'] += 'struct ' + op + 'Cmd {\n'
+      blocks['DEFERRED_STRUCTS'] += ''.join(['  ' + field + ';\n' for field in fields])
+      blocks['DEFERRED_STRUCTS'] += '};\n\n'
+
+      blocks['DEFERRED_RECORD'] += '  if (auto* cmd = push<' + op + 'Cmd>(Op::' + op + ')) {\n'
+      blocks['DEFERRED_RECORD'] += ''.join(assigns)
+      blocks['DEFERRED_RECORD'] += '  }\n}\n\n'
+
+      args = ['commandBuffer'] + ['cmd->' + param.findtext('name') for param in params[1:]]
+      blocks['DEFERRED_REPLAY'] += '      case Op::' + op + ': {\n'
+      blocks['DEFERRED_REPLAY'] += '        auto const* cmd = static_cast<const ' + op + 'Cmd*>(payload);\n'
+      blocks['DEFERRED_REPLAY'] += wrap_call('volk.' + name, args, ';', '        ')
+      blocks['DEFERRED_REPLAY'] += '        break;\n'
+      blocks['DEFERRED_REPLAY'] += '      }\n'
+    for key in ('DEFERRED_DECLARATIONS', 'DEFERRED_OPS', 'DEFERRED_STRUCTS', 'DEFERRED_RECORD', 'DEFERRED_REPLAY'):
+      if blocks[key].endswith('#if ' + group + '\n'):
+        blocks[key] = blocks[key][:-len('#if ' + group + '\n')]
+        continue
+      if blocks[key].endswith('\n\n'):
+        blocks[key] = blocks[key][:-1]
+      blocks[key] += '#endif /* ' + group + ' */\n'
+
+  # Core structures which may be chained to a recorded structure, until no new ones are found
+  extensions = []
+  while True:
+    found = [name for (name, struct) in sorted(structs.items()) if name not in extensions and name in type_versions and
+             not struct.get('returnedonly') and any(copies.get(base) is not None
+                                                     for base in struct.get('structextends', '').split(',') if base)]
+    found = [name for name in found if struct_copies(name) is not None]
+    if not found:
+      break
+    extensions += found
+
+  versions = OrderedDict()
+  for name in sorted(copies):
+    if copies[name]:
+      versions.setdefault(type_versions[name], []).append(name)
+  for (version, names) in sorted(versions.items(), key=lambda item: list(command_groups).index(item[0])):
+    blocks['DEFERRED_COPY_DECLARATIONS'] += '#if ' + version + '\n'
+    blocks['DEFERRED_COPY'] += '#if ' + version + '\n'
+    for name in names:
+      blocks['DEFERRED_COPY_DECLARATIONS'] += '  void copyMembers(' + name + '& value) noexcept;\n'
+      blocks['DEFERRED_COPY'] += 'void VolkDeferredCommands::copyMembers(' + name + '& value) noexcept {\n'
+      blocks['DEFERRED_COPY'] += ''.join(copies[name])
+      blocks['DEFERRED_COPY'] += '}\n\n'
+    blocks['DEFERRED_COPY_DECLARATIONS'] += '#endif /* ' + version + ' */\n'
+    blocks['DEFERRED_COPY'] = blocks['DEFERRED_COPY'][:-1] + '#endif /* ' + version + ' */\n\n'
+
+  copyextension = 'const void* VolkDeferredCommands::copyExtension'
+  blocks['DEFERRED_COPY'] += copyextension + '(const VkBaseInStructure* pNext) noexcept {\n'
+  blocks['DEFERRED_COPY'] += '  switch (pNext->sType) {\n'
+  for name in sorted(extensions, key=lambda name: (list(command_groups).index(type_versions[name]), name)):
+    stype = structs[name].find('member[name="sType"]').get('values')
+    blocks['DEFERRED_COPY'] += '#if ' + type_versions[name] + '\n'
+    blocks['DEFERRED_COPY'] += '  case ' + stype + ':\n'
+    blocks['DEFERRED_COPY'] += '    return copyStructs(reinterpret_cast<const ' + name + '*>(pNext), 1);\n'
+    blocks['DEFERRED_COPY'] += '#endif /* ' + type_versions[name] + ' */\n'
+  blocks['DEFERRED_COPY'] += '  default:\n'
+  blocks['DEFERRED_COPY'] += '    return nullptr;\n'
+  blocks['DEFERRED_COPY'] += '  }\n'
+  blocks['DEFERRED_COPY'] += '}\n'
+  return blocks
+
+def generate_tracked_blocks(command_groups, commands, types, core_objtypes):
+  # VolkObjectTracker forwards every device command with the (device, create info, allocator, handle) shape of a
+  # create command or the (device, handle, allocator) shape of a destroy command. Commands which create several objects
+  # at once or allocate from a pool are hand-written. Object types outside the 1.0 range get stable counter indices.
+  blocks = {'TRACKED_TYPE_COUNT': '', 'TRACKED_DECLARATIONS': '', 'TRACKED_DEFINITIONS': '', 'TRACKED_TYPES': ''}
+  type_groups = OrderedDict()
+
+  def handle_objtype(name):
+    type = types.get(name)
+    return type.get('objtypeenum') if type is not None and type.get('category') == 'handle' else None
+
+  for (group, cmdnames) in command_groups.items():
+    declarations = ''
+    definitions = ''
+    for name in sorted(cmdnames):
+      params = [param for param in commands[name].findall('param') if 'vulkan' in param.get('api', 'vulkan').split(',')]
+      decls = [' '.join(''.join(param.itertext()).split()) for param in params]
+      ptypes = [param.findtext('type') for param in params]
+      if not ptypes or ptypes[0] != 'VkDevice':
+        continue
+      if (name.startswith('vkCreate') or name.startswith('vkAllocate')) and len(params) == 4 and \
+         decls[1].startswith('const ') and decls[1].count('*') == 1 and ptypes[2] == 'VkAllocationCallbacks' and \
+         decls[3].count('*') == 1 and not decls[3].startswith('const ') and handle_objtype(ptypes[3]):
+        (handle, objtype) = (ptypes[3], handle_objtype(ptypes[3]))
+        declarations += wrap_call('  VOLK_CPP_DECLARE_TRACKED_CREATE', [handle, name, ptypes[1]], '', '')
+        definitions += wrap_call('VOLK_CPP_DEFINE_TRACKED_CREATE', [handle, objtype, name, ptypes[1]], '', '')
+      elif (name.startswith('vkDestroy') or name.startswith('vkFree')) and len(params) == 3 and \
+           '*' not in decls[1] and ptypes[2] == 'VkAllocationCallbacks' and handle_objtype(ptypes[1]):
+        (handle, objtype) = (ptypes[1], handle_objtype(ptypes[1]))
+        declarations += wrap_call('  VOLK_CPP_DECLARE_TRACKED_DESTROY', [handle, name], '', '')
+        definitions += wrap_call('VOLK_CPP_DEFINE_TRACKED_DESTROY', [handle, objtype, name], '', '')
+      else:
+        continue
+      if objtype not in core_objtypes:
+        type_groups.setdefault(objtype, [])
+        if group not in type_groups[objtype]:
+          type_groups[objtype].append(group)
+    if declarations:
+      blocks['TRACKED_DECLARATIONS'] += '#if ' + group + '\n' + declarations + '#endif /* ' + group + ' */\n'
+      blocks['TRACKED_DEFINITIONS'] += '#if ' + group + '\n' + definitions + '#endif /* ' + group + ' */\n'
+
+  for (index, (objtype, groups)) in enumerate(type_groups.items()):
+    key = ' || '.join(['(' + g + ')' if len(groups) > 1 and ('&&' in g or '||' in g) else g for g in groups])
+    blocks['TRACKED_TYPES'] += '#if ' + key + '\n'
+    blocks['TRACKED_TYPES'] += '  case ' + objtype + ':\n'
+    blocks['TRACKED_TYPES'] += '    return VK_OBJECT_TYPE_COMMAND_POOL + ' + str(index + 1) + ';\n'
+    blocks['TRACKED_TYPES'] += '#endif\n'
+  # Core 1.0 types, the types above and one counter for all other types.
+  count = len(core_objtypes) + len(type_groups) + 1
+  blocks['TRACKED_TYPE_COUNT'] = '  static constexpr uint32_t kTypeCount = ' + str(count) + ';\n'
+  return blocks
+
 def is_descendant_type(types, name, base):
   if name == base:
     return True
@@ -80,6 +418,8 @@ if __name__ == "__main__":
 
   command_groups = OrderedDict()
   instance_commands = set()
+  feature_groups = set()
+  type_versions = {}
 
   for feature in spec.findall('feature'):
     api = feature.get('api')
@@ -88,6 +428,9 @@ if __name__ == "__main__":
     key = defined(feature.get('name'))
     cmdrefs = feature.findall('require/command')
     command_groups[key] = [cmdref.get('name') for cmdref in cmdrefs]
+    feature_groups.add(key)
+    for typeref in feature.findall('require/type'):
+      type_versions.setdefault(typeref.get('name'), key)
 
   for ext in sorted(spec.findall('extensions/extension'), key=lambda ext: ext.get('name')):
     supported = ext.get('supported')
@@ -139,17 +482,23 @@ if __name__ == "__main__":
       name = cmd.findtext('proto/name')
       commands[name] = cmd
 
+  command_aliases = {}
+
   for cmd in spec.findall('commands/command'):
     if cmd.get('alias'):
       name = cmd.get('name')
       commands[name] = commands[cmd.get('alias')]
+      command_aliases[name] = cmd.get('alias')
 
   types = {}
+  structs = {}
 
   for type in spec.findall('types/type'):
     name = type.findtext('name')
     if name:
       types[name] = type
+    if type.get('category') in ('struct', 'union') and not type.get('alias'):
+      structs[type.get('name')] = type
 
   for key in block_keys:
     blocks[key] = ''
@@ -193,8 +542,21 @@ if __name__ == "__main__":
       else:
         blocks[key] += '#endif /* ' + group + ' */\n'
 
+  blocks['VMA_FUNCTIONS'] = generate_vma_functions(command_groups, command_aliases)
+  blocks.update(generate_table_blocks(command_groups))
+  blocks.update(generate_deferred_blocks(command_groups, feature_groups, commands, structs, type_versions))
+
+  # VkObjectType values defined by Vulkan 1.0 have a value attribute; later ones extend the enum.
+  core_objtypes = [enum.get('name') for enum in spec.findall('enums[@name="VkObjectType"]/enum') if enum.get('value')]
+  blocks.update(generate_tracked_blocks(command_groups, commands, types, core_objtypes))
+
   patch_file('volk.hpp', blocks)
   patch_file('volk.cpp', blocks)
+  patch_file('volk_export.h', blocks)
+  patch_file('volk_deferred_commands.hpp', blocks)
+  patch_file('volk_deferred_commands.cpp', blocks)
+  patch_file('volk_object_tracker.hpp', blocks)
+  patch_file('volk_object_tracker.cpp', blocks)
   patch_file('CMakeLists.txt', blocks)
 
   print(version.find('name').tail.strip())
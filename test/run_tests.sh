@@ -83,5 +83,17 @@ run_volk_cpp_test
 popd
 popd
 
+echo
+echo "unit =======================================>"
+echo 
+
+pushd test/unit
+reset_build
+pushd _build
+cmake .. || exit 1
+cmake --build . --config Debug || exit 1
+ctest --output-on-failure -C Debug || exit 1
+popd
 popd
 
+popd
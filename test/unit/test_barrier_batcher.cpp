@@ -0,0 +1,339 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_barrier_batcher.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_BASE_VERSION_1_3)
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+struct Call {
+  VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+  std::vector<VkMemoryBarrier2> memoryBarriers;
+  std::vector<VkBufferMemoryBarrier2> bufferBarriers;
+  std::vector<VkImageMemoryBarrier2> imageBarriers;
+};
+
+struct LegacyCall {
+  VkPipelineStageFlags srcStageMask = 0;
+  VkPipelineStageFlags dstStageMask = 0;
+  uint32_t memoryBarrierCount = 0;
+  VkMemoryBarrier memoryBarrier = {};
+  std::vector<VkImageMemoryBarrier> imageBarriers;
+};
+
+std::vector<Call> calls;
+std::vector<LegacyCall> legacyCalls;
+
+VkCommandBuffer commandBuffer(uintptr_t value) {
+  return reinterpret_cast<VkCommandBuffer>(value);
+}
+
+template <typename T>
+T handle(uint64_t value) {
+  return reinterpret_cast<T>(static_cast<uintptr_t>(value));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) {
+  auto const& info = *pDependencyInfo;
+  Call call;
+  call.commandBuffer = commandBuffer;
+  call.memoryBarriers.assign(info.pMemoryBarriers, info.pMemoryBarriers + info.memoryBarrierCount);
+  call.bufferBarriers.assign(info.pBufferMemoryBarriers, info.pBufferMemoryBarriers + info.bufferMemoryBarrierCount);
+  call.imageBarriers.assign(info.pImageMemoryBarriers, info.pImageMemoryBarriers + info.imageMemoryBarrierCount);
+  calls.push_back(call);
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier(VkCommandBuffer, VkPipelineStageFlags srcStageMask,
+                                              VkPipelineStageFlags dstStageMask, VkDependencyFlags,
+                                              uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                                              uint32_t, const VkBufferMemoryBarrier*, uint32_t imageMemoryBarrierCount,
+                                              const VkImageMemoryBarrier* pImageMemoryBarriers) {
+  LegacyCall call;
+  call.srcStageMask = srcStageMask;
+  call.dstStageMask = dstStageMask;
+  call.memoryBarrierCount = memoryBarrierCount;
+  if (memoryBarrierCount != 0) {
+    call.memoryBarrier = pMemoryBarriers[0];
+  }
+  call.imageBarriers.assign(pImageMemoryBarriers, pImageMemoryBarriers + imageMemoryBarrierCount);
+  legacyCalls.push_back(call);
+}
+
+VkMemoryBarrier2 memoryBarrier(VkPipelineStageFlags2 srcStageMask, VkAccessFlags2 srcAccessMask,
+                               VkPipelineStageFlags2 dstStageMask, VkAccessFlags2 dstAccessMask) {
+  VkMemoryBarrier2 barrier = {};
+  barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+  barrier.srcStageMask = srcStageMask;
+  barrier.srcAccessMask = srcAccessMask;
+  barrier.dstStageMask = dstStageMask;
+  barrier.dstAccessMask = dstAccessMask;
+  return barrier;
+}
+
+VkBufferMemoryBarrier2 bufferBarrier(uint64_t buffer, VkDeviceSize offset, VkDeviceSize size) {
+  VkBufferMemoryBarrier2 barrier = {};
+  barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+  barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+  barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+  barrier.dstStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+  barrier.dstAccessMask = VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+  barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.buffer = handle<VkBuffer>(buffer);
+  barrier.offset = offset;
+  barrier.size = size;
+  return barrier;
+}
+
+VkImageMemoryBarrier2 imageBarrier(uint64_t image, VkImageLayout oldLayout, VkImageLayout newLayout) {
+  VkImageMemoryBarrier2 barrier = {};
+  barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+  barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+  barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+  barrier.dstStageMask = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+  barrier.dstAccessMask = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT;
+  barrier.oldLayout = oldLayout;
+  barrier.newLayout = newLayout;
+  barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+  barrier.image = handle<VkImage>(image);
+  barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+  return barrier;
+}
+
+VkDependencyInfo dependencyInfo(const VkMemoryBarrier2* memoryBarrier, const VkBufferMemoryBarrier2* bufferBarrier,
+                                const VkImageMemoryBarrier2* imageBarrier) {
+  VkDependencyInfo info = {};
+  info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+  info.memoryBarrierCount = memoryBarrier ? 1 : 0;
+  info.pMemoryBarriers = memoryBarrier;
+  info.bufferMemoryBarrierCount = bufferBarrier ? 1 : 0;
+  info.pBufferMemoryBarriers = bufferBarrier;
+  info.imageMemoryBarrierCount = imageBarrier ? 1 : 0;
+  info.pImageMemoryBarriers = imageBarrier;
+  return info;
+}
+
+void testMerging(Volk& volk) {
+  calls.clear();
+  VolkBarrierBatcher batcher(volk);
+  VOLK_TEST_CHECK(batcher.getStatus() == VK_SUCCESS);
+  auto const cb = commandBuffer(1);
+
+  auto const first = memoryBarrier(VK_PIPELINE_STAGE_2_COPY_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT,
+                                   VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+  auto const second = memoryBarrier(VK_PIPELINE_STAGE_2_HOST_BIT, VK_ACCESS_2_MEMORY_WRITE_BIT,
+                                    VK_PIPELINE_STAGE_2_COPY_BIT, VK_ACCESS_2_TRANSFER_READ_BIT);
+  auto const buffer = bufferBarrier(10, 0, 256);
+  auto const otherBuffer = bufferBarrier(11, 0, 256);
+  auto image = imageBarrier(20, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+  auto const sameImage = image;
+  image.dstStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+  image.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT;
+
+  auto info = dependencyInfo(&first, &buffer, &image);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  info = dependencyInfo(&second, &buffer, &sameImage);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  info = dependencyInfo(nullptr, &otherBuffer, nullptr);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  VOLK_TEST_CHECK(calls.empty());
+
+  batcher.flush();
+  batcher.flush(); // nothing pending
+  VOLK_TEST_CHECK(calls.size() == 1);
+  if (calls.size() == 1) {
+    auto const& call = calls[0];
+    VOLK_TEST_CHECK(call.commandBuffer == cb);
+    VOLK_TEST_CHECK(call.memoryBarriers.size() == 1);
+    VOLK_TEST_CHECK(call.bufferBarriers.size() == 2);
+    VOLK_TEST_CHECK(call.imageBarriers.size() == 1);
+    if (call.memoryBarriers.size() == 1) {
+      VOLK_TEST_CHECK(call.memoryBarriers[0].srcStageMask ==
+                      (VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_HOST_BIT));
+      VOLK_TEST_CHECK(call.memoryBarriers[0].srcAccessMask ==
+                      (VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT));
+      VOLK_TEST_CHECK(call.memoryBarriers[0].dstStageMask ==
+                      (VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_2_COPY_BIT));
+      VOLK_TEST_CHECK(call.memoryBarriers[0].dstAccessMask ==
+                      (VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_TRANSFER_READ_BIT));
+    }
+    if (call.bufferBarriers.size() == 2) {
+      VOLK_TEST_CHECK(call.bufferBarriers[0].buffer == buffer.buffer);
+      VOLK_TEST_CHECK(call.bufferBarriers[1].buffer == otherBuffer.buffer);
+    }
+    if (call.imageBarriers.size() == 1) {
+      VOLK_TEST_CHECK(call.imageBarriers[0].dstStageMask ==
+                      (VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_2_COPY_BIT));
+      VOLK_TEST_CHECK(call.imageBarriers[0].dstAccessMask ==
+                      (VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_TRANSFER_READ_BIT));
+    }
+  }
+
+  auto const& stats = batcher.getStats();
+  VOLK_TEST_CHECK(stats.barriers == 7);
+  VOLK_TEST_CHECK(stats.merged == 3);
+  VOLK_TEST_CHECK(stats.driverCalls == 1);
+}
+
+void testConflictsFlush(Volk& volk) {
+  calls.clear();
+  VolkBarrierBatcher batcher(volk);
+  auto const cb = commandBuffer(1);
+
+  // a second transition of the same image is recorded after the first one
+  auto const toTransfer = imageBarrier(20, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+  auto const toShader =
+    imageBarrier(20, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+  auto info = dependencyInfo(nullptr, nullptr, &toTransfer);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  info = dependencyInfo(nullptr, nullptr, &toShader);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  VOLK_TEST_CHECK(calls.size() == 1);
+
+  // another range of the same buffer
+  auto const head = bufferBarrier(10, 0, 256);
+  auto const tail = bufferBarrier(10, 256, 256);
+  info = dependencyInfo(nullptr, &head, nullptr);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  VOLK_TEST_CHECK(calls.size() == 1);
+  info = dependencyInfo(nullptr, &tail, nullptr);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  VOLK_TEST_CHECK(calls.size() == 2);
+
+  // another command buffer
+  info = dependencyInfo(nullptr, &head, nullptr);
+  batcher.vkCmdPipelineBarrier2(commandBuffer(2), &info);
+  VOLK_TEST_CHECK(calls.size() == 3);
+
+  // different dependency flags
+  info.dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+  batcher.vkCmdPipelineBarrier2(commandBuffer(2), &info);
+  VOLK_TEST_CHECK(calls.size() == 4);
+
+  // a chained barrier flushes the batch and is forwarded on its own
+  auto chained = bufferBarrier(11, 0, 256);
+  VkMemoryBarrier2 extension = {};
+  chained.pNext = &extension;
+  info = dependencyInfo(nullptr, &chained, nullptr);
+  batcher.vkCmdPipelineBarrier2(commandBuffer(2), &info);
+  VOLK_TEST_CHECK(calls.size() == 6);
+
+  batcher.flush();
+  VOLK_TEST_CHECK(calls.size() == 6);
+  if (calls.size() == 6) {
+    VOLK_TEST_CHECK(calls[0].imageBarriers.size() == 1 &&
+                    calls[0].imageBarriers[0].newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+    VOLK_TEST_CHECK(calls[1].imageBarriers.size() == 1 &&
+                    calls[1].imageBarriers[0].newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    VOLK_TEST_CHECK(calls[1].bufferBarriers.size() == 1 && calls[1].bufferBarriers[0].offset == 0);
+    VOLK_TEST_CHECK(calls[2].commandBuffer == cb);
+    VOLK_TEST_CHECK(calls[2].bufferBarriers.size() == 1 && calls[2].bufferBarriers[0].offset == 256);
+    VOLK_TEST_CHECK(calls[3].commandBuffer == commandBuffer(2));
+    VOLK_TEST_CHECK(calls[5].bufferBarriers.size() == 1 && calls[5].bufferBarriers[0].pNext == &extension);
+  }
+  VOLK_TEST_CHECK(batcher.getStats().merged == 0);
+  VOLK_TEST_CHECK(batcher.getStats().driverCalls == 6);
+}
+
+void testCall(Volk& volk) {
+  calls.clear();
+  VolkBarrierBatcher batcher(volk);
+  auto const barrier = bufferBarrier(10, 0, 256);
+  auto const info = dependencyInfo(nullptr, &barrier, nullptr);
+  batcher.vkCmdPipelineBarrier2(commandBuffer(1), &info);
+
+  size_t pendingCalls = ~size_t(0);
+  batcher.call([&pendingCalls](int) { pendingCalls = calls.size(); }, 0);
+  VOLK_TEST_CHECK(pendingCalls == 1);
+}
+
+void testLegacyMapping() {
+  legacyCalls.clear();
+  Volk volk;
+  volk.vkCmdPipelineBarrier = cmdPipelineBarrier;
+  VolkBarrierBatcher batcher(volk);
+  VOLK_TEST_CHECK(batcher.getStatus() == VK_ERROR_EXTENSION_NOT_PRESENT);
+  auto const cb = commandBuffer(1);
+  VkPipelineStageFlags2 const unknownStage = VkPipelineStageFlags2(1) << 50;
+  VkAccessFlags2 const unknownAccess = VkAccessFlags2(1) << 50;
+
+  // copy and sampled reads map to transfer and shader reads, NONE to the ends of the pipe
+  auto const copy = memoryBarrier(VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE, VK_PIPELINE_STAGE_2_COPY_BIT,
+                                  VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_SHADER_SAMPLED_READ_BIT);
+  auto info = dependencyInfo(&copy, nullptr, nullptr);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  batcher.flush();
+
+  auto const none = memoryBarrier(VK_PIPELINE_STAGE_2_BLIT_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT,
+                                  VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT, VK_PIPELINE_STAGE_2_NONE, VK_ACCESS_2_NONE);
+  info = dependencyInfo(&none, nullptr, nullptr);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  batcher.flush();
+
+  // stages of image barriers are combined; unknown high bits widen to all commands and all memory
+  auto image = imageBarrier(20, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+  image.srcStageMask = VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT | VK_PIPELINE_STAGE_2_HOST_BIT;
+  image.srcAccessMask = unknownAccess;
+  image.dstStageMask = VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT | unknownStage;
+  image.dstAccessMask = VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+  info = dependencyInfo(nullptr, nullptr, &image);
+  batcher.vkCmdPipelineBarrier2(cb, &info);
+  batcher.flush();
+
+  VOLK_TEST_CHECK(legacyCalls.size() == 3);
+  if (legacyCalls.size() != 3) {
+    return;
+  }
+
+  VOLK_TEST_CHECK(legacyCalls[0].srcStageMask == VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT);
+  VOLK_TEST_CHECK(legacyCalls[0].dstStageMask == VK_PIPELINE_STAGE_TRANSFER_BIT);
+  VOLK_TEST_CHECK(legacyCalls[0].memoryBarrierCount == 1);
+  VOLK_TEST_CHECK(legacyCalls[0].memoryBarrier.srcAccessMask == 0);
+  VOLK_TEST_CHECK(legacyCalls[0].memoryBarrier.dstAccessMask ==
+                  (VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT));
+
+  VOLK_TEST_CHECK(legacyCalls[1].srcStageMask == VK_PIPELINE_STAGE_TRANSFER_BIT);
+  VOLK_TEST_CHECK(legacyCalls[1].dstStageMask == VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+  VOLK_TEST_CHECK(legacyCalls[1].memoryBarrier.srcAccessMask == VK_ACCESS_SHADER_WRITE_BIT);
+
+  VOLK_TEST_CHECK(legacyCalls[2].memoryBarrierCount == 0);
+  VOLK_TEST_CHECK(legacyCalls[2].srcStageMask == (VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_HOST_BIT));
+  VOLK_TEST_CHECK(legacyCalls[2].dstStageMask ==
+                  (VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT |
+                   VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT | VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT |
+                   VK_PIPELINE_STAGE_ALL_COMMANDS_BIT));
+  VOLK_TEST_CHECK(legacyCalls[2].imageBarriers.size() == 1);
+  if (legacyCalls[2].imageBarriers.size() == 1) {
+    auto const& legacy = legacyCalls[2].imageBarriers[0];
+    VOLK_TEST_CHECK(legacy.srcAccessMask == (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT));
+    VOLK_TEST_CHECK(legacy.dstAccessMask == VK_ACCESS_SHADER_READ_BIT);
+    VOLK_TEST_CHECK(legacy.newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    VOLK_TEST_CHECK(legacy.image == image.image);
+  }
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCmdPipelineBarrier2 = cmdPipelineBarrier2;
+
+  testMerging(volk);
+  testConflictsFlush(volk);
+  testCall(volk);
+  testLegacyMapping();
+
+  return VOLK_TEST_RESULT();
+}
+
+#else
+
+int main() {
+  return 0;
+}
+
+#endif /* defined(VK_BASE_VERSION_1_3) */
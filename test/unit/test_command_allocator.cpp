@@ -0,0 +1,195 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_command_allocator.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_BASE_VERSION_1_2)
+
+#include <atomic>
+#include <cstdint>
+#include <latch>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Fake device: command buffer handles encode their pool, so tests can tell which pool a buffer came from.
+constexpr uint64_t kPoolShift = 16;
+
+std::mutex mutex;
+std::atomic<uint64_t> nextPool = 1;
+std::vector<uint32_t> batchSizes;
+std::vector<VkCommandPool> resetPools;
+std::vector<uint64_t> waitValues;
+uint64_t semaphoreValue = 0;
+uint64_t nextBuffer = 0;
+
+VkCommandPool getPool(VkCommandBuffer commandBuffer) {
+  return reinterpret_cast<VkCommandPool>(reinterpret_cast<uintptr_t>(commandBuffer) >> kPoolShift);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreCounterValue(VkDevice, VkSemaphore, uint64_t* pValue) {
+  std::lock_guard lock(mutex);
+  *pValue = semaphoreValue;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores(VkDevice, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t) {
+  std::lock_guard lock(mutex);
+  waitValues.push_back(pWaitInfo->pValues[0]);
+  semaphoreValue = pWaitInfo->pValues[0];
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createCommandPool(VkDevice, const VkCommandPoolCreateInfo*,
+                                                 const VkAllocationCallbacks*, VkCommandPool* pCommandPool) {
+  *pCommandPool = reinterpret_cast<VkCommandPool>(static_cast<uintptr_t>(nextPool++));
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyCommandPool(VkDevice, VkCommandPool, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetCommandPool(VkDevice, VkCommandPool commandPool, VkCommandPoolResetFlags) {
+  std::lock_guard lock(mutex);
+  resetPools.push_back(commandPool);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                                      VkCommandBuffer* pCommandBuffers) {
+  std::lock_guard lock(mutex);
+  batchSizes.push_back(pAllocateInfo->commandBufferCount);
+  auto const pool = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pAllocateInfo->commandPool));
+  for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+    auto const value = (pool << kPoolShift) | (++nextBuffer & ((1 << kPoolShift) - 1));
+    pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(static_cast<uintptr_t>(value));
+  }
+  return VK_SUCCESS;
+}
+
+void reset() {
+  batchSizes.clear();
+  resetPools.clear();
+  waitValues.clear();
+  semaphoreValue = 0;
+}
+
+void testRingReuse(Volk& volk) {
+  reset();
+  VolkCommandAllocator allocator(volk, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, 2);
+  VOLK_TEST_CHECK(allocator.getStatus() == VK_SUCCESS);
+
+  VOLK_TEST_CHECK(allocator.beginFrame(1) == VK_SUCCESS);
+  auto const a = allocator.allocate();
+  auto const b = allocator.allocate();
+  VOLK_TEST_CHECK(a != VK_NULL_HANDLE && b != VK_NULL_HANDLE && a != b);
+  VOLK_TEST_CHECK(getPool(a) == getPool(b));
+
+  // The second ring entry has its own pool; nothing has been recorded into it yet, so there is nothing to wait for.
+  VOLK_TEST_CHECK(allocator.beginFrame(2) == VK_SUCCESS);
+  auto const c = allocator.allocate();
+  VOLK_TEST_CHECK(getPool(c) != getPool(a));
+  VOLK_TEST_CHECK(waitValues.empty() && resetPools.empty());
+
+  // Reusing the first entry waits for frame 1 and resets its pool once; its command buffers are handed out again.
+  VOLK_TEST_CHECK(allocator.beginFrame(3) == VK_SUCCESS);
+  VOLK_TEST_CHECK(waitValues.size() == 1 && waitValues[0] == 1);
+  VOLK_TEST_CHECK(resetPools.size() == 1 && resetPools[0] == getPool(a));
+  VOLK_TEST_CHECK(allocator.allocate() == a);
+  VOLK_TEST_CHECK(allocator.allocate() == b);
+  VOLK_TEST_CHECK(batchSizes.size() == 2);
+
+  // Frame 2 has already completed: no wait.
+  semaphoreValue = 2;
+  VOLK_TEST_CHECK(allocator.beginFrame(4) == VK_SUCCESS);
+  VOLK_TEST_CHECK(waitValues.size() == 1);
+  VOLK_TEST_CHECK(allocator.allocate() == c);
+}
+
+void testGrowingBatches(Volk& volk) {
+  reset();
+  VolkCommandAllocator allocator(volk, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, 1);
+  VOLK_TEST_CHECK(allocator.beginFrame(1) == VK_SUCCESS);
+  std::set<VkCommandBuffer> primary;
+  for (uint32_t i = 0; i < 40; ++i) {
+    primary.insert(allocator.allocate());
+  }
+  VOLK_TEST_CHECK(primary.size() == 40);
+  VOLK_TEST_CHECK((batchSizes == std::vector<uint32_t>{8, 8, 16, 32}));
+
+  // Secondary command buffers come from separate batches of the same pool.
+  auto const secondary = allocator.allocate(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+  VOLK_TEST_CHECK(primary.count(secondary) == 0 && getPool(secondary) == getPool(*primary.begin()));
+  VOLK_TEST_CHECK(batchSizes.size() == 5 && batchSizes[4] == 8);
+
+  // After a reset the batches are reused, so the next frame allocates nothing.
+  semaphoreValue = 1;
+  VOLK_TEST_CHECK(allocator.beginFrame(2) == VK_SUCCESS);
+  for (uint32_t i = 0; i < 40; ++i) {
+    VOLK_TEST_CHECK(primary.count(allocator.allocate()) == 1);
+  }
+  VOLK_TEST_CHECK(batchSizes.size() == 5);
+}
+
+void testThreadsPastMaxThreads(Volk& volk) {
+  reset();
+  VolkCommandAllocator allocator(volk, VK_NULL_HANDLE, 0, VK_NULL_HANDLE, 1);
+  VOLK_TEST_CHECK(allocator.beginFrame(1) == VK_SUCCESS);
+
+  // kMaxThreads threads hold their pools while one more thread asks for a command buffer.
+  constexpr uint32_t kThreads = VolkCommandAllocator::kMaxThreads;
+  VkCommandBuffer commandBuffers[kThreads + 1] = {};
+  std::latch allocated(kThreads);
+  std::latch done(1);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      commandBuffers[t] = allocator.allocate();
+      allocated.count_down();
+      done.wait();
+    });
+  }
+  allocated.wait();
+  std::thread([&] { commandBuffers[kThreads] = allocator.allocate(); }).join();
+  done.count_down();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::set<VkCommandPool> pools;
+  for (uint32_t t = 0; t < kThreads; ++t) {
+    VOLK_TEST_CHECK(commandBuffers[t] != VK_NULL_HANDLE);
+    pools.insert(getPool(commandBuffers[t]));
+  }
+  VOLK_TEST_CHECK(pools.size() == kThreads);
+  VOLK_TEST_CHECK(commandBuffers[kThreads] == VK_NULL_HANDLE);
+
+  // The threads have exited, so a new thread gets one of their pools.
+  VkCommandBuffer later = VK_NULL_HANDLE;
+  std::thread([&] { later = allocator.allocate(); }).join();
+  VOLK_TEST_CHECK(later != VK_NULL_HANDLE && pools.count(getPool(later)) == 1);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetSemaphoreCounterValue = getSemaphoreCounterValue;
+  volk.vkWaitSemaphores = waitSemaphores;
+  volk.vkCreateCommandPool = createCommandPool;
+  volk.vkDestroyCommandPool = destroyCommandPool;
+  volk.vkResetCommandPool = resetCommandPool;
+  volk.vkAllocateCommandBuffers = allocateCommandBuffers;
+
+  testRingReuse(volk);
+  testGrowingBatches(volk);
+  testThreadsPastMaxThreads(volk);
+  return VOLK_TEST_RESULT();
+}
+
+#else
+int main() {
+  return 0;
+}
+#endif
@@ -0,0 +1,212 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_deferred_commands.hpp"
+#include "volk_test.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+std::vector<VkBufferCopy> copiedRegions;
+float blendConstants[4] = {};
+std::vector<uint8_t> pushedValues;
+uint32_t barrierCount = 0;
+uint32_t endRenderingCount = 0;
+float lineWidth = 0.0f;
+uint32_t dispatchBase[6] = {};
+std::vector<VkImageMemoryBarrier2> imageBarriers;
+VkRenderingInfo renderingInfo = {};
+std::vector<VkRenderingAttachmentInfo> colorAttachments;
+std::vector<VkRect2D> deviceRenderAreas;
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer(VkCommandBuffer, VkBuffer, VkBuffer, uint32_t regionCount,
+                                         const VkBufferCopy* pRegions) {
+  copiedRegions.assign(pRegions, pRegions + regionCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdSetBlendConstants(VkCommandBuffer, const float constants[4]) {
+  std::memcpy(blendConstants, constants, sizeof(blendConstants));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPushConstants(VkCommandBuffer, VkPipelineLayout, VkShaderStageFlags, uint32_t,
+                                            uint32_t size, const void* pValues) {
+  auto bytes = static_cast<const uint8_t*>(pValues);
+  pushedValues.assign(bytes, bytes + size);
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier(VkCommandBuffer, VkPipelineStageFlags, VkPipelineStageFlags,
+                                              VkDependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier*,
+                                              uint32_t, const VkBufferMemoryBarrier*, uint32_t,
+                                              const VkImageMemoryBarrier*) {
+  barrierCount += memoryBarrierCount;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdEndRendering(VkCommandBuffer) {
+  ++endRenderingCount;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdSetLineWidth(VkCommandBuffer, float width) {
+  lineWidth = width;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdDispatchBase(VkCommandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
+                                           uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY,
+                                           uint32_t groupCountZ) {
+  uint32_t const values[6] = {baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ};
+  std::memcpy(dispatchBase, values, sizeof(dispatchBase));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer, const VkDependencyInfo* pDependencyInfo) {
+  imageBarriers.assign(pDependencyInfo->pImageMemoryBarriers,
+                       pDependencyInfo->pImageMemoryBarriers + pDependencyInfo->imageMemoryBarrierCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdBeginRendering(VkCommandBuffer, const VkRenderingInfo* pRenderingInfo) {
+  renderingInfo = *pRenderingInfo;
+  colorAttachments.assign(pRenderingInfo->pColorAttachments,
+                          pRenderingInfo->pColorAttachments + pRenderingInfo->colorAttachmentCount);
+  deviceRenderAreas.clear();
+  auto const* deviceGroup = static_cast<const VkDeviceGroupRenderPassBeginInfo*>(pRenderingInfo->pNext);
+  if (deviceGroup && deviceGroup->sType == VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO) {
+    deviceRenderAreas.assign(deviceGroup->pDeviceRenderAreas,
+                             deviceGroup->pDeviceRenderAreas + deviceGroup->deviceRenderAreaCount);
+  }
+}
+
+void testArraysAreCopied(Volk& volk) {
+  VolkDeferredCommands stream;
+  std::vector<VkBufferCopy> regions = {{0, 16, 32}, {64, 128, 256}};
+  float constants[4] = {0.25f, 0.5f, 0.75f, 1.0f};
+  uint32_t values[2] = {7, 9};
+  stream.vkCmdCopyBuffer(VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, uint32_t(regions.size()), regions.data());
+  stream.vkCmdSetBlendConstants(VK_NULL_HANDLE, constants);
+  stream.vkCmdPushConstants(VK_NULL_HANDLE, VK_NULL_HANDLE, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(values), values);
+  stream.vkCmdEndRendering(VK_NULL_HANDLE);
+  regions.assign(2, VkBufferCopy{});
+  constants[0] = 0.0f;
+  values[0] = 0;
+
+  VOLK_TEST_CHECK(stream.replay(VK_NULL_HANDLE, volk) == VK_SUCCESS);
+  VOLK_TEST_CHECK(copiedRegions.size() == 2 && copiedRegions[1].dstOffset == 128 && copiedRegions[1].size == 256);
+  VOLK_TEST_CHECK(blendConstants[0] == 0.25f && blendConstants[3] == 1.0f);
+  VOLK_TEST_CHECK(pushedValues.size() == sizeof(values));
+  uint32_t pushed[2] = {};
+  std::memcpy(pushed, pushedValues.data(), sizeof(pushed));
+  VOLK_TEST_CHECK(pushed[0] == 7 && pushed[1] == 9);
+  VOLK_TEST_CHECK(endRenderingCount == 1);
+
+  VOLK_TEST_CHECK(stream.replay(VK_NULL_HANDLE, volk) == VK_SUCCESS);
+  VOLK_TEST_CHECK(endRenderingCount == 2);
+}
+
+void testChainedBarriersAreRejected(Volk& volk) {
+  VolkDeferredCommands stream;
+  VkMemoryBarrier barrier = {};
+  barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+  stream.vkCmdPipelineBarrier(VK_NULL_HANDLE, 0, 0, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+  VOLK_TEST_CHECK(stream.replay(VK_NULL_HANDLE, volk) == VK_SUCCESS);
+  VOLK_TEST_CHECK(barrierCount == 1);
+
+  VkMemoryBarrier chained = barrier;
+  chained.pNext = &barrier;
+  stream.vkCmdPipelineBarrier(VK_NULL_HANDLE, 0, 0, 0, 1, &chained, 0, nullptr, 0, nullptr);
+  VOLK_TEST_CHECK(stream.replay(VK_NULL_HANDLE, volk) == VK_ERROR_FEATURE_NOT_PRESENT);
+  VOLK_TEST_CHECK(barrierCount == 1);
+
+  stream.reset();
+  VOLK_TEST_CHECK(stream.isEmpty());
+  VOLK_TEST_CHECK(stream.replay(VK_NULL_HANDLE, volk) == VK_SUCCESS);
+}
+
+void testLineWidthAndDispatchBase(Volk& volk) {
+  VolkDeferredCommands stream;
+  stream.vkCmdSetLineWidth(VK_NULL_HANDLE, 2.5f);
+  stream.vkCmdDispatchBase(VK_NULL_HANDLE, 1, 2, 3, 4, 5, 6);
+  VOLK_TEST_CHECK(stream.replay(VK_NULL_HANDLE, volk) == VK_SUCCESS);
+  VOLK_TEST_CHECK(lineWidth == 2.5f);
+  VOLK_TEST_CHECK(dispatchBase[0] == 1 && dispatchBase[2] == 3 && dispatchBase[5] == 6);
+}
+
+void testNestedArraysAreCopied(Volk& volk) {
+  VolkDeferredCommands stream;
+  std::vector<VkImageMemoryBarrier2> barriers(3);
+  for (uint32_t i = 0; i < 3; ++i) {
+    barriers[i].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    barriers[i].newLayout = VK_IMAGE_LAYOUT_GENERAL;
+    barriers[i].subresourceRange.baseMipLevel = i;
+  }
+  VkDependencyInfo dependencyInfo = {};
+  dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+  dependencyInfo.imageMemoryBarrierCount = 3;
+  dependencyInfo.pImageMemoryBarriers = barriers.data();
+  stream.vkCmdPipelineBarrier2(VK_NULL_HANDLE, &dependencyInfo);
+
+  std::vector<VkRenderingAttachmentInfo> attachments(2);
+  for (auto& attachment : attachments) {
+    attachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+    attachment.imageLayout = VK_IMAGE_LAYOUT_GENERAL;
+  }
+  std::vector<VkRect2D> areas = {{{0, 0}, {64, 64}}, {{64, 0}, {64, 64}}};
+  VkDeviceGroupRenderPassBeginInfo deviceGroup = {};
+  deviceGroup.sType = VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO;
+  deviceGroup.deviceMask = 3;
+  deviceGroup.deviceRenderAreaCount = uint32_t(areas.size());
+  deviceGroup.pDeviceRenderAreas = areas.data();
+  VkRenderingInfo info = {};
+  info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+  info.pNext = &deviceGroup;
+  info.layerCount = 1;
+  info.colorAttachmentCount = uint32_t(attachments.size());
+  info.pColorAttachments = attachments.data();
+  stream.vkCmdBeginRendering(VK_NULL_HANDLE, &info);
+
+  // Everything the commands point to is overwritten before replay.
+  barriers.assign(3, VkImageMemoryBarrier2{});
+  attachments.assign(2, VkRenderingAttachmentInfo{});
+  areas.assign(2, VkRect2D{});
+  deviceGroup = {};
+  info = {};
+
+  VOLK_TEST_CHECK(stream.replay(VK_NULL_HANDLE, volk) == VK_SUCCESS);
+  VOLK_TEST_CHECK(imageBarriers.size() == 3 && imageBarriers[2].subresourceRange.baseMipLevel == 2);
+  VOLK_TEST_CHECK(imageBarriers[0].newLayout == VK_IMAGE_LAYOUT_GENERAL);
+  VOLK_TEST_CHECK(renderingInfo.layerCount == 1 && colorAttachments.size() == 2);
+  VOLK_TEST_CHECK(colorAttachments[1].imageLayout == VK_IMAGE_LAYOUT_GENERAL);
+  VOLK_TEST_CHECK(deviceRenderAreas.size() == 2 && deviceRenderAreas[1].offset.x == 64);
+  VOLK_TEST_CHECK(renderingInfo.pNext != &deviceGroup);
+}
+
+void testUnknownExtensionIsRejected(Volk& volk) {
+  VolkDeferredCommands stream;
+  // A structure which doesn't extend VkRenderingInfo can't be copied.
+  VkMemoryBarrier barrier = {};
+  barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+  VkRenderingInfo info = {};
+  info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+  info.pNext = &barrier;
+  stream.vkCmdBeginRendering(VK_NULL_HANDLE, &info);
+  VOLK_TEST_CHECK(stream.replay(VK_NULL_HANDLE, volk) == VK_ERROR_FEATURE_NOT_PRESENT);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCmdCopyBuffer = cmdCopyBuffer;
+  volk.vkCmdSetBlendConstants = cmdSetBlendConstants;
+  volk.vkCmdPushConstants = cmdPushConstants;
+  volk.vkCmdPipelineBarrier = cmdPipelineBarrier;
+  volk.vkCmdEndRendering = cmdEndRendering;
+  volk.vkCmdSetLineWidth = cmdSetLineWidth;
+  volk.vkCmdDispatchBase = cmdDispatchBase;
+  volk.vkCmdPipelineBarrier2 = cmdPipelineBarrier2;
+  volk.vkCmdBeginRendering = cmdBeginRendering;
+
+  testArraysAreCopied(volk);
+  testChainedBarriersAreRejected(volk);
+  testLineWidthAndDispatchBase(volk);
+  testNestedArraysAreCopied(volk);
+  testUnknownExtensionIsRejected(volk);
+  return VOLK_TEST_RESULT();
+}
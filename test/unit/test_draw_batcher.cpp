@@ -0,0 +1,112 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_draw_batcher.hpp"
+#include "volk_test.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+uint32_t maxMultiDrawCount = 4;
+VkBool32 multiDrawSupported = VK_TRUE;
+std::vector<uint32_t> multiDrawCounts;
+uint32_t singleDraws = 0;
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFeatures2(VkPhysicalDevice, VkPhysicalDeviceFeatures2* pFeatures) {
+  auto multiDraw = static_cast<VkPhysicalDeviceMultiDrawFeaturesEXT*>(pFeatures->pNext);
+  multiDraw->multiDraw = multiDrawSupported;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties2(VkPhysicalDevice, VkPhysicalDeviceProperties2* pProperties) {
+  auto multiDraw = static_cast<VkPhysicalDeviceMultiDrawPropertiesEXT*>(pProperties->pNext);
+  multiDraw->maxMultiDrawCount = maxMultiDrawCount;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdDraw(VkCommandBuffer, uint32_t, uint32_t, uint32_t, uint32_t) {
+  ++singleDraws;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdDrawIndexed(VkCommandBuffer, uint32_t, uint32_t, uint32_t, int32_t, uint32_t) {
+  ++singleDraws;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdDrawMulti(VkCommandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT*, uint32_t,
+                                        uint32_t, uint32_t) {
+  multiDrawCounts.push_back(drawCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdDrawMultiIndexed(VkCommandBuffer, uint32_t drawCount, const VkMultiDrawIndexedInfoEXT*,
+                                               uint32_t, uint32_t, uint32_t, const int32_t*) {
+  multiDrawCounts.push_back(drawCount);
+}
+
+void reset() {
+  multiDrawCounts.clear();
+  singleDraws = 0;
+}
+
+void testBatchesStayBelowLimit(Volk& volk) {
+  reset();
+  maxMultiDrawCount = 4;
+  multiDrawSupported = VK_TRUE;
+  VolkDrawBatcher batcher(volk, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(batcher.getStatus() == VK_SUCCESS);
+  for (uint32_t i = 0; i < 7; ++i) {
+    batcher.vkCmdDraw(VK_NULL_HANDLE, 3, 1, i * 3, 0);
+  }
+  batcher.flush();
+
+  VOLK_TEST_CHECK(multiDrawCounts == std::vector<uint32_t>({3, 3}));
+  VOLK_TEST_CHECK(singleDraws == 1);
+  VOLK_TEST_CHECK(batcher.getStats().draws == 7);
+  VOLK_TEST_CHECK(batcher.getStats().driverCalls == 3);
+}
+
+void testBatchesBreakOnInstanceChange(Volk& volk) {
+  reset();
+  maxMultiDrawCount = 16;
+  multiDrawSupported = VK_TRUE;
+  VolkDrawBatcher batcher(volk, VK_NULL_HANDLE);
+  batcher.vkCmdDrawIndexed(VK_NULL_HANDLE, 6, 1, 0, 0, 0);
+  batcher.vkCmdDrawIndexed(VK_NULL_HANDLE, 6, 1, 6, 0, 0);
+  batcher.vkCmdDrawIndexed(VK_NULL_HANDLE, 6, 2, 12, 0, 0);
+  batcher.flush();
+  VOLK_TEST_CHECK(multiDrawCounts == std::vector<uint32_t>({2}));
+  VOLK_TEST_CHECK(singleDraws == 1);
+}
+
+void testSmallLimitsAndMissingFeatureForward(Volk& volk) {
+  reset();
+  maxMultiDrawCount = 2;
+  multiDrawSupported = VK_TRUE;
+  {
+    VolkDrawBatcher batcher(volk, VK_NULL_HANDLE);
+    VOLK_TEST_CHECK(batcher.getStatus() == VK_ERROR_EXTENSION_NOT_PRESENT);
+  }
+
+  maxMultiDrawCount = 16;
+  multiDrawSupported = VK_FALSE;
+  VolkDrawBatcher batcher(volk, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(batcher.getStatus() == VK_ERROR_EXTENSION_NOT_PRESENT);
+  batcher.vkCmdDraw(VK_NULL_HANDLE, 3, 1, 0, 0);
+  batcher.vkCmdDraw(VK_NULL_HANDLE, 3, 1, 3, 0);
+  VOLK_TEST_CHECK(singleDraws == 2);
+  VOLK_TEST_CHECK(multiDrawCounts.empty());
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetPhysicalDeviceFeatures2 = getPhysicalDeviceFeatures2;
+  volk.vkGetPhysicalDeviceProperties2 = getPhysicalDeviceProperties2;
+  volk.vkCmdDraw = cmdDraw;
+  volk.vkCmdDrawIndexed = cmdDrawIndexed;
+  volk.vkCmdDrawMultiEXT = cmdDrawMulti;
+  volk.vkCmdDrawMultiIndexedEXT = cmdDrawMultiIndexed;
+
+  testBatchesStayBelowLimit(volk);
+  testBatchesBreakOnInstanceChange(volk);
+  testSmallLimitsAndMissingFeatureForward(volk);
+  return VOLK_TEST_RESULT();
+}
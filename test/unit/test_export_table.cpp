@@ -0,0 +1,44 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk.hpp"
+#include "volk_export.h"
+#include "volk_test.hpp"
+
+#include <memory>
+
+namespace {
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL getInstanceProcAddr(VkInstance, const char*) {
+  return nullptr;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks*) {}
+
+} // namespace
+
+int main() {
+  Volk host(getInstanceProcAddr);
+  VOLK_TEST_CHECK(host.getStatus() == VK_SUCCESS);
+  host.vkDestroyBuffer = destroyBuffer;
+
+  VolkCppExport hostExport;
+  auto table = std::make_unique<VolkCppTable>();
+  host.exportTable(&hostExport, table.get());
+  VOLK_TEST_CHECK(hostExport.table == table.get());
+  VOLK_TEST_CHECK(table->vkDestroyBuffer == destroyBuffer);
+  VOLK_TEST_CHECK(volkCppGetTable(&hostExport) == table.get());
+
+  Volk plugin(hostExport);
+  VOLK_TEST_CHECK(plugin.getStatus() == VK_SUCCESS);
+  VOLK_TEST_CHECK(plugin.vkDestroyBuffer == destroyBuffer);
+  VOLK_TEST_CHECK(plugin.vkGetInstanceProcAddr == getInstanceProcAddr);
+
+  // A table of another layout isn't used: function pointers are loaded through vkGetInstanceProcAddr instead.
+  table->headerVersion = VOLK_CPP_HEADER_VERSION + 1;
+  VOLK_TEST_CHECK(volkCppGetTable(&hostExport) == nullptr);
+  Volk otherPlugin(hostExport);
+  VOLK_TEST_CHECK(otherPlugin.getStatus() == VK_SUCCESS);
+  VOLK_TEST_CHECK(otherPlugin.vkDestroyBuffer == nullptr);
+
+  VOLK_TEST_CHECK(volkCppGetTable(nullptr) == nullptr);
+  return VOLK_TEST_RESULT();
+}
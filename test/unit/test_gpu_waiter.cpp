@@ -0,0 +1,166 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_gpu_waiter.hpp"
+#include "volk_test.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+// Fake timeline semaphores: host signals and device loss wake every blocked vkWaitSemaphores.
+std::mutex mutex;
+std::condition_variable signaled;
+std::map<VkSemaphore, uint64_t> values;
+bool deviceLost = false;
+uint32_t waitCalls = 0;
+uint64_t nextSemaphore = 1;
+
+VkSemaphore makeSemaphore() {
+  std::lock_guard lock(mutex);
+  auto const semaphore = reinterpret_cast<VkSemaphore>(static_cast<uintptr_t>(nextSemaphore++));
+  values[semaphore] = 0;
+  return semaphore;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*,
+                                               VkSemaphore* pSemaphore) {
+  *pSemaphore = makeSemaphore();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreCounterValue(VkDevice, VkSemaphore semaphore, uint64_t* pValue) {
+  std::lock_guard lock(mutex);
+  *pValue = values[semaphore];
+  return deviceLost ? VK_ERROR_DEVICE_LOST : VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL signalSemaphore(VkDevice, const VkSemaphoreSignalInfo* pSignalInfo) {
+  std::lock_guard lock(mutex);
+  values[pSignalInfo->semaphore] = pSignalInfo->value;
+  signaled.notify_all();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores(VkDevice, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t) {
+  std::unique_lock lock(mutex);
+  ++waitCalls;
+  signaled.wait(lock, [pWaitInfo] {
+    for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; ++i) {
+      if (values[pWaitInfo->pSemaphores[i]] >= pWaitInfo->pValues[i]) {
+        return true;
+      }
+    }
+    return deviceLost;
+  });
+  return deviceLost ? VK_ERROR_DEVICE_LOST : VK_SUCCESS;
+}
+
+void signal(VkSemaphore semaphore, uint64_t value) {
+  VkSemaphoreSignalInfo signalInfo = {};
+  signalInfo.semaphore = semaphore;
+  signalInfo.value = value;
+  (void)signalSemaphore(VK_NULL_HANDLE, &signalInfo);
+}
+
+void loseDevice() {
+  std::lock_guard lock(mutex);
+  deviceLost = true;
+  signaled.notify_all();
+}
+
+struct Completion {
+  std::promise<VkResult> result;
+  std::thread::id thread;
+};
+
+// Eagerly started coroutine which never suspends at its end.
+struct Task {
+  struct promise_type {
+    Task get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::abort(); }
+  };
+};
+
+Task await(VolkGpuWaiter::Awaitable awaitable, Completion& completion) {
+  auto const result = co_await awaitable;
+  completion.thread = std::this_thread::get_id();
+  completion.result.set_value(result);
+}
+
+void testSemaphoreWaitResumesOnWaiterThread(Volk& volk) {
+  deviceLost = false;
+  VolkGpuWaiter waiter(volk, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(waiter.getStatus() == VK_SUCCESS);
+  auto const semaphore = makeSemaphore();
+
+  Completion completion;
+  auto future = completion.result.get_future();
+  await(waiter.wait(semaphore, 2), completion);
+  signal(semaphore, 1);
+  VOLK_TEST_CHECK(future.wait_for(std::chrono::milliseconds(20)) == std::future_status::timeout);
+  signal(semaphore, 2);
+  VOLK_TEST_CHECK(future.get() == VK_SUCCESS);
+  VOLK_TEST_CHECK(completion.thread != std::this_thread::get_id());
+
+  Completion ready;
+  await(waiter.wait(semaphore, 2), ready);
+  VOLK_TEST_CHECK(ready.result.get_future().get() == VK_SUCCESS);
+  VOLK_TEST_CHECK(ready.thread == std::this_thread::get_id());
+}
+
+void testDeviceLossIsSticky(Volk& volk) {
+  deviceLost = false;
+  VolkGpuWaiter waiter(volk, VK_NULL_HANDLE);
+  auto const semaphore = makeSemaphore();
+
+  Completion pending;
+  auto future = pending.result.get_future();
+  await(waiter.wait(semaphore, 1), pending);
+  loseDevice();
+  VOLK_TEST_CHECK(future.get() == VK_ERROR_DEVICE_LOST);
+
+  // The waiter thread stopped instead of retrying vkWaitSemaphores.
+  uint32_t calls = 0;
+  {
+    std::lock_guard lock(mutex);
+    calls = waitCalls;
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  {
+    std::lock_guard lock(mutex);
+    VOLK_TEST_CHECK(waitCalls == calls);
+  }
+
+  // Later waits complete with the sticky error without suspending, even if their value was reached.
+  signal(semaphore, 1);
+  Completion later;
+  await(waiter.wait(semaphore, 1), later);
+  VOLK_TEST_CHECK(later.result.get_future().get() == VK_ERROR_DEVICE_LOST);
+  VOLK_TEST_CHECK(later.thread == std::this_thread::get_id());
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreateSemaphore = createSemaphore;
+  volk.vkDestroySemaphore = destroySemaphore;
+  volk.vkGetSemaphoreCounterValue = getSemaphoreCounterValue;
+  volk.vkSignalSemaphore = signalSemaphore;
+  volk.vkWaitSemaphores = waitSemaphores;
+
+  testSemaphoreWaitResumesOnWaiterThread(volk);
+  testDeviceLossIsSticky(volk);
+  return VOLK_TEST_RESULT();
+}
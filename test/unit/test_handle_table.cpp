@@ -0,0 +1,89 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_handle_table.hpp"
+#include "volk_test.hpp"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void testChurnReclaimsTombstones() {
+  VolkHandleTable<uint32_t> table(64);
+  std::vector<uint64_t> live;
+  uint64_t nextHandle = 1;
+  for (uint32_t i = 0; i < 40; ++i) {
+    VOLK_TEST_CHECK(table.insert(nextHandle, uint32_t(nextHandle)));
+    live.push_back(nextHandle++);
+  }
+
+  for (uint32_t round = 0; round < 10000; ++round) {
+    auto const victim = (round * 7919U) % live.size();
+    uint32_t value = 0;
+    VOLK_TEST_CHECK(table.erase(live[victim], &value));
+    VOLK_TEST_CHECK(value == uint32_t(live[victim]));
+    VOLK_TEST_CHECK(table.insert(nextHandle, uint32_t(nextHandle)));
+    live[victim] = nextHandle++;
+    VOLK_TEST_CHECK(table.getTombstoneCount() <= table.getCapacity() / 4);
+  }
+
+  VOLK_TEST_CHECK(table.getSize() == live.size());
+  for (auto handle : live) {
+    uint32_t value = 0;
+    VOLK_TEST_CHECK(table.find(handle, &value) && value == uint32_t(handle));
+  }
+  uint32_t value = 0;
+  VOLK_TEST_CHECK(!table.find(uint64_t(1), &value));
+  VOLK_TEST_CHECK(!table.find(nextHandle, &value));
+}
+
+void testFullTable() {
+  VolkHandleTable<uint32_t> table(4);
+  for (uint64_t handle = 1; handle <= 4; ++handle) {
+    VOLK_TEST_CHECK(table.insert(handle, 0U));
+  }
+  VOLK_TEST_CHECK(!table.insert(uint64_t(5), 0U));
+  VOLK_TEST_CHECK(table.erase(uint64_t(2)));
+  VOLK_TEST_CHECK(!table.erase(uint64_t(2)));
+  VOLK_TEST_CHECK(table.insert(uint64_t(5), 0U));
+  uint32_t value = 0;
+  for (uint64_t handle : {1, 3, 4, 5}) {
+    VOLK_TEST_CHECK(table.find(handle, &value));
+  }
+}
+
+void testConcurrentChurn() {
+  constexpr uint32_t kThreads = 4;
+  constexpr uint64_t kHandlesPerThread = 32;
+  VolkHandleTable<uint64_t> table(kThreads * kHandlesPerThread * 2);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&table, t] {
+      for (uint64_t round = 0; round < 2000; ++round) {
+        for (uint64_t i = 0; i < kHandlesPerThread; ++i) {
+          uint64_t const handle = ((round * kHandlesPerThread + i) << 8) | (t + 1);
+          VOLK_TEST_CHECK(table.insert(handle, handle));
+        }
+        for (uint64_t i = 0; i < kHandlesPerThread; ++i) {
+          uint64_t const handle = ((round * kHandlesPerThread + i) << 8) | (t + 1);
+          uint64_t value = 0;
+          VOLK_TEST_CHECK(table.find(handle, &value) && value == handle);
+          VOLK_TEST_CHECK(table.erase(handle));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  VOLK_TEST_CHECK(table.getSize() == 0);
+}
+
+} // namespace
+
+int main() {
+  testChurnReclaimsTombstones();
+  testFullTable();
+  testConcurrentChurn();
+  return VOLK_TEST_RESULT();
+}
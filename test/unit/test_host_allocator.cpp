@@ -0,0 +1,225 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_host_allocator.hpp"
+#include "volk_test.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <latch>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kPooledScopes = 1U << VK_SYSTEM_ALLOCATION_SCOPE_COMMAND | 1U << VK_SYSTEM_ALLOCATION_SCOPE_OBJECT;
+
+const VkAllocationCallbacks* deviceAllocator = nullptr;
+
+VKAPI_ATTR VkResult VKAPI_CALL createDevice(VkPhysicalDevice, const VkDeviceCreateInfo*,
+                                            const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
+  deviceAllocator = pAllocator;
+  *pDevice = reinterpret_cast<VkDevice>(uintptr_t(1));
+  return VK_SUCCESS;
+}
+
+void* allocate(VolkHostAllocator& allocator, size_t size, VkSystemAllocationScope scope, size_t alignment = 8) {
+  auto const callbacks = allocator.getAllocationCallbacks();
+  return callbacks->pfnAllocation(callbacks->pUserData, size, alignment, scope);
+}
+
+void release(VolkHostAllocator& allocator, void* pMemory) {
+  auto const callbacks = allocator.getAllocationCallbacks();
+  callbacks->pfnFree(callbacks->pUserData, pMemory);
+}
+
+bool isAligned(void* pointer, size_t alignment) {
+  return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+void testStats(Volk& volk) {
+  VolkHostAllocator allocator(volk);
+  auto const a = allocate(allocator, 100, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+  auto const b = allocate(allocator, 1000, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+  release(allocator, a);
+  release(allocator, nullptr);
+
+  auto stats = allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+  VOLK_TEST_CHECK(stats.allocationCount == 2 && stats.freeCount == 1 && stats.pooledCount == 0);
+  VOLK_TEST_CHECK(stats.liveBytes == 1000 && stats.peakBytes == 1100);
+  // 100 falls into (64, 128], 1000 into (512, 1024].
+  VOLK_TEST_CHECK(stats.sizeHistogram[7] == 1 && stats.sizeHistogram[10] == 1);
+  VOLK_TEST_CHECK(allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_COMMAND).allocationCount == 0);
+  auto const invalidScope = static_cast<VkSystemAllocationScope>(VolkHostAllocator::kScopeCount);
+  VOLK_TEST_CHECK(allocator.getStats(invalidScope).allocationCount == 0);
+  release(allocator, b);
+
+  auto const callbacks = allocator.getAllocationCallbacks();
+  callbacks->pfnInternalAllocation(callbacks->pUserData, 4096, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE,
+                                   VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+  callbacks->pfnInternalAllocation(callbacks->pUserData, 512, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE,
+                                   VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+  callbacks->pfnInternalFree(callbacks->pUserData, 4096, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE,
+                             VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+  stats = allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+  VOLK_TEST_CHECK(stats.internalLiveBytes == 512 && stats.allocationCount == 0);
+
+  VkDevice device = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(allocator.vkCreateDevice(VK_NULL_HANDLE, nullptr, nullptr, &device) == VK_SUCCESS);
+  VOLK_TEST_CHECK(deviceAllocator == allocator.getAllocationCallbacks());
+  VkAllocationCallbacks own = {};
+  VOLK_TEST_CHECK(allocator.vkCreateDevice(VK_NULL_HANDLE, nullptr, &own, &device) == VK_SUCCESS);
+  VOLK_TEST_CHECK(deviceAllocator == &own);
+}
+
+void testSizeClassPools(Volk& volk) {
+  VolkHostAllocator allocator(volk, kPooledScopes);
+
+  // A freed block is reused by the next allocation of the same size class.
+  auto const a = allocate(allocator, 40, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+  memset(a, 0xab, 40);
+  release(allocator, a);
+  auto const b = allocate(allocator, 48, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+  VOLK_TEST_CHECK(b == a);
+  auto const c = allocate(allocator, 200, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+  VOLK_TEST_CHECK(c != a && isAligned(c, 16));
+
+  // Blocks of one size class are packed in a chunk.
+  auto const d = allocate(allocator, 48, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+  VOLK_TEST_CHECK(static_cast<uint8_t*>(d) - static_cast<uint8_t*>(b) == 64);
+
+  // Unpooled scopes, large sizes and large alignments go to the system heap.
+  auto const large = allocate(allocator, 2048, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+  auto const aligned = allocate(allocator, 64, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND, 256);
+  auto const device = allocate(allocator, 64, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+  VOLK_TEST_CHECK(isAligned(aligned, 256));
+  VOLK_TEST_CHECK(allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_COMMAND).pooledCount == 3);
+  VOLK_TEST_CHECK(allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_OBJECT).pooledCount == 1);
+  VOLK_TEST_CHECK(allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_DEVICE).pooledCount == 0);
+
+  for (auto pointer : {b, c, d, large, aligned, device}) {
+    release(allocator, pointer);
+  }
+  VOLK_TEST_CHECK(allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_COMMAND).liveBytes == 0);
+  VOLK_TEST_CHECK(allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_OBJECT).liveBytes == 0);
+}
+
+void testReallocation(Volk& volk) {
+  VolkHostAllocator allocator(volk, kPooledScopes);
+  auto const callbacks = allocator.getAllocationCallbacks();
+  auto const realloc = [&](void* pOriginal, size_t size, VkSystemAllocationScope scope) {
+    return callbacks->pfnReallocation(callbacks->pUserData, pOriginal, size, 8, scope);
+  };
+
+  // Growing moves the data from a pool block to the system heap; the original scope is kept.
+  auto pointer = static_cast<uint8_t*>(realloc(nullptr, 16, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND));
+  for (uint8_t i = 0; i < 16; ++i) {
+    pointer[i] = i;
+  }
+  pointer = static_cast<uint8_t*>(realloc(pointer, 4096, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE));
+  bool preserved = true;
+  for (uint8_t i = 0; i < 16; ++i) {
+    preserved = preserved && pointer[i] == i;
+  }
+  VOLK_TEST_CHECK(preserved);
+  auto stats = allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+  VOLK_TEST_CHECK(stats.reallocationCount == 1 && stats.liveBytes == 4096 && stats.pooledCount == 1);
+  VOLK_TEST_CHECK(allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_DEVICE).allocationCount == 0);
+
+  // Shrinking truncates; size 0 frees.
+  pointer = static_cast<uint8_t*>(realloc(pointer, 8, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND));
+  VOLK_TEST_CHECK(pointer[7] == 7);
+  VOLK_TEST_CHECK(realloc(pointer, 0, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND) == nullptr);
+  stats = allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+  VOLK_TEST_CHECK(stats.reallocationCount == 2 && stats.liveBytes == 0 && stats.freeCount == 3);
+}
+
+void testBlocksReturnToTheirShard(Volk& volk) {
+  VolkHostAllocator allocator(volk, kPooledScopes);
+  std::atomic<void*> pointer = nullptr;
+  void* again = nullptr;
+  std::latch freed(1);
+
+  // A block freed by another thread goes back to the shard of the allocating thread.
+  std::thread worker([&] {
+    pointer = allocate(allocator, 100, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    freed.wait();
+    again = allocate(allocator, 100, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    release(allocator, again);
+  });
+  while (!pointer.load()) {
+    std::this_thread::yield();
+  }
+  // The main thread owns another shard, whose free lists are empty.
+  auto const own = allocate(allocator, 100, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+  VOLK_TEST_CHECK(own != pointer);
+  release(allocator, pointer);
+  freed.count_down();
+  worker.join();
+  VOLK_TEST_CHECK(again == pointer);
+  release(allocator, own);
+}
+
+void testShardIsHandedOffOnThreadExit(Volk& volk) {
+  VolkHostAllocator allocator(volk, kPooledScopes);
+
+  // The shard of an exiting thread, with its free blocks, goes to the next thread which needs one.
+  void* first = nullptr;
+  std::thread([&] {
+    first = allocate(allocator, 500, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    release(allocator, first);
+  }).join();
+  void* second = nullptr;
+  std::thread([&] {
+    second = allocate(allocator, 500, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    release(allocator, second);
+  }).join();
+  VOLK_TEST_CHECK(first && second == first);
+}
+
+void testThreadsPastShardCount(Volk& volk) {
+  VolkHostAllocator allocator(volk, kPooledScopes);
+  constexpr uint32_t kThreadCount = VolkHostAllocator::kMaxThreads + 4;
+  constexpr uint32_t kIterations = 1000;
+
+  // Threads which find no free shard share the last one.
+  std::latch started(kThreadCount);
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < kThreadCount; ++t) {
+    threads.emplace_back([&allocator, &started, t] {
+      started.arrive_and_wait();
+      void* blocks[4] = {};
+      for (uint32_t i = 0; i < kIterations; ++i) {
+        auto& block = blocks[i % 4];
+        release(allocator, block);
+        block = allocate(allocator, 16 + (i + t) % 200, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+        memset(block, static_cast<int>(t), 16);
+      }
+      for (auto block : blocks) {
+        release(allocator, block);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto const stats = allocator.getStats(VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+  VOLK_TEST_CHECK(stats.allocationCount == kThreadCount * kIterations);
+  VOLK_TEST_CHECK(stats.pooledCount == stats.allocationCount);
+  VOLK_TEST_CHECK(stats.freeCount == stats.allocationCount && stats.liveBytes == 0);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreateDevice = createDevice;
+
+  testStats(volk);
+  testSizeClassPools(volk);
+  testReallocation(volk);
+  testBlocksReturnToTheirShard(volk);
+  testShardIsHandedOffOnThreadExit(volk);
+  testThreadsPastShardCount(volk);
+  return VOLK_TEST_RESULT();
+}
@@ -0,0 +1,344 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_image_uploader.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_BASE_VERSION_1_4)
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Fake device: host image copies are recorded, the staged queue's ring lives in host memory and its transfer queue
+// completes a batch when the host waits for it. Only VK_FORMAT_R8G8B8A8_UNORM supports host image transfers, into
+// VK_IMAGE_LAYOUT_GENERAL or VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL.
+std::vector<uint8_t> ringMemory;
+VkDeviceSize lastBufferSize = 0;
+uint64_t nextHandle = 1;
+uint64_t submittedValue = 0;
+uint64_t completedValue = 0;
+uint32_t formatQueries = 0;
+uint32_t stagedCopies = 0;
+VkResult transitionResult = VK_SUCCESS;
+std::vector<VkHostImageLayoutTransitionInfo> transitions;
+std::vector<VkMemoryToImageCopy> hostCopies;
+VkImageLayout hostCopyLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+template <typename Handle>
+Handle makeHandle() {
+  return reinterpret_cast<Handle>(static_cast<uintptr_t>(nextHandle++));
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties2(VkPhysicalDevice, VkPhysicalDeviceProperties2* pProperties) {
+  static VkImageLayout const layouts[] = {VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+  auto* hostImageCopy = static_cast<VkPhysicalDeviceHostImageCopyProperties*>(pProperties->pNext);
+  if (hostImageCopy->pCopyDstLayouts) {
+    std::copy(layouts, layouts + 2, hostImageCopy->pCopyDstLayouts);
+  }
+  hostImageCopy->copyDstLayoutCount = 2;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFormatProperties2(VkPhysicalDevice, VkFormat format,
+                                                              VkFormatProperties2* pFormatProperties) {
+  ++formatQueries;
+  auto* properties3 = static_cast<VkFormatProperties3*>(pFormatProperties->pNext);
+  properties3->optimalTilingFeatures =
+    format == VK_FORMAT_R8G8B8A8_UNORM ? VK_FORMAT_FEATURE_2_HOST_IMAGE_TRANSFER_BIT : 0;
+  properties3->linearTilingFeatures = 0;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL transitionImageLayout(VkDevice, uint32_t transitionCount,
+                                                     const VkHostImageLayoutTransitionInfo* pTransitions) {
+  transitions.insert(transitions.end(), pTransitions, pTransitions + transitionCount);
+  return transitionResult;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL copyMemoryToImage(VkDevice, const VkCopyMemoryToImageInfo* pCopyMemoryToImageInfo) {
+  hostCopies.insert(hostCopies.end(), pCopyMemoryToImageInfo->pRegions,
+                    pCopyMemoryToImageInfo->pRegions + pCopyMemoryToImageInfo->regionCount);
+  hostCopyLayout = pCopyMemoryToImageInfo->dstImageLayout;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createBuffer(VkDevice, const VkBufferCreateInfo* pCreateInfo,
+                                            const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+  lastBufferSize = pCreateInfo->size;
+  *pBuffer = makeHandle<VkBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements(VkDevice, VkBuffer, VkMemoryRequirements* pRequirements) {
+  pRequirements->size = lastBufferSize;
+  pRequirements->alignment = 256;
+  pRequirements->memoryTypeBits = 1;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties* pProperties) {
+  *pProperties = {};
+  pProperties->memoryTypeCount = 1;
+  pProperties->memoryTypes[0].propertyFlags =
+    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo* pAllocateInfo,
+                                              const VkAllocationCallbacks*, VkDeviceMemory* pMemory) {
+  ringMemory.assign(static_cast<size_t>(pAllocateInfo->allocationSize), 0);
+  *pMemory = makeHandle<VkDeviceMemory>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory(VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL mapMemory(VkDevice, VkDeviceMemory, VkDeviceSize, VkDeviceSize, VkMemoryMapFlags,
+                                         void** ppData) {
+  *ppData = ringMemory.data();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createCommandPool(VkDevice, const VkCommandPoolCreateInfo*,
+                                                 const VkAllocationCallbacks*, VkCommandPool* pCommandPool) {
+  *pCommandPool = makeHandle<VkCommandPool>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*,
+                                               VkSemaphore* pSemaphore) {
+  *pSemaphore = makeHandle<VkSemaphore>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL freeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroyCommandPool(VkDevice, VkCommandPool, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo*,
+                                                      VkCommandBuffer* pCommandBuffers) {
+  *pCommandBuffers = makeHandle<VkCommandBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer(VkCommandBuffer, VkCommandBufferResetFlags) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer(VkCommandBuffer, const VkCommandBufferBeginInfo*) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL endCommandBuffer(VkCommandBuffer) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBufferToImage(VkCommandBuffer, VkBuffer, VkImage, VkImageLayout, uint32_t,
+                                                const VkBufferImageCopy*) {
+  ++stagedCopies;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer, const VkDependencyInfo*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL queueSubmit2(VkQueue, uint32_t, const VkSubmitInfo2* pSubmits, VkFence) {
+  submittedValue = pSubmits->pSignalSemaphoreInfos->value;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreCounterValue(VkDevice, VkSemaphore, uint64_t* pValue) {
+  *pValue = completedValue;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores(VkDevice, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t) {
+  completedValue = std::max(completedValue, std::min(pWaitInfo->pValues[0], submittedValue));
+  return completedValue >= pWaitInfo->pValues[0] ? VK_SUCCESS : VK_TIMEOUT;
+}
+
+void reset() {
+  formatQueries = 0;
+  stagedCopies = 0;
+  transitionResult = VK_SUCCESS;
+  transitions.clear();
+  hostCopies.clear();
+  hostCopyLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+}
+
+VkBufferImageCopy makeRegion(uint32_t mipLevel, uint32_t baseArrayLayer, uint32_t layerCount,
+                             VkDeviceSize bufferOffset) {
+  VkBufferImageCopy region = {};
+  region.bufferOffset = bufferOffset;
+  region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, baseArrayLayer, layerCount};
+  region.imageExtent = {4, 4, 1};
+  return region;
+}
+
+bool hasRange(const VkHostImageLayoutTransitionInfo& transition, uint32_t mipLevel, uint32_t baseArrayLayer,
+              uint32_t layerCount) {
+  auto const& range = transition.subresourceRange;
+  return range.aspectMask == VK_IMAGE_ASPECT_COLOR_BIT && range.baseMipLevel == mipLevel && range.levelCount == 1 &&
+         range.baseArrayLayer == baseArrayLayer && range.layerCount == layerCount;
+}
+
+constexpr VkImageUsageFlags kHostUsage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_HOST_TRANSFER_BIT;
+
+void testHostCopyTransitionsRegions(Volk& volk, VolkUploadQueue& stagedQueue) {
+  reset();
+  VolkImageUploader uploader(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, stagedQueue);
+  VOLK_TEST_CHECK(uploader.isHostCopyAvailable());
+  auto const image = makeHandle<VkImage>();
+  std::vector<uint8_t> const data(96, 1);
+
+  // Two rectangles of mip 0 layer 0, and layers 1-2 of mip 2: mip 1 and layers 1-2 of mip 0 aren't discarded.
+  VkBufferImageCopy const regions[] = {makeRegion(0, 0, 1, 0), makeRegion(0, 0, 1, 32), makeRegion(2, 1, 2, 64)};
+  uint64_t value = ~0ull;
+  VOLK_TEST_CHECK(uploader.upload(image, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, kHostUsage,
+                                  VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 3, regions, data.data(), 96,
+                                  &value) == VK_SUCCESS);
+  VOLK_TEST_CHECK(value == 0);
+
+  VOLK_TEST_CHECK(transitions.size() == 2);
+  if (transitions.size() == 2) {
+    VOLK_TEST_CHECK(hasRange(transitions[0], 0, 0, 1));
+    VOLK_TEST_CHECK(hasRange(transitions[1], 2, 1, 2));
+    for (auto const& transition : transitions) {
+      VOLK_TEST_CHECK(transition.image == image);
+      VOLK_TEST_CHECK(transition.oldLayout == VK_IMAGE_LAYOUT_UNDEFINED);
+      VOLK_TEST_CHECK(transition.newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+  }
+  VOLK_TEST_CHECK(hostCopies.size() == 3);
+  if (hostCopies.size() == 3) {
+    VOLK_TEST_CHECK(hostCopies[1].pHostPointer == data.data() + 32);
+    VOLK_TEST_CHECK(hostCopies[2].imageSubresource.mipLevel == 2);
+  }
+  VOLK_TEST_CHECK(hostCopyLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+  // Format features are queried once per format and tiling.
+  VOLK_TEST_CHECK(uploader.upload(image, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, kHostUsage,
+                                  VK_IMAGE_LAYOUT_GENERAL, 1, regions, data.data(), 32, &value) == VK_SUCCESS);
+  VOLK_TEST_CHECK(formatQueries == 1);
+
+  auto const stats = uploader.getStats();
+  VOLK_TEST_CHECK(stats.hostUploads == 2);
+  VOLK_TEST_CHECK(stats.hostBytes == 128);
+  VOLK_TEST_CHECK(stats.stagedUploads == 0);
+}
+
+void testRemainingArrayLayers(Volk& volk, VolkUploadQueue& stagedQueue) {
+  reset();
+  VolkImageUploader uploader(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, stagedQueue);
+  auto const image = makeHandle<VkImage>();
+  std::vector<uint8_t> const data(64, 2);
+
+  VkBufferImageCopy const regions[] = {makeRegion(1, 2, VK_REMAINING_ARRAY_LAYERS, 0), makeRegion(1, 0, 1, 32)};
+  uint64_t value = ~0ull;
+  VOLK_TEST_CHECK(uploader.upload(image, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, kHostUsage,
+                                  VK_IMAGE_LAYOUT_GENERAL, 2, regions, data.data(), 64, &value) == VK_SUCCESS);
+  VOLK_TEST_CHECK(transitions.size() == 2);
+  if (transitions.size() == 2) {
+    VOLK_TEST_CHECK(hasRange(transitions[0], 1, 2, VK_REMAINING_ARRAY_LAYERS));
+    VOLK_TEST_CHECK(hasRange(transitions[1], 1, 0, 1));
+  }
+}
+
+void testTransitionFailure(Volk& volk, VolkUploadQueue& stagedQueue) {
+  reset();
+  VolkImageUploader uploader(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, stagedQueue);
+  auto const image = makeHandle<VkImage>();
+  std::vector<uint8_t> const data(32, 3);
+  auto const region = makeRegion(0, 0, 1, 0);
+
+  transitionResult = VK_ERROR_OUT_OF_HOST_MEMORY;
+  uint64_t value = ~0ull;
+  VOLK_TEST_CHECK(uploader.upload(image, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, kHostUsage,
+                                  VK_IMAGE_LAYOUT_GENERAL, 1, &region, data.data(), 32,
+                                  &value) == VK_ERROR_OUT_OF_HOST_MEMORY);
+  VOLK_TEST_CHECK(value == ~0ull);
+  VOLK_TEST_CHECK(hostCopies.empty());
+  VOLK_TEST_CHECK(uploader.getStats().hostUploads == 0);
+}
+
+void testStagedFallback(Volk& volk, VolkUploadQueue& stagedQueue) {
+  reset();
+  VolkImageUploader uploader(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, stagedQueue);
+  auto const image = makeHandle<VkImage>();
+  std::vector<uint8_t> const data(32, 4);
+  auto const region = makeRegion(0, 0, 1, 0);
+
+  // Without the host transfer usage, with a format lacking the feature, or into a layout the host can't copy to.
+  VOLK_TEST_CHECK(!uploader.supportsHostCopy(VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL,
+                                             VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_LAYOUT_GENERAL));
+  VOLK_TEST_CHECK(!uploader.supportsHostCopy(VK_FORMAT_R8_UNORM, VK_IMAGE_TILING_OPTIMAL, kHostUsage,
+                                             VK_IMAGE_LAYOUT_GENERAL));
+  VOLK_TEST_CHECK(!uploader.supportsHostCopy(VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_LINEAR, kHostUsage,
+                                             VK_IMAGE_LAYOUT_GENERAL));
+
+  uint64_t value = 0;
+  VOLK_TEST_CHECK(uploader.upload(image, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, kHostUsage,
+                                  VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region, data.data(), 32,
+                                  &value) == VK_SUCCESS);
+  VOLK_TEST_CHECK(value != 0);
+  VOLK_TEST_CHECK(stagedQueue.flush() == value);
+  VOLK_TEST_CHECK(stagedCopies == 1);
+  VOLK_TEST_CHECK(transitions.empty() && hostCopies.empty());
+
+  // The host path is disabled without the hostImageCopy feature.
+  VolkImageUploader disabled(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, stagedQueue, false);
+  VOLK_TEST_CHECK(!disabled.isHostCopyAvailable());
+  VOLK_TEST_CHECK(disabled.upload(image, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, kHostUsage,
+                                  VK_IMAGE_LAYOUT_GENERAL, 1, &region, data.data(), 32, &value) == VK_SUCCESS);
+  VOLK_TEST_CHECK(stagedQueue.flush() == value);
+  VOLK_TEST_CHECK(stagedCopies == 2);
+  VOLK_TEST_CHECK(transitions.empty());
+
+  auto const stats = uploader.getStats();
+  VOLK_TEST_CHECK(stats.stagedUploads == 1);
+  VOLK_TEST_CHECK(stats.stagedBytes == 32);
+  VOLK_TEST_CHECK(stats.hostUploads == 0);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetPhysicalDeviceProperties2 = getPhysicalDeviceProperties2;
+  volk.vkGetPhysicalDeviceFormatProperties2 = getPhysicalDeviceFormatProperties2;
+  volk.vkTransitionImageLayout = transitionImageLayout;
+  volk.vkCopyMemoryToImage = copyMemoryToImage;
+  volk.vkCreateBuffer = createBuffer;
+  volk.vkGetBufferMemoryRequirements = getBufferMemoryRequirements;
+  volk.vkGetPhysicalDeviceMemoryProperties = getPhysicalDeviceMemoryProperties;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkBindBufferMemory = bindBufferMemory;
+  volk.vkMapMemory = mapMemory;
+  volk.vkCreateCommandPool = createCommandPool;
+  volk.vkCreateSemaphore = createSemaphore;
+  volk.vkDestroyBuffer = destroyBuffer;
+  volk.vkFreeMemory = freeMemory;
+  volk.vkDestroyCommandPool = destroyCommandPool;
+  volk.vkDestroySemaphore = destroySemaphore;
+  volk.vkAllocateCommandBuffers = allocateCommandBuffers;
+  volk.vkResetCommandBuffer = resetCommandBuffer;
+  volk.vkBeginCommandBuffer = beginCommandBuffer;
+  volk.vkEndCommandBuffer = endCommandBuffer;
+  volk.vkCmdCopyBufferToImage = cmdCopyBufferToImage;
+  volk.vkCmdPipelineBarrier2 = cmdPipelineBarrier2;
+  volk.vkQueueSubmit2 = queueSubmit2;
+  volk.vkGetSemaphoreCounterValue = getSemaphoreCounterValue;
+  volk.vkWaitSemaphores = waitSemaphores;
+
+  VolkUploadQueue stagedQueue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0, 4096);
+  testHostCopyTransitionsRegions(volk, stagedQueue);
+  testRemainingArrayLayers(volk, stagedQueue);
+  testTransitionFailure(volk, stagedQueue);
+  testStagedFallback(volk, stagedQueue);
+  return VOLK_TEST_RESULT();
+}
+
+#else
+int main() {
+  return 0;
+}
+#endif
@@ -0,0 +1,347 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_job_graph.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_BASE_VERSION_1_3)
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Fake timeline semaphores and a fake GPU thread executing submitted batches in queue order once their waits are
+// satisfied. Executed GPU batches and finished CPU tasks are appended to the same log.
+struct Batch {
+  uintptr_t id = 0; // the first command buffer
+  std::vector<std::pair<VkSemaphore, uint64_t>> waits;
+  std::vector<std::pair<VkSemaphore, uint64_t>> signals;
+};
+
+struct Submission {
+  VkQueue queue = VK_NULL_HANDLE;
+  std::vector<Batch> batches;
+  size_t logSize = 0; // log entries when the submission was made
+};
+
+std::mutex mutex;
+std::condition_variable changed;
+std::map<VkSemaphore, uint64_t> values;
+std::map<VkQueue, std::deque<Batch>> queued;
+std::vector<Submission> submissions;
+std::vector<uintptr_t> log;
+bool gpuPaused = false;
+bool gpuStop = false;
+VkResult submitResult = VK_SUCCESS;
+uint64_t nextSemaphore = 1;
+
+template <typename T>
+T handle(uintptr_t value) {
+  return reinterpret_cast<T>(value);
+}
+
+void reset() {
+  std::lock_guard lock(mutex);
+  queued.clear();
+  submissions.clear();
+  log.clear();
+  gpuPaused = false;
+  submitResult = VK_SUCCESS;
+}
+
+void record(uintptr_t id) {
+  std::lock_guard lock(mutex);
+  log.push_back(id);
+}
+
+void setGpuPaused(bool paused) {
+  std::lock_guard lock(mutex);
+  gpuPaused = paused;
+  changed.notify_all();
+}
+
+size_t submissionCount() {
+  std::unique_lock lock(mutex);
+  return submissions.size();
+}
+
+bool waitForSubmissions(size_t count) {
+  std::unique_lock lock(mutex);
+  return changed.wait_for(lock, std::chrono::seconds(5), [count] { return submissions.size() >= count; });
+}
+
+bool isReady(const Batch& batch) {
+  for (auto const& [semaphore, value] : batch.waits) {
+    if (values[semaphore] < value) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void runGpu() {
+  std::unique_lock lock(mutex);
+  for (;;) {
+    Batch* ready = nullptr;
+    std::deque<Batch>* queue = nullptr;
+    changed.wait(lock, [&] {
+      if (gpuStop) {
+        return true;
+      }
+      for (auto& [_, batches] : queued) {
+        if (!gpuPaused && !batches.empty() && isReady(batches.front())) {
+          ready = &batches.front();
+          queue = &batches;
+          return true;
+        }
+      }
+      return false;
+    });
+    if (!ready) {
+      return;
+    }
+    log.push_back(ready->id);
+    for (auto const& [semaphore, value] : ready->signals) {
+      values[semaphore] = value;
+    }
+    queue->pop_front();
+    changed.notify_all();
+  }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*,
+                                               VkSemaphore* pSemaphore) {
+  std::lock_guard lock(mutex);
+  *pSemaphore = handle<VkSemaphore>(nextSemaphore++);
+  values[*pSemaphore] = 0;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreCounterValue(VkDevice, VkSemaphore semaphore, uint64_t* pValue) {
+  std::lock_guard lock(mutex);
+  *pValue = values[semaphore];
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL signalSemaphore(VkDevice, const VkSemaphoreSignalInfo* pSignalInfo) {
+  std::lock_guard lock(mutex);
+  values[pSignalInfo->semaphore] = pSignalInfo->value;
+  changed.notify_all();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores(VkDevice, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t) {
+  std::unique_lock lock(mutex);
+  changed.wait(lock, [pWaitInfo] {
+    for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; ++i) {
+      if (values[pWaitInfo->pSemaphores[i]] >= pWaitInfo->pValues[i]) {
+        return true;
+      }
+    }
+    return false;
+  });
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL queueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits,
+                                            VkFence) {
+  std::lock_guard lock(mutex);
+  Submission submission;
+  submission.queue = queue;
+  submission.logSize = log.size();
+  for (uint32_t i = 0; i < submitCount; ++i) {
+    auto const& submit = pSubmits[i];
+    Batch batch;
+    batch.id = reinterpret_cast<uintptr_t>(submit.pCommandBufferInfos[0].commandBuffer);
+    for (uint32_t j = 0; j < submit.waitSemaphoreInfoCount; ++j) {
+      batch.waits.emplace_back(submit.pWaitSemaphoreInfos[j].semaphore, submit.pWaitSemaphoreInfos[j].value);
+    }
+    for (uint32_t j = 0; j < submit.signalSemaphoreInfoCount; ++j) {
+      batch.signals.emplace_back(submit.pSignalSemaphoreInfos[j].semaphore, submit.pSignalSemaphoreInfos[j].value);
+    }
+    submission.batches.push_back(batch);
+  }
+  submissions.push_back(submission);
+  changed.notify_all();
+  if (submitResult != VK_SUCCESS) {
+    return submitResult;
+  }
+  for (auto const& batch : submission.batches) {
+    queued[queue].push_back(batch);
+  }
+  return VK_SUCCESS;
+}
+
+uint32_t addGpuNode(VolkJobGraph& graph, VkQueue queue, uintptr_t id, std::vector<uint32_t> dependencies = {}) {
+  VkCommandBufferSubmitInfo commandBufferInfo = {};
+  commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+  commandBufferInfo.commandBuffer = handle<VkCommandBuffer>(id);
+  return graph.addGpuNode(queue, 1, &commandBufferInfo, static_cast<uint32_t>(dependencies.size()),
+                          dependencies.data());
+}
+
+uint32_t addCpuNode(VolkJobGraph& graph, uintptr_t id, std::vector<uint32_t> dependencies = {}) {
+  return graph.addCpuNode([id] { record(id); }, static_cast<uint32_t>(dependencies.size()), dependencies.data());
+}
+
+void testCpuAndGpuEdges(Volk& volk, VolkThreadPool& pool) {
+  reset();
+  VolkJobGraph graph(volk, VK_NULL_HANDLE, pool);
+  VOLK_TEST_CHECK(graph.getStatus() == VK_SUCCESS);
+  auto const queue = handle<VkQueue>(1);
+
+  // CPU -> GPU -> CPU
+  auto const upload = addCpuNode(graph, 1);
+  auto const render = addGpuNode(graph, queue, 100, {upload});
+  auto const readback = addCpuNode(graph, 2, {render});
+  VOLK_TEST_CHECK(readback == 2);
+  VOLK_TEST_CHECK(addCpuNode(graph, 3, {5}) == VolkJobGraph::kInvalidNode);
+
+  VOLK_TEST_CHECK(graph.execute() == VK_SUCCESS);
+  VOLK_TEST_CHECK((log == std::vector<uintptr_t>{1, 100, 2}));
+  VOLK_TEST_CHECK(submissions.size() == 1);
+  if (submissions.size() == 1) {
+    // The GPU node was submitted after its CPU dependency finished and doesn't wait on a semaphore for it.
+    VOLK_TEST_CHECK(submissions[0].logSize == 1);
+    VOLK_TEST_CHECK(submissions[0].batches.size() == 1 && submissions[0].batches[0].waits.empty());
+  }
+  auto const signal = graph.getSignal(render);
+  VOLK_TEST_CHECK(signal.semaphore != VK_NULL_HANDLE && signal.value == 1);
+  VOLK_TEST_CHECK(graph.getSignal(upload).semaphore == VK_NULL_HANDLE);
+
+  // The graph can run again; the queue semaphore keeps counting.
+  reset();
+  VOLK_TEST_CHECK(graph.execute() == VK_SUCCESS);
+  VOLK_TEST_CHECK((log == std::vector<uintptr_t>{1, 100, 2}));
+  VOLK_TEST_CHECK(graph.getSignal(render).value == 2);
+}
+
+void testGpuEdgesAcrossQueues(Volk& volk, VolkThreadPool& pool) {
+  reset();
+  VolkJobGraph graph(volk, VK_NULL_HANDLE, pool);
+  auto const graphics = handle<VkQueue>(1);
+  auto const compute = handle<VkQueue>(2);
+
+  auto const shadow = addGpuNode(graph, graphics, 100);
+  auto const cull = addGpuNode(graph, compute, 200, {shadow});
+  auto const lighting = addGpuNode(graph, graphics, 101, {shadow, cull});
+  auto const done = addCpuNode(graph, 1, {lighting});
+  (void)done;
+
+  // GPU-to-GPU edges don't return to the host: everything is submitted while the GPU is stalled.
+  setGpuPaused(true);
+  auto result = std::async(std::launch::async, [&graph] { return graph.execute(); });
+  VOLK_TEST_CHECK(waitForSubmissions(2));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  VOLK_TEST_CHECK(submissionCount() == 2);
+  VOLK_TEST_CHECK(result.wait_for(std::chrono::milliseconds(0)) == std::future_status::timeout);
+  setGpuPaused(false);
+  VOLK_TEST_CHECK(result.get() == VK_SUCCESS);
+
+  VOLK_TEST_CHECK((log == std::vector<uintptr_t>{100, 200, 101, 1}));
+  VOLK_TEST_CHECK(submissions.size() == 2);
+  if (submissions.size() == 2) {
+    // One vkQueueSubmit2 per queue; a dependent on the same queue lands in the same call as its dependency.
+    auto const& first = submissions[0].queue == graphics ? submissions[0] : submissions[1];
+    auto const& second = submissions[0].queue == graphics ? submissions[1] : submissions[0];
+    VOLK_TEST_CHECK(first.queue == graphics && second.queue == compute);
+    VOLK_TEST_CHECK(first.batches.size() == 2 && second.batches.size() == 1);
+    if (first.batches.size() == 2 && second.batches.size() == 1) {
+      auto const shadowSignal = graph.getSignal(shadow);
+      auto const cullSignal = graph.getSignal(cull);
+      VOLK_TEST_CHECK(shadowSignal.semaphore != cullSignal.semaphore);
+      VOLK_TEST_CHECK(first.batches[0].id == 100 && first.batches[0].waits.empty());
+      VOLK_TEST_CHECK((second.batches[0].waits ==
+                       std::vector<std::pair<VkSemaphore, uint64_t>>{{shadowSignal.semaphore, shadowSignal.value}}));
+      VOLK_TEST_CHECK(first.batches[1].id == 101);
+      VOLK_TEST_CHECK((first.batches[1].waits ==
+                       std::vector<std::pair<VkSemaphore, uint64_t>>{{shadowSignal.semaphore, shadowSignal.value},
+                                                                      {cullSignal.semaphore, cullSignal.value}}));
+    }
+  }
+}
+
+void testErrorWaitsForRunningCpuNodes(Volk& volk, VolkThreadPool& pool) {
+  reset();
+  VolkJobGraph graph(volk, VK_NULL_HANDLE, pool);
+  auto const queue = handle<VkQueue>(1);
+
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  auto const slow = graph.addCpuNode([released] {
+    released.wait();
+    record(1);
+  });
+  addCpuNode(graph, 2, {slow});
+  auto const quick = addCpuNode(graph, 3);
+  auto const failing = addGpuNode(graph, queue, 100, {quick});
+  addGpuNode(graph, queue, 101, {failing});
+  {
+    std::lock_guard lock(mutex);
+    submitResult = VK_ERROR_DEVICE_LOST;
+  }
+
+  // The submission fails while the slow node is running: execute() reports the error once it has finished and
+  // starts nothing else.
+  auto result = std::async(std::launch::async, [&graph] { return graph.execute(); });
+  VOLK_TEST_CHECK(waitForSubmissions(1));
+  VOLK_TEST_CHECK(result.wait_for(std::chrono::milliseconds(20)) == std::future_status::timeout);
+  release.set_value();
+  VOLK_TEST_CHECK(result.get() == VK_ERROR_DEVICE_LOST);
+  VOLK_TEST_CHECK((log == std::vector<uintptr_t>{3, 1}));
+  VOLK_TEST_CHECK(submissions.size() == 1);
+  if (submissions.size() == 1) {
+    VOLK_TEST_CHECK(submissions[0].batches.size() == 2);
+  }
+}
+
+void testMissingTimelineSemaphores(VolkThreadPool& pool) {
+  Volk volk;
+  VolkJobGraph graph(volk, VK_NULL_HANDLE, pool);
+  VOLK_TEST_CHECK(graph.getStatus() == VK_ERROR_EXTENSION_NOT_PRESENT);
+  VOLK_TEST_CHECK(addGpuNode(graph, handle<VkQueue>(1), 100) == VolkJobGraph::kInvalidNode);
+  VOLK_TEST_CHECK(graph.execute() == VK_ERROR_EXTENSION_NOT_PRESENT);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreateSemaphore = createSemaphore;
+  volk.vkDestroySemaphore = destroySemaphore;
+  volk.vkGetSemaphoreCounterValue = getSemaphoreCounterValue;
+  volk.vkSignalSemaphore = signalSemaphore;
+  volk.vkWaitSemaphores = waitSemaphores;
+  volk.vkQueueSubmit2 = queueSubmit2;
+
+  std::thread gpu(runGpu);
+  {
+    VolkThreadPool pool(2);
+    testCpuAndGpuEdges(volk, pool);
+    testGpuEdgesAcrossQueues(volk, pool);
+    testErrorWaitsForRunningCpuNodes(volk, pool);
+    testMissingTimelineSemaphores(pool);
+  }
+  {
+    std::lock_guard lock(mutex);
+    gpuStop = true;
+    changed.notify_all();
+  }
+  gpu.join();
+  return VOLK_TEST_RESULT();
+}
+
+#else
+int main() {
+  return 0;
+}
+#endif
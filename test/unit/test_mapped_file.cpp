@@ -0,0 +1,86 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_mapped_file.hpp"
+#include "volk_test.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string writeFile(const char* name, const std::vector<uint8_t>& contents) {
+  auto const path = (std::filesystem::temp_directory_path() / name).string();
+  auto* file = std::fopen(path.c_str(), "wb");
+  if (file) {
+    if (!contents.empty()) {
+      std::fwrite(contents.data(), 1, contents.size(), file);
+    }
+    std::fclose(file);
+  }
+  return path;
+}
+
+bool hasContents(const VolkMappedFile& file, const std::vector<uint8_t>& contents) {
+  return file.isOpen() && file.getSize() == contents.size() &&
+         std::memcmp(file.getData(), contents.data(), contents.size()) == 0;
+}
+
+void testMapping() {
+  std::vector<uint8_t> small(100);
+  std::vector<uint8_t> large(3 * 65536 + 17);
+  for (size_t i = 0; i < large.size(); ++i) {
+    large[i] = static_cast<uint8_t>(i * 7);
+    if (i < small.size()) {
+      small[i] = static_cast<uint8_t>(255 - i);
+    }
+  }
+  auto const smallPath = writeFile("volk_test_mapped_file_small", small);
+  auto const largePath = writeFile("volk_test_mapped_file_large", large);
+
+  VolkMappedFile file(smallPath.c_str());
+  VOLK_TEST_CHECK(hasContents(file, small));
+
+  // Opening another file replaces the mapping.
+  VOLK_TEST_CHECK(file.open(largePath.c_str()));
+  VOLK_TEST_CHECK(hasContents(file, large));
+
+  file.close();
+  VOLK_TEST_CHECK(!file.isOpen());
+  VOLK_TEST_CHECK(file.getData() == nullptr && file.getSize() == 0);
+  file.close();
+
+  std::remove(smallPath.c_str());
+  std::remove(largePath.c_str());
+}
+
+void testFailures() {
+  auto const emptyPath = writeFile("volk_test_mapped_file_empty", {});
+  auto const missingPath = (std::filesystem::temp_directory_path() / "volk_test_mapped_file_missing").string();
+  std::remove(missingPath.c_str());
+
+  VolkMappedFile file;
+  VOLK_TEST_CHECK(!file.isOpen());
+  VOLK_TEST_CHECK(!file.open(missingPath.c_str()));
+  VOLK_TEST_CHECK(!file.open(emptyPath.c_str()));
+  VOLK_TEST_CHECK(!file.isOpen() && file.getSize() == 0);
+
+  // A failed open still closes the previous mapping.
+  auto const path = writeFile("volk_test_mapped_file_replaced", {1, 2, 3});
+  VOLK_TEST_CHECK(file.open(path.c_str()));
+  VOLK_TEST_CHECK(!file.open(missingPath.c_str()));
+  VOLK_TEST_CHECK(!file.isOpen() && file.getData() == nullptr);
+
+  std::remove(emptyPath.c_str());
+  std::remove(path.c_str());
+}
+
+} // namespace
+
+int main() {
+  testMapping();
+  testFailures();
+  return VOLK_TEST_RESULT();
+}
@@ -0,0 +1,187 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_mapping_cache.hpp"
+#include "volk_test.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+// Fake device: memory type 0 is host visible, type 1 host visible and coherent. Flushed ranges are recorded.
+constexpr VkDeviceSize kAtomSize = 64;
+
+std::vector<VkMappedMemoryRange> flushed;
+std::vector<uint8_t> hostMemory(1 << 16);
+uint32_t driverUnmaps = 0;
+uint64_t nextMemory = 1;
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties(VkPhysicalDevice, VkPhysicalDeviceProperties* pProperties) {
+  *pProperties = {};
+  pProperties->limits.nonCoherentAtomSize = kAtomSize;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties* pProperties) {
+  *pProperties = {};
+  pProperties->memoryTypeCount = 2;
+  pProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+  pProperties->memoryTypes[1].propertyFlags =
+    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo*, const VkAllocationCallbacks*,
+                                              VkDeviceMemory* pMemory) {
+  *pMemory = reinterpret_cast<VkDeviceMemory>(static_cast<uintptr_t>(nextMemory++));
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL freeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL mapMemory(VkDevice, VkDeviceMemory, VkDeviceSize, VkDeviceSize, VkMemoryMapFlags,
+                                         void** ppData) {
+  *ppData = hostMemory.data();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL unmapMemory(VkDevice, VkDeviceMemory) {
+  ++driverUnmaps;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL flushMappedMemoryRanges(VkDevice, uint32_t memoryRangeCount,
+                                                       const VkMappedMemoryRange* pMemoryRanges) {
+  flushed.assign(pMemoryRanges, pMemoryRanges + memoryRangeCount);
+  return VK_SUCCESS;
+}
+
+VkDeviceMemory allocate(VolkMappingCache& cache, uint32_t memoryTypeIndex, VkDeviceSize size) {
+  VkMemoryAllocateInfo allocateInfo = {};
+  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.allocationSize = size;
+  allocateInfo.memoryTypeIndex = memoryTypeIndex;
+  VkDeviceMemory memory = VK_NULL_HANDLE;
+  (void)cache.vkAllocateMemory(VK_NULL_HANDLE, &allocateInfo, nullptr, &memory);
+  return memory;
+}
+
+bool isRange(const VkMappedMemoryRange& range, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size) {
+  return range.memory == memory && range.offset == offset && range.size == size;
+}
+
+void testRangesAreRoundedToAtoms(Volk& volk) {
+  VolkMappingCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  auto const memory = allocate(cache, 0, 1000);
+
+  cache.flush(memory, 70, 10);
+  VOLK_TEST_CHECK(cache.flushRanges() == VK_SUCCESS);
+  VOLK_TEST_CHECK(flushed.size() == 1 && isRange(flushed[0], memory, 64, 64));
+
+  // The last atom is cut by the end of the allocation, so the range becomes VK_WHOLE_SIZE.
+  cache.flush(memory, 990, 10);
+  VOLK_TEST_CHECK(cache.flushRanges() == VK_SUCCESS);
+  VOLK_TEST_CHECK(flushed.size() == 1 && isRange(flushed[0], memory, 960, VK_WHOLE_SIZE));
+}
+
+void testRangesAreMerged(Volk& volk) {
+  VolkMappingCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  auto const memory = allocate(cache, 0, 4096);
+  auto const other = allocate(cache, 0, 4096);
+
+  cache.flush(memory, 300, 10);   // [256, 320)
+  cache.flush(other, 0, 64);      // [0, 64)
+  cache.flush(memory, 0, 100);    // [0, 128)
+  cache.flush(memory, 100, 100);  // [64, 256), overlaps the previous one
+  cache.flush(memory, 256, 64);   // [256, 320), adjacent and duplicate
+  cache.flush(memory, 1024, 64);  // [1024, 1088), separate
+  VOLK_TEST_CHECK(cache.flushRanges() == VK_SUCCESS);
+  VOLK_TEST_CHECK(flushed.size() == 3);
+  VOLK_TEST_CHECK(isRange(flushed[0], memory, 0, 320));
+  VOLK_TEST_CHECK(isRange(flushed[1], memory, 1024, 64));
+  VOLK_TEST_CHECK(isRange(flushed[2], other, 0, 64));
+  VOLK_TEST_CHECK(cache.getStats().flushedRanges == 3);
+
+  // VK_WHOLE_SIZE absorbs the later ranges of the same memory.
+  cache.flush(memory, 128, VK_WHOLE_SIZE);
+  cache.flush(memory, 2048, 64);
+  cache.flush(memory, 0, 10);
+  VOLK_TEST_CHECK(cache.flushRanges() == VK_SUCCESS);
+  VOLK_TEST_CHECK(flushed.size() == 2);
+  VOLK_TEST_CHECK(isRange(flushed[0], memory, 0, 64));
+  VOLK_TEST_CHECK(isRange(flushed[1], memory, 128, VK_WHOLE_SIZE));
+}
+
+void testCoherentMemoryIsNotFlushed(Volk& volk) {
+  VolkMappingCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  auto const memory = allocate(cache, 1, 4096);
+
+  flushed.clear();
+  cache.flush(memory, 0, 64);
+  VOLK_TEST_CHECK(cache.flushRanges() == VK_SUCCESS);
+  VOLK_TEST_CHECK(flushed.empty());
+  VOLK_TEST_CHECK(cache.getStats().flushCalls == 0);
+}
+
+void testUnknownSizeIsNotRoundedUp(Volk& volk) {
+  VolkMappingCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  auto const memory = reinterpret_cast<VkDeviceMemory>(static_cast<uintptr_t>(nextMemory++));
+
+  // Memory allocated elsewhere may end in the middle of an atom, so only the start is rounded.
+  cache.flush(memory, 70, 26);
+  VOLK_TEST_CHECK(cache.flushRanges() == VK_SUCCESS);
+  VOLK_TEST_CHECK(flushed.size() == 1 && isRange(flushed[0], memory, 64, 32));
+}
+
+#if defined(VK_KHR_map_memory2)
+VKAPI_ATTR VkResult VKAPI_CALL unmapMemory2(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo) {
+  unmapMemory(device, pMemoryUnmapInfo->memory);
+  return VK_SUCCESS;
+}
+
+void testUnmapWithPNextDropsMapping(Volk& volk) {
+  VolkMappingCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  auto const memory = allocate(cache, 0, 4096);
+
+  void* data = nullptr;
+  VOLK_TEST_CHECK(cache.vkMapMemory(VK_NULL_HANDLE, memory, 0, VK_WHOLE_SIZE, 0, &data) == VK_SUCCESS);
+  cache.vkUnmapMemory(VK_NULL_HANDLE, memory);
+  VOLK_TEST_CHECK(cache.vkMapMemory(VK_NULL_HANDLE, memory, 64, VK_WHOLE_SIZE, 0, &data) == VK_SUCCESS);
+  VOLK_TEST_CHECK(data == hostMemory.data() + 64);
+  VOLK_TEST_CHECK(cache.getStats().driverMaps == 1 && cache.getStats().cachedMaps == 1);
+
+  // The driver unmaps the memory, so the next map call must map it again.
+  VkBaseInStructure next = {};
+  VkMemoryUnmapInfoKHR unmapInfo = {};
+  unmapInfo.sType = VK_STRUCTURE_TYPE_MEMORY_UNMAP_INFO_KHR;
+  unmapInfo.pNext = &next;
+  unmapInfo.memory = memory;
+  auto const unmaps = driverUnmaps;
+  VOLK_TEST_CHECK(cache.vkUnmapMemory2KHR(VK_NULL_HANDLE, &unmapInfo) == VK_SUCCESS);
+  VOLK_TEST_CHECK(driverUnmaps == unmaps + 1);
+  VOLK_TEST_CHECK(cache.vkMapMemory(VK_NULL_HANDLE, memory, 0, VK_WHOLE_SIZE, 0, &data) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getStats().driverMaps == 2);
+}
+#endif
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetPhysicalDeviceProperties = getPhysicalDeviceProperties;
+  volk.vkGetPhysicalDeviceMemoryProperties = getPhysicalDeviceMemoryProperties;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkFreeMemory = freeMemory;
+  volk.vkMapMemory = mapMemory;
+  volk.vkUnmapMemory = unmapMemory;
+#if defined(VK_KHR_map_memory2)
+  volk.vkUnmapMemory2KHR = unmapMemory2;
+#endif
+  volk.vkFlushMappedMemoryRanges = flushMappedMemoryRanges;
+
+  testRangesAreRoundedToAtoms(volk);
+  testRangesAreMerged(volk);
+  testCoherentMemoryIsNotFlushed(volk);
+  testUnknownSizeIsNotRoundedUp(volk);
+#if defined(VK_KHR_map_memory2)
+  testUnmapWithPNextDropsMapping(volk);
+#endif
+  return VOLK_TEST_RESULT();
+}
@@ -0,0 +1,210 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_memory_telemetry.hpp"
+#include "volk_test.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace {
+
+// Fake device: memory type 0 lives in heap 0, memory type 1 in heap 1. Freed handles are handed out again first, like
+// drivers which recycle their allocation objects.
+constexpr VkDeviceSize kHeapSize = 1 << 20;
+
+std::vector<VkDeviceMemory> freedHandles;
+std::function<void()> onFree;
+uint64_t nextMemory = 1;
+bool failAllocations = false;
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties* pProperties) {
+  *pProperties = {};
+  pProperties->memoryTypeCount = 2;
+  pProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  pProperties->memoryTypes[0].heapIndex = 0;
+  pProperties->memoryTypes[1].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+  pProperties->memoryTypes[1].heapIndex = 1;
+  pProperties->memoryHeapCount = 2;
+  pProperties->memoryHeaps[0].size = kHeapSize;
+  pProperties->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+  pProperties->memoryHeaps[1].size = kHeapSize;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo*, const VkAllocationCallbacks*,
+                                              VkDeviceMemory* pMemory) {
+  if (failAllocations) {
+    return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+  }
+  if (!freedHandles.empty()) {
+    *pMemory = freedHandles.back();
+    freedHandles.pop_back();
+  } else {
+    *pMemory = reinterpret_cast<VkDeviceMemory>(static_cast<uintptr_t>(nextMemory++));
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL freeMemory(VkDevice, VkDeviceMemory memory, const VkAllocationCallbacks*) {
+  if (memory != VK_NULL_HANDLE) {
+    freedHandles.push_back(memory);
+  }
+  if (onFree) {
+    onFree();
+  }
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL mapMemory(VkDevice, VkDeviceMemory, VkDeviceSize, VkDeviceSize, VkMemoryMapFlags,
+                                         void** ppData) {
+  *ppData = nullptr;
+  return VK_SUCCESS;
+}
+
+VkDeviceMemory allocate(VolkMemoryTelemetry& telemetry, uint32_t memoryTypeIndex, VkDeviceSize size) {
+  VkMemoryAllocateInfo allocateInfo = {};
+  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.allocationSize = size;
+  allocateInfo.memoryTypeIndex = memoryTypeIndex;
+  VkDeviceMemory memory = VK_NULL_HANDLE;
+  (void)telemetry.vkAllocateMemory(VK_NULL_HANDLE, &allocateInfo, nullptr, &memory);
+  return memory;
+}
+
+void testAllocateAndFree(Volk& volk) {
+  VolkMemoryTelemetry telemetry(volk, VK_NULL_HANDLE, false);
+  auto const a = allocate(telemetry, 0, 4096);
+  auto const b = allocate(telemetry, 0, 1000);
+  auto const c = allocate(telemetry, 1, 65536);
+  void* data = nullptr;
+  (void)telemetry.vkMapMemory(VK_NULL_HANDLE, c, 0, VK_WHOLE_SIZE, 0, &data);
+
+  VolkMemoryTelemetry::Snapshot snapshot;
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(snapshot.memoryTypeCount == 2 && snapshot.memoryHeapCount == 2);
+  auto const& type0 = snapshot.types[0];
+  VOLK_TEST_CHECK(type0.heapIndex == 0 && type0.propertyFlags == VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  VOLK_TEST_CHECK(type0.liveBytes == 5096 && type0.peakBytes == 5096);
+  VOLK_TEST_CHECK(type0.liveAllocations == 2 && type0.allocationCount == 2 && type0.freeCount == 0);
+  // 4096 falls into (2048, 4096], 1000 into (512, 1024].
+  VOLK_TEST_CHECK(type0.sizeHistogram[12] == 1 && type0.sizeHistogram[10] == 1);
+  VOLK_TEST_CHECK(snapshot.types[1].liveBytes == 65536 && snapshot.types[1].mapCount == 1);
+  VOLK_TEST_CHECK(snapshot.heaps[0].liveBytes == 5096 && snapshot.heaps[0].size == kHeapSize);
+  VOLK_TEST_CHECK(snapshot.heaps[0].flags == VK_MEMORY_HEAP_DEVICE_LOCAL_BIT);
+  VOLK_TEST_CHECK(snapshot.heaps[1].liveBytes == 65536);
+  VOLK_TEST_CHECK(snapshot.heaps[0].budget == 0 && snapshot.heaps[0].usage == 0);
+
+  telemetry.vkFreeMemory(VK_NULL_HANDLE, a, nullptr);
+  telemetry.vkFreeMemory(VK_NULL_HANDLE, VK_NULL_HANDLE, nullptr);
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(snapshot.types[0].liveBytes == 1000 && snapshot.types[0].peakBytes == 5096);
+  VOLK_TEST_CHECK(snapshot.types[0].liveAllocations == 1 && snapshot.types[0].freeCount == 1);
+  VOLK_TEST_CHECK(snapshot.heaps[0].liveBytes == 1000 && snapshot.heaps[0].peakBytes == 5096);
+  uint64_t lifetimes = 0;
+  for (auto const count : snapshot.types[0].lifetimeHistogram) {
+    lifetimes += count;
+  }
+  VOLK_TEST_CHECK(lifetimes == 1);
+
+  telemetry.vkFreeMemory(VK_NULL_HANDLE, b, nullptr);
+  telemetry.vkFreeMemory(VK_NULL_HANDLE, c, nullptr);
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(snapshot.types[0].liveBytes == 0 && snapshot.types[1].liveBytes == 0);
+  VOLK_TEST_CHECK(snapshot.heaps[0].liveBytes == 0 && snapshot.heaps[1].liveBytes == 0);
+  VOLK_TEST_CHECK(telemetry.getUntrackedCount() == 0);
+}
+
+void testFailedAndUntrackedAllocations(Volk& volk) {
+  VolkMemoryTelemetry telemetry(volk, VK_NULL_HANDLE, false, 2);
+  failAllocations = true;
+  (void)allocate(telemetry, 0, 4096);
+  failAllocations = false;
+
+  // The table holds two allocations; the third is counted but not tracked.
+  VkDeviceMemory memory[3] = {};
+  for (auto& m : memory) {
+    m = allocate(telemetry, 0, 100);
+  }
+  VolkMemoryTelemetry::Snapshot snapshot;
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(snapshot.types[0].failedCount == 1);
+  VOLK_TEST_CHECK(snapshot.types[0].allocationCount == 3);
+  VOLK_TEST_CHECK(snapshot.types[0].liveAllocations == 2 && snapshot.types[0].liveBytes == 200);
+  VOLK_TEST_CHECK(telemetry.getUntrackedCount() == 1);
+
+  for (auto const m : memory) {
+    telemetry.vkFreeMemory(VK_NULL_HANDLE, m, nullptr);
+  }
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(snapshot.types[0].liveAllocations == 0 && snapshot.types[0].liveBytes == 0);
+  VOLK_TEST_CHECK(snapshot.types[0].freeCount == 2);
+}
+
+void testFreedHandleIsReusedDuringFree(Volk& volk) {
+  // The table is full, so the new allocation can only be tracked if the freed one was forgotten first.
+  VolkMemoryTelemetry telemetry(volk, VK_NULL_HANDLE, false, 2);
+  auto const memory = allocate(telemetry, 0, 4096);
+  auto const other = allocate(telemetry, 0, 100);
+
+  // Another thread allocates as soon as the driver releases the handle, and gets the same handle back.
+  VkDeviceMemory reused = VK_NULL_HANDLE;
+  onFree = [&] {
+    onFree = nullptr;
+    reused = allocate(telemetry, 1, 256);
+  };
+  telemetry.vkFreeMemory(VK_NULL_HANDLE, memory, nullptr);
+  VOLK_TEST_CHECK(reused == memory);
+
+  VolkMemoryTelemetry::Snapshot snapshot;
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(telemetry.getUntrackedCount() == 0);
+  VOLK_TEST_CHECK(snapshot.types[0].liveAllocations == 1 && snapshot.types[0].liveBytes == 100);
+  VOLK_TEST_CHECK(snapshot.types[1].liveAllocations == 1 && snapshot.types[1].liveBytes == 256);
+
+  telemetry.vkFreeMemory(VK_NULL_HANDLE, reused, nullptr);
+  telemetry.vkFreeMemory(VK_NULL_HANDLE, other, nullptr);
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(snapshot.types[1].liveAllocations == 0 && snapshot.types[1].freeCount == 1);
+}
+
+void testChurn(Volk& volk) {
+  VolkMemoryTelemetry telemetry(volk, VK_NULL_HANDLE, false, 64);
+  constexpr uint32_t kRounds = 1000;
+  VkDeviceMemory live[8] = {};
+  for (uint32_t round = 0; round < kRounds; ++round) {
+    auto& slot = live[round % 8];
+    telemetry.vkFreeMemory(VK_NULL_HANDLE, slot, nullptr);
+    slot = allocate(telemetry, round % 2, 1024);
+  }
+
+  VolkMemoryTelemetry::Snapshot snapshot;
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(snapshot.types[0].allocationCount + snapshot.types[1].allocationCount == kRounds);
+  VOLK_TEST_CHECK(snapshot.types[0].freeCount + snapshot.types[1].freeCount == kRounds - 8);
+  VOLK_TEST_CHECK(snapshot.types[0].liveBytes + snapshot.types[1].liveBytes == 8 * 1024);
+  VOLK_TEST_CHECK(snapshot.types[0].peakBytes <= 8 * 1024);
+  VOLK_TEST_CHECK(snapshot.allocationsPerSecond > 0.0 && snapshot.freesPerSecond > 0.0);
+  VOLK_TEST_CHECK(telemetry.getUntrackedCount() == 0);
+
+  for (auto const memory : live) {
+    telemetry.vkFreeMemory(VK_NULL_HANDLE, memory, nullptr);
+  }
+  telemetry.getSnapshot(&snapshot);
+  VOLK_TEST_CHECK(snapshot.heaps[0].liveBytes == 0 && snapshot.heaps[1].liveBytes == 0);
+  VOLK_TEST_CHECK(snapshot.allocationsPerSecond == 0.0);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetPhysicalDeviceMemoryProperties = getPhysicalDeviceMemoryProperties;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkFreeMemory = freeMemory;
+  volk.vkMapMemory = mapMemory;
+
+  testAllocateAndFree(volk);
+  testFailedAndUntrackedAllocations(volk);
+  testFreedHandleIsReusedDuringFree(volk);
+  testChurn(volk);
+  return VOLK_TEST_RESULT();
+}
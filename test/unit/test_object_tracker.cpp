@@ -0,0 +1,312 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_object_tracker.hpp"
+#include "volk_test.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::atomic<uint64_t> nextHandle = 0x100;
+
+template <typename Handle>
+Handle makeHandle(uint64_t value) {
+  return reinterpret_cast<Handle>(value);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createBuffer(VkDevice, const VkBufferCreateInfo*, const VkAllocationCallbacks*,
+                                            VkBuffer* pBuffer) {
+  *pBuffer = makeHandle<VkBuffer>(nextHandle++);
+  return VK_SUCCESS;
+}
+
+// Images get the same values as buffers: non-dispatchable handles of different types may be equal.
+uint64_t nextImage = 0x100;
+
+VKAPI_ATTR VkResult VKAPI_CALL createImage(VkDevice, const VkImageCreateInfo*, const VkAllocationCallbacks*,
+                                           VkImage* pImage) {
+  *pImage = makeHandle<VkImage>(nextImage++);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroyImage(VkDevice, VkImage, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL createCommandPool(VkDevice, const VkCommandPoolCreateInfo*,
+                                                 const VkAllocationCallbacks*, VkCommandPool* pCommandPool) {
+  *pCommandPool = makeHandle<VkCommandPool>(nextHandle++);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyCommandPool(VkDevice, VkCommandPool, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                                      VkCommandBuffer* pCommandBuffers) {
+  for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+    pCommandBuffers[i] = makeHandle<VkCommandBuffer>(nextHandle++);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL freeCommandBuffers(VkDevice, VkCommandPool, uint32_t, const VkCommandBuffer*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL createDescriptorPool(VkDevice, const VkDescriptorPoolCreateInfo*,
+                                                    const VkAllocationCallbacks*, VkDescriptorPool* pDescriptorPool) {
+  *pDescriptorPool = makeHandle<VkDescriptorPool>(nextHandle++);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateDescriptorSets(VkDevice, const VkDescriptorSetAllocateInfo* pAllocateInfo,
+                                                      VkDescriptorSet* pDescriptorSets) {
+  for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
+    pDescriptorSets[i] = makeHandle<VkDescriptorSet>(nextHandle++);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetDescriptorPool(VkDevice, VkDescriptorPool, VkDescriptorPoolResetFlags) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyDevice(VkDevice, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL createRenderPass2(VkDevice, const VkRenderPassCreateInfo2*, const VkAllocationCallbacks*,
+                                                 VkRenderPass* pRenderPass) {
+  *pRenderPass = makeHandle<VkRenderPass>(nextHandle++);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyRenderPass(VkDevice, VkRenderPass, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSamplerYcbcrConversion(VkDevice, const VkSamplerYcbcrConversionCreateInfo*,
+                                                            const VkAllocationCallbacks*,
+                                                            VkSamplerYcbcrConversion* pYcbcrConversion) {
+  *pYcbcrConversion = makeHandle<VkSamplerYcbcrConversion>(nextHandle++);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroySamplerYcbcrConversion(VkDevice, VkSamplerYcbcrConversion,
+                                                         const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL createShadersEXT(VkDevice, uint32_t createInfoCount, const VkShaderCreateInfoEXT*,
+                                                const VkAllocationCallbacks*, VkShaderEXT* pShaders) {
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    pShaders[i] = makeHandle<VkShaderEXT>(nextHandle++);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyShaderEXT(VkDevice, VkShaderEXT, const VkAllocationCallbacks*) {}
+
+void testCountersIgnoreUnknownHandles(Volk& volk) {
+  VolkObjectTracker tracker(volk);
+  VkBuffer buffer = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(tracker.vkCreateBuffer(VK_NULL_HANDLE, nullptr, nullptr, &buffer) == VK_SUCCESS);
+  tracker.vkDestroyBuffer(VK_NULL_HANDLE, buffer, nullptr);
+  tracker.vkDestroyBuffer(VK_NULL_HANDLE, buffer, nullptr);
+  tracker.vkDestroyBuffer(VK_NULL_HANDLE, makeHandle<VkBuffer>(0xdead), nullptr);
+
+  auto stats = tracker.getStats(VK_OBJECT_TYPE_BUFFER);
+  VOLK_TEST_CHECK(stats.created == 1);
+  VOLK_TEST_CHECK(stats.destroyed == 1);
+  VOLK_TEST_CHECK(stats.live == 0);
+  VOLK_TEST_CHECK(stats.highWater == 1);
+}
+
+void testEqualHandlesOfDifferentTypes(Volk& volk) {
+  nextHandle = 0x100;
+  nextImage = 0x100;
+  VolkObjectTracker tracker(volk);
+  VkBuffer buffer = VK_NULL_HANDLE;
+  VkImage image = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(tracker.vkCreateBuffer(VK_NULL_HANDLE, nullptr, nullptr, &buffer) == VK_SUCCESS);
+  VOLK_TEST_CHECK(tracker.vkCreateImage(VK_NULL_HANDLE, nullptr, nullptr, &image) == VK_SUCCESS);
+  VOLK_TEST_CHECK(reinterpret_cast<uint64_t>(buffer) == reinterpret_cast<uint64_t>(image));
+  VOLK_TEST_CHECK(tracker.getUntrackedCount() == 0);
+
+  tracker.vkDestroyImage(VK_NULL_HANDLE, image, nullptr);
+  tracker.vkDestroyImage(VK_NULL_HANDLE, image, nullptr);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_IMAGE).live == 0);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_BUFFER).live == 1);
+  tracker.vkDestroyBuffer(VK_NULL_HANDLE, buffer, nullptr);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_BUFFER).live == 0);
+}
+
+void testPoolsReleaseTheirChildren(Volk& volk) {
+  VolkObjectTracker tracker(volk);
+  VkCommandPool commandPool = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(tracker.vkCreateCommandPool(VK_NULL_HANDLE, nullptr, nullptr, &commandPool) == VK_SUCCESS);
+  VkCommandBufferAllocateInfo commandBufferInfo = {};
+  commandBufferInfo.commandPool = commandPool;
+  commandBufferInfo.commandBufferCount = 4;
+  VkCommandBuffer commandBuffers[4] = {};
+  VOLK_TEST_CHECK(tracker.vkAllocateCommandBuffers(VK_NULL_HANDLE, &commandBufferInfo, commandBuffers) == VK_SUCCESS);
+  tracker.vkFreeCommandBuffers(VK_NULL_HANDLE, commandPool, 1, commandBuffers);
+  tracker.vkDestroyCommandPool(VK_NULL_HANDLE, commandPool, nullptr);
+
+  auto stats = tracker.getStats(VK_OBJECT_TYPE_COMMAND_BUFFER);
+  VOLK_TEST_CHECK(stats.created == 4);
+  VOLK_TEST_CHECK(stats.destroyed == 4);
+  VOLK_TEST_CHECK(stats.live == 0);
+
+  VkDescriptorPool descriptorPool = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(tracker.vkCreateDescriptorPool(VK_NULL_HANDLE, nullptr, nullptr, &descriptorPool) == VK_SUCCESS);
+  VkDescriptorSetAllocateInfo setInfo = {};
+  setInfo.descriptorPool = descriptorPool;
+  setInfo.descriptorSetCount = 3;
+  VkDescriptorSet sets[3] = {};
+  for (uint32_t frame = 0; frame < 3; ++frame) {
+    VOLK_TEST_CHECK(tracker.vkAllocateDescriptorSets(VK_NULL_HANDLE, &setInfo, sets) == VK_SUCCESS);
+    VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_DESCRIPTOR_SET).live == 3);
+    VOLK_TEST_CHECK(tracker.vkResetDescriptorPool(VK_NULL_HANDLE, descriptorPool, 0) == VK_SUCCESS);
+    VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_DESCRIPTOR_SET).live == 0);
+  }
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_DESCRIPTOR_SET).destroyed == 9);
+}
+
+void testOverflowKeepsCountersBalanced(Volk& volk) {
+  VolkObjectTracker tracker(volk, 2);
+  std::vector<VkBuffer> buffers(5);
+  for (auto& buffer : buffers) {
+    VOLK_TEST_CHECK(tracker.vkCreateBuffer(VK_NULL_HANDLE, nullptr, nullptr, &buffer) == VK_SUCCESS);
+  }
+  VOLK_TEST_CHECK(tracker.getUntrackedCount() == 3);
+  for (auto buffer : buffers) {
+    tracker.vkDestroyBuffer(VK_NULL_HANDLE, buffer, nullptr);
+  }
+  tracker.vkDestroyBuffer(VK_NULL_HANDLE, buffers[4], nullptr);
+
+  auto stats = tracker.getStats(VK_OBJECT_TYPE_BUFFER);
+  VOLK_TEST_CHECK(stats.destroyed == 5);
+  VOLK_TEST_CHECK(stats.live == 0);
+}
+
+void testLeaksAreReported(Volk& volk) {
+  std::vector<VkObjectType> leaked;
+  VolkObjectTracker tracker(volk, 64, [&leaked](VkDevice, VkObjectType objectType, uint64_t) {
+    leaked.push_back(objectType);
+  });
+  VkCommandPool commandPool = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(tracker.vkCreateCommandPool(VK_NULL_HANDLE, nullptr, nullptr, &commandPool) == VK_SUCCESS);
+  VkCommandBufferAllocateInfo commandBufferInfo = {};
+  commandBufferInfo.commandPool = commandPool;
+  commandBufferInfo.commandBufferCount = 2;
+  VkCommandBuffer commandBuffers[2] = {};
+  VOLK_TEST_CHECK(tracker.vkAllocateCommandBuffers(VK_NULL_HANDLE, &commandBufferInfo, commandBuffers) == VK_SUCCESS);
+  tracker.vkDestroyDevice(VK_NULL_HANDLE, nullptr);
+
+  VOLK_TEST_CHECK(leaked.size() == 3);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_COMMAND_BUFFER).leaked == 2);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_COMMAND_BUFFER).live == 0);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_COMMAND_POOL).leaked == 1);
+}
+
+void testGeneratedPairs(Volk& volk) {
+  VolkObjectTracker tracker(volk);
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  VkRenderPass renderPass = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(tracker.vkCreateRenderPass2(VK_NULL_HANDLE, nullptr, nullptr, &renderPass) == VK_SUCCESS);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_RENDER_PASS).live == 1);
+  tracker.vkDestroyRenderPass(VK_NULL_HANDLE, renderPass, nullptr);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_RENDER_PASS).destroyed == 1);
+#endif
+#if defined(VK_COMPUTE_VERSION_1_1) && defined(VK_KHR_sampler_ycbcr_conversion)
+  // The extension alias and the core command count the same objects.
+  VkSamplerYcbcrConversion conversion = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(tracker.vkCreateSamplerYcbcrConversionKHR(VK_NULL_HANDLE, nullptr, nullptr, &conversion) ==
+                  VK_SUCCESS);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION).live == 1);
+  tracker.vkDestroySamplerYcbcrConversion(VK_NULL_HANDLE, conversion, nullptr);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION).live == 0);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION).destroyed == 1);
+#endif
+#if defined(VK_EXT_shader_object)
+  VkShaderEXT shaders[2] = {};
+  VOLK_TEST_CHECK(tracker.vkCreateShadersEXT(VK_NULL_HANDLE, 2, nullptr, nullptr, shaders) == VK_SUCCESS);
+  tracker.vkDestroyShaderEXT(VK_NULL_HANDLE, shaders[0], nullptr);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_SHADER_EXT).created == 2);
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_SHADER_EXT).live == 1);
+  // Types the tracker doesn't know share one counter, separate from the shaders.
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_MAX_ENUM).live == 0);
+#endif
+}
+
+void testConcurrentPools(Volk& volk) {
+  constexpr uint32_t kThreads = 4;
+  constexpr uint32_t kRounds = 200;
+  VolkObjectTracker tracker(volk, 1024);
+  VkCommandPool pools[kThreads] = {};
+  for (auto& pool : pools) {
+    VOLK_TEST_CHECK(tracker.vkCreateCommandPool(VK_NULL_HANDLE, nullptr, nullptr, &pool) == VK_SUCCESS);
+  }
+
+  // Each thread owns its pool, as Vulkan requires, and allocates from it while the others do the same.
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&tracker, &pools, t] {
+      for (uint32_t round = 0; round < kRounds; ++round) {
+        VkCommandBuffer commandBuffers[2] = {};
+        VkCommandBufferAllocateInfo info = {};
+        info.commandPool = pools[t];
+        info.commandBufferCount = 2;
+        (void)tracker.vkAllocateCommandBuffers(VK_NULL_HANDLE, &info, commandBuffers);
+        tracker.vkFreeCommandBuffers(VK_NULL_HANDLE, pools[t], 1, commandBuffers);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  VOLK_TEST_CHECK(tracker.getStats(VK_OBJECT_TYPE_COMMAND_BUFFER).live == kThreads * kRounds);
+
+  for (auto pool : pools) {
+    tracker.vkDestroyCommandPool(VK_NULL_HANDLE, pool, nullptr);
+  }
+  auto stats = tracker.getStats(VK_OBJECT_TYPE_COMMAND_BUFFER);
+  VOLK_TEST_CHECK(stats.live == 0);
+  VOLK_TEST_CHECK(stats.destroyed == 2 * kThreads * kRounds);
+  VOLK_TEST_CHECK(tracker.getUntrackedCount() == 0);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreateBuffer = createBuffer;
+  volk.vkDestroyBuffer = destroyBuffer;
+  volk.vkCreateImage = createImage;
+  volk.vkDestroyImage = destroyImage;
+  volk.vkCreateCommandPool = createCommandPool;
+  volk.vkDestroyCommandPool = destroyCommandPool;
+  volk.vkAllocateCommandBuffers = allocateCommandBuffers;
+  volk.vkFreeCommandBuffers = freeCommandBuffers;
+  volk.vkCreateDescriptorPool = createDescriptorPool;
+  volk.vkAllocateDescriptorSets = allocateDescriptorSets;
+  volk.vkResetDescriptorPool = resetDescriptorPool;
+  volk.vkDestroyDevice = destroyDevice;
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  volk.vkCreateRenderPass2 = createRenderPass2;
+  volk.vkDestroyRenderPass = destroyRenderPass;
+#endif
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+  volk.vkCreateSamplerYcbcrConversionKHR = createSamplerYcbcrConversion;
+#endif
+#if defined(VK_COMPUTE_VERSION_1_1)
+  volk.vkDestroySamplerYcbcrConversion = destroySamplerYcbcrConversion;
+#endif
+#if defined(VK_EXT_shader_object)
+  volk.vkCreateShadersEXT = createShadersEXT;
+  volk.vkDestroyShaderEXT = destroyShaderEXT;
+#endif
+
+  testCountersIgnoreUnknownHandles(volk);
+  testEqualHandlesOfDifferentTypes(volk);
+  testPoolsReleaseTheirChildren(volk);
+  testOverflowKeepsCountersBalanced(volk);
+  testLeaksAreReported(volk);
+  testGeneratedPairs(volk);
+  testConcurrentPools(volk);
+  return VOLK_TEST_RESULT();
+}
@@ -0,0 +1,237 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_perf_lint.hpp"
+#include "volk_test.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+#if defined(VK_KHR_swapchain)
+VkResult presentResult = VK_SUCCESS;
+#endif
+uint32_t driverCalls = 0;
+
+VKAPI_ATTR VkResult VKAPI_CALL queueWaitIdle(VkQueue) {
+  ++driverCalls;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL deviceWaitIdle(VkDevice) {
+  ++driverCalls;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo*, const VkAllocationCallbacks*,
+                                              VkDeviceMemory*) {
+  ++driverCalls;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createComputePipelines(VkDevice, VkPipelineCache, uint32_t,
+                                                      const VkComputePipelineCreateInfo*, const VkAllocationCallbacks*,
+                                                      VkPipeline*) {
+  ++driverCalls;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL updateDescriptorSets(VkDevice, uint32_t, const VkWriteDescriptorSet*, uint32_t,
+                                                const VkCopyDescriptorSet*) {
+  ++driverCalls;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier(VkCommandBuffer, VkPipelineStageFlags, VkPipelineStageFlags,
+                                              VkDependencyFlags, uint32_t, const VkMemoryBarrier*, uint32_t,
+                                              const VkBufferMemoryBarrier*, uint32_t, const VkImageMemoryBarrier*) {
+  ++driverCalls;
+}
+
+#if defined(VK_BASE_VERSION_1_3) || defined(VK_KHR_synchronization2)
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer, const VkDependencyInfo*) {
+  ++driverCalls;
+}
+#endif
+
+#if defined(VK_KHR_swapchain)
+VKAPI_ATTR VkResult VKAPI_CALL queuePresent(VkQueue, const VkPresentInfoKHR*) {
+  ++driverCalls;
+  return presentResult;
+}
+#endif
+
+uint64_t count(const VolkPerfLint& lint, VolkPerfLint::Pattern pattern) {
+  return lint.getReport(pattern).count;
+}
+
+void testFrameLoopPatterns(Volk& volk) {
+  VolkPerfLint lint(volk);
+  VkDeviceMemory memory = VK_NULL_HANDLE;
+  VkMemoryAllocateInfo allocateInfo = {};
+
+  // Loading before the first frame isn't reported.
+  (void)lint.vkDeviceWaitIdle(VK_NULL_HANDLE);
+  (void)lint.vkAllocateMemory(VK_NULL_HANDLE, &allocateInfo, nullptr, &memory);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::WaitIdle) == 0);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::AllocateMemoryInFrame) == 0);
+
+  lint.markFrame();
+  uint32_t const waitLine = __LINE__ + 1;
+  (void)lint.vkQueueWaitIdle(VK_NULL_HANDLE);
+  (void)lint.vkDeviceWaitIdle(VK_NULL_HANDLE);
+  (void)lint.vkAllocateMemory(VK_NULL_HANDLE, &allocateInfo, nullptr, &memory);
+  lint.markFrame();
+  auto const wait = lint.getReport(VolkPerfLint::Pattern::WaitIdle);
+  VOLK_TEST_CHECK(wait.count == 2);
+  VOLK_TEST_CHECK(wait.perFrame == 1.0);
+  VOLK_TEST_CHECK(wait.file && strstr(wait.file, "test_perf_lint.cpp") && wait.line == waitLine + 1);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::AllocateMemoryInFrame) == 1);
+
+  // Shutdown after leaving the frame loop isn't reported.
+  lint.leaveFrameLoop();
+  (void)lint.vkDeviceWaitIdle(VK_NULL_HANDLE);
+  (void)lint.vkAllocateMemory(VK_NULL_HANDLE, &allocateInfo, nullptr, &memory);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::WaitIdle) == 2);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::AllocateMemoryInFrame) == 1);
+
+  // The next frame enters the loop again.
+  lint.markFrame();
+  (void)lint.vkDeviceWaitIdle(VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::WaitIdle) == 3);
+
+  lint.reset();
+  VOLK_TEST_CHECK(lint.getReport(VolkPerfLint::Pattern::WaitIdle).count == 0);
+  VOLK_TEST_CHECK(lint.getReport(VolkPerfLint::Pattern::WaitIdle).file == nullptr);
+  VOLK_TEST_CHECK(lint.getFrameCount() == 3);
+}
+
+#if defined(VK_KHR_swapchain)
+void testOutOfDatePresentLeavesFrameLoop(Volk& volk) {
+  VolkPerfLint lint(volk);
+  VkPresentInfoKHR presentInfo = {};
+
+  presentResult = VK_SUCCESS;
+  (void)lint.vkQueuePresentKHR(VK_NULL_HANDLE, &presentInfo);
+  (void)lint.vkQueueWaitIdle(VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::WaitIdle) == 1);
+
+  // Swapchain recreation waits for the device.
+  presentResult = VK_ERROR_OUT_OF_DATE_KHR;
+  VOLK_TEST_CHECK(lint.vkQueuePresentKHR(VK_NULL_HANDLE, &presentInfo) == VK_ERROR_OUT_OF_DATE_KHR);
+  (void)lint.vkDeviceWaitIdle(VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::WaitIdle) == 1);
+  VOLK_TEST_CHECK(lint.getFrameCount() == 2);
+  presentResult = VK_SUCCESS;
+}
+#endif
+
+void testPipelineCreationOnRenderThread(Volk& volk) {
+  VolkPerfLint lint(volk);
+  VkComputePipelineCreateInfo info = {};
+  VkPipeline pipeline = VK_NULL_HANDLE;
+
+  // No render thread before the first frame.
+  (void)lint.vkCreateComputePipelines(VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &info, nullptr, &pipeline);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::PipelineCreationOnRenderThread) == 0);
+
+  lint.markFrame();
+  std::thread([&] {
+    (void)lint.vkCreateComputePipelines(VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &info, nullptr, &pipeline);
+  }).join();
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::PipelineCreationOnRenderThread) == 0);
+
+  (void)lint.vkCreateComputePipelines(VK_NULL_HANDLE, VK_NULL_HANDLE, 1, &info, nullptr, &pipeline);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::PipelineCreationOnRenderThread) == 1);
+}
+
+void testSingleDescriptorWrites(Volk& volk) {
+  VolkPerfLint lint(volk);
+  VkWriteDescriptorSet writes[2] = {};
+  VkCopyDescriptorSet copy = {};
+
+  lint.vkUpdateDescriptorSets(VK_NULL_HANDLE, 1, writes, 0, nullptr);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::SingleDescriptorWrite) == 1);
+
+  lint.vkUpdateDescriptorSets(VK_NULL_HANDLE, 2, writes, 0, nullptr);
+  lint.vkUpdateDescriptorSets(VK_NULL_HANDLE, 1, writes, 1, &copy);
+  lint.vkUpdateDescriptorSets(VK_NULL_HANDLE, 0, nullptr, 1, &copy);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::SingleDescriptorWrite) == 1);
+}
+
+void testSingleBarriers(Volk& volk) {
+  VolkPerfLint lint(volk, false);
+  VkMemoryBarrier memoryBarrier = {};
+  VkImageMemoryBarrier imageBarriers[2] = {};
+
+  lint.vkCmdPipelineBarrier(VK_NULL_HANDLE, 0, 0, 0, 0, nullptr, 0, nullptr, 1, imageBarriers);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::SingleBarrier) == 1);
+  VOLK_TEST_CHECK(lint.getReport(VolkPerfLint::Pattern::SingleBarrier).file == nullptr);
+
+  // Several barriers, or an execution dependency only.
+  lint.vkCmdPipelineBarrier(VK_NULL_HANDLE, 0, 0, 0, 0, nullptr, 0, nullptr, 2, imageBarriers);
+  lint.vkCmdPipelineBarrier(VK_NULL_HANDLE, 0, 0, 0, 1, &memoryBarrier, 0, nullptr, 1, imageBarriers);
+  lint.vkCmdPipelineBarrier(VK_NULL_HANDLE, 0, 0, 0, 0, nullptr, 0, nullptr, 0, nullptr);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::SingleBarrier) == 1);
+
+#if defined(VK_BASE_VERSION_1_3)
+  VkImageMemoryBarrier2 imageBarrier2 = {};
+  VkDependencyInfo dependencyInfo = {};
+  dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+  dependencyInfo.imageMemoryBarrierCount = 1;
+  dependencyInfo.pImageMemoryBarriers = &imageBarrier2;
+  lint.vkCmdPipelineBarrier2(VK_NULL_HANDLE, &dependencyInfo);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::SingleBarrier) == 2);
+#endif
+}
+
+#if defined(VK_KHR_synchronization2)
+void testSingleBarrierKHR(Volk& volk) {
+  VolkPerfLint lint(volk);
+  VkImageMemoryBarrier2 imageBarrier = {};
+  VkDependencyInfoKHR dependencyInfo = {};
+  dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+  dependencyInfo.imageMemoryBarrierCount = 1;
+  dependencyInfo.pImageMemoryBarriers = &imageBarrier;
+  auto const calls = driverCalls;
+  lint.vkCmdPipelineBarrier2KHR(VK_NULL_HANDLE, &dependencyInfo);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::SingleBarrier) == 1);
+  VOLK_TEST_CHECK(driverCalls == calls + 1);
+
+  dependencyInfo.imageMemoryBarrierCount = 0;
+  lint.vkCmdPipelineBarrier2KHR(VK_NULL_HANDLE, &dependencyInfo);
+  VOLK_TEST_CHECK(count(lint, VolkPerfLint::Pattern::SingleBarrier) == 1);
+}
+#endif
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkQueueWaitIdle = queueWaitIdle;
+  volk.vkDeviceWaitIdle = deviceWaitIdle;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkCreateComputePipelines = createComputePipelines;
+  volk.vkUpdateDescriptorSets = updateDescriptorSets;
+  volk.vkCmdPipelineBarrier = cmdPipelineBarrier;
+#if defined(VK_BASE_VERSION_1_3)
+  volk.vkCmdPipelineBarrier2 = cmdPipelineBarrier2;
+#endif
+#if defined(VK_KHR_synchronization2)
+  volk.vkCmdPipelineBarrier2KHR = cmdPipelineBarrier2;
+#endif
+#if defined(VK_KHR_swapchain)
+  volk.vkQueuePresentKHR = queuePresent;
+#endif
+
+  testFrameLoopPatterns(volk);
+#if defined(VK_KHR_swapchain)
+  testOutOfDatePresentLeavesFrameLoop(volk);
+#endif
+  testPipelineCreationOnRenderThread(volk);
+  testSingleDescriptorWrites(volk);
+  testSingleBarriers(volk);
+#if defined(VK_KHR_synchronization2)
+  testSingleBarrierKHR(volk);
+#endif
+  return VOLK_TEST_RESULT();
+}
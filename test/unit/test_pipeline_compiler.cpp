@@ -0,0 +1,136 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_pipeline_compiler.hpp"
+#include "volk_test.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace {
+
+std::atomic<uint64_t> createdCount = 0;
+std::atomic<uint64_t> destroyedCount = 0;
+std::atomic<bool> failCreation = false;
+
+VKAPI_ATTR VkResult VKAPI_CALL createPipelineCache(VkDevice, const VkPipelineCacheCreateInfo*,
+                                                   const VkAllocationCallbacks*, VkPipelineCache* pPipelineCache) {
+  *pPipelineCache = reinterpret_cast<VkPipelineCache>(uint64_t(1));
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyPipelineCache(VkDevice, VkPipelineCache, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL createComputePipelines(VkDevice, VkPipelineCache, uint32_t createInfoCount,
+                                                      const VkComputePipelineCreateInfo*, const VkAllocationCallbacks*,
+                                                      VkPipeline* pPipelines) {
+  if (failCreation) {
+    return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+  }
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    pPipelines[i] = reinterpret_cast<VkPipeline>(++createdCount);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyPipeline(VkDevice, VkPipeline, const VkAllocationCallbacks*) {
+  ++destroyedCount;
+}
+
+VkComputePipelineCreateInfo makeInfo(uint64_t module) {
+  VkComputePipelineCreateInfo info = {};
+  info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+  info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+  info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+  info.stage.module = reinterpret_cast<VkShaderModule>(module);
+  info.stage.pName = "main";
+  return info;
+}
+
+void testIdenticalRequestsAreCompiledOnce(Volk& volk) {
+  createdCount = 0;
+  VolkPipelineCompiler compiler(volk, VK_NULL_HANDLE, 2);
+  auto info = makeInfo(1);
+  auto sameInfo = makeInfo(1);
+  auto otherInfo = makeInfo(2);
+
+  auto first = compiler.compile(info, VolkPipelineCompiler::Priority::Visible);
+  auto other = compiler.compile(otherInfo, VolkPipelineCompiler::Priority::Visible);
+  compiler.wait();
+  VOLK_TEST_CHECK(first.key != other.key);
+  VOLK_TEST_CHECK(first.future.get().pipeline != other.future.get().pipeline);
+
+  // The finished job was evicted, the request is served from its result.
+  auto second = compiler.compile(sameInfo, VolkPipelineCompiler::Priority::Visible);
+  VOLK_TEST_CHECK(second.key == first.key);
+  VOLK_TEST_CHECK(second.future.get().pipeline == first.future.get().pipeline);
+  VOLK_TEST_CHECK(createdCount == 2);
+}
+
+void testKeyCollisionsAreCompiledSeparately(Volk& volk) {
+  createdCount = 0;
+  VolkPipelineCompiler compiler(volk, VK_NULL_HANDLE, 2);
+  auto info = makeInfo(1);
+  auto otherInfo = makeInfo(2);
+
+  // An application key equal to the hash of another create info must not be served its pipeline.
+  auto first = compiler.compile(info, VolkPipelineCompiler::Priority::Visible);
+  auto colliding = compiler.compile(otherInfo, VolkPipelineCompiler::Priority::Visible, first.key);
+  compiler.wait();
+  VOLK_TEST_CHECK(colliding.key != first.key);
+  VOLK_TEST_CHECK(colliding.future.get().pipeline != first.future.get().pipeline);
+  VOLK_TEST_CHECK(createdCount == 2);
+
+  auto colliding2 = compiler.compile(otherInfo, VolkPipelineCompiler::Priority::Visible, first.key);
+  compiler.wait();
+  VOLK_TEST_CHECK(colliding2.future.get().pipeline != first.future.get().pipeline);
+  VOLK_TEST_CHECK(createdCount == 3);
+}
+
+void testFailedRequestsAreRetried(Volk& volk) {
+  createdCount = 0;
+  VolkPipelineCompiler compiler(volk, VK_NULL_HANDLE, 1);
+  auto info = makeInfo(3);
+
+  failCreation = true;
+  auto failed = compiler.compile(info, VolkPipelineCompiler::Priority::Visible);
+  VOLK_TEST_CHECK(failed.future.get().result == VK_ERROR_OUT_OF_DEVICE_MEMORY);
+  compiler.wait();
+
+  failCreation = false;
+  auto retried = compiler.compile(info, VolkPipelineCompiler::Priority::Visible);
+  VOLK_TEST_CHECK(retried.future.get().result == VK_SUCCESS);
+  VOLK_TEST_CHECK(createdCount == 1);
+}
+
+void testReservedKeysAreRejected(Volk& volk) {
+  createdCount = 0;
+  VolkPipelineCompiler compiler(volk, VK_NULL_HANDLE, 1);
+  auto info = makeInfo(4);
+  VkBaseInStructure unknown = {};
+  info.pNext = &unknown;
+  auto otherInfo = makeInfo(5);
+
+  // Requests which can't be deduplicated get keys with kUniqueKeyBit; an application key can't alias them.
+  auto unique = compiler.compile(info, VolkPipelineCompiler::Priority::Prefetch);
+  VOLK_TEST_CHECK(unique.key & VolkPipelineCompiler::kUniqueKeyBit);
+  auto collision = compiler.compile(otherInfo, VolkPipelineCompiler::Priority::Prefetch, unique.key);
+  VOLK_TEST_CHECK(collision.future.get().result == VK_ERROR_INITIALIZATION_FAILED);
+  VOLK_TEST_CHECK(unique.future.get().result == VK_SUCCESS);
+  VOLK_TEST_CHECK(createdCount == 1);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreatePipelineCache = createPipelineCache;
+  volk.vkDestroyPipelineCache = destroyPipelineCache;
+  volk.vkCreateComputePipelines = createComputePipelines;
+  volk.vkDestroyPipeline = destroyPipeline;
+
+  testIdenticalRequestsAreCompiledOnce(volk);
+  testKeyCollisionsAreCompiledSeparately(volk);
+  testFailedRequestsAreRetried(volk);
+  testReservedKeysAreRejected(volk);
+  VOLK_TEST_CHECK(destroyedCount == 7);
+  return VOLK_TEST_RESULT();
+}
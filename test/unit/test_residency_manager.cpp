@@ -0,0 +1,153 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_residency_manager.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_BASE_VERSION_1_1) && defined(VK_EXT_pageable_device_local_memory) && defined(VK_EXT_memory_budget)
+
+#include <cstdint>
+#include <map>
+
+namespace {
+
+// Fake device: heap 0 is device local (memory type 0), heap 1 is host memory (memory type 1). Priorities are recorded.
+constexpr VkDeviceSize kHeapSize = 1 << 20;
+
+std::map<VkDeviceMemory, float> priorities;
+VkDeviceSize heapBudget = kHeapSize;
+VkDeviceSize heapUsage = 0;
+uint64_t nextMemory = 1;
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties* pProperties) {
+  *pProperties = {};
+  pProperties->memoryTypeCount = 2;
+  pProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  pProperties->memoryTypes[0].heapIndex = 0;
+  pProperties->memoryTypes[1].propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+  pProperties->memoryTypes[1].heapIndex = 1;
+  pProperties->memoryHeapCount = 2;
+  pProperties->memoryHeaps[0].size = kHeapSize;
+  pProperties->memoryHeaps[1].size = kHeapSize;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice,
+                                                              VkPhysicalDeviceMemoryProperties2* pProperties) {
+  getPhysicalDeviceMemoryProperties(physicalDevice, &pProperties->memoryProperties);
+  auto budget = static_cast<VkPhysicalDeviceMemoryBudgetPropertiesEXT*>(pProperties->pNext);
+  budget->heapBudget[0] = heapBudget;
+  budget->heapUsage[0] = heapUsage;
+  budget->heapBudget[1] = kHeapSize;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo*, const VkAllocationCallbacks*,
+                                              VkDeviceMemory* pMemory) {
+  *pMemory = reinterpret_cast<VkDeviceMemory>(static_cast<uintptr_t>(nextMemory++));
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL freeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR void VKAPI_CALL setDeviceMemoryPriority(VkDevice, VkDeviceMemory memory, float priority) {
+  priorities[memory] = priority;
+}
+
+VkDeviceMemory allocate(VolkResidencyManager& manager, uint32_t memoryTypeIndex, VkDeviceSize size) {
+  VkMemoryAllocateInfo allocateInfo = {};
+  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.allocationSize = size;
+  allocateInfo.memoryTypeIndex = memoryTypeIndex;
+  VkDeviceMemory memory = VK_NULL_HANDLE;
+  (void)manager.vkAllocateMemory(VK_NULL_HANDLE, &allocateInfo, nullptr, &memory);
+  return memory;
+}
+
+void testAgeMapsToLevels(Volk& volk) {
+  VolkResidencyManager manager(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, true);
+  VOLK_TEST_CHECK(manager.getStatus() == VK_SUCCESS);
+  auto const memory = allocate(manager, 0, 4096);
+
+  // Expected priority after each frame since the last use: ages up to 1, 4, 16 and 64 keep levels 0 to 3.
+  auto const expected = [](uint32_t age) {
+    return age <= 1 ? 1.0f : age <= 4 ? 0.75f : age <= 16 ? 0.5f : age <= 64 ? 0.25f : 0.0f;
+  };
+  for (uint32_t age = 1; age <= 70; ++age) {
+    manager.beginFrame();
+    VOLK_TEST_CHECK(priorities[memory] == expected(age));
+    VOLK_TEST_CHECK(manager.getHeapStats(0).coldBytes == (age > 64 ? 4096u : 0u));
+  }
+  // The driver is only called when the level changes: once per level.
+  VOLK_TEST_CHECK(manager.getStats().priorityChanges == VolkResidencyManager::kLevelCount);
+
+  // Using the memory makes it hot again.
+  manager.use(1, &memory);
+  manager.beginFrame();
+  VOLK_TEST_CHECK(priorities[memory] == 1.0f);
+  VOLK_TEST_CHECK(manager.getHeapStats(0).coldBytes == 0);
+  manager.vkFreeMemory(VK_NULL_HANDLE, memory, nullptr);
+}
+
+void testRecentlyUsedMemoryStaysHot(Volk& volk) {
+  VolkResidencyManager manager(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, true);
+  auto const hot = allocate(manager, 0, 4096);
+  auto const cold = allocate(manager, 0, 8192);
+
+  for (uint32_t frame = 0; frame < 100; ++frame) {
+    manager.use(1, &hot);
+    manager.beginFrame();
+  }
+  VOLK_TEST_CHECK(priorities[hot] == 1.0f);
+  VOLK_TEST_CHECK(priorities[cold] == 0.0f);
+  VOLK_TEST_CHECK(manager.getHeapStats(0).trackedBytes == 4096 + 8192);
+  VOLK_TEST_CHECK(manager.getHeapStats(0).coldBytes == 8192);
+
+  manager.vkFreeMemory(VK_NULL_HANDLE, cold, nullptr);
+  VOLK_TEST_CHECK(manager.getHeapStats(0).trackedBytes == 4096);
+  VOLK_TEST_CHECK(manager.getHeapStats(0).coldBytes == 0);
+  manager.vkFreeMemory(VK_NULL_HANDLE, hot, nullptr);
+}
+
+void testHeadroomFollowsBudget(Volk& volk) {
+  heapBudget = 1000;
+  heapUsage = 850;
+  VolkResidencyManager manager(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, true, 0.9f);
+  VOLK_TEST_CHECK(manager.hasHeadroom(0, 40));
+  VOLK_TEST_CHECK(!manager.hasHeadroom(0, 60));
+  VOLK_TEST_CHECK(manager.hasHeadroom(1, 60));
+  VOLK_TEST_CHECK(manager.getStats().throttled == 1);
+
+  // Allocations count against the budget until the next refresh.
+  auto const memory = allocate(manager, 0, 40);
+  VOLK_TEST_CHECK(!manager.hasHeadroom(0, 20));
+
+  heapUsage = 1100;
+  manager.beginFrame();
+  VOLK_TEST_CHECK(manager.getHeapStats(0).overBudgetFrames == 1);
+  VOLK_TEST_CHECK(manager.getHeapStats(0).pressure > 1.0f);
+  manager.vkFreeMemory(VK_NULL_HANDLE, memory, nullptr);
+  heapBudget = kHeapSize;
+  heapUsage = 0;
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetPhysicalDeviceMemoryProperties = getPhysicalDeviceMemoryProperties;
+  volk.vkGetPhysicalDeviceMemoryProperties2 = getPhysicalDeviceMemoryProperties2;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkFreeMemory = freeMemory;
+  volk.vkSetDeviceMemoryPriorityEXT = setDeviceMemoryPriority;
+
+  testAgeMapsToLevels(volk);
+  testRecentlyUsedMemoryStaysHot(volk);
+  testHeadroomFollowsBudget(volk);
+  return VOLK_TEST_RESULT();
+}
+
+#else
+
+int main() {
+  return 0;
+}
+
+#endif
@@ -0,0 +1,263 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_shader_module_identifier.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_EXT_shader_module_identifier)
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace {
+
+// Fake driver: a module's identifier is its code's second word. The pipeline cache holds the identifiers of the
+// pipelines compiled so far; identifier-only creation succeeds if they were all compiled before.
+std::map<VkShaderModule, uint32_t> modules;
+std::set<uint32_t> compiled;
+uint8_t algorithmUUID = 1;
+uint32_t modulesCreated = 0;
+uint32_t fastPathAttempts = 0;
+uint64_t nextHandle = 1;
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties2(VkPhysicalDevice, VkPhysicalDeviceProperties2* pProperties) {
+  auto identifierProperties = static_cast<VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT*>(pProperties->pNext);
+  memset(identifierProperties->shaderModuleIdentifierAlgorithmUUID, algorithmUUID, VK_UUID_SIZE);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createShaderModule(VkDevice, const VkShaderModuleCreateInfo* pCreateInfo,
+                                                  const VkAllocationCallbacks*, VkShaderModule* pShaderModule) {
+  *pShaderModule = reinterpret_cast<VkShaderModule>(static_cast<uintptr_t>(nextHandle++));
+  modules[*pShaderModule] = pCreateInfo->pCode[1];
+  ++modulesCreated;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyShaderModule(VkDevice, VkShaderModule shaderModule, const VkAllocationCallbacks*) {
+  modules.erase(shaderModule);
+}
+
+void writeIdentifier(uint32_t id, VkShaderModuleIdentifierEXT* pIdentifier) {
+  pIdentifier->identifierSize = sizeof(id);
+  memcpy(pIdentifier->identifier, &id, sizeof(id));
+}
+
+VKAPI_ATTR void VKAPI_CALL getShaderModuleIdentifier(VkDevice, VkShaderModule shaderModule,
+                                                     VkShaderModuleIdentifierEXT* pIdentifier) {
+  writeIdentifier(modules[shaderModule], pIdentifier);
+}
+
+VKAPI_ATTR void VKAPI_CALL getShaderModuleCreateInfoIdentifier(VkDevice, const VkShaderModuleCreateInfo* pCreateInfo,
+                                                               VkShaderModuleIdentifierEXT* pIdentifier) {
+  writeIdentifier(pCreateInfo->pCode[1], pIdentifier);
+}
+
+VkResult createStages(VkPipelineCreateFlags flags, uint32_t stageCount, const VkPipelineShaderStageCreateInfo* stages,
+                      VkPipeline* pPipeline) {
+  std::vector<uint32_t> ids;
+  bool identifiersOnly = true;
+  for (uint32_t i = 0; i < stageCount; ++i) {
+    if (stages[i].module != VK_NULL_HANDLE) {
+      identifiersOnly = false;
+      ids.push_back(modules.at(stages[i].module));
+      continue;
+    }
+    auto identifierInfo = static_cast<const VkPipelineShaderStageModuleIdentifierCreateInfoEXT*>(stages[i].pNext);
+    VOLK_TEST_CHECK(identifierInfo && identifierInfo->identifierSize == sizeof(uint32_t));
+    uint32_t id = 0;
+    memcpy(&id, identifierInfo->pIdentifier, sizeof(id));
+    ids.push_back(id);
+  }
+
+  if (identifiersOnly) {
+    ++fastPathAttempts;
+    VOLK_TEST_CHECK(flags & VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT);
+    for (auto id : ids) {
+      if (!compiled.count(id)) {
+        *pPipeline = VK_NULL_HANDLE;
+        return VK_PIPELINE_COMPILE_REQUIRED;
+      }
+    }
+  }
+  compiled.insert(ids.begin(), ids.end());
+  *pPipeline = reinterpret_cast<VkPipeline>(static_cast<uintptr_t>(nextHandle++));
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createComputePipelines(VkDevice, VkPipelineCache, uint32_t,
+                                                      const VkComputePipelineCreateInfo* pCreateInfos,
+                                                      const VkAllocationCallbacks*, VkPipeline* pPipelines) {
+  return createStages(pCreateInfos->flags, 1, &pCreateInfos->stage, pPipelines);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createGraphicsPipelines(VkDevice, VkPipelineCache, uint32_t,
+                                                       const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                                       const VkAllocationCallbacks*, VkPipeline* pPipelines) {
+  return createStages(pCreateInfos->flags, pCreateInfos->stageCount, pCreateInfos->pStages, pPipelines);
+}
+
+// Loader serving code whose identifier is the key, counting its calls.
+struct Loader {
+  uint32_t calls = 0;
+  bool fail = false;
+
+  VolkShaderModuleIdentifierCache::SpirvLoader get() {
+    return [this](uint64_t key, std::vector<uint32_t>& code) {
+      ++calls;
+      code = {0x07230203, static_cast<uint32_t>(key), 0, 0};
+      return !fail;
+    };
+  }
+};
+
+VkComputePipelineCreateInfo makeComputeInfo() {
+  VkComputePipelineCreateInfo info = {};
+  info.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+  info.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+  info.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+  info.stage.pName = "main";
+  return info;
+}
+
+void testIdentifierFastPath(Volk& volk) {
+  compiled.clear();
+  VolkShaderModuleIdentifierCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(cache.getStatus() == VK_SUCCESS);
+  auto const info = makeComputeInfo();
+  Loader loader;
+  VkPipeline pipeline = VK_NULL_HANDLE;
+
+  // Unknown key: SPIR-V is loaded and the identifier recorded.
+  VOLK_TEST_CHECK(cache.createComputePipeline(VK_NULL_HANDLE, info, 11, loader.get(), nullptr, &pipeline) ==
+                  VK_SUCCESS);
+  VOLK_TEST_CHECK(loader.calls == 1 && cache.getMissCount() == 1);
+
+  // Known key in the pipeline cache: no SPIR-V and no module at all.
+  auto const created = modulesCreated;
+  VOLK_TEST_CHECK(cache.createComputePipeline(VK_NULL_HANDLE, info, 11, loader.get(), nullptr, &pipeline) ==
+                  VK_SUCCESS);
+  VOLK_TEST_CHECK(pipeline != VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(loader.calls == 1 && modulesCreated == created);
+  VOLK_TEST_CHECK(cache.getHitCount() == 1 && cache.getMissCount() == 1);
+  VOLK_TEST_CHECK(modules.empty());
+}
+
+void testFallbackWhenCompileRequired(Volk& volk) {
+  compiled.clear();
+  VolkShaderModuleIdentifierCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  auto const info = makeComputeInfo();
+  Loader loader;
+  VkPipeline pipeline = VK_NULL_HANDLE;
+
+  // The identifier is known but the pipeline isn't in the driver's cache.
+  const uint32_t code[4] = {0x07230203, 12, 0, 0};
+  cache.registerCode(12, code, sizeof(code));
+  auto const attempts = fastPathAttempts;
+  VOLK_TEST_CHECK(cache.createComputePipeline(VK_NULL_HANDLE, info, 12, loader.get(), nullptr, &pipeline) ==
+                  VK_SUCCESS);
+  VOLK_TEST_CHECK(fastPathAttempts == attempts + 1);
+  VOLK_TEST_CHECK(loader.calls == 1);
+  VOLK_TEST_CHECK(cache.getHitCount() == 0 && cache.getMissCount() == 1);
+
+  // A failing loader fails the creation without leaking modules.
+  compiled.clear();
+  loader.fail = true;
+  VOLK_TEST_CHECK(cache.createComputePipeline(VK_NULL_HANDLE, info, 12, loader.get(), nullptr, &pipeline) ==
+                  VK_ERROR_INITIALIZATION_FAILED);
+  VOLK_TEST_CHECK(modules.empty());
+}
+
+void testGraphicsStagesWithoutKeys(Volk& volk) {
+  compiled.clear();
+  VolkShaderModuleIdentifierCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  Loader loader;
+
+  // The fragment stage has no key and keeps its own module.
+  const uint32_t fragmentCode[4] = {0x07230203, 22, 0, 0};
+  VkShaderModuleCreateInfo moduleInfo = {};
+  moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+  moduleInfo.codeSize = sizeof(fragmentCode);
+  moduleInfo.pCode = fragmentCode;
+  VkShaderModule fragmentModule = VK_NULL_HANDLE;
+  (void)createShaderModule(VK_NULL_HANDLE, &moduleInfo, nullptr, &fragmentModule);
+
+  VkPipelineShaderStageCreateInfo stages[2] = {};
+  stages[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+  stages[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+  stages[0].pName = "main";
+  stages[1] = stages[0];
+  stages[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+  stages[1].module = fragmentModule;
+  VkGraphicsPipelineCreateInfo info = {};
+  info.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+  info.stageCount = 2;
+  info.pStages = stages;
+  const uint64_t keys[2] = {21, 0};
+
+  VkPipeline pipeline = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(cache.createGraphicsPipeline(VK_NULL_HANDLE, info, keys, loader.get(), nullptr, &pipeline) ==
+                  VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.createGraphicsPipeline(VK_NULL_HANDLE, info, keys, loader.get(), nullptr, &pipeline) ==
+                  VK_SUCCESS);
+  VOLK_TEST_CHECK(loader.calls == 1);
+  VOLK_TEST_CHECK(cache.getHitCount() == 1 && cache.getMissCount() == 1);
+  VOLK_TEST_CHECK(stages[0].module == VK_NULL_HANDLE && stages[0].pNext == nullptr);
+  destroyShaderModule(VK_NULL_HANDLE, fragmentModule, nullptr);
+}
+
+void testSerializedIdentifiers(Volk& volk) {
+  compiled.clear();
+  VolkShaderModuleIdentifierCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  auto const info = makeComputeInfo();
+  Loader loader;
+  VkPipeline pipeline = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(cache.createComputePipeline(VK_NULL_HANDLE, info, 31, loader.get(), nullptr, &pipeline) ==
+                  VK_SUCCESS);
+
+  size_t size = 0;
+  VOLK_TEST_CHECK(cache.getData(&size, nullptr) == VK_SUCCESS);
+  std::vector<uint8_t> data(size);
+  VOLK_TEST_CHECK(cache.getData(&size, data.data()) == VK_SUCCESS);
+
+  // A warm start takes the fast path right away.
+  VolkShaderModuleIdentifierCache warm(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(warm.loadData(data.data(), data.size()) == VK_SUCCESS);
+  VOLK_TEST_CHECK(warm.createComputePipeline(VK_NULL_HANDLE, info, 31, loader.get(), nullptr, &pipeline) ==
+                  VK_SUCCESS);
+  VOLK_TEST_CHECK(loader.calls == 1 && warm.getHitCount() == 1);
+
+  VOLK_TEST_CHECK(warm.loadData(data.data(), data.size() - 1) == VK_ERROR_INITIALIZATION_FAILED);
+
+  algorithmUUID = 2;
+  VolkShaderModuleIdentifierCache otherDriver(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(otherDriver.loadData(data.data(), data.size()) == VK_ERROR_INCOMPATIBLE_DRIVER);
+  algorithmUUID = 1;
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetPhysicalDeviceProperties2 = getPhysicalDeviceProperties2;
+  volk.vkCreateShaderModule = createShaderModule;
+  volk.vkDestroyShaderModule = destroyShaderModule;
+  volk.vkGetShaderModuleIdentifierEXT = getShaderModuleIdentifier;
+  volk.vkGetShaderModuleCreateInfoIdentifierEXT = getShaderModuleCreateInfoIdentifier;
+  volk.vkCreateComputePipelines = createComputePipelines;
+  volk.vkCreateGraphicsPipelines = createGraphicsPipelines;
+
+  testIdentifierFastPath(volk);
+  testFallbackWhenCompileRequired(volk);
+  testGraphicsStagesWithoutKeys(volk);
+  testSerializedIdentifiers(volk);
+  return VOLK_TEST_RESULT();
+}
+
+#else
+
+int main() {
+  return 0;
+}
+
+#endif /* defined(VK_EXT_shader_module_identifier) */
@@ -0,0 +1,202 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_shader_object_cache.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_EXT_shader_object)
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+uint64_t nextShader = 0;
+uint32_t binaryCreateCount = 0;
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties2(VkPhysicalDevice, VkPhysicalDeviceProperties2*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL createShaders(VkDevice, uint32_t createInfoCount,
+                                             const VkShaderCreateInfoEXT* pCreateInfos, const VkAllocationCallbacks*,
+                                             VkShaderEXT* pShaders) {
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    if (pCreateInfos[i].codeType == VK_SHADER_CODE_TYPE_BINARY_EXT) {
+      ++binaryCreateCount;
+    }
+    pShaders[i] = reinterpret_cast<VkShaderEXT>(++nextShader);
+  }
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyShader(VkDevice, VkShaderEXT, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL getShaderBinaryData(VkDevice, VkShaderEXT shader, size_t* pDataSize, void* pData) {
+  if (pData) {
+    uint64_t value = reinterpret_cast<uint64_t>(shader);
+    memcpy(pData, &value, sizeof(value));
+  }
+  *pDataSize = sizeof(uint64_t);
+  return VK_SUCCESS;
+}
+
+VkShaderCreateInfoEXT makeInfo(const uint32_t* code, VkShaderStageFlagBits stage) {
+  VkShaderCreateInfoEXT info = {};
+  info.sType = VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT;
+  info.stage = stage;
+  info.codeType = VK_SHADER_CODE_TYPE_SPIRV_EXT;
+  info.codeSize = sizeof(uint32_t) * 4;
+  info.pCode = code;
+  info.pName = "main";
+  return info;
+}
+
+void testPNextBypassesCache(Volk& volk) {
+  VolkShaderObjectCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  const uint32_t code[4] = {0x07230203, 1, 2, 3};
+  VkShaderCreateInfoEXT info = makeInfo(code, VK_SHADER_STAGE_COMPUTE_BIT);
+  VkBaseInStructure ext = {};
+  info.pNext = &ext;
+
+  VkShaderEXT shader = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(cache.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getHitCount() == 0);
+  VOLK_TEST_CHECK(cache.getMissCount() == 0);
+}
+
+void testSetLayoutsAreKeyedByBindings(Volk& volk) {
+  VolkShaderObjectCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  const uint32_t code[4] = {0x07230203, 4, 5, 6};
+
+  VkDescriptorSetLayoutBinding binding = {};
+  binding.binding = 0;
+  binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+  binding.descriptorCount = 1;
+  binding.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT;
+  VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+  layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+  layoutInfo.bindingCount = 1;
+  layoutInfo.pBindings = &binding;
+
+  auto bufferLayout = reinterpret_cast<VkDescriptorSetLayout>(uint64_t(0x100));
+  auto imageLayout = reinterpret_cast<VkDescriptorSetLayout>(uint64_t(0x200));
+  VkShaderCreateInfoEXT info = makeInfo(code, VK_SHADER_STAGE_COMPUTE_BIT);
+  info.setLayoutCount = 1;
+  info.pSetLayouts = &bufferLayout;
+
+  // Unregistered layouts can't be keyed.
+  VkShaderEXT shader = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(cache.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getMissCount() == 0);
+
+  cache.registerSetLayout(bufferLayout, layoutInfo);
+  binding.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+  cache.registerSetLayout(imageLayout, layoutInfo);
+
+  VOLK_TEST_CHECK(cache.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getMissCount() == 1);
+  VOLK_TEST_CHECK(cache.getHitCount() == 1);
+
+  // Same code and layout count, different bindings.
+  info.pSetLayouts = &imageLayout;
+  VOLK_TEST_CHECK(cache.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getMissCount() == 2);
+  VOLK_TEST_CHECK(cache.getHitCount() == 1);
+
+  cache.unregisterSetLayout(imageLayout);
+  VOLK_TEST_CHECK(cache.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getMissCount() == 2);
+  VOLK_TEST_CHECK(cache.getHitCount() == 1);
+}
+
+void testLinkedStagesAreKeyedByGroup(Volk& volk) {
+  VolkShaderObjectCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  const uint32_t vertexCode[4] = {0x07230203, 7, 8, 9};
+  const uint32_t fragmentCode[4] = {0x07230203, 10, 11, 12};
+  const uint32_t otherFragmentCode[4] = {0x07230203, 13, 14, 15};
+
+  VkShaderCreateInfoEXT infos[2] = {makeInfo(vertexCode, VK_SHADER_STAGE_VERTEX_BIT),
+                                    makeInfo(fragmentCode, VK_SHADER_STAGE_FRAGMENT_BIT)};
+  infos[0].flags = VK_SHADER_CREATE_LINK_STAGE_BIT_EXT;
+  infos[0].nextStage = VK_SHADER_STAGE_FRAGMENT_BIT;
+  infos[1].flags = VK_SHADER_CREATE_LINK_STAGE_BIT_EXT;
+
+  VkShaderEXT shaders[2] = {};
+  VOLK_TEST_CHECK(cache.createShaders(2, infos, nullptr, shaders) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getMissCount() == 2);
+
+  // The vertex stage is unchanged, but it was linked against another fragment stage.
+  infos[1].pCode = otherFragmentCode;
+  binaryCreateCount = 0;
+  VOLK_TEST_CHECK(cache.createShaders(2, infos, nullptr, shaders) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getHitCount() == 0);
+  VOLK_TEST_CHECK(cache.getMissCount() == 4);
+  VOLK_TEST_CHECK(binaryCreateCount == 0);
+
+  infos[1].pCode = fragmentCode;
+  VOLK_TEST_CHECK(cache.createShaders(2, infos, nullptr, shaders) == VK_SUCCESS);
+  VOLK_TEST_CHECK(cache.getHitCount() == 2);
+  VOLK_TEST_CHECK(binaryCreateCount == 2);
+}
+
+void testKeyBytesAreCompared(Volk& volk) {
+  VolkShaderObjectCache cache(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  const uint32_t code[4] = {0x07230203, 16, 17, 18};
+  VkShaderCreateInfoEXT info = makeInfo(code, VK_SHADER_STAGE_COMPUTE_BIT);
+  VkShaderEXT shader = VK_NULL_HANDLE;
+  VOLK_TEST_CHECK(cache.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+
+  size_t size = 0;
+  VOLK_TEST_CHECK(cache.getData(&size, nullptr) == VK_SUCCESS);
+  std::vector<uint8_t> data(size);
+  VOLK_TEST_CHECK(cache.getData(&size, data.data()) == VK_SUCCESS);
+
+  // Serialized data from another shader whose key hashes the same: change a byte of the key, but not the hash.
+  const uint32_t otherCode[4] = {0x07230203, 16, 17, 19};
+  auto const found = std::search(data.begin(), data.end(), reinterpret_cast<const uint8_t*>(code),
+                                 reinterpret_cast<const uint8_t*>(code) + sizeof(code));
+  VOLK_TEST_CHECK(found != data.end());
+  if (found != data.end()) {
+    memcpy(&*found, otherCode, sizeof(otherCode));
+  }
+
+  VolkShaderObjectCache collided(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(collided.loadData(data.data(), data.size()) == VK_SUCCESS);
+  binaryCreateCount = 0;
+  VOLK_TEST_CHECK(collided.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(collided.getHitCount() == 0);
+  VOLK_TEST_CHECK(binaryCreateCount == 0);
+
+  // The unmodified data is a hit.
+  VOLK_TEST_CHECK(cache.getData(&size, data.data()) == VK_SUCCESS);
+  VolkShaderObjectCache warm(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(warm.loadData(data.data(), data.size()) == VK_SUCCESS);
+  VOLK_TEST_CHECK(warm.createShaders(1, &info, nullptr, &shader) == VK_SUCCESS);
+  VOLK_TEST_CHECK(warm.getHitCount() == 1);
+  VOLK_TEST_CHECK(binaryCreateCount == 1);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetPhysicalDeviceProperties2 = getPhysicalDeviceProperties2;
+  volk.vkCreateShadersEXT = createShaders;
+  volk.vkDestroyShaderEXT = destroyShader;
+  volk.vkGetShaderBinaryDataEXT = getShaderBinaryData;
+
+  testPNextBypassesCache(volk);
+  testSetLayoutsAreKeyedByBindings(volk);
+  testLinkedStagesAreKeyedByGroup(volk);
+  testKeyBytesAreCompared(volk);
+  return VOLK_TEST_RESULT();
+}
+
+#else
+
+int main() {
+  return 0;
+}
+
+#endif /* defined(VK_EXT_shader_object) */
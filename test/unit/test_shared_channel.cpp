@@ -0,0 +1,246 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_shared_channel.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_BASE_VERSION_1_2) && defined(VK_KHR_external_memory_fd) && defined(VK_KHR_external_semaphore_fd) && \
+  !defined(_WIN32)
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+// Fake driver: exported handles are pipes holding one tag byte, so the consumer can check which object each received
+// fd belongs to. Buffers are tagged by allocation order, the ready and release semaphores with 100 and 101.
+constexpr uint8_t kSemaphoreTag = 100;
+
+VkExternalMemoryFeatureFlags externalFeatures = 0;
+uint64_t nextHandle = 1;
+std::vector<VkDeviceMemory> memories;
+std::vector<VkSemaphore> semaphores;
+std::vector<bool> dedicatedAllocations;
+std::vector<uint8_t> importedTags;
+bool importedCloseOnExec = true;
+
+template <typename Handle>
+Handle makeHandle() {
+  return reinterpret_cast<Handle>(static_cast<uintptr_t>(nextHandle++));
+}
+
+int makeFd(uint8_t tag) {
+  int fds[2] = {-1, -1};
+  if (pipe(fds) != 0) {
+    return -1;
+  }
+  (void)write(fds[1], &tag, 1);
+  close(fds[1]);
+  return fds[0];
+}
+
+void importFd(int fd) {
+  importedCloseOnExec = importedCloseOnExec && (fcntl(fd, F_GETFD) & FD_CLOEXEC);
+  uint8_t tag = 0xff;
+  (void)read(fd, &tag, 1);
+  close(fd);
+  importedTags.push_back(tag);
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties* pProperties) {
+  *pProperties = {};
+  pProperties->memoryTypeCount = 1;
+  pProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceProperties2(VkPhysicalDevice, VkPhysicalDeviceProperties2* pProperties) {
+  auto idProperties = static_cast<VkPhysicalDeviceIDProperties*>(pProperties->pNext);
+  std::memset(idProperties->deviceUUID, 1, VK_UUID_SIZE);
+  std::memset(idProperties->driverUUID, 2, VK_UUID_SIZE);
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceExternalBufferProperties(VkPhysicalDevice,
+                                                                     const VkPhysicalDeviceExternalBufferInfo*,
+                                                                     VkExternalBufferProperties* pProperties) {
+  pProperties->externalMemoryProperties.externalMemoryFeatures = externalFeatures;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*,
+                                               VkSemaphore* pSemaphore) {
+  *pSemaphore = makeHandle<VkSemaphore>();
+  semaphores.push_back(*pSemaphore);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createBuffer(VkDevice, const VkBufferCreateInfo*, const VkAllocationCallbacks*,
+                                            VkBuffer* pBuffer) {
+  *pBuffer = makeHandle<VkBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements(VkDevice, VkBuffer, VkMemoryRequirements* pRequirements) {
+  pRequirements->size = 4096;
+  pRequirements->alignment = 256;
+  pRequirements->memoryTypeBits = 1;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo* pAllocateInfo,
+                                              const VkAllocationCallbacks*, VkDeviceMemory* pMemory) {
+  bool dedicated = false;
+  for (auto next = static_cast<const VkBaseInStructure*>(pAllocateInfo->pNext); next; next = next->pNext) {
+    if (next->sType == VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO) {
+      dedicated = reinterpret_cast<const VkMemoryDedicatedAllocateInfo*>(next)->buffer != VK_NULL_HANDLE;
+    } else if (next->sType == VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR) {
+      importFd(reinterpret_cast<const VkImportMemoryFdInfoKHR*>(next)->fd);
+    }
+  }
+  dedicatedAllocations.push_back(dedicated);
+  *pMemory = makeHandle<VkDeviceMemory>();
+  memories.push_back(*pMemory);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory(VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL freeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL getMemoryFd(VkDevice, const VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
+  for (size_t i = 0; i < memories.size(); ++i) {
+    if (memories[i] == pGetFdInfo->memory) {
+      *pFd = makeFd(static_cast<uint8_t>(i));
+    }
+  }
+  return *pFd >= 0 ? VK_SUCCESS : VK_ERROR_TOO_MANY_OBJECTS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreFd(VkDevice, const VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
+  for (size_t i = 0; i < semaphores.size(); ++i) {
+    if (semaphores[i] == pGetFdInfo->semaphore) {
+      *pFd = makeFd(static_cast<uint8_t>(kSemaphoreTag + i));
+    }
+  }
+  return *pFd >= 0 ? VK_SUCCESS : VK_ERROR_TOO_MANY_OBJECTS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL importSemaphoreFd(VkDevice, const VkImportSemaphoreFdInfoKHR* pImportInfo) {
+  importFd(pImportInfo->fd);
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores(VkDevice, const VkSemaphoreWaitInfo*, uint64_t) {
+  return VK_SUCCESS;
+}
+
+void reset(VkExternalMemoryFeatureFlags features) {
+  externalFeatures = features;
+  memories.clear();
+  semaphores.clear();
+  dedicatedAllocations.clear();
+  importedTags.clear();
+  importedCloseOnExec = true;
+}
+
+// The consumer runs in a child process, like the producer's peer would after socketpair() and fork().
+int consume(Volk& volk, int socket, bool dedicated) {
+  reset(VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT);
+  VolkSharedChannel channel(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(channel.receive(socket) == VK_SUCCESS);
+  VOLK_TEST_CHECK(channel.getBufferCount() == 3);
+  VOLK_TEST_CHECK(channel.getBufferSize() == 4000);
+  VOLK_TEST_CHECK(channel.getReadySemaphore() != VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(importedTags == std::vector<uint8_t>({kSemaphoreTag, kSemaphoreTag + 1, 0, 1, 2}));
+  VOLK_TEST_CHECK(importedCloseOnExec);
+  VOLK_TEST_CHECK(dedicatedAllocations == std::vector<bool>(3, dedicated));
+  return VOLK_TEST_RESULT();
+}
+
+void testSendToChildProcess(Volk& volk, bool dedicated) {
+  int sockets[2] = {-1, -1};
+  VOLK_TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+  auto const pid = fork();
+  if (pid == 0) {
+    close(sockets[0]);
+    _exit(consume(volk, sockets[1], dedicated));
+  }
+  close(sockets[1]);
+
+  VkExternalMemoryFeatureFlags features = VK_EXTERNAL_MEMORY_FEATURE_EXPORTABLE_BIT;
+  if (dedicated) {
+    features |= VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT;
+  }
+  reset(features);
+  VolkSharedChannel channel(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(channel.getStatus() == VK_SUCCESS);
+  VOLK_TEST_CHECK(channel.createBuffers(3, 4000, VK_BUFFER_USAGE_TRANSFER_DST_BIT) == VK_SUCCESS);
+  VOLK_TEST_CHECK(dedicatedAllocations == std::vector<bool>(3, dedicated));
+  VOLK_TEST_CHECK(channel.send(sockets[0]) == VK_SUCCESS);
+  close(sockets[0]);
+
+  int status = 0;
+  VOLK_TEST_CHECK(waitpid(pid, &status, 0) == pid);
+  VOLK_TEST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS);
+}
+
+void testUnsupportedExportFails(Volk& volk) {
+  reset(VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT);
+  VolkSharedChannel channel(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(channel.createBuffers(2, 4000, VK_BUFFER_USAGE_TRANSFER_DST_BIT) == VK_ERROR_FEATURE_NOT_PRESENT);
+  VOLK_TEST_CHECK(channel.getBufferCount() == 0);
+  VOLK_TEST_CHECK(memories.empty());
+}
+
+void testSendToClosedPeerFails(Volk& volk) {
+  int sockets[2] = {-1, -1};
+  VOLK_TEST_CHECK(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+  close(sockets[1]);
+  reset(VK_EXTERNAL_MEMORY_FEATURE_EXPORTABLE_BIT);
+  VolkSharedChannel channel(volk, VK_NULL_HANDLE, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(channel.createBuffers(1, 4000, VK_BUFFER_USAGE_TRANSFER_DST_BIT) == VK_SUCCESS);
+  // Would raise SIGPIPE and kill the test without MSG_NOSIGNAL or SO_NOSIGPIPE.
+  VOLK_TEST_CHECK(channel.send(sockets[0]) == VK_ERROR_INITIALIZATION_FAILED);
+  close(sockets[0]);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkGetPhysicalDeviceMemoryProperties = getPhysicalDeviceMemoryProperties;
+  volk.vkGetPhysicalDeviceProperties2 = getPhysicalDeviceProperties2;
+  volk.vkGetPhysicalDeviceExternalBufferProperties = getPhysicalDeviceExternalBufferProperties;
+  volk.vkCreateSemaphore = createSemaphore;
+  volk.vkCreateBuffer = createBuffer;
+  volk.vkGetBufferMemoryRequirements = getBufferMemoryRequirements;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkBindBufferMemory = bindBufferMemory;
+  volk.vkDestroyBuffer = destroyBuffer;
+  volk.vkFreeMemory = freeMemory;
+  volk.vkDestroySemaphore = destroySemaphore;
+  volk.vkGetMemoryFdKHR = getMemoryFd;
+  volk.vkGetSemaphoreFdKHR = getSemaphoreFd;
+  volk.vkImportSemaphoreFdKHR = importSemaphoreFd;
+  volk.vkWaitSemaphores = waitSemaphores;
+
+  testSendToChildProcess(volk, false);
+  testSendToChildProcess(volk, true);
+  testUnsupportedExportFails(volk);
+  testSendToClosedPeerFails(volk);
+  return VOLK_TEST_RESULT();
+}
+
+#else
+
+int main() {
+  return 0;
+}
+
+#endif
@@ -0,0 +1,254 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_state_filter.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_COMPUTE_VERSION_1_0) && defined(VK_GRAPHICS_VERSION_1_0)
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using Command = VolkStateFilter::Command;
+
+uint32_t bindPipelineCount = 0;
+uint32_t bindDescriptorSetsCount = 0;
+uint32_t pushConstantsCount = 0;
+uint32_t setViewportCount = 0;
+std::vector<uint32_t> dynamicOffsets;
+
+VkCommandBuffer commandBuffer(uintptr_t value) {
+  return reinterpret_cast<VkCommandBuffer>(value);
+}
+
+template <typename T>
+T handle(uint64_t value) {
+  return reinterpret_cast<T>(static_cast<uintptr_t>(value));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer(VkCommandBuffer, const VkCommandBufferBeginInfo*) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdExecuteCommands(VkCommandBuffer, uint32_t, const VkCommandBuffer*) {}
+
+VKAPI_ATTR void VKAPI_CALL cmdBindPipeline(VkCommandBuffer, VkPipelineBindPoint, VkPipeline) {
+  ++bindPipelineCount;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdBindDescriptorSets(VkCommandBuffer, VkPipelineBindPoint, VkPipelineLayout, uint32_t,
+                                                 uint32_t, const VkDescriptorSet*, uint32_t dynamicOffsetCount,
+                                                 const uint32_t* pDynamicOffsets) {
+  ++bindDescriptorSetsCount;
+  dynamicOffsets.assign(pDynamicOffsets, pDynamicOffsets + dynamicOffsetCount);
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdPushConstants(VkCommandBuffer, VkPipelineLayout, VkShaderStageFlags, uint32_t, uint32_t,
+                                            const void*) {
+  ++pushConstantsCount;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdSetViewport(VkCommandBuffer, uint32_t, uint32_t, const VkViewport*) {
+  ++setViewportCount;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdSetScissor(VkCommandBuffer, uint32_t, uint32_t, const VkRect2D*) {}
+
+void testPushConstantsWrittenMask(Volk& volk) {
+  VolkStateFilter filter(volk);
+  auto const cb = commandBuffer(1);
+  auto const layout = handle<VkPipelineLayout>(1);
+  uint8_t zeros[32] = {};
+  uint8_t values[32];
+  for (uint32_t i = 0; i < 32; ++i) {
+    values[i] = uint8_t(i + 1);
+  }
+
+  pushConstantsCount = 0;
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 0, 16, values);
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 0, 16, values);
+  VOLK_TEST_CHECK(pushConstantsCount == 1);
+
+  // The shadow bytes of [16, 32) are zero, but they were never pushed: the driver's values are undefined.
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 16, 16, zeros);
+  VOLK_TEST_CHECK(pushConstantsCount == 2);
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 16, 16, zeros);
+  VOLK_TEST_CHECK(pushConstantsCount == 2);
+
+  // A range overlapping written and unwritten bytes is forwarded.
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 24, 16, zeros);
+  VOLK_TEST_CHECK(pushConstantsCount == 3);
+
+  // Ranges crossing the first 64-byte word of the mask.
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 56, 16, values);
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 56, 16, values);
+  VOLK_TEST_CHECK(pushConstantsCount == 4);
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 64, 8, values + 8);
+  VOLK_TEST_CHECK(pushConstantsCount == 4);
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_VERTEX_BIT, 64, 16, values + 8);
+  VOLK_TEST_CHECK(pushConstantsCount == 5);
+
+  // Other stages or another layout forget what was written.
+  filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_FRAGMENT_BIT, 0, 16, values);
+  VOLK_TEST_CHECK(pushConstantsCount == 6);
+  filter.vkCmdPushConstants(cb, handle<VkPipelineLayout>(2), VK_SHADER_STAGE_FRAGMENT_BIT, 0, 16, values);
+  VOLK_TEST_CHECK(pushConstantsCount == 7);
+
+  // So does binding a pipeline, whose layout may not be compatible.
+  filter.vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, handle<VkPipeline>(1));
+  filter.vkCmdPushConstants(cb, handle<VkPipelineLayout>(2), VK_SHADER_STAGE_FRAGMENT_BIT, 0, 16, values);
+  VOLK_TEST_CHECK(pushConstantsCount == 8);
+}
+
+void testDynamicOffsetsAreNeverElided(Volk& volk) {
+  VolkStateFilter filter(volk);
+  auto const cb = commandBuffer(1);
+  auto const layout = handle<VkPipelineLayout>(1);
+  VkDescriptorSet sets[2] = {handle<VkDescriptorSet>(1), handle<VkDescriptorSet>(2)};
+  uint32_t offsets[2] = {256, 512};
+
+  bindDescriptorSetsCount = 0;
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 2, offsets);
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 2, offsets);
+  offsets[1] = 768;
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 2, offsets);
+  VOLK_TEST_CHECK(bindDescriptorSetsCount == 3);
+  VOLK_TEST_CHECK(dynamicOffsets.size() == 2 && dynamicOffsets[1] == 768);
+
+  // Sets bound with dynamic offsets aren't shadowed, so binding them without offsets is forwarded too.
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 0, nullptr);
+  VOLK_TEST_CHECK(bindDescriptorSetsCount == 4);
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 0, nullptr);
+  VOLK_TEST_CHECK(bindDescriptorSetsCount == 4);
+}
+
+void testLayoutChangeClearsSets(Volk& volk) {
+  VolkStateFilter filter(volk);
+  auto const cb = commandBuffer(1);
+  auto const layoutA = handle<VkPipelineLayout>(1);
+  auto const layoutB = handle<VkPipelineLayout>(2);
+  VkDescriptorSet sets[2] = {handle<VkDescriptorSet>(1), handle<VkDescriptorSet>(2)};
+
+  bindDescriptorSetsCount = 0;
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layoutA, 0, 2, sets, 0, nullptr);
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layoutB, 0, 1, sets, 0, nullptr);
+  VOLK_TEST_CHECK(bindDescriptorSetsCount == 2);
+
+  // Set 1 was bound with layoutA; the layout change may have disturbed it.
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layoutB, 1, 1, sets + 1, 0, nullptr);
+  VOLK_TEST_CHECK(bindDescriptorSetsCount == 3);
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, layoutB, 0, 2, sets, 0, nullptr);
+  VOLK_TEST_CHECK(bindDescriptorSetsCount == 3);
+
+  // The compute bind point is shadowed separately.
+  filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_COMPUTE, layoutB, 0, 2, sets, 0, nullptr);
+  VOLK_TEST_CHECK(bindDescriptorSetsCount == 4);
+}
+
+void testResetOnCommandBufferChange(Volk& volk) {
+  VolkStateFilter filter(volk);
+  auto const pipeline = handle<VkPipeline>(1);
+  VkViewport viewport = {0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f};
+
+  bindPipelineCount = 0;
+  setViewportCount = 0;
+  filter.vkCmdBindPipeline(commandBuffer(1), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+  filter.vkCmdSetViewport(commandBuffer(1), 0, 1, &viewport);
+  filter.vkCmdBindPipeline(commandBuffer(1), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+  filter.vkCmdSetViewport(commandBuffer(1), 0, 1, &viewport);
+  VOLK_TEST_CHECK(bindPipelineCount == 1 && setViewportCount == 1);
+
+  // Another command buffer has none of that state.
+  filter.vkCmdBindPipeline(commandBuffer(2), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+  filter.vkCmdSetViewport(commandBuffer(2), 0, 1, &viewport);
+  VOLK_TEST_CHECK(bindPipelineCount == 2 && setViewportCount == 2);
+
+  // Neither has the same command buffer once it is begun again.
+  VkCommandBufferBeginInfo beginInfo = {};
+  beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  VOLK_TEST_CHECK(filter.vkBeginCommandBuffer(commandBuffer(2), &beginInfo) == VK_SUCCESS);
+  filter.vkCmdBindPipeline(commandBuffer(2), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+  filter.vkCmdBindPipeline(commandBuffer(2), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+  VOLK_TEST_CHECK(bindPipelineCount == 3);
+
+  // Secondary command buffers leave the state undefined.
+  auto const secondary = commandBuffer(3);
+  filter.vkCmdExecuteCommands(commandBuffer(2), 1, &secondary);
+  filter.vkCmdBindPipeline(commandBuffer(2), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+  VOLK_TEST_CHECK(bindPipelineCount == 4);
+
+  // Binding a graphics pipeline resets the dynamic viewports its static state may override.
+  filter.vkCmdSetViewport(commandBuffer(2), 0, 1, &viewport);
+  filter.vkCmdBindPipeline(commandBuffer(2), VK_PIPELINE_BIND_POINT_GRAPHICS, handle<VkPipeline>(2));
+  filter.vkCmdSetViewport(commandBuffer(2), 0, 1, &viewport);
+  VOLK_TEST_CHECK(setViewportCount == 4);
+}
+
+void testStats(Volk& volk) {
+  VolkStateFilter filter(volk);
+  VOLK_TEST_CHECK(filter.getStatus() == VK_SUCCESS);
+  auto const cb = commandBuffer(1);
+  auto const layout = handle<VkPipelineLayout>(1);
+  auto const set = handle<VkDescriptorSet>(1);
+  VkRect2D scissor = {{0, 0}, {64, 64}};
+  uint32_t value = 7;
+
+  for (uint32_t i = 0; i < 3; ++i) {
+    filter.vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, handle<VkPipeline>(1));
+    filter.vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, 1, &set, 0, nullptr);
+    filter.vkCmdSetScissor(cb, 0, 1, &scissor);
+    filter.vkCmdPushConstants(cb, layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(value), &value);
+  }
+
+  auto const& stats = filter.getStats();
+  VOLK_TEST_CHECK(stats.calls[uint32_t(Command::BindPipeline)] == 3);
+  VOLK_TEST_CHECK(stats.elided[uint32_t(Command::BindPipeline)] == 2);
+  VOLK_TEST_CHECK(stats.calls[uint32_t(Command::BindDescriptorSets)] == 3);
+  VOLK_TEST_CHECK(stats.elided[uint32_t(Command::BindDescriptorSets)] == 2);
+  VOLK_TEST_CHECK(stats.calls[uint32_t(Command::SetScissor)] == 3);
+  VOLK_TEST_CHECK(stats.elided[uint32_t(Command::SetScissor)] == 2);
+  VOLK_TEST_CHECK(stats.calls[uint32_t(Command::PushConstants)] == 3);
+  VOLK_TEST_CHECK(stats.elided[uint32_t(Command::PushConstants)] == 2);
+  VOLK_TEST_CHECK(stats.calls[uint32_t(Command::SetViewport)] == 0);
+
+  filter.resetStats();
+  VOLK_TEST_CHECK(filter.getStats().calls[uint32_t(Command::BindPipeline)] == 0);
+  VOLK_TEST_CHECK(filter.getStats().elided[uint32_t(Command::PushConstants)] == 0);
+
+  // Resetting the stats keeps the shadowed state.
+  filter.vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, handle<VkPipeline>(1));
+  VOLK_TEST_CHECK(filter.getStats().elided[uint32_t(Command::BindPipeline)] == 1);
+
+  Volk missing;
+  VolkStateFilter unloaded(missing);
+  VOLK_TEST_CHECK(unloaded.getStatus() == VK_ERROR_EXTENSION_NOT_PRESENT);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkBeginCommandBuffer = beginCommandBuffer;
+  volk.vkCmdExecuteCommands = cmdExecuteCommands;
+  volk.vkCmdBindPipeline = cmdBindPipeline;
+  volk.vkCmdBindDescriptorSets = cmdBindDescriptorSets;
+  volk.vkCmdPushConstants = cmdPushConstants;
+  volk.vkCmdSetViewport = cmdSetViewport;
+  volk.vkCmdSetScissor = cmdSetScissor;
+
+  testPushConstantsWrittenMask(volk);
+  testDynamicOffsetsAreNeverElided(volk);
+  testLayoutChangeClearsSets(volk);
+  testResetOnCommandBufferChange(volk);
+  testStats(volk);
+  return VOLK_TEST_RESULT();
+}
+
+#else
+
+int main() {
+  return 0;
+}
+
+#endif /* defined(VK_COMPUTE_VERSION_1_0) && defined(VK_GRAPHICS_VERSION_1_0) */
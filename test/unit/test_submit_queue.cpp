@@ -0,0 +1,238 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_submit_queue.hpp"
+#include "volk_test.hpp"
+
+#if defined(VK_BASE_VERSION_1_3)
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Submission {
+  std::vector<uintptr_t> batches; // the command buffer of each batch
+  VkFence fence = VK_NULL_HANDLE;
+};
+
+// Written under the queue lock of VolkSubmitQueue, read after flush() or wait() returns.
+std::vector<Submission> submissions;
+VkResult submitResult = VK_SUCCESS;
+
+VkCommandBuffer commandBuffer(uintptr_t value) {
+  return reinterpret_cast<VkCommandBuffer>(value);
+}
+
+VkFence fence(uintptr_t value) {
+  return reinterpret_cast<VkFence>(value);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL queueSubmit2(VkQueue, uint32_t submitCount, const VkSubmitInfo2* pSubmits,
+                                            VkFence fence) {
+  Submission submission;
+  for (uint32_t i = 0; i < submitCount; ++i) {
+    submission.batches.push_back(reinterpret_cast<uintptr_t>(pSubmits[i].pCommandBufferInfos[0].commandBuffer));
+  }
+  submission.fence = fence;
+  submissions.push_back(submission);
+  return submitResult;
+}
+
+uint64_t enqueue(VolkSubmitQueue& queue, uintptr_t id, std::vector<uint64_t> dependencies = {}) {
+  VkCommandBufferSubmitInfo commandBufferInfo = {};
+  commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+  commandBufferInfo.commandBuffer = commandBuffer(id);
+  VkSubmitInfo2 submitInfo = {};
+  submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+  submitInfo.commandBufferInfoCount = 1;
+  submitInfo.pCommandBufferInfos = &commandBufferInfo;
+  return queue.enqueue(submitInfo, static_cast<uint32_t>(dependencies.size()), dependencies.data());
+}
+
+void testDependencyOrder(Volk& volk) {
+  submissions.clear();
+  VolkSubmitQueue queue(volk, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(queue.getStatus() == VK_SUCCESS);
+
+  auto const a = enqueue(queue, 1);
+  auto const b = enqueue(queue, 2, {a, a + 2}); // tickets not handed out yet are ignored
+  auto const c = enqueue(queue, 3);
+  enqueue(queue, 4, {b, c});
+  VOLK_TEST_CHECK(submissions.empty());
+
+  VOLK_TEST_CHECK(queue.flush(fence(7)) == VK_SUCCESS);
+  VOLK_TEST_CHECK(submissions.size() == 1);
+  if (submissions.size() == 1) {
+    VOLK_TEST_CHECK((submissions[0].batches == std::vector<uintptr_t>{1, 2, 3, 4}));
+    VOLK_TEST_CHECK(submissions[0].fence == fence(7));
+  }
+
+  // A dependency on a submitted batch is satisfied, an empty flush only submits a fence.
+  enqueue(queue, 5, {c});
+  VOLK_TEST_CHECK(queue.flush() == VK_SUCCESS);
+  VOLK_TEST_CHECK(queue.flush() == VK_SUCCESS);
+  VOLK_TEST_CHECK(queue.flush(fence(8)) == VK_SUCCESS);
+  VOLK_TEST_CHECK(submissions.size() == 3);
+  if (submissions.size() == 3) {
+    VOLK_TEST_CHECK(submissions[1].batches == std::vector<uintptr_t>{5});
+    VOLK_TEST_CHECK(submissions[2].batches.empty() && submissions[2].fence == fence(8));
+  }
+
+  auto const stats = queue.getStats();
+  VOLK_TEST_CHECK(stats.batches == 5);
+  VOLK_TEST_CHECK(stats.driverCalls == 3);
+}
+
+void testFailureKeepsBatches(Volk& volk) {
+  submissions.clear();
+  VolkSubmitQueue queue(volk, VK_NULL_HANDLE);
+
+  auto const a = enqueue(queue, 1);
+  enqueue(queue, 2, {a});
+  submitResult = VK_ERROR_DEVICE_LOST;
+  VOLK_TEST_CHECK(queue.flush() == VK_ERROR_DEVICE_LOST);
+  VOLK_TEST_CHECK(queue.getStats().batches == 0);
+
+  // The batches are retried in order together with new ones; the dependency still holds.
+  submitResult = VK_SUCCESS;
+  enqueue(queue, 3, {a});
+  VOLK_TEST_CHECK(queue.flush() == VK_SUCCESS);
+  VOLK_TEST_CHECK(submissions.size() == 2);
+  if (submissions.size() == 2) {
+    VOLK_TEST_CHECK((submissions[0].batches == std::vector<uintptr_t>{1, 2}));
+    VOLK_TEST_CHECK((submissions[1].batches == std::vector<uintptr_t>{1, 2, 3}));
+  }
+  auto const stats = queue.getStats();
+  VOLK_TEST_CHECK(stats.batches == 3);
+  VOLK_TEST_CHECK(stats.driverCalls == 2);
+}
+
+void testSubmitThread(Volk& volk) {
+  submissions.clear();
+  VolkSubmitQueue queue(volk, VK_NULL_HANDLE, true);
+
+  auto const a = enqueue(queue, 1);
+  enqueue(queue, 2, {a});
+  VOLK_TEST_CHECK(queue.flush(fence(7)) == VK_SUCCESS);
+  queue.wait();
+  VOLK_TEST_CHECK(submissions.size() == 1);
+  if (submissions.size() == 1) {
+    VOLK_TEST_CHECK((submissions[0].batches == std::vector<uintptr_t>{1, 2}));
+    VOLK_TEST_CHECK(submissions[0].fence == fence(7));
+  }
+
+  // Errors on the submit thread are reported by getStatus() and the batches are retried by the next flush.
+  submitResult = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+  enqueue(queue, 3);
+  VOLK_TEST_CHECK(queue.flush() == VK_SUCCESS);
+  queue.wait();
+  VOLK_TEST_CHECK(queue.getStatus() == VK_ERROR_OUT_OF_DEVICE_MEMORY);
+  submitResult = VK_SUCCESS;
+  VOLK_TEST_CHECK(queue.flush() == VK_SUCCESS);
+  queue.wait();
+  VOLK_TEST_CHECK(submissions.size() == 3);
+  if (submissions.size() == 3) {
+    VOLK_TEST_CHECK(submissions[2].batches == std::vector<uintptr_t>{3});
+  }
+
+  // call() submits on the calling thread before the function runs.
+  enqueue(queue, 4);
+  size_t submitted = 0;
+  queue.call([&submitted] { submitted = submissions.size(); });
+  VOLK_TEST_CHECK(submitted == 4);
+  VOLK_TEST_CHECK(queue.getStats().batches == 4);
+}
+
+void testConcurrentProducers(Volk& volk) {
+  submissions.clear();
+  constexpr uint32_t kThreads = 4;
+  constexpr uint32_t kBatches = 500;
+
+  // Every batch depends on the one its producer enqueued before and on the ticket after the latest one returned to any
+  // producer, which may still be on its way into the queue; such batches are held back by a concurrent flush.
+  std::map<uintptr_t, std::vector<uintptr_t>> dependencies; // batch id -> ids it depends on
+  std::vector<std::vector<std::pair<uintptr_t, std::vector<uint64_t>>>> enqueued(kThreads);
+  std::vector<std::vector<uint64_t>> tickets(kThreads);
+  {
+    VolkSubmitQueue queue(volk, VK_NULL_HANDLE);
+    std::atomic<uint64_t> latest = 0;
+    std::atomic<uint32_t> running = kThreads;
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&, t] {
+        uint64_t previous = 0;
+        for (uint32_t i = 0; i < kBatches; ++i) {
+          auto const id = uintptr_t(t) * kBatches + i + 1;
+          std::vector<uint64_t> depends = {previous, latest.load() + 1};
+          previous = enqueue(queue, id, depends);
+          latest = previous;
+          enqueued[t].emplace_back(id, depends);
+          tickets[t].push_back(previous);
+        }
+        --running;
+      });
+    }
+    while (running != 0) {
+      VOLK_TEST_CHECK(queue.flush() == VK_SUCCESS);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    VOLK_TEST_CHECK(queue.flush() == VK_SUCCESS);
+    VOLK_TEST_CHECK(queue.getStats().batches == kThreads * kBatches);
+  }
+
+  std::map<uint64_t, uintptr_t> ids; // ticket -> batch id
+  for (uint32_t t = 0; t < kThreads; ++t) {
+    for (uint32_t i = 0; i < kBatches; ++i) {
+      ids[tickets[t][i]] = enqueued[t][i].first;
+    }
+  }
+  std::map<uintptr_t, size_t> position;
+  for (auto const& submission : submissions) {
+    for (auto id : submission.batches) {
+      VOLK_TEST_CHECK(position.count(id) == 0);
+      position.emplace(id, position.size());
+    }
+  }
+  VOLK_TEST_CHECK(position.size() == kThreads * kBatches);
+  for (uint32_t t = 0; t < kThreads; ++t) {
+    for (uint32_t i = 0; i < kBatches; ++i) {
+      auto const& [id, depends] = enqueued[t][i];
+      for (auto ticket : depends) {
+        if (ticket != 0 && ticket < tickets[t][i]) {
+          VOLK_TEST_CHECK(position[ids[ticket]] < position[id]);
+        }
+      }
+    }
+  }
+}
+
+void testMissingSynchronization2() {
+  Volk volk;
+  VolkSubmitQueue queue(volk, VK_NULL_HANDLE);
+  VOLK_TEST_CHECK(queue.getStatus() == VK_ERROR_EXTENSION_NOT_PRESENT);
+  VOLK_TEST_CHECK(queue.flush() == VK_ERROR_EXTENSION_NOT_PRESENT);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkQueueSubmit2 = queueSubmit2;
+
+  testDependencyOrder(volk);
+  testFailureKeepsBatches(volk);
+  testSubmitThread(volk);
+  testConcurrentProducers(volk);
+  testMissingSynchronization2();
+  return VOLK_TEST_RESULT();
+}
+
+#else
+int main() {
+  return 0;
+}
+#endif
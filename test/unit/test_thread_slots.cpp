@@ -0,0 +1,136 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_frame_budget.hpp"
+#include "volk_thread_slots.hpp"
+#include "volk_test.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void testSlotsAreReleasedOnThreadExit() {
+  std::vector<uint32_t> retired;
+  VolkThreadSlots<3> slots([&retired](uint32_t slot) { retired.push_back(slot); });
+
+  uint32_t first = ~0U;
+  std::thread([&] { first = slots.acquire(); }).join();
+  VOLK_TEST_CHECK(first == 0);
+  VOLK_TEST_CHECK(retired.size() == 1 && retired[0] == 0);
+  VOLK_TEST_CHECK(slots.getOwner(0) == std::thread::id());
+
+  uint32_t second = ~0U;
+  std::thread([&] { second = slots.acquire(); }).join();
+  VOLK_TEST_CHECK(second == 0);
+  VOLK_TEST_CHECK(retired.size() == 2);
+}
+
+void testThreadsBeyondCountShareLastSlot() {
+  VolkThreadSlots<3> slots;
+  VOLK_TEST_CHECK(slots.acquire() == 0);
+  VOLK_TEST_CHECK(slots.acquire() == 0);
+
+  uint32_t second = ~0U;
+  uint32_t third = ~0U;
+  std::thread([&] {
+    second = slots.acquire();
+    std::thread([&] { third = slots.acquire(); }).join();
+  }).join();
+  VOLK_TEST_CHECK(second == 1);
+  VOLK_TEST_CHECK(third == VolkThreadSlots<3>::kSharedSlot);
+}
+
+void testDestroyedSlotsAreNotReleased() {
+  uint32_t retireCount = 0;
+  auto slots = std::make_unique<VolkThreadSlots<2>>([&retireCount](uint32_t) { ++retireCount; });
+  std::mutex mutex;
+  std::condition_variable changed;
+  bool acquired = false;
+  bool destroyed = false;
+  std::thread thread([&] {
+    (void)slots->acquire();
+    std::unique_lock lock(mutex);
+    acquired = true;
+    changed.notify_all();
+    changed.wait(lock, [&] { return destroyed; });
+  });
+  {
+    std::unique_lock lock(mutex);
+    changed.wait(lock, [&] { return acquired; });
+    slots.reset();
+    destroyed = true;
+    changed.notify_all();
+  }
+  thread.join();
+  VOLK_TEST_CHECK(retireCount == 0);
+}
+
+void testRetireCallbackMayUseOtherSlots() {
+  // Retire callbacks run without the registry lock: constructing, using and destroying other objects works.
+  uint32_t innerSlot = ~0U;
+  VolkThreadSlots<2> slots([&innerSlot](uint32_t) {
+    VolkThreadSlots<2> inner;
+    innerSlot = inner.acquire();
+  });
+  std::thread([&] { (void)slots.acquire(); }).join();
+  VOLK_TEST_CHECK(innerSlot == 0);
+}
+
+void testDestructorWaitsForRetireCallback() {
+  std::mutex mutex;
+  std::condition_variable changed;
+  bool started = false;
+  bool finished = false;
+  auto slots = std::make_unique<VolkThreadSlots<2>>([&](uint32_t) {
+    {
+      std::lock_guard lock(mutex);
+      started = true;
+    }
+    changed.notify_all();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::lock_guard lock(mutex);
+    finished = true;
+  });
+  std::thread thread([&] { (void)slots->acquire(); });
+  {
+    std::unique_lock lock(mutex);
+    changed.wait(lock, [&] { return started; });
+  }
+  slots.reset();
+  {
+    std::lock_guard lock(mutex);
+    VOLK_TEST_CHECK(finished);
+  }
+  thread.join();
+}
+
+void testFrameBudgetKeepsTimeOfExitedThreads(Volk& volk) {
+  VolkFrameBudget budget(volk);
+  std::thread([&] {
+    VolkFrameBudget::Scope scope(budget, VolkFrameBudget::Category::Recording);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }).join();
+  budget.markFrame();
+
+  auto stats = budget.getStats(VolkFrameBudget::Category::Recording);
+  VOLK_TEST_CHECK(stats.frameCount == 1);
+  VOLK_TEST_CHECK(stats.maxNanoseconds >= 1000000);
+  VOLK_TEST_CHECK(budget.getStats(VolkFrameBudget::Category::Recording, 0).maxNanoseconds == 0);
+  VOLK_TEST_CHECK(budget.getSlotThread(0) == std::thread::id());
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  testSlotsAreReleasedOnThreadExit();
+  testThreadsBeyondCountShareLastSlot();
+  testDestroyedSlotsAreNotReleased();
+  testRetireCallbackMayUseOtherSlots();
+  testDestructorWaitsForRetireCallback();
+  testFrameBudgetKeepsTimeOfExitedThreads(volk);
+  return VOLK_TEST_RESULT();
+}
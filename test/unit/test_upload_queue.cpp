@@ -0,0 +1,332 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_test.hpp"
+#include "volk_upload_queue.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace {
+
+// Fake device: the ring lives in host memory, buffer copies are executed when recorded, and the transfer queue
+// completes a batch when the host waits for it.
+std::vector<uint8_t> ringMemory;
+VkDeviceSize lastBufferSize = 0;
+uint64_t nextHandle = 1;
+uint64_t submittedValue = 0;
+uint64_t completedValue = 0;
+std::vector<VkBufferCopy> bufferRegions;
+std::map<VkBuffer, std::vector<uint8_t>> bufferContents;
+std::vector<std::vector<VkImageMemoryBarrier2>> imageBarrierCalls;
+
+template <typename Handle>
+Handle makeHandle() {
+  return reinterpret_cast<Handle>(static_cast<uintptr_t>(nextHandle++));
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createBuffer(VkDevice, const VkBufferCreateInfo* pCreateInfo,
+                                            const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+  lastBufferSize = pCreateInfo->size;
+  *pBuffer = makeHandle<VkBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements(VkDevice, VkBuffer, VkMemoryRequirements* pRequirements) {
+  pRequirements->size = lastBufferSize;
+  pRequirements->alignment = 256;
+  pRequirements->memoryTypeBits = 1;
+}
+
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties(VkPhysicalDevice,
+                                                             VkPhysicalDeviceMemoryProperties* pProperties) {
+  *pProperties = {};
+  pProperties->memoryTypeCount = 1;
+  pProperties->memoryTypes[0].propertyFlags =
+    VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo* pAllocateInfo,
+                                              const VkAllocationCallbacks*, VkDeviceMemory* pMemory) {
+  ringMemory.assign(static_cast<size_t>(pAllocateInfo->allocationSize), 0);
+  *pMemory = makeHandle<VkDeviceMemory>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory(VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL mapMemory(VkDevice, VkDeviceMemory, VkDeviceSize, VkDeviceSize, VkMemoryMapFlags,
+                                         void** ppData) {
+  *ppData = ringMemory.data();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createCommandPool(VkDevice, const VkCommandPoolCreateInfo*,
+                                                 const VkAllocationCallbacks*, VkCommandPool* pCommandPool) {
+  *pCommandPool = makeHandle<VkCommandPool>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL createSemaphore(VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*,
+                                               VkSemaphore* pSemaphore) {
+  *pSemaphore = makeHandle<VkSemaphore>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL destroyBuffer(VkDevice, VkBuffer, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL freeMemory(VkDevice, VkDeviceMemory, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroyCommandPool(VkDevice, VkCommandPool, const VkAllocationCallbacks*) {}
+VKAPI_ATTR void VKAPI_CALL destroySemaphore(VkDevice, VkSemaphore, const VkAllocationCallbacks*) {}
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateCommandBuffers(VkDevice, const VkCommandBufferAllocateInfo*,
+                                                      VkCommandBuffer* pCommandBuffers) {
+  *pCommandBuffers = makeHandle<VkCommandBuffer>();
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer(VkCommandBuffer, VkCommandBufferResetFlags) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer(VkCommandBuffer, const VkCommandBufferBeginInfo*) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL endCommandBuffer(VkCommandBuffer) {
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer(VkCommandBuffer, VkBuffer, VkBuffer dstBuffer, uint32_t regionCount,
+                                         const VkBufferCopy* pRegions) {
+  auto& contents = bufferContents[dstBuffer];
+  for (uint32_t i = 0; i < regionCount; ++i) {
+    auto const& region = pRegions[i];
+    bufferRegions.push_back(region);
+    contents.resize(std::max(contents.size(), static_cast<size_t>(region.dstOffset + region.size)));
+    std::memcpy(contents.data() + region.dstOffset, ringMemory.data() + region.srcOffset,
+                static_cast<size_t>(region.size));
+  }
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBufferToImage(VkCommandBuffer, VkBuffer, VkImage, VkImageLayout, uint32_t,
+                                                const VkBufferImageCopy*) {}
+
+VKAPI_ATTR void VKAPI_CALL cmdPipelineBarrier2(VkCommandBuffer, const VkDependencyInfo* pDependencyInfo) {
+  imageBarrierCalls.emplace_back(pDependencyInfo->pImageMemoryBarriers,
+                                 pDependencyInfo->pImageMemoryBarriers + pDependencyInfo->imageMemoryBarrierCount);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL queueSubmit2(VkQueue, uint32_t, const VkSubmitInfo2* pSubmits, VkFence) {
+  submittedValue = pSubmits->pSignalSemaphoreInfos->value;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL getSemaphoreCounterValue(VkDevice, VkSemaphore, uint64_t* pValue) {
+  *pValue = completedValue;
+  return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL waitSemaphores(VkDevice, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t) {
+  completedValue = std::max(completedValue, std::min(pWaitInfo->pValues[0], submittedValue));
+  return completedValue >= pWaitInfo->pValues[0] ? VK_SUCCESS : VK_TIMEOUT;
+}
+
+void reset() {
+  submittedValue = 0;
+  completedValue = 0;
+  bufferRegions.clear();
+  bufferContents.clear();
+  imageBarrierCalls.clear();
+}
+
+std::vector<uint8_t> makeData(size_t size, uint8_t seed) {
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<uint8_t>(seed + i * 7);
+  }
+  return data;
+}
+
+VkBufferImageCopy makeRegion(uint32_t mipLevel, uint32_t baseArrayLayer, uint32_t layerCount,
+                             VkDeviceSize bufferOffset) {
+  VkBufferImageCopy region = {};
+  region.bufferOffset = bufferOffset;
+  region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, mipLevel, baseArrayLayer, layerCount};
+  region.imageExtent = {4, 4, 1};
+  return region;
+}
+
+void testRingWrapsAfterOldestBatch(Volk& volk) {
+  reset();
+  VolkUploadQueue queue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0, 256);
+  VOLK_TEST_CHECK(queue.getStatus() == VK_SUCCESS);
+  auto const buffer = makeHandle<VkBuffer>();
+  auto const a = makeData(100, 1);
+  auto const b = makeData(100, 2);
+  auto const c = makeData(100, 3);
+
+  VOLK_TEST_CHECK(queue.uploadBuffer(buffer, 0, a.data(), 100) == 1);
+  // Half the ring is pending after this upload, which submits the batch.
+  VOLK_TEST_CHECK(queue.uploadBuffer(buffer, 100, b.data(), 100) == 1);
+  VOLK_TEST_CHECK(queue.getStats().batches == 1);
+  // [224, 324) would cross the end of the ring: the upload wraps to 0 once the first batch is complete.
+  VOLK_TEST_CHECK(queue.uploadBuffer(buffer, 200, c.data(), 100) == 2);
+  VOLK_TEST_CHECK(queue.getStats().stalls == 1);
+  VOLK_TEST_CHECK(queue.flush() == 2);
+
+  VOLK_TEST_CHECK(bufferRegions.size() == 3);
+  VOLK_TEST_CHECK(bufferRegions[0].srcOffset == 0);
+  VOLK_TEST_CHECK(bufferRegions[1].srcOffset == 112);
+  VOLK_TEST_CHECK(bufferRegions[2].srcOffset == 0);
+  auto expected = a;
+  expected.insert(expected.end(), b.begin(), b.end());
+  expected.insert(expected.end(), c.begin(), c.end());
+  VOLK_TEST_CHECK(bufferContents[buffer] == expected);
+}
+
+void testLargeUploadIsSplit(Volk& volk) {
+  reset();
+  VolkUploadQueue queue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0, 256);
+  auto const buffer = makeHandle<VkBuffer>();
+  auto const data = makeData(600, 5);
+
+  // Chunks of half the ring: four full batches, and the tail left pending.
+  VOLK_TEST_CHECK(queue.uploadBuffer(buffer, 0, data.data(), data.size()) == 5);
+  VOLK_TEST_CHECK(queue.getStats().batches == 4);
+  VOLK_TEST_CHECK(queue.flush() == 5);
+  VOLK_TEST_CHECK(queue.getStats().bytes == 600);
+  VOLK_TEST_CHECK(bufferRegions.size() == 5);
+  for (auto const& region : bufferRegions) {
+    VOLK_TEST_CHECK(region.srcOffset + region.size <= 256);
+  }
+  VOLK_TEST_CHECK(bufferContents[buffer] == data);
+}
+
+void testEmptyUploadFails(Volk& volk) {
+  reset();
+  VolkUploadQueue queue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0, 256);
+  auto const buffer = makeHandle<VkBuffer>();
+  VOLK_TEST_CHECK(queue.uploadBuffer(buffer, 0, nullptr, 0) == 0);
+  VOLK_TEST_CHECK(queue.flush() == 0);
+  VOLK_TEST_CHECK(queue.getStats().batches == 0);
+  VOLK_TEST_CHECK(queue.getStatus() == VK_SUCCESS);
+}
+
+void testImageBarriersCoverRegions(Volk& volk) {
+  reset();
+  VolkUploadQueue queue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 1, 256);
+  auto const image = makeHandle<VkImage>();
+  auto const data = makeData(96, 7);
+  // Two rectangles of mip 0 layer 0, and layers 1-2 of mip 2: mip 1 and layers 1-2 of mip 0 aren't written.
+  VkBufferImageCopy const regions[] = {makeRegion(0, 0, 1, 0), makeRegion(0, 0, 1, 32), makeRegion(2, 1, 2, 64)};
+  auto const value = queue.uploadImage(image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, 3, regions, data.data(), 96);
+  VOLK_TEST_CHECK(queue.flush() == value);
+  queue.recordAcquireBarriers(VK_NULL_HANDLE, value);
+
+  // Discard, release and acquire barriers.
+  VOLK_TEST_CHECK(imageBarrierCalls.size() == 3);
+  for (auto const& barriers : imageBarrierCalls) {
+    VOLK_TEST_CHECK(barriers.size() == 2);
+    if (barriers.size() != 2) {
+      continue;
+    }
+    auto const& mip0 = barriers[0].subresourceRange;
+    auto const& mip2 = barriers[1].subresourceRange;
+    VOLK_TEST_CHECK(mip0.baseMipLevel == 0 && mip0.levelCount == 1 && mip0.baseArrayLayer == 0 &&
+                    mip0.layerCount == 1);
+    VOLK_TEST_CHECK(mip2.baseMipLevel == 2 && mip2.levelCount == 1 && mip2.baseArrayLayer == 1 &&
+                    mip2.layerCount == 2);
+  }
+  VOLK_TEST_CHECK(imageBarrierCalls[0][0].oldLayout == VK_IMAGE_LAYOUT_UNDEFINED);
+  VOLK_TEST_CHECK(imageBarrierCalls[1][0].srcQueueFamilyIndex == 0);
+  VOLK_TEST_CHECK(imageBarrierCalls[2][1].dstQueueFamilyIndex == 1);
+}
+
+void testPendingImageIsSubmitted(Volk& volk) {
+  reset();
+  VolkUploadQueue queue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0, 256);
+  auto const image = makeHandle<VkImage>();
+  auto const otherImage = makeHandle<VkImage>();
+  auto const data = makeData(32, 9);
+  auto const region = makeRegion(0, 0, 1, 0);
+
+  VOLK_TEST_CHECK(queue.uploadImage(image, VK_IMAGE_LAYOUT_GENERAL, 1, &region, data.data(), 32) == 1);
+  VOLK_TEST_CHECK(queue.uploadImage(otherImage, VK_IMAGE_LAYOUT_GENERAL, 1, &region, data.data(), 32) == 1);
+  VOLK_TEST_CHECK(queue.getStats().batches == 0);
+  VOLK_TEST_CHECK(queue.uploadImage(image, VK_IMAGE_LAYOUT_GENERAL, 1, &region, data.data(), 32) == 2);
+  VOLK_TEST_CHECK(queue.getStats().batches == 1);
+  VOLK_TEST_CHECK(queue.flush() == 2);
+}
+
+void testHeadroomThrottles(Volk& volk) {
+  reset();
+  bool headroom = false;
+  std::vector<VkDeviceSize> asked;
+  VolkUploadQueue queue(volk, VK_NULL_HANDLE, VK_NULL_HANDLE, VK_NULL_HANDLE, 0, 0, 256, [&](VkDeviceSize size) {
+    asked.push_back(size);
+    return headroom;
+  });
+  auto const buffer = makeHandle<VkBuffer>();
+  auto const data = makeData(32, 11);
+
+  // Nothing is in flight: waiting can't free memory, so the upload goes ahead without asking.
+  VOLK_TEST_CHECK(queue.uploadBuffer(buffer, 0, data.data(), 32) == 1);
+  VOLK_TEST_CHECK(asked.empty());
+
+  // The pending batch is submitted and waited for before more data is staged.
+  VOLK_TEST_CHECK(queue.uploadBuffer(buffer, 32, data.data(), 32) == 2);
+  VOLK_TEST_CHECK((asked == std::vector<VkDeviceSize>{32}));
+  VOLK_TEST_CHECK(completedValue == 1);
+  auto stats = queue.getStats();
+  VOLK_TEST_CHECK(stats.throttles == 1);
+  VOLK_TEST_CHECK(stats.batches == 1);
+  VOLK_TEST_CHECK(stats.stalls == 0);
+
+  // With headroom, uploads share the pending batch.
+  headroom = true;
+  VOLK_TEST_CHECK(queue.uploadBuffer(buffer, 64, data.data(), 32) == 2);
+  VOLK_TEST_CHECK(queue.flush() == 2);
+  stats = queue.getStats();
+  VOLK_TEST_CHECK(stats.throttles == 1);
+  VOLK_TEST_CHECK(stats.batches == 2);
+  VOLK_TEST_CHECK(bufferContents[buffer].size() == 96);
+}
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkCreateBuffer = createBuffer;
+  volk.vkGetBufferMemoryRequirements = getBufferMemoryRequirements;
+  volk.vkGetPhysicalDeviceMemoryProperties = getPhysicalDeviceMemoryProperties;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkBindBufferMemory = bindBufferMemory;
+  volk.vkMapMemory = mapMemory;
+  volk.vkCreateCommandPool = createCommandPool;
+  volk.vkCreateSemaphore = createSemaphore;
+  volk.vkDestroyBuffer = destroyBuffer;
+  volk.vkFreeMemory = freeMemory;
+  volk.vkDestroyCommandPool = destroyCommandPool;
+  volk.vkDestroySemaphore = destroySemaphore;
+  volk.vkAllocateCommandBuffers = allocateCommandBuffers;
+  volk.vkResetCommandBuffer = resetCommandBuffer;
+  volk.vkBeginCommandBuffer = beginCommandBuffer;
+  volk.vkEndCommandBuffer = endCommandBuffer;
+  volk.vkCmdCopyBuffer = cmdCopyBuffer;
+  volk.vkCmdCopyBufferToImage = cmdCopyBufferToImage;
+  volk.vkCmdPipelineBarrier2 = cmdPipelineBarrier2;
+  volk.vkQueueSubmit2 = queueSubmit2;
+  volk.vkGetSemaphoreCounterValue = getSemaphoreCounterValue;
+  volk.vkWaitSemaphores = waitSemaphores;
+
+  testRingWrapsAfterOldestBatch(volk);
+  testLargeUploadIsSplit(volk);
+  testEmptyUploadFails(volk);
+  testImageBarriersCoverRegions(volk);
+  testPendingImageIsSubmitted(volk);
+  testHeadroomThrottles(volk);
+  return VOLK_TEST_RESULT();
+}
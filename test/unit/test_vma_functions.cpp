@@ -0,0 +1,55 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk.hpp"
+#include "volk_test.hpp"
+
+namespace {
+
+// Subset of VmaVulkanFunctions: members that VMA doesn't declare must be skipped.
+struct VmaVulkanFunctions {
+  PFN_vkAllocateMemory vkAllocateMemory;
+  PFN_vkFreeMemory vkFreeMemory;
+#if defined(VK_BASE_VERSION_1_1)
+  PFN_vkGetBufferMemoryRequirements2KHR vkGetBufferMemoryRequirements2KHR;
+#endif
+};
+
+VKAPI_ATTR VkResult VKAPI_CALL allocateMemory(VkDevice, const VkMemoryAllocateInfo*, const VkAllocationCallbacks*,
+                                              VkDeviceMemory*) {
+  return VK_SUCCESS;
+}
+
+#if defined(VK_BASE_VERSION_1_1)
+VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements2(VkDevice, const VkBufferMemoryRequirementsInfo2*,
+                                                        VkMemoryRequirements2*) {}
+#endif
+
+} // namespace
+
+int main() {
+  Volk volk;
+  volk.vkAllocateMemory = allocateMemory;
+  volk.vkFreeMemory = nullptr;
+
+  VmaVulkanFunctions functions = {};
+  volk.fillVmaVulkanFunctions(functions);
+  VOLK_TEST_CHECK(functions.vkAllocateMemory == allocateMemory);
+  VOLK_TEST_CHECK(functions.vkFreeMemory == nullptr);
+
+#if defined(VK_BASE_VERSION_1_1)
+  // The KHR member falls back to the extension function when the core one isn't loaded.
+  volk.vkGetBufferMemoryRequirements2 = nullptr;
+#if defined(VK_KHR_get_memory_requirements2)
+  volk.vkGetBufferMemoryRequirements2KHR = getBufferMemoryRequirements2;
+  volk.fillVmaVulkanFunctions(functions);
+  VOLK_TEST_CHECK(functions.vkGetBufferMemoryRequirements2KHR == getBufferMemoryRequirements2);
+#endif
+
+  volk.vkGetBufferMemoryRequirements2 = getBufferMemoryRequirements2;
+#if defined(VK_KHR_get_memory_requirements2)
+  volk.vkGetBufferMemoryRequirements2KHR = nullptr;
+#endif
+  volk.fillVmaVulkanFunctions(functions);
+  VOLK_TEST_CHECK(functions.vkGetBufferMemoryRequirements2KHR == getBufferMemoryRequirements2);
+#endif
+  return VOLK_TEST_RESULT();
+}
@@ -0,0 +1,20 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * Minimal checks for the behavior tests: a failed check prints its location and the test exits with a non-zero code.
+ */
+inline int volkTestFailures = 0;
+
+#define VOLK_TEST_CHECK(condition)                                                   \
+  do {                                                                               \
+    if (!(condition)) {                                                              \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+      ++volkTestFailures;                                                            \
+    }                                                                                \
+  } while (false)
+
+#define VOLK_TEST_RESULT() (volkTestFailures == 0 ? EXIT_SUCCESS : EXIT_FAILURE)
@@ -1,6 +1,7 @@
 /* This file is part of volk-cpp library; see volk.hpp for version/license details */
 /* clang-format off */
 #include "volk.hpp"
+#include "volk_export.h"
 
 #ifdef _WIN32
   #ifndef WIN32_LEAN_AND_MEAN
@@ -55,6 +56,33 @@ Volk::Volk(PFN_vkGetInstanceProcAddr handler /* = nullptr */) noexcept {
   genLoadLoader(nullptr, &Volk::vkGetInstanceProcAddrStub);
 }
 
+Volk::Volk(const VolkCppExport& hostExport) noexcept
+  : Volk(hostExport.getInstanceProcAddr) {
+  if (status_ != VK_SUCCESS) {
+    return;
+  }
+
+  if (auto table = volkCppGetTable(&hostExport)) {
+    genImportTable(*table);
+    if ((hostExport.loadedMask & VOLK_CPP_EXPORT_INSTANCE_BIT) != 0) {
+      loadedInstance_ = hostExport.instance;
+    }
+    if ((hostExport.loadedMask & VOLK_CPP_EXPORT_DEVICE_BIT) != 0) {
+      loadedDevice_ = hostExport.device;
+    }
+    return;
+  }
+
+  if ((hostExport.loadedMask & VOLK_CPP_EXPORT_INSTANCE_BIT) != 0) {
+    if ((hostExport.loadedMask & VOLK_CPP_EXPORT_DEVICE_BIT) != 0) {
+      loadInstanceOnly(hostExport.instance);
+      loadDevice(hostExport.device);
+    } else {
+      loadInstance(hostExport.instance);
+    }
+  }
+}
+
 Volk::~Volk() noexcept {
   if (loadedModule_) {
 #if defined(_WIN32)
@@ -121,6 +149,33 @@ VkDevice Volk::getLoadedDevice() noexcept {
   return loadedDevice_;
 }
 
+uint32_t Volk::getVkHeaderVersion() const noexcept {
+  return VK_HEADER_VERSION;
+}
+
+void Volk::exportTable(VolkCppExport* pExport, VolkCppTable* pTable) const noexcept {
+  *pTable = {};
+  pTable->structSize = sizeof(VolkCppTable);
+  pTable->headerVersion = VOLK_CPP_HEADER_VERSION;
+  genExportTable(pTable);
+
+  *pExport = {};
+  pExport->structSize = sizeof(VolkCppExport);
+  pExport->exportVersion = VOLK_CPP_EXPORT_VERSION;
+  pExport->headerVersion = VOLK_CPP_HEADER_VERSION;
+  pExport->vkHeaderVersion = VK_HEADER_VERSION;
+  pExport->table = pTable;
+  pExport->getInstanceProcAddr = vkGetInstanceProcAddr;
+  pExport->instance = loadedInstance_;
+  pExport->device = loadedDevice_;
+  if (loadedInstance_ != VK_NULL_HANDLE) {
+    pExport->loadedMask |= VOLK_CPP_EXPORT_INSTANCE_BIT;
+  }
+  if (loadedDevice_ != VK_NULL_HANDLE) {
+    pExport->loadedMask |= VOLK_CPP_EXPORT_DEVICE_BIT;
+  }
+}
+
 PFN_vkVoidFunction Volk::vkGetInstanceProcAddrStub(void* context, char const* name) noexcept {
   return vkGetInstanceProcAddr(static_cast<VkInstance>(context), name);
 }
@@ -1415,4 +1470,2470 @@ void Volk::genLoadDevice(void* context, PFN_vkVoidFunction (Volk::*load)(void*,
   /* VOLK_CPP_GENERATE_LOAD_DEVICE */
 }
 
+void Volk::genExportTable(VolkCppTable* pTable) const noexcept {
+  /* VOLK_CPP_GENERATE_EXPORT_TABLE */
+#if defined(VK_BASE_VERSION_1_0)
+  pTable->vkAllocateCommandBuffers = vkAllocateCommandBuffers;
+  pTable->vkAllocateMemory = vkAllocateMemory;
+  pTable->vkBeginCommandBuffer = vkBeginCommandBuffer;
+  pTable->vkBindBufferMemory = vkBindBufferMemory;
+  pTable->vkBindImageMemory = vkBindImageMemory;
+  pTable->vkCmdBeginQuery = vkCmdBeginQuery;
+  pTable->vkCmdCopyBuffer = vkCmdCopyBuffer;
+  pTable->vkCmdCopyBufferToImage = vkCmdCopyBufferToImage;
+  pTable->vkCmdCopyImage = vkCmdCopyImage;
+  pTable->vkCmdCopyImageToBuffer = vkCmdCopyImageToBuffer;
+  pTable->vkCmdCopyQueryPoolResults = vkCmdCopyQueryPoolResults;
+  pTable->vkCmdEndQuery = vkCmdEndQuery;
+  pTable->vkCmdExecuteCommands = vkCmdExecuteCommands;
+  pTable->vkCmdFillBuffer = vkCmdFillBuffer;
+  pTable->vkCmdPipelineBarrier = vkCmdPipelineBarrier;
+  pTable->vkCmdResetQueryPool = vkCmdResetQueryPool;
+  pTable->vkCmdUpdateBuffer = vkCmdUpdateBuffer;
+  pTable->vkCmdWriteTimestamp = vkCmdWriteTimestamp;
+  pTable->vkCreateBuffer = vkCreateBuffer;
+  pTable->vkCreateCommandPool = vkCreateCommandPool;
+  pTable->vkCreateDevice = vkCreateDevice;
+  pTable->vkCreateFence = vkCreateFence;
+  pTable->vkCreateImage = vkCreateImage;
+  pTable->vkCreateImageView = vkCreateImageView;
+  pTable->vkCreateInstance = vkCreateInstance;
+  pTable->vkCreateQueryPool = vkCreateQueryPool;
+  pTable->vkCreateSemaphore = vkCreateSemaphore;
+  pTable->vkDestroyBuffer = vkDestroyBuffer;
+  pTable->vkDestroyCommandPool = vkDestroyCommandPool;
+  pTable->vkDestroyDevice = vkDestroyDevice;
+  pTable->vkDestroyFence = vkDestroyFence;
+  pTable->vkDestroyImage = vkDestroyImage;
+  pTable->vkDestroyImageView = vkDestroyImageView;
+  pTable->vkDestroyInstance = vkDestroyInstance;
+  pTable->vkDestroyQueryPool = vkDestroyQueryPool;
+  pTable->vkDestroySemaphore = vkDestroySemaphore;
+  pTable->vkDeviceWaitIdle = vkDeviceWaitIdle;
+  pTable->vkEndCommandBuffer = vkEndCommandBuffer;
+  pTable->vkEnumerateDeviceExtensionProperties = vkEnumerateDeviceExtensionProperties;
+  pTable->vkEnumerateDeviceLayerProperties = vkEnumerateDeviceLayerProperties;
+  pTable->vkEnumerateInstanceExtensionProperties = vkEnumerateInstanceExtensionProperties;
+  pTable->vkEnumerateInstanceLayerProperties = vkEnumerateInstanceLayerProperties;
+  pTable->vkEnumeratePhysicalDevices = vkEnumeratePhysicalDevices;
+  pTable->vkFlushMappedMemoryRanges = vkFlushMappedMemoryRanges;
+  pTable->vkFreeCommandBuffers = vkFreeCommandBuffers;
+  pTable->vkFreeMemory = vkFreeMemory;
+  pTable->vkGetBufferMemoryRequirements = vkGetBufferMemoryRequirements;
+  pTable->vkGetDeviceMemoryCommitment = vkGetDeviceMemoryCommitment;
+  pTable->vkGetDeviceProcAddr = vkGetDeviceProcAddr;
+  pTable->vkGetDeviceQueue = vkGetDeviceQueue;
+  pTable->vkGetFenceStatus = vkGetFenceStatus;
+  pTable->vkGetImageMemoryRequirements = vkGetImageMemoryRequirements;
+  pTable->vkGetImageSparseMemoryRequirements = vkGetImageSparseMemoryRequirements;
+  pTable->vkGetImageSubresourceLayout = vkGetImageSubresourceLayout;
+  pTable->vkGetInstanceProcAddr = vkGetInstanceProcAddr;
+  pTable->vkGetPhysicalDeviceFeatures = vkGetPhysicalDeviceFeatures;
+  pTable->vkGetPhysicalDeviceFormatProperties = vkGetPhysicalDeviceFormatProperties;
+  pTable->vkGetPhysicalDeviceImageFormatProperties = vkGetPhysicalDeviceImageFormatProperties;
+  pTable->vkGetPhysicalDeviceMemoryProperties = vkGetPhysicalDeviceMemoryProperties;
+  pTable->vkGetPhysicalDeviceProperties = vkGetPhysicalDeviceProperties;
+  pTable->vkGetPhysicalDeviceQueueFamilyProperties = vkGetPhysicalDeviceQueueFamilyProperties;
+  pTable->vkGetPhysicalDeviceSparseImageFormatProperties = vkGetPhysicalDeviceSparseImageFormatProperties;
+  pTable->vkGetQueryPoolResults = vkGetQueryPoolResults;
+  pTable->vkInvalidateMappedMemoryRanges = vkInvalidateMappedMemoryRanges;
+  pTable->vkMapMemory = vkMapMemory;
+  pTable->vkQueueBindSparse = vkQueueBindSparse;
+  pTable->vkQueueSubmit = vkQueueSubmit;
+  pTable->vkQueueWaitIdle = vkQueueWaitIdle;
+  pTable->vkResetCommandBuffer = vkResetCommandBuffer;
+  pTable->vkResetCommandPool = vkResetCommandPool;
+  pTable->vkResetFences = vkResetFences;
+  pTable->vkUnmapMemory = vkUnmapMemory;
+  pTable->vkWaitForFences = vkWaitForFences;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+  pTable->vkAllocateDescriptorSets = vkAllocateDescriptorSets;
+  pTable->vkCmdBindDescriptorSets = vkCmdBindDescriptorSets;
+  pTable->vkCmdBindPipeline = vkCmdBindPipeline;
+  pTable->vkCmdClearColorImage = vkCmdClearColorImage;
+  pTable->vkCmdDispatch = vkCmdDispatch;
+  pTable->vkCmdDispatchIndirect = vkCmdDispatchIndirect;
+  pTable->vkCmdPushConstants = vkCmdPushConstants;
+  pTable->vkCmdResetEvent = vkCmdResetEvent;
+  pTable->vkCmdSetEvent = vkCmdSetEvent;
+  pTable->vkCmdWaitEvents = vkCmdWaitEvents;
+  pTable->vkCreateBufferView = vkCreateBufferView;
+  pTable->vkCreateComputePipelines = vkCreateComputePipelines;
+  pTable->vkCreateDescriptorPool = vkCreateDescriptorPool;
+  pTable->vkCreateDescriptorSetLayout = vkCreateDescriptorSetLayout;
+  pTable->vkCreateEvent = vkCreateEvent;
+  pTable->vkCreatePipelineCache = vkCreatePipelineCache;
+  pTable->vkCreatePipelineLayout = vkCreatePipelineLayout;
+  pTable->vkCreateSampler = vkCreateSampler;
+  pTable->vkCreateShaderModule = vkCreateShaderModule;
+  pTable->vkDestroyBufferView = vkDestroyBufferView;
+  pTable->vkDestroyDescriptorPool = vkDestroyDescriptorPool;
+  pTable->vkDestroyDescriptorSetLayout = vkDestroyDescriptorSetLayout;
+  pTable->vkDestroyEvent = vkDestroyEvent;
+  pTable->vkDestroyPipeline = vkDestroyPipeline;
+  pTable->vkDestroyPipelineCache = vkDestroyPipelineCache;
+  pTable->vkDestroyPipelineLayout = vkDestroyPipelineLayout;
+  pTable->vkDestroySampler = vkDestroySampler;
+  pTable->vkDestroyShaderModule = vkDestroyShaderModule;
+  pTable->vkFreeDescriptorSets = vkFreeDescriptorSets;
+  pTable->vkGetEventStatus = vkGetEventStatus;
+  pTable->vkGetPipelineCacheData = vkGetPipelineCacheData;
+  pTable->vkMergePipelineCaches = vkMergePipelineCaches;
+  pTable->vkResetDescriptorPool = vkResetDescriptorPool;
+  pTable->vkResetEvent = vkResetEvent;
+  pTable->vkSetEvent = vkSetEvent;
+  pTable->vkUpdateDescriptorSets = vkUpdateDescriptorSets;
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  pTable->vkCmdBeginRenderPass = vkCmdBeginRenderPass;
+  pTable->vkCmdBindIndexBuffer = vkCmdBindIndexBuffer;
+  pTable->vkCmdBindVertexBuffers = vkCmdBindVertexBuffers;
+  pTable->vkCmdBlitImage = vkCmdBlitImage;
+  pTable->vkCmdClearAttachments = vkCmdClearAttachments;
+  pTable->vkCmdClearDepthStencilImage = vkCmdClearDepthStencilImage;
+  pTable->vkCmdDraw = vkCmdDraw;
+  pTable->vkCmdDrawIndexed = vkCmdDrawIndexed;
+  pTable->vkCmdDrawIndexedIndirect = vkCmdDrawIndexedIndirect;
+  pTable->vkCmdDrawIndirect = vkCmdDrawIndirect;
+  pTable->vkCmdEndRenderPass = vkCmdEndRenderPass;
+  pTable->vkCmdNextSubpass = vkCmdNextSubpass;
+  pTable->vkCmdResolveImage = vkCmdResolveImage;
+  pTable->vkCmdSetBlendConstants = vkCmdSetBlendConstants;
+  pTable->vkCmdSetDepthBias = vkCmdSetDepthBias;
+  pTable->vkCmdSetDepthBounds = vkCmdSetDepthBounds;
+  pTable->vkCmdSetLineWidth = vkCmdSetLineWidth;
+  pTable->vkCmdSetScissor = vkCmdSetScissor;
+  pTable->vkCmdSetStencilCompareMask = vkCmdSetStencilCompareMask;
+  pTable->vkCmdSetStencilReference = vkCmdSetStencilReference;
+  pTable->vkCmdSetStencilWriteMask = vkCmdSetStencilWriteMask;
+  pTable->vkCmdSetViewport = vkCmdSetViewport;
+  pTable->vkCreateFramebuffer = vkCreateFramebuffer;
+  pTable->vkCreateGraphicsPipelines = vkCreateGraphicsPipelines;
+  pTable->vkCreateRenderPass = vkCreateRenderPass;
+  pTable->vkDestroyFramebuffer = vkDestroyFramebuffer;
+  pTable->vkDestroyRenderPass = vkDestroyRenderPass;
+  pTable->vkGetRenderAreaGranularity = vkGetRenderAreaGranularity;
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_BASE_VERSION_1_1)
+  pTable->vkBindBufferMemory2 = vkBindBufferMemory2;
+  pTable->vkBindImageMemory2 = vkBindImageMemory2;
+  pTable->vkCmdSetDeviceMask = vkCmdSetDeviceMask;
+  pTable->vkEnumerateInstanceVersion = vkEnumerateInstanceVersion;
+  pTable->vkEnumeratePhysicalDeviceGroups = vkEnumeratePhysicalDeviceGroups;
+  pTable->vkGetBufferMemoryRequirements2 = vkGetBufferMemoryRequirements2;
+  pTable->vkGetDeviceGroupPeerMemoryFeatures = vkGetDeviceGroupPeerMemoryFeatures;
+  pTable->vkGetDeviceQueue2 = vkGetDeviceQueue2;
+  pTable->vkGetImageMemoryRequirements2 = vkGetImageMemoryRequirements2;
+  pTable->vkGetImageSparseMemoryRequirements2 = vkGetImageSparseMemoryRequirements2;
+  pTable->vkGetPhysicalDeviceExternalBufferProperties = vkGetPhysicalDeviceExternalBufferProperties;
+  pTable->vkGetPhysicalDeviceExternalFenceProperties = vkGetPhysicalDeviceExternalFenceProperties;
+  pTable->vkGetPhysicalDeviceExternalSemaphoreProperties = vkGetPhysicalDeviceExternalSemaphoreProperties;
+  pTable->vkGetPhysicalDeviceFeatures2 = vkGetPhysicalDeviceFeatures2;
+  pTable->vkGetPhysicalDeviceFormatProperties2 = vkGetPhysicalDeviceFormatProperties2;
+  pTable->vkGetPhysicalDeviceImageFormatProperties2 = vkGetPhysicalDeviceImageFormatProperties2;
+  pTable->vkGetPhysicalDeviceMemoryProperties2 = vkGetPhysicalDeviceMemoryProperties2;
+  pTable->vkGetPhysicalDeviceProperties2 = vkGetPhysicalDeviceProperties2;
+  pTable->vkGetPhysicalDeviceQueueFamilyProperties2 = vkGetPhysicalDeviceQueueFamilyProperties2;
+  pTable->vkGetPhysicalDeviceSparseImageFormatProperties2 = vkGetPhysicalDeviceSparseImageFormatProperties2;
+  pTable->vkTrimCommandPool = vkTrimCommandPool;
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+  pTable->vkCmdDispatchBase = vkCmdDispatchBase;
+  pTable->vkCreateDescriptorUpdateTemplate = vkCreateDescriptorUpdateTemplate;
+  pTable->vkCreateSamplerYcbcrConversion = vkCreateSamplerYcbcrConversion;
+  pTable->vkDestroyDescriptorUpdateTemplate = vkDestroyDescriptorUpdateTemplate;
+  pTable->vkDestroySamplerYcbcrConversion = vkDestroySamplerYcbcrConversion;
+  pTable->vkGetDescriptorSetLayoutSupport = vkGetDescriptorSetLayoutSupport;
+  pTable->vkUpdateDescriptorSetWithTemplate = vkUpdateDescriptorSetWithTemplate;
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_BASE_VERSION_1_2)
+  pTable->vkGetBufferDeviceAddress = vkGetBufferDeviceAddress;
+  pTable->vkGetBufferOpaqueCaptureAddress = vkGetBufferOpaqueCaptureAddress;
+  pTable->vkGetDeviceMemoryOpaqueCaptureAddress = vkGetDeviceMemoryOpaqueCaptureAddress;
+  pTable->vkGetSemaphoreCounterValue = vkGetSemaphoreCounterValue;
+  pTable->vkResetQueryPool = vkResetQueryPool;
+  pTable->vkSignalSemaphore = vkSignalSemaphore;
+  pTable->vkWaitSemaphores = vkWaitSemaphores;
+#endif /* defined(VK_BASE_VERSION_1_2) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  pTable->vkCmdBeginRenderPass2 = vkCmdBeginRenderPass2;
+  pTable->vkCmdDrawIndexedIndirectCount = vkCmdDrawIndexedIndirectCount;
+  pTable->vkCmdDrawIndirectCount = vkCmdDrawIndirectCount;
+  pTable->vkCmdEndRenderPass2 = vkCmdEndRenderPass2;
+  pTable->vkCmdNextSubpass2 = vkCmdNextSubpass2;
+  pTable->vkCreateRenderPass2 = vkCreateRenderPass2;
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+  pTable->vkCmdCopyBuffer2 = vkCmdCopyBuffer2;
+  pTable->vkCmdCopyBufferToImage2 = vkCmdCopyBufferToImage2;
+  pTable->vkCmdCopyImage2 = vkCmdCopyImage2;
+  pTable->vkCmdCopyImageToBuffer2 = vkCmdCopyImageToBuffer2;
+  pTable->vkCmdPipelineBarrier2 = vkCmdPipelineBarrier2;
+  pTable->vkCmdWriteTimestamp2 = vkCmdWriteTimestamp2;
+  pTable->vkCreatePrivateDataSlot = vkCreatePrivateDataSlot;
+  pTable->vkDestroyPrivateDataSlot = vkDestroyPrivateDataSlot;
+  pTable->vkGetDeviceBufferMemoryRequirements = vkGetDeviceBufferMemoryRequirements;
+  pTable->vkGetDeviceImageMemoryRequirements = vkGetDeviceImageMemoryRequirements;
+  pTable->vkGetDeviceImageSparseMemoryRequirements = vkGetDeviceImageSparseMemoryRequirements;
+  pTable->vkGetPhysicalDeviceToolProperties = vkGetPhysicalDeviceToolProperties;
+  pTable->vkGetPrivateData = vkGetPrivateData;
+  pTable->vkQueueSubmit2 = vkQueueSubmit2;
+  pTable->vkSetPrivateData = vkSetPrivateData;
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_3)
+  pTable->vkCmdResetEvent2 = vkCmdResetEvent2;
+  pTable->vkCmdSetEvent2 = vkCmdSetEvent2;
+  pTable->vkCmdWaitEvents2 = vkCmdWaitEvents2;
+#endif /* defined(VK_COMPUTE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+  pTable->vkCmdBeginRendering = vkCmdBeginRendering;
+  pTable->vkCmdBindVertexBuffers2 = vkCmdBindVertexBuffers2;
+  pTable->vkCmdBlitImage2 = vkCmdBlitImage2;
+  pTable->vkCmdEndRendering = vkCmdEndRendering;
+  pTable->vkCmdResolveImage2 = vkCmdResolveImage2;
+  pTable->vkCmdSetCullMode = vkCmdSetCullMode;
+  pTable->vkCmdSetDepthBiasEnable = vkCmdSetDepthBiasEnable;
+  pTable->vkCmdSetDepthBoundsTestEnable = vkCmdSetDepthBoundsTestEnable;
+  pTable->vkCmdSetDepthCompareOp = vkCmdSetDepthCompareOp;
+  pTable->vkCmdSetDepthTestEnable = vkCmdSetDepthTestEnable;
+  pTable->vkCmdSetDepthWriteEnable = vkCmdSetDepthWriteEnable;
+  pTable->vkCmdSetFrontFace = vkCmdSetFrontFace;
+  pTable->vkCmdSetPrimitiveRestartEnable = vkCmdSetPrimitiveRestartEnable;
+  pTable->vkCmdSetPrimitiveTopology = vkCmdSetPrimitiveTopology;
+  pTable->vkCmdSetRasterizerDiscardEnable = vkCmdSetRasterizerDiscardEnable;
+  pTable->vkCmdSetScissorWithCount = vkCmdSetScissorWithCount;
+  pTable->vkCmdSetStencilOp = vkCmdSetStencilOp;
+  pTable->vkCmdSetStencilTestEnable = vkCmdSetStencilTestEnable;
+  pTable->vkCmdSetViewportWithCount = vkCmdSetViewportWithCount;
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_BASE_VERSION_1_4)
+  pTable->vkCopyImageToImage = vkCopyImageToImage;
+  pTable->vkCopyImageToMemory = vkCopyImageToMemory;
+  pTable->vkCopyMemoryToImage = vkCopyMemoryToImage;
+  pTable->vkGetDeviceImageSubresourceLayout = vkGetDeviceImageSubresourceLayout;
+  pTable->vkGetImageSubresourceLayout2 = vkGetImageSubresourceLayout2;
+  pTable->vkMapMemory2 = vkMapMemory2;
+  pTable->vkTransitionImageLayout = vkTransitionImageLayout;
+  pTable->vkUnmapMemory2 = vkUnmapMemory2;
+#endif /* defined(VK_BASE_VERSION_1_4) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+  pTable->vkCmdBindDescriptorSets2 = vkCmdBindDescriptorSets2;
+  pTable->vkCmdPushConstants2 = vkCmdPushConstants2;
+  pTable->vkCmdPushDescriptorSet = vkCmdPushDescriptorSet;
+  pTable->vkCmdPushDescriptorSet2 = vkCmdPushDescriptorSet2;
+  pTable->vkCmdPushDescriptorSetWithTemplate = vkCmdPushDescriptorSetWithTemplate;
+  pTable->vkCmdPushDescriptorSetWithTemplate2 = vkCmdPushDescriptorSetWithTemplate2;
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+  pTable->vkCmdBindIndexBuffer2 = vkCmdBindIndexBuffer2;
+  pTable->vkCmdSetLineStipple = vkCmdSetLineStipple;
+  pTable->vkCmdSetRenderingAttachmentLocations = vkCmdSetRenderingAttachmentLocations;
+  pTable->vkCmdSetRenderingInputAttachmentIndices = vkCmdSetRenderingInputAttachmentIndices;
+  pTable->vkGetRenderingAreaGranularity = vkGetRenderingAreaGranularity;
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+#if defined(VK_AMDX_shader_enqueue)
+  pTable->vkCmdDispatchGraphAMDX = vkCmdDispatchGraphAMDX;
+  pTable->vkCmdDispatchGraphIndirectAMDX = vkCmdDispatchGraphIndirectAMDX;
+  pTable->vkCmdDispatchGraphIndirectCountAMDX = vkCmdDispatchGraphIndirectCountAMDX;
+  pTable->vkCmdInitializeGraphScratchMemoryAMDX = vkCmdInitializeGraphScratchMemoryAMDX;
+  pTable->vkCreateExecutionGraphPipelinesAMDX = vkCreateExecutionGraphPipelinesAMDX;
+  pTable->vkGetExecutionGraphPipelineNodeIndexAMDX = vkGetExecutionGraphPipelineNodeIndexAMDX;
+  pTable->vkGetExecutionGraphPipelineScratchSizeAMDX = vkGetExecutionGraphPipelineScratchSizeAMDX;
+#endif /* defined(VK_AMDX_shader_enqueue) */
+#if defined(VK_AMD_anti_lag)
+  pTable->vkAntiLagUpdateAMD = vkAntiLagUpdateAMD;
+#endif /* defined(VK_AMD_anti_lag) */
+#if defined(VK_AMD_buffer_marker)
+  pTable->vkCmdWriteBufferMarkerAMD = vkCmdWriteBufferMarkerAMD;
+#endif /* defined(VK_AMD_buffer_marker) */
+#if defined(VK_AMD_buffer_marker) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2))
+  pTable->vkCmdWriteBufferMarker2AMD = vkCmdWriteBufferMarker2AMD;
+#endif /* defined(VK_AMD_buffer_marker) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2)) */
+#if defined(VK_AMD_display_native_hdr)
+  pTable->vkSetLocalDimmingAMD = vkSetLocalDimmingAMD;
+#endif /* defined(VK_AMD_display_native_hdr) */
+#if defined(VK_AMD_draw_indirect_count)
+  pTable->vkCmdDrawIndexedIndirectCountAMD = vkCmdDrawIndexedIndirectCountAMD;
+  pTable->vkCmdDrawIndirectCountAMD = vkCmdDrawIndirectCountAMD;
+#endif /* defined(VK_AMD_draw_indirect_count) */
+#if defined(VK_AMD_shader_info)
+  pTable->vkGetShaderInfoAMD = vkGetShaderInfoAMD;
+#endif /* defined(VK_AMD_shader_info) */
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+  pTable->vkGetAndroidHardwareBufferPropertiesANDROID = vkGetAndroidHardwareBufferPropertiesANDROID;
+  pTable->vkGetMemoryAndroidHardwareBufferANDROID = vkGetMemoryAndroidHardwareBufferANDROID;
+#endif /* defined(VK_ANDROID_external_memory_android_hardware_buffer) */
+#if defined(VK_ARM_data_graph)
+  pTable->vkBindDataGraphPipelineSessionMemoryARM = vkBindDataGraphPipelineSessionMemoryARM;
+  pTable->vkCmdDispatchDataGraphARM = vkCmdDispatchDataGraphARM;
+  pTable->vkCreateDataGraphPipelineSessionARM = vkCreateDataGraphPipelineSessionARM;
+  pTable->vkCreateDataGraphPipelinesARM = vkCreateDataGraphPipelinesARM;
+  pTable->vkDestroyDataGraphPipelineSessionARM = vkDestroyDataGraphPipelineSessionARM;
+  pTable->vkGetDataGraphPipelineAvailablePropertiesARM = vkGetDataGraphPipelineAvailablePropertiesARM;
+  pTable->vkGetDataGraphPipelinePropertiesARM = vkGetDataGraphPipelinePropertiesARM;
+  pTable->vkGetDataGraphPipelineSessionBindPointRequirementsARM = vkGetDataGraphPipelineSessionBindPointRequirementsARM;
+  pTable->vkGetDataGraphPipelineSessionMemoryRequirementsARM = vkGetDataGraphPipelineSessionMemoryRequirementsARM;
+  pTable->vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM = vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM;
+  pTable->vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM = vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM;
+#endif /* defined(VK_ARM_data_graph) */
+#if defined(VK_ARM_performance_counters_by_region)
+  pTable->vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM = vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM;
+#endif /* defined(VK_ARM_performance_counters_by_region) */
+#if defined(VK_ARM_tensors)
+  pTable->vkBindTensorMemoryARM = vkBindTensorMemoryARM;
+  pTable->vkCmdCopyTensorARM = vkCmdCopyTensorARM;
+  pTable->vkCreateTensorARM = vkCreateTensorARM;
+  pTable->vkCreateTensorViewARM = vkCreateTensorViewARM;
+  pTable->vkDestroyTensorARM = vkDestroyTensorARM;
+  pTable->vkDestroyTensorViewARM = vkDestroyTensorViewARM;
+  pTable->vkGetDeviceTensorMemoryRequirementsARM = vkGetDeviceTensorMemoryRequirementsARM;
+  pTable->vkGetPhysicalDeviceExternalTensorPropertiesARM = vkGetPhysicalDeviceExternalTensorPropertiesARM;
+  pTable->vkGetTensorMemoryRequirementsARM = vkGetTensorMemoryRequirementsARM;
+#endif /* defined(VK_ARM_tensors) */
+#if defined(VK_ARM_tensors) && defined(VK_EXT_descriptor_buffer)
+  pTable->vkGetTensorOpaqueCaptureDescriptorDataARM = vkGetTensorOpaqueCaptureDescriptorDataARM;
+  pTable->vkGetTensorViewOpaqueCaptureDescriptorDataARM = vkGetTensorViewOpaqueCaptureDescriptorDataARM;
+#endif /* defined(VK_ARM_tensors) && defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_EXT_acquire_drm_display)
+  pTable->vkAcquireDrmDisplayEXT = vkAcquireDrmDisplayEXT;
+  pTable->vkGetDrmDisplayEXT = vkGetDrmDisplayEXT;
+#endif /* defined(VK_EXT_acquire_drm_display) */
+#if defined(VK_EXT_acquire_xlib_display)
+  pTable->vkAcquireXlibDisplayEXT = vkAcquireXlibDisplayEXT;
+  pTable->vkGetRandROutputDisplayEXT = vkGetRandROutputDisplayEXT;
+#endif /* defined(VK_EXT_acquire_xlib_display) */
+#if defined(VK_EXT_attachment_feedback_loop_dynamic_state)
+  pTable->vkCmdSetAttachmentFeedbackLoopEnableEXT = vkCmdSetAttachmentFeedbackLoopEnableEXT;
+#endif /* defined(VK_EXT_attachment_feedback_loop_dynamic_state) */
+#if defined(VK_EXT_buffer_device_address)
+  pTable->vkGetBufferDeviceAddressEXT = vkGetBufferDeviceAddressEXT;
+#endif /* defined(VK_EXT_buffer_device_address) */
+#if defined(VK_EXT_calibrated_timestamps)
+  pTable->vkGetCalibratedTimestampsEXT = vkGetCalibratedTimestampsEXT;
+  pTable->vkGetPhysicalDeviceCalibrateableTimeDomainsEXT = vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+#endif /* defined(VK_EXT_calibrated_timestamps) */
+#if defined(VK_EXT_color_write_enable)
+  pTable->vkCmdSetColorWriteEnableEXT = vkCmdSetColorWriteEnableEXT;
+#endif /* defined(VK_EXT_color_write_enable) */
+#if defined(VK_EXT_conditional_rendering)
+  pTable->vkCmdBeginConditionalRenderingEXT = vkCmdBeginConditionalRenderingEXT;
+  pTable->vkCmdEndConditionalRenderingEXT = vkCmdEndConditionalRenderingEXT;
+#endif /* defined(VK_EXT_conditional_rendering) */
+#if defined(VK_EXT_custom_resolve) && (defined(VK_KHR_dynamic_rendering) || defined(VK_VERSION_1_3))
+  pTable->vkCmdBeginCustomResolveEXT = vkCmdBeginCustomResolveEXT;
+#endif /* defined(VK_EXT_custom_resolve) && (defined(VK_KHR_dynamic_rendering) || defined(VK_VERSION_1_3)) */
+#if defined(VK_EXT_debug_marker)
+  pTable->vkCmdDebugMarkerBeginEXT = vkCmdDebugMarkerBeginEXT;
+  pTable->vkCmdDebugMarkerEndEXT = vkCmdDebugMarkerEndEXT;
+  pTable->vkCmdDebugMarkerInsertEXT = vkCmdDebugMarkerInsertEXT;
+  pTable->vkDebugMarkerSetObjectNameEXT = vkDebugMarkerSetObjectNameEXT;
+  pTable->vkDebugMarkerSetObjectTagEXT = vkDebugMarkerSetObjectTagEXT;
+#endif /* defined(VK_EXT_debug_marker) */
+#if defined(VK_EXT_debug_report)
+  pTable->vkCreateDebugReportCallbackEXT = vkCreateDebugReportCallbackEXT;
+  pTable->vkDebugReportMessageEXT = vkDebugReportMessageEXT;
+  pTable->vkDestroyDebugReportCallbackEXT = vkDestroyDebugReportCallbackEXT;
+#endif /* defined(VK_EXT_debug_report) */
+#if defined(VK_EXT_debug_utils)
+  pTable->vkCmdBeginDebugUtilsLabelEXT = vkCmdBeginDebugUtilsLabelEXT;
+  pTable->vkCmdEndDebugUtilsLabelEXT = vkCmdEndDebugUtilsLabelEXT;
+  pTable->vkCmdInsertDebugUtilsLabelEXT = vkCmdInsertDebugUtilsLabelEXT;
+  pTable->vkCreateDebugUtilsMessengerEXT = vkCreateDebugUtilsMessengerEXT;
+  pTable->vkDestroyDebugUtilsMessengerEXT = vkDestroyDebugUtilsMessengerEXT;
+  pTable->vkQueueBeginDebugUtilsLabelEXT = vkQueueBeginDebugUtilsLabelEXT;
+  pTable->vkQueueEndDebugUtilsLabelEXT = vkQueueEndDebugUtilsLabelEXT;
+  pTable->vkQueueInsertDebugUtilsLabelEXT = vkQueueInsertDebugUtilsLabelEXT;
+  pTable->vkSetDebugUtilsObjectNameEXT = vkSetDebugUtilsObjectNameEXT;
+  pTable->vkSetDebugUtilsObjectTagEXT = vkSetDebugUtilsObjectTagEXT;
+  pTable->vkSubmitDebugUtilsMessageEXT = vkSubmitDebugUtilsMessageEXT;
+#endif /* defined(VK_EXT_debug_utils) */
+#if defined(VK_EXT_depth_bias_control)
+  pTable->vkCmdSetDepthBias2EXT = vkCmdSetDepthBias2EXT;
+#endif /* defined(VK_EXT_depth_bias_control) */
+#if defined(VK_EXT_descriptor_buffer)
+  pTable->vkCmdBindDescriptorBufferEmbeddedSamplersEXT = vkCmdBindDescriptorBufferEmbeddedSamplersEXT;
+  pTable->vkCmdBindDescriptorBuffersEXT = vkCmdBindDescriptorBuffersEXT;
+  pTable->vkCmdSetDescriptorBufferOffsetsEXT = vkCmdSetDescriptorBufferOffsetsEXT;
+  pTable->vkGetBufferOpaqueCaptureDescriptorDataEXT = vkGetBufferOpaqueCaptureDescriptorDataEXT;
+  pTable->vkGetDescriptorEXT = vkGetDescriptorEXT;
+  pTable->vkGetDescriptorSetLayoutBindingOffsetEXT = vkGetDescriptorSetLayoutBindingOffsetEXT;
+  pTable->vkGetDescriptorSetLayoutSizeEXT = vkGetDescriptorSetLayoutSizeEXT;
+  pTable->vkGetImageOpaqueCaptureDescriptorDataEXT = vkGetImageOpaqueCaptureDescriptorDataEXT;
+  pTable->vkGetImageViewOpaqueCaptureDescriptorDataEXT = vkGetImageViewOpaqueCaptureDescriptorDataEXT;
+  pTable->vkGetSamplerOpaqueCaptureDescriptorDataEXT = vkGetSamplerOpaqueCaptureDescriptorDataEXT;
+#endif /* defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_EXT_descriptor_buffer) && (defined(VK_KHR_acceleration_structure) || defined(VK_NV_ray_tracing))
+  pTable->vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT = vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
+#endif /* defined(VK_EXT_descriptor_buffer) && (defined(VK_KHR_acceleration_structure) || defined(VK_NV_ray_tracing)) */
+#if defined(VK_EXT_descriptor_heap)
+  pTable->vkCmdBindResourceHeapEXT = vkCmdBindResourceHeapEXT;
+  pTable->vkCmdBindSamplerHeapEXT = vkCmdBindSamplerHeapEXT;
+  pTable->vkCmdPushDataEXT = vkCmdPushDataEXT;
+  pTable->vkGetImageOpaqueCaptureDataEXT = vkGetImageOpaqueCaptureDataEXT;
+  pTable->vkGetPhysicalDeviceDescriptorSizeEXT = vkGetPhysicalDeviceDescriptorSizeEXT;
+  pTable->vkWriteResourceDescriptorsEXT = vkWriteResourceDescriptorsEXT;
+  pTable->vkWriteSamplerDescriptorsEXT = vkWriteSamplerDescriptorsEXT;
+#endif /* defined(VK_EXT_descriptor_heap) */
+#if defined(VK_EXT_descriptor_heap) && defined(VK_EXT_custom_border_color)
+  pTable->vkRegisterCustomBorderColorEXT = vkRegisterCustomBorderColorEXT;
+  pTable->vkUnregisterCustomBorderColorEXT = vkUnregisterCustomBorderColorEXT;
+#endif /* defined(VK_EXT_descriptor_heap) && defined(VK_EXT_custom_border_color) */
+#if defined(VK_EXT_descriptor_heap) && defined(VK_ARM_tensors)
+  pTable->vkGetTensorOpaqueCaptureDataARM = vkGetTensorOpaqueCaptureDataARM;
+#endif /* defined(VK_EXT_descriptor_heap) && defined(VK_ARM_tensors) */
+#if defined(VK_EXT_device_fault)
+  pTable->vkGetDeviceFaultInfoEXT = vkGetDeviceFaultInfoEXT;
+#endif /* defined(VK_EXT_device_fault) */
+#if defined(VK_EXT_device_generated_commands)
+  pTable->vkCmdExecuteGeneratedCommandsEXT = vkCmdExecuteGeneratedCommandsEXT;
+  pTable->vkCmdPreprocessGeneratedCommandsEXT = vkCmdPreprocessGeneratedCommandsEXT;
+  pTable->vkCreateIndirectCommandsLayoutEXT = vkCreateIndirectCommandsLayoutEXT;
+  pTable->vkCreateIndirectExecutionSetEXT = vkCreateIndirectExecutionSetEXT;
+  pTable->vkDestroyIndirectCommandsLayoutEXT = vkDestroyIndirectCommandsLayoutEXT;
+  pTable->vkDestroyIndirectExecutionSetEXT = vkDestroyIndirectExecutionSetEXT;
+  pTable->vkGetGeneratedCommandsMemoryRequirementsEXT = vkGetGeneratedCommandsMemoryRequirementsEXT;
+  pTable->vkUpdateIndirectExecutionSetPipelineEXT = vkUpdateIndirectExecutionSetPipelineEXT;
+  pTable->vkUpdateIndirectExecutionSetShaderEXT = vkUpdateIndirectExecutionSetShaderEXT;
+#endif /* defined(VK_EXT_device_generated_commands) */
+#if defined(VK_EXT_direct_mode_display)
+  pTable->vkReleaseDisplayEXT = vkReleaseDisplayEXT;
+#endif /* defined(VK_EXT_direct_mode_display) */
+#if defined(VK_EXT_directfb_surface)
+  pTable->vkCreateDirectFBSurfaceEXT = vkCreateDirectFBSurfaceEXT;
+  pTable->vkGetPhysicalDeviceDirectFBPresentationSupportEXT = vkGetPhysicalDeviceDirectFBPresentationSupportEXT;
+#endif /* defined(VK_EXT_directfb_surface) */
+#if defined(VK_EXT_discard_rectangles)
+  pTable->vkCmdSetDiscardRectangleEXT = vkCmdSetDiscardRectangleEXT;
+#endif /* defined(VK_EXT_discard_rectangles) */
+#if defined(VK_EXT_discard_rectangles) && VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2
+  pTable->vkCmdSetDiscardRectangleEnableEXT = vkCmdSetDiscardRectangleEnableEXT;
+  pTable->vkCmdSetDiscardRectangleModeEXT = vkCmdSetDiscardRectangleModeEXT;
+#endif /* defined(VK_EXT_discard_rectangles) && VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2 */
+#if defined(VK_EXT_display_control)
+  pTable->vkDisplayPowerControlEXT = vkDisplayPowerControlEXT;
+  pTable->vkGetSwapchainCounterEXT = vkGetSwapchainCounterEXT;
+  pTable->vkRegisterDeviceEventEXT = vkRegisterDeviceEventEXT;
+  pTable->vkRegisterDisplayEventEXT = vkRegisterDisplayEventEXT;
+#endif /* defined(VK_EXT_display_control) */
+#if defined(VK_EXT_display_surface_counter)
+  pTable->vkGetPhysicalDeviceSurfaceCapabilities2EXT = vkGetPhysicalDeviceSurfaceCapabilities2EXT;
+#endif /* defined(VK_EXT_display_surface_counter) */
+#if defined(VK_EXT_external_memory_host)
+  pTable->vkGetMemoryHostPointerPropertiesEXT = vkGetMemoryHostPointerPropertiesEXT;
+#endif /* defined(VK_EXT_external_memory_host) */
+#if defined(VK_EXT_external_memory_metal)
+  pTable->vkGetMemoryMetalHandleEXT = vkGetMemoryMetalHandleEXT;
+  pTable->vkGetMemoryMetalHandlePropertiesEXT = vkGetMemoryMetalHandlePropertiesEXT;
+#endif /* defined(VK_EXT_external_memory_metal) */
+#if defined(VK_EXT_fragment_density_map_offset)
+  pTable->vkCmdEndRendering2EXT = vkCmdEndRendering2EXT;
+#endif /* defined(VK_EXT_fragment_density_map_offset) */
+#if defined(VK_EXT_full_screen_exclusive)
+  pTable->vkAcquireFullScreenExclusiveModeEXT = vkAcquireFullScreenExclusiveModeEXT;
+  pTable->vkGetPhysicalDeviceSurfacePresentModes2EXT = vkGetPhysicalDeviceSurfacePresentModes2EXT;
+  pTable->vkReleaseFullScreenExclusiveModeEXT = vkReleaseFullScreenExclusiveModeEXT;
+#endif /* defined(VK_EXT_full_screen_exclusive) */
+#if defined(VK_EXT_full_screen_exclusive) && (defined(VK_KHR_device_group) || defined(VK_VERSION_1_1))
+  pTable->vkGetDeviceGroupSurfacePresentModes2EXT = vkGetDeviceGroupSurfacePresentModes2EXT;
+#endif /* defined(VK_EXT_full_screen_exclusive) && (defined(VK_KHR_device_group) || defined(VK_VERSION_1_1)) */
+#if defined(VK_EXT_hdr_metadata)
+  pTable->vkSetHdrMetadataEXT = vkSetHdrMetadataEXT;
+#endif /* defined(VK_EXT_hdr_metadata) */
+#if defined(VK_EXT_headless_surface)
+  pTable->vkCreateHeadlessSurfaceEXT = vkCreateHeadlessSurfaceEXT;
+#endif /* defined(VK_EXT_headless_surface) */
+#if defined(VK_EXT_host_image_copy)
+  pTable->vkCopyImageToImageEXT = vkCopyImageToImageEXT;
+  pTable->vkCopyImageToMemoryEXT = vkCopyImageToMemoryEXT;
+  pTable->vkCopyMemoryToImageEXT = vkCopyMemoryToImageEXT;
+  pTable->vkTransitionImageLayoutEXT = vkTransitionImageLayoutEXT;
+#endif /* defined(VK_EXT_host_image_copy) */
+#if defined(VK_EXT_host_query_reset)
+  pTable->vkResetQueryPoolEXT = vkResetQueryPoolEXT;
+#endif /* defined(VK_EXT_host_query_reset) */
+#if defined(VK_EXT_image_drm_format_modifier)
+  pTable->vkGetImageDrmFormatModifierPropertiesEXT = vkGetImageDrmFormatModifierPropertiesEXT;
+#endif /* defined(VK_EXT_image_drm_format_modifier) */
+#if defined(VK_EXT_line_rasterization)
+  pTable->vkCmdSetLineStippleEXT = vkCmdSetLineStippleEXT;
+#endif /* defined(VK_EXT_line_rasterization) */
+#if defined(VK_EXT_memory_decompression)
+  pTable->vkCmdDecompressMemoryEXT = vkCmdDecompressMemoryEXT;
+  pTable->vkCmdDecompressMemoryIndirectCountEXT = vkCmdDecompressMemoryIndirectCountEXT;
+#endif /* defined(VK_EXT_memory_decompression) */
+#if defined(VK_EXT_mesh_shader)
+  pTable->vkCmdDrawMeshTasksEXT = vkCmdDrawMeshTasksEXT;
+  pTable->vkCmdDrawMeshTasksIndirectEXT = vkCmdDrawMeshTasksIndirectEXT;
+#endif /* defined(VK_EXT_mesh_shader) */
+#if defined(VK_EXT_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count))
+  pTable->vkCmdDrawMeshTasksIndirectCountEXT = vkCmdDrawMeshTasksIndirectCountEXT;
+#endif /* defined(VK_EXT_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count)) */
+#if defined(VK_EXT_metal_objects)
+  pTable->vkExportMetalObjectsEXT = vkExportMetalObjectsEXT;
+#endif /* defined(VK_EXT_metal_objects) */
+#if defined(VK_EXT_metal_surface)
+  pTable->vkCreateMetalSurfaceEXT = vkCreateMetalSurfaceEXT;
+#endif /* defined(VK_EXT_metal_surface) */
+#if defined(VK_EXT_multi_draw)
+  pTable->vkCmdDrawMultiEXT = vkCmdDrawMultiEXT;
+  pTable->vkCmdDrawMultiIndexedEXT = vkCmdDrawMultiIndexedEXT;
+#endif /* defined(VK_EXT_multi_draw) */
+#if defined(VK_EXT_opacity_micromap)
+  pTable->vkBuildMicromapsEXT = vkBuildMicromapsEXT;
+  pTable->vkCmdBuildMicromapsEXT = vkCmdBuildMicromapsEXT;
+  pTable->vkCmdCopyMemoryToMicromapEXT = vkCmdCopyMemoryToMicromapEXT;
+  pTable->vkCmdCopyMicromapEXT = vkCmdCopyMicromapEXT;
+  pTable->vkCmdCopyMicromapToMemoryEXT = vkCmdCopyMicromapToMemoryEXT;
+  pTable->vkCmdWriteMicromapsPropertiesEXT = vkCmdWriteMicromapsPropertiesEXT;
+  pTable->vkCopyMemoryToMicromapEXT = vkCopyMemoryToMicromapEXT;
+  pTable->vkCopyMicromapEXT = vkCopyMicromapEXT;
+  pTable->vkCopyMicromapToMemoryEXT = vkCopyMicromapToMemoryEXT;
+  pTable->vkCreateMicromapEXT = vkCreateMicromapEXT;
+  pTable->vkDestroyMicromapEXT = vkDestroyMicromapEXT;
+  pTable->vkGetDeviceMicromapCompatibilityEXT = vkGetDeviceMicromapCompatibilityEXT;
+  pTable->vkGetMicromapBuildSizesEXT = vkGetMicromapBuildSizesEXT;
+  pTable->vkWriteMicromapsPropertiesEXT = vkWriteMicromapsPropertiesEXT;
+#endif /* defined(VK_EXT_opacity_micromap) */
+#if defined(VK_EXT_pageable_device_local_memory)
+  pTable->vkSetDeviceMemoryPriorityEXT = vkSetDeviceMemoryPriorityEXT;
+#endif /* defined(VK_EXT_pageable_device_local_memory) */
+#if defined(VK_EXT_pipeline_properties)
+  pTable->vkGetPipelinePropertiesEXT = vkGetPipelinePropertiesEXT;
+#endif /* defined(VK_EXT_pipeline_properties) */
+#if defined(VK_EXT_present_timing)
+  pTable->vkGetPastPresentationTimingEXT = vkGetPastPresentationTimingEXT;
+  pTable->vkGetSwapchainTimeDomainPropertiesEXT = vkGetSwapchainTimeDomainPropertiesEXT;
+  pTable->vkGetSwapchainTimingPropertiesEXT = vkGetSwapchainTimingPropertiesEXT;
+  pTable->vkSetSwapchainPresentTimingQueueSizeEXT = vkSetSwapchainPresentTimingQueueSizeEXT;
+#endif /* defined(VK_EXT_present_timing) */
+#if defined(VK_EXT_private_data)
+  pTable->vkCreatePrivateDataSlotEXT = vkCreatePrivateDataSlotEXT;
+  pTable->vkDestroyPrivateDataSlotEXT = vkDestroyPrivateDataSlotEXT;
+  pTable->vkGetPrivateDataEXT = vkGetPrivateDataEXT;
+  pTable->vkSetPrivateDataEXT = vkSetPrivateDataEXT;
+#endif /* defined(VK_EXT_private_data) */
+#if defined(VK_EXT_sample_locations)
+  pTable->vkCmdSetSampleLocationsEXT = vkCmdSetSampleLocationsEXT;
+  pTable->vkGetPhysicalDeviceMultisamplePropertiesEXT = vkGetPhysicalDeviceMultisamplePropertiesEXT;
+#endif /* defined(VK_EXT_sample_locations) */
+#if defined(VK_EXT_shader_module_identifier)
+  pTable->vkGetShaderModuleCreateInfoIdentifierEXT = vkGetShaderModuleCreateInfoIdentifierEXT;
+  pTable->vkGetShaderModuleIdentifierEXT = vkGetShaderModuleIdentifierEXT;
+#endif /* defined(VK_EXT_shader_module_identifier) */
+#if defined(VK_EXT_shader_object)
+  pTable->vkCmdBindShadersEXT = vkCmdBindShadersEXT;
+  pTable->vkCreateShadersEXT = vkCreateShadersEXT;
+  pTable->vkDestroyShaderEXT = vkDestroyShaderEXT;
+  pTable->vkGetShaderBinaryDataEXT = vkGetShaderBinaryDataEXT;
+#endif /* defined(VK_EXT_shader_object) */
+#if defined(VK_EXT_swapchain_maintenance1)
+  pTable->vkReleaseSwapchainImagesEXT = vkReleaseSwapchainImagesEXT;
+#endif /* defined(VK_EXT_swapchain_maintenance1) */
+#if defined(VK_EXT_tooling_info)
+  pTable->vkGetPhysicalDeviceToolPropertiesEXT = vkGetPhysicalDeviceToolPropertiesEXT;
+#endif /* defined(VK_EXT_tooling_info) */
+#if defined(VK_EXT_transform_feedback)
+  pTable->vkCmdBeginQueryIndexedEXT = vkCmdBeginQueryIndexedEXT;
+  pTable->vkCmdBeginTransformFeedbackEXT = vkCmdBeginTransformFeedbackEXT;
+  pTable->vkCmdBindTransformFeedbackBuffersEXT = vkCmdBindTransformFeedbackBuffersEXT;
+  pTable->vkCmdDrawIndirectByteCountEXT = vkCmdDrawIndirectByteCountEXT;
+  pTable->vkCmdEndQueryIndexedEXT = vkCmdEndQueryIndexedEXT;
+  pTable->vkCmdEndTransformFeedbackEXT = vkCmdEndTransformFeedbackEXT;
+#endif /* defined(VK_EXT_transform_feedback) */
+#if defined(VK_EXT_validation_cache)
+  pTable->vkCreateValidationCacheEXT = vkCreateValidationCacheEXT;
+  pTable->vkDestroyValidationCacheEXT = vkDestroyValidationCacheEXT;
+  pTable->vkGetValidationCacheDataEXT = vkGetValidationCacheDataEXT;
+  pTable->vkMergeValidationCachesEXT = vkMergeValidationCachesEXT;
+#endif /* defined(VK_EXT_validation_cache) */
+#if defined(VK_FUCHSIA_buffer_collection)
+  pTable->vkCreateBufferCollectionFUCHSIA = vkCreateBufferCollectionFUCHSIA;
+  pTable->vkDestroyBufferCollectionFUCHSIA = vkDestroyBufferCollectionFUCHSIA;
+  pTable->vkGetBufferCollectionPropertiesFUCHSIA = vkGetBufferCollectionPropertiesFUCHSIA;
+  pTable->vkSetBufferCollectionBufferConstraintsFUCHSIA = vkSetBufferCollectionBufferConstraintsFUCHSIA;
+  pTable->vkSetBufferCollectionImageConstraintsFUCHSIA = vkSetBufferCollectionImageConstraintsFUCHSIA;
+#endif /* defined(VK_FUCHSIA_buffer_collection) */
+#if defined(VK_FUCHSIA_external_memory)
+  pTable->vkGetMemoryZirconHandleFUCHSIA = vkGetMemoryZirconHandleFUCHSIA;
+  pTable->vkGetMemoryZirconHandlePropertiesFUCHSIA = vkGetMemoryZirconHandlePropertiesFUCHSIA;
+#endif /* defined(VK_FUCHSIA_external_memory) */
+#if defined(VK_FUCHSIA_external_semaphore)
+  pTable->vkGetSemaphoreZirconHandleFUCHSIA = vkGetSemaphoreZirconHandleFUCHSIA;
+  pTable->vkImportSemaphoreZirconHandleFUCHSIA = vkImportSemaphoreZirconHandleFUCHSIA;
+#endif /* defined(VK_FUCHSIA_external_semaphore) */
+#if defined(VK_FUCHSIA_imagepipe_surface)
+  pTable->vkCreateImagePipeSurfaceFUCHSIA = vkCreateImagePipeSurfaceFUCHSIA;
+#endif /* defined(VK_FUCHSIA_imagepipe_surface) */
+#if defined(VK_GGP_stream_descriptor_surface)
+  pTable->vkCreateStreamDescriptorSurfaceGGP = vkCreateStreamDescriptorSurfaceGGP;
+#endif /* defined(VK_GGP_stream_descriptor_surface) */
+#if defined(VK_GOOGLE_display_timing)
+  pTable->vkGetPastPresentationTimingGOOGLE = vkGetPastPresentationTimingGOOGLE;
+  pTable->vkGetRefreshCycleDurationGOOGLE = vkGetRefreshCycleDurationGOOGLE;
+#endif /* defined(VK_GOOGLE_display_timing) */
+#if defined(VK_HUAWEI_cluster_culling_shader)
+  pTable->vkCmdDrawClusterHUAWEI = vkCmdDrawClusterHUAWEI;
+  pTable->vkCmdDrawClusterIndirectHUAWEI = vkCmdDrawClusterIndirectHUAWEI;
+#endif /* defined(VK_HUAWEI_cluster_culling_shader) */
+#if defined(VK_HUAWEI_invocation_mask)
+  pTable->vkCmdBindInvocationMaskHUAWEI = vkCmdBindInvocationMaskHUAWEI;
+#endif /* defined(VK_HUAWEI_invocation_mask) */
+#if defined(VK_HUAWEI_subpass_shading)
+  pTable->vkCmdSubpassShadingHUAWEI = vkCmdSubpassShadingHUAWEI;
+  pTable->vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+#endif /* defined(VK_HUAWEI_subpass_shading) */
+#if defined(VK_INTEL_performance_query)
+  pTable->vkAcquirePerformanceConfigurationINTEL = vkAcquirePerformanceConfigurationINTEL;
+  pTable->vkCmdSetPerformanceMarkerINTEL = vkCmdSetPerformanceMarkerINTEL;
+  pTable->vkCmdSetPerformanceOverrideINTEL = vkCmdSetPerformanceOverrideINTEL;
+  pTable->vkCmdSetPerformanceStreamMarkerINTEL = vkCmdSetPerformanceStreamMarkerINTEL;
+  pTable->vkGetPerformanceParameterINTEL = vkGetPerformanceParameterINTEL;
+  pTable->vkInitializePerformanceApiINTEL = vkInitializePerformanceApiINTEL;
+  pTable->vkQueueSetPerformanceConfigurationINTEL = vkQueueSetPerformanceConfigurationINTEL;
+  pTable->vkReleasePerformanceConfigurationINTEL = vkReleasePerformanceConfigurationINTEL;
+  pTable->vkUninitializePerformanceApiINTEL = vkUninitializePerformanceApiINTEL;
+#endif /* defined(VK_INTEL_performance_query) */
+#if defined(VK_KHR_acceleration_structure)
+  pTable->vkBuildAccelerationStructuresKHR = vkBuildAccelerationStructuresKHR;
+  pTable->vkCmdBuildAccelerationStructuresIndirectKHR = vkCmdBuildAccelerationStructuresIndirectKHR;
+  pTable->vkCmdBuildAccelerationStructuresKHR = vkCmdBuildAccelerationStructuresKHR;
+  pTable->vkCmdCopyAccelerationStructureKHR = vkCmdCopyAccelerationStructureKHR;
+  pTable->vkCmdCopyAccelerationStructureToMemoryKHR = vkCmdCopyAccelerationStructureToMemoryKHR;
+  pTable->vkCmdCopyMemoryToAccelerationStructureKHR = vkCmdCopyMemoryToAccelerationStructureKHR;
+  pTable->vkCmdWriteAccelerationStructuresPropertiesKHR = vkCmdWriteAccelerationStructuresPropertiesKHR;
+  pTable->vkCopyAccelerationStructureKHR = vkCopyAccelerationStructureKHR;
+  pTable->vkCopyAccelerationStructureToMemoryKHR = vkCopyAccelerationStructureToMemoryKHR;
+  pTable->vkCopyMemoryToAccelerationStructureKHR = vkCopyMemoryToAccelerationStructureKHR;
+  pTable->vkCreateAccelerationStructureKHR = vkCreateAccelerationStructureKHR;
+  pTable->vkDestroyAccelerationStructureKHR = vkDestroyAccelerationStructureKHR;
+  pTable->vkGetAccelerationStructureBuildSizesKHR = vkGetAccelerationStructureBuildSizesKHR;
+  pTable->vkGetAccelerationStructureDeviceAddressKHR = vkGetAccelerationStructureDeviceAddressKHR;
+  pTable->vkGetDeviceAccelerationStructureCompatibilityKHR = vkGetDeviceAccelerationStructureCompatibilityKHR;
+  pTable->vkWriteAccelerationStructuresPropertiesKHR = vkWriteAccelerationStructuresPropertiesKHR;
+#endif /* defined(VK_KHR_acceleration_structure) */
+#if defined(VK_KHR_android_surface)
+  pTable->vkCreateAndroidSurfaceKHR = vkCreateAndroidSurfaceKHR;
+#endif /* defined(VK_KHR_android_surface) */
+#if defined(VK_KHR_bind_memory2)
+  pTable->vkBindBufferMemory2KHR = vkBindBufferMemory2KHR;
+  pTable->vkBindImageMemory2KHR = vkBindImageMemory2KHR;
+#endif /* defined(VK_KHR_bind_memory2) */
+#if defined(VK_KHR_buffer_device_address)
+  pTable->vkGetBufferDeviceAddressKHR = vkGetBufferDeviceAddressKHR;
+  pTable->vkGetBufferOpaqueCaptureAddressKHR = vkGetBufferOpaqueCaptureAddressKHR;
+  pTable->vkGetDeviceMemoryOpaqueCaptureAddressKHR = vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+#endif /* defined(VK_KHR_buffer_device_address) */
+#if defined(VK_KHR_calibrated_timestamps)
+  pTable->vkGetCalibratedTimestampsKHR = vkGetCalibratedTimestampsKHR;
+  pTable->vkGetPhysicalDeviceCalibrateableTimeDomainsKHR = vkGetPhysicalDeviceCalibrateableTimeDomainsKHR;
+#endif /* defined(VK_KHR_calibrated_timestamps) */
+#if defined(VK_KHR_cooperative_matrix)
+  pTable->vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR = vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR;
+#endif /* defined(VK_KHR_cooperative_matrix) */
+#if defined(VK_KHR_copy_commands2)
+  pTable->vkCmdBlitImage2KHR = vkCmdBlitImage2KHR;
+  pTable->vkCmdCopyBuffer2KHR = vkCmdCopyBuffer2KHR;
+  pTable->vkCmdCopyBufferToImage2KHR = vkCmdCopyBufferToImage2KHR;
+  pTable->vkCmdCopyImage2KHR = vkCmdCopyImage2KHR;
+  pTable->vkCmdCopyImageToBuffer2KHR = vkCmdCopyImageToBuffer2KHR;
+  pTable->vkCmdResolveImage2KHR = vkCmdResolveImage2KHR;
+#endif /* defined(VK_KHR_copy_commands2) */
+#if defined(VK_KHR_copy_memory_indirect)
+  pTable->vkCmdCopyMemoryIndirectKHR = vkCmdCopyMemoryIndirectKHR;
+  pTable->vkCmdCopyMemoryToImageIndirectKHR = vkCmdCopyMemoryToImageIndirectKHR;
+#endif /* defined(VK_KHR_copy_memory_indirect) */
+#if defined(VK_KHR_create_renderpass2)
+  pTable->vkCmdBeginRenderPass2KHR = vkCmdBeginRenderPass2KHR;
+  pTable->vkCmdEndRenderPass2KHR = vkCmdEndRenderPass2KHR;
+  pTable->vkCmdNextSubpass2KHR = vkCmdNextSubpass2KHR;
+  pTable->vkCreateRenderPass2KHR = vkCreateRenderPass2KHR;
+#endif /* defined(VK_KHR_create_renderpass2) */
+#if defined(VK_KHR_deferred_host_operations)
+  pTable->vkCreateDeferredOperationKHR = vkCreateDeferredOperationKHR;
+  pTable->vkDeferredOperationJoinKHR = vkDeferredOperationJoinKHR;
+  pTable->vkDestroyDeferredOperationKHR = vkDestroyDeferredOperationKHR;
+  pTable->vkGetDeferredOperationMaxConcurrencyKHR = vkGetDeferredOperationMaxConcurrencyKHR;
+  pTable->vkGetDeferredOperationResultKHR = vkGetDeferredOperationResultKHR;
+#endif /* defined(VK_KHR_deferred_host_operations) */
+#if defined(VK_KHR_descriptor_update_template)
+  pTable->vkCreateDescriptorUpdateTemplateKHR = vkCreateDescriptorUpdateTemplateKHR;
+  pTable->vkDestroyDescriptorUpdateTemplateKHR = vkDestroyDescriptorUpdateTemplateKHR;
+  pTable->vkUpdateDescriptorSetWithTemplateKHR = vkUpdateDescriptorSetWithTemplateKHR;
+#endif /* defined(VK_KHR_descriptor_update_template) */
+#if defined(VK_KHR_device_group)
+  pTable->vkCmdDispatchBaseKHR = vkCmdDispatchBaseKHR;
+  pTable->vkCmdSetDeviceMaskKHR = vkCmdSetDeviceMaskKHR;
+  pTable->vkGetDeviceGroupPeerMemoryFeaturesKHR = vkGetDeviceGroupPeerMemoryFeaturesKHR;
+#endif /* defined(VK_KHR_device_group) */
+#if defined(VK_KHR_device_group_creation)
+  pTable->vkEnumeratePhysicalDeviceGroupsKHR = vkEnumeratePhysicalDeviceGroupsKHR;
+#endif /* defined(VK_KHR_device_group_creation) */
+#if defined(VK_KHR_display)
+  pTable->vkCreateDisplayModeKHR = vkCreateDisplayModeKHR;
+  pTable->vkCreateDisplayPlaneSurfaceKHR = vkCreateDisplayPlaneSurfaceKHR;
+  pTable->vkGetDisplayModePropertiesKHR = vkGetDisplayModePropertiesKHR;
+  pTable->vkGetDisplayPlaneCapabilitiesKHR = vkGetDisplayPlaneCapabilitiesKHR;
+  pTable->vkGetDisplayPlaneSupportedDisplaysKHR = vkGetDisplayPlaneSupportedDisplaysKHR;
+  pTable->vkGetPhysicalDeviceDisplayPlanePropertiesKHR = vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
+  pTable->vkGetPhysicalDeviceDisplayPropertiesKHR = vkGetPhysicalDeviceDisplayPropertiesKHR;
+#endif /* defined(VK_KHR_display) */
+#if defined(VK_KHR_display_swapchain)
+  pTable->vkCreateSharedSwapchainsKHR = vkCreateSharedSwapchainsKHR;
+#endif /* defined(VK_KHR_display_swapchain) */
+#if defined(VK_KHR_draw_indirect_count)
+  pTable->vkCmdDrawIndexedIndirectCountKHR = vkCmdDrawIndexedIndirectCountKHR;
+  pTable->vkCmdDrawIndirectCountKHR = vkCmdDrawIndirectCountKHR;
+#endif /* defined(VK_KHR_draw_indirect_count) */
+#if defined(VK_KHR_dynamic_rendering)
+  pTable->vkCmdBeginRenderingKHR = vkCmdBeginRenderingKHR;
+  pTable->vkCmdEndRenderingKHR = vkCmdEndRenderingKHR;
+#endif /* defined(VK_KHR_dynamic_rendering) */
+#if defined(VK_KHR_dynamic_rendering_local_read)
+  pTable->vkCmdSetRenderingAttachmentLocationsKHR = vkCmdSetRenderingAttachmentLocationsKHR;
+  pTable->vkCmdSetRenderingInputAttachmentIndicesKHR = vkCmdSetRenderingInputAttachmentIndicesKHR;
+#endif /* defined(VK_KHR_dynamic_rendering_local_read) */
+#if defined(VK_KHR_external_fence_capabilities)
+  pTable->vkGetPhysicalDeviceExternalFencePropertiesKHR = vkGetPhysicalDeviceExternalFencePropertiesKHR;
+#endif /* defined(VK_KHR_external_fence_capabilities) */
+#if defined(VK_KHR_external_fence_fd)
+  pTable->vkGetFenceFdKHR = vkGetFenceFdKHR;
+  pTable->vkImportFenceFdKHR = vkImportFenceFdKHR;
+#endif /* defined(VK_KHR_external_fence_fd) */
+#if defined(VK_KHR_external_fence_win32)
+  pTable->vkGetFenceWin32HandleKHR = vkGetFenceWin32HandleKHR;
+  pTable->vkImportFenceWin32HandleKHR = vkImportFenceWin32HandleKHR;
+#endif /* defined(VK_KHR_external_fence_win32) */
+#if defined(VK_KHR_external_memory_capabilities)
+  pTable->vkGetPhysicalDeviceExternalBufferPropertiesKHR = vkGetPhysicalDeviceExternalBufferPropertiesKHR;
+#endif /* defined(VK_KHR_external_memory_capabilities) */
+#if defined(VK_KHR_external_memory_fd)
+  pTable->vkGetMemoryFdKHR = vkGetMemoryFdKHR;
+  pTable->vkGetMemoryFdPropertiesKHR = vkGetMemoryFdPropertiesKHR;
+#endif /* defined(VK_KHR_external_memory_fd) */
+#if defined(VK_KHR_external_memory_win32)
+  pTable->vkGetMemoryWin32HandleKHR = vkGetMemoryWin32HandleKHR;
+  pTable->vkGetMemoryWin32HandlePropertiesKHR = vkGetMemoryWin32HandlePropertiesKHR;
+#endif /* defined(VK_KHR_external_memory_win32) */
+#if defined(VK_KHR_external_semaphore_capabilities)
+  pTable->vkGetPhysicalDeviceExternalSemaphorePropertiesKHR = vkGetPhysicalDeviceExternalSemaphorePropertiesKHR;
+#endif /* defined(VK_KHR_external_semaphore_capabilities) */
+#if defined(VK_KHR_external_semaphore_fd)
+  pTable->vkGetSemaphoreFdKHR = vkGetSemaphoreFdKHR;
+  pTable->vkImportSemaphoreFdKHR = vkImportSemaphoreFdKHR;
+#endif /* defined(VK_KHR_external_semaphore_fd) */
+#if defined(VK_KHR_external_semaphore_win32)
+  pTable->vkGetSemaphoreWin32HandleKHR = vkGetSemaphoreWin32HandleKHR;
+  pTable->vkImportSemaphoreWin32HandleKHR = vkImportSemaphoreWin32HandleKHR;
+#endif /* defined(VK_KHR_external_semaphore_win32) */
+#if defined(VK_KHR_fragment_shading_rate)
+  pTable->vkCmdSetFragmentShadingRateKHR = vkCmdSetFragmentShadingRateKHR;
+  pTable->vkGetPhysicalDeviceFragmentShadingRatesKHR = vkGetPhysicalDeviceFragmentShadingRatesKHR;
+#endif /* defined(VK_KHR_fragment_shading_rate) */
+#if defined(VK_KHR_get_display_properties2)
+  pTable->vkGetDisplayModeProperties2KHR = vkGetDisplayModeProperties2KHR;
+  pTable->vkGetDisplayPlaneCapabilities2KHR = vkGetDisplayPlaneCapabilities2KHR;
+  pTable->vkGetPhysicalDeviceDisplayPlaneProperties2KHR = vkGetPhysicalDeviceDisplayPlaneProperties2KHR;
+  pTable->vkGetPhysicalDeviceDisplayProperties2KHR = vkGetPhysicalDeviceDisplayProperties2KHR;
+#endif /* defined(VK_KHR_get_display_properties2) */
+#if defined(VK_KHR_get_memory_requirements2)
+  pTable->vkGetBufferMemoryRequirements2KHR = vkGetBufferMemoryRequirements2KHR;
+  pTable->vkGetImageMemoryRequirements2KHR = vkGetImageMemoryRequirements2KHR;
+  pTable->vkGetImageSparseMemoryRequirements2KHR = vkGetImageSparseMemoryRequirements2KHR;
+#endif /* defined(VK_KHR_get_memory_requirements2) */
+#if defined(VK_KHR_get_physical_device_properties2)
+  pTable->vkGetPhysicalDeviceFeatures2KHR = vkGetPhysicalDeviceFeatures2KHR;
+  pTable->vkGetPhysicalDeviceFormatProperties2KHR = vkGetPhysicalDeviceFormatProperties2KHR;
+  pTable->vkGetPhysicalDeviceImageFormatProperties2KHR = vkGetPhysicalDeviceImageFormatProperties2KHR;
+  pTable->vkGetPhysicalDeviceMemoryProperties2KHR = vkGetPhysicalDeviceMemoryProperties2KHR;
+  pTable->vkGetPhysicalDeviceProperties2KHR = vkGetPhysicalDeviceProperties2KHR;
+  pTable->vkGetPhysicalDeviceQueueFamilyProperties2KHR = vkGetPhysicalDeviceQueueFamilyProperties2KHR;
+  pTable->vkGetPhysicalDeviceSparseImageFormatProperties2KHR = vkGetPhysicalDeviceSparseImageFormatProperties2KHR;
+#endif /* defined(VK_KHR_get_physical_device_properties2) */
+#if defined(VK_KHR_get_surface_capabilities2)
+  pTable->vkGetPhysicalDeviceSurfaceCapabilities2KHR = vkGetPhysicalDeviceSurfaceCapabilities2KHR;
+  pTable->vkGetPhysicalDeviceSurfaceFormats2KHR = vkGetPhysicalDeviceSurfaceFormats2KHR;
+#endif /* defined(VK_KHR_get_surface_capabilities2) */
+#if defined(VK_KHR_line_rasterization)
+  pTable->vkCmdSetLineStippleKHR = vkCmdSetLineStippleKHR;
+#endif /* defined(VK_KHR_line_rasterization) */
+#if defined(VK_KHR_maintenance1)
+  pTable->vkTrimCommandPoolKHR = vkTrimCommandPoolKHR;
+#endif /* defined(VK_KHR_maintenance1) */
+#if defined(VK_KHR_maintenance10)
+  pTable->vkCmdEndRendering2KHR = vkCmdEndRendering2KHR;
+#endif /* defined(VK_KHR_maintenance10) */
+#if defined(VK_KHR_maintenance3)
+  pTable->vkGetDescriptorSetLayoutSupportKHR = vkGetDescriptorSetLayoutSupportKHR;
+#endif /* defined(VK_KHR_maintenance3) */
+#if defined(VK_KHR_maintenance4)
+  pTable->vkGetDeviceBufferMemoryRequirementsKHR = vkGetDeviceBufferMemoryRequirementsKHR;
+  pTable->vkGetDeviceImageMemoryRequirementsKHR = vkGetDeviceImageMemoryRequirementsKHR;
+  pTable->vkGetDeviceImageSparseMemoryRequirementsKHR = vkGetDeviceImageSparseMemoryRequirementsKHR;
+#endif /* defined(VK_KHR_maintenance4) */
+#if defined(VK_KHR_maintenance5)
+  pTable->vkCmdBindIndexBuffer2KHR = vkCmdBindIndexBuffer2KHR;
+  pTable->vkGetDeviceImageSubresourceLayoutKHR = vkGetDeviceImageSubresourceLayoutKHR;
+  pTable->vkGetImageSubresourceLayout2KHR = vkGetImageSubresourceLayout2KHR;
+  pTable->vkGetRenderingAreaGranularityKHR = vkGetRenderingAreaGranularityKHR;
+#endif /* defined(VK_KHR_maintenance5) */
+#if defined(VK_KHR_maintenance6)
+  pTable->vkCmdBindDescriptorSets2KHR = vkCmdBindDescriptorSets2KHR;
+  pTable->vkCmdPushConstants2KHR = vkCmdPushConstants2KHR;
+#endif /* defined(VK_KHR_maintenance6) */
+#if defined(VK_KHR_maintenance6) && defined(VK_KHR_push_descriptor)
+  pTable->vkCmdPushDescriptorSet2KHR = vkCmdPushDescriptorSet2KHR;
+  pTable->vkCmdPushDescriptorSetWithTemplate2KHR = vkCmdPushDescriptorSetWithTemplate2KHR;
+#endif /* defined(VK_KHR_maintenance6) && defined(VK_KHR_push_descriptor) */
+#if defined(VK_KHR_maintenance6) && defined(VK_EXT_descriptor_buffer)
+  pTable->vkCmdBindDescriptorBufferEmbeddedSamplers2EXT = vkCmdBindDescriptorBufferEmbeddedSamplers2EXT;
+  pTable->vkCmdSetDescriptorBufferOffsets2EXT = vkCmdSetDescriptorBufferOffsets2EXT;
+#endif /* defined(VK_KHR_maintenance6) && defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_KHR_map_memory2)
+  pTable->vkMapMemory2KHR = vkMapMemory2KHR;
+  pTable->vkUnmapMemory2KHR = vkUnmapMemory2KHR;
+#endif /* defined(VK_KHR_map_memory2) */
+#if defined(VK_KHR_performance_query)
+  pTable->vkAcquireProfilingLockKHR = vkAcquireProfilingLockKHR;
+  pTable->vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+  pTable->vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+  pTable->vkReleaseProfilingLockKHR = vkReleaseProfilingLockKHR;
+#endif /* defined(VK_KHR_performance_query) */
+#if defined(VK_KHR_pipeline_binary)
+  pTable->vkCreatePipelineBinariesKHR = vkCreatePipelineBinariesKHR;
+  pTable->vkDestroyPipelineBinaryKHR = vkDestroyPipelineBinaryKHR;
+  pTable->vkGetPipelineBinaryDataKHR = vkGetPipelineBinaryDataKHR;
+  pTable->vkGetPipelineKeyKHR = vkGetPipelineKeyKHR;
+  pTable->vkReleaseCapturedPipelineDataKHR = vkReleaseCapturedPipelineDataKHR;
+#endif /* defined(VK_KHR_pipeline_binary) */
+#if defined(VK_KHR_pipeline_executable_properties)
+  pTable->vkGetPipelineExecutableInternalRepresentationsKHR = vkGetPipelineExecutableInternalRepresentationsKHR;
+  pTable->vkGetPipelineExecutablePropertiesKHR = vkGetPipelineExecutablePropertiesKHR;
+  pTable->vkGetPipelineExecutableStatisticsKHR = vkGetPipelineExecutableStatisticsKHR;
+#endif /* defined(VK_KHR_pipeline_executable_properties) */
+#if defined(VK_KHR_present_wait)
+  pTable->vkWaitForPresentKHR = vkWaitForPresentKHR;
+#endif /* defined(VK_KHR_present_wait) */
+#if defined(VK_KHR_present_wait2)
+  pTable->vkWaitForPresent2KHR = vkWaitForPresent2KHR;
+#endif /* defined(VK_KHR_present_wait2) */
+#if defined(VK_KHR_push_descriptor)
+  pTable->vkCmdPushDescriptorSetKHR = vkCmdPushDescriptorSetKHR;
+#endif /* defined(VK_KHR_push_descriptor) */
+#if defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline)
+  pTable->vkCmdTraceRaysIndirect2KHR = vkCmdTraceRaysIndirect2KHR;
+#endif /* defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline) */
+#if defined(VK_KHR_ray_tracing_pipeline)
+  pTable->vkCmdSetRayTracingPipelineStackSizeKHR = vkCmdSetRayTracingPipelineStackSizeKHR;
+  pTable->vkCmdTraceRaysIndirectKHR = vkCmdTraceRaysIndirectKHR;
+  pTable->vkCmdTraceRaysKHR = vkCmdTraceRaysKHR;
+  pTable->vkCreateRayTracingPipelinesKHR = vkCreateRayTracingPipelinesKHR;
+  pTable->vkGetRayTracingCaptureReplayShaderGroupHandlesKHR = vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+  pTable->vkGetRayTracingShaderGroupHandlesKHR = vkGetRayTracingShaderGroupHandlesKHR;
+  pTable->vkGetRayTracingShaderGroupStackSizeKHR = vkGetRayTracingShaderGroupStackSizeKHR;
+#endif /* defined(VK_KHR_ray_tracing_pipeline) */
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+  pTable->vkCreateSamplerYcbcrConversionKHR = vkCreateSamplerYcbcrConversionKHR;
+  pTable->vkDestroySamplerYcbcrConversionKHR = vkDestroySamplerYcbcrConversionKHR;
+#endif /* defined(VK_KHR_sampler_ycbcr_conversion) */
+#if defined(VK_KHR_shared_presentable_image)
+  pTable->vkGetSwapchainStatusKHR = vkGetSwapchainStatusKHR;
+#endif /* defined(VK_KHR_shared_presentable_image) */
+#if defined(VK_KHR_surface)
+  pTable->vkDestroySurfaceKHR = vkDestroySurfaceKHR;
+  pTable->vkGetPhysicalDeviceSurfaceCapabilitiesKHR = vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+  pTable->vkGetPhysicalDeviceSurfaceFormatsKHR = vkGetPhysicalDeviceSurfaceFormatsKHR;
+  pTable->vkGetPhysicalDeviceSurfacePresentModesKHR = vkGetPhysicalDeviceSurfacePresentModesKHR;
+  pTable->vkGetPhysicalDeviceSurfaceSupportKHR = vkGetPhysicalDeviceSurfaceSupportKHR;
+#endif /* defined(VK_KHR_surface) */
+#if defined(VK_KHR_swapchain)
+  pTable->vkAcquireNextImageKHR = vkAcquireNextImageKHR;
+  pTable->vkCreateSwapchainKHR = vkCreateSwapchainKHR;
+  pTable->vkDestroySwapchainKHR = vkDestroySwapchainKHR;
+  pTable->vkGetSwapchainImagesKHR = vkGetSwapchainImagesKHR;
+  pTable->vkQueuePresentKHR = vkQueuePresentKHR;
+#endif /* defined(VK_KHR_swapchain) */
+#if defined(VK_KHR_swapchain_maintenance1)
+  pTable->vkReleaseSwapchainImagesKHR = vkReleaseSwapchainImagesKHR;
+#endif /* defined(VK_KHR_swapchain_maintenance1) */
+#if defined(VK_KHR_synchronization2)
+  pTable->vkCmdPipelineBarrier2KHR = vkCmdPipelineBarrier2KHR;
+  pTable->vkCmdResetEvent2KHR = vkCmdResetEvent2KHR;
+  pTable->vkCmdSetEvent2KHR = vkCmdSetEvent2KHR;
+  pTable->vkCmdWaitEvents2KHR = vkCmdWaitEvents2KHR;
+  pTable->vkCmdWriteTimestamp2KHR = vkCmdWriteTimestamp2KHR;
+  pTable->vkQueueSubmit2KHR = vkQueueSubmit2KHR;
+#endif /* defined(VK_KHR_synchronization2) */
+#if defined(VK_KHR_timeline_semaphore)
+  pTable->vkGetSemaphoreCounterValueKHR = vkGetSemaphoreCounterValueKHR;
+  pTable->vkSignalSemaphoreKHR = vkSignalSemaphoreKHR;
+  pTable->vkWaitSemaphoresKHR = vkWaitSemaphoresKHR;
+#endif /* defined(VK_KHR_timeline_semaphore) */
+#if defined(VK_KHR_video_decode_queue)
+  pTable->vkCmdDecodeVideoKHR = vkCmdDecodeVideoKHR;
+#endif /* defined(VK_KHR_video_decode_queue) */
+#if defined(VK_KHR_video_encode_queue)
+  pTable->vkCmdEncodeVideoKHR = vkCmdEncodeVideoKHR;
+  pTable->vkGetEncodedVideoSessionParametersKHR = vkGetEncodedVideoSessionParametersKHR;
+  pTable->vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR = vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR;
+#endif /* defined(VK_KHR_video_encode_queue) */
+#if defined(VK_KHR_video_queue)
+  pTable->vkBindVideoSessionMemoryKHR = vkBindVideoSessionMemoryKHR;
+  pTable->vkCmdBeginVideoCodingKHR = vkCmdBeginVideoCodingKHR;
+  pTable->vkCmdControlVideoCodingKHR = vkCmdControlVideoCodingKHR;
+  pTable->vkCmdEndVideoCodingKHR = vkCmdEndVideoCodingKHR;
+  pTable->vkCreateVideoSessionKHR = vkCreateVideoSessionKHR;
+  pTable->vkCreateVideoSessionParametersKHR = vkCreateVideoSessionParametersKHR;
+  pTable->vkDestroyVideoSessionKHR = vkDestroyVideoSessionKHR;
+  pTable->vkDestroyVideoSessionParametersKHR = vkDestroyVideoSessionParametersKHR;
+  pTable->vkGetPhysicalDeviceVideoCapabilitiesKHR = vkGetPhysicalDeviceVideoCapabilitiesKHR;
+  pTable->vkGetPhysicalDeviceVideoFormatPropertiesKHR = vkGetPhysicalDeviceVideoFormatPropertiesKHR;
+  pTable->vkGetVideoSessionMemoryRequirementsKHR = vkGetVideoSessionMemoryRequirementsKHR;
+  pTable->vkUpdateVideoSessionParametersKHR = vkUpdateVideoSessionParametersKHR;
+#endif /* defined(VK_KHR_video_queue) */
+#if defined(VK_KHR_wayland_surface)
+  pTable->vkCreateWaylandSurfaceKHR = vkCreateWaylandSurfaceKHR;
+  pTable->vkGetPhysicalDeviceWaylandPresentationSupportKHR = vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+#endif /* defined(VK_KHR_wayland_surface) */
+#if defined(VK_KHR_win32_surface)
+  pTable->vkCreateWin32SurfaceKHR = vkCreateWin32SurfaceKHR;
+  pTable->vkGetPhysicalDeviceWin32PresentationSupportKHR = vkGetPhysicalDeviceWin32PresentationSupportKHR;
+#endif /* defined(VK_KHR_win32_surface) */
+#if defined(VK_KHR_xcb_surface)
+  pTable->vkCreateXcbSurfaceKHR = vkCreateXcbSurfaceKHR;
+  pTable->vkGetPhysicalDeviceXcbPresentationSupportKHR = vkGetPhysicalDeviceXcbPresentationSupportKHR;
+#endif /* defined(VK_KHR_xcb_surface) */
+#if defined(VK_KHR_xlib_surface)
+  pTable->vkCreateXlibSurfaceKHR = vkCreateXlibSurfaceKHR;
+  pTable->vkGetPhysicalDeviceXlibPresentationSupportKHR = vkGetPhysicalDeviceXlibPresentationSupportKHR;
+#endif /* defined(VK_KHR_xlib_surface) */
+#if defined(VK_MVK_ios_surface)
+  pTable->vkCreateIOSSurfaceMVK = vkCreateIOSSurfaceMVK;
+#endif /* defined(VK_MVK_ios_surface) */
+#if defined(VK_MVK_macos_surface)
+  pTable->vkCreateMacOSSurfaceMVK = vkCreateMacOSSurfaceMVK;
+#endif /* defined(VK_MVK_macos_surface) */
+#if defined(VK_NN_vi_surface)
+  pTable->vkCreateViSurfaceNN = vkCreateViSurfaceNN;
+#endif /* defined(VK_NN_vi_surface) */
+#if defined(VK_NVX_binary_import)
+  pTable->vkCmdCuLaunchKernelNVX = vkCmdCuLaunchKernelNVX;
+  pTable->vkCreateCuFunctionNVX = vkCreateCuFunctionNVX;
+  pTable->vkCreateCuModuleNVX = vkCreateCuModuleNVX;
+  pTable->vkDestroyCuFunctionNVX = vkDestroyCuFunctionNVX;
+  pTable->vkDestroyCuModuleNVX = vkDestroyCuModuleNVX;
+#endif /* defined(VK_NVX_binary_import) */
+#if defined(VK_NVX_image_view_handle)
+  pTable->vkGetDeviceCombinedImageSamplerIndexNVX = vkGetDeviceCombinedImageSamplerIndexNVX;
+  pTable->vkGetImageViewAddressNVX = vkGetImageViewAddressNVX;
+  pTable->vkGetImageViewHandle64NVX = vkGetImageViewHandle64NVX;
+  pTable->vkGetImageViewHandleNVX = vkGetImageViewHandleNVX;
+#endif /* defined(VK_NVX_image_view_handle) */
+#if defined(VK_NV_acquire_winrt_display)
+  pTable->vkAcquireWinrtDisplayNV = vkAcquireWinrtDisplayNV;
+  pTable->vkGetWinrtDisplayNV = vkGetWinrtDisplayNV;
+#endif /* defined(VK_NV_acquire_winrt_display) */
+#if defined(VK_NV_clip_space_w_scaling)
+  pTable->vkCmdSetViewportWScalingNV = vkCmdSetViewportWScalingNV;
+#endif /* defined(VK_NV_clip_space_w_scaling) */
+#if defined(VK_NV_cluster_acceleration_structure)
+  pTable->vkCmdBuildClusterAccelerationStructureIndirectNV = vkCmdBuildClusterAccelerationStructureIndirectNV;
+  pTable->vkGetClusterAccelerationStructureBuildSizesNV = vkGetClusterAccelerationStructureBuildSizesNV;
+#endif /* defined(VK_NV_cluster_acceleration_structure) */
+#if defined(VK_NV_compute_occupancy_priority)
+  pTable->vkCmdSetComputeOccupancyPriorityNV = vkCmdSetComputeOccupancyPriorityNV;
+#endif /* defined(VK_NV_compute_occupancy_priority) */
+#if defined(VK_NV_cooperative_matrix)
+  pTable->vkGetPhysicalDeviceCooperativeMatrixPropertiesNV = vkGetPhysicalDeviceCooperativeMatrixPropertiesNV;
+#endif /* defined(VK_NV_cooperative_matrix) */
+#if defined(VK_NV_cooperative_matrix2)
+  pTable->vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV = vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV;
+#endif /* defined(VK_NV_cooperative_matrix2) */
+#if defined(VK_NV_cooperative_vector)
+  pTable->vkCmdConvertCooperativeVectorMatrixNV = vkCmdConvertCooperativeVectorMatrixNV;
+  pTable->vkConvertCooperativeVectorMatrixNV = vkConvertCooperativeVectorMatrixNV;
+  pTable->vkGetPhysicalDeviceCooperativeVectorPropertiesNV = vkGetPhysicalDeviceCooperativeVectorPropertiesNV;
+#endif /* defined(VK_NV_cooperative_vector) */
+#if defined(VK_NV_copy_memory_indirect)
+  pTable->vkCmdCopyMemoryIndirectNV = vkCmdCopyMemoryIndirectNV;
+  pTable->vkCmdCopyMemoryToImageIndirectNV = vkCmdCopyMemoryToImageIndirectNV;
+#endif /* defined(VK_NV_copy_memory_indirect) */
+#if defined(VK_NV_coverage_reduction_mode)
+  pTable->vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+#endif /* defined(VK_NV_coverage_reduction_mode) */
+#if defined(VK_NV_cuda_kernel_launch)
+  pTable->vkCmdCudaLaunchKernelNV = vkCmdCudaLaunchKernelNV;
+  pTable->vkCreateCudaFunctionNV = vkCreateCudaFunctionNV;
+  pTable->vkCreateCudaModuleNV = vkCreateCudaModuleNV;
+  pTable->vkDestroyCudaFunctionNV = vkDestroyCudaFunctionNV;
+  pTable->vkDestroyCudaModuleNV = vkDestroyCudaModuleNV;
+  pTable->vkGetCudaModuleCacheNV = vkGetCudaModuleCacheNV;
+#endif /* defined(VK_NV_cuda_kernel_launch) */
+#if defined(VK_NV_device_diagnostic_checkpoints)
+  pTable->vkCmdSetCheckpointNV = vkCmdSetCheckpointNV;
+  pTable->vkGetQueueCheckpointDataNV = vkGetQueueCheckpointDataNV;
+#endif /* defined(VK_NV_device_diagnostic_checkpoints) */
+#if defined(VK_NV_device_diagnostic_checkpoints) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2))
+  pTable->vkGetQueueCheckpointData2NV = vkGetQueueCheckpointData2NV;
+#endif /* defined(VK_NV_device_diagnostic_checkpoints) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2)) */
+#if defined(VK_NV_device_generated_commands)
+  pTable->vkCmdBindPipelineShaderGroupNV = vkCmdBindPipelineShaderGroupNV;
+  pTable->vkCmdExecuteGeneratedCommandsNV = vkCmdExecuteGeneratedCommandsNV;
+  pTable->vkCmdPreprocessGeneratedCommandsNV = vkCmdPreprocessGeneratedCommandsNV;
+  pTable->vkCreateIndirectCommandsLayoutNV = vkCreateIndirectCommandsLayoutNV;
+  pTable->vkDestroyIndirectCommandsLayoutNV = vkDestroyIndirectCommandsLayoutNV;
+  pTable->vkGetGeneratedCommandsMemoryRequirementsNV = vkGetGeneratedCommandsMemoryRequirementsNV;
+#endif /* defined(VK_NV_device_generated_commands) */
+#if defined(VK_NV_device_generated_commands_compute)
+  pTable->vkCmdUpdatePipelineIndirectBufferNV = vkCmdUpdatePipelineIndirectBufferNV;
+  pTable->vkGetPipelineIndirectDeviceAddressNV = vkGetPipelineIndirectDeviceAddressNV;
+  pTable->vkGetPipelineIndirectMemoryRequirementsNV = vkGetPipelineIndirectMemoryRequirementsNV;
+#endif /* defined(VK_NV_device_generated_commands_compute) */
+#if defined(VK_NV_external_compute_queue)
+  pTable->vkCreateExternalComputeQueueNV = vkCreateExternalComputeQueueNV;
+  pTable->vkDestroyExternalComputeQueueNV = vkDestroyExternalComputeQueueNV;
+  pTable->vkGetExternalComputeQueueDataNV = vkGetExternalComputeQueueDataNV;
+#endif /* defined(VK_NV_external_compute_queue) */
+#if defined(VK_NV_external_memory_capabilities)
+  pTable->vkGetPhysicalDeviceExternalImageFormatPropertiesNV = vkGetPhysicalDeviceExternalImageFormatPropertiesNV;
+#endif /* defined(VK_NV_external_memory_capabilities) */
+#if defined(VK_NV_external_memory_rdma)
+  pTable->vkGetMemoryRemoteAddressNV = vkGetMemoryRemoteAddressNV;
+#endif /* defined(VK_NV_external_memory_rdma) */
+#if defined(VK_NV_external_memory_win32)
+  pTable->vkGetMemoryWin32HandleNV = vkGetMemoryWin32HandleNV;
+#endif /* defined(VK_NV_external_memory_win32) */
+#if defined(VK_NV_fragment_shading_rate_enums)
+  pTable->vkCmdSetFragmentShadingRateEnumNV = vkCmdSetFragmentShadingRateEnumNV;
+#endif /* defined(VK_NV_fragment_shading_rate_enums) */
+#if defined(VK_NV_low_latency2)
+  pTable->vkGetLatencyTimingsNV = vkGetLatencyTimingsNV;
+  pTable->vkLatencySleepNV = vkLatencySleepNV;
+  pTable->vkQueueNotifyOutOfBandNV = vkQueueNotifyOutOfBandNV;
+  pTable->vkSetLatencyMarkerNV = vkSetLatencyMarkerNV;
+  pTable->vkSetLatencySleepModeNV = vkSetLatencySleepModeNV;
+#endif /* defined(VK_NV_low_latency2) */
+#if defined(VK_NV_memory_decompression)
+  pTable->vkCmdDecompressMemoryIndirectCountNV = vkCmdDecompressMemoryIndirectCountNV;
+  pTable->vkCmdDecompressMemoryNV = vkCmdDecompressMemoryNV;
+#endif /* defined(VK_NV_memory_decompression) */
+#if defined(VK_NV_mesh_shader)
+  pTable->vkCmdDrawMeshTasksIndirectNV = vkCmdDrawMeshTasksIndirectNV;
+  pTable->vkCmdDrawMeshTasksNV = vkCmdDrawMeshTasksNV;
+#endif /* defined(VK_NV_mesh_shader) */
+#if defined(VK_NV_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count))
+  pTable->vkCmdDrawMeshTasksIndirectCountNV = vkCmdDrawMeshTasksIndirectCountNV;
+#endif /* defined(VK_NV_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count)) */
+#if defined(VK_NV_optical_flow)
+  pTable->vkBindOpticalFlowSessionImageNV = vkBindOpticalFlowSessionImageNV;
+  pTable->vkCmdOpticalFlowExecuteNV = vkCmdOpticalFlowExecuteNV;
+  pTable->vkCreateOpticalFlowSessionNV = vkCreateOpticalFlowSessionNV;
+  pTable->vkDestroyOpticalFlowSessionNV = vkDestroyOpticalFlowSessionNV;
+  pTable->vkGetPhysicalDeviceOpticalFlowImageFormatsNV = vkGetPhysicalDeviceOpticalFlowImageFormatsNV;
+#endif /* defined(VK_NV_optical_flow) */
+#if defined(VK_NV_partitioned_acceleration_structure)
+  pTable->vkCmdBuildPartitionedAccelerationStructuresNV = vkCmdBuildPartitionedAccelerationStructuresNV;
+  pTable->vkGetPartitionedAccelerationStructuresBuildSizesNV = vkGetPartitionedAccelerationStructuresBuildSizesNV;
+#endif /* defined(VK_NV_partitioned_acceleration_structure) */
+#if defined(VK_NV_ray_tracing)
+  pTable->vkBindAccelerationStructureMemoryNV = vkBindAccelerationStructureMemoryNV;
+  pTable->vkCmdBuildAccelerationStructureNV = vkCmdBuildAccelerationStructureNV;
+  pTable->vkCmdCopyAccelerationStructureNV = vkCmdCopyAccelerationStructureNV;
+  pTable->vkCmdTraceRaysNV = vkCmdTraceRaysNV;
+  pTable->vkCmdWriteAccelerationStructuresPropertiesNV = vkCmdWriteAccelerationStructuresPropertiesNV;
+  pTable->vkCompileDeferredNV = vkCompileDeferredNV;
+  pTable->vkCreateAccelerationStructureNV = vkCreateAccelerationStructureNV;
+  pTable->vkCreateRayTracingPipelinesNV = vkCreateRayTracingPipelinesNV;
+  pTable->vkDestroyAccelerationStructureNV = vkDestroyAccelerationStructureNV;
+  pTable->vkGetAccelerationStructureHandleNV = vkGetAccelerationStructureHandleNV;
+  pTable->vkGetAccelerationStructureMemoryRequirementsNV = vkGetAccelerationStructureMemoryRequirementsNV;
+  pTable->vkGetRayTracingShaderGroupHandlesNV = vkGetRayTracingShaderGroupHandlesNV;
+#endif /* defined(VK_NV_ray_tracing) */
+#if defined(VK_NV_scissor_exclusive) && VK_NV_SCISSOR_EXCLUSIVE_SPEC_VERSION >= 2
+  pTable->vkCmdSetExclusiveScissorEnableNV = vkCmdSetExclusiveScissorEnableNV;
+#endif /* defined(VK_NV_scissor_exclusive) && VK_NV_SCISSOR_EXCLUSIVE_SPEC_VERSION >= 2 */
+#if defined(VK_NV_scissor_exclusive)
+  pTable->vkCmdSetExclusiveScissorNV = vkCmdSetExclusiveScissorNV;
+#endif /* defined(VK_NV_scissor_exclusive) */
+#if defined(VK_NV_shading_rate_image)
+  pTable->vkCmdBindShadingRateImageNV = vkCmdBindShadingRateImageNV;
+  pTable->vkCmdSetCoarseSampleOrderNV = vkCmdSetCoarseSampleOrderNV;
+  pTable->vkCmdSetViewportShadingRatePaletteNV = vkCmdSetViewportShadingRatePaletteNV;
+#endif /* defined(VK_NV_shading_rate_image) */
+#if defined(VK_OHOS_external_memory)
+  pTable->vkGetMemoryNativeBufferOHOS = vkGetMemoryNativeBufferOHOS;
+  pTable->vkGetNativeBufferPropertiesOHOS = vkGetNativeBufferPropertiesOHOS;
+#endif /* defined(VK_OHOS_external_memory) */
+#if defined(VK_OHOS_surface)
+  pTable->vkCreateSurfaceOHOS = vkCreateSurfaceOHOS;
+#endif /* defined(VK_OHOS_surface) */
+#if defined(VK_QCOM_tile_memory_heap)
+  pTable->vkCmdBindTileMemoryQCOM = vkCmdBindTileMemoryQCOM;
+#endif /* defined(VK_QCOM_tile_memory_heap) */
+#if defined(VK_QCOM_tile_properties)
+  pTable->vkGetDynamicRenderingTilePropertiesQCOM = vkGetDynamicRenderingTilePropertiesQCOM;
+  pTable->vkGetFramebufferTilePropertiesQCOM = vkGetFramebufferTilePropertiesQCOM;
+#endif /* defined(VK_QCOM_tile_properties) */
+#if defined(VK_QCOM_tile_shading)
+  pTable->vkCmdBeginPerTileExecutionQCOM = vkCmdBeginPerTileExecutionQCOM;
+  pTable->vkCmdDispatchTileQCOM = vkCmdDispatchTileQCOM;
+  pTable->vkCmdEndPerTileExecutionQCOM = vkCmdEndPerTileExecutionQCOM;
+#endif /* defined(VK_QCOM_tile_shading) */
+#if defined(VK_QNX_external_memory_screen_buffer)
+  pTable->vkGetScreenBufferPropertiesQNX = vkGetScreenBufferPropertiesQNX;
+#endif /* defined(VK_QNX_external_memory_screen_buffer) */
+#if defined(VK_QNX_screen_surface)
+  pTable->vkCreateScreenSurfaceQNX = vkCreateScreenSurfaceQNX;
+  pTable->vkGetPhysicalDeviceScreenPresentationSupportQNX = vkGetPhysicalDeviceScreenPresentationSupportQNX;
+#endif /* defined(VK_QNX_screen_surface) */
+#if defined(VK_SEC_ubm_surface)
+  pTable->vkCreateUbmSurfaceSEC = vkCreateUbmSurfaceSEC;
+  pTable->vkGetPhysicalDeviceUbmPresentationSupportSEC = vkGetPhysicalDeviceUbmPresentationSupportSEC;
+#endif /* defined(VK_SEC_ubm_surface) */
+#if defined(VK_VALVE_descriptor_set_host_mapping)
+  pTable->vkGetDescriptorSetHostMappingVALVE = vkGetDescriptorSetHostMappingVALVE;
+  pTable->vkGetDescriptorSetLayoutHostMappingInfoVALVE = vkGetDescriptorSetLayoutHostMappingInfoVALVE;
+#endif /* defined(VK_VALVE_descriptor_set_host_mapping) */
+#if (defined(VK_EXT_depth_clamp_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clamp_control))
+  pTable->vkCmdSetDepthClampRangeEXT = vkCmdSetDepthClampRangeEXT;
+#endif /* (defined(VK_EXT_depth_clamp_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clamp_control)) */
+#if (defined(VK_EXT_extended_dynamic_state)) || (defined(VK_EXT_shader_object))
+  pTable->vkCmdBindVertexBuffers2EXT = vkCmdBindVertexBuffers2EXT;
+  pTable->vkCmdSetCullModeEXT = vkCmdSetCullModeEXT;
+  pTable->vkCmdSetDepthBoundsTestEnableEXT = vkCmdSetDepthBoundsTestEnableEXT;
+  pTable->vkCmdSetDepthCompareOpEXT = vkCmdSetDepthCompareOpEXT;
+  pTable->vkCmdSetDepthTestEnableEXT = vkCmdSetDepthTestEnableEXT;
+  pTable->vkCmdSetDepthWriteEnableEXT = vkCmdSetDepthWriteEnableEXT;
+  pTable->vkCmdSetFrontFaceEXT = vkCmdSetFrontFaceEXT;
+  pTable->vkCmdSetPrimitiveTopologyEXT = vkCmdSetPrimitiveTopologyEXT;
+  pTable->vkCmdSetScissorWithCountEXT = vkCmdSetScissorWithCountEXT;
+  pTable->vkCmdSetStencilOpEXT = vkCmdSetStencilOpEXT;
+  pTable->vkCmdSetStencilTestEnableEXT = vkCmdSetStencilTestEnableEXT;
+  pTable->vkCmdSetViewportWithCountEXT = vkCmdSetViewportWithCountEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state2)) || (defined(VK_EXT_shader_object))
+  pTable->vkCmdSetDepthBiasEnableEXT = vkCmdSetDepthBiasEnableEXT;
+  pTable->vkCmdSetLogicOpEXT = vkCmdSetLogicOpEXT;
+  pTable->vkCmdSetPatchControlPointsEXT = vkCmdSetPatchControlPointsEXT;
+  pTable->vkCmdSetPrimitiveRestartEnableEXT = vkCmdSetPrimitiveRestartEnableEXT;
+  pTable->vkCmdSetRasterizerDiscardEnableEXT = vkCmdSetRasterizerDiscardEnableEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state2)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3)) || (defined(VK_EXT_shader_object))
+  pTable->vkCmdSetAlphaToCoverageEnableEXT = vkCmdSetAlphaToCoverageEnableEXT;
+  pTable->vkCmdSetAlphaToOneEnableEXT = vkCmdSetAlphaToOneEnableEXT;
+  pTable->vkCmdSetColorBlendEnableEXT = vkCmdSetColorBlendEnableEXT;
+  pTable->vkCmdSetColorBlendEquationEXT = vkCmdSetColorBlendEquationEXT;
+  pTable->vkCmdSetColorWriteMaskEXT = vkCmdSetColorWriteMaskEXT;
+  pTable->vkCmdSetDepthClampEnableEXT = vkCmdSetDepthClampEnableEXT;
+  pTable->vkCmdSetLogicOpEnableEXT = vkCmdSetLogicOpEnableEXT;
+  pTable->vkCmdSetPolygonModeEXT = vkCmdSetPolygonModeEXT;
+  pTable->vkCmdSetRasterizationSamplesEXT = vkCmdSetRasterizationSamplesEXT;
+  pTable->vkCmdSetSampleMaskEXT = vkCmdSetSampleMaskEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && (defined(VK_KHR_maintenance2) || defined(VK_VERSION_1_1))) || (defined(VK_EXT_shader_object))
+  pTable->vkCmdSetTessellationDomainOriginEXT = vkCmdSetTessellationDomainOriginEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && (defined(VK_KHR_maintenance2) || defined(VK_VERSION_1_1))) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_transform_feedback)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_transform_feedback))
+  pTable->vkCmdSetRasterizationStreamEXT = vkCmdSetRasterizationStreamEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_transform_feedback)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_transform_feedback)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_conservative_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_conservative_rasterization))
+  pTable->vkCmdSetConservativeRasterizationModeEXT = vkCmdSetConservativeRasterizationModeEXT;
+  pTable->vkCmdSetExtraPrimitiveOverestimationSizeEXT = vkCmdSetExtraPrimitiveOverestimationSizeEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_conservative_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_conservative_rasterization)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_enable)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_enable))
+  pTable->vkCmdSetDepthClipEnableEXT = vkCmdSetDepthClipEnableEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_enable)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_enable)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_sample_locations)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_sample_locations))
+  pTable->vkCmdSetSampleLocationsEnableEXT = vkCmdSetSampleLocationsEnableEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_sample_locations)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_sample_locations)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_blend_operation_advanced)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_blend_operation_advanced))
+  pTable->vkCmdSetColorBlendAdvancedEXT = vkCmdSetColorBlendAdvancedEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_blend_operation_advanced)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_blend_operation_advanced)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_provoking_vertex)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_provoking_vertex))
+  pTable->vkCmdSetProvokingVertexModeEXT = vkCmdSetProvokingVertexModeEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_provoking_vertex)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_provoking_vertex)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_line_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_line_rasterization))
+  pTable->vkCmdSetLineRasterizationModeEXT = vkCmdSetLineRasterizationModeEXT;
+  pTable->vkCmdSetLineStippleEnableEXT = vkCmdSetLineStippleEnableEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_line_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_line_rasterization)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_control))
+  pTable->vkCmdSetDepthClipNegativeOneToOneEXT = vkCmdSetDepthClipNegativeOneToOneEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_control)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_clip_space_w_scaling)) || (defined(VK_EXT_shader_object) && defined(VK_NV_clip_space_w_scaling))
+  pTable->vkCmdSetViewportWScalingEnableNV = vkCmdSetViewportWScalingEnableNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_clip_space_w_scaling)) || (defined(VK_EXT_shader_object) && defined(VK_NV_clip_space_w_scaling)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_viewport_swizzle)) || (defined(VK_EXT_shader_object) && defined(VK_NV_viewport_swizzle))
+  pTable->vkCmdSetViewportSwizzleNV = vkCmdSetViewportSwizzleNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_viewport_swizzle)) || (defined(VK_EXT_shader_object) && defined(VK_NV_viewport_swizzle)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_fragment_coverage_to_color)) || (defined(VK_EXT_shader_object) && defined(VK_NV_fragment_coverage_to_color))
+  pTable->vkCmdSetCoverageToColorEnableNV = vkCmdSetCoverageToColorEnableNV;
+  pTable->vkCmdSetCoverageToColorLocationNV = vkCmdSetCoverageToColorLocationNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_fragment_coverage_to_color)) || (defined(VK_EXT_shader_object) && defined(VK_NV_fragment_coverage_to_color)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) || (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples))
+  pTable->vkCmdSetCoverageModulationModeNV = vkCmdSetCoverageModulationModeNV;
+  pTable->vkCmdSetCoverageModulationTableEnableNV = vkCmdSetCoverageModulationTableEnableNV;
+  pTable->vkCmdSetCoverageModulationTableNV = vkCmdSetCoverageModulationTableNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) || (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_shading_rate_image)) || (defined(VK_EXT_shader_object) && defined(VK_NV_shading_rate_image))
+  pTable->vkCmdSetShadingRateImageEnableNV = vkCmdSetShadingRateImageEnableNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_shading_rate_image)) || (defined(VK_EXT_shader_object) && defined(VK_NV_shading_rate_image)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_representative_fragment_test)) || (defined(VK_EXT_shader_object) && defined(VK_NV_representative_fragment_test))
+  pTable->vkCmdSetRepresentativeFragmentTestEnableNV = vkCmdSetRepresentativeFragmentTestEnableNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_representative_fragment_test)) || (defined(VK_EXT_shader_object) && defined(VK_NV_representative_fragment_test)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_coverage_reduction_mode)) || (defined(VK_EXT_shader_object) && defined(VK_NV_coverage_reduction_mode))
+  pTable->vkCmdSetCoverageReductionModeNV = vkCmdSetCoverageReductionModeNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_coverage_reduction_mode)) || (defined(VK_EXT_shader_object) && defined(VK_NV_coverage_reduction_mode)) */
+#if (defined(VK_EXT_host_image_copy)) || (defined(VK_EXT_image_compression_control))
+  pTable->vkGetImageSubresourceLayout2EXT = vkGetImageSubresourceLayout2EXT;
+#endif /* (defined(VK_EXT_host_image_copy)) || (defined(VK_EXT_image_compression_control)) */
+#if (defined(VK_EXT_shader_object)) || (defined(VK_EXT_vertex_input_dynamic_state))
+  pTable->vkCmdSetVertexInputEXT = vkCmdSetVertexInputEXT;
+#endif /* (defined(VK_EXT_shader_object)) || (defined(VK_EXT_vertex_input_dynamic_state)) */
+#if (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && (defined(VK_VERSION_1_1) || defined(VK_KHR_descriptor_update_template)))
+  pTable->vkCmdPushDescriptorSetWithTemplateKHR = vkCmdPushDescriptorSetWithTemplateKHR;
+#endif /* (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && (defined(VK_VERSION_1_1) || defined(VK_KHR_descriptor_update_template))) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+  pTable->vkGetDeviceGroupPresentCapabilitiesKHR = vkGetDeviceGroupPresentCapabilitiesKHR;
+  pTable->vkGetDeviceGroupSurfacePresentModesKHR = vkGetDeviceGroupSurfacePresentModesKHR;
+  pTable->vkGetPhysicalDevicePresentRectanglesKHR = vkGetPhysicalDevicePresentRectanglesKHR;
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+  pTable->vkAcquireNextImage2KHR = vkAcquireNextImage2KHR;
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+  /* VOLK_CPP_GENERATE_EXPORT_TABLE */
+}
+
+void Volk::genImportTable(const VolkCppTable& table) noexcept {
+  /* VOLK_CPP_GENERATE_IMPORT_TABLE */
+#if defined(VK_BASE_VERSION_1_0)
+  vkAllocateCommandBuffers = table.vkAllocateCommandBuffers;
+  vkAllocateMemory = table.vkAllocateMemory;
+  vkBeginCommandBuffer = table.vkBeginCommandBuffer;
+  vkBindBufferMemory = table.vkBindBufferMemory;
+  vkBindImageMemory = table.vkBindImageMemory;
+  vkCmdBeginQuery = table.vkCmdBeginQuery;
+  vkCmdCopyBuffer = table.vkCmdCopyBuffer;
+  vkCmdCopyBufferToImage = table.vkCmdCopyBufferToImage;
+  vkCmdCopyImage = table.vkCmdCopyImage;
+  vkCmdCopyImageToBuffer = table.vkCmdCopyImageToBuffer;
+  vkCmdCopyQueryPoolResults = table.vkCmdCopyQueryPoolResults;
+  vkCmdEndQuery = table.vkCmdEndQuery;
+  vkCmdExecuteCommands = table.vkCmdExecuteCommands;
+  vkCmdFillBuffer = table.vkCmdFillBuffer;
+  vkCmdPipelineBarrier = table.vkCmdPipelineBarrier;
+  vkCmdResetQueryPool = table.vkCmdResetQueryPool;
+  vkCmdUpdateBuffer = table.vkCmdUpdateBuffer;
+  vkCmdWriteTimestamp = table.vkCmdWriteTimestamp;
+  vkCreateBuffer = table.vkCreateBuffer;
+  vkCreateCommandPool = table.vkCreateCommandPool;
+  vkCreateDevice = table.vkCreateDevice;
+  vkCreateFence = table.vkCreateFence;
+  vkCreateImage = table.vkCreateImage;
+  vkCreateImageView = table.vkCreateImageView;
+  vkCreateInstance = table.vkCreateInstance;
+  vkCreateQueryPool = table.vkCreateQueryPool;
+  vkCreateSemaphore = table.vkCreateSemaphore;
+  vkDestroyBuffer = table.vkDestroyBuffer;
+  vkDestroyCommandPool = table.vkDestroyCommandPool;
+  vkDestroyDevice = table.vkDestroyDevice;
+  vkDestroyFence = table.vkDestroyFence;
+  vkDestroyImage = table.vkDestroyImage;
+  vkDestroyImageView = table.vkDestroyImageView;
+  vkDestroyInstance = table.vkDestroyInstance;
+  vkDestroyQueryPool = table.vkDestroyQueryPool;
+  vkDestroySemaphore = table.vkDestroySemaphore;
+  vkDeviceWaitIdle = table.vkDeviceWaitIdle;
+  vkEndCommandBuffer = table.vkEndCommandBuffer;
+  vkEnumerateDeviceExtensionProperties = table.vkEnumerateDeviceExtensionProperties;
+  vkEnumerateDeviceLayerProperties = table.vkEnumerateDeviceLayerProperties;
+  vkEnumerateInstanceExtensionProperties = table.vkEnumerateInstanceExtensionProperties;
+  vkEnumerateInstanceLayerProperties = table.vkEnumerateInstanceLayerProperties;
+  vkEnumeratePhysicalDevices = table.vkEnumeratePhysicalDevices;
+  vkFlushMappedMemoryRanges = table.vkFlushMappedMemoryRanges;
+  vkFreeCommandBuffers = table.vkFreeCommandBuffers;
+  vkFreeMemory = table.vkFreeMemory;
+  vkGetBufferMemoryRequirements = table.vkGetBufferMemoryRequirements;
+  vkGetDeviceMemoryCommitment = table.vkGetDeviceMemoryCommitment;
+  vkGetDeviceProcAddr = table.vkGetDeviceProcAddr;
+  vkGetDeviceQueue = table.vkGetDeviceQueue;
+  vkGetFenceStatus = table.vkGetFenceStatus;
+  vkGetImageMemoryRequirements = table.vkGetImageMemoryRequirements;
+  vkGetImageSparseMemoryRequirements = table.vkGetImageSparseMemoryRequirements;
+  vkGetImageSubresourceLayout = table.vkGetImageSubresourceLayout;
+  vkGetInstanceProcAddr = table.vkGetInstanceProcAddr;
+  vkGetPhysicalDeviceFeatures = table.vkGetPhysicalDeviceFeatures;
+  vkGetPhysicalDeviceFormatProperties = table.vkGetPhysicalDeviceFormatProperties;
+  vkGetPhysicalDeviceImageFormatProperties = table.vkGetPhysicalDeviceImageFormatProperties;
+  vkGetPhysicalDeviceMemoryProperties = table.vkGetPhysicalDeviceMemoryProperties;
+  vkGetPhysicalDeviceProperties = table.vkGetPhysicalDeviceProperties;
+  vkGetPhysicalDeviceQueueFamilyProperties = table.vkGetPhysicalDeviceQueueFamilyProperties;
+  vkGetPhysicalDeviceSparseImageFormatProperties = table.vkGetPhysicalDeviceSparseImageFormatProperties;
+  vkGetQueryPoolResults = table.vkGetQueryPoolResults;
+  vkInvalidateMappedMemoryRanges = table.vkInvalidateMappedMemoryRanges;
+  vkMapMemory = table.vkMapMemory;
+  vkQueueBindSparse = table.vkQueueBindSparse;
+  vkQueueSubmit = table.vkQueueSubmit;
+  vkQueueWaitIdle = table.vkQueueWaitIdle;
+  vkResetCommandBuffer = table.vkResetCommandBuffer;
+  vkResetCommandPool = table.vkResetCommandPool;
+  vkResetFences = table.vkResetFences;
+  vkUnmapMemory = table.vkUnmapMemory;
+  vkWaitForFences = table.vkWaitForFences;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+  vkAllocateDescriptorSets = table.vkAllocateDescriptorSets;
+  vkCmdBindDescriptorSets = table.vkCmdBindDescriptorSets;
+  vkCmdBindPipeline = table.vkCmdBindPipeline;
+  vkCmdClearColorImage = table.vkCmdClearColorImage;
+  vkCmdDispatch = table.vkCmdDispatch;
+  vkCmdDispatchIndirect = table.vkCmdDispatchIndirect;
+  vkCmdPushConstants = table.vkCmdPushConstants;
+  vkCmdResetEvent = table.vkCmdResetEvent;
+  vkCmdSetEvent = table.vkCmdSetEvent;
+  vkCmdWaitEvents = table.vkCmdWaitEvents;
+  vkCreateBufferView = table.vkCreateBufferView;
+  vkCreateComputePipelines = table.vkCreateComputePipelines;
+  vkCreateDescriptorPool = table.vkCreateDescriptorPool;
+  vkCreateDescriptorSetLayout = table.vkCreateDescriptorSetLayout;
+  vkCreateEvent = table.vkCreateEvent;
+  vkCreatePipelineCache = table.vkCreatePipelineCache;
+  vkCreatePipelineLayout = table.vkCreatePipelineLayout;
+  vkCreateSampler = table.vkCreateSampler;
+  vkCreateShaderModule = table.vkCreateShaderModule;
+  vkDestroyBufferView = table.vkDestroyBufferView;
+  vkDestroyDescriptorPool = table.vkDestroyDescriptorPool;
+  vkDestroyDescriptorSetLayout = table.vkDestroyDescriptorSetLayout;
+  vkDestroyEvent = table.vkDestroyEvent;
+  vkDestroyPipeline = table.vkDestroyPipeline;
+  vkDestroyPipelineCache = table.vkDestroyPipelineCache;
+  vkDestroyPipelineLayout = table.vkDestroyPipelineLayout;
+  vkDestroySampler = table.vkDestroySampler;
+  vkDestroyShaderModule = table.vkDestroyShaderModule;
+  vkFreeDescriptorSets = table.vkFreeDescriptorSets;
+  vkGetEventStatus = table.vkGetEventStatus;
+  vkGetPipelineCacheData = table.vkGetPipelineCacheData;
+  vkMergePipelineCaches = table.vkMergePipelineCaches;
+  vkResetDescriptorPool = table.vkResetDescriptorPool;
+  vkResetEvent = table.vkResetEvent;
+  vkSetEvent = table.vkSetEvent;
+  vkUpdateDescriptorSets = table.vkUpdateDescriptorSets;
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  vkCmdBeginRenderPass = table.vkCmdBeginRenderPass;
+  vkCmdBindIndexBuffer = table.vkCmdBindIndexBuffer;
+  vkCmdBindVertexBuffers = table.vkCmdBindVertexBuffers;
+  vkCmdBlitImage = table.vkCmdBlitImage;
+  vkCmdClearAttachments = table.vkCmdClearAttachments;
+  vkCmdClearDepthStencilImage = table.vkCmdClearDepthStencilImage;
+  vkCmdDraw = table.vkCmdDraw;
+  vkCmdDrawIndexed = table.vkCmdDrawIndexed;
+  vkCmdDrawIndexedIndirect = table.vkCmdDrawIndexedIndirect;
+  vkCmdDrawIndirect = table.vkCmdDrawIndirect;
+  vkCmdEndRenderPass = table.vkCmdEndRenderPass;
+  vkCmdNextSubpass = table.vkCmdNextSubpass;
+  vkCmdResolveImage = table.vkCmdResolveImage;
+  vkCmdSetBlendConstants = table.vkCmdSetBlendConstants;
+  vkCmdSetDepthBias = table.vkCmdSetDepthBias;
+  vkCmdSetDepthBounds = table.vkCmdSetDepthBounds;
+  vkCmdSetLineWidth = table.vkCmdSetLineWidth;
+  vkCmdSetScissor = table.vkCmdSetScissor;
+  vkCmdSetStencilCompareMask = table.vkCmdSetStencilCompareMask;
+  vkCmdSetStencilReference = table.vkCmdSetStencilReference;
+  vkCmdSetStencilWriteMask = table.vkCmdSetStencilWriteMask;
+  vkCmdSetViewport = table.vkCmdSetViewport;
+  vkCreateFramebuffer = table.vkCreateFramebuffer;
+  vkCreateGraphicsPipelines = table.vkCreateGraphicsPipelines;
+  vkCreateRenderPass = table.vkCreateRenderPass;
+  vkDestroyFramebuffer = table.vkDestroyFramebuffer;
+  vkDestroyRenderPass = table.vkDestroyRenderPass;
+  vkGetRenderAreaGranularity = table.vkGetRenderAreaGranularity;
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_BASE_VERSION_1_1)
+  vkBindBufferMemory2 = table.vkBindBufferMemory2;
+  vkBindImageMemory2 = table.vkBindImageMemory2;
+  vkCmdSetDeviceMask = table.vkCmdSetDeviceMask;
+  vkEnumerateInstanceVersion = table.vkEnumerateInstanceVersion;
+  vkEnumeratePhysicalDeviceGroups = table.vkEnumeratePhysicalDeviceGroups;
+  vkGetBufferMemoryRequirements2 = table.vkGetBufferMemoryRequirements2;
+  vkGetDeviceGroupPeerMemoryFeatures = table.vkGetDeviceGroupPeerMemoryFeatures;
+  vkGetDeviceQueue2 = table.vkGetDeviceQueue2;
+  vkGetImageMemoryRequirements2 = table.vkGetImageMemoryRequirements2;
+  vkGetImageSparseMemoryRequirements2 = table.vkGetImageSparseMemoryRequirements2;
+  vkGetPhysicalDeviceExternalBufferProperties = table.vkGetPhysicalDeviceExternalBufferProperties;
+  vkGetPhysicalDeviceExternalFenceProperties = table.vkGetPhysicalDeviceExternalFenceProperties;
+  vkGetPhysicalDeviceExternalSemaphoreProperties = table.vkGetPhysicalDeviceExternalSemaphoreProperties;
+  vkGetPhysicalDeviceFeatures2 = table.vkGetPhysicalDeviceFeatures2;
+  vkGetPhysicalDeviceFormatProperties2 = table.vkGetPhysicalDeviceFormatProperties2;
+  vkGetPhysicalDeviceImageFormatProperties2 = table.vkGetPhysicalDeviceImageFormatProperties2;
+  vkGetPhysicalDeviceMemoryProperties2 = table.vkGetPhysicalDeviceMemoryProperties2;
+  vkGetPhysicalDeviceProperties2 = table.vkGetPhysicalDeviceProperties2;
+  vkGetPhysicalDeviceQueueFamilyProperties2 = table.vkGetPhysicalDeviceQueueFamilyProperties2;
+  vkGetPhysicalDeviceSparseImageFormatProperties2 = table.vkGetPhysicalDeviceSparseImageFormatProperties2;
+  vkTrimCommandPool = table.vkTrimCommandPool;
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+  vkCmdDispatchBase = table.vkCmdDispatchBase;
+  vkCreateDescriptorUpdateTemplate = table.vkCreateDescriptorUpdateTemplate;
+  vkCreateSamplerYcbcrConversion = table.vkCreateSamplerYcbcrConversion;
+  vkDestroyDescriptorUpdateTemplate = table.vkDestroyDescriptorUpdateTemplate;
+  vkDestroySamplerYcbcrConversion = table.vkDestroySamplerYcbcrConversion;
+  vkGetDescriptorSetLayoutSupport = table.vkGetDescriptorSetLayoutSupport;
+  vkUpdateDescriptorSetWithTemplate = table.vkUpdateDescriptorSetWithTemplate;
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_BASE_VERSION_1_2)
+  vkGetBufferDeviceAddress = table.vkGetBufferDeviceAddress;
+  vkGetBufferOpaqueCaptureAddress = table.vkGetBufferOpaqueCaptureAddress;
+  vkGetDeviceMemoryOpaqueCaptureAddress = table.vkGetDeviceMemoryOpaqueCaptureAddress;
+  vkGetSemaphoreCounterValue = table.vkGetSemaphoreCounterValue;
+  vkResetQueryPool = table.vkResetQueryPool;
+  vkSignalSemaphore = table.vkSignalSemaphore;
+  vkWaitSemaphores = table.vkWaitSemaphores;
+#endif /* defined(VK_BASE_VERSION_1_2) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  vkCmdBeginRenderPass2 = table.vkCmdBeginRenderPass2;
+  vkCmdDrawIndexedIndirectCount = table.vkCmdDrawIndexedIndirectCount;
+  vkCmdDrawIndirectCount = table.vkCmdDrawIndirectCount;
+  vkCmdEndRenderPass2 = table.vkCmdEndRenderPass2;
+  vkCmdNextSubpass2 = table.vkCmdNextSubpass2;
+  vkCreateRenderPass2 = table.vkCreateRenderPass2;
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+  vkCmdCopyBuffer2 = table.vkCmdCopyBuffer2;
+  vkCmdCopyBufferToImage2 = table.vkCmdCopyBufferToImage2;
+  vkCmdCopyImage2 = table.vkCmdCopyImage2;
+  vkCmdCopyImageToBuffer2 = table.vkCmdCopyImageToBuffer2;
+  vkCmdPipelineBarrier2 = table.vkCmdPipelineBarrier2;
+  vkCmdWriteTimestamp2 = table.vkCmdWriteTimestamp2;
+  vkCreatePrivateDataSlot = table.vkCreatePrivateDataSlot;
+  vkDestroyPrivateDataSlot = table.vkDestroyPrivateDataSlot;
+  vkGetDeviceBufferMemoryRequirements = table.vkGetDeviceBufferMemoryRequirements;
+  vkGetDeviceImageMemoryRequirements = table.vkGetDeviceImageMemoryRequirements;
+  vkGetDeviceImageSparseMemoryRequirements = table.vkGetDeviceImageSparseMemoryRequirements;
+  vkGetPhysicalDeviceToolProperties = table.vkGetPhysicalDeviceToolProperties;
+  vkGetPrivateData = table.vkGetPrivateData;
+  vkQueueSubmit2 = table.vkQueueSubmit2;
+  vkSetPrivateData = table.vkSetPrivateData;
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_3)
+  vkCmdResetEvent2 = table.vkCmdResetEvent2;
+  vkCmdSetEvent2 = table.vkCmdSetEvent2;
+  vkCmdWaitEvents2 = table.vkCmdWaitEvents2;
+#endif /* defined(VK_COMPUTE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+  vkCmdBeginRendering = table.vkCmdBeginRendering;
+  vkCmdBindVertexBuffers2 = table.vkCmdBindVertexBuffers2;
+  vkCmdBlitImage2 = table.vkCmdBlitImage2;
+  vkCmdEndRendering = table.vkCmdEndRendering;
+  vkCmdResolveImage2 = table.vkCmdResolveImage2;
+  vkCmdSetCullMode = table.vkCmdSetCullMode;
+  vkCmdSetDepthBiasEnable = table.vkCmdSetDepthBiasEnable;
+  vkCmdSetDepthBoundsTestEnable = table.vkCmdSetDepthBoundsTestEnable;
+  vkCmdSetDepthCompareOp = table.vkCmdSetDepthCompareOp;
+  vkCmdSetDepthTestEnable = table.vkCmdSetDepthTestEnable;
+  vkCmdSetDepthWriteEnable = table.vkCmdSetDepthWriteEnable;
+  vkCmdSetFrontFace = table.vkCmdSetFrontFace;
+  vkCmdSetPrimitiveRestartEnable = table.vkCmdSetPrimitiveRestartEnable;
+  vkCmdSetPrimitiveTopology = table.vkCmdSetPrimitiveTopology;
+  vkCmdSetRasterizerDiscardEnable = table.vkCmdSetRasterizerDiscardEnable;
+  vkCmdSetScissorWithCount = table.vkCmdSetScissorWithCount;
+  vkCmdSetStencilOp = table.vkCmdSetStencilOp;
+  vkCmdSetStencilTestEnable = table.vkCmdSetStencilTestEnable;
+  vkCmdSetViewportWithCount = table.vkCmdSetViewportWithCount;
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_BASE_VERSION_1_4)
+  vkCopyImageToImage = table.vkCopyImageToImage;
+  vkCopyImageToMemory = table.vkCopyImageToMemory;
+  vkCopyMemoryToImage = table.vkCopyMemoryToImage;
+  vkGetDeviceImageSubresourceLayout = table.vkGetDeviceImageSubresourceLayout;
+  vkGetImageSubresourceLayout2 = table.vkGetImageSubresourceLayout2;
+  vkMapMemory2 = table.vkMapMemory2;
+  vkTransitionImageLayout = table.vkTransitionImageLayout;
+  vkUnmapMemory2 = table.vkUnmapMemory2;
+#endif /* defined(VK_BASE_VERSION_1_4) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+  vkCmdBindDescriptorSets2 = table.vkCmdBindDescriptorSets2;
+  vkCmdPushConstants2 = table.vkCmdPushConstants2;
+  vkCmdPushDescriptorSet = table.vkCmdPushDescriptorSet;
+  vkCmdPushDescriptorSet2 = table.vkCmdPushDescriptorSet2;
+  vkCmdPushDescriptorSetWithTemplate = table.vkCmdPushDescriptorSetWithTemplate;
+  vkCmdPushDescriptorSetWithTemplate2 = table.vkCmdPushDescriptorSetWithTemplate2;
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+  vkCmdBindIndexBuffer2 = table.vkCmdBindIndexBuffer2;
+  vkCmdSetLineStipple = table.vkCmdSetLineStipple;
+  vkCmdSetRenderingAttachmentLocations = table.vkCmdSetRenderingAttachmentLocations;
+  vkCmdSetRenderingInputAttachmentIndices = table.vkCmdSetRenderingInputAttachmentIndices;
+  vkGetRenderingAreaGranularity = table.vkGetRenderingAreaGranularity;
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+#if defined(VK_AMDX_shader_enqueue)
+  vkCmdDispatchGraphAMDX = table.vkCmdDispatchGraphAMDX;
+  vkCmdDispatchGraphIndirectAMDX = table.vkCmdDispatchGraphIndirectAMDX;
+  vkCmdDispatchGraphIndirectCountAMDX = table.vkCmdDispatchGraphIndirectCountAMDX;
+  vkCmdInitializeGraphScratchMemoryAMDX = table.vkCmdInitializeGraphScratchMemoryAMDX;
+  vkCreateExecutionGraphPipelinesAMDX = table.vkCreateExecutionGraphPipelinesAMDX;
+  vkGetExecutionGraphPipelineNodeIndexAMDX = table.vkGetExecutionGraphPipelineNodeIndexAMDX;
+  vkGetExecutionGraphPipelineScratchSizeAMDX = table.vkGetExecutionGraphPipelineScratchSizeAMDX;
+#endif /* defined(VK_AMDX_shader_enqueue) */
+#if defined(VK_AMD_anti_lag)
+  vkAntiLagUpdateAMD = table.vkAntiLagUpdateAMD;
+#endif /* defined(VK_AMD_anti_lag) */
+#if defined(VK_AMD_buffer_marker)
+  vkCmdWriteBufferMarkerAMD = table.vkCmdWriteBufferMarkerAMD;
+#endif /* defined(VK_AMD_buffer_marker) */
+#if defined(VK_AMD_buffer_marker) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2))
+  vkCmdWriteBufferMarker2AMD = table.vkCmdWriteBufferMarker2AMD;
+#endif /* defined(VK_AMD_buffer_marker) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2)) */
+#if defined(VK_AMD_display_native_hdr)
+  vkSetLocalDimmingAMD = table.vkSetLocalDimmingAMD;
+#endif /* defined(VK_AMD_display_native_hdr) */
+#if defined(VK_AMD_draw_indirect_count)
+  vkCmdDrawIndexedIndirectCountAMD = table.vkCmdDrawIndexedIndirectCountAMD;
+  vkCmdDrawIndirectCountAMD = table.vkCmdDrawIndirectCountAMD;
+#endif /* defined(VK_AMD_draw_indirect_count) */
+#if defined(VK_AMD_shader_info)
+  vkGetShaderInfoAMD = table.vkGetShaderInfoAMD;
+#endif /* defined(VK_AMD_shader_info) */
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+  vkGetAndroidHardwareBufferPropertiesANDROID = table.vkGetAndroidHardwareBufferPropertiesANDROID;
+  vkGetMemoryAndroidHardwareBufferANDROID = table.vkGetMemoryAndroidHardwareBufferANDROID;
+#endif /* defined(VK_ANDROID_external_memory_android_hardware_buffer) */
+#if defined(VK_ARM_data_graph)
+  vkBindDataGraphPipelineSessionMemoryARM = table.vkBindDataGraphPipelineSessionMemoryARM;
+  vkCmdDispatchDataGraphARM = table.vkCmdDispatchDataGraphARM;
+  vkCreateDataGraphPipelineSessionARM = table.vkCreateDataGraphPipelineSessionARM;
+  vkCreateDataGraphPipelinesARM = table.vkCreateDataGraphPipelinesARM;
+  vkDestroyDataGraphPipelineSessionARM = table.vkDestroyDataGraphPipelineSessionARM;
+  vkGetDataGraphPipelineAvailablePropertiesARM = table.vkGetDataGraphPipelineAvailablePropertiesARM;
+  vkGetDataGraphPipelinePropertiesARM = table.vkGetDataGraphPipelinePropertiesARM;
+  vkGetDataGraphPipelineSessionBindPointRequirementsARM = table.vkGetDataGraphPipelineSessionBindPointRequirementsARM;
+  vkGetDataGraphPipelineSessionMemoryRequirementsARM = table.vkGetDataGraphPipelineSessionMemoryRequirementsARM;
+  vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM = table.vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM;
+  vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM = table.vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM;
+#endif /* defined(VK_ARM_data_graph) */
+#if defined(VK_ARM_performance_counters_by_region)
+  vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM = table.vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM;
+#endif /* defined(VK_ARM_performance_counters_by_region) */
+#if defined(VK_ARM_tensors)
+  vkBindTensorMemoryARM = table.vkBindTensorMemoryARM;
+  vkCmdCopyTensorARM = table.vkCmdCopyTensorARM;
+  vkCreateTensorARM = table.vkCreateTensorARM;
+  vkCreateTensorViewARM = table.vkCreateTensorViewARM;
+  vkDestroyTensorARM = table.vkDestroyTensorARM;
+  vkDestroyTensorViewARM = table.vkDestroyTensorViewARM;
+  vkGetDeviceTensorMemoryRequirementsARM = table.vkGetDeviceTensorMemoryRequirementsARM;
+  vkGetPhysicalDeviceExternalTensorPropertiesARM = table.vkGetPhysicalDeviceExternalTensorPropertiesARM;
+  vkGetTensorMemoryRequirementsARM = table.vkGetTensorMemoryRequirementsARM;
+#endif /* defined(VK_ARM_tensors) */
+#if defined(VK_ARM_tensors) && defined(VK_EXT_descriptor_buffer)
+  vkGetTensorOpaqueCaptureDescriptorDataARM = table.vkGetTensorOpaqueCaptureDescriptorDataARM;
+  vkGetTensorViewOpaqueCaptureDescriptorDataARM = table.vkGetTensorViewOpaqueCaptureDescriptorDataARM;
+#endif /* defined(VK_ARM_tensors) && defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_EXT_acquire_drm_display)
+  vkAcquireDrmDisplayEXT = table.vkAcquireDrmDisplayEXT;
+  vkGetDrmDisplayEXT = table.vkGetDrmDisplayEXT;
+#endif /* defined(VK_EXT_acquire_drm_display) */
+#if defined(VK_EXT_acquire_xlib_display)
+  vkAcquireXlibDisplayEXT = table.vkAcquireXlibDisplayEXT;
+  vkGetRandROutputDisplayEXT = table.vkGetRandROutputDisplayEXT;
+#endif /* defined(VK_EXT_acquire_xlib_display) */
+#if defined(VK_EXT_attachment_feedback_loop_dynamic_state)
+  vkCmdSetAttachmentFeedbackLoopEnableEXT = table.vkCmdSetAttachmentFeedbackLoopEnableEXT;
+#endif /* defined(VK_EXT_attachment_feedback_loop_dynamic_state) */
+#if defined(VK_EXT_buffer_device_address)
+  vkGetBufferDeviceAddressEXT = table.vkGetBufferDeviceAddressEXT;
+#endif /* defined(VK_EXT_buffer_device_address) */
+#if defined(VK_EXT_calibrated_timestamps)
+  vkGetCalibratedTimestampsEXT = table.vkGetCalibratedTimestampsEXT;
+  vkGetPhysicalDeviceCalibrateableTimeDomainsEXT = table.vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+#endif /* defined(VK_EXT_calibrated_timestamps) */
+#if defined(VK_EXT_color_write_enable)
+  vkCmdSetColorWriteEnableEXT = table.vkCmdSetColorWriteEnableEXT;
+#endif /* defined(VK_EXT_color_write_enable) */
+#if defined(VK_EXT_conditional_rendering)
+  vkCmdBeginConditionalRenderingEXT = table.vkCmdBeginConditionalRenderingEXT;
+  vkCmdEndConditionalRenderingEXT = table.vkCmdEndConditionalRenderingEXT;
+#endif /* defined(VK_EXT_conditional_rendering) */
+#if defined(VK_EXT_custom_resolve) && (defined(VK_KHR_dynamic_rendering) || defined(VK_VERSION_1_3))
+  vkCmdBeginCustomResolveEXT = table.vkCmdBeginCustomResolveEXT;
+#endif /* defined(VK_EXT_custom_resolve) && (defined(VK_KHR_dynamic_rendering) || defined(VK_VERSION_1_3)) */
+#if defined(VK_EXT_debug_marker)
+  vkCmdDebugMarkerBeginEXT = table.vkCmdDebugMarkerBeginEXT;
+  vkCmdDebugMarkerEndEXT = table.vkCmdDebugMarkerEndEXT;
+  vkCmdDebugMarkerInsertEXT = table.vkCmdDebugMarkerInsertEXT;
+  vkDebugMarkerSetObjectNameEXT = table.vkDebugMarkerSetObjectNameEXT;
+  vkDebugMarkerSetObjectTagEXT = table.vkDebugMarkerSetObjectTagEXT;
+#endif /* defined(VK_EXT_debug_marker) */
+#if defined(VK_EXT_debug_report)
+  vkCreateDebugReportCallbackEXT = table.vkCreateDebugReportCallbackEXT;
+  vkDebugReportMessageEXT = table.vkDebugReportMessageEXT;
+  vkDestroyDebugReportCallbackEXT = table.vkDestroyDebugReportCallbackEXT;
+#endif /* defined(VK_EXT_debug_report) */
+#if defined(VK_EXT_debug_utils)
+  vkCmdBeginDebugUtilsLabelEXT = table.vkCmdBeginDebugUtilsLabelEXT;
+  vkCmdEndDebugUtilsLabelEXT = table.vkCmdEndDebugUtilsLabelEXT;
+  vkCmdInsertDebugUtilsLabelEXT = table.vkCmdInsertDebugUtilsLabelEXT;
+  vkCreateDebugUtilsMessengerEXT = table.vkCreateDebugUtilsMessengerEXT;
+  vkDestroyDebugUtilsMessengerEXT = table.vkDestroyDebugUtilsMessengerEXT;
+  vkQueueBeginDebugUtilsLabelEXT = table.vkQueueBeginDebugUtilsLabelEXT;
+  vkQueueEndDebugUtilsLabelEXT = table.vkQueueEndDebugUtilsLabelEXT;
+  vkQueueInsertDebugUtilsLabelEXT = table.vkQueueInsertDebugUtilsLabelEXT;
+  vkSetDebugUtilsObjectNameEXT = table.vkSetDebugUtilsObjectNameEXT;
+  vkSetDebugUtilsObjectTagEXT = table.vkSetDebugUtilsObjectTagEXT;
+  vkSubmitDebugUtilsMessageEXT = table.vkSubmitDebugUtilsMessageEXT;
+#endif /* defined(VK_EXT_debug_utils) */
+#if defined(VK_EXT_depth_bias_control)
+  vkCmdSetDepthBias2EXT = table.vkCmdSetDepthBias2EXT;
+#endif /* defined(VK_EXT_depth_bias_control) */
+#if defined(VK_EXT_descriptor_buffer)
+  vkCmdBindDescriptorBufferEmbeddedSamplersEXT = table.vkCmdBindDescriptorBufferEmbeddedSamplersEXT;
+  vkCmdBindDescriptorBuffersEXT = table.vkCmdBindDescriptorBuffersEXT;
+  vkCmdSetDescriptorBufferOffsetsEXT = table.vkCmdSetDescriptorBufferOffsetsEXT;
+  vkGetBufferOpaqueCaptureDescriptorDataEXT = table.vkGetBufferOpaqueCaptureDescriptorDataEXT;
+  vkGetDescriptorEXT = table.vkGetDescriptorEXT;
+  vkGetDescriptorSetLayoutBindingOffsetEXT = table.vkGetDescriptorSetLayoutBindingOffsetEXT;
+  vkGetDescriptorSetLayoutSizeEXT = table.vkGetDescriptorSetLayoutSizeEXT;
+  vkGetImageOpaqueCaptureDescriptorDataEXT = table.vkGetImageOpaqueCaptureDescriptorDataEXT;
+  vkGetImageViewOpaqueCaptureDescriptorDataEXT = table.vkGetImageViewOpaqueCaptureDescriptorDataEXT;
+  vkGetSamplerOpaqueCaptureDescriptorDataEXT = table.vkGetSamplerOpaqueCaptureDescriptorDataEXT;
+#endif /* defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_EXT_descriptor_buffer) && (defined(VK_KHR_acceleration_structure) || defined(VK_NV_ray_tracing))
+  vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT = table.vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
+#endif /* defined(VK_EXT_descriptor_buffer) && (defined(VK_KHR_acceleration_structure) || defined(VK_NV_ray_tracing)) */
+#if defined(VK_EXT_descriptor_heap)
+  vkCmdBindResourceHeapEXT = table.vkCmdBindResourceHeapEXT;
+  vkCmdBindSamplerHeapEXT = table.vkCmdBindSamplerHeapEXT;
+  vkCmdPushDataEXT = table.vkCmdPushDataEXT;
+  vkGetImageOpaqueCaptureDataEXT = table.vkGetImageOpaqueCaptureDataEXT;
+  vkGetPhysicalDeviceDescriptorSizeEXT = table.vkGetPhysicalDeviceDescriptorSizeEXT;
+  vkWriteResourceDescriptorsEXT = table.vkWriteResourceDescriptorsEXT;
+  vkWriteSamplerDescriptorsEXT = table.vkWriteSamplerDescriptorsEXT;
+#endif /* defined(VK_EXT_descriptor_heap) */
+#if defined(VK_EXT_descriptor_heap) && defined(VK_EXT_custom_border_color)
+  vkRegisterCustomBorderColorEXT = table.vkRegisterCustomBorderColorEXT;
+  vkUnregisterCustomBorderColorEXT = table.vkUnregisterCustomBorderColorEXT;
+#endif /* defined(VK_EXT_descriptor_heap) && defined(VK_EXT_custom_border_color) */
+#if defined(VK_EXT_descriptor_heap) && defined(VK_ARM_tensors)
+  vkGetTensorOpaqueCaptureDataARM = table.vkGetTensorOpaqueCaptureDataARM;
+#endif /* defined(VK_EXT_descriptor_heap) && defined(VK_ARM_tensors) */
+#if defined(VK_EXT_device_fault)
+  vkGetDeviceFaultInfoEXT = table.vkGetDeviceFaultInfoEXT;
+#endif /* defined(VK_EXT_device_fault) */
+#if defined(VK_EXT_device_generated_commands)
+  vkCmdExecuteGeneratedCommandsEXT = table.vkCmdExecuteGeneratedCommandsEXT;
+  vkCmdPreprocessGeneratedCommandsEXT = table.vkCmdPreprocessGeneratedCommandsEXT;
+  vkCreateIndirectCommandsLayoutEXT = table.vkCreateIndirectCommandsLayoutEXT;
+  vkCreateIndirectExecutionSetEXT = table.vkCreateIndirectExecutionSetEXT;
+  vkDestroyIndirectCommandsLayoutEXT = table.vkDestroyIndirectCommandsLayoutEXT;
+  vkDestroyIndirectExecutionSetEXT = table.vkDestroyIndirectExecutionSetEXT;
+  vkGetGeneratedCommandsMemoryRequirementsEXT = table.vkGetGeneratedCommandsMemoryRequirementsEXT;
+  vkUpdateIndirectExecutionSetPipelineEXT = table.vkUpdateIndirectExecutionSetPipelineEXT;
+  vkUpdateIndirectExecutionSetShaderEXT = table.vkUpdateIndirectExecutionSetShaderEXT;
+#endif /* defined(VK_EXT_device_generated_commands) */
+#if defined(VK_EXT_direct_mode_display)
+  vkReleaseDisplayEXT = table.vkReleaseDisplayEXT;
+#endif /* defined(VK_EXT_direct_mode_display) */
+#if defined(VK_EXT_directfb_surface)
+  vkCreateDirectFBSurfaceEXT = table.vkCreateDirectFBSurfaceEXT;
+  vkGetPhysicalDeviceDirectFBPresentationSupportEXT = table.vkGetPhysicalDeviceDirectFBPresentationSupportEXT;
+#endif /* defined(VK_EXT_directfb_surface) */
+#if defined(VK_EXT_discard_rectangles)
+  vkCmdSetDiscardRectangleEXT = table.vkCmdSetDiscardRectangleEXT;
+#endif /* defined(VK_EXT_discard_rectangles) */
+#if defined(VK_EXT_discard_rectangles) && VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2
+  vkCmdSetDiscardRectangleEnableEXT = table.vkCmdSetDiscardRectangleEnableEXT;
+  vkCmdSetDiscardRectangleModeEXT = table.vkCmdSetDiscardRectangleModeEXT;
+#endif /* defined(VK_EXT_discard_rectangles) && VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2 */
+#if defined(VK_EXT_display_control)
+  vkDisplayPowerControlEXT = table.vkDisplayPowerControlEXT;
+  vkGetSwapchainCounterEXT = table.vkGetSwapchainCounterEXT;
+  vkRegisterDeviceEventEXT = table.vkRegisterDeviceEventEXT;
+  vkRegisterDisplayEventEXT = table.vkRegisterDisplayEventEXT;
+#endif /* defined(VK_EXT_display_control) */
+#if defined(VK_EXT_display_surface_counter)
+  vkGetPhysicalDeviceSurfaceCapabilities2EXT = table.vkGetPhysicalDeviceSurfaceCapabilities2EXT;
+#endif /* defined(VK_EXT_display_surface_counter) */
+#if defined(VK_EXT_external_memory_host)
+  vkGetMemoryHostPointerPropertiesEXT = table.vkGetMemoryHostPointerPropertiesEXT;
+#endif /* defined(VK_EXT_external_memory_host) */
+#if defined(VK_EXT_external_memory_metal)
+  vkGetMemoryMetalHandleEXT = table.vkGetMemoryMetalHandleEXT;
+  vkGetMemoryMetalHandlePropertiesEXT = table.vkGetMemoryMetalHandlePropertiesEXT;
+#endif /* defined(VK_EXT_external_memory_metal) */
+#if defined(VK_EXT_fragment_density_map_offset)
+  vkCmdEndRendering2EXT = table.vkCmdEndRendering2EXT;
+#endif /* defined(VK_EXT_fragment_density_map_offset) */
+#if defined(VK_EXT_full_screen_exclusive)
+  vkAcquireFullScreenExclusiveModeEXT = table.vkAcquireFullScreenExclusiveModeEXT;
+  vkGetPhysicalDeviceSurfacePresentModes2EXT = table.vkGetPhysicalDeviceSurfacePresentModes2EXT;
+  vkReleaseFullScreenExclusiveModeEXT = table.vkReleaseFullScreenExclusiveModeEXT;
+#endif /* defined(VK_EXT_full_screen_exclusive) */
+#if defined(VK_EXT_full_screen_exclusive) && (defined(VK_KHR_device_group) || defined(VK_VERSION_1_1))
+  vkGetDeviceGroupSurfacePresentModes2EXT = table.vkGetDeviceGroupSurfacePresentModes2EXT;
+#endif /* defined(VK_EXT_full_screen_exclusive) && (defined(VK_KHR_device_group) || defined(VK_VERSION_1_1)) */
+#if defined(VK_EXT_hdr_metadata)
+  vkSetHdrMetadataEXT = table.vkSetHdrMetadataEXT;
+#endif /* defined(VK_EXT_hdr_metadata) */
+#if defined(VK_EXT_headless_surface)
+  vkCreateHeadlessSurfaceEXT = table.vkCreateHeadlessSurfaceEXT;
+#endif /* defined(VK_EXT_headless_surface) */
+#if defined(VK_EXT_host_image_copy)
+  vkCopyImageToImageEXT = table.vkCopyImageToImageEXT;
+  vkCopyImageToMemoryEXT = table.vkCopyImageToMemoryEXT;
+  vkCopyMemoryToImageEXT = table.vkCopyMemoryToImageEXT;
+  vkTransitionImageLayoutEXT = table.vkTransitionImageLayoutEXT;
+#endif /* defined(VK_EXT_host_image_copy) */
+#if defined(VK_EXT_host_query_reset)
+  vkResetQueryPoolEXT = table.vkResetQueryPoolEXT;
+#endif /* defined(VK_EXT_host_query_reset) */
+#if defined(VK_EXT_image_drm_format_modifier)
+  vkGetImageDrmFormatModifierPropertiesEXT = table.vkGetImageDrmFormatModifierPropertiesEXT;
+#endif /* defined(VK_EXT_image_drm_format_modifier) */
+#if defined(VK_EXT_line_rasterization)
+  vkCmdSetLineStippleEXT = table.vkCmdSetLineStippleEXT;
+#endif /* defined(VK_EXT_line_rasterization) */
+#if defined(VK_EXT_memory_decompression)
+  vkCmdDecompressMemoryEXT = table.vkCmdDecompressMemoryEXT;
+  vkCmdDecompressMemoryIndirectCountEXT = table.vkCmdDecompressMemoryIndirectCountEXT;
+#endif /* defined(VK_EXT_memory_decompression) */
+#if defined(VK_EXT_mesh_shader)
+  vkCmdDrawMeshTasksEXT = table.vkCmdDrawMeshTasksEXT;
+  vkCmdDrawMeshTasksIndirectEXT = table.vkCmdDrawMeshTasksIndirectEXT;
+#endif /* defined(VK_EXT_mesh_shader) */
+#if defined(VK_EXT_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count))
+  vkCmdDrawMeshTasksIndirectCountEXT = table.vkCmdDrawMeshTasksIndirectCountEXT;
+#endif /* defined(VK_EXT_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count)) */
+#if defined(VK_EXT_metal_objects)
+  vkExportMetalObjectsEXT = table.vkExportMetalObjectsEXT;
+#endif /* defined(VK_EXT_metal_objects) */
+#if defined(VK_EXT_metal_surface)
+  vkCreateMetalSurfaceEXT = table.vkCreateMetalSurfaceEXT;
+#endif /* defined(VK_EXT_metal_surface) */
+#if defined(VK_EXT_multi_draw)
+  vkCmdDrawMultiEXT = table.vkCmdDrawMultiEXT;
+  vkCmdDrawMultiIndexedEXT = table.vkCmdDrawMultiIndexedEXT;
+#endif /* defined(VK_EXT_multi_draw) */
+#if defined(VK_EXT_opacity_micromap)
+  vkBuildMicromapsEXT = table.vkBuildMicromapsEXT;
+  vkCmdBuildMicromapsEXT = table.vkCmdBuildMicromapsEXT;
+  vkCmdCopyMemoryToMicromapEXT = table.vkCmdCopyMemoryToMicromapEXT;
+  vkCmdCopyMicromapEXT = table.vkCmdCopyMicromapEXT;
+  vkCmdCopyMicromapToMemoryEXT = table.vkCmdCopyMicromapToMemoryEXT;
+  vkCmdWriteMicromapsPropertiesEXT = table.vkCmdWriteMicromapsPropertiesEXT;
+  vkCopyMemoryToMicromapEXT = table.vkCopyMemoryToMicromapEXT;
+  vkCopyMicromapEXT = table.vkCopyMicromapEXT;
+  vkCopyMicromapToMemoryEXT = table.vkCopyMicromapToMemoryEXT;
+  vkCreateMicromapEXT = table.vkCreateMicromapEXT;
+  vkDestroyMicromapEXT = table.vkDestroyMicromapEXT;
+  vkGetDeviceMicromapCompatibilityEXT = table.vkGetDeviceMicromapCompatibilityEXT;
+  vkGetMicromapBuildSizesEXT = table.vkGetMicromapBuildSizesEXT;
+  vkWriteMicromapsPropertiesEXT = table.vkWriteMicromapsPropertiesEXT;
+#endif /* defined(VK_EXT_opacity_micromap) */
+#if defined(VK_EXT_pageable_device_local_memory)
+  vkSetDeviceMemoryPriorityEXT = table.vkSetDeviceMemoryPriorityEXT;
+#endif /* defined(VK_EXT_pageable_device_local_memory) */
+#if defined(VK_EXT_pipeline_properties)
+  vkGetPipelinePropertiesEXT = table.vkGetPipelinePropertiesEXT;
+#endif /* defined(VK_EXT_pipeline_properties) */
+#if defined(VK_EXT_present_timing)
+  vkGetPastPresentationTimingEXT = table.vkGetPastPresentationTimingEXT;
+  vkGetSwapchainTimeDomainPropertiesEXT = table.vkGetSwapchainTimeDomainPropertiesEXT;
+  vkGetSwapchainTimingPropertiesEXT = table.vkGetSwapchainTimingPropertiesEXT;
+  vkSetSwapchainPresentTimingQueueSizeEXT = table.vkSetSwapchainPresentTimingQueueSizeEXT;
+#endif /* defined(VK_EXT_present_timing) */
+#if defined(VK_EXT_private_data)
+  vkCreatePrivateDataSlotEXT = table.vkCreatePrivateDataSlotEXT;
+  vkDestroyPrivateDataSlotEXT = table.vkDestroyPrivateDataSlotEXT;
+  vkGetPrivateDataEXT = table.vkGetPrivateDataEXT;
+  vkSetPrivateDataEXT = table.vkSetPrivateDataEXT;
+#endif /* defined(VK_EXT_private_data) */
+#if defined(VK_EXT_sample_locations)
+  vkCmdSetSampleLocationsEXT = table.vkCmdSetSampleLocationsEXT;
+  vkGetPhysicalDeviceMultisamplePropertiesEXT = table.vkGetPhysicalDeviceMultisamplePropertiesEXT;
+#endif /* defined(VK_EXT_sample_locations) */
+#if defined(VK_EXT_shader_module_identifier)
+  vkGetShaderModuleCreateInfoIdentifierEXT = table.vkGetShaderModuleCreateInfoIdentifierEXT;
+  vkGetShaderModuleIdentifierEXT = table.vkGetShaderModuleIdentifierEXT;
+#endif /* defined(VK_EXT_shader_module_identifier) */
+#if defined(VK_EXT_shader_object)
+  vkCmdBindShadersEXT = table.vkCmdBindShadersEXT;
+  vkCreateShadersEXT = table.vkCreateShadersEXT;
+  vkDestroyShaderEXT = table.vkDestroyShaderEXT;
+  vkGetShaderBinaryDataEXT = table.vkGetShaderBinaryDataEXT;
+#endif /* defined(VK_EXT_shader_object) */
+#if defined(VK_EXT_swapchain_maintenance1)
+  vkReleaseSwapchainImagesEXT = table.vkReleaseSwapchainImagesEXT;
+#endif /* defined(VK_EXT_swapchain_maintenance1) */
+#if defined(VK_EXT_tooling_info)
+  vkGetPhysicalDeviceToolPropertiesEXT = table.vkGetPhysicalDeviceToolPropertiesEXT;
+#endif /* defined(VK_EXT_tooling_info) */
+#if defined(VK_EXT_transform_feedback)
+  vkCmdBeginQueryIndexedEXT = table.vkCmdBeginQueryIndexedEXT;
+  vkCmdBeginTransformFeedbackEXT = table.vkCmdBeginTransformFeedbackEXT;
+  vkCmdBindTransformFeedbackBuffersEXT = table.vkCmdBindTransformFeedbackBuffersEXT;
+  vkCmdDrawIndirectByteCountEXT = table.vkCmdDrawIndirectByteCountEXT;
+  vkCmdEndQueryIndexedEXT = table.vkCmdEndQueryIndexedEXT;
+  vkCmdEndTransformFeedbackEXT = table.vkCmdEndTransformFeedbackEXT;
+#endif /* defined(VK_EXT_transform_feedback) */
+#if defined(VK_EXT_validation_cache)
+  vkCreateValidationCacheEXT = table.vkCreateValidationCacheEXT;
+  vkDestroyValidationCacheEXT = table.vkDestroyValidationCacheEXT;
+  vkGetValidationCacheDataEXT = table.vkGetValidationCacheDataEXT;
+  vkMergeValidationCachesEXT = table.vkMergeValidationCachesEXT;
+#endif /* defined(VK_EXT_validation_cache) */
+#if defined(VK_FUCHSIA_buffer_collection)
+  vkCreateBufferCollectionFUCHSIA = table.vkCreateBufferCollectionFUCHSIA;
+  vkDestroyBufferCollectionFUCHSIA = table.vkDestroyBufferCollectionFUCHSIA;
+  vkGetBufferCollectionPropertiesFUCHSIA = table.vkGetBufferCollectionPropertiesFUCHSIA;
+  vkSetBufferCollectionBufferConstraintsFUCHSIA = table.vkSetBufferCollectionBufferConstraintsFUCHSIA;
+  vkSetBufferCollectionImageConstraintsFUCHSIA = table.vkSetBufferCollectionImageConstraintsFUCHSIA;
+#endif /* defined(VK_FUCHSIA_buffer_collection) */
+#if defined(VK_FUCHSIA_external_memory)
+  vkGetMemoryZirconHandleFUCHSIA = table.vkGetMemoryZirconHandleFUCHSIA;
+  vkGetMemoryZirconHandlePropertiesFUCHSIA = table.vkGetMemoryZirconHandlePropertiesFUCHSIA;
+#endif /* defined(VK_FUCHSIA_external_memory) */
+#if defined(VK_FUCHSIA_external_semaphore)
+  vkGetSemaphoreZirconHandleFUCHSIA = table.vkGetSemaphoreZirconHandleFUCHSIA;
+  vkImportSemaphoreZirconHandleFUCHSIA = table.vkImportSemaphoreZirconHandleFUCHSIA;
+#endif /* defined(VK_FUCHSIA_external_semaphore) */
+#if defined(VK_FUCHSIA_imagepipe_surface)
+  vkCreateImagePipeSurfaceFUCHSIA = table.vkCreateImagePipeSurfaceFUCHSIA;
+#endif /* defined(VK_FUCHSIA_imagepipe_surface) */
+#if defined(VK_GGP_stream_descriptor_surface)
+  vkCreateStreamDescriptorSurfaceGGP = table.vkCreateStreamDescriptorSurfaceGGP;
+#endif /* defined(VK_GGP_stream_descriptor_surface) */
+#if defined(VK_GOOGLE_display_timing)
+  vkGetPastPresentationTimingGOOGLE = table.vkGetPastPresentationTimingGOOGLE;
+  vkGetRefreshCycleDurationGOOGLE = table.vkGetRefreshCycleDurationGOOGLE;
+#endif /* defined(VK_GOOGLE_display_timing) */
+#if defined(VK_HUAWEI_cluster_culling_shader)
+  vkCmdDrawClusterHUAWEI = table.vkCmdDrawClusterHUAWEI;
+  vkCmdDrawClusterIndirectHUAWEI = table.vkCmdDrawClusterIndirectHUAWEI;
+#endif /* defined(VK_HUAWEI_cluster_culling_shader) */
+#if defined(VK_HUAWEI_invocation_mask)
+  vkCmdBindInvocationMaskHUAWEI = table.vkCmdBindInvocationMaskHUAWEI;
+#endif /* defined(VK_HUAWEI_invocation_mask) */
+#if defined(VK_HUAWEI_subpass_shading)
+  vkCmdSubpassShadingHUAWEI = table.vkCmdSubpassShadingHUAWEI;
+  vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = table.vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+#endif /* defined(VK_HUAWEI_subpass_shading) */
+#if defined(VK_INTEL_performance_query)
+  vkAcquirePerformanceConfigurationINTEL = table.vkAcquirePerformanceConfigurationINTEL;
+  vkCmdSetPerformanceMarkerINTEL = table.vkCmdSetPerformanceMarkerINTEL;
+  vkCmdSetPerformanceOverrideINTEL = table.vkCmdSetPerformanceOverrideINTEL;
+  vkCmdSetPerformanceStreamMarkerINTEL = table.vkCmdSetPerformanceStreamMarkerINTEL;
+  vkGetPerformanceParameterINTEL = table.vkGetPerformanceParameterINTEL;
+  vkInitializePerformanceApiINTEL = table.vkInitializePerformanceApiINTEL;
+  vkQueueSetPerformanceConfigurationINTEL = table.vkQueueSetPerformanceConfigurationINTEL;
+  vkReleasePerformanceConfigurationINTEL = table.vkReleasePerformanceConfigurationINTEL;
+  vkUninitializePerformanceApiINTEL = table.vkUninitializePerformanceApiINTEL;
+#endif /* defined(VK_INTEL_performance_query) */
+#if defined(VK_KHR_acceleration_structure)
+  vkBuildAccelerationStructuresKHR = table.vkBuildAccelerationStructuresKHR;
+  vkCmdBuildAccelerationStructuresIndirectKHR = table.vkCmdBuildAccelerationStructuresIndirectKHR;
+  vkCmdBuildAccelerationStructuresKHR = table.vkCmdBuildAccelerationStructuresKHR;
+  vkCmdCopyAccelerationStructureKHR = table.vkCmdCopyAccelerationStructureKHR;
+  vkCmdCopyAccelerationStructureToMemoryKHR = table.vkCmdCopyAccelerationStructureToMemoryKHR;
+  vkCmdCopyMemoryToAccelerationStructureKHR = table.vkCmdCopyMemoryToAccelerationStructureKHR;
+  vkCmdWriteAccelerationStructuresPropertiesKHR = table.vkCmdWriteAccelerationStructuresPropertiesKHR;
+  vkCopyAccelerationStructureKHR = table.vkCopyAccelerationStructureKHR;
+  vkCopyAccelerationStructureToMemoryKHR = table.vkCopyAccelerationStructureToMemoryKHR;
+  vkCopyMemoryToAccelerationStructureKHR = table.vkCopyMemoryToAccelerationStructureKHR;
+  vkCreateAccelerationStructureKHR = table.vkCreateAccelerationStructureKHR;
+  vkDestroyAccelerationStructureKHR = table.vkDestroyAccelerationStructureKHR;
+  vkGetAccelerationStructureBuildSizesKHR = table.vkGetAccelerationStructureBuildSizesKHR;
+  vkGetAccelerationStructureDeviceAddressKHR = table.vkGetAccelerationStructureDeviceAddressKHR;
+  vkGetDeviceAccelerationStructureCompatibilityKHR = table.vkGetDeviceAccelerationStructureCompatibilityKHR;
+  vkWriteAccelerationStructuresPropertiesKHR = table.vkWriteAccelerationStructuresPropertiesKHR;
+#endif /* defined(VK_KHR_acceleration_structure) */
+#if defined(VK_KHR_android_surface)
+  vkCreateAndroidSurfaceKHR = table.vkCreateAndroidSurfaceKHR;
+#endif /* defined(VK_KHR_android_surface) */
+#if defined(VK_KHR_bind_memory2)
+  vkBindBufferMemory2KHR = table.vkBindBufferMemory2KHR;
+  vkBindImageMemory2KHR = table.vkBindImageMemory2KHR;
+#endif /* defined(VK_KHR_bind_memory2) */
+#if defined(VK_KHR_buffer_device_address)
+  vkGetBufferDeviceAddressKHR = table.vkGetBufferDeviceAddressKHR;
+  vkGetBufferOpaqueCaptureAddressKHR = table.vkGetBufferOpaqueCaptureAddressKHR;
+  vkGetDeviceMemoryOpaqueCaptureAddressKHR = table.vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+#endif /* defined(VK_KHR_buffer_device_address) */
+#if defined(VK_KHR_calibrated_timestamps)
+  vkGetCalibratedTimestampsKHR = table.vkGetCalibratedTimestampsKHR;
+  vkGetPhysicalDeviceCalibrateableTimeDomainsKHR = table.vkGetPhysicalDeviceCalibrateableTimeDomainsKHR;
+#endif /* defined(VK_KHR_calibrated_timestamps) */
+#if defined(VK_KHR_cooperative_matrix)
+  vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR = table.vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR;
+#endif /* defined(VK_KHR_cooperative_matrix) */
+#if defined(VK_KHR_copy_commands2)
+  vkCmdBlitImage2KHR = table.vkCmdBlitImage2KHR;
+  vkCmdCopyBuffer2KHR = table.vkCmdCopyBuffer2KHR;
+  vkCmdCopyBufferToImage2KHR = table.vkCmdCopyBufferToImage2KHR;
+  vkCmdCopyImage2KHR = table.vkCmdCopyImage2KHR;
+  vkCmdCopyImageToBuffer2KHR = table.vkCmdCopyImageToBuffer2KHR;
+  vkCmdResolveImage2KHR = table.vkCmdResolveImage2KHR;
+#endif /* defined(VK_KHR_copy_commands2) */
+#if defined(VK_KHR_copy_memory_indirect)
+  vkCmdCopyMemoryIndirectKHR = table.vkCmdCopyMemoryIndirectKHR;
+  vkCmdCopyMemoryToImageIndirectKHR = table.vkCmdCopyMemoryToImageIndirectKHR;
+#endif /* defined(VK_KHR_copy_memory_indirect) */
+#if defined(VK_KHR_create_renderpass2)
+  vkCmdBeginRenderPass2KHR = table.vkCmdBeginRenderPass2KHR;
+  vkCmdEndRenderPass2KHR = table.vkCmdEndRenderPass2KHR;
+  vkCmdNextSubpass2KHR = table.vkCmdNextSubpass2KHR;
+  vkCreateRenderPass2KHR = table.vkCreateRenderPass2KHR;
+#endif /* defined(VK_KHR_create_renderpass2) */
+#if defined(VK_KHR_deferred_host_operations)
+  vkCreateDeferredOperationKHR = table.vkCreateDeferredOperationKHR;
+  vkDeferredOperationJoinKHR = table.vkDeferredOperationJoinKHR;
+  vkDestroyDeferredOperationKHR = table.vkDestroyDeferredOperationKHR;
+  vkGetDeferredOperationMaxConcurrencyKHR = table.vkGetDeferredOperationMaxConcurrencyKHR;
+  vkGetDeferredOperationResultKHR = table.vkGetDeferredOperationResultKHR;
+#endif /* defined(VK_KHR_deferred_host_operations) */
+#if defined(VK_KHR_descriptor_update_template)
+  vkCreateDescriptorUpdateTemplateKHR = table.vkCreateDescriptorUpdateTemplateKHR;
+  vkDestroyDescriptorUpdateTemplateKHR = table.vkDestroyDescriptorUpdateTemplateKHR;
+  vkUpdateDescriptorSetWithTemplateKHR = table.vkUpdateDescriptorSetWithTemplateKHR;
+#endif /* defined(VK_KHR_descriptor_update_template) */
+#if defined(VK_KHR_device_group)
+  vkCmdDispatchBaseKHR = table.vkCmdDispatchBaseKHR;
+  vkCmdSetDeviceMaskKHR = table.vkCmdSetDeviceMaskKHR;
+  vkGetDeviceGroupPeerMemoryFeaturesKHR = table.vkGetDeviceGroupPeerMemoryFeaturesKHR;
+#endif /* defined(VK_KHR_device_group) */
+#if defined(VK_KHR_device_group_creation)
+  vkEnumeratePhysicalDeviceGroupsKHR = table.vkEnumeratePhysicalDeviceGroupsKHR;
+#endif /* defined(VK_KHR_device_group_creation) */
+#if defined(VK_KHR_display)
+  vkCreateDisplayModeKHR = table.vkCreateDisplayModeKHR;
+  vkCreateDisplayPlaneSurfaceKHR = table.vkCreateDisplayPlaneSurfaceKHR;
+  vkGetDisplayModePropertiesKHR = table.vkGetDisplayModePropertiesKHR;
+  vkGetDisplayPlaneCapabilitiesKHR = table.vkGetDisplayPlaneCapabilitiesKHR;
+  vkGetDisplayPlaneSupportedDisplaysKHR = table.vkGetDisplayPlaneSupportedDisplaysKHR;
+  vkGetPhysicalDeviceDisplayPlanePropertiesKHR = table.vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
+  vkGetPhysicalDeviceDisplayPropertiesKHR = table.vkGetPhysicalDeviceDisplayPropertiesKHR;
+#endif /* defined(VK_KHR_display) */
+#if defined(VK_KHR_display_swapchain)
+  vkCreateSharedSwapchainsKHR = table.vkCreateSharedSwapchainsKHR;
+#endif /* defined(VK_KHR_display_swapchain) */
+#if defined(VK_KHR_draw_indirect_count)
+  vkCmdDrawIndexedIndirectCountKHR = table.vkCmdDrawIndexedIndirectCountKHR;
+  vkCmdDrawIndirectCountKHR = table.vkCmdDrawIndirectCountKHR;
+#endif /* defined(VK_KHR_draw_indirect_count) */
+#if defined(VK_KHR_dynamic_rendering)
+  vkCmdBeginRenderingKHR = table.vkCmdBeginRenderingKHR;
+  vkCmdEndRenderingKHR = table.vkCmdEndRenderingKHR;
+#endif /* defined(VK_KHR_dynamic_rendering) */
+#if defined(VK_KHR_dynamic_rendering_local_read)
+  vkCmdSetRenderingAttachmentLocationsKHR = table.vkCmdSetRenderingAttachmentLocationsKHR;
+  vkCmdSetRenderingInputAttachmentIndicesKHR = table.vkCmdSetRenderingInputAttachmentIndicesKHR;
+#endif /* defined(VK_KHR_dynamic_rendering_local_read) */
+#if defined(VK_KHR_external_fence_capabilities)
+  vkGetPhysicalDeviceExternalFencePropertiesKHR = table.vkGetPhysicalDeviceExternalFencePropertiesKHR;
+#endif /* defined(VK_KHR_external_fence_capabilities) */
+#if defined(VK_KHR_external_fence_fd)
+  vkGetFenceFdKHR = table.vkGetFenceFdKHR;
+  vkImportFenceFdKHR = table.vkImportFenceFdKHR;
+#endif /* defined(VK_KHR_external_fence_fd) */
+#if defined(VK_KHR_external_fence_win32)
+  vkGetFenceWin32HandleKHR = table.vkGetFenceWin32HandleKHR;
+  vkImportFenceWin32HandleKHR = table.vkImportFenceWin32HandleKHR;
+#endif /* defined(VK_KHR_external_fence_win32) */
+#if defined(VK_KHR_external_memory_capabilities)
+  vkGetPhysicalDeviceExternalBufferPropertiesKHR = table.vkGetPhysicalDeviceExternalBufferPropertiesKHR;
+#endif /* defined(VK_KHR_external_memory_capabilities) */
+#if defined(VK_KHR_external_memory_fd)
+  vkGetMemoryFdKHR = table.vkGetMemoryFdKHR;
+  vkGetMemoryFdPropertiesKHR = table.vkGetMemoryFdPropertiesKHR;
+#endif /* defined(VK_KHR_external_memory_fd) */
+#if defined(VK_KHR_external_memory_win32)
+  vkGetMemoryWin32HandleKHR = table.vkGetMemoryWin32HandleKHR;
+  vkGetMemoryWin32HandlePropertiesKHR = table.vkGetMemoryWin32HandlePropertiesKHR;
+#endif /* defined(VK_KHR_external_memory_win32) */
+#if defined(VK_KHR_external_semaphore_capabilities)
+  vkGetPhysicalDeviceExternalSemaphorePropertiesKHR = table.vkGetPhysicalDeviceExternalSemaphorePropertiesKHR;
+#endif /* defined(VK_KHR_external_semaphore_capabilities) */
+#if defined(VK_KHR_external_semaphore_fd)
+  vkGetSemaphoreFdKHR = table.vkGetSemaphoreFdKHR;
+  vkImportSemaphoreFdKHR = table.vkImportSemaphoreFdKHR;
+#endif /* defined(VK_KHR_external_semaphore_fd) */
+#if defined(VK_KHR_external_semaphore_win32)
+  vkGetSemaphoreWin32HandleKHR = table.vkGetSemaphoreWin32HandleKHR;
+  vkImportSemaphoreWin32HandleKHR = table.vkImportSemaphoreWin32HandleKHR;
+#endif /* defined(VK_KHR_external_semaphore_win32) */
+#if defined(VK_KHR_fragment_shading_rate)
+  vkCmdSetFragmentShadingRateKHR = table.vkCmdSetFragmentShadingRateKHR;
+  vkGetPhysicalDeviceFragmentShadingRatesKHR = table.vkGetPhysicalDeviceFragmentShadingRatesKHR;
+#endif /* defined(VK_KHR_fragment_shading_rate) */
+#if defined(VK_KHR_get_display_properties2)
+  vkGetDisplayModeProperties2KHR = table.vkGetDisplayModeProperties2KHR;
+  vkGetDisplayPlaneCapabilities2KHR = table.vkGetDisplayPlaneCapabilities2KHR;
+  vkGetPhysicalDeviceDisplayPlaneProperties2KHR = table.vkGetPhysicalDeviceDisplayPlaneProperties2KHR;
+  vkGetPhysicalDeviceDisplayProperties2KHR = table.vkGetPhysicalDeviceDisplayProperties2KHR;
+#endif /* defined(VK_KHR_get_display_properties2) */
+#if defined(VK_KHR_get_memory_requirements2)
+  vkGetBufferMemoryRequirements2KHR = table.vkGetBufferMemoryRequirements2KHR;
+  vkGetImageMemoryRequirements2KHR = table.vkGetImageMemoryRequirements2KHR;
+  vkGetImageSparseMemoryRequirements2KHR = table.vkGetImageSparseMemoryRequirements2KHR;
+#endif /* defined(VK_KHR_get_memory_requirements2) */
+#if defined(VK_KHR_get_physical_device_properties2)
+  vkGetPhysicalDeviceFeatures2KHR = table.vkGetPhysicalDeviceFeatures2KHR;
+  vkGetPhysicalDeviceFormatProperties2KHR = table.vkGetPhysicalDeviceFormatProperties2KHR;
+  vkGetPhysicalDeviceImageFormatProperties2KHR = table.vkGetPhysicalDeviceImageFormatProperties2KHR;
+  vkGetPhysicalDeviceMemoryProperties2KHR = table.vkGetPhysicalDeviceMemoryProperties2KHR;
+  vkGetPhysicalDeviceProperties2KHR = table.vkGetPhysicalDeviceProperties2KHR;
+  vkGetPhysicalDeviceQueueFamilyProperties2KHR = table.vkGetPhysicalDeviceQueueFamilyProperties2KHR;
+  vkGetPhysicalDeviceSparseImageFormatProperties2KHR = table.vkGetPhysicalDeviceSparseImageFormatProperties2KHR;
+#endif /* defined(VK_KHR_get_physical_device_properties2) */
+#if defined(VK_KHR_get_surface_capabilities2)
+  vkGetPhysicalDeviceSurfaceCapabilities2KHR = table.vkGetPhysicalDeviceSurfaceCapabilities2KHR;
+  vkGetPhysicalDeviceSurfaceFormats2KHR = table.vkGetPhysicalDeviceSurfaceFormats2KHR;
+#endif /* defined(VK_KHR_get_surface_capabilities2) */
+#if defined(VK_KHR_line_rasterization)
+  vkCmdSetLineStippleKHR = table.vkCmdSetLineStippleKHR;
+#endif /* defined(VK_KHR_line_rasterization) */
+#if defined(VK_KHR_maintenance1)
+  vkTrimCommandPoolKHR = table.vkTrimCommandPoolKHR;
+#endif /* defined(VK_KHR_maintenance1) */
+#if defined(VK_KHR_maintenance10)
+  vkCmdEndRendering2KHR = table.vkCmdEndRendering2KHR;
+#endif /* defined(VK_KHR_maintenance10) */
+#if defined(VK_KHR_maintenance3)
+  vkGetDescriptorSetLayoutSupportKHR = table.vkGetDescriptorSetLayoutSupportKHR;
+#endif /* defined(VK_KHR_maintenance3) */
+#if defined(VK_KHR_maintenance4)
+  vkGetDeviceBufferMemoryRequirementsKHR = table.vkGetDeviceBufferMemoryRequirementsKHR;
+  vkGetDeviceImageMemoryRequirementsKHR = table.vkGetDeviceImageMemoryRequirementsKHR;
+  vkGetDeviceImageSparseMemoryRequirementsKHR = table.vkGetDeviceImageSparseMemoryRequirementsKHR;
+#endif /* defined(VK_KHR_maintenance4) */
+#if defined(VK_KHR_maintenance5)
+  vkCmdBindIndexBuffer2KHR = table.vkCmdBindIndexBuffer2KHR;
+  vkGetDeviceImageSubresourceLayoutKHR = table.vkGetDeviceImageSubresourceLayoutKHR;
+  vkGetImageSubresourceLayout2KHR = table.vkGetImageSubresourceLayout2KHR;
+  vkGetRenderingAreaGranularityKHR = table.vkGetRenderingAreaGranularityKHR;
+#endif /* defined(VK_KHR_maintenance5) */
+#if defined(VK_KHR_maintenance6)
+  vkCmdBindDescriptorSets2KHR = table.vkCmdBindDescriptorSets2KHR;
+  vkCmdPushConstants2KHR = table.vkCmdPushConstants2KHR;
+#endif /* defined(VK_KHR_maintenance6) */
+#if defined(VK_KHR_maintenance6) && defined(VK_KHR_push_descriptor)
+  vkCmdPushDescriptorSet2KHR = table.vkCmdPushDescriptorSet2KHR;
+  vkCmdPushDescriptorSetWithTemplate2KHR = table.vkCmdPushDescriptorSetWithTemplate2KHR;
+#endif /* defined(VK_KHR_maintenance6) && defined(VK_KHR_push_descriptor) */
+#if defined(VK_KHR_maintenance6) && defined(VK_EXT_descriptor_buffer)
+  vkCmdBindDescriptorBufferEmbeddedSamplers2EXT = table.vkCmdBindDescriptorBufferEmbeddedSamplers2EXT;
+  vkCmdSetDescriptorBufferOffsets2EXT = table.vkCmdSetDescriptorBufferOffsets2EXT;
+#endif /* defined(VK_KHR_maintenance6) && defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_KHR_map_memory2)
+  vkMapMemory2KHR = table.vkMapMemory2KHR;
+  vkUnmapMemory2KHR = table.vkUnmapMemory2KHR;
+#endif /* defined(VK_KHR_map_memory2) */
+#if defined(VK_KHR_performance_query)
+  vkAcquireProfilingLockKHR = table.vkAcquireProfilingLockKHR;
+  vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = table.vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+  vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = table.vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+  vkReleaseProfilingLockKHR = table.vkReleaseProfilingLockKHR;
+#endif /* defined(VK_KHR_performance_query) */
+#if defined(VK_KHR_pipeline_binary)
+  vkCreatePipelineBinariesKHR = table.vkCreatePipelineBinariesKHR;
+  vkDestroyPipelineBinaryKHR = table.vkDestroyPipelineBinaryKHR;
+  vkGetPipelineBinaryDataKHR = table.vkGetPipelineBinaryDataKHR;
+  vkGetPipelineKeyKHR = table.vkGetPipelineKeyKHR;
+  vkReleaseCapturedPipelineDataKHR = table.vkReleaseCapturedPipelineDataKHR;
+#endif /* defined(VK_KHR_pipeline_binary) */
+#if defined(VK_KHR_pipeline_executable_properties)
+  vkGetPipelineExecutableInternalRepresentationsKHR = table.vkGetPipelineExecutableInternalRepresentationsKHR;
+  vkGetPipelineExecutablePropertiesKHR = table.vkGetPipelineExecutablePropertiesKHR;
+  vkGetPipelineExecutableStatisticsKHR = table.vkGetPipelineExecutableStatisticsKHR;
+#endif /* defined(VK_KHR_pipeline_executable_properties) */
+#if defined(VK_KHR_present_wait)
+  vkWaitForPresentKHR = table.vkWaitForPresentKHR;
+#endif /* defined(VK_KHR_present_wait) */
+#if defined(VK_KHR_present_wait2)
+  vkWaitForPresent2KHR = table.vkWaitForPresent2KHR;
+#endif /* defined(VK_KHR_present_wait2) */
+#if defined(VK_KHR_push_descriptor)
+  vkCmdPushDescriptorSetKHR = table.vkCmdPushDescriptorSetKHR;
+#endif /* defined(VK_KHR_push_descriptor) */
+#if defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline)
+  vkCmdTraceRaysIndirect2KHR = table.vkCmdTraceRaysIndirect2KHR;
+#endif /* defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline) */
+#if defined(VK_KHR_ray_tracing_pipeline)
+  vkCmdSetRayTracingPipelineStackSizeKHR = table.vkCmdSetRayTracingPipelineStackSizeKHR;
+  vkCmdTraceRaysIndirectKHR = table.vkCmdTraceRaysIndirectKHR;
+  vkCmdTraceRaysKHR = table.vkCmdTraceRaysKHR;
+  vkCreateRayTracingPipelinesKHR = table.vkCreateRayTracingPipelinesKHR;
+  vkGetRayTracingCaptureReplayShaderGroupHandlesKHR = table.vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+  vkGetRayTracingShaderGroupHandlesKHR = table.vkGetRayTracingShaderGroupHandlesKHR;
+  vkGetRayTracingShaderGroupStackSizeKHR = table.vkGetRayTracingShaderGroupStackSizeKHR;
+#endif /* defined(VK_KHR_ray_tracing_pipeline) */
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+  vkCreateSamplerYcbcrConversionKHR = table.vkCreateSamplerYcbcrConversionKHR;
+  vkDestroySamplerYcbcrConversionKHR = table.vkDestroySamplerYcbcrConversionKHR;
+#endif /* defined(VK_KHR_sampler_ycbcr_conversion) */
+#if defined(VK_KHR_shared_presentable_image)
+  vkGetSwapchainStatusKHR = table.vkGetSwapchainStatusKHR;
+#endif /* defined(VK_KHR_shared_presentable_image) */
+#if defined(VK_KHR_surface)
+  vkDestroySurfaceKHR = table.vkDestroySurfaceKHR;
+  vkGetPhysicalDeviceSurfaceCapabilitiesKHR = table.vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+  vkGetPhysicalDeviceSurfaceFormatsKHR = table.vkGetPhysicalDeviceSurfaceFormatsKHR;
+  vkGetPhysicalDeviceSurfacePresentModesKHR = table.vkGetPhysicalDeviceSurfacePresentModesKHR;
+  vkGetPhysicalDeviceSurfaceSupportKHR = table.vkGetPhysicalDeviceSurfaceSupportKHR;
+#endif /* defined(VK_KHR_surface) */
+#if defined(VK_KHR_swapchain)
+  vkAcquireNextImageKHR = table.vkAcquireNextImageKHR;
+  vkCreateSwapchainKHR = table.vkCreateSwapchainKHR;
+  vkDestroySwapchainKHR = table.vkDestroySwapchainKHR;
+  vkGetSwapchainImagesKHR = table.vkGetSwapchainImagesKHR;
+  vkQueuePresentKHR = table.vkQueuePresentKHR;
+#endif /* defined(VK_KHR_swapchain) */
+#if defined(VK_KHR_swapchain_maintenance1)
+  vkReleaseSwapchainImagesKHR = table.vkReleaseSwapchainImagesKHR;
+#endif /* defined(VK_KHR_swapchain_maintenance1) */
+#if defined(VK_KHR_synchronization2)
+  vkCmdPipelineBarrier2KHR = table.vkCmdPipelineBarrier2KHR;
+  vkCmdResetEvent2KHR = table.vkCmdResetEvent2KHR;
+  vkCmdSetEvent2KHR = table.vkCmdSetEvent2KHR;
+  vkCmdWaitEvents2KHR = table.vkCmdWaitEvents2KHR;
+  vkCmdWriteTimestamp2KHR = table.vkCmdWriteTimestamp2KHR;
+  vkQueueSubmit2KHR = table.vkQueueSubmit2KHR;
+#endif /* defined(VK_KHR_synchronization2) */
+#if defined(VK_KHR_timeline_semaphore)
+  vkGetSemaphoreCounterValueKHR = table.vkGetSemaphoreCounterValueKHR;
+  vkSignalSemaphoreKHR = table.vkSignalSemaphoreKHR;
+  vkWaitSemaphoresKHR = table.vkWaitSemaphoresKHR;
+#endif /* defined(VK_KHR_timeline_semaphore) */
+#if defined(VK_KHR_video_decode_queue)
+  vkCmdDecodeVideoKHR = table.vkCmdDecodeVideoKHR;
+#endif /* defined(VK_KHR_video_decode_queue) */
+#if defined(VK_KHR_video_encode_queue)
+  vkCmdEncodeVideoKHR = table.vkCmdEncodeVideoKHR;
+  vkGetEncodedVideoSessionParametersKHR = table.vkGetEncodedVideoSessionParametersKHR;
+  vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR = table.vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR;
+#endif /* defined(VK_KHR_video_encode_queue) */
+#if defined(VK_KHR_video_queue)
+  vkBindVideoSessionMemoryKHR = table.vkBindVideoSessionMemoryKHR;
+  vkCmdBeginVideoCodingKHR = table.vkCmdBeginVideoCodingKHR;
+  vkCmdControlVideoCodingKHR = table.vkCmdControlVideoCodingKHR;
+  vkCmdEndVideoCodingKHR = table.vkCmdEndVideoCodingKHR;
+  vkCreateVideoSessionKHR = table.vkCreateVideoSessionKHR;
+  vkCreateVideoSessionParametersKHR = table.vkCreateVideoSessionParametersKHR;
+  vkDestroyVideoSessionKHR = table.vkDestroyVideoSessionKHR;
+  vkDestroyVideoSessionParametersKHR = table.vkDestroyVideoSessionParametersKHR;
+  vkGetPhysicalDeviceVideoCapabilitiesKHR = table.vkGetPhysicalDeviceVideoCapabilitiesKHR;
+  vkGetPhysicalDeviceVideoFormatPropertiesKHR = table.vkGetPhysicalDeviceVideoFormatPropertiesKHR;
+  vkGetVideoSessionMemoryRequirementsKHR = table.vkGetVideoSessionMemoryRequirementsKHR;
+  vkUpdateVideoSessionParametersKHR = table.vkUpdateVideoSessionParametersKHR;
+#endif /* defined(VK_KHR_video_queue) */
+#if defined(VK_KHR_wayland_surface)
+  vkCreateWaylandSurfaceKHR = table.vkCreateWaylandSurfaceKHR;
+  vkGetPhysicalDeviceWaylandPresentationSupportKHR = table.vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+#endif /* defined(VK_KHR_wayland_surface) */
+#if defined(VK_KHR_win32_surface)
+  vkCreateWin32SurfaceKHR = table.vkCreateWin32SurfaceKHR;
+  vkGetPhysicalDeviceWin32PresentationSupportKHR = table.vkGetPhysicalDeviceWin32PresentationSupportKHR;
+#endif /* defined(VK_KHR_win32_surface) */
+#if defined(VK_KHR_xcb_surface)
+  vkCreateXcbSurfaceKHR = table.vkCreateXcbSurfaceKHR;
+  vkGetPhysicalDeviceXcbPresentationSupportKHR = table.vkGetPhysicalDeviceXcbPresentationSupportKHR;
+#endif /* defined(VK_KHR_xcb_surface) */
+#if defined(VK_KHR_xlib_surface)
+  vkCreateXlibSurfaceKHR = table.vkCreateXlibSurfaceKHR;
+  vkGetPhysicalDeviceXlibPresentationSupportKHR = table.vkGetPhysicalDeviceXlibPresentationSupportKHR;
+#endif /* defined(VK_KHR_xlib_surface) */
+#if defined(VK_MVK_ios_surface)
+  vkCreateIOSSurfaceMVK = table.vkCreateIOSSurfaceMVK;
+#endif /* defined(VK_MVK_ios_surface) */
+#if defined(VK_MVK_macos_surface)
+  vkCreateMacOSSurfaceMVK = table.vkCreateMacOSSurfaceMVK;
+#endif /* defined(VK_MVK_macos_surface) */
+#if defined(VK_NN_vi_surface)
+  vkCreateViSurfaceNN = table.vkCreateViSurfaceNN;
+#endif /* defined(VK_NN_vi_surface) */
+#if defined(VK_NVX_binary_import)
+  vkCmdCuLaunchKernelNVX = table.vkCmdCuLaunchKernelNVX;
+  vkCreateCuFunctionNVX = table.vkCreateCuFunctionNVX;
+  vkCreateCuModuleNVX = table.vkCreateCuModuleNVX;
+  vkDestroyCuFunctionNVX = table.vkDestroyCuFunctionNVX;
+  vkDestroyCuModuleNVX = table.vkDestroyCuModuleNVX;
+#endif /* defined(VK_NVX_binary_import) */
+#if defined(VK_NVX_image_view_handle)
+  vkGetDeviceCombinedImageSamplerIndexNVX = table.vkGetDeviceCombinedImageSamplerIndexNVX;
+  vkGetImageViewAddressNVX = table.vkGetImageViewAddressNVX;
+  vkGetImageViewHandle64NVX = table.vkGetImageViewHandle64NVX;
+  vkGetImageViewHandleNVX = table.vkGetImageViewHandleNVX;
+#endif /* defined(VK_NVX_image_view_handle) */
+#if defined(VK_NV_acquire_winrt_display)
+  vkAcquireWinrtDisplayNV = table.vkAcquireWinrtDisplayNV;
+  vkGetWinrtDisplayNV = table.vkGetWinrtDisplayNV;
+#endif /* defined(VK_NV_acquire_winrt_display) */
+#if defined(VK_NV_clip_space_w_scaling)
+  vkCmdSetViewportWScalingNV = table.vkCmdSetViewportWScalingNV;
+#endif /* defined(VK_NV_clip_space_w_scaling) */
+#if defined(VK_NV_cluster_acceleration_structure)
+  vkCmdBuildClusterAccelerationStructureIndirectNV = table.vkCmdBuildClusterAccelerationStructureIndirectNV;
+  vkGetClusterAccelerationStructureBuildSizesNV = table.vkGetClusterAccelerationStructureBuildSizesNV;
+#endif /* defined(VK_NV_cluster_acceleration_structure) */
+#if defined(VK_NV_compute_occupancy_priority)
+  vkCmdSetComputeOccupancyPriorityNV = table.vkCmdSetComputeOccupancyPriorityNV;
+#endif /* defined(VK_NV_compute_occupancy_priority) */
+#if defined(VK_NV_cooperative_matrix)
+  vkGetPhysicalDeviceCooperativeMatrixPropertiesNV = table.vkGetPhysicalDeviceCooperativeMatrixPropertiesNV;
+#endif /* defined(VK_NV_cooperative_matrix) */
+#if defined(VK_NV_cooperative_matrix2)
+  vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV = table.vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV;
+#endif /* defined(VK_NV_cooperative_matrix2) */
+#if defined(VK_NV_cooperative_vector)
+  vkCmdConvertCooperativeVectorMatrixNV = table.vkCmdConvertCooperativeVectorMatrixNV;
+  vkConvertCooperativeVectorMatrixNV = table.vkConvertCooperativeVectorMatrixNV;
+  vkGetPhysicalDeviceCooperativeVectorPropertiesNV = table.vkGetPhysicalDeviceCooperativeVectorPropertiesNV;
+#endif /* defined(VK_NV_cooperative_vector) */
+#if defined(VK_NV_copy_memory_indirect)
+  vkCmdCopyMemoryIndirectNV = table.vkCmdCopyMemoryIndirectNV;
+  vkCmdCopyMemoryToImageIndirectNV = table.vkCmdCopyMemoryToImageIndirectNV;
+#endif /* defined(VK_NV_copy_memory_indirect) */
+#if defined(VK_NV_coverage_reduction_mode)
+  vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = table.vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+#endif /* defined(VK_NV_coverage_reduction_mode) */
+#if defined(VK_NV_cuda_kernel_launch)
+  vkCmdCudaLaunchKernelNV = table.vkCmdCudaLaunchKernelNV;
+  vkCreateCudaFunctionNV = table.vkCreateCudaFunctionNV;
+  vkCreateCudaModuleNV = table.vkCreateCudaModuleNV;
+  vkDestroyCudaFunctionNV = table.vkDestroyCudaFunctionNV;
+  vkDestroyCudaModuleNV = table.vkDestroyCudaModuleNV;
+  vkGetCudaModuleCacheNV = table.vkGetCudaModuleCacheNV;
+#endif /* defined(VK_NV_cuda_kernel_launch) */
+#if defined(VK_NV_device_diagnostic_checkpoints)
+  vkCmdSetCheckpointNV = table.vkCmdSetCheckpointNV;
+  vkGetQueueCheckpointDataNV = table.vkGetQueueCheckpointDataNV;
+#endif /* defined(VK_NV_device_diagnostic_checkpoints) */
+#if defined(VK_NV_device_diagnostic_checkpoints) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2))
+  vkGetQueueCheckpointData2NV = table.vkGetQueueCheckpointData2NV;
+#endif /* defined(VK_NV_device_diagnostic_checkpoints) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2)) */
+#if defined(VK_NV_device_generated_commands)
+  vkCmdBindPipelineShaderGroupNV = table.vkCmdBindPipelineShaderGroupNV;
+  vkCmdExecuteGeneratedCommandsNV = table.vkCmdExecuteGeneratedCommandsNV;
+  vkCmdPreprocessGeneratedCommandsNV = table.vkCmdPreprocessGeneratedCommandsNV;
+  vkCreateIndirectCommandsLayoutNV = table.vkCreateIndirectCommandsLayoutNV;
+  vkDestroyIndirectCommandsLayoutNV = table.vkDestroyIndirectCommandsLayoutNV;
+  vkGetGeneratedCommandsMemoryRequirementsNV = table.vkGetGeneratedCommandsMemoryRequirementsNV;
+#endif /* defined(VK_NV_device_generated_commands) */
+#if defined(VK_NV_device_generated_commands_compute)
+  vkCmdUpdatePipelineIndirectBufferNV = table.vkCmdUpdatePipelineIndirectBufferNV;
+  vkGetPipelineIndirectDeviceAddressNV = table.vkGetPipelineIndirectDeviceAddressNV;
+  vkGetPipelineIndirectMemoryRequirementsNV = table.vkGetPipelineIndirectMemoryRequirementsNV;
+#endif /* defined(VK_NV_device_generated_commands_compute) */
+#if defined(VK_NV_external_compute_queue)
+  vkCreateExternalComputeQueueNV = table.vkCreateExternalComputeQueueNV;
+  vkDestroyExternalComputeQueueNV = table.vkDestroyExternalComputeQueueNV;
+  vkGetExternalComputeQueueDataNV = table.vkGetExternalComputeQueueDataNV;
+#endif /* defined(VK_NV_external_compute_queue) */
+#if defined(VK_NV_external_memory_capabilities)
+  vkGetPhysicalDeviceExternalImageFormatPropertiesNV = table.vkGetPhysicalDeviceExternalImageFormatPropertiesNV;
+#endif /* defined(VK_NV_external_memory_capabilities) */
+#if defined(VK_NV_external_memory_rdma)
+  vkGetMemoryRemoteAddressNV = table.vkGetMemoryRemoteAddressNV;
+#endif /* defined(VK_NV_external_memory_rdma) */
+#if defined(VK_NV_external_memory_win32)
+  vkGetMemoryWin32HandleNV = table.vkGetMemoryWin32HandleNV;
+#endif /* defined(VK_NV_external_memory_win32) */
+#if defined(VK_NV_fragment_shading_rate_enums)
+  vkCmdSetFragmentShadingRateEnumNV = table.vkCmdSetFragmentShadingRateEnumNV;
+#endif /* defined(VK_NV_fragment_shading_rate_enums) */
+#if defined(VK_NV_low_latency2)
+  vkGetLatencyTimingsNV = table.vkGetLatencyTimingsNV;
+  vkLatencySleepNV = table.vkLatencySleepNV;
+  vkQueueNotifyOutOfBandNV = table.vkQueueNotifyOutOfBandNV;
+  vkSetLatencyMarkerNV = table.vkSetLatencyMarkerNV;
+  vkSetLatencySleepModeNV = table.vkSetLatencySleepModeNV;
+#endif /* defined(VK_NV_low_latency2) */
+#if defined(VK_NV_memory_decompression)
+  vkCmdDecompressMemoryIndirectCountNV = table.vkCmdDecompressMemoryIndirectCountNV;
+  vkCmdDecompressMemoryNV = table.vkCmdDecompressMemoryNV;
+#endif /* defined(VK_NV_memory_decompression) */
+#if defined(VK_NV_mesh_shader)
+  vkCmdDrawMeshTasksIndirectNV = table.vkCmdDrawMeshTasksIndirectNV;
+  vkCmdDrawMeshTasksNV = table.vkCmdDrawMeshTasksNV;
+#endif /* defined(VK_NV_mesh_shader) */
+#if defined(VK_NV_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count))
+  vkCmdDrawMeshTasksIndirectCountNV = table.vkCmdDrawMeshTasksIndirectCountNV;
+#endif /* defined(VK_NV_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count)) */
+#if defined(VK_NV_optical_flow)
+  vkBindOpticalFlowSessionImageNV = table.vkBindOpticalFlowSessionImageNV;
+  vkCmdOpticalFlowExecuteNV = table.vkCmdOpticalFlowExecuteNV;
+  vkCreateOpticalFlowSessionNV = table.vkCreateOpticalFlowSessionNV;
+  vkDestroyOpticalFlowSessionNV = table.vkDestroyOpticalFlowSessionNV;
+  vkGetPhysicalDeviceOpticalFlowImageFormatsNV = table.vkGetPhysicalDeviceOpticalFlowImageFormatsNV;
+#endif /* defined(VK_NV_optical_flow) */
+#if defined(VK_NV_partitioned_acceleration_structure)
+  vkCmdBuildPartitionedAccelerationStructuresNV = table.vkCmdBuildPartitionedAccelerationStructuresNV;
+  vkGetPartitionedAccelerationStructuresBuildSizesNV = table.vkGetPartitionedAccelerationStructuresBuildSizesNV;
+#endif /* defined(VK_NV_partitioned_acceleration_structure) */
+#if defined(VK_NV_ray_tracing)
+  vkBindAccelerationStructureMemoryNV = table.vkBindAccelerationStructureMemoryNV;
+  vkCmdBuildAccelerationStructureNV = table.vkCmdBuildAccelerationStructureNV;
+  vkCmdCopyAccelerationStructureNV = table.vkCmdCopyAccelerationStructureNV;
+  vkCmdTraceRaysNV = table.vkCmdTraceRaysNV;
+  vkCmdWriteAccelerationStructuresPropertiesNV = table.vkCmdWriteAccelerationStructuresPropertiesNV;
+  vkCompileDeferredNV = table.vkCompileDeferredNV;
+  vkCreateAccelerationStructureNV = table.vkCreateAccelerationStructureNV;
+  vkCreateRayTracingPipelinesNV = table.vkCreateRayTracingPipelinesNV;
+  vkDestroyAccelerationStructureNV = table.vkDestroyAccelerationStructureNV;
+  vkGetAccelerationStructureHandleNV = table.vkGetAccelerationStructureHandleNV;
+  vkGetAccelerationStructureMemoryRequirementsNV = table.vkGetAccelerationStructureMemoryRequirementsNV;
+  vkGetRayTracingShaderGroupHandlesNV = table.vkGetRayTracingShaderGroupHandlesNV;
+#endif /* defined(VK_NV_ray_tracing) */
+#if defined(VK_NV_scissor_exclusive) && VK_NV_SCISSOR_EXCLUSIVE_SPEC_VERSION >= 2
+  vkCmdSetExclusiveScissorEnableNV = table.vkCmdSetExclusiveScissorEnableNV;
+#endif /* defined(VK_NV_scissor_exclusive) && VK_NV_SCISSOR_EXCLUSIVE_SPEC_VERSION >= 2 */
+#if defined(VK_NV_scissor_exclusive)
+  vkCmdSetExclusiveScissorNV = table.vkCmdSetExclusiveScissorNV;
+#endif /* defined(VK_NV_scissor_exclusive) */
+#if defined(VK_NV_shading_rate_image)
+  vkCmdBindShadingRateImageNV = table.vkCmdBindShadingRateImageNV;
+  vkCmdSetCoarseSampleOrderNV = table.vkCmdSetCoarseSampleOrderNV;
+  vkCmdSetViewportShadingRatePaletteNV = table.vkCmdSetViewportShadingRatePaletteNV;
+#endif /* defined(VK_NV_shading_rate_image) */
+#if defined(VK_OHOS_external_memory)
+  vkGetMemoryNativeBufferOHOS = table.vkGetMemoryNativeBufferOHOS;
+  vkGetNativeBufferPropertiesOHOS = table.vkGetNativeBufferPropertiesOHOS;
+#endif /* defined(VK_OHOS_external_memory) */
+#if defined(VK_OHOS_surface)
+  vkCreateSurfaceOHOS = table.vkCreateSurfaceOHOS;
+#endif /* defined(VK_OHOS_surface) */
+#if defined(VK_QCOM_tile_memory_heap)
+  vkCmdBindTileMemoryQCOM = table.vkCmdBindTileMemoryQCOM;
+#endif /* defined(VK_QCOM_tile_memory_heap) */
+#if defined(VK_QCOM_tile_properties)
+  vkGetDynamicRenderingTilePropertiesQCOM = table.vkGetDynamicRenderingTilePropertiesQCOM;
+  vkGetFramebufferTilePropertiesQCOM = table.vkGetFramebufferTilePropertiesQCOM;
+#endif /* defined(VK_QCOM_tile_properties) */
+#if defined(VK_QCOM_tile_shading)
+  vkCmdBeginPerTileExecutionQCOM = table.vkCmdBeginPerTileExecutionQCOM;
+  vkCmdDispatchTileQCOM = table.vkCmdDispatchTileQCOM;
+  vkCmdEndPerTileExecutionQCOM = table.vkCmdEndPerTileExecutionQCOM;
+#endif /* defined(VK_QCOM_tile_shading) */
+#if defined(VK_QNX_external_memory_screen_buffer)
+  vkGetScreenBufferPropertiesQNX = table.vkGetScreenBufferPropertiesQNX;
+#endif /* defined(VK_QNX_external_memory_screen_buffer) */
+#if defined(VK_QNX_screen_surface)
+  vkCreateScreenSurfaceQNX = table.vkCreateScreenSurfaceQNX;
+  vkGetPhysicalDeviceScreenPresentationSupportQNX = table.vkGetPhysicalDeviceScreenPresentationSupportQNX;
+#endif /* defined(VK_QNX_screen_surface) */
+#if defined(VK_SEC_ubm_surface)
+  vkCreateUbmSurfaceSEC = table.vkCreateUbmSurfaceSEC;
+  vkGetPhysicalDeviceUbmPresentationSupportSEC = table.vkGetPhysicalDeviceUbmPresentationSupportSEC;
+#endif /* defined(VK_SEC_ubm_surface) */
+#if defined(VK_VALVE_descriptor_set_host_mapping)
+  vkGetDescriptorSetHostMappingVALVE = table.vkGetDescriptorSetHostMappingVALVE;
+  vkGetDescriptorSetLayoutHostMappingInfoVALVE = table.vkGetDescriptorSetLayoutHostMappingInfoVALVE;
+#endif /* defined(VK_VALVE_descriptor_set_host_mapping) */
+#if (defined(VK_EXT_depth_clamp_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clamp_control))
+  vkCmdSetDepthClampRangeEXT = table.vkCmdSetDepthClampRangeEXT;
+#endif /* (defined(VK_EXT_depth_clamp_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clamp_control)) */
+#if (defined(VK_EXT_extended_dynamic_state)) || (defined(VK_EXT_shader_object))
+  vkCmdBindVertexBuffers2EXT = table.vkCmdBindVertexBuffers2EXT;
+  vkCmdSetCullModeEXT = table.vkCmdSetCullModeEXT;
+  vkCmdSetDepthBoundsTestEnableEXT = table.vkCmdSetDepthBoundsTestEnableEXT;
+  vkCmdSetDepthCompareOpEXT = table.vkCmdSetDepthCompareOpEXT;
+  vkCmdSetDepthTestEnableEXT = table.vkCmdSetDepthTestEnableEXT;
+  vkCmdSetDepthWriteEnableEXT = table.vkCmdSetDepthWriteEnableEXT;
+  vkCmdSetFrontFaceEXT = table.vkCmdSetFrontFaceEXT;
+  vkCmdSetPrimitiveTopologyEXT = table.vkCmdSetPrimitiveTopologyEXT;
+  vkCmdSetScissorWithCountEXT = table.vkCmdSetScissorWithCountEXT;
+  vkCmdSetStencilOpEXT = table.vkCmdSetStencilOpEXT;
+  vkCmdSetStencilTestEnableEXT = table.vkCmdSetStencilTestEnableEXT;
+  vkCmdSetViewportWithCountEXT = table.vkCmdSetViewportWithCountEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state2)) || (defined(VK_EXT_shader_object))
+  vkCmdSetDepthBiasEnableEXT = table.vkCmdSetDepthBiasEnableEXT;
+  vkCmdSetLogicOpEXT = table.vkCmdSetLogicOpEXT;
+  vkCmdSetPatchControlPointsEXT = table.vkCmdSetPatchControlPointsEXT;
+  vkCmdSetPrimitiveRestartEnableEXT = table.vkCmdSetPrimitiveRestartEnableEXT;
+  vkCmdSetRasterizerDiscardEnableEXT = table.vkCmdSetRasterizerDiscardEnableEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state2)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3)) || (defined(VK_EXT_shader_object))
+  vkCmdSetAlphaToCoverageEnableEXT = table.vkCmdSetAlphaToCoverageEnableEXT;
+  vkCmdSetAlphaToOneEnableEXT = table.vkCmdSetAlphaToOneEnableEXT;
+  vkCmdSetColorBlendEnableEXT = table.vkCmdSetColorBlendEnableEXT;
+  vkCmdSetColorBlendEquationEXT = table.vkCmdSetColorBlendEquationEXT;
+  vkCmdSetColorWriteMaskEXT = table.vkCmdSetColorWriteMaskEXT;
+  vkCmdSetDepthClampEnableEXT = table.vkCmdSetDepthClampEnableEXT;
+  vkCmdSetLogicOpEnableEXT = table.vkCmdSetLogicOpEnableEXT;
+  vkCmdSetPolygonModeEXT = table.vkCmdSetPolygonModeEXT;
+  vkCmdSetRasterizationSamplesEXT = table.vkCmdSetRasterizationSamplesEXT;
+  vkCmdSetSampleMaskEXT = table.vkCmdSetSampleMaskEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && (defined(VK_KHR_maintenance2) || defined(VK_VERSION_1_1))) || (defined(VK_EXT_shader_object))
+  vkCmdSetTessellationDomainOriginEXT = table.vkCmdSetTessellationDomainOriginEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && (defined(VK_KHR_maintenance2) || defined(VK_VERSION_1_1))) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_transform_feedback)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_transform_feedback))
+  vkCmdSetRasterizationStreamEXT = table.vkCmdSetRasterizationStreamEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_transform_feedback)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_transform_feedback)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_conservative_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_conservative_rasterization))
+  vkCmdSetConservativeRasterizationModeEXT = table.vkCmdSetConservativeRasterizationModeEXT;
+  vkCmdSetExtraPrimitiveOverestimationSizeEXT = table.vkCmdSetExtraPrimitiveOverestimationSizeEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_conservative_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_conservative_rasterization)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_enable)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_enable))
+  vkCmdSetDepthClipEnableEXT = table.vkCmdSetDepthClipEnableEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_enable)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_enable)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_sample_locations)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_sample_locations))
+  vkCmdSetSampleLocationsEnableEXT = table.vkCmdSetSampleLocationsEnableEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_sample_locations)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_sample_locations)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_blend_operation_advanced)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_blend_operation_advanced))
+  vkCmdSetColorBlendAdvancedEXT = table.vkCmdSetColorBlendAdvancedEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_blend_operation_advanced)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_blend_operation_advanced)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_provoking_vertex)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_provoking_vertex))
+  vkCmdSetProvokingVertexModeEXT = table.vkCmdSetProvokingVertexModeEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_provoking_vertex)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_provoking_vertex)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_line_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_line_rasterization))
+  vkCmdSetLineRasterizationModeEXT = table.vkCmdSetLineRasterizationModeEXT;
+  vkCmdSetLineStippleEnableEXT = table.vkCmdSetLineStippleEnableEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_line_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_line_rasterization)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_control))
+  vkCmdSetDepthClipNegativeOneToOneEXT = table.vkCmdSetDepthClipNegativeOneToOneEXT;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_control)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_clip_space_w_scaling)) || (defined(VK_EXT_shader_object) && defined(VK_NV_clip_space_w_scaling))
+  vkCmdSetViewportWScalingEnableNV = table.vkCmdSetViewportWScalingEnableNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_clip_space_w_scaling)) || (defined(VK_EXT_shader_object) && defined(VK_NV_clip_space_w_scaling)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_viewport_swizzle)) || (defined(VK_EXT_shader_object) && defined(VK_NV_viewport_swizzle))
+  vkCmdSetViewportSwizzleNV = table.vkCmdSetViewportSwizzleNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_viewport_swizzle)) || (defined(VK_EXT_shader_object) && defined(VK_NV_viewport_swizzle)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_fragment_coverage_to_color)) || (defined(VK_EXT_shader_object) && defined(VK_NV_fragment_coverage_to_color))
+  vkCmdSetCoverageToColorEnableNV = table.vkCmdSetCoverageToColorEnableNV;
+  vkCmdSetCoverageToColorLocationNV = table.vkCmdSetCoverageToColorLocationNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_fragment_coverage_to_color)) || (defined(VK_EXT_shader_object) && defined(VK_NV_fragment_coverage_to_color)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) || (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples))
+  vkCmdSetCoverageModulationModeNV = table.vkCmdSetCoverageModulationModeNV;
+  vkCmdSetCoverageModulationTableEnableNV = table.vkCmdSetCoverageModulationTableEnableNV;
+  vkCmdSetCoverageModulationTableNV = table.vkCmdSetCoverageModulationTableNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) || (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_shading_rate_image)) || (defined(VK_EXT_shader_object) && defined(VK_NV_shading_rate_image))
+  vkCmdSetShadingRateImageEnableNV = table.vkCmdSetShadingRateImageEnableNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_shading_rate_image)) || (defined(VK_EXT_shader_object) && defined(VK_NV_shading_rate_image)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_representative_fragment_test)) || (defined(VK_EXT_shader_object) && defined(VK_NV_representative_fragment_test))
+  vkCmdSetRepresentativeFragmentTestEnableNV = table.vkCmdSetRepresentativeFragmentTestEnableNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_representative_fragment_test)) || (defined(VK_EXT_shader_object) && defined(VK_NV_representative_fragment_test)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_coverage_reduction_mode)) || (defined(VK_EXT_shader_object) && defined(VK_NV_coverage_reduction_mode))
+  vkCmdSetCoverageReductionModeNV = table.vkCmdSetCoverageReductionModeNV;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_coverage_reduction_mode)) || (defined(VK_EXT_shader_object) && defined(VK_NV_coverage_reduction_mode)) */
+#if (defined(VK_EXT_host_image_copy)) || (defined(VK_EXT_image_compression_control))
+  vkGetImageSubresourceLayout2EXT = table.vkGetImageSubresourceLayout2EXT;
+#endif /* (defined(VK_EXT_host_image_copy)) || (defined(VK_EXT_image_compression_control)) */
+#if (defined(VK_EXT_shader_object)) || (defined(VK_EXT_vertex_input_dynamic_state))
+  vkCmdSetVertexInputEXT = table.vkCmdSetVertexInputEXT;
+#endif /* (defined(VK_EXT_shader_object)) || (defined(VK_EXT_vertex_input_dynamic_state)) */
+#if (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && (defined(VK_VERSION_1_1) || defined(VK_KHR_descriptor_update_template)))
+  vkCmdPushDescriptorSetWithTemplateKHR = table.vkCmdPushDescriptorSetWithTemplateKHR;
+#endif /* (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && (defined(VK_VERSION_1_1) || defined(VK_KHR_descriptor_update_template))) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+  vkGetDeviceGroupPresentCapabilitiesKHR = table.vkGetDeviceGroupPresentCapabilitiesKHR;
+  vkGetDeviceGroupSurfacePresentModesKHR = table.vkGetDeviceGroupSurfacePresentModesKHR;
+  vkGetPhysicalDevicePresentRectanglesKHR = table.vkGetPhysicalDevicePresentRectanglesKHR;
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+  vkAcquireNextImage2KHR = table.vkAcquireNextImage2KHR;
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+  /* VOLK_CPP_GENERATE_IMPORT_TABLE */
+}
+
 /* clang-format on */
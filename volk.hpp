@@ -69,6 +69,9 @@
 
 #include <cstdint>
 
+struct VolkCppExport;
+struct VolkCppTable;
+
 class Volk final {
 public:
   /**
@@ -81,6 +84,13 @@ public:
   Volk& operator=(const Volk&) = delete;
   Volk(Volk&&) = default;
   Volk& operator=(Volk&&) = default;
+
+  /**
+   * Take function pointers from a table exported by another module (see exportTable()). The exporter's table is
+   * copied if its layout matches this build; otherwise function pointers are loaded with the exporter's
+   * vkGetInstanceProcAddr and its loaded VkInstance/VkDevice.
+   */
+  explicit Volk(const VolkCppExport& hostExport) noexcept;
   
   /**
    * Get version of Vulkan Header with which this class was compiled.
@@ -132,6 +142,29 @@ public:
    * or VK_NULL_HANDLE if loadDevice() has not been called.
    */
   [[nodiscard]] VkDevice getLoadedDevice() noexcept;
+
+  /**
+   * Get VK_HEADER_VERSION, the patch version of the Vulkan headers this class was compiled with.
+   *
+   * Together with the function pointer members this makes Volk a Vulkan-Hpp dispatcher: a Volk instance can be
+   * passed as the dispatcher argument of Vulkan-Hpp functions, which then call the already loaded pointers directly.
+   */
+  [[nodiscard]] uint32_t getVkHeaderVersion() const noexcept;
+
+  /**
+   * Fill VulkanMemoryAllocator's VmaVulkanFunctions with the loaded function pointers, so that VMA doesn't resolve
+   * them again. Members that the used VMA version doesn't have are skipped; KHR members get the core function
+   * if it is loaded and the extension function otherwise.
+   */
+  template <typename VmaVulkanFunctions>
+  void fillVmaVulkanFunctions(VmaVulkanFunctions& functions) const noexcept;
+
+  /**
+   * Describe this Volk in C-compatible structures (declared in volk_export.h), e.g. to hand the already loaded
+   * function pointers over to plugins. The function pointers are copied into pTable, which pExport points to; the
+   * table must outlive every user of the export.
+   */
+  void exportTable(VolkCppExport* pExport, VolkCppTable* pTable) const noexcept;
   
 #define ALIGNMENT(index) \
   private: \
@@ -1822,6 +1855,8 @@ public:
 private:
   void genLoadLoader(void* context, PFN_vkVoidFunction (Volk::*load)(void*, char const*)) noexcept;
   void genLoadInstance(void* context, PFN_vkVoidFunction (Volk::*load)(void*, char const*)) noexcept;
+  void genExportTable(VolkCppTable* pTable) const noexcept;
+  void genImportTable(const VolkCppTable& table) noexcept;
   void genLoadDevice(void* context, PFN_vkVoidFunction (Volk::*load)(void*, char const*)) noexcept;
   [[nodiscard]] PFN_vkVoidFunction vkGetInstanceProcAddrStub(void* context, char const* name) noexcept;
   [[nodiscard]] PFN_vkVoidFunction vkGetDeviceProcAddrStub(void* context, char const* name) noexcept;
@@ -1833,6 +1868,189 @@ private:
   VkDevice loadedDevice_ = VK_NULL_HANDLE;
 };
 
+template <typename VmaVulkanFunctions>
+void Volk::fillVmaVulkanFunctions(VmaVulkanFunctions& functions) const noexcept {
+  /* VOLK_CPP_GENERATE_VMA_FUNCTIONS */
+  if constexpr (requires { functions.vkGetInstanceProcAddr; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkGetInstanceProcAddr = vkGetInstanceProcAddr;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkGetDeviceProcAddr; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkGetDeviceProcAddr = vkGetDeviceProcAddr;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkGetPhysicalDeviceProperties; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkGetPhysicalDeviceProperties = vkGetPhysicalDeviceProperties;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkGetPhysicalDeviceMemoryProperties; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkGetPhysicalDeviceMemoryProperties = vkGetPhysicalDeviceMemoryProperties;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkAllocateMemory; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkAllocateMemory = vkAllocateMemory;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkFreeMemory; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkFreeMemory = vkFreeMemory;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkMapMemory; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkMapMemory = vkMapMemory;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkUnmapMemory; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkUnmapMemory = vkUnmapMemory;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkFlushMappedMemoryRanges; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkFlushMappedMemoryRanges = vkFlushMappedMemoryRanges;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkInvalidateMappedMemoryRanges; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkInvalidateMappedMemoryRanges = vkInvalidateMappedMemoryRanges;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkBindBufferMemory; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkBindBufferMemory = vkBindBufferMemory;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkBindImageMemory; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkBindImageMemory = vkBindImageMemory;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkGetBufferMemoryRequirements; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkGetBufferMemoryRequirements = vkGetBufferMemoryRequirements;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkGetImageMemoryRequirements; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkGetImageMemoryRequirements = vkGetImageMemoryRequirements;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkCreateBuffer; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkCreateBuffer = vkCreateBuffer;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkDestroyBuffer; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkDestroyBuffer = vkDestroyBuffer;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkCreateImage; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkCreateImage = vkCreateImage;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkDestroyImage; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkDestroyImage = vkDestroyImage;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkCmdCopyBuffer; }) {
+#if defined(VK_BASE_VERSION_1_0)
+    functions.vkCmdCopyBuffer = vkCmdCopyBuffer;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+  }
+  if constexpr (requires { functions.vkGetBufferMemoryRequirements2KHR; }) {
+    functions.vkGetBufferMemoryRequirements2KHR = nullptr;
+#if defined(VK_BASE_VERSION_1_1)
+    functions.vkGetBufferMemoryRequirements2KHR = vkGetBufferMemoryRequirements2;
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_KHR_get_memory_requirements2)
+    if (!functions.vkGetBufferMemoryRequirements2KHR) {
+      functions.vkGetBufferMemoryRequirements2KHR = vkGetBufferMemoryRequirements2KHR;
+    }
+#endif /* defined(VK_KHR_get_memory_requirements2) */
+  }
+  if constexpr (requires { functions.vkGetImageMemoryRequirements2KHR; }) {
+    functions.vkGetImageMemoryRequirements2KHR = nullptr;
+#if defined(VK_BASE_VERSION_1_1)
+    functions.vkGetImageMemoryRequirements2KHR = vkGetImageMemoryRequirements2;
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_KHR_get_memory_requirements2)
+    if (!functions.vkGetImageMemoryRequirements2KHR) {
+      functions.vkGetImageMemoryRequirements2KHR = vkGetImageMemoryRequirements2KHR;
+    }
+#endif /* defined(VK_KHR_get_memory_requirements2) */
+  }
+  if constexpr (requires { functions.vkBindBufferMemory2KHR; }) {
+    functions.vkBindBufferMemory2KHR = nullptr;
+#if defined(VK_BASE_VERSION_1_1)
+    functions.vkBindBufferMemory2KHR = vkBindBufferMemory2;
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_KHR_bind_memory2)
+    if (!functions.vkBindBufferMemory2KHR) {
+      functions.vkBindBufferMemory2KHR = vkBindBufferMemory2KHR;
+    }
+#endif /* defined(VK_KHR_bind_memory2) */
+  }
+  if constexpr (requires { functions.vkBindImageMemory2KHR; }) {
+    functions.vkBindImageMemory2KHR = nullptr;
+#if defined(VK_BASE_VERSION_1_1)
+    functions.vkBindImageMemory2KHR = vkBindImageMemory2;
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_KHR_bind_memory2)
+    if (!functions.vkBindImageMemory2KHR) {
+      functions.vkBindImageMemory2KHR = vkBindImageMemory2KHR;
+    }
+#endif /* defined(VK_KHR_bind_memory2) */
+  }
+  if constexpr (requires { functions.vkGetPhysicalDeviceMemoryProperties2KHR; }) {
+    functions.vkGetPhysicalDeviceMemoryProperties2KHR = nullptr;
+#if defined(VK_BASE_VERSION_1_1)
+    functions.vkGetPhysicalDeviceMemoryProperties2KHR = vkGetPhysicalDeviceMemoryProperties2;
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_KHR_get_physical_device_properties2)
+    if (!functions.vkGetPhysicalDeviceMemoryProperties2KHR) {
+      functions.vkGetPhysicalDeviceMemoryProperties2KHR = vkGetPhysicalDeviceMemoryProperties2KHR;
+    }
+#endif /* defined(VK_KHR_get_physical_device_properties2) */
+  }
+  if constexpr (requires { functions.vkGetDeviceBufferMemoryRequirements; }) {
+    functions.vkGetDeviceBufferMemoryRequirements = nullptr;
+#if defined(VK_BASE_VERSION_1_3)
+    functions.vkGetDeviceBufferMemoryRequirements = vkGetDeviceBufferMemoryRequirements;
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_KHR_maintenance4)
+    if (!functions.vkGetDeviceBufferMemoryRequirements) {
+      functions.vkGetDeviceBufferMemoryRequirements = vkGetDeviceBufferMemoryRequirementsKHR;
+    }
+#endif /* defined(VK_KHR_maintenance4) */
+  }
+  if constexpr (requires { functions.vkGetDeviceImageMemoryRequirements; }) {
+    functions.vkGetDeviceImageMemoryRequirements = nullptr;
+#if defined(VK_BASE_VERSION_1_3)
+    functions.vkGetDeviceImageMemoryRequirements = vkGetDeviceImageMemoryRequirements;
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_KHR_maintenance4)
+    if (!functions.vkGetDeviceImageMemoryRequirements) {
+      functions.vkGetDeviceImageMemoryRequirements = vkGetDeviceImageMemoryRequirementsKHR;
+    }
+#endif /* defined(VK_KHR_maintenance4) */
+  }
+  if constexpr (requires { functions.vkGetMemoryWin32HandleKHR; }) {
+#if defined(VK_KHR_external_memory_win32)
+    functions.vkGetMemoryWin32HandleKHR = vkGetMemoryWin32HandleKHR;
+#endif /* defined(VK_KHR_external_memory_win32) */
+  }
+  /* VOLK_CPP_GENERATE_VMA_FUNCTIONS */
+}
+
 #ifdef VOLK_CPP_IMPLEMENTATION
 #undef VOLK_CPP_IMPLEMENTATION
 /* Prevent tools like dependency checkers from detecting a cyclic dependency */
@@ -0,0 +1,250 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_barrier_batcher.hpp"
+
+#if defined(VK_BASE_VERSION_1_3)
+
+#include <cstring>
+
+namespace {
+
+VkPipelineStageFlags toLegacyStages(VkPipelineStageFlags2 stages, bool source) noexcept {
+  if (stages == VK_PIPELINE_STAGE_2_NONE) {
+    return source ? VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+  }
+  VkPipelineStageFlags2 const transfer = VK_PIPELINE_STAGE_2_COPY_BIT | VK_PIPELINE_STAGE_2_RESOLVE_BIT |
+                                         VK_PIPELINE_STAGE_2_BLIT_BIT | VK_PIPELINE_STAGE_2_CLEAR_BIT;
+  VkPipelineStageFlags2 const vertexInput =
+    VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT | VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT;
+
+  auto result = static_cast<VkPipelineStageFlags>(stages & 0xffffffffull);
+  if (stages & transfer) {
+    result |= VK_PIPELINE_STAGE_TRANSFER_BIT;
+  }
+  if (stages & vertexInput) {
+    result |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+  }
+  if (stages & VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT) {
+    result |= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_TESSELLATION_CONTROL_SHADER_BIT |
+              VK_PIPELINE_STAGE_TESSELLATION_EVALUATION_SHADER_BIT | VK_PIPELINE_STAGE_GEOMETRY_SHADER_BIT;
+  }
+  if ((stages >> 32) & ~((transfer | vertexInput | VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT) >> 32)) {
+    result |= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+  }
+  return result;
+}
+
+VkAccessFlags toLegacyAccess(VkAccessFlags2 access) noexcept {
+  VkAccessFlags2 const reads = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_READ_BIT;
+
+  auto result = static_cast<VkAccessFlags>(access & 0xffffffffull);
+  if (access & reads) {
+    result |= VK_ACCESS_SHADER_READ_BIT;
+  }
+  if (access & VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT) {
+    result |= VK_ACCESS_SHADER_WRITE_BIT;
+  }
+  if ((access >> 32) & ~((reads | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT) >> 32)) {
+    result |= VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+  }
+  return result;
+}
+
+template <typename Barrier>
+void mergeMasks(Barrier& target, const Barrier& barrier) noexcept {
+  target.srcStageMask |= barrier.srcStageMask;
+  target.srcAccessMask |= barrier.srcAccessMask;
+  target.dstStageMask |= barrier.dstStageMask;
+  target.dstAccessMask |= barrier.dstAccessMask;
+}
+
+bool operator==(const VkImageSubresourceRange& a, const VkImageSubresourceRange& b) noexcept {
+  return a.aspectMask == b.aspectMask && a.baseMipLevel == b.baseMipLevel && a.levelCount == b.levelCount &&
+         a.baseArrayLayer == b.baseArrayLayer && a.layerCount == b.layerCount;
+}
+
+} // namespace
+
+VolkBarrierBatcher::VolkBarrierBatcher(Volk& volk) noexcept
+  : volk_(volk)
+  , pipelineBarrier2_(volk.vkCmdPipelineBarrier2) {
+#if defined(VK_KHR_synchronization2)
+  if (!pipelineBarrier2_) {
+    pipelineBarrier2_ = volk.vkCmdPipelineBarrier2KHR;
+  }
+#endif
+}
+
+VkResult VolkBarrierBatcher::getStatus() const noexcept {
+  return pipelineBarrier2_ ? VK_SUCCESS : VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+const VolkBarrierBatcher::Stats& VolkBarrierBatcher::getStats() const noexcept {
+  return stats_;
+}
+
+void VolkBarrierBatcher::vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer,
+                                               const VkDependencyInfo* pDependencyInfo) noexcept {
+  auto const& info = *pDependencyInfo;
+  stats_.barriers += info.memoryBarrierCount + info.bufferMemoryBarrierCount + info.imageMemoryBarrierCount;
+
+  bool chained = info.pNext != nullptr;
+  for (uint32_t i = 0; i < info.memoryBarrierCount && !chained; ++i) {
+    chained = info.pMemoryBarriers[i].pNext != nullptr;
+  }
+  for (uint32_t i = 0; i < info.bufferMemoryBarrierCount && !chained; ++i) {
+    chained = info.pBufferMemoryBarriers[i].pNext != nullptr;
+  }
+  for (uint32_t i = 0; i < info.imageMemoryBarrierCount && !chained; ++i) {
+    chained = info.pImageMemoryBarriers[i].pNext != nullptr;
+  }
+
+  if (chained || commandBuffer != commandBuffer_ || info.dependencyFlags != dependencyFlags_) {
+    flush();
+  }
+  if (chained) {
+    record(commandBuffer, info);
+    return;
+  }
+
+  commandBuffer_ = commandBuffer;
+  dependencyFlags_ = info.dependencyFlags;
+  for (uint32_t i = 0; i < info.memoryBarrierCount; ++i) {
+    addMemoryBarrier(info.pMemoryBarriers[i]);
+  }
+  for (uint32_t i = 0; i < info.bufferMemoryBarrierCount; ++i) {
+    addBufferBarrier(info.pBufferMemoryBarriers[i]);
+  }
+  for (uint32_t i = 0; i < info.imageMemoryBarrierCount; ++i) {
+    addImageBarrier(info.pImageMemoryBarriers[i]);
+  }
+}
+
+void VolkBarrierBatcher::addMemoryBarrier(const VkMemoryBarrier2& barrier) noexcept {
+  if (memoryBarriers_.empty()) {
+    memoryBarriers_.push_back(barrier);
+    return;
+  }
+  mergeMasks(memoryBarriers_[0], barrier);
+  ++stats_.merged;
+}
+
+void VolkBarrierBatcher::addBufferBarrier(const VkBufferMemoryBarrier2& barrier) noexcept {
+  for (auto& pending : bufferBarriers_) {
+    if (pending.buffer != barrier.buffer) {
+      continue;
+    }
+    if (pending.offset == barrier.offset && pending.size == barrier.size &&
+        pending.srcQueueFamilyIndex == barrier.srcQueueFamilyIndex &&
+        pending.dstQueueFamilyIndex == barrier.dstQueueFamilyIndex) {
+      mergeMasks(pending, barrier);
+      ++stats_.merged;
+      return;
+    }
+    flush();
+    break;
+  }
+  bufferBarriers_.push_back(barrier);
+}
+
+void VolkBarrierBatcher::addImageBarrier(const VkImageMemoryBarrier2& barrier) noexcept {
+  for (auto& pending : imageBarriers_) {
+    if (pending.image != barrier.image) {
+      continue;
+    }
+    if (pending.subresourceRange == barrier.subresourceRange && pending.oldLayout == barrier.oldLayout &&
+        pending.newLayout == barrier.newLayout && pending.srcQueueFamilyIndex == barrier.srcQueueFamilyIndex &&
+        pending.dstQueueFamilyIndex == barrier.dstQueueFamilyIndex) {
+      mergeMasks(pending, barrier);
+      ++stats_.merged;
+      return;
+    }
+    flush();
+    break;
+  }
+  imageBarriers_.push_back(barrier);
+}
+
+void VolkBarrierBatcher::flush() noexcept {
+  if (memoryBarriers_.empty() && bufferBarriers_.empty() && imageBarriers_.empty()) {
+    return;
+  }
+
+  VkDependencyInfo info = {};
+  info.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+  info.dependencyFlags = dependencyFlags_;
+  info.memoryBarrierCount = static_cast<uint32_t>(memoryBarriers_.size());
+  info.pMemoryBarriers = memoryBarriers_.data();
+  info.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferBarriers_.size());
+  info.pBufferMemoryBarriers = bufferBarriers_.data();
+  info.imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers_.size());
+  info.pImageMemoryBarriers = imageBarriers_.data();
+  record(commandBuffer_, info);
+
+  memoryBarriers_.clear();
+  bufferBarriers_.clear();
+  imageBarriers_.clear();
+}
+
+void VolkBarrierBatcher::record(VkCommandBuffer commandBuffer, const VkDependencyInfo& dependencyInfo) noexcept {
+  ++stats_.driverCalls;
+  if (pipelineBarrier2_) {
+    pipelineBarrier2_(commandBuffer, &dependencyInfo);
+    return;
+  }
+
+  // pNext chains of synchronization2 structures have no legacy equivalent and are dropped.
+  VkPipelineStageFlags2 srcStages = 0;
+  VkPipelineStageFlags2 dstStages = 0;
+  VkMemoryBarrier memoryBarrier = {};
+  memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+  for (uint32_t i = 0; i < dependencyInfo.memoryBarrierCount; ++i) {
+    auto const& barrier = dependencyInfo.pMemoryBarriers[i];
+    srcStages |= barrier.srcStageMask;
+    dstStages |= barrier.dstStageMask;
+    memoryBarrier.srcAccessMask |= toLegacyAccess(barrier.srcAccessMask);
+    memoryBarrier.dstAccessMask |= toLegacyAccess(barrier.dstAccessMask);
+  }
+
+  legacyBufferBarriers_.clear();
+  for (uint32_t i = 0; i < dependencyInfo.bufferMemoryBarrierCount; ++i) {
+    auto const& barrier = dependencyInfo.pBufferMemoryBarriers[i];
+    srcStages |= barrier.srcStageMask;
+    dstStages |= barrier.dstStageMask;
+    VkBufferMemoryBarrier legacy = {};
+    legacy.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    legacy.srcAccessMask = toLegacyAccess(barrier.srcAccessMask);
+    legacy.dstAccessMask = toLegacyAccess(barrier.dstAccessMask);
+    legacy.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+    legacy.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+    legacy.buffer = barrier.buffer;
+    legacy.offset = barrier.offset;
+    legacy.size = barrier.size;
+    legacyBufferBarriers_.push_back(legacy);
+  }
+
+  legacyImageBarriers_.clear();
+  for (uint32_t i = 0; i < dependencyInfo.imageMemoryBarrierCount; ++i) {
+    auto const& barrier = dependencyInfo.pImageMemoryBarriers[i];
+    srcStages |= barrier.srcStageMask;
+    dstStages |= barrier.dstStageMask;
+    VkImageMemoryBarrier legacy = {};
+    legacy.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    legacy.srcAccessMask = toLegacyAccess(barrier.srcAccessMask);
+    legacy.dstAccessMask = toLegacyAccess(barrier.dstAccessMask);
+    legacy.oldLayout = barrier.oldLayout;
+    legacy.newLayout = barrier.newLayout;
+    legacy.srcQueueFamilyIndex = barrier.srcQueueFamilyIndex;
+    legacy.dstQueueFamilyIndex = barrier.dstQueueFamilyIndex;
+    legacy.image = barrier.image;
+    legacy.subresourceRange = barrier.subresourceRange;
+    legacyImageBarriers_.push_back(legacy);
+  }
+
+  volk_.vkCmdPipelineBarrier(commandBuffer, toLegacyStages(srcStages, true), toLegacyStages(dstStages, false),
+                             dependencyInfo.dependencyFlags, dependencyInfo.memoryBarrierCount != 0 ? 1 : 0,
+                             &memoryBarrier, static_cast<uint32_t>(legacyBufferBarriers_.size()),
+                             legacyBufferBarriers_.data(), static_cast<uint32_t>(legacyImageBarriers_.size()),
+                             legacyImageBarriers_.data());
+}
+
+#endif
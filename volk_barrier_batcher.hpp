@@ -0,0 +1,85 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(VK_BASE_VERSION_1_3)
+
+/**
+ * Accumulates pipeline barriers and records them as one vkCmdPipelineBarrier2 call right before the next action
+ * command.
+ *
+ * Barriers passed to vkCmdPipelineBarrier2 of this class are gathered until flush() or call(): all memory barriers
+ * merge into one, and barriers on the same buffer range or image subresource range with the same layouts and queue
+ * families merge their stage and access masks. A barrier on a resource already pending with a different range or
+ * transition flushes the batch first, so transitions of a resource keep their order. Structures with a pNext chain
+ * flush the batch and are forwarded as they are.
+ *
+ * Without synchronization2 the batch is recorded with vkCmdPipelineBarrier: stage masks of all barriers are combined
+ * and synchronization2-only stage and access bits are mapped to their legacy equivalents.
+ *
+ * A batcher is meant to be used by one recording thread; its arrays are reused across batches.
+ */
+class VolkBarrierBatcher final {
+public:
+  struct Stats {
+    uint64_t barriers = 0;    // barriers passed to the batcher
+    uint64_t merged = 0;      // barriers merged into a pending one
+    uint64_t driverCalls = 0; // barrier calls that reached the driver
+  };
+
+  /**
+   * Volk must have device function pointers loaded.
+   */
+  explicit VolkBarrierBatcher(Volk& volk) noexcept;
+  VolkBarrierBatcher(const VolkBarrierBatcher&) = delete;
+  VolkBarrierBatcher& operator=(const VolkBarrierBatcher&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if barriers are recorded with vkCmdPipelineBarrier because neither
+   * Vulkan 1.3 nor VK_KHR_synchronization2 is loaded.
+   */
+  [[nodiscard]] VkResult getStatus() const noexcept;
+
+  void vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) noexcept;
+
+  /**
+   * Record the pending barriers.
+   */
+  void flush() noexcept;
+
+  /**
+   * Flush, then call a Vulkan function pointer, e.g. call(volk.vkCmdDispatch, cmd, x, y, z).
+   */
+  template <typename Function, typename... Args>
+  decltype(auto) call(Function function, Args... args) noexcept {
+    flush();
+    return function(args...);
+  }
+
+  [[nodiscard]] const Stats& getStats() const noexcept;
+
+private:
+  void addMemoryBarrier(const VkMemoryBarrier2& barrier) noexcept;
+  void addBufferBarrier(const VkBufferMemoryBarrier2& barrier) noexcept;
+  void addImageBarrier(const VkImageMemoryBarrier2& barrier) noexcept;
+  void record(VkCommandBuffer commandBuffer, const VkDependencyInfo& dependencyInfo) noexcept;
+
+  Volk& volk_;
+  PFN_vkCmdPipelineBarrier2 pipelineBarrier2_ = nullptr;
+  Stats stats_;
+
+  VkCommandBuffer commandBuffer_ = VK_NULL_HANDLE;
+  VkDependencyFlags dependencyFlags_ = 0;
+  std::vector<VkMemoryBarrier2> memoryBarriers_; // at most one
+  std::vector<VkBufferMemoryBarrier2> bufferBarriers_;
+  std::vector<VkImageMemoryBarrier2> imageBarriers_;
+
+  std::vector<VkBufferMemoryBarrier> legacyBufferBarriers_;
+  std::vector<VkImageMemoryBarrier> legacyImageBarriers_;
+};
+
+#endif
@@ -0,0 +1,123 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_command_allocator.hpp"
+
+#if defined(VK_BASE_VERSION_1_2)
+
+#include <algorithm>
+
+namespace {
+
+constexpr uint32_t kMinBatchSize = 8;
+
+} // namespace
+
+VolkCommandAllocator::VolkCommandAllocator(Volk& volk, VkDevice device, uint32_t queueFamilyIndex,
+                                           VkSemaphore timelineSemaphore, uint32_t framesInFlight /* = 2 */) noexcept
+  : volk_(volk)
+  , device_(device)
+  , queueFamilyIndex_(queueFamilyIndex)
+  , timelineSemaphore_(timelineSemaphore)
+  , framesInFlight_(std::clamp<uint32_t>(framesInFlight, 1, kMaxFramesInFlight))
+  , getSemaphoreCounterValue_(volk.vkGetSemaphoreCounterValue)
+  , waitSemaphores_(volk.vkWaitSemaphores) {
+#if defined(VK_KHR_timeline_semaphore)
+  if (!getSemaphoreCounterValue_ || !waitSemaphores_) {
+    getSemaphoreCounterValue_ = volk.vkGetSemaphoreCounterValueKHR;
+    waitSemaphores_ = volk.vkWaitSemaphoresKHR;
+  }
+#endif
+}
+
+VolkCommandAllocator::~VolkCommandAllocator() noexcept {
+  for (auto& slot : threadSlots_) {
+    for (auto& pool : slot.pools) {
+      if (pool.pool != VK_NULL_HANDLE) {
+        volk_.vkDestroyCommandPool(device_, pool.pool, nullptr);
+      }
+    }
+  }
+}
+
+VkResult VolkCommandAllocator::getStatus() noexcept {
+  return getSemaphoreCounterValue_ && waitSemaphores_ ? VK_SUCCESS : VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+VkResult VolkCommandAllocator::beginFrame(uint64_t signalValue) noexcept {
+  auto const frame = static_cast<uint32_t>(frameCount_++ % framesInFlight_);
+  auto const waitValue = frameValues_[frame];
+
+  uint64_t value = 0;
+  auto result = getSemaphoreCounterValue_(device_, timelineSemaphore_, &value);
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+  if (value < waitValue) {
+    VkSemaphoreWaitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &timelineSemaphore_;
+    waitInfo.pValues = &waitValue;
+    result = waitSemaphores_(device_, &waitInfo, UINT64_MAX);
+    if (result != VK_SUCCESS) {
+      return result;
+    }
+  }
+
+  for (auto& slot : threadSlots_) {
+    auto& pool = slot.pools[frame];
+    if (pool.used[0] + pool.used[1] == 0) {
+      continue;
+    }
+    result = volk_.vkResetCommandPool(device_, pool.pool, 0);
+    if (result != VK_SUCCESS) {
+      return result;
+    }
+    pool.used[0] = 0;
+    pool.used[1] = 0;
+  }
+
+  frameValues_[frame] = signalValue;
+  currentFrame_.store(frame, std::memory_order_release);
+  return VK_SUCCESS;
+}
+
+VkCommandBuffer VolkCommandAllocator::allocate(
+  VkCommandBufferLevel level /* = VK_COMMAND_BUFFER_LEVEL_PRIMARY */) noexcept {
+  auto const index = slots_.acquire();
+  if (index == slots_.kSharedSlot) {
+    return VK_NULL_HANDLE;
+  }
+
+  auto& pool = threadSlots_[index].pools[currentFrame_.load(std::memory_order_acquire)];
+  if (pool.pool == VK_NULL_HANDLE) {
+    VkCommandPoolCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    createInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    createInfo.queueFamilyIndex = queueFamilyIndex_;
+    if (volk_.vkCreateCommandPool(device_, &createInfo, nullptr, &pool.pool) != VK_SUCCESS) {
+      pool.pool = VK_NULL_HANDLE;
+      return VK_NULL_HANDLE;
+    }
+  }
+
+  auto const levelIndex = level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ? 0 : 1;
+  auto& buffers = pool.buffers[levelIndex];
+  auto& used = pool.used[levelIndex];
+  if (used == buffers.size()) {
+    // Grow by doubling, so a thread settles on a pool size after a few frames.
+    auto const count = std::max<uint32_t>(kMinBatchSize, static_cast<uint32_t>(buffers.size()));
+    VkCommandBufferAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocateInfo.commandPool = pool.pool;
+    allocateInfo.level = level;
+    allocateInfo.commandBufferCount = count;
+    buffers.resize(used + count);
+    if (volk_.vkAllocateCommandBuffers(device_, &allocateInfo, buffers.data() + used) != VK_SUCCESS) {
+      buffers.resize(used);
+      return VK_NULL_HANDLE;
+    }
+  }
+  return buffers[used++];
+}
+
+#endif /* defined(VK_BASE_VERSION_1_2) */
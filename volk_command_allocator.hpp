@@ -0,0 +1,85 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_thread_slots.hpp"
+
+#if defined(VK_BASE_VERSION_1_2)
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Command buffer allocator for parallel recording: a ring of command pools per thread and frame in flight.
+ *
+ * Command buffers are allocated from the pools with vkAllocateCommandBuffers in growing batches and handed out by
+ * bumping an index. beginFrame() moves to the next ring entry, waits on the timeline semaphore until the work recorded
+ * in that entry has completed, and resets each of its pools at once with vkResetCommandPool.
+ *
+ * allocate() may be called from any number of threads between beginFrame() calls; beginFrame() must not run
+ * concurrently with allocate(). Command buffers are valid until their ring entry is reused.
+ *
+ * Each thread owns its pools, since recording into a command buffer is externally synchronized with its pool. Up to
+ * kMaxThreads threads get pools at the same time; a thread past that gets VK_NULL_HANDLE from allocate() for as long as
+ * it runs, and pools of exited threads are handed to new threads.
+ */
+class VolkCommandAllocator final {
+public:
+  static constexpr uint32_t kMaxThreads = 16;
+  static constexpr uint32_t kMaxFramesInFlight = 4;
+
+  /**
+   * Volk must have device function pointers loaded for the given device. timelineSemaphore is signaled by the
+   * application when a frame's command buffers have completed, with the value given to beginFrame().
+   */
+  VolkCommandAllocator(Volk& volk, VkDevice device, uint32_t queueFamilyIndex, VkSemaphore timelineSemaphore,
+                       uint32_t framesInFlight = 2) noexcept;
+  ~VolkCommandAllocator() noexcept;
+  VolkCommandAllocator(const VolkCommandAllocator&) = delete;
+  VolkCommandAllocator& operator=(const VolkCommandAllocator&) = delete;
+
+  /**
+   * Returns VK_SUCCESS, or VK_ERROR_EXTENSION_NOT_PRESENT if timeline semaphore functions aren't loaded.
+   */
+  [[nodiscard]] VkResult getStatus() noexcept;
+
+  /**
+   * Start a frame whose command buffers will be complete once the timeline semaphore reaches signalValue.
+   * Blocks until the frame previously recorded in the same ring entry has completed.
+   */
+  VkResult beginFrame(uint64_t signalValue) noexcept;
+
+  /**
+   * Command buffer from the calling thread's pool of the current frame, or VK_NULL_HANDLE on allocation failure and
+   * on threads which found no free pool.
+   */
+  [[nodiscard]] VkCommandBuffer allocate(VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY) noexcept;
+
+private:
+  struct Pool {
+    VkCommandPool pool = VK_NULL_HANDLE;
+    std::vector<VkCommandBuffer> buffers[2]; // primary, secondary
+    size_t used[2] = {};
+  };
+
+  struct Slot {
+    Pool pools[kMaxFramesInFlight];
+  };
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  uint32_t queueFamilyIndex_ = 0;
+  VkSemaphore timelineSemaphore_ = VK_NULL_HANDLE;
+  uint32_t framesInFlight_ = 2;
+  PFN_vkGetSemaphoreCounterValue getSemaphoreCounterValue_ = nullptr;
+  PFN_vkWaitSemaphores waitSemaphores_ = nullptr;
+
+  VolkThreadSlots<kMaxThreads + 1> slots_; // the shared slot has no pools
+  Slot threadSlots_[kMaxThreads];
+  uint64_t frameValues_[kMaxFramesInFlight] = {};
+  uint64_t frameCount_ = 0;
+  std::atomic<uint32_t> currentFrame_ = 0;
+};
+
+#endif /* defined(VK_BASE_VERSION_1_2) */
@@ -0,0 +1,2162 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_deferred_commands.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+enum class VolkDeferredCommands::Op : uint32_t {
+  Data, // arrays referenced by other commands, skipped by replay
+  /* VOLK_CPP_GENERATE_DEFERRED_OPS */
+#if defined(VK_BASE_VERSION_1_0)
+  BeginQuery,
+  CopyBuffer,
+  CopyBufferToImage,
+  CopyImage,
+  CopyImageToBuffer,
+  CopyQueryPoolResults,
+  EndQuery,
+  ExecuteCommands,
+  FillBuffer,
+  PipelineBarrier,
+  ResetQueryPool,
+  UpdateBuffer,
+  WriteTimestamp,
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+  BindDescriptorSets,
+  BindPipeline,
+  ClearColorImage,
+  Dispatch,
+  DispatchIndirect,
+  PushConstants,
+  ResetEvent,
+  SetEvent,
+  WaitEvents,
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  BeginRenderPass,
+  BindIndexBuffer,
+  BindVertexBuffers,
+  BlitImage,
+  ClearAttachments,
+  ClearDepthStencilImage,
+  Draw,
+  DrawIndexed,
+  DrawIndexedIndirect,
+  DrawIndirect,
+  EndRenderPass,
+  NextSubpass,
+  ResolveImage,
+  SetBlendConstants,
+  SetDepthBias,
+  SetDepthBounds,
+  SetLineWidth,
+  SetScissor,
+  SetStencilCompareMask,
+  SetStencilReference,
+  SetStencilWriteMask,
+  SetViewport,
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_BASE_VERSION_1_1)
+  SetDeviceMask,
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+  DispatchBase,
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  BeginRenderPass2,
+  DrawIndexedIndirectCount,
+  DrawIndirectCount,
+  EndRenderPass2,
+  NextSubpass2,
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+  CopyBuffer2,
+  CopyBufferToImage2,
+  CopyImage2,
+  CopyImageToBuffer2,
+  PipelineBarrier2,
+  WriteTimestamp2,
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_3)
+  ResetEvent2,
+  SetEvent2,
+  WaitEvents2,
+#endif /* defined(VK_COMPUTE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+  BeginRendering,
+  BindVertexBuffers2,
+  BlitImage2,
+  EndRendering,
+  ResolveImage2,
+  SetCullMode,
+  SetDepthBiasEnable,
+  SetDepthBoundsTestEnable,
+  SetDepthCompareOp,
+  SetDepthTestEnable,
+  SetDepthWriteEnable,
+  SetFrontFace,
+  SetPrimitiveRestartEnable,
+  SetPrimitiveTopology,
+  SetRasterizerDiscardEnable,
+  SetScissorWithCount,
+  SetStencilOp,
+  SetStencilTestEnable,
+  SetViewportWithCount,
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+  BindDescriptorSets2,
+  PushConstants2,
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+  BindIndexBuffer2,
+  SetLineStipple,
+  SetRenderingAttachmentLocations,
+  SetRenderingInputAttachmentIndices,
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+  /* VOLK_CPP_GENERATE_DEFERRED_OPS */
+};
+
+namespace {
+constexpr size_t kChunkSize = 64 * 1024;
+constexpr size_t kAlignment = 8;
+
+// Every allocation in the stream is prefixed with a header; payloads are 8-byte aligned, which is enough for all
+// Vulkan structures.
+struct Header {
+  uint32_t op = 0;
+  uint32_t size = 0; // payload size, multiple of kAlignment
+};
+static_assert(sizeof(Header) == kAlignment);
+
+constexpr size_t alignSize(size_t size) noexcept {
+  return (size + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+/* VOLK_CPP_GENERATE_DEFERRED_STRUCTS */
+#if defined(VK_BASE_VERSION_1_0)
+struct BeginQueryCmd {
+  VkQueryPool queryPool;
+  uint32_t query;
+  VkQueryControlFlags flags;
+};
+
+struct CopyBufferCmd {
+  VkBuffer srcBuffer;
+  VkBuffer dstBuffer;
+  uint32_t regionCount;
+  const VkBufferCopy* pRegions;
+};
+
+struct CopyBufferToImageCmd {
+  VkBuffer srcBuffer;
+  VkImage dstImage;
+  VkImageLayout dstImageLayout;
+  uint32_t regionCount;
+  const VkBufferImageCopy* pRegions;
+};
+
+struct CopyImageCmd {
+  VkImage srcImage;
+  VkImageLayout srcImageLayout;
+  VkImage dstImage;
+  VkImageLayout dstImageLayout;
+  uint32_t regionCount;
+  const VkImageCopy* pRegions;
+};
+
+struct CopyImageToBufferCmd {
+  VkImage srcImage;
+  VkImageLayout srcImageLayout;
+  VkBuffer dstBuffer;
+  uint32_t regionCount;
+  const VkBufferImageCopy* pRegions;
+};
+
+struct CopyQueryPoolResultsCmd {
+  VkQueryPool queryPool;
+  uint32_t firstQuery;
+  uint32_t queryCount;
+  VkBuffer dstBuffer;
+  VkDeviceSize dstOffset;
+  VkDeviceSize stride;
+  VkQueryResultFlags flags;
+};
+
+struct EndQueryCmd {
+  VkQueryPool queryPool;
+  uint32_t query;
+};
+
+struct ExecuteCommandsCmd {
+  uint32_t commandBufferCount;
+  const VkCommandBuffer* pCommandBuffers;
+};
+
+struct FillBufferCmd {
+  VkBuffer dstBuffer;
+  VkDeviceSize dstOffset;
+  VkDeviceSize size;
+  uint32_t data;
+};
+
+struct PipelineBarrierCmd {
+  VkPipelineStageFlags srcStageMask;
+  VkPipelineStageFlags dstStageMask;
+  VkDependencyFlags dependencyFlags;
+  uint32_t memoryBarrierCount;
+  const VkMemoryBarrier* pMemoryBarriers;
+  uint32_t bufferMemoryBarrierCount;
+  const VkBufferMemoryBarrier* pBufferMemoryBarriers;
+  uint32_t imageMemoryBarrierCount;
+  const VkImageMemoryBarrier* pImageMemoryBarriers;
+};
+
+struct ResetQueryPoolCmd {
+  VkQueryPool queryPool;
+  uint32_t firstQuery;
+  uint32_t queryCount;
+};
+
+struct UpdateBufferCmd {
+  VkBuffer dstBuffer;
+  VkDeviceSize dstOffset;
+  VkDeviceSize dataSize;
+  const void* pData;
+};
+
+struct WriteTimestampCmd {
+  VkPipelineStageFlagBits pipelineStage;
+  VkQueryPool queryPool;
+  uint32_t query;
+};
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+struct BindDescriptorSetsCmd {
+  VkPipelineBindPoint pipelineBindPoint;
+  VkPipelineLayout layout;
+  uint32_t firstSet;
+  uint32_t descriptorSetCount;
+  const VkDescriptorSet* pDescriptorSets;
+  uint32_t dynamicOffsetCount;
+  const uint32_t* pDynamicOffsets;
+};
+
+struct BindPipelineCmd {
+  VkPipelineBindPoint pipelineBindPoint;
+  VkPipeline pipeline;
+};
+
+struct ClearColorImageCmd {
+  VkImage image;
+  VkImageLayout imageLayout;
+  const VkClearColorValue* pColor;
+  uint32_t rangeCount;
+  const VkImageSubresourceRange* pRanges;
+};
+
+struct DispatchCmd {
+  uint32_t groupCountX;
+  uint32_t groupCountY;
+  uint32_t groupCountZ;
+};
+
+struct DispatchIndirectCmd {
+  VkBuffer buffer;
+  VkDeviceSize offset;
+};
+
+struct PushConstantsCmd {
+  VkPipelineLayout layout;
+  VkShaderStageFlags stageFlags;
+  uint32_t offset;
+  uint32_t size;
+  const void* pValues;
+};
+
+struct ResetEventCmd {
+  VkEvent event;
+  VkPipelineStageFlags stageMask;
+};
+
+struct SetEventCmd {
+  VkEvent event;
+  VkPipelineStageFlags stageMask;
+};
+
+struct WaitEventsCmd {
+  uint32_t eventCount;
+  const VkEvent* pEvents;
+  VkPipelineStageFlags srcStageMask;
+  VkPipelineStageFlags dstStageMask;
+  uint32_t memoryBarrierCount;
+  const VkMemoryBarrier* pMemoryBarriers;
+  uint32_t bufferMemoryBarrierCount;
+  const VkBufferMemoryBarrier* pBufferMemoryBarriers;
+  uint32_t imageMemoryBarrierCount;
+  const VkImageMemoryBarrier* pImageMemoryBarriers;
+};
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+struct BeginRenderPassCmd {
+  const VkRenderPassBeginInfo* pRenderPassBegin;
+  VkSubpassContents contents;
+};
+
+struct BindIndexBufferCmd {
+  VkBuffer buffer;
+  VkDeviceSize offset;
+  VkIndexType indexType;
+};
+
+struct BindVertexBuffersCmd {
+  uint32_t firstBinding;
+  uint32_t bindingCount;
+  const VkBuffer* pBuffers;
+  const VkDeviceSize* pOffsets;
+};
+
+struct BlitImageCmd {
+  VkImage srcImage;
+  VkImageLayout srcImageLayout;
+  VkImage dstImage;
+  VkImageLayout dstImageLayout;
+  uint32_t regionCount;
+  const VkImageBlit* pRegions;
+  VkFilter filter;
+};
+
+struct ClearAttachmentsCmd {
+  uint32_t attachmentCount;
+  const VkClearAttachment* pAttachments;
+  uint32_t rectCount;
+  const VkClearRect* pRects;
+};
+
+struct ClearDepthStencilImageCmd {
+  VkImage image;
+  VkImageLayout imageLayout;
+  const VkClearDepthStencilValue* pDepthStencil;
+  uint32_t rangeCount;
+  const VkImageSubresourceRange* pRanges;
+};
+
+struct DrawCmd {
+  uint32_t vertexCount;
+  uint32_t instanceCount;
+  uint32_t firstVertex;
+  uint32_t firstInstance;
+};
+
+struct DrawIndexedCmd {
+  uint32_t indexCount;
+  uint32_t instanceCount;
+  uint32_t firstIndex;
+  int32_t vertexOffset;
+  uint32_t firstInstance;
+};
+
+struct DrawIndexedIndirectCmd {
+  VkBuffer buffer;
+  VkDeviceSize offset;
+  uint32_t drawCount;
+  uint32_t stride;
+};
+
+struct DrawIndirectCmd {
+  VkBuffer buffer;
+  VkDeviceSize offset;
+  uint32_t drawCount;
+  uint32_t stride;
+};
+
+struct NextSubpassCmd {
+  VkSubpassContents contents;
+};
+
+struct ResolveImageCmd {
+  VkImage srcImage;
+  VkImageLayout srcImageLayout;
+  VkImage dstImage;
+  VkImageLayout dstImageLayout;
+  uint32_t regionCount;
+  const VkImageResolve* pRegions;
+};
+
+struct SetBlendConstantsCmd {
+  float blendConstants[4];
+};
+
+struct SetDepthBiasCmd {
+  float depthBiasConstantFactor;
+  float depthBiasClamp;
+  float depthBiasSlopeFactor;
+};
+
+struct SetDepthBoundsCmd {
+  float minDepthBounds;
+  float maxDepthBounds;
+};
+
+struct SetLineWidthCmd {
+  float lineWidth;
+};
+
+struct SetScissorCmd {
+  uint32_t firstScissor;
+  uint32_t scissorCount;
+  const VkRect2D* pScissors;
+};
+
+struct SetStencilCompareMaskCmd {
+  VkStencilFaceFlags faceMask;
+  uint32_t compareMask;
+};
+
+struct SetStencilReferenceCmd {
+  VkStencilFaceFlags faceMask;
+  uint32_t reference;
+};
+
+struct SetStencilWriteMaskCmd {
+  VkStencilFaceFlags faceMask;
+  uint32_t writeMask;
+};
+
+struct SetViewportCmd {
+  uint32_t firstViewport;
+  uint32_t viewportCount;
+  const VkViewport* pViewports;
+};
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_BASE_VERSION_1_1)
+struct SetDeviceMaskCmd {
+  uint32_t deviceMask;
+};
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+struct DispatchBaseCmd {
+  uint32_t baseGroupX;
+  uint32_t baseGroupY;
+  uint32_t baseGroupZ;
+  uint32_t groupCountX;
+  uint32_t groupCountY;
+  uint32_t groupCountZ;
+};
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+struct BeginRenderPass2Cmd {
+  const VkRenderPassBeginInfo* pRenderPassBegin;
+  const VkSubpassBeginInfo* pSubpassBeginInfo;
+};
+
+struct DrawIndexedIndirectCountCmd {
+  VkBuffer buffer;
+  VkDeviceSize offset;
+  VkBuffer countBuffer;
+  VkDeviceSize countBufferOffset;
+  uint32_t maxDrawCount;
+  uint32_t stride;
+};
+
+struct DrawIndirectCountCmd {
+  VkBuffer buffer;
+  VkDeviceSize offset;
+  VkBuffer countBuffer;
+  VkDeviceSize countBufferOffset;
+  uint32_t maxDrawCount;
+  uint32_t stride;
+};
+
+struct EndRenderPass2Cmd {
+  const VkSubpassEndInfo* pSubpassEndInfo;
+};
+
+struct NextSubpass2Cmd {
+  const VkSubpassBeginInfo* pSubpassBeginInfo;
+  const VkSubpassEndInfo* pSubpassEndInfo;
+};
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+struct CopyBuffer2Cmd {
+  const VkCopyBufferInfo2* pCopyBufferInfo;
+};
+
+struct CopyBufferToImage2Cmd {
+  const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo;
+};
+
+struct CopyImage2Cmd {
+  const VkCopyImageInfo2* pCopyImageInfo;
+};
+
+struct CopyImageToBuffer2Cmd {
+  const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo;
+};
+
+struct PipelineBarrier2Cmd {
+  const VkDependencyInfo* pDependencyInfo;
+};
+
+struct WriteTimestamp2Cmd {
+  VkPipelineStageFlags2 stage;
+  VkQueryPool queryPool;
+  uint32_t query;
+};
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_3)
+struct ResetEvent2Cmd {
+  VkEvent event;
+  VkPipelineStageFlags2 stageMask;
+};
+
+struct SetEvent2Cmd {
+  VkEvent event;
+  const VkDependencyInfo* pDependencyInfo;
+};
+
+struct WaitEvents2Cmd {
+  uint32_t eventCount;
+  const VkEvent* pEvents;
+  const VkDependencyInfo* pDependencyInfos;
+};
+#endif /* defined(VK_COMPUTE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+struct BeginRenderingCmd {
+  const VkRenderingInfo* pRenderingInfo;
+};
+
+struct BindVertexBuffers2Cmd {
+  uint32_t firstBinding;
+  uint32_t bindingCount;
+  const VkBuffer* pBuffers;
+  const VkDeviceSize* pOffsets;
+  const VkDeviceSize* pSizes;
+  const VkDeviceSize* pStrides;
+};
+
+struct BlitImage2Cmd {
+  const VkBlitImageInfo2* pBlitImageInfo;
+};
+
+struct ResolveImage2Cmd {
+  const VkResolveImageInfo2* pResolveImageInfo;
+};
+
+struct SetCullModeCmd {
+  VkCullModeFlags cullMode;
+};
+
+struct SetDepthBiasEnableCmd {
+  VkBool32 depthBiasEnable;
+};
+
+struct SetDepthBoundsTestEnableCmd {
+  VkBool32 depthBoundsTestEnable;
+};
+
+struct SetDepthCompareOpCmd {
+  VkCompareOp depthCompareOp;
+};
+
+struct SetDepthTestEnableCmd {
+  VkBool32 depthTestEnable;
+};
+
+struct SetDepthWriteEnableCmd {
+  VkBool32 depthWriteEnable;
+};
+
+struct SetFrontFaceCmd {
+  VkFrontFace frontFace;
+};
+
+struct SetPrimitiveRestartEnableCmd {
+  VkBool32 primitiveRestartEnable;
+};
+
+struct SetPrimitiveTopologyCmd {
+  VkPrimitiveTopology primitiveTopology;
+};
+
+struct SetRasterizerDiscardEnableCmd {
+  VkBool32 rasterizerDiscardEnable;
+};
+
+struct SetScissorWithCountCmd {
+  uint32_t scissorCount;
+  const VkRect2D* pScissors;
+};
+
+struct SetStencilOpCmd {
+  VkStencilFaceFlags faceMask;
+  VkStencilOp failOp;
+  VkStencilOp passOp;
+  VkStencilOp depthFailOp;
+  VkCompareOp compareOp;
+};
+
+struct SetStencilTestEnableCmd {
+  VkBool32 stencilTestEnable;
+};
+
+struct SetViewportWithCountCmd {
+  uint32_t viewportCount;
+  const VkViewport* pViewports;
+};
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+struct BindDescriptorSets2Cmd {
+  const VkBindDescriptorSetsInfo* pBindDescriptorSetsInfo;
+};
+
+struct PushConstants2Cmd {
+  const VkPushConstantsInfo* pPushConstantsInfo;
+};
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+struct BindIndexBuffer2Cmd {
+  VkBuffer buffer;
+  VkDeviceSize offset;
+  VkDeviceSize size;
+  VkIndexType indexType;
+};
+
+struct SetLineStippleCmd {
+  uint32_t lineStippleFactor;
+  uint16_t lineStipplePattern;
+};
+
+struct SetRenderingAttachmentLocationsCmd {
+  const VkRenderingAttachmentLocationInfo* pLocationInfo;
+};
+
+struct SetRenderingInputAttachmentIndicesCmd {
+  const VkRenderingInputAttachmentIndexInfo* pInputAttachmentIndexInfo;
+};
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+/* VOLK_CPP_GENERATE_DEFERRED_STRUCTS */
+} // namespace
+
+void* VolkDeferredCommands::allocate(Op op, size_t size) noexcept {
+  size = alignSize(size);
+  auto const required = sizeof(Header) + size;
+
+  while (current_ < chunks_.size() && chunks_[current_].used + required > chunks_[current_].size) {
+    ++current_;
+  }
+  if (current_ == chunks_.size()) {
+    // Oversized arrays get a chunk of their own.
+    Chunk chunk;
+    chunk.size = std::max(kChunkSize, required);
+    chunk.data.reset(new (std::nothrow) uint8_t[chunk.size]);
+    if (!chunk.data) {
+      status_ = VK_ERROR_OUT_OF_HOST_MEMORY;
+      return nullptr;
+    }
+    chunks_.push_back(std::move(chunk));
+  }
+
+  auto& chunk = chunks_[current_];
+  Header header;
+  header.op = static_cast<uint32_t>(op);
+  header.size = static_cast<uint32_t>(size);
+  std::memcpy(chunk.data.get() + chunk.used, &header, sizeof(Header));
+  void* payload = chunk.data.get() + chunk.used + sizeof(Header);
+  chunk.used += required;
+  return payload;
+}
+
+template <typename T>
+T* VolkDeferredCommands::push(Op op) noexcept {
+  return static_cast<T*>(allocate(op, sizeof(T)));
+}
+
+template <typename T>
+T* VolkDeferredCommands::copy(const T* data, size_t count) noexcept {
+  if (!data || count == 0) {
+    return nullptr;
+  }
+  auto* result = allocate(Op::Data, sizeof(T) * count);
+  if (result) {
+    std::memcpy(result, data, sizeof(T) * count);
+  }
+  return static_cast<T*>(result);
+}
+
+template <typename T>
+T* VolkDeferredCommands::copyStructs(const T* data, size_t count) noexcept {
+  auto* result = copy(data, count);
+  for (size_t i = 0; result && i < count; ++i) {
+    copyMembers(result[i]);
+  }
+  return result;
+}
+
+const void* VolkDeferredCommands::copyChain(const void* pNext) noexcept {
+  if (!pNext) {
+    return nullptr;
+  }
+  // The extension structures copy the rest of the chain themselves.
+  auto const* result = copyExtension(static_cast<const VkBaseInStructure*>(pNext));
+  if (!result && status_ == VK_SUCCESS) {
+    status_ = VK_ERROR_FEATURE_NOT_PRESENT;
+  }
+  return result;
+}
+
+/* VOLK_CPP_GENERATE_DEFERRED_COPY */
+#if defined(VK_BASE_VERSION_1_0)
+void VolkDeferredCommands::copyMembers(VkBufferMemoryBarrier& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkImageMemoryBarrier& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkMemoryBarrier& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+#endif /* defined(VK_BASE_VERSION_1_0) */
+
+#if defined(VK_COMPUTE_VERSION_1_0)
+void VolkDeferredCommands::copyMembers(VkPipelineLayoutCreateInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pSetLayouts = copy(value.pSetLayouts, value.setLayoutCount);
+  value.pPushConstantRanges = copy(value.pPushConstantRanges, value.pushConstantRangeCount);
+}
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+
+#if defined(VK_GRAPHICS_VERSION_1_0)
+void VolkDeferredCommands::copyMembers(VkRenderPassBeginInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pClearValues = copy(value.pClearValues, value.clearValueCount);
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+
+#if defined(VK_GRAPHICS_VERSION_1_1)
+void VolkDeferredCommands::copyMembers(VkDeviceGroupRenderPassBeginInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pDeviceRenderAreas = copy(value.pDeviceRenderAreas, value.deviceRenderAreaCount);
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_1) */
+
+#if defined(VK_GRAPHICS_VERSION_1_2)
+void VolkDeferredCommands::copyMembers(VkRenderPassAttachmentBeginInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pAttachments = copy(value.pAttachments, value.attachmentCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkSubpassBeginInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkSubpassEndInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+
+#if defined(VK_BASE_VERSION_1_3)
+void VolkDeferredCommands::copyMembers(VkBufferCopy2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkBufferImageCopy2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkBufferMemoryBarrier2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkCopyBufferInfo2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pRegions = copyStructs(value.pRegions, value.regionCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkCopyBufferToImageInfo2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pRegions = copyStructs(value.pRegions, value.regionCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkCopyImageInfo2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pRegions = copyStructs(value.pRegions, value.regionCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkCopyImageToBufferInfo2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pRegions = copyStructs(value.pRegions, value.regionCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkDependencyInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pMemoryBarriers = copyStructs(value.pMemoryBarriers, value.memoryBarrierCount);
+  value.pBufferMemoryBarriers = copyStructs(value.pBufferMemoryBarriers, value.bufferMemoryBarrierCount);
+  value.pImageMemoryBarriers = copyStructs(value.pImageMemoryBarriers, value.imageMemoryBarrierCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkImageCopy2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkImageMemoryBarrier2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkMemoryBarrier2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+#endif /* defined(VK_BASE_VERSION_1_3) */
+
+#if defined(VK_GRAPHICS_VERSION_1_3)
+void VolkDeferredCommands::copyMembers(VkBlitImageInfo2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pRegions = copyStructs(value.pRegions, value.regionCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkImageBlit2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkImageResolve2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkRenderingAttachmentInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+}
+
+void VolkDeferredCommands::copyMembers(VkRenderingInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pColorAttachments = copyStructs(value.pColorAttachments, value.colorAttachmentCount);
+  value.pDepthAttachment = copyStructs(value.pDepthAttachment, value.pDepthAttachment ? 1 : 0);
+  value.pStencilAttachment = copyStructs(value.pStencilAttachment, value.pStencilAttachment ? 1 : 0);
+}
+
+void VolkDeferredCommands::copyMembers(VkResolveImageInfo2& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pRegions = copyStructs(value.pRegions, value.regionCount);
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+
+#if defined(VK_COMPUTE_VERSION_1_4)
+void VolkDeferredCommands::copyMembers(VkBindDescriptorSetsInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pDescriptorSets = copy(value.pDescriptorSets, value.descriptorSetCount);
+  value.pDynamicOffsets = copy(value.pDynamicOffsets, value.dynamicOffsetCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkPushConstantsInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pValues = copy(static_cast<const uint8_t*>(value.pValues), static_cast<size_t>(value.size));
+}
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+
+#if defined(VK_GRAPHICS_VERSION_1_4)
+void VolkDeferredCommands::copyMembers(VkRenderingAttachmentLocationInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pColorAttachmentLocations = copy(value.pColorAttachmentLocations, value.colorAttachmentCount);
+}
+
+void VolkDeferredCommands::copyMembers(VkRenderingInputAttachmentIndexInfo& value) noexcept {
+  value.pNext = copyChain(value.pNext);
+  value.pColorAttachmentInputIndices = copy(value.pColorAttachmentInputIndices, value.colorAttachmentCount);
+  value.pDepthInputAttachmentIndex = copy(value.pDepthInputAttachmentIndex, value.pDepthInputAttachmentIndex ? 1 : 0);
+  value.pStencilInputAttachmentIndex = copy(value.pStencilInputAttachmentIndex,
+                                            value.pStencilInputAttachmentIndex ? 1 : 0);
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+
+const void* VolkDeferredCommands::copyExtension(const VkBaseInStructure* pNext) noexcept {
+  switch (pNext->sType) {
+#if defined(VK_COMPUTE_VERSION_1_0)
+  case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO:
+    return copyStructs(reinterpret_cast<const VkPipelineLayoutCreateInfo*>(pNext), 1);
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_1)
+  case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
+    return copyStructs(reinterpret_cast<const VkDeviceGroupRenderPassBeginInfo*>(pNext), 1);
+#endif /* defined(VK_GRAPHICS_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
+    return copyStructs(reinterpret_cast<const VkRenderPassAttachmentBeginInfo*>(pNext), 1);
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+  default:
+    return nullptr;
+  }
+}
+/* VOLK_CPP_GENERATE_DEFERRED_COPY */
+
+void VolkDeferredCommands::reset() noexcept {
+  for (auto& chunk : chunks_) {
+    chunk.used = 0;
+  }
+  current_ = 0;
+  status_ = VK_SUCCESS;
+}
+
+bool VolkDeferredCommands::isEmpty() const noexcept {
+  return chunks_.empty() || chunks_[0].used == 0;
+}
+
+size_t VolkDeferredCommands::getSize() const noexcept {
+  size_t size = 0;
+  for (auto const& chunk : chunks_) {
+    size += chunk.used;
+  }
+  return size;
+}
+
+/* VOLK_CPP_GENERATE_DEFERRED_RECORD */
+#if defined(VK_BASE_VERSION_1_0)
+void VolkDeferredCommands::vkCmdBeginQuery(VkCommandBuffer, VkQueryPool queryPool, uint32_t query,
+                                           VkQueryControlFlags flags) noexcept {
+  if (auto* cmd = push<BeginQueryCmd>(Op::BeginQuery)) {
+    cmd->queryPool = queryPool;
+    cmd->query = query;
+    cmd->flags = flags;
+  }
+}
+
+void VolkDeferredCommands::vkCmdCopyBuffer(VkCommandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
+                                           uint32_t regionCount, const VkBufferCopy* pRegions) noexcept {
+  if (auto* cmd = push<CopyBufferCmd>(Op::CopyBuffer)) {
+    cmd->srcBuffer = srcBuffer;
+    cmd->dstBuffer = dstBuffer;
+    cmd->regionCount = regionCount;
+    cmd->pRegions = copy(pRegions, regionCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdCopyBufferToImage(VkCommandBuffer, VkBuffer srcBuffer, VkImage dstImage,
+                                                  VkImageLayout dstImageLayout, uint32_t regionCount,
+                                                  const VkBufferImageCopy* pRegions) noexcept {
+  if (auto* cmd = push<CopyBufferToImageCmd>(Op::CopyBufferToImage)) {
+    cmd->srcBuffer = srcBuffer;
+    cmd->dstImage = dstImage;
+    cmd->dstImageLayout = dstImageLayout;
+    cmd->regionCount = regionCount;
+    cmd->pRegions = copy(pRegions, regionCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdCopyImage(VkCommandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                          VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                          const VkImageCopy* pRegions) noexcept {
+  if (auto* cmd = push<CopyImageCmd>(Op::CopyImage)) {
+    cmd->srcImage = srcImage;
+    cmd->srcImageLayout = srcImageLayout;
+    cmd->dstImage = dstImage;
+    cmd->dstImageLayout = dstImageLayout;
+    cmd->regionCount = regionCount;
+    cmd->pRegions = copy(pRegions, regionCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdCopyImageToBuffer(VkCommandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                                  VkBuffer dstBuffer, uint32_t regionCount,
+                                                  const VkBufferImageCopy* pRegions) noexcept {
+  if (auto* cmd = push<CopyImageToBufferCmd>(Op::CopyImageToBuffer)) {
+    cmd->srcImage = srcImage;
+    cmd->srcImageLayout = srcImageLayout;
+    cmd->dstBuffer = dstBuffer;
+    cmd->regionCount = regionCount;
+    cmd->pRegions = copy(pRegions, regionCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdCopyQueryPoolResults(VkCommandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
+                                                     uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                                     VkDeviceSize stride, VkQueryResultFlags flags) noexcept {
+  if (auto* cmd = push<CopyQueryPoolResultsCmd>(Op::CopyQueryPoolResults)) {
+    cmd->queryPool = queryPool;
+    cmd->firstQuery = firstQuery;
+    cmd->queryCount = queryCount;
+    cmd->dstBuffer = dstBuffer;
+    cmd->dstOffset = dstOffset;
+    cmd->stride = stride;
+    cmd->flags = flags;
+  }
+}
+
+void VolkDeferredCommands::vkCmdEndQuery(VkCommandBuffer, VkQueryPool queryPool, uint32_t query) noexcept {
+  if (auto* cmd = push<EndQueryCmd>(Op::EndQuery)) {
+    cmd->queryPool = queryPool;
+    cmd->query = query;
+  }
+}
+
+void VolkDeferredCommands::vkCmdExecuteCommands(VkCommandBuffer, uint32_t commandBufferCount,
+                                                const VkCommandBuffer* pCommandBuffers) noexcept {
+  if (auto* cmd = push<ExecuteCommandsCmd>(Op::ExecuteCommands)) {
+    cmd->commandBufferCount = commandBufferCount;
+    cmd->pCommandBuffers = copy(pCommandBuffers, commandBufferCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdFillBuffer(VkCommandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                           VkDeviceSize size, uint32_t data) noexcept {
+  if (auto* cmd = push<FillBufferCmd>(Op::FillBuffer)) {
+    cmd->dstBuffer = dstBuffer;
+    cmd->dstOffset = dstOffset;
+    cmd->size = size;
+    cmd->data = data;
+  }
+}
+
+void VolkDeferredCommands::vkCmdPipelineBarrier(VkCommandBuffer, VkPipelineStageFlags srcStageMask,
+                                                VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                                                uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                                                uint32_t bufferMemoryBarrierCount,
+                                                const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                                uint32_t imageMemoryBarrierCount,
+                                                const VkImageMemoryBarrier* pImageMemoryBarriers) noexcept {
+  if (auto* cmd = push<PipelineBarrierCmd>(Op::PipelineBarrier)) {
+    cmd->srcStageMask = srcStageMask;
+    cmd->dstStageMask = dstStageMask;
+    cmd->dependencyFlags = dependencyFlags;
+    cmd->memoryBarrierCount = memoryBarrierCount;
+    cmd->pMemoryBarriers = copyStructs(pMemoryBarriers, memoryBarrierCount);
+    cmd->bufferMemoryBarrierCount = bufferMemoryBarrierCount;
+    cmd->pBufferMemoryBarriers = copyStructs(pBufferMemoryBarriers, bufferMemoryBarrierCount);
+    cmd->imageMemoryBarrierCount = imageMemoryBarrierCount;
+    cmd->pImageMemoryBarriers = copyStructs(pImageMemoryBarriers, imageMemoryBarrierCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdResetQueryPool(VkCommandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
+                                               uint32_t queryCount) noexcept {
+  if (auto* cmd = push<ResetQueryPoolCmd>(Op::ResetQueryPool)) {
+    cmd->queryPool = queryPool;
+    cmd->firstQuery = firstQuery;
+    cmd->queryCount = queryCount;
+  }
+}
+
+void VolkDeferredCommands::vkCmdUpdateBuffer(VkCommandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                                             VkDeviceSize dataSize, const void* pData) noexcept {
+  if (auto* cmd = push<UpdateBufferCmd>(Op::UpdateBuffer)) {
+    cmd->dstBuffer = dstBuffer;
+    cmd->dstOffset = dstOffset;
+    cmd->dataSize = dataSize;
+    cmd->pData = copy(static_cast<const uint8_t*>(pData), static_cast<size_t>(dataSize));
+  }
+}
+
+void VolkDeferredCommands::vkCmdWriteTimestamp(VkCommandBuffer, VkPipelineStageFlagBits pipelineStage,
+                                               VkQueryPool queryPool, uint32_t query) noexcept {
+  if (auto* cmd = push<WriteTimestampCmd>(Op::WriteTimestamp)) {
+    cmd->pipelineStage = pipelineStage;
+    cmd->queryPool = queryPool;
+    cmd->query = query;
+  }
+}
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+void VolkDeferredCommands::vkCmdBindDescriptorSets(VkCommandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                                   VkPipelineLayout layout, uint32_t firstSet,
+                                                   uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets,
+                                                   uint32_t dynamicOffsetCount,
+                                                   const uint32_t* pDynamicOffsets) noexcept {
+  if (auto* cmd = push<BindDescriptorSetsCmd>(Op::BindDescriptorSets)) {
+    cmd->pipelineBindPoint = pipelineBindPoint;
+    cmd->layout = layout;
+    cmd->firstSet = firstSet;
+    cmd->descriptorSetCount = descriptorSetCount;
+    cmd->pDescriptorSets = copy(pDescriptorSets, descriptorSetCount);
+    cmd->dynamicOffsetCount = dynamicOffsetCount;
+    cmd->pDynamicOffsets = copy(pDynamicOffsets, dynamicOffsetCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdBindPipeline(VkCommandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                             VkPipeline pipeline) noexcept {
+  if (auto* cmd = push<BindPipelineCmd>(Op::BindPipeline)) {
+    cmd->pipelineBindPoint = pipelineBindPoint;
+    cmd->pipeline = pipeline;
+  }
+}
+
+void VolkDeferredCommands::vkCmdClearColorImage(VkCommandBuffer, VkImage image, VkImageLayout imageLayout,
+                                                const VkClearColorValue* pColor, uint32_t rangeCount,
+                                                const VkImageSubresourceRange* pRanges) noexcept {
+  if (auto* cmd = push<ClearColorImageCmd>(Op::ClearColorImage)) {
+    cmd->image = image;
+    cmd->imageLayout = imageLayout;
+    cmd->pColor = copy(pColor, pColor ? 1 : 0);
+    cmd->rangeCount = rangeCount;
+    cmd->pRanges = copy(pRanges, rangeCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdDispatch(VkCommandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                                         uint32_t groupCountZ) noexcept {
+  if (auto* cmd = push<DispatchCmd>(Op::Dispatch)) {
+    cmd->groupCountX = groupCountX;
+    cmd->groupCountY = groupCountY;
+    cmd->groupCountZ = groupCountZ;
+  }
+}
+
+void VolkDeferredCommands::vkCmdDispatchIndirect(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset) noexcept {
+  if (auto* cmd = push<DispatchIndirectCmd>(Op::DispatchIndirect)) {
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+  }
+}
+
+void VolkDeferredCommands::vkCmdPushConstants(VkCommandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                                              uint32_t offset, uint32_t size, const void* pValues) noexcept {
+  if (auto* cmd = push<PushConstantsCmd>(Op::PushConstants)) {
+    cmd->layout = layout;
+    cmd->stageFlags = stageFlags;
+    cmd->offset = offset;
+    cmd->size = size;
+    cmd->pValues = copy(static_cast<const uint8_t*>(pValues), static_cast<size_t>(size));
+  }
+}
+
+void VolkDeferredCommands::vkCmdResetEvent(VkCommandBuffer, VkEvent event, VkPipelineStageFlags stageMask) noexcept {
+  if (auto* cmd = push<ResetEventCmd>(Op::ResetEvent)) {
+    cmd->event = event;
+    cmd->stageMask = stageMask;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetEvent(VkCommandBuffer, VkEvent event, VkPipelineStageFlags stageMask) noexcept {
+  if (auto* cmd = push<SetEventCmd>(Op::SetEvent)) {
+    cmd->event = event;
+    cmd->stageMask = stageMask;
+  }
+}
+
+void VolkDeferredCommands::vkCmdWaitEvents(VkCommandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                                           VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
+                                           uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                                           uint32_t bufferMemoryBarrierCount,
+                                           const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                           uint32_t imageMemoryBarrierCount,
+                                           const VkImageMemoryBarrier* pImageMemoryBarriers) noexcept {
+  if (auto* cmd = push<WaitEventsCmd>(Op::WaitEvents)) {
+    cmd->eventCount = eventCount;
+    cmd->pEvents = copy(pEvents, eventCount);
+    cmd->srcStageMask = srcStageMask;
+    cmd->dstStageMask = dstStageMask;
+    cmd->memoryBarrierCount = memoryBarrierCount;
+    cmd->pMemoryBarriers = copyStructs(pMemoryBarriers, memoryBarrierCount);
+    cmd->bufferMemoryBarrierCount = bufferMemoryBarrierCount;
+    cmd->pBufferMemoryBarriers = copyStructs(pBufferMemoryBarriers, bufferMemoryBarrierCount);
+    cmd->imageMemoryBarrierCount = imageMemoryBarrierCount;
+    cmd->pImageMemoryBarriers = copyStructs(pImageMemoryBarriers, imageMemoryBarrierCount);
+  }
+}
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+void VolkDeferredCommands::vkCmdBeginRenderPass(VkCommandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                                VkSubpassContents contents) noexcept {
+  if (auto* cmd = push<BeginRenderPassCmd>(Op::BeginRenderPass)) {
+    cmd->pRenderPassBegin = copyStructs(pRenderPassBegin, pRenderPassBegin ? 1 : 0);
+    cmd->contents = contents;
+  }
+}
+
+void VolkDeferredCommands::vkCmdBindIndexBuffer(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                VkIndexType indexType) noexcept {
+  if (auto* cmd = push<BindIndexBufferCmd>(Op::BindIndexBuffer)) {
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->indexType = indexType;
+  }
+}
+
+void VolkDeferredCommands::vkCmdBindVertexBuffers(VkCommandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                                                  const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) noexcept {
+  if (auto* cmd = push<BindVertexBuffersCmd>(Op::BindVertexBuffers)) {
+    cmd->firstBinding = firstBinding;
+    cmd->bindingCount = bindingCount;
+    cmd->pBuffers = copy(pBuffers, bindingCount);
+    cmd->pOffsets = copy(pOffsets, bindingCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdBlitImage(VkCommandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                          VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                          const VkImageBlit* pRegions, VkFilter filter) noexcept {
+  if (auto* cmd = push<BlitImageCmd>(Op::BlitImage)) {
+    cmd->srcImage = srcImage;
+    cmd->srcImageLayout = srcImageLayout;
+    cmd->dstImage = dstImage;
+    cmd->dstImageLayout = dstImageLayout;
+    cmd->regionCount = regionCount;
+    cmd->pRegions = copy(pRegions, regionCount);
+    cmd->filter = filter;
+  }
+}
+
+void VolkDeferredCommands::vkCmdClearAttachments(VkCommandBuffer, uint32_t attachmentCount,
+                                                 const VkClearAttachment* pAttachments, uint32_t rectCount,
+                                                 const VkClearRect* pRects) noexcept {
+  if (auto* cmd = push<ClearAttachmentsCmd>(Op::ClearAttachments)) {
+    cmd->attachmentCount = attachmentCount;
+    cmd->pAttachments = copy(pAttachments, attachmentCount);
+    cmd->rectCount = rectCount;
+    cmd->pRects = copy(pRects, rectCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdClearDepthStencilImage(VkCommandBuffer, VkImage image, VkImageLayout imageLayout,
+                                                       const VkClearDepthStencilValue* pDepthStencil,
+                                                       uint32_t rangeCount,
+                                                       const VkImageSubresourceRange* pRanges) noexcept {
+  if (auto* cmd = push<ClearDepthStencilImageCmd>(Op::ClearDepthStencilImage)) {
+    cmd->image = image;
+    cmd->imageLayout = imageLayout;
+    cmd->pDepthStencil = copy(pDepthStencil, pDepthStencil ? 1 : 0);
+    cmd->rangeCount = rangeCount;
+    cmd->pRanges = copy(pRanges, rangeCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdDraw(VkCommandBuffer, uint32_t vertexCount, uint32_t instanceCount,
+                                     uint32_t firstVertex, uint32_t firstInstance) noexcept {
+  if (auto* cmd = push<DrawCmd>(Op::Draw)) {
+    cmd->vertexCount = vertexCount;
+    cmd->instanceCount = instanceCount;
+    cmd->firstVertex = firstVertex;
+    cmd->firstInstance = firstInstance;
+  }
+}
+
+void VolkDeferredCommands::vkCmdDrawIndexed(VkCommandBuffer, uint32_t indexCount, uint32_t instanceCount,
+                                            uint32_t firstIndex, int32_t vertexOffset,
+                                            uint32_t firstInstance) noexcept {
+  if (auto* cmd = push<DrawIndexedCmd>(Op::DrawIndexed)) {
+    cmd->indexCount = indexCount;
+    cmd->instanceCount = instanceCount;
+    cmd->firstIndex = firstIndex;
+    cmd->vertexOffset = vertexOffset;
+    cmd->firstInstance = firstInstance;
+  }
+}
+
+void VolkDeferredCommands::vkCmdDrawIndexedIndirect(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                    uint32_t drawCount, uint32_t stride) noexcept {
+  if (auto* cmd = push<DrawIndexedIndirectCmd>(Op::DrawIndexedIndirect)) {
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->drawCount = drawCount;
+    cmd->stride = stride;
+  }
+}
+
+void VolkDeferredCommands::vkCmdDrawIndirect(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
+                                             uint32_t stride) noexcept {
+  if (auto* cmd = push<DrawIndirectCmd>(Op::DrawIndirect)) {
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->drawCount = drawCount;
+    cmd->stride = stride;
+  }
+}
+
+void VolkDeferredCommands::vkCmdEndRenderPass(VkCommandBuffer) noexcept {
+  (void)allocate(Op::EndRenderPass, 0);
+}
+
+void VolkDeferredCommands::vkCmdNextSubpass(VkCommandBuffer, VkSubpassContents contents) noexcept {
+  if (auto* cmd = push<NextSubpassCmd>(Op::NextSubpass)) {
+    cmd->contents = contents;
+  }
+}
+
+void VolkDeferredCommands::vkCmdResolveImage(VkCommandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                                             VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                                             const VkImageResolve* pRegions) noexcept {
+  if (auto* cmd = push<ResolveImageCmd>(Op::ResolveImage)) {
+    cmd->srcImage = srcImage;
+    cmd->srcImageLayout = srcImageLayout;
+    cmd->dstImage = dstImage;
+    cmd->dstImageLayout = dstImageLayout;
+    cmd->regionCount = regionCount;
+    cmd->pRegions = copy(pRegions, regionCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetBlendConstants(VkCommandBuffer, const float blendConstants[4]) noexcept {
+  if (auto* cmd = push<SetBlendConstantsCmd>(Op::SetBlendConstants)) {
+    std::memcpy(cmd->blendConstants, blendConstants, sizeof(cmd->blendConstants));
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetDepthBias(VkCommandBuffer, float depthBiasConstantFactor, float depthBiasClamp,
+                                             float depthBiasSlopeFactor) noexcept {
+  if (auto* cmd = push<SetDepthBiasCmd>(Op::SetDepthBias)) {
+    cmd->depthBiasConstantFactor = depthBiasConstantFactor;
+    cmd->depthBiasClamp = depthBiasClamp;
+    cmd->depthBiasSlopeFactor = depthBiasSlopeFactor;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetDepthBounds(VkCommandBuffer, float minDepthBounds, float maxDepthBounds) noexcept {
+  if (auto* cmd = push<SetDepthBoundsCmd>(Op::SetDepthBounds)) {
+    cmd->minDepthBounds = minDepthBounds;
+    cmd->maxDepthBounds = maxDepthBounds;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetLineWidth(VkCommandBuffer, float lineWidth) noexcept {
+  if (auto* cmd = push<SetLineWidthCmd>(Op::SetLineWidth)) {
+    cmd->lineWidth = lineWidth;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetScissor(VkCommandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                                           const VkRect2D* pScissors) noexcept {
+  if (auto* cmd = push<SetScissorCmd>(Op::SetScissor)) {
+    cmd->firstScissor = firstScissor;
+    cmd->scissorCount = scissorCount;
+    cmd->pScissors = copy(pScissors, scissorCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetStencilCompareMask(VkCommandBuffer, VkStencilFaceFlags faceMask,
+                                                      uint32_t compareMask) noexcept {
+  if (auto* cmd = push<SetStencilCompareMaskCmd>(Op::SetStencilCompareMask)) {
+    cmd->faceMask = faceMask;
+    cmd->compareMask = compareMask;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetStencilReference(VkCommandBuffer, VkStencilFaceFlags faceMask,
+                                                    uint32_t reference) noexcept {
+  if (auto* cmd = push<SetStencilReferenceCmd>(Op::SetStencilReference)) {
+    cmd->faceMask = faceMask;
+    cmd->reference = reference;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetStencilWriteMask(VkCommandBuffer, VkStencilFaceFlags faceMask,
+                                                    uint32_t writeMask) noexcept {
+  if (auto* cmd = push<SetStencilWriteMaskCmd>(Op::SetStencilWriteMask)) {
+    cmd->faceMask = faceMask;
+    cmd->writeMask = writeMask;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetViewport(VkCommandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                                            const VkViewport* pViewports) noexcept {
+  if (auto* cmd = push<SetViewportCmd>(Op::SetViewport)) {
+    cmd->firstViewport = firstViewport;
+    cmd->viewportCount = viewportCount;
+    cmd->pViewports = copy(pViewports, viewportCount);
+  }
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_BASE_VERSION_1_1)
+void VolkDeferredCommands::vkCmdSetDeviceMask(VkCommandBuffer, uint32_t deviceMask) noexcept {
+  if (auto* cmd = push<SetDeviceMaskCmd>(Op::SetDeviceMask)) {
+    cmd->deviceMask = deviceMask;
+  }
+}
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+void VolkDeferredCommands::vkCmdDispatchBase(VkCommandBuffer, uint32_t baseGroupX, uint32_t baseGroupY,
+                                             uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY,
+                                             uint32_t groupCountZ) noexcept {
+  if (auto* cmd = push<DispatchBaseCmd>(Op::DispatchBase)) {
+    cmd->baseGroupX = baseGroupX;
+    cmd->baseGroupY = baseGroupY;
+    cmd->baseGroupZ = baseGroupZ;
+    cmd->groupCountX = groupCountX;
+    cmd->groupCountY = groupCountY;
+    cmd->groupCountZ = groupCountZ;
+  }
+}
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+void VolkDeferredCommands::vkCmdBeginRenderPass2(VkCommandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                                                 const VkSubpassBeginInfo* pSubpassBeginInfo) noexcept {
+  if (auto* cmd = push<BeginRenderPass2Cmd>(Op::BeginRenderPass2)) {
+    cmd->pRenderPassBegin = copyStructs(pRenderPassBegin, pRenderPassBegin ? 1 : 0);
+    cmd->pSubpassBeginInfo = copyStructs(pSubpassBeginInfo, pSubpassBeginInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdDrawIndexedIndirectCount(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                         VkBuffer countBuffer, VkDeviceSize countBufferOffset,
+                                                         uint32_t maxDrawCount, uint32_t stride) noexcept {
+  if (auto* cmd = push<DrawIndexedIndirectCountCmd>(Op::DrawIndexedIndirectCount)) {
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->countBuffer = countBuffer;
+    cmd->countBufferOffset = countBufferOffset;
+    cmd->maxDrawCount = maxDrawCount;
+    cmd->stride = stride;
+  }
+}
+
+void VolkDeferredCommands::vkCmdDrawIndirectCount(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                  VkBuffer countBuffer, VkDeviceSize countBufferOffset,
+                                                  uint32_t maxDrawCount, uint32_t stride) noexcept {
+  if (auto* cmd = push<DrawIndirectCountCmd>(Op::DrawIndirectCount)) {
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->countBuffer = countBuffer;
+    cmd->countBufferOffset = countBufferOffset;
+    cmd->maxDrawCount = maxDrawCount;
+    cmd->stride = stride;
+  }
+}
+
+void VolkDeferredCommands::vkCmdEndRenderPass2(VkCommandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) noexcept {
+  if (auto* cmd = push<EndRenderPass2Cmd>(Op::EndRenderPass2)) {
+    cmd->pSubpassEndInfo = copyStructs(pSubpassEndInfo, pSubpassEndInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdNextSubpass2(VkCommandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo,
+                                             const VkSubpassEndInfo* pSubpassEndInfo) noexcept {
+  if (auto* cmd = push<NextSubpass2Cmd>(Op::NextSubpass2)) {
+    cmd->pSubpassBeginInfo = copyStructs(pSubpassBeginInfo, pSubpassBeginInfo ? 1 : 0);
+    cmd->pSubpassEndInfo = copyStructs(pSubpassEndInfo, pSubpassEndInfo ? 1 : 0);
+  }
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+void VolkDeferredCommands::vkCmdCopyBuffer2(VkCommandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) noexcept {
+  if (auto* cmd = push<CopyBuffer2Cmd>(Op::CopyBuffer2)) {
+    cmd->pCopyBufferInfo = copyStructs(pCopyBufferInfo, pCopyBufferInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdCopyBufferToImage2(VkCommandBuffer,
+                                                   const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) noexcept {
+  if (auto* cmd = push<CopyBufferToImage2Cmd>(Op::CopyBufferToImage2)) {
+    cmd->pCopyBufferToImageInfo = copyStructs(pCopyBufferToImageInfo, pCopyBufferToImageInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdCopyImage2(VkCommandBuffer, const VkCopyImageInfo2* pCopyImageInfo) noexcept {
+  if (auto* cmd = push<CopyImage2Cmd>(Op::CopyImage2)) {
+    cmd->pCopyImageInfo = copyStructs(pCopyImageInfo, pCopyImageInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdCopyImageToBuffer2(VkCommandBuffer,
+                                                   const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) noexcept {
+  if (auto* cmd = push<CopyImageToBuffer2Cmd>(Op::CopyImageToBuffer2)) {
+    cmd->pCopyImageToBufferInfo = copyStructs(pCopyImageToBufferInfo, pCopyImageToBufferInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdPipelineBarrier2(VkCommandBuffer, const VkDependencyInfo* pDependencyInfo) noexcept {
+  if (auto* cmd = push<PipelineBarrier2Cmd>(Op::PipelineBarrier2)) {
+    cmd->pDependencyInfo = copyStructs(pDependencyInfo, pDependencyInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdWriteTimestamp2(VkCommandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool,
+                                                uint32_t query) noexcept {
+  if (auto* cmd = push<WriteTimestamp2Cmd>(Op::WriteTimestamp2)) {
+    cmd->stage = stage;
+    cmd->queryPool = queryPool;
+    cmd->query = query;
+  }
+}
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_3)
+void VolkDeferredCommands::vkCmdResetEvent2(VkCommandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) noexcept {
+  if (auto* cmd = push<ResetEvent2Cmd>(Op::ResetEvent2)) {
+    cmd->event = event;
+    cmd->stageMask = stageMask;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetEvent2(VkCommandBuffer, VkEvent event,
+                                          const VkDependencyInfo* pDependencyInfo) noexcept {
+  if (auto* cmd = push<SetEvent2Cmd>(Op::SetEvent2)) {
+    cmd->event = event;
+    cmd->pDependencyInfo = copyStructs(pDependencyInfo, pDependencyInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdWaitEvents2(VkCommandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                                            const VkDependencyInfo* pDependencyInfos) noexcept {
+  if (auto* cmd = push<WaitEvents2Cmd>(Op::WaitEvents2)) {
+    cmd->eventCount = eventCount;
+    cmd->pEvents = copy(pEvents, eventCount);
+    cmd->pDependencyInfos = copyStructs(pDependencyInfos, eventCount);
+  }
+}
+#endif /* defined(VK_COMPUTE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+void VolkDeferredCommands::vkCmdBeginRendering(VkCommandBuffer, const VkRenderingInfo* pRenderingInfo) noexcept {
+  if (auto* cmd = push<BeginRenderingCmd>(Op::BeginRendering)) {
+    cmd->pRenderingInfo = copyStructs(pRenderingInfo, pRenderingInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdBindVertexBuffers2(VkCommandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                                                   const VkBuffer* pBuffers, const VkDeviceSize* pOffsets,
+                                                   const VkDeviceSize* pSizes, const VkDeviceSize* pStrides) noexcept {
+  if (auto* cmd = push<BindVertexBuffers2Cmd>(Op::BindVertexBuffers2)) {
+    cmd->firstBinding = firstBinding;
+    cmd->bindingCount = bindingCount;
+    cmd->pBuffers = copy(pBuffers, bindingCount);
+    cmd->pOffsets = copy(pOffsets, bindingCount);
+    cmd->pSizes = copy(pSizes, bindingCount);
+    cmd->pStrides = copy(pStrides, bindingCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdBlitImage2(VkCommandBuffer, const VkBlitImageInfo2* pBlitImageInfo) noexcept {
+  if (auto* cmd = push<BlitImage2Cmd>(Op::BlitImage2)) {
+    cmd->pBlitImageInfo = copyStructs(pBlitImageInfo, pBlitImageInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdEndRendering(VkCommandBuffer) noexcept {
+  (void)allocate(Op::EndRendering, 0);
+}
+
+void VolkDeferredCommands::vkCmdResolveImage2(VkCommandBuffer, const VkResolveImageInfo2* pResolveImageInfo) noexcept {
+  if (auto* cmd = push<ResolveImage2Cmd>(Op::ResolveImage2)) {
+    cmd->pResolveImageInfo = copyStructs(pResolveImageInfo, pResolveImageInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetCullMode(VkCommandBuffer, VkCullModeFlags cullMode) noexcept {
+  if (auto* cmd = push<SetCullModeCmd>(Op::SetCullMode)) {
+    cmd->cullMode = cullMode;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetDepthBiasEnable(VkCommandBuffer, VkBool32 depthBiasEnable) noexcept {
+  if (auto* cmd = push<SetDepthBiasEnableCmd>(Op::SetDepthBiasEnable)) {
+    cmd->depthBiasEnable = depthBiasEnable;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetDepthBoundsTestEnable(VkCommandBuffer, VkBool32 depthBoundsTestEnable) noexcept {
+  if (auto* cmd = push<SetDepthBoundsTestEnableCmd>(Op::SetDepthBoundsTestEnable)) {
+    cmd->depthBoundsTestEnable = depthBoundsTestEnable;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetDepthCompareOp(VkCommandBuffer, VkCompareOp depthCompareOp) noexcept {
+  if (auto* cmd = push<SetDepthCompareOpCmd>(Op::SetDepthCompareOp)) {
+    cmd->depthCompareOp = depthCompareOp;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetDepthTestEnable(VkCommandBuffer, VkBool32 depthTestEnable) noexcept {
+  if (auto* cmd = push<SetDepthTestEnableCmd>(Op::SetDepthTestEnable)) {
+    cmd->depthTestEnable = depthTestEnable;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetDepthWriteEnable(VkCommandBuffer, VkBool32 depthWriteEnable) noexcept {
+  if (auto* cmd = push<SetDepthWriteEnableCmd>(Op::SetDepthWriteEnable)) {
+    cmd->depthWriteEnable = depthWriteEnable;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetFrontFace(VkCommandBuffer, VkFrontFace frontFace) noexcept {
+  if (auto* cmd = push<SetFrontFaceCmd>(Op::SetFrontFace)) {
+    cmd->frontFace = frontFace;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetPrimitiveRestartEnable(VkCommandBuffer, VkBool32 primitiveRestartEnable) noexcept {
+  if (auto* cmd = push<SetPrimitiveRestartEnableCmd>(Op::SetPrimitiveRestartEnable)) {
+    cmd->primitiveRestartEnable = primitiveRestartEnable;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetPrimitiveTopology(VkCommandBuffer, VkPrimitiveTopology primitiveTopology) noexcept {
+  if (auto* cmd = push<SetPrimitiveTopologyCmd>(Op::SetPrimitiveTopology)) {
+    cmd->primitiveTopology = primitiveTopology;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetRasterizerDiscardEnable(VkCommandBuffer, VkBool32 rasterizerDiscardEnable) noexcept {
+  if (auto* cmd = push<SetRasterizerDiscardEnableCmd>(Op::SetRasterizerDiscardEnable)) {
+    cmd->rasterizerDiscardEnable = rasterizerDiscardEnable;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetScissorWithCount(VkCommandBuffer, uint32_t scissorCount,
+                                                    const VkRect2D* pScissors) noexcept {
+  if (auto* cmd = push<SetScissorWithCountCmd>(Op::SetScissorWithCount)) {
+    cmd->scissorCount = scissorCount;
+    cmd->pScissors = copy(pScissors, scissorCount);
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetStencilOp(VkCommandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp,
+                                             VkStencilOp passOp, VkStencilOp depthFailOp,
+                                             VkCompareOp compareOp) noexcept {
+  if (auto* cmd = push<SetStencilOpCmd>(Op::SetStencilOp)) {
+    cmd->faceMask = faceMask;
+    cmd->failOp = failOp;
+    cmd->passOp = passOp;
+    cmd->depthFailOp = depthFailOp;
+    cmd->compareOp = compareOp;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetStencilTestEnable(VkCommandBuffer, VkBool32 stencilTestEnable) noexcept {
+  if (auto* cmd = push<SetStencilTestEnableCmd>(Op::SetStencilTestEnable)) {
+    cmd->stencilTestEnable = stencilTestEnable;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetViewportWithCount(VkCommandBuffer, uint32_t viewportCount,
+                                                     const VkViewport* pViewports) noexcept {
+  if (auto* cmd = push<SetViewportWithCountCmd>(Op::SetViewportWithCount)) {
+    cmd->viewportCount = viewportCount;
+    cmd->pViewports = copy(pViewports, viewportCount);
+  }
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+void VolkDeferredCommands::vkCmdBindDescriptorSets2(VkCommandBuffer,
+                                                    const VkBindDescriptorSetsInfo* pBindDescriptorSetsInfo) noexcept {
+  if (auto* cmd = push<BindDescriptorSets2Cmd>(Op::BindDescriptorSets2)) {
+    cmd->pBindDescriptorSetsInfo = copyStructs(pBindDescriptorSetsInfo, pBindDescriptorSetsInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdPushConstants2(VkCommandBuffer,
+                                               const VkPushConstantsInfo* pPushConstantsInfo) noexcept {
+  if (auto* cmd = push<PushConstants2Cmd>(Op::PushConstants2)) {
+    cmd->pPushConstantsInfo = copyStructs(pPushConstantsInfo, pPushConstantsInfo ? 1 : 0);
+  }
+}
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+void VolkDeferredCommands::vkCmdBindIndexBuffer2(VkCommandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                                 VkDeviceSize size, VkIndexType indexType) noexcept {
+  if (auto* cmd = push<BindIndexBuffer2Cmd>(Op::BindIndexBuffer2)) {
+    cmd->buffer = buffer;
+    cmd->offset = offset;
+    cmd->size = size;
+    cmd->indexType = indexType;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetLineStipple(VkCommandBuffer, uint32_t lineStippleFactor,
+                                               uint16_t lineStipplePattern) noexcept {
+  if (auto* cmd = push<SetLineStippleCmd>(Op::SetLineStipple)) {
+    cmd->lineStippleFactor = lineStippleFactor;
+    cmd->lineStipplePattern = lineStipplePattern;
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetRenderingAttachmentLocations(VkCommandBuffer,
+                                                                const VkRenderingAttachmentLocationInfo* pLocationInfo) noexcept {
+  if (auto* cmd = push<SetRenderingAttachmentLocationsCmd>(Op::SetRenderingAttachmentLocations)) {
+    cmd->pLocationInfo = copyStructs(pLocationInfo, pLocationInfo ? 1 : 0);
+  }
+}
+
+void VolkDeferredCommands::vkCmdSetRenderingInputAttachmentIndices(VkCommandBuffer,
+                                                                   const VkRenderingInputAttachmentIndexInfo* pInputAttachmentIndexInfo) noexcept {
+  if (auto* cmd = push<SetRenderingInputAttachmentIndicesCmd>(Op::SetRenderingInputAttachmentIndices)) {
+    cmd->pInputAttachmentIndexInfo = copyStructs(pInputAttachmentIndexInfo, pInputAttachmentIndexInfo ? 1 : 0);
+  }
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+/* VOLK_CPP_GENERATE_DEFERRED_RECORD */
+
+VkResult VolkDeferredCommands::replay(VkCommandBuffer commandBuffer, const Volk& volk) const noexcept {
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  for (auto const& chunk : chunks_) {
+    size_t offset = 0;
+    while (offset < chunk.used) {
+      Header header;
+      std::memcpy(&header, chunk.data.get() + offset, sizeof(Header));
+      const void* payload = chunk.data.get() + offset + sizeof(Header);
+      offset += sizeof(Header) + header.size;
+
+      switch (static_cast<Op>(header.op)) {
+      case Op::Data:
+        break;
+      /* VOLK_CPP_GENERATE_DEFERRED_REPLAY */
+#if defined(VK_BASE_VERSION_1_0)
+      case Op::BeginQuery: {
+        auto const* cmd = static_cast<const BeginQueryCmd*>(payload);
+        volk.vkCmdBeginQuery(commandBuffer, cmd->queryPool, cmd->query, cmd->flags);
+        break;
+      }
+      case Op::CopyBuffer: {
+        auto const* cmd = static_cast<const CopyBufferCmd*>(payload);
+        volk.vkCmdCopyBuffer(commandBuffer, cmd->srcBuffer, cmd->dstBuffer, cmd->regionCount, cmd->pRegions);
+        break;
+      }
+      case Op::CopyBufferToImage: {
+        auto const* cmd = static_cast<const CopyBufferToImageCmd*>(payload);
+        volk.vkCmdCopyBufferToImage(commandBuffer, cmd->srcBuffer, cmd->dstImage, cmd->dstImageLayout, cmd->regionCount,
+                                    cmd->pRegions);
+        break;
+      }
+      case Op::CopyImage: {
+        auto const* cmd = static_cast<const CopyImageCmd*>(payload);
+        volk.vkCmdCopyImage(commandBuffer, cmd->srcImage, cmd->srcImageLayout, cmd->dstImage, cmd->dstImageLayout,
+                            cmd->regionCount, cmd->pRegions);
+        break;
+      }
+      case Op::CopyImageToBuffer: {
+        auto const* cmd = static_cast<const CopyImageToBufferCmd*>(payload);
+        volk.vkCmdCopyImageToBuffer(commandBuffer, cmd->srcImage, cmd->srcImageLayout, cmd->dstBuffer, cmd->regionCount,
+                                    cmd->pRegions);
+        break;
+      }
+      case Op::CopyQueryPoolResults: {
+        auto const* cmd = static_cast<const CopyQueryPoolResultsCmd*>(payload);
+        volk.vkCmdCopyQueryPoolResults(commandBuffer, cmd->queryPool, cmd->firstQuery, cmd->queryCount, cmd->dstBuffer,
+                                       cmd->dstOffset, cmd->stride, cmd->flags);
+        break;
+      }
+      case Op::EndQuery: {
+        auto const* cmd = static_cast<const EndQueryCmd*>(payload);
+        volk.vkCmdEndQuery(commandBuffer, cmd->queryPool, cmd->query);
+        break;
+      }
+      case Op::ExecuteCommands: {
+        auto const* cmd = static_cast<const ExecuteCommandsCmd*>(payload);
+        volk.vkCmdExecuteCommands(commandBuffer, cmd->commandBufferCount, cmd->pCommandBuffers);
+        break;
+      }
+      case Op::FillBuffer: {
+        auto const* cmd = static_cast<const FillBufferCmd*>(payload);
+        volk.vkCmdFillBuffer(commandBuffer, cmd->dstBuffer, cmd->dstOffset, cmd->size, cmd->data);
+        break;
+      }
+      case Op::PipelineBarrier: {
+        auto const* cmd = static_cast<const PipelineBarrierCmd*>(payload);
+        volk.vkCmdPipelineBarrier(commandBuffer, cmd->srcStageMask, cmd->dstStageMask, cmd->dependencyFlags,
+                                  cmd->memoryBarrierCount, cmd->pMemoryBarriers, cmd->bufferMemoryBarrierCount,
+                                  cmd->pBufferMemoryBarriers, cmd->imageMemoryBarrierCount, cmd->pImageMemoryBarriers);
+        break;
+      }
+      case Op::ResetQueryPool: {
+        auto const* cmd = static_cast<const ResetQueryPoolCmd*>(payload);
+        volk.vkCmdResetQueryPool(commandBuffer, cmd->queryPool, cmd->firstQuery, cmd->queryCount);
+        break;
+      }
+      case Op::UpdateBuffer: {
+        auto const* cmd = static_cast<const UpdateBufferCmd*>(payload);
+        volk.vkCmdUpdateBuffer(commandBuffer, cmd->dstBuffer, cmd->dstOffset, cmd->dataSize, cmd->pData);
+        break;
+      }
+      case Op::WriteTimestamp: {
+        auto const* cmd = static_cast<const WriteTimestampCmd*>(payload);
+        volk.vkCmdWriteTimestamp(commandBuffer, cmd->pipelineStage, cmd->queryPool, cmd->query);
+        break;
+      }
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+      case Op::BindDescriptorSets: {
+        auto const* cmd = static_cast<const BindDescriptorSetsCmd*>(payload);
+        volk.vkCmdBindDescriptorSets(commandBuffer, cmd->pipelineBindPoint, cmd->layout, cmd->firstSet,
+                                     cmd->descriptorSetCount, cmd->pDescriptorSets, cmd->dynamicOffsetCount,
+                                     cmd->pDynamicOffsets);
+        break;
+      }
+      case Op::BindPipeline: {
+        auto const* cmd = static_cast<const BindPipelineCmd*>(payload);
+        volk.vkCmdBindPipeline(commandBuffer, cmd->pipelineBindPoint, cmd->pipeline);
+        break;
+      }
+      case Op::ClearColorImage: {
+        auto const* cmd = static_cast<const ClearColorImageCmd*>(payload);
+        volk.vkCmdClearColorImage(commandBuffer, cmd->image, cmd->imageLayout, cmd->pColor, cmd->rangeCount,
+                                  cmd->pRanges);
+        break;
+      }
+      case Op::Dispatch: {
+        auto const* cmd = static_cast<const DispatchCmd*>(payload);
+        volk.vkCmdDispatch(commandBuffer, cmd->groupCountX, cmd->groupCountY, cmd->groupCountZ);
+        break;
+      }
+      case Op::DispatchIndirect: {
+        auto const* cmd = static_cast<const DispatchIndirectCmd*>(payload);
+        volk.vkCmdDispatchIndirect(commandBuffer, cmd->buffer, cmd->offset);
+        break;
+      }
+      case Op::PushConstants: {
+        auto const* cmd = static_cast<const PushConstantsCmd*>(payload);
+        volk.vkCmdPushConstants(commandBuffer, cmd->layout, cmd->stageFlags, cmd->offset, cmd->size, cmd->pValues);
+        break;
+      }
+      case Op::ResetEvent: {
+        auto const* cmd = static_cast<const ResetEventCmd*>(payload);
+        volk.vkCmdResetEvent(commandBuffer, cmd->event, cmd->stageMask);
+        break;
+      }
+      case Op::SetEvent: {
+        auto const* cmd = static_cast<const SetEventCmd*>(payload);
+        volk.vkCmdSetEvent(commandBuffer, cmd->event, cmd->stageMask);
+        break;
+      }
+      case Op::WaitEvents: {
+        auto const* cmd = static_cast<const WaitEventsCmd*>(payload);
+        volk.vkCmdWaitEvents(commandBuffer, cmd->eventCount, cmd->pEvents, cmd->srcStageMask, cmd->dstStageMask,
+                             cmd->memoryBarrierCount, cmd->pMemoryBarriers, cmd->bufferMemoryBarrierCount,
+                             cmd->pBufferMemoryBarriers, cmd->imageMemoryBarrierCount, cmd->pImageMemoryBarriers);
+        break;
+      }
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+      case Op::BeginRenderPass: {
+        auto const* cmd = static_cast<const BeginRenderPassCmd*>(payload);
+        volk.vkCmdBeginRenderPass(commandBuffer, cmd->pRenderPassBegin, cmd->contents);
+        break;
+      }
+      case Op::BindIndexBuffer: {
+        auto const* cmd = static_cast<const BindIndexBufferCmd*>(payload);
+        volk.vkCmdBindIndexBuffer(commandBuffer, cmd->buffer, cmd->offset, cmd->indexType);
+        break;
+      }
+      case Op::BindVertexBuffers: {
+        auto const* cmd = static_cast<const BindVertexBuffersCmd*>(payload);
+        volk.vkCmdBindVertexBuffers(commandBuffer, cmd->firstBinding, cmd->bindingCount, cmd->pBuffers, cmd->pOffsets);
+        break;
+      }
+      case Op::BlitImage: {
+        auto const* cmd = static_cast<const BlitImageCmd*>(payload);
+        volk.vkCmdBlitImage(commandBuffer, cmd->srcImage, cmd->srcImageLayout, cmd->dstImage, cmd->dstImageLayout,
+                            cmd->regionCount, cmd->pRegions, cmd->filter);
+        break;
+      }
+      case Op::ClearAttachments: {
+        auto const* cmd = static_cast<const ClearAttachmentsCmd*>(payload);
+        volk.vkCmdClearAttachments(commandBuffer, cmd->attachmentCount, cmd->pAttachments, cmd->rectCount, cmd->pRects);
+        break;
+      }
+      case Op::ClearDepthStencilImage: {
+        auto const* cmd = static_cast<const ClearDepthStencilImageCmd*>(payload);
+        volk.vkCmdClearDepthStencilImage(commandBuffer, cmd->image, cmd->imageLayout, cmd->pDepthStencil,
+                                         cmd->rangeCount, cmd->pRanges);
+        break;
+      }
+      case Op::Draw: {
+        auto const* cmd = static_cast<const DrawCmd*>(payload);
+        volk.vkCmdDraw(commandBuffer, cmd->vertexCount, cmd->instanceCount, cmd->firstVertex, cmd->firstInstance);
+        break;
+      }
+      case Op::DrawIndexed: {
+        auto const* cmd = static_cast<const DrawIndexedCmd*>(payload);
+        volk.vkCmdDrawIndexed(commandBuffer, cmd->indexCount, cmd->instanceCount, cmd->firstIndex, cmd->vertexOffset,
+                              cmd->firstInstance);
+        break;
+      }
+      case Op::DrawIndexedIndirect: {
+        auto const* cmd = static_cast<const DrawIndexedIndirectCmd*>(payload);
+        volk.vkCmdDrawIndexedIndirect(commandBuffer, cmd->buffer, cmd->offset, cmd->drawCount, cmd->stride);
+        break;
+      }
+      case Op::DrawIndirect: {
+        auto const* cmd = static_cast<const DrawIndirectCmd*>(payload);
+        volk.vkCmdDrawIndirect(commandBuffer, cmd->buffer, cmd->offset, cmd->drawCount, cmd->stride);
+        break;
+      }
+      case Op::EndRenderPass:
+        volk.vkCmdEndRenderPass(commandBuffer);
+        break;
+      case Op::NextSubpass: {
+        auto const* cmd = static_cast<const NextSubpassCmd*>(payload);
+        volk.vkCmdNextSubpass(commandBuffer, cmd->contents);
+        break;
+      }
+      case Op::ResolveImage: {
+        auto const* cmd = static_cast<const ResolveImageCmd*>(payload);
+        volk.vkCmdResolveImage(commandBuffer, cmd->srcImage, cmd->srcImageLayout, cmd->dstImage, cmd->dstImageLayout,
+                               cmd->regionCount, cmd->pRegions);
+        break;
+      }
+      case Op::SetBlendConstants: {
+        auto const* cmd = static_cast<const SetBlendConstantsCmd*>(payload);
+        volk.vkCmdSetBlendConstants(commandBuffer, cmd->blendConstants);
+        break;
+      }
+      case Op::SetDepthBias: {
+        auto const* cmd = static_cast<const SetDepthBiasCmd*>(payload);
+        volk.vkCmdSetDepthBias(commandBuffer, cmd->depthBiasConstantFactor, cmd->depthBiasClamp,
+                               cmd->depthBiasSlopeFactor);
+        break;
+      }
+      case Op::SetDepthBounds: {
+        auto const* cmd = static_cast<const SetDepthBoundsCmd*>(payload);
+        volk.vkCmdSetDepthBounds(commandBuffer, cmd->minDepthBounds, cmd->maxDepthBounds);
+        break;
+      }
+      case Op::SetLineWidth: {
+        auto const* cmd = static_cast<const SetLineWidthCmd*>(payload);
+        volk.vkCmdSetLineWidth(commandBuffer, cmd->lineWidth);
+        break;
+      }
+      case Op::SetScissor: {
+        auto const* cmd = static_cast<const SetScissorCmd*>(payload);
+        volk.vkCmdSetScissor(commandBuffer, cmd->firstScissor, cmd->scissorCount, cmd->pScissors);
+        break;
+      }
+      case Op::SetStencilCompareMask: {
+        auto const* cmd = static_cast<const SetStencilCompareMaskCmd*>(payload);
+        volk.vkCmdSetStencilCompareMask(commandBuffer, cmd->faceMask, cmd->compareMask);
+        break;
+      }
+      case Op::SetStencilReference: {
+        auto const* cmd = static_cast<const SetStencilReferenceCmd*>(payload);
+        volk.vkCmdSetStencilReference(commandBuffer, cmd->faceMask, cmd->reference);
+        break;
+      }
+      case Op::SetStencilWriteMask: {
+        auto const* cmd = static_cast<const SetStencilWriteMaskCmd*>(payload);
+        volk.vkCmdSetStencilWriteMask(commandBuffer, cmd->faceMask, cmd->writeMask);
+        break;
+      }
+      case Op::SetViewport: {
+        auto const* cmd = static_cast<const SetViewportCmd*>(payload);
+        volk.vkCmdSetViewport(commandBuffer, cmd->firstViewport, cmd->viewportCount, cmd->pViewports);
+        break;
+      }
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_BASE_VERSION_1_1)
+      case Op::SetDeviceMask: {
+        auto const* cmd = static_cast<const SetDeviceMaskCmd*>(payload);
+        volk.vkCmdSetDeviceMask(commandBuffer, cmd->deviceMask);
+        break;
+      }
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+      case Op::DispatchBase: {
+        auto const* cmd = static_cast<const DispatchBaseCmd*>(payload);
+        volk.vkCmdDispatchBase(commandBuffer, cmd->baseGroupX, cmd->baseGroupY, cmd->baseGroupZ, cmd->groupCountX,
+                               cmd->groupCountY, cmd->groupCountZ);
+        break;
+      }
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+      case Op::BeginRenderPass2: {
+        auto const* cmd = static_cast<const BeginRenderPass2Cmd*>(payload);
+        volk.vkCmdBeginRenderPass2(commandBuffer, cmd->pRenderPassBegin, cmd->pSubpassBeginInfo);
+        break;
+      }
+      case Op::DrawIndexedIndirectCount: {
+        auto const* cmd = static_cast<const DrawIndexedIndirectCountCmd*>(payload);
+        volk.vkCmdDrawIndexedIndirectCount(commandBuffer, cmd->buffer, cmd->offset, cmd->countBuffer,
+                                           cmd->countBufferOffset, cmd->maxDrawCount, cmd->stride);
+        break;
+      }
+      case Op::DrawIndirectCount: {
+        auto const* cmd = static_cast<const DrawIndirectCountCmd*>(payload);
+        volk.vkCmdDrawIndirectCount(commandBuffer, cmd->buffer, cmd->offset, cmd->countBuffer, cmd->countBufferOffset,
+                                    cmd->maxDrawCount, cmd->stride);
+        break;
+      }
+      case Op::EndRenderPass2: {
+        auto const* cmd = static_cast<const EndRenderPass2Cmd*>(payload);
+        volk.vkCmdEndRenderPass2(commandBuffer, cmd->pSubpassEndInfo);
+        break;
+      }
+      case Op::NextSubpass2: {
+        auto const* cmd = static_cast<const NextSubpass2Cmd*>(payload);
+        volk.vkCmdNextSubpass2(commandBuffer, cmd->pSubpassBeginInfo, cmd->pSubpassEndInfo);
+        break;
+      }
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+      case Op::CopyBuffer2: {
+        auto const* cmd = static_cast<const CopyBuffer2Cmd*>(payload);
+        volk.vkCmdCopyBuffer2(commandBuffer, cmd->pCopyBufferInfo);
+        break;
+      }
+      case Op::CopyBufferToImage2: {
+        auto const* cmd = static_cast<const CopyBufferToImage2Cmd*>(payload);
+        volk.vkCmdCopyBufferToImage2(commandBuffer, cmd->pCopyBufferToImageInfo);
+        break;
+      }
+      case Op::CopyImage2: {
+        auto const* cmd = static_cast<const CopyImage2Cmd*>(payload);
+        volk.vkCmdCopyImage2(commandBuffer, cmd->pCopyImageInfo);
+        break;
+      }
+      case Op::CopyImageToBuffer2: {
+        auto const* cmd = static_cast<const CopyImageToBuffer2Cmd*>(payload);
+        volk.vkCmdCopyImageToBuffer2(commandBuffer, cmd->pCopyImageToBufferInfo);
+        break;
+      }
+      case Op::PipelineBarrier2: {
+        auto const* cmd = static_cast<const PipelineBarrier2Cmd*>(payload);
+        volk.vkCmdPipelineBarrier2(commandBuffer, cmd->pDependencyInfo);
+        break;
+      }
+      case Op::WriteTimestamp2: {
+        auto const* cmd = static_cast<const WriteTimestamp2Cmd*>(payload);
+        volk.vkCmdWriteTimestamp2(commandBuffer, cmd->stage, cmd->queryPool, cmd->query);
+        break;
+      }
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_3)
+      case Op::ResetEvent2: {
+        auto const* cmd = static_cast<const ResetEvent2Cmd*>(payload);
+        volk.vkCmdResetEvent2(commandBuffer, cmd->event, cmd->stageMask);
+        break;
+      }
+      case Op::SetEvent2: {
+        auto const* cmd = static_cast<const SetEvent2Cmd*>(payload);
+        volk.vkCmdSetEvent2(commandBuffer, cmd->event, cmd->pDependencyInfo);
+        break;
+      }
+      case Op::WaitEvents2: {
+        auto const* cmd = static_cast<const WaitEvents2Cmd*>(payload);
+        volk.vkCmdWaitEvents2(commandBuffer, cmd->eventCount, cmd->pEvents, cmd->pDependencyInfos);
+        break;
+      }
+#endif /* defined(VK_COMPUTE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+      case Op::BeginRendering: {
+        auto const* cmd = static_cast<const BeginRenderingCmd*>(payload);
+        volk.vkCmdBeginRendering(commandBuffer, cmd->pRenderingInfo);
+        break;
+      }
+      case Op::BindVertexBuffers2: {
+        auto const* cmd = static_cast<const BindVertexBuffers2Cmd*>(payload);
+        volk.vkCmdBindVertexBuffers2(commandBuffer, cmd->firstBinding, cmd->bindingCount, cmd->pBuffers, cmd->pOffsets,
+                                     cmd->pSizes, cmd->pStrides);
+        break;
+      }
+      case Op::BlitImage2: {
+        auto const* cmd = static_cast<const BlitImage2Cmd*>(payload);
+        volk.vkCmdBlitImage2(commandBuffer, cmd->pBlitImageInfo);
+        break;
+      }
+      case Op::EndRendering:
+        volk.vkCmdEndRendering(commandBuffer);
+        break;
+      case Op::ResolveImage2: {
+        auto const* cmd = static_cast<const ResolveImage2Cmd*>(payload);
+        volk.vkCmdResolveImage2(commandBuffer, cmd->pResolveImageInfo);
+        break;
+      }
+      case Op::SetCullMode: {
+        auto const* cmd = static_cast<const SetCullModeCmd*>(payload);
+        volk.vkCmdSetCullMode(commandBuffer, cmd->cullMode);
+        break;
+      }
+      case Op::SetDepthBiasEnable: {
+        auto const* cmd = static_cast<const SetDepthBiasEnableCmd*>(payload);
+        volk.vkCmdSetDepthBiasEnable(commandBuffer, cmd->depthBiasEnable);
+        break;
+      }
+      case Op::SetDepthBoundsTestEnable: {
+        auto const* cmd = static_cast<const SetDepthBoundsTestEnableCmd*>(payload);
+        volk.vkCmdSetDepthBoundsTestEnable(commandBuffer, cmd->depthBoundsTestEnable);
+        break;
+      }
+      case Op::SetDepthCompareOp: {
+        auto const* cmd = static_cast<const SetDepthCompareOpCmd*>(payload);
+        volk.vkCmdSetDepthCompareOp(commandBuffer, cmd->depthCompareOp);
+        break;
+      }
+      case Op::SetDepthTestEnable: {
+        auto const* cmd = static_cast<const SetDepthTestEnableCmd*>(payload);
+        volk.vkCmdSetDepthTestEnable(commandBuffer, cmd->depthTestEnable);
+        break;
+      }
+      case Op::SetDepthWriteEnable: {
+        auto const* cmd = static_cast<const SetDepthWriteEnableCmd*>(payload);
+        volk.vkCmdSetDepthWriteEnable(commandBuffer, cmd->depthWriteEnable);
+        break;
+      }
+      case Op::SetFrontFace: {
+        auto const* cmd = static_cast<const SetFrontFaceCmd*>(payload);
+        volk.vkCmdSetFrontFace(commandBuffer, cmd->frontFace);
+        break;
+      }
+      case Op::SetPrimitiveRestartEnable: {
+        auto const* cmd = static_cast<const SetPrimitiveRestartEnableCmd*>(payload);
+        volk.vkCmdSetPrimitiveRestartEnable(commandBuffer, cmd->primitiveRestartEnable);
+        break;
+      }
+      case Op::SetPrimitiveTopology: {
+        auto const* cmd = static_cast<const SetPrimitiveTopologyCmd*>(payload);
+        volk.vkCmdSetPrimitiveTopology(commandBuffer, cmd->primitiveTopology);
+        break;
+      }
+      case Op::SetRasterizerDiscardEnable: {
+        auto const* cmd = static_cast<const SetRasterizerDiscardEnableCmd*>(payload);
+        volk.vkCmdSetRasterizerDiscardEnable(commandBuffer, cmd->rasterizerDiscardEnable);
+        break;
+      }
+      case Op::SetScissorWithCount: {
+        auto const* cmd = static_cast<const SetScissorWithCountCmd*>(payload);
+        volk.vkCmdSetScissorWithCount(commandBuffer, cmd->scissorCount, cmd->pScissors);
+        break;
+      }
+      case Op::SetStencilOp: {
+        auto const* cmd = static_cast<const SetStencilOpCmd*>(payload);
+        volk.vkCmdSetStencilOp(commandBuffer, cmd->faceMask, cmd->failOp, cmd->passOp, cmd->depthFailOp,
+                               cmd->compareOp);
+        break;
+      }
+      case Op::SetStencilTestEnable: {
+        auto const* cmd = static_cast<const SetStencilTestEnableCmd*>(payload);
+        volk.vkCmdSetStencilTestEnable(commandBuffer, cmd->stencilTestEnable);
+        break;
+      }
+      case Op::SetViewportWithCount: {
+        auto const* cmd = static_cast<const SetViewportWithCountCmd*>(payload);
+        volk.vkCmdSetViewportWithCount(commandBuffer, cmd->viewportCount, cmd->pViewports);
+        break;
+      }
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+      case Op::BindDescriptorSets2: {
+        auto const* cmd = static_cast<const BindDescriptorSets2Cmd*>(payload);
+        volk.vkCmdBindDescriptorSets2(commandBuffer, cmd->pBindDescriptorSetsInfo);
+        break;
+      }
+      case Op::PushConstants2: {
+        auto const* cmd = static_cast<const PushConstants2Cmd*>(payload);
+        volk.vkCmdPushConstants2(commandBuffer, cmd->pPushConstantsInfo);
+        break;
+      }
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+      case Op::BindIndexBuffer2: {
+        auto const* cmd = static_cast<const BindIndexBuffer2Cmd*>(payload);
+        volk.vkCmdBindIndexBuffer2(commandBuffer, cmd->buffer, cmd->offset, cmd->size, cmd->indexType);
+        break;
+      }
+      case Op::SetLineStipple: {
+        auto const* cmd = static_cast<const SetLineStippleCmd*>(payload);
+        volk.vkCmdSetLineStipple(commandBuffer, cmd->lineStippleFactor, cmd->lineStipplePattern);
+        break;
+      }
+      case Op::SetRenderingAttachmentLocations: {
+        auto const* cmd = static_cast<const SetRenderingAttachmentLocationsCmd*>(payload);
+        volk.vkCmdSetRenderingAttachmentLocations(commandBuffer, cmd->pLocationInfo);
+        break;
+      }
+      case Op::SetRenderingInputAttachmentIndices: {
+        auto const* cmd = static_cast<const SetRenderingInputAttachmentIndicesCmd*>(payload);
+        volk.vkCmdSetRenderingInputAttachmentIndices(commandBuffer, cmd->pInputAttachmentIndexInfo);
+        break;
+      }
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+      /* VOLK_CPP_GENERATE_DEFERRED_REPLAY */
+      default:
+        break;
+      }
+    }
+  }
+  return VK_SUCCESS;
+}
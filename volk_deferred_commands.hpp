@@ -0,0 +1,307 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Deferred command stream: records vkCmd* calls into a compact arena-backed byte stream without calling the driver,
+ * and replays them into a real command buffer later, possibly on another thread.
+ *
+ * The recording methods have the signatures of the Volk function pointers, so code templated on the table type can
+ * record into either; their VkCommandBuffer argument is ignored. Arrays are copied into the stream, so they don't need
+ * to outlive the call.
+ *
+ * Every core vkCmd* command whose parameters can be copied is supported; structures are copied deeply, with the nested
+ * arrays of e.g. dependency and rendering infos. pNext chains are copied if they only hold core structures which extend
+ * a recorded structure (e.g. VkDeviceGroupRenderPassBeginInfo); recording any other structure in a chain doesn't
+ * record the command, and replay() returns VK_ERROR_FEATURE_NOT_PRESENT. The push descriptor commands, whose data has
+ * no size or depends on the descriptor type, and extension commands aren't supported.
+ *
+ * A stream isn't internally synchronized: record on one thread, then replay (any number of times) or reset.
+ */
+class VolkDeferredCommands final {
+public:
+  VolkDeferredCommands() noexcept = default;
+  VolkDeferredCommands(const VolkDeferredCommands&) = delete;
+  VolkDeferredCommands& operator=(const VolkDeferredCommands&) = delete;
+  VolkDeferredCommands(VolkDeferredCommands&&) = default;
+  VolkDeferredCommands& operator=(VolkDeferredCommands&&) = default;
+
+  /**
+   * Record the stream into commandBuffer with the function pointers of volk, which must have device functions loaded.
+   * Returns VK_ERROR_FEATURE_NOT_PRESENT if a command couldn't be recorded, in which case nothing is replayed.
+   */
+  VkResult replay(VkCommandBuffer commandBuffer, const Volk& volk) const noexcept;
+
+  /**
+   * Drop all recorded commands; the arena memory is kept for reuse.
+   */
+  void reset() noexcept;
+
+  [[nodiscard]] bool isEmpty() const noexcept;
+
+  /**
+   * Bytes of the arena in use.
+   */
+  [[nodiscard]] size_t getSize() const noexcept;
+
+  /* VOLK_CPP_GENERATE_DEFERRED_DECLARATIONS */
+#if defined(VK_BASE_VERSION_1_0)
+  void vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query,
+                       VkQueryControlFlags flags) noexcept;
+  void vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount,
+                       const VkBufferCopy* pRegions) noexcept;
+  void vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage,
+                              VkImageLayout dstImageLayout, uint32_t regionCount,
+                              const VkBufferImageCopy* pRegions) noexcept;
+  void vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage,
+                      VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy* pRegions) noexcept;
+  void vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                              VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy* pRegions) noexcept;
+  void vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
+                                 uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride,
+                                 VkQueryResultFlags flags) noexcept;
+  void vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) noexcept;
+  void vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                            const VkCommandBuffer* pCommandBuffers) noexcept;
+  void vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size,
+                       uint32_t data) noexcept;
+  void vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                            VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                            uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                            uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                            uint32_t imageMemoryBarrierCount,
+                            const VkImageMemoryBarrier* pImageMemoryBarriers) noexcept;
+  void vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery,
+                           uint32_t queryCount) noexcept;
+  void vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
+                         VkDeviceSize dataSize, const void* pData) noexcept;
+  void vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool,
+                           uint32_t query) noexcept;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+  void vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                               VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
+                               const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount,
+                               const uint32_t* pDynamicOffsets) noexcept;
+  void vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                         VkPipeline pipeline) noexcept;
+  void vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout,
+                            const VkClearColorValue* pColor, uint32_t rangeCount,
+                            const VkImageSubresourceRange* pRanges) noexcept;
+  void vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY,
+                     uint32_t groupCountZ) noexcept;
+  void vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) noexcept;
+  void vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                          uint32_t offset, uint32_t size, const void* pValues) noexcept;
+  void vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) noexcept;
+  void vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) noexcept;
+  void vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                       VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
+                       uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                       uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                       uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) noexcept;
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  void vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                            VkSubpassContents contents) noexcept;
+  void vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                            VkIndexType indexType) noexcept;
+  void vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                              const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) noexcept;
+  void vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage,
+                      VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit* pRegions,
+                      VkFilter filter) noexcept;
+  void vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
+                             const VkClearAttachment* pAttachments, uint32_t rectCount,
+                             const VkClearRect* pRects) noexcept;
+  void vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout,
+                                   const VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount,
+                                   const VkImageSubresourceRange* pRanges) noexcept;
+  void vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
+                 uint32_t firstInstance) noexcept;
+  void vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex,
+                        int32_t vertexOffset, uint32_t firstInstance) noexcept;
+  void vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
+                                uint32_t stride) noexcept;
+  void vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount,
+                         uint32_t stride) noexcept;
+  void vkCmdEndRenderPass(VkCommandBuffer commandBuffer) noexcept;
+  void vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) noexcept;
+  void vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout,
+                         VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount,
+                         const VkImageResolve* pRegions) noexcept;
+  void vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) noexcept;
+  void vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp,
+                         float depthBiasSlopeFactor) noexcept;
+  void vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) noexcept;
+  void vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) noexcept;
+  void vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                       const VkRect2D* pScissors) noexcept;
+  void vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
+                                  uint32_t compareMask) noexcept;
+  void vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
+                                uint32_t reference) noexcept;
+  void vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask,
+                                uint32_t writeMask) noexcept;
+  void vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                        const VkViewport* pViewports) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_BASE_VERSION_1_1)
+  void vkCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) noexcept;
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+  void vkCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ,
+                         uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) noexcept;
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  void vkCmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
+                             const VkSubpassBeginInfo* pSubpassBeginInfo) noexcept;
+  void vkCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
+                                     VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount,
+                                     uint32_t stride) noexcept;
+  void vkCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer,
+                              VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) noexcept;
+  void vkCmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo* pSubpassEndInfo) noexcept;
+  void vkCmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo* pSubpassBeginInfo,
+                         const VkSubpassEndInfo* pSubpassEndInfo) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+  void vkCmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) noexcept;
+  void vkCmdCopyBufferToImage2(VkCommandBuffer commandBuffer,
+                               const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) noexcept;
+  void vkCmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2* pCopyImageInfo) noexcept;
+  void vkCmdCopyImageToBuffer2(VkCommandBuffer commandBuffer,
+                               const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) noexcept;
+  void vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo) noexcept;
+  void vkCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool,
+                            uint32_t query) noexcept;
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_3)
+  void vkCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) noexcept;
+  void vkCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo* pDependencyInfo) noexcept;
+  void vkCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
+                        const VkDependencyInfo* pDependencyInfos) noexcept;
+#endif /* defined(VK_COMPUTE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+  void vkCmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo* pRenderingInfo) noexcept;
+  void vkCmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount,
+                               const VkBuffer* pBuffers, const VkDeviceSize* pOffsets, const VkDeviceSize* pSizes,
+                               const VkDeviceSize* pStrides) noexcept;
+  void vkCmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2* pBlitImageInfo) noexcept;
+  void vkCmdEndRendering(VkCommandBuffer commandBuffer) noexcept;
+  void vkCmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2* pResolveImageInfo) noexcept;
+  void vkCmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) noexcept;
+  void vkCmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) noexcept;
+  void vkCmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) noexcept;
+  void vkCmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) noexcept;
+  void vkCmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) noexcept;
+  void vkCmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) noexcept;
+  void vkCmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) noexcept;
+  void vkCmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) noexcept;
+  void vkCmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) noexcept;
+  void vkCmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) noexcept;
+  void vkCmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount,
+                                const VkRect2D* pScissors) noexcept;
+  void vkCmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp,
+                         VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) noexcept;
+  void vkCmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) noexcept;
+  void vkCmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount,
+                                 const VkViewport* pViewports) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+  void vkCmdBindDescriptorSets2(VkCommandBuffer commandBuffer,
+                                const VkBindDescriptorSetsInfo* pBindDescriptorSetsInfo) noexcept;
+  void vkCmdPushConstants2(VkCommandBuffer commandBuffer, const VkPushConstantsInfo* pPushConstantsInfo) noexcept;
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+  void vkCmdBindIndexBuffer2(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size,
+                             VkIndexType indexType) noexcept;
+  void vkCmdSetLineStipple(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
+                           uint16_t lineStipplePattern) noexcept;
+  void vkCmdSetRenderingAttachmentLocations(VkCommandBuffer commandBuffer,
+                                            const VkRenderingAttachmentLocationInfo* pLocationInfo) noexcept;
+  void vkCmdSetRenderingInputAttachmentIndices(VkCommandBuffer commandBuffer,
+                                               const VkRenderingInputAttachmentIndexInfo* pInputAttachmentIndexInfo) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+  /* VOLK_CPP_GENERATE_DEFERRED_DECLARATIONS */
+
+private:
+  enum class Op : uint32_t;
+
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> data;
+    size_t size = 0;
+    size_t used = 0;
+  };
+
+  [[nodiscard]] void* allocate(Op op, size_t size) noexcept;
+  template <typename T>
+  [[nodiscard]] T* push(Op op) noexcept;
+  template <typename T>
+  [[nodiscard]] T* copy(const T* data, size_t count) noexcept;
+  template <typename T>
+  [[nodiscard]] T* copyStructs(const T* data, size_t count) noexcept;
+  [[nodiscard]] const void* copyChain(const void* pNext) noexcept;
+  [[nodiscard]] const void* copyExtension(const VkBaseInStructure* pNext) noexcept;
+
+  /* VOLK_CPP_GENERATE_DEFERRED_COPY_DECLARATIONS */
+#if defined(VK_BASE_VERSION_1_0)
+  void copyMembers(VkBufferMemoryBarrier& value) noexcept;
+  void copyMembers(VkImageMemoryBarrier& value) noexcept;
+  void copyMembers(VkMemoryBarrier& value) noexcept;
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+  void copyMembers(VkPipelineLayoutCreateInfo& value) noexcept;
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  void copyMembers(VkRenderPassBeginInfo& value) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_1)
+  void copyMembers(VkDeviceGroupRenderPassBeginInfo& value) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  void copyMembers(VkRenderPassAttachmentBeginInfo& value) noexcept;
+  void copyMembers(VkSubpassBeginInfo& value) noexcept;
+  void copyMembers(VkSubpassEndInfo& value) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+  void copyMembers(VkBufferCopy2& value) noexcept;
+  void copyMembers(VkBufferImageCopy2& value) noexcept;
+  void copyMembers(VkBufferMemoryBarrier2& value) noexcept;
+  void copyMembers(VkCopyBufferInfo2& value) noexcept;
+  void copyMembers(VkCopyBufferToImageInfo2& value) noexcept;
+  void copyMembers(VkCopyImageInfo2& value) noexcept;
+  void copyMembers(VkCopyImageToBufferInfo2& value) noexcept;
+  void copyMembers(VkDependencyInfo& value) noexcept;
+  void copyMembers(VkImageCopy2& value) noexcept;
+  void copyMembers(VkImageMemoryBarrier2& value) noexcept;
+  void copyMembers(VkMemoryBarrier2& value) noexcept;
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+  void copyMembers(VkBlitImageInfo2& value) noexcept;
+  void copyMembers(VkImageBlit2& value) noexcept;
+  void copyMembers(VkImageResolve2& value) noexcept;
+  void copyMembers(VkRenderingAttachmentInfo& value) noexcept;
+  void copyMembers(VkRenderingInfo& value) noexcept;
+  void copyMembers(VkResolveImageInfo2& value) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+  void copyMembers(VkBindDescriptorSetsInfo& value) noexcept;
+  void copyMembers(VkPushConstantsInfo& value) noexcept;
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+  void copyMembers(VkRenderingAttachmentLocationInfo& value) noexcept;
+  void copyMembers(VkRenderingInputAttachmentIndexInfo& value) noexcept;
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+  /* VOLK_CPP_GENERATE_DEFERRED_COPY_DECLARATIONS */
+
+  std::vector<Chunk> chunks_;
+  size_t current_ = 0;
+  VkResult status_ = VK_SUCCESS;
+};
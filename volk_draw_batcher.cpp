@@ -0,0 +1,120 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_draw_batcher.hpp"
+
+#if defined(VK_GRAPHICS_VERSION_1_0)
+
+VolkDrawBatcher::VolkDrawBatcher(Volk& volk, VkPhysicalDevice physicalDevice) noexcept : volk_(volk) {
+#if defined(VK_EXT_multi_draw)
+  if (!volk_.vkCmdDrawMultiEXT || !volk_.vkCmdDrawMultiIndexedEXT || !volk_.vkGetPhysicalDeviceFeatures2 ||
+      !volk_.vkGetPhysicalDeviceProperties2) {
+    return;
+  }
+
+  VkPhysicalDeviceMultiDrawFeaturesEXT multiDrawFeatures = {};
+  multiDrawFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT;
+  VkPhysicalDeviceFeatures2 features = {};
+  features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+  features.pNext = &multiDrawFeatures;
+  volk_.vkGetPhysicalDeviceFeatures2(physicalDevice, &features);
+  if (!multiDrawFeatures.multiDraw) {
+    return;
+  }
+
+  VkPhysicalDeviceMultiDrawPropertiesEXT multiDrawProperties = {};
+  multiDrawProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT;
+  VkPhysicalDeviceProperties2 properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties.pNext = &multiDrawProperties;
+  volk_.vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+
+  // drawCount must be less than maxMultiDrawCount, and a single draw is never worth a multi-draw call.
+  maxMultiDrawCount_ = multiDrawProperties.maxMultiDrawCount > 2 ? multiDrawProperties.maxMultiDrawCount : 0;
+#else
+  (void)physicalDevice;
+#endif
+}
+
+VkResult VolkDrawBatcher::getStatus() const noexcept {
+  return maxMultiDrawCount_ != 0 ? VK_SUCCESS : VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+const VolkDrawBatcher::Stats& VolkDrawBatcher::getStats() const noexcept {
+  return stats_;
+}
+
+bool VolkDrawBatcher::append(VkCommandBuffer commandBuffer, Kind kind, uint32_t instanceCount,
+                             uint32_t firstInstance) noexcept {
+  ++stats_.draws;
+  if (maxMultiDrawCount_ == 0) {
+    return false;
+  }
+  if (kind_ != Kind::None && (commandBuffer != commandBuffer_ || kind != kind_ || instanceCount != instanceCount_ ||
+                              firstInstance != firstInstance_)) {
+    flush();
+  }
+  commandBuffer_ = commandBuffer;
+  kind_ = kind;
+  instanceCount_ = instanceCount;
+  firstInstance_ = firstInstance;
+  return true;
+}
+
+void VolkDrawBatcher::vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount,
+                                uint32_t firstVertex, uint32_t firstInstance) noexcept {
+  if (!append(commandBuffer, Kind::Draw, instanceCount, firstInstance)) {
+    ++stats_.driverCalls;
+    volk_.vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    return;
+  }
+#if defined(VK_EXT_multi_draw)
+  draws_.push_back({firstVertex, vertexCount});
+  if (draws_.size() == maxMultiDrawCount_ - 1) {
+    flush();
+  }
+#endif
+}
+
+void VolkDrawBatcher::vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
+                                       uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) noexcept {
+  if (!append(commandBuffer, Kind::DrawIndexed, instanceCount, firstInstance)) {
+    ++stats_.driverCalls;
+    volk_.vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+    return;
+  }
+#if defined(VK_EXT_multi_draw)
+  indexedDraws_.push_back({firstIndex, indexCount, vertexOffset});
+  if (indexedDraws_.size() == maxMultiDrawCount_ - 1) {
+    flush();
+  }
+#endif
+}
+
+void VolkDrawBatcher::flush() noexcept {
+#if defined(VK_EXT_multi_draw)
+  if (kind_ == Kind::Draw && !draws_.empty()) {
+    ++stats_.driverCalls;
+    if (draws_.size() == 1) {
+      volk_.vkCmdDraw(commandBuffer_, draws_[0].vertexCount, instanceCount_, draws_[0].firstVertex, firstInstance_);
+    } else {
+      volk_.vkCmdDrawMultiEXT(commandBuffer_, static_cast<uint32_t>(draws_.size()), draws_.data(), instanceCount_,
+                              firstInstance_, sizeof(VkMultiDrawInfoEXT));
+    }
+  } else if (kind_ == Kind::DrawIndexed && !indexedDraws_.empty()) {
+    ++stats_.driverCalls;
+    if (indexedDraws_.size() == 1) {
+      auto const& draw = indexedDraws_[0];
+      volk_.vkCmdDrawIndexed(commandBuffer_, draw.indexCount, instanceCount_, draw.firstIndex, draw.vertexOffset,
+                             firstInstance_);
+    } else {
+      volk_.vkCmdDrawMultiIndexedEXT(commandBuffer_, static_cast<uint32_t>(indexedDraws_.size()),
+                                     indexedDraws_.data(), instanceCount_, firstInstance_,
+                                     sizeof(VkMultiDrawIndexedInfoEXT), nullptr);
+    }
+  }
+  draws_.clear();
+  indexedDraws_.clear();
+#endif
+  kind_ = Kind::None;
+}
+
+#endif
@@ -0,0 +1,92 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <cstdint>
+#include <vector>
+
+#if defined(VK_GRAPHICS_VERSION_1_0)
+
+/**
+ * Coalesces consecutive vkCmdDraw/vkCmdDrawIndexed calls into vkCmdDrawMultiEXT/vkCmdDrawMultiIndexedEXT.
+ *
+ * Draws are buffered while they can share one multi-draw call: same command buffer, same kind, same instance count
+ * and first instance. The batch is emitted when that stops being true, when it reaches maxMultiDrawCount - 1 draws
+ * (drawCount must be less than the limit), or on flush(). Any other command recorded between draws must go through
+ * call() (or follow a flush()), so that it is ordered after the buffered draws; flush before ending the render pass
+ * or the command buffer.
+ *
+ * Batching changes gl_DrawID (DrawIndex in SPIR-V): the draws of one multi-draw call see 0, 1, 2... in recording
+ * order instead of 0 each, so shaders which use it must not be drawn through a batcher.
+ *
+ * Without VK_EXT_multi_draw, or if the device doesn't support the multiDraw feature, the draws are forwarded
+ * immediately. A batcher is meant to be used by one recording thread; its scratch arrays are reused across batches.
+ */
+class VolkDrawBatcher final {
+public:
+  struct Stats {
+    uint64_t draws = 0;       // draws recorded through the batcher
+    uint64_t driverCalls = 0; // draw calls that reached the driver
+  };
+
+  /**
+   * Volk must have device function pointers loaded; multi-draw is used if VK_EXT_multi_draw is loaded and the
+   * physical device supports the multiDraw feature, which must then be enabled on the device.
+   */
+  VolkDrawBatcher(Volk& volk, VkPhysicalDevice physicalDevice) noexcept;
+  VolkDrawBatcher(const VolkDrawBatcher&) = delete;
+  VolkDrawBatcher& operator=(const VolkDrawBatcher&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if draws are forwarded one by one because VK_EXT_multi_draw isn't loaded or
+   * supported.
+   */
+  [[nodiscard]] VkResult getStatus() const noexcept;
+
+  void vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex,
+                 uint32_t firstInstance) noexcept;
+  void vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount,
+                        uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) noexcept;
+
+  /**
+   * Emit the buffered draws.
+   */
+  void flush() noexcept;
+
+  /**
+   * Flush, then call a Vulkan function pointer, e.g. call(volk.vkCmdBindPipeline, cmd, bindPoint, pipeline).
+   */
+  template <typename Function, typename... Args>
+  decltype(auto) call(Function function, Args... args) noexcept {
+    flush();
+    return function(args...);
+  }
+
+  [[nodiscard]] const Stats& getStats() const noexcept;
+
+private:
+  enum class Kind : uint32_t {
+    None,
+    Draw,
+    DrawIndexed,
+  };
+
+  [[nodiscard]] bool append(VkCommandBuffer commandBuffer, Kind kind, uint32_t instanceCount,
+                            uint32_t firstInstance) noexcept;
+
+  Volk& volk_;
+  uint32_t maxMultiDrawCount_ = 0;
+  Stats stats_;
+
+  VkCommandBuffer commandBuffer_ = VK_NULL_HANDLE;
+  Kind kind_ = Kind::None;
+  uint32_t instanceCount_ = 0;
+  uint32_t firstInstance_ = 0;
+#if defined(VK_EXT_multi_draw)
+  std::vector<VkMultiDrawInfoEXT> draws_;
+  std::vector<VkMultiDrawIndexedInfoEXT> indexedDraws_;
+#endif
+};
+
+#endif
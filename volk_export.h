@@ -0,0 +1,1743 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+/* clang-format off */
+#pragma once
+
+/**
+ * C-compatible description of a loaded Volk, passed from a host application to plugins and shared libraries.
+ *
+ * VolkCppExport is versioned and only grows: new fields are appended and exportVersion is bumped, so a plugin can
+ * check structSize before reading a field it knows about. The function pointers themselves are copied into a plain
+ * VolkCppTable, which plugins use directly (C) or import into their own Volk (C++). See Volk::exportTable() and
+ * Volk::Volk(const VolkCppExport&).
+ */
+
+#if !defined(VULKAN_H_) && !defined(VULKAN_CORE_H_)
+  #ifndef VK_NO_PROTOTYPES
+    #define VK_NO_PROTOTYPES
+  #endif
+  #ifdef VOLK_CPP_VULKAN_H_PATH
+    #include VOLK_CPP_VULKAN_H_PATH
+  #else
+    #include <vulkan/vulkan_core.h>
+  #endif
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define VOLK_CPP_EXPORT_VERSION 1
+
+/* VOLK_CPP_GENERATE_VERSION_DEFINE */
+#define VOLK_CPP_HEADER_VERSION 344
+/* VOLK_CPP_GENERATE_VERSION_DEFINE */
+
+/* Bits of VolkCppExport::loadedMask */
+#define VOLK_CPP_EXPORT_INSTANCE_BIT 0x00000001u
+#define VOLK_CPP_EXPORT_DEVICE_BIT 0x00000002u
+
+/**
+ * Function pointers of a Volk. The layout only depends on headerVersion: commands which aren't compiled in are
+ * replaced with padding of the same size, so tables built against different Vulkan headers or platform defines
+ * are interchangeable as long as headerVersion and structSize match.
+ */
+typedef struct VolkCppTable {
+  uint32_t structSize;    /* sizeof(VolkCppTable) of the exporter */
+  uint32_t headerVersion; /* VOLK_CPP_HEADER_VERSION of the exporter */
+  /* VOLK_CPP_GENERATE_EXPORT_FUNCTION_POINTERS */
+#if defined(VK_BASE_VERSION_1_0)
+  PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers;
+  PFN_vkAllocateMemory vkAllocateMemory;
+  PFN_vkBeginCommandBuffer vkBeginCommandBuffer;
+  PFN_vkBindBufferMemory vkBindBufferMemory;
+  PFN_vkBindImageMemory vkBindImageMemory;
+  PFN_vkCmdBeginQuery vkCmdBeginQuery;
+  PFN_vkCmdCopyBuffer vkCmdCopyBuffer;
+  PFN_vkCmdCopyBufferToImage vkCmdCopyBufferToImage;
+  PFN_vkCmdCopyImage vkCmdCopyImage;
+  PFN_vkCmdCopyImageToBuffer vkCmdCopyImageToBuffer;
+  PFN_vkCmdCopyQueryPoolResults vkCmdCopyQueryPoolResults;
+  PFN_vkCmdEndQuery vkCmdEndQuery;
+  PFN_vkCmdExecuteCommands vkCmdExecuteCommands;
+  PFN_vkCmdFillBuffer vkCmdFillBuffer;
+  PFN_vkCmdPipelineBarrier vkCmdPipelineBarrier;
+  PFN_vkCmdResetQueryPool vkCmdResetQueryPool;
+  PFN_vkCmdUpdateBuffer vkCmdUpdateBuffer;
+  PFN_vkCmdWriteTimestamp vkCmdWriteTimestamp;
+  PFN_vkCreateBuffer vkCreateBuffer;
+  PFN_vkCreateCommandPool vkCreateCommandPool;
+  PFN_vkCreateDevice vkCreateDevice;
+  PFN_vkCreateFence vkCreateFence;
+  PFN_vkCreateImage vkCreateImage;
+  PFN_vkCreateImageView vkCreateImageView;
+  PFN_vkCreateInstance vkCreateInstance;
+  PFN_vkCreateQueryPool vkCreateQueryPool;
+  PFN_vkCreateSemaphore vkCreateSemaphore;
+  PFN_vkDestroyBuffer vkDestroyBuffer;
+  PFN_vkDestroyCommandPool vkDestroyCommandPool;
+  PFN_vkDestroyDevice vkDestroyDevice;
+  PFN_vkDestroyFence vkDestroyFence;
+  PFN_vkDestroyImage vkDestroyImage;
+  PFN_vkDestroyImageView vkDestroyImageView;
+  PFN_vkDestroyInstance vkDestroyInstance;
+  PFN_vkDestroyQueryPool vkDestroyQueryPool;
+  PFN_vkDestroySemaphore vkDestroySemaphore;
+  PFN_vkDeviceWaitIdle vkDeviceWaitIdle;
+  PFN_vkEndCommandBuffer vkEndCommandBuffer;
+  PFN_vkEnumerateDeviceExtensionProperties vkEnumerateDeviceExtensionProperties;
+  PFN_vkEnumerateDeviceLayerProperties vkEnumerateDeviceLayerProperties;
+  PFN_vkEnumerateInstanceExtensionProperties vkEnumerateInstanceExtensionProperties;
+  PFN_vkEnumerateInstanceLayerProperties vkEnumerateInstanceLayerProperties;
+  PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices;
+  PFN_vkFlushMappedMemoryRanges vkFlushMappedMemoryRanges;
+  PFN_vkFreeCommandBuffers vkFreeCommandBuffers;
+  PFN_vkFreeMemory vkFreeMemory;
+  PFN_vkGetBufferMemoryRequirements vkGetBufferMemoryRequirements;
+  PFN_vkGetDeviceMemoryCommitment vkGetDeviceMemoryCommitment;
+  PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr;
+  PFN_vkGetDeviceQueue vkGetDeviceQueue;
+  PFN_vkGetFenceStatus vkGetFenceStatus;
+  PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements;
+  PFN_vkGetImageSparseMemoryRequirements vkGetImageSparseMemoryRequirements;
+  PFN_vkGetImageSubresourceLayout vkGetImageSubresourceLayout;
+  PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr;
+  PFN_vkGetPhysicalDeviceFeatures vkGetPhysicalDeviceFeatures;
+  PFN_vkGetPhysicalDeviceFormatProperties vkGetPhysicalDeviceFormatProperties;
+  PFN_vkGetPhysicalDeviceImageFormatProperties vkGetPhysicalDeviceImageFormatProperties;
+  PFN_vkGetPhysicalDeviceMemoryProperties vkGetPhysicalDeviceMemoryProperties;
+  PFN_vkGetPhysicalDeviceProperties vkGetPhysicalDeviceProperties;
+  PFN_vkGetPhysicalDeviceQueueFamilyProperties vkGetPhysicalDeviceQueueFamilyProperties;
+  PFN_vkGetPhysicalDeviceSparseImageFormatProperties vkGetPhysicalDeviceSparseImageFormatProperties;
+  PFN_vkGetQueryPoolResults vkGetQueryPoolResults;
+  PFN_vkInvalidateMappedMemoryRanges vkInvalidateMappedMemoryRanges;
+  PFN_vkMapMemory vkMapMemory;
+  PFN_vkQueueBindSparse vkQueueBindSparse;
+  PFN_vkQueueSubmit vkQueueSubmit;
+  PFN_vkQueueWaitIdle vkQueueWaitIdle;
+  PFN_vkResetCommandBuffer vkResetCommandBuffer;
+  PFN_vkResetCommandPool vkResetCommandPool;
+  PFN_vkResetFences vkResetFences;
+  PFN_vkUnmapMemory vkUnmapMemory;
+  PFN_vkWaitForFences vkWaitForFences;
+#else
+  PFN_vkVoidFunction padding0[73];
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+  PFN_vkAllocateDescriptorSets vkAllocateDescriptorSets;
+  PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets;
+  PFN_vkCmdBindPipeline vkCmdBindPipeline;
+  PFN_vkCmdClearColorImage vkCmdClearColorImage;
+  PFN_vkCmdDispatch vkCmdDispatch;
+  PFN_vkCmdDispatchIndirect vkCmdDispatchIndirect;
+  PFN_vkCmdPushConstants vkCmdPushConstants;
+  PFN_vkCmdResetEvent vkCmdResetEvent;
+  PFN_vkCmdSetEvent vkCmdSetEvent;
+  PFN_vkCmdWaitEvents vkCmdWaitEvents;
+  PFN_vkCreateBufferView vkCreateBufferView;
+  PFN_vkCreateComputePipelines vkCreateComputePipelines;
+  PFN_vkCreateDescriptorPool vkCreateDescriptorPool;
+  PFN_vkCreateDescriptorSetLayout vkCreateDescriptorSetLayout;
+  PFN_vkCreateEvent vkCreateEvent;
+  PFN_vkCreatePipelineCache vkCreatePipelineCache;
+  PFN_vkCreatePipelineLayout vkCreatePipelineLayout;
+  PFN_vkCreateSampler vkCreateSampler;
+  PFN_vkCreateShaderModule vkCreateShaderModule;
+  PFN_vkDestroyBufferView vkDestroyBufferView;
+  PFN_vkDestroyDescriptorPool vkDestroyDescriptorPool;
+  PFN_vkDestroyDescriptorSetLayout vkDestroyDescriptorSetLayout;
+  PFN_vkDestroyEvent vkDestroyEvent;
+  PFN_vkDestroyPipeline vkDestroyPipeline;
+  PFN_vkDestroyPipelineCache vkDestroyPipelineCache;
+  PFN_vkDestroyPipelineLayout vkDestroyPipelineLayout;
+  PFN_vkDestroySampler vkDestroySampler;
+  PFN_vkDestroyShaderModule vkDestroyShaderModule;
+  PFN_vkFreeDescriptorSets vkFreeDescriptorSets;
+  PFN_vkGetEventStatus vkGetEventStatus;
+  PFN_vkGetPipelineCacheData vkGetPipelineCacheData;
+  PFN_vkMergePipelineCaches vkMergePipelineCaches;
+  PFN_vkResetDescriptorPool vkResetDescriptorPool;
+  PFN_vkResetEvent vkResetEvent;
+  PFN_vkSetEvent vkSetEvent;
+  PFN_vkUpdateDescriptorSets vkUpdateDescriptorSets;
+#else
+  PFN_vkVoidFunction padding1[36];
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  PFN_vkCmdBeginRenderPass vkCmdBeginRenderPass;
+  PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer;
+  PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers;
+  PFN_vkCmdBlitImage vkCmdBlitImage;
+  PFN_vkCmdClearAttachments vkCmdClearAttachments;
+  PFN_vkCmdClearDepthStencilImage vkCmdClearDepthStencilImage;
+  PFN_vkCmdDraw vkCmdDraw;
+  PFN_vkCmdDrawIndexed vkCmdDrawIndexed;
+  PFN_vkCmdDrawIndexedIndirect vkCmdDrawIndexedIndirect;
+  PFN_vkCmdDrawIndirect vkCmdDrawIndirect;
+  PFN_vkCmdEndRenderPass vkCmdEndRenderPass;
+  PFN_vkCmdNextSubpass vkCmdNextSubpass;
+  PFN_vkCmdResolveImage vkCmdResolveImage;
+  PFN_vkCmdSetBlendConstants vkCmdSetBlendConstants;
+  PFN_vkCmdSetDepthBias vkCmdSetDepthBias;
+  PFN_vkCmdSetDepthBounds vkCmdSetDepthBounds;
+  PFN_vkCmdSetLineWidth vkCmdSetLineWidth;
+  PFN_vkCmdSetScissor vkCmdSetScissor;
+  PFN_vkCmdSetStencilCompareMask vkCmdSetStencilCompareMask;
+  PFN_vkCmdSetStencilReference vkCmdSetStencilReference;
+  PFN_vkCmdSetStencilWriteMask vkCmdSetStencilWriteMask;
+  PFN_vkCmdSetViewport vkCmdSetViewport;
+  PFN_vkCreateFramebuffer vkCreateFramebuffer;
+  PFN_vkCreateGraphicsPipelines vkCreateGraphicsPipelines;
+  PFN_vkCreateRenderPass vkCreateRenderPass;
+  PFN_vkDestroyFramebuffer vkDestroyFramebuffer;
+  PFN_vkDestroyRenderPass vkDestroyRenderPass;
+  PFN_vkGetRenderAreaGranularity vkGetRenderAreaGranularity;
+#else
+  PFN_vkVoidFunction padding2[28];
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_BASE_VERSION_1_1)
+  PFN_vkBindBufferMemory2 vkBindBufferMemory2;
+  PFN_vkBindImageMemory2 vkBindImageMemory2;
+  PFN_vkCmdSetDeviceMask vkCmdSetDeviceMask;
+  PFN_vkEnumerateInstanceVersion vkEnumerateInstanceVersion;
+  PFN_vkEnumeratePhysicalDeviceGroups vkEnumeratePhysicalDeviceGroups;
+  PFN_vkGetBufferMemoryRequirements2 vkGetBufferMemoryRequirements2;
+  PFN_vkGetDeviceGroupPeerMemoryFeatures vkGetDeviceGroupPeerMemoryFeatures;
+  PFN_vkGetDeviceQueue2 vkGetDeviceQueue2;
+  PFN_vkGetImageMemoryRequirements2 vkGetImageMemoryRequirements2;
+  PFN_vkGetImageSparseMemoryRequirements2 vkGetImageSparseMemoryRequirements2;
+  PFN_vkGetPhysicalDeviceExternalBufferProperties vkGetPhysicalDeviceExternalBufferProperties;
+  PFN_vkGetPhysicalDeviceExternalFenceProperties vkGetPhysicalDeviceExternalFenceProperties;
+  PFN_vkGetPhysicalDeviceExternalSemaphoreProperties vkGetPhysicalDeviceExternalSemaphoreProperties;
+  PFN_vkGetPhysicalDeviceFeatures2 vkGetPhysicalDeviceFeatures2;
+  PFN_vkGetPhysicalDeviceFormatProperties2 vkGetPhysicalDeviceFormatProperties2;
+  PFN_vkGetPhysicalDeviceImageFormatProperties2 vkGetPhysicalDeviceImageFormatProperties2;
+  PFN_vkGetPhysicalDeviceMemoryProperties2 vkGetPhysicalDeviceMemoryProperties2;
+  PFN_vkGetPhysicalDeviceProperties2 vkGetPhysicalDeviceProperties2;
+  PFN_vkGetPhysicalDeviceQueueFamilyProperties2 vkGetPhysicalDeviceQueueFamilyProperties2;
+  PFN_vkGetPhysicalDeviceSparseImageFormatProperties2 vkGetPhysicalDeviceSparseImageFormatProperties2;
+  PFN_vkTrimCommandPool vkTrimCommandPool;
+#else
+  PFN_vkVoidFunction padding3[21];
+#endif /* defined(VK_BASE_VERSION_1_1) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+  PFN_vkCmdDispatchBase vkCmdDispatchBase;
+  PFN_vkCreateDescriptorUpdateTemplate vkCreateDescriptorUpdateTemplate;
+  PFN_vkCreateSamplerYcbcrConversion vkCreateSamplerYcbcrConversion;
+  PFN_vkDestroyDescriptorUpdateTemplate vkDestroyDescriptorUpdateTemplate;
+  PFN_vkDestroySamplerYcbcrConversion vkDestroySamplerYcbcrConversion;
+  PFN_vkGetDescriptorSetLayoutSupport vkGetDescriptorSetLayoutSupport;
+  PFN_vkUpdateDescriptorSetWithTemplate vkUpdateDescriptorSetWithTemplate;
+#else
+  PFN_vkVoidFunction padding4[7];
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_BASE_VERSION_1_2)
+  PFN_vkGetBufferDeviceAddress vkGetBufferDeviceAddress;
+  PFN_vkGetBufferOpaqueCaptureAddress vkGetBufferOpaqueCaptureAddress;
+  PFN_vkGetDeviceMemoryOpaqueCaptureAddress vkGetDeviceMemoryOpaqueCaptureAddress;
+  PFN_vkGetSemaphoreCounterValue vkGetSemaphoreCounterValue;
+  PFN_vkResetQueryPool vkResetQueryPool;
+  PFN_vkSignalSemaphore vkSignalSemaphore;
+  PFN_vkWaitSemaphores vkWaitSemaphores;
+#else
+  PFN_vkVoidFunction padding5[7];
+#endif /* defined(VK_BASE_VERSION_1_2) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  PFN_vkCmdBeginRenderPass2 vkCmdBeginRenderPass2;
+  PFN_vkCmdDrawIndexedIndirectCount vkCmdDrawIndexedIndirectCount;
+  PFN_vkCmdDrawIndirectCount vkCmdDrawIndirectCount;
+  PFN_vkCmdEndRenderPass2 vkCmdEndRenderPass2;
+  PFN_vkCmdNextSubpass2 vkCmdNextSubpass2;
+  PFN_vkCreateRenderPass2 vkCreateRenderPass2;
+#else
+  PFN_vkVoidFunction padding6[6];
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+  PFN_vkCmdCopyBuffer2 vkCmdCopyBuffer2;
+  PFN_vkCmdCopyBufferToImage2 vkCmdCopyBufferToImage2;
+  PFN_vkCmdCopyImage2 vkCmdCopyImage2;
+  PFN_vkCmdCopyImageToBuffer2 vkCmdCopyImageToBuffer2;
+  PFN_vkCmdPipelineBarrier2 vkCmdPipelineBarrier2;
+  PFN_vkCmdWriteTimestamp2 vkCmdWriteTimestamp2;
+  PFN_vkCreatePrivateDataSlot vkCreatePrivateDataSlot;
+  PFN_vkDestroyPrivateDataSlot vkDestroyPrivateDataSlot;
+  PFN_vkGetDeviceBufferMemoryRequirements vkGetDeviceBufferMemoryRequirements;
+  PFN_vkGetDeviceImageMemoryRequirements vkGetDeviceImageMemoryRequirements;
+  PFN_vkGetDeviceImageSparseMemoryRequirements vkGetDeviceImageSparseMemoryRequirements;
+  PFN_vkGetPhysicalDeviceToolProperties vkGetPhysicalDeviceToolProperties;
+  PFN_vkGetPrivateData vkGetPrivateData;
+  PFN_vkQueueSubmit2 vkQueueSubmit2;
+  PFN_vkSetPrivateData vkSetPrivateData;
+#else
+  PFN_vkVoidFunction padding7[15];
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_COMPUTE_VERSION_1_3)
+  PFN_vkCmdResetEvent2 vkCmdResetEvent2;
+  PFN_vkCmdSetEvent2 vkCmdSetEvent2;
+  PFN_vkCmdWaitEvents2 vkCmdWaitEvents2;
+#else
+  PFN_vkVoidFunction padding8[3];
+#endif /* defined(VK_COMPUTE_VERSION_1_3) */
+#if defined(VK_GRAPHICS_VERSION_1_3)
+  PFN_vkCmdBeginRendering vkCmdBeginRendering;
+  PFN_vkCmdBindVertexBuffers2 vkCmdBindVertexBuffers2;
+  PFN_vkCmdBlitImage2 vkCmdBlitImage2;
+  PFN_vkCmdEndRendering vkCmdEndRendering;
+  PFN_vkCmdResolveImage2 vkCmdResolveImage2;
+  PFN_vkCmdSetCullMode vkCmdSetCullMode;
+  PFN_vkCmdSetDepthBiasEnable vkCmdSetDepthBiasEnable;
+  PFN_vkCmdSetDepthBoundsTestEnable vkCmdSetDepthBoundsTestEnable;
+  PFN_vkCmdSetDepthCompareOp vkCmdSetDepthCompareOp;
+  PFN_vkCmdSetDepthTestEnable vkCmdSetDepthTestEnable;
+  PFN_vkCmdSetDepthWriteEnable vkCmdSetDepthWriteEnable;
+  PFN_vkCmdSetFrontFace vkCmdSetFrontFace;
+  PFN_vkCmdSetPrimitiveRestartEnable vkCmdSetPrimitiveRestartEnable;
+  PFN_vkCmdSetPrimitiveTopology vkCmdSetPrimitiveTopology;
+  PFN_vkCmdSetRasterizerDiscardEnable vkCmdSetRasterizerDiscardEnable;
+  PFN_vkCmdSetScissorWithCount vkCmdSetScissorWithCount;
+  PFN_vkCmdSetStencilOp vkCmdSetStencilOp;
+  PFN_vkCmdSetStencilTestEnable vkCmdSetStencilTestEnable;
+  PFN_vkCmdSetViewportWithCount vkCmdSetViewportWithCount;
+#else
+  PFN_vkVoidFunction padding9[19];
+#endif /* defined(VK_GRAPHICS_VERSION_1_3) */
+#if defined(VK_BASE_VERSION_1_4)
+  PFN_vkCopyImageToImage vkCopyImageToImage;
+  PFN_vkCopyImageToMemory vkCopyImageToMemory;
+  PFN_vkCopyMemoryToImage vkCopyMemoryToImage;
+  PFN_vkGetDeviceImageSubresourceLayout vkGetDeviceImageSubresourceLayout;
+  PFN_vkGetImageSubresourceLayout2 vkGetImageSubresourceLayout2;
+  PFN_vkMapMemory2 vkMapMemory2;
+  PFN_vkTransitionImageLayout vkTransitionImageLayout;
+  PFN_vkUnmapMemory2 vkUnmapMemory2;
+#else
+  PFN_vkVoidFunction padding10[8];
+#endif /* defined(VK_BASE_VERSION_1_4) */
+#if defined(VK_COMPUTE_VERSION_1_4)
+  PFN_vkCmdBindDescriptorSets2 vkCmdBindDescriptorSets2;
+  PFN_vkCmdPushConstants2 vkCmdPushConstants2;
+  PFN_vkCmdPushDescriptorSet vkCmdPushDescriptorSet;
+  PFN_vkCmdPushDescriptorSet2 vkCmdPushDescriptorSet2;
+  PFN_vkCmdPushDescriptorSetWithTemplate vkCmdPushDescriptorSetWithTemplate;
+  PFN_vkCmdPushDescriptorSetWithTemplate2 vkCmdPushDescriptorSetWithTemplate2;
+#else
+  PFN_vkVoidFunction padding11[6];
+#endif /* defined(VK_COMPUTE_VERSION_1_4) */
+#if defined(VK_GRAPHICS_VERSION_1_4)
+  PFN_vkCmdBindIndexBuffer2 vkCmdBindIndexBuffer2;
+  PFN_vkCmdSetLineStipple vkCmdSetLineStipple;
+  PFN_vkCmdSetRenderingAttachmentLocations vkCmdSetRenderingAttachmentLocations;
+  PFN_vkCmdSetRenderingInputAttachmentIndices vkCmdSetRenderingInputAttachmentIndices;
+  PFN_vkGetRenderingAreaGranularity vkGetRenderingAreaGranularity;
+#else
+  PFN_vkVoidFunction padding12[5];
+#endif /* defined(VK_GRAPHICS_VERSION_1_4) */
+#if defined(VK_AMDX_shader_enqueue)
+  PFN_vkCmdDispatchGraphAMDX vkCmdDispatchGraphAMDX;
+  PFN_vkCmdDispatchGraphIndirectAMDX vkCmdDispatchGraphIndirectAMDX;
+  PFN_vkCmdDispatchGraphIndirectCountAMDX vkCmdDispatchGraphIndirectCountAMDX;
+  PFN_vkCmdInitializeGraphScratchMemoryAMDX vkCmdInitializeGraphScratchMemoryAMDX;
+  PFN_vkCreateExecutionGraphPipelinesAMDX vkCreateExecutionGraphPipelinesAMDX;
+  PFN_vkGetExecutionGraphPipelineNodeIndexAMDX vkGetExecutionGraphPipelineNodeIndexAMDX;
+  PFN_vkGetExecutionGraphPipelineScratchSizeAMDX vkGetExecutionGraphPipelineScratchSizeAMDX;
+#else
+  PFN_vkVoidFunction padding13[7];
+#endif /* defined(VK_AMDX_shader_enqueue) */
+#if defined(VK_AMD_anti_lag)
+  PFN_vkAntiLagUpdateAMD vkAntiLagUpdateAMD;
+#else
+  PFN_vkVoidFunction padding14;
+#endif /* defined(VK_AMD_anti_lag) */
+#if defined(VK_AMD_buffer_marker)
+  PFN_vkCmdWriteBufferMarkerAMD vkCmdWriteBufferMarkerAMD;
+#else
+  PFN_vkVoidFunction padding15;
+#endif /* defined(VK_AMD_buffer_marker) */
+#if defined(VK_AMD_buffer_marker) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2))
+  PFN_vkCmdWriteBufferMarker2AMD vkCmdWriteBufferMarker2AMD;
+#else
+  PFN_vkVoidFunction padding16;
+#endif /* defined(VK_AMD_buffer_marker) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2)) */
+#if defined(VK_AMD_display_native_hdr)
+  PFN_vkSetLocalDimmingAMD vkSetLocalDimmingAMD;
+#else
+  PFN_vkVoidFunction padding17;
+#endif /* defined(VK_AMD_display_native_hdr) */
+#if defined(VK_AMD_draw_indirect_count)
+  PFN_vkCmdDrawIndexedIndirectCountAMD vkCmdDrawIndexedIndirectCountAMD;
+  PFN_vkCmdDrawIndirectCountAMD vkCmdDrawIndirectCountAMD;
+#else
+  PFN_vkVoidFunction padding18[2];
+#endif /* defined(VK_AMD_draw_indirect_count) */
+#if defined(VK_AMD_shader_info)
+  PFN_vkGetShaderInfoAMD vkGetShaderInfoAMD;
+#else
+  PFN_vkVoidFunction padding19;
+#endif /* defined(VK_AMD_shader_info) */
+#if defined(VK_ANDROID_external_memory_android_hardware_buffer)
+  PFN_vkGetAndroidHardwareBufferPropertiesANDROID vkGetAndroidHardwareBufferPropertiesANDROID;
+  PFN_vkGetMemoryAndroidHardwareBufferANDROID vkGetMemoryAndroidHardwareBufferANDROID;
+#else
+  PFN_vkVoidFunction padding20[2];
+#endif /* defined(VK_ANDROID_external_memory_android_hardware_buffer) */
+#if defined(VK_ARM_data_graph)
+  PFN_vkBindDataGraphPipelineSessionMemoryARM vkBindDataGraphPipelineSessionMemoryARM;
+  PFN_vkCmdDispatchDataGraphARM vkCmdDispatchDataGraphARM;
+  PFN_vkCreateDataGraphPipelineSessionARM vkCreateDataGraphPipelineSessionARM;
+  PFN_vkCreateDataGraphPipelinesARM vkCreateDataGraphPipelinesARM;
+  PFN_vkDestroyDataGraphPipelineSessionARM vkDestroyDataGraphPipelineSessionARM;
+  PFN_vkGetDataGraphPipelineAvailablePropertiesARM vkGetDataGraphPipelineAvailablePropertiesARM;
+  PFN_vkGetDataGraphPipelinePropertiesARM vkGetDataGraphPipelinePropertiesARM;
+  PFN_vkGetDataGraphPipelineSessionBindPointRequirementsARM vkGetDataGraphPipelineSessionBindPointRequirementsARM;
+  PFN_vkGetDataGraphPipelineSessionMemoryRequirementsARM vkGetDataGraphPipelineSessionMemoryRequirementsARM;
+  PFN_vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM vkGetPhysicalDeviceQueueFamilyDataGraphProcessingEnginePropertiesARM;
+  PFN_vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM vkGetPhysicalDeviceQueueFamilyDataGraphPropertiesARM;
+#else
+  PFN_vkVoidFunction padding21[11];
+#endif /* defined(VK_ARM_data_graph) */
+#if defined(VK_ARM_performance_counters_by_region)
+  PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM vkEnumeratePhysicalDeviceQueueFamilyPerformanceCountersByRegionARM;
+#else
+  PFN_vkVoidFunction padding22;
+#endif /* defined(VK_ARM_performance_counters_by_region) */
+#if defined(VK_ARM_tensors)
+  PFN_vkBindTensorMemoryARM vkBindTensorMemoryARM;
+  PFN_vkCmdCopyTensorARM vkCmdCopyTensorARM;
+  PFN_vkCreateTensorARM vkCreateTensorARM;
+  PFN_vkCreateTensorViewARM vkCreateTensorViewARM;
+  PFN_vkDestroyTensorARM vkDestroyTensorARM;
+  PFN_vkDestroyTensorViewARM vkDestroyTensorViewARM;
+  PFN_vkGetDeviceTensorMemoryRequirementsARM vkGetDeviceTensorMemoryRequirementsARM;
+  PFN_vkGetPhysicalDeviceExternalTensorPropertiesARM vkGetPhysicalDeviceExternalTensorPropertiesARM;
+  PFN_vkGetTensorMemoryRequirementsARM vkGetTensorMemoryRequirementsARM;
+#else
+  PFN_vkVoidFunction padding23[9];
+#endif /* defined(VK_ARM_tensors) */
+#if defined(VK_ARM_tensors) && defined(VK_EXT_descriptor_buffer)
+  PFN_vkGetTensorOpaqueCaptureDescriptorDataARM vkGetTensorOpaqueCaptureDescriptorDataARM;
+  PFN_vkGetTensorViewOpaqueCaptureDescriptorDataARM vkGetTensorViewOpaqueCaptureDescriptorDataARM;
+#else
+  PFN_vkVoidFunction padding24[2];
+#endif /* defined(VK_ARM_tensors) && defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_EXT_acquire_drm_display)
+  PFN_vkAcquireDrmDisplayEXT vkAcquireDrmDisplayEXT;
+  PFN_vkGetDrmDisplayEXT vkGetDrmDisplayEXT;
+#else
+  PFN_vkVoidFunction padding25[2];
+#endif /* defined(VK_EXT_acquire_drm_display) */
+#if defined(VK_EXT_acquire_xlib_display)
+  PFN_vkAcquireXlibDisplayEXT vkAcquireXlibDisplayEXT;
+  PFN_vkGetRandROutputDisplayEXT vkGetRandROutputDisplayEXT;
+#else
+  PFN_vkVoidFunction padding26[2];
+#endif /* defined(VK_EXT_acquire_xlib_display) */
+#if defined(VK_EXT_attachment_feedback_loop_dynamic_state)
+  PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT vkCmdSetAttachmentFeedbackLoopEnableEXT;
+#else
+  PFN_vkVoidFunction padding27;
+#endif /* defined(VK_EXT_attachment_feedback_loop_dynamic_state) */
+#if defined(VK_EXT_buffer_device_address)
+  PFN_vkGetBufferDeviceAddressEXT vkGetBufferDeviceAddressEXT;
+#else
+  PFN_vkVoidFunction padding28;
+#endif /* defined(VK_EXT_buffer_device_address) */
+#if defined(VK_EXT_calibrated_timestamps)
+  PFN_vkGetCalibratedTimestampsEXT vkGetCalibratedTimestampsEXT;
+  PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+#else
+  PFN_vkVoidFunction padding29[2];
+#endif /* defined(VK_EXT_calibrated_timestamps) */
+#if defined(VK_EXT_color_write_enable)
+  PFN_vkCmdSetColorWriteEnableEXT vkCmdSetColorWriteEnableEXT;
+#else
+  PFN_vkVoidFunction padding30;
+#endif /* defined(VK_EXT_color_write_enable) */
+#if defined(VK_EXT_conditional_rendering)
+  PFN_vkCmdBeginConditionalRenderingEXT vkCmdBeginConditionalRenderingEXT;
+  PFN_vkCmdEndConditionalRenderingEXT vkCmdEndConditionalRenderingEXT;
+#else
+  PFN_vkVoidFunction padding31[2];
+#endif /* defined(VK_EXT_conditional_rendering) */
+#if defined(VK_EXT_custom_resolve) && (defined(VK_KHR_dynamic_rendering) || defined(VK_VERSION_1_3))
+  PFN_vkCmdBeginCustomResolveEXT vkCmdBeginCustomResolveEXT;
+#else
+  PFN_vkVoidFunction padding32;
+#endif /* defined(VK_EXT_custom_resolve) && (defined(VK_KHR_dynamic_rendering) || defined(VK_VERSION_1_3)) */
+#if defined(VK_EXT_debug_marker)
+  PFN_vkCmdDebugMarkerBeginEXT vkCmdDebugMarkerBeginEXT;
+  PFN_vkCmdDebugMarkerEndEXT vkCmdDebugMarkerEndEXT;
+  PFN_vkCmdDebugMarkerInsertEXT vkCmdDebugMarkerInsertEXT;
+  PFN_vkDebugMarkerSetObjectNameEXT vkDebugMarkerSetObjectNameEXT;
+  PFN_vkDebugMarkerSetObjectTagEXT vkDebugMarkerSetObjectTagEXT;
+#else
+  PFN_vkVoidFunction padding33[5];
+#endif /* defined(VK_EXT_debug_marker) */
+#if defined(VK_EXT_debug_report)
+  PFN_vkCreateDebugReportCallbackEXT vkCreateDebugReportCallbackEXT;
+  PFN_vkDebugReportMessageEXT vkDebugReportMessageEXT;
+  PFN_vkDestroyDebugReportCallbackEXT vkDestroyDebugReportCallbackEXT;
+#else
+  PFN_vkVoidFunction padding34[3];
+#endif /* defined(VK_EXT_debug_report) */
+#if defined(VK_EXT_debug_utils)
+  PFN_vkCmdBeginDebugUtilsLabelEXT vkCmdBeginDebugUtilsLabelEXT;
+  PFN_vkCmdEndDebugUtilsLabelEXT vkCmdEndDebugUtilsLabelEXT;
+  PFN_vkCmdInsertDebugUtilsLabelEXT vkCmdInsertDebugUtilsLabelEXT;
+  PFN_vkCreateDebugUtilsMessengerEXT vkCreateDebugUtilsMessengerEXT;
+  PFN_vkDestroyDebugUtilsMessengerEXT vkDestroyDebugUtilsMessengerEXT;
+  PFN_vkQueueBeginDebugUtilsLabelEXT vkQueueBeginDebugUtilsLabelEXT;
+  PFN_vkQueueEndDebugUtilsLabelEXT vkQueueEndDebugUtilsLabelEXT;
+  PFN_vkQueueInsertDebugUtilsLabelEXT vkQueueInsertDebugUtilsLabelEXT;
+  PFN_vkSetDebugUtilsObjectNameEXT vkSetDebugUtilsObjectNameEXT;
+  PFN_vkSetDebugUtilsObjectTagEXT vkSetDebugUtilsObjectTagEXT;
+  PFN_vkSubmitDebugUtilsMessageEXT vkSubmitDebugUtilsMessageEXT;
+#else
+  PFN_vkVoidFunction padding35[11];
+#endif /* defined(VK_EXT_debug_utils) */
+#if defined(VK_EXT_depth_bias_control)
+  PFN_vkCmdSetDepthBias2EXT vkCmdSetDepthBias2EXT;
+#else
+  PFN_vkVoidFunction padding36;
+#endif /* defined(VK_EXT_depth_bias_control) */
+#if defined(VK_EXT_descriptor_buffer)
+  PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT vkCmdBindDescriptorBufferEmbeddedSamplersEXT;
+  PFN_vkCmdBindDescriptorBuffersEXT vkCmdBindDescriptorBuffersEXT;
+  PFN_vkCmdSetDescriptorBufferOffsetsEXT vkCmdSetDescriptorBufferOffsetsEXT;
+  PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT vkGetBufferOpaqueCaptureDescriptorDataEXT;
+  PFN_vkGetDescriptorEXT vkGetDescriptorEXT;
+  PFN_vkGetDescriptorSetLayoutBindingOffsetEXT vkGetDescriptorSetLayoutBindingOffsetEXT;
+  PFN_vkGetDescriptorSetLayoutSizeEXT vkGetDescriptorSetLayoutSizeEXT;
+  PFN_vkGetImageOpaqueCaptureDescriptorDataEXT vkGetImageOpaqueCaptureDescriptorDataEXT;
+  PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT vkGetImageViewOpaqueCaptureDescriptorDataEXT;
+  PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT vkGetSamplerOpaqueCaptureDescriptorDataEXT;
+#else
+  PFN_vkVoidFunction padding37[10];
+#endif /* defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_EXT_descriptor_buffer) && (defined(VK_KHR_acceleration_structure) || defined(VK_NV_ray_tracing))
+  PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
+#else
+  PFN_vkVoidFunction padding38;
+#endif /* defined(VK_EXT_descriptor_buffer) && (defined(VK_KHR_acceleration_structure) || defined(VK_NV_ray_tracing)) */
+#if defined(VK_EXT_descriptor_heap)
+  PFN_vkCmdBindResourceHeapEXT vkCmdBindResourceHeapEXT;
+  PFN_vkCmdBindSamplerHeapEXT vkCmdBindSamplerHeapEXT;
+  PFN_vkCmdPushDataEXT vkCmdPushDataEXT;
+  PFN_vkGetImageOpaqueCaptureDataEXT vkGetImageOpaqueCaptureDataEXT;
+  PFN_vkGetPhysicalDeviceDescriptorSizeEXT vkGetPhysicalDeviceDescriptorSizeEXT;
+  PFN_vkWriteResourceDescriptorsEXT vkWriteResourceDescriptorsEXT;
+  PFN_vkWriteSamplerDescriptorsEXT vkWriteSamplerDescriptorsEXT;
+#else
+  PFN_vkVoidFunction padding39[7];
+#endif /* defined(VK_EXT_descriptor_heap) */
+#if defined(VK_EXT_descriptor_heap) && defined(VK_EXT_custom_border_color)
+  PFN_vkRegisterCustomBorderColorEXT vkRegisterCustomBorderColorEXT;
+  PFN_vkUnregisterCustomBorderColorEXT vkUnregisterCustomBorderColorEXT;
+#else
+  PFN_vkVoidFunction padding40[2];
+#endif /* defined(VK_EXT_descriptor_heap) && defined(VK_EXT_custom_border_color) */
+#if defined(VK_EXT_descriptor_heap) && defined(VK_ARM_tensors)
+  PFN_vkGetTensorOpaqueCaptureDataARM vkGetTensorOpaqueCaptureDataARM;
+#else
+  PFN_vkVoidFunction padding41;
+#endif /* defined(VK_EXT_descriptor_heap) && defined(VK_ARM_tensors) */
+#if defined(VK_EXT_device_fault)
+  PFN_vkGetDeviceFaultInfoEXT vkGetDeviceFaultInfoEXT;
+#else
+  PFN_vkVoidFunction padding42;
+#endif /* defined(VK_EXT_device_fault) */
+#if defined(VK_EXT_device_generated_commands)
+  PFN_vkCmdExecuteGeneratedCommandsEXT vkCmdExecuteGeneratedCommandsEXT;
+  PFN_vkCmdPreprocessGeneratedCommandsEXT vkCmdPreprocessGeneratedCommandsEXT;
+  PFN_vkCreateIndirectCommandsLayoutEXT vkCreateIndirectCommandsLayoutEXT;
+  PFN_vkCreateIndirectExecutionSetEXT vkCreateIndirectExecutionSetEXT;
+  PFN_vkDestroyIndirectCommandsLayoutEXT vkDestroyIndirectCommandsLayoutEXT;
+  PFN_vkDestroyIndirectExecutionSetEXT vkDestroyIndirectExecutionSetEXT;
+  PFN_vkGetGeneratedCommandsMemoryRequirementsEXT vkGetGeneratedCommandsMemoryRequirementsEXT;
+  PFN_vkUpdateIndirectExecutionSetPipelineEXT vkUpdateIndirectExecutionSetPipelineEXT;
+  PFN_vkUpdateIndirectExecutionSetShaderEXT vkUpdateIndirectExecutionSetShaderEXT;
+#else
+  PFN_vkVoidFunction padding43[9];
+#endif /* defined(VK_EXT_device_generated_commands) */
+#if defined(VK_EXT_direct_mode_display)
+  PFN_vkReleaseDisplayEXT vkReleaseDisplayEXT;
+#else
+  PFN_vkVoidFunction padding44;
+#endif /* defined(VK_EXT_direct_mode_display) */
+#if defined(VK_EXT_directfb_surface)
+  PFN_vkCreateDirectFBSurfaceEXT vkCreateDirectFBSurfaceEXT;
+  PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT vkGetPhysicalDeviceDirectFBPresentationSupportEXT;
+#else
+  PFN_vkVoidFunction padding45[2];
+#endif /* defined(VK_EXT_directfb_surface) */
+#if defined(VK_EXT_discard_rectangles)
+  PFN_vkCmdSetDiscardRectangleEXT vkCmdSetDiscardRectangleEXT;
+#else
+  PFN_vkVoidFunction padding46;
+#endif /* defined(VK_EXT_discard_rectangles) */
+#if defined(VK_EXT_discard_rectangles) && VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2
+  PFN_vkCmdSetDiscardRectangleEnableEXT vkCmdSetDiscardRectangleEnableEXT;
+  PFN_vkCmdSetDiscardRectangleModeEXT vkCmdSetDiscardRectangleModeEXT;
+#else
+  PFN_vkVoidFunction padding47[2];
+#endif /* defined(VK_EXT_discard_rectangles) && VK_EXT_DISCARD_RECTANGLES_SPEC_VERSION >= 2 */
+#if defined(VK_EXT_display_control)
+  PFN_vkDisplayPowerControlEXT vkDisplayPowerControlEXT;
+  PFN_vkGetSwapchainCounterEXT vkGetSwapchainCounterEXT;
+  PFN_vkRegisterDeviceEventEXT vkRegisterDeviceEventEXT;
+  PFN_vkRegisterDisplayEventEXT vkRegisterDisplayEventEXT;
+#else
+  PFN_vkVoidFunction padding48[4];
+#endif /* defined(VK_EXT_display_control) */
+#if defined(VK_EXT_display_surface_counter)
+  PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT vkGetPhysicalDeviceSurfaceCapabilities2EXT;
+#else
+  PFN_vkVoidFunction padding49;
+#endif /* defined(VK_EXT_display_surface_counter) */
+#if defined(VK_EXT_external_memory_host)
+  PFN_vkGetMemoryHostPointerPropertiesEXT vkGetMemoryHostPointerPropertiesEXT;
+#else
+  PFN_vkVoidFunction padding50;
+#endif /* defined(VK_EXT_external_memory_host) */
+#if defined(VK_EXT_external_memory_metal)
+  PFN_vkGetMemoryMetalHandleEXT vkGetMemoryMetalHandleEXT;
+  PFN_vkGetMemoryMetalHandlePropertiesEXT vkGetMemoryMetalHandlePropertiesEXT;
+#else
+  PFN_vkVoidFunction padding51[2];
+#endif /* defined(VK_EXT_external_memory_metal) */
+#if defined(VK_EXT_fragment_density_map_offset)
+  PFN_vkCmdEndRendering2EXT vkCmdEndRendering2EXT;
+#else
+  PFN_vkVoidFunction padding52;
+#endif /* defined(VK_EXT_fragment_density_map_offset) */
+#if defined(VK_EXT_full_screen_exclusive)
+  PFN_vkAcquireFullScreenExclusiveModeEXT vkAcquireFullScreenExclusiveModeEXT;
+  PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT vkGetPhysicalDeviceSurfacePresentModes2EXT;
+  PFN_vkReleaseFullScreenExclusiveModeEXT vkReleaseFullScreenExclusiveModeEXT;
+#else
+  PFN_vkVoidFunction padding53[3];
+#endif /* defined(VK_EXT_full_screen_exclusive) */
+#if defined(VK_EXT_full_screen_exclusive) && (defined(VK_KHR_device_group) || defined(VK_VERSION_1_1))
+  PFN_vkGetDeviceGroupSurfacePresentModes2EXT vkGetDeviceGroupSurfacePresentModes2EXT;
+#else
+  PFN_vkVoidFunction padding54;
+#endif /* defined(VK_EXT_full_screen_exclusive) && (defined(VK_KHR_device_group) || defined(VK_VERSION_1_1)) */
+#if defined(VK_EXT_hdr_metadata)
+  PFN_vkSetHdrMetadataEXT vkSetHdrMetadataEXT;
+#else
+  PFN_vkVoidFunction padding55;
+#endif /* defined(VK_EXT_hdr_metadata) */
+#if defined(VK_EXT_headless_surface)
+  PFN_vkCreateHeadlessSurfaceEXT vkCreateHeadlessSurfaceEXT;
+#else
+  PFN_vkVoidFunction padding56;
+#endif /* defined(VK_EXT_headless_surface) */
+#if defined(VK_EXT_host_image_copy)
+  PFN_vkCopyImageToImageEXT vkCopyImageToImageEXT;
+  PFN_vkCopyImageToMemoryEXT vkCopyImageToMemoryEXT;
+  PFN_vkCopyMemoryToImageEXT vkCopyMemoryToImageEXT;
+  PFN_vkTransitionImageLayoutEXT vkTransitionImageLayoutEXT;
+#else
+  PFN_vkVoidFunction padding57[4];
+#endif /* defined(VK_EXT_host_image_copy) */
+#if defined(VK_EXT_host_query_reset)
+  PFN_vkResetQueryPoolEXT vkResetQueryPoolEXT;
+#else
+  PFN_vkVoidFunction padding58;
+#endif /* defined(VK_EXT_host_query_reset) */
+#if defined(VK_EXT_image_drm_format_modifier)
+  PFN_vkGetImageDrmFormatModifierPropertiesEXT vkGetImageDrmFormatModifierPropertiesEXT;
+#else
+  PFN_vkVoidFunction padding59;
+#endif /* defined(VK_EXT_image_drm_format_modifier) */
+#if defined(VK_EXT_line_rasterization)
+  PFN_vkCmdSetLineStippleEXT vkCmdSetLineStippleEXT;
+#else
+  PFN_vkVoidFunction padding60;
+#endif /* defined(VK_EXT_line_rasterization) */
+#if defined(VK_EXT_memory_decompression)
+  PFN_vkCmdDecompressMemoryEXT vkCmdDecompressMemoryEXT;
+  PFN_vkCmdDecompressMemoryIndirectCountEXT vkCmdDecompressMemoryIndirectCountEXT;
+#else
+  PFN_vkVoidFunction padding61[2];
+#endif /* defined(VK_EXT_memory_decompression) */
+#if defined(VK_EXT_mesh_shader)
+  PFN_vkCmdDrawMeshTasksEXT vkCmdDrawMeshTasksEXT;
+  PFN_vkCmdDrawMeshTasksIndirectEXT vkCmdDrawMeshTasksIndirectEXT;
+#else
+  PFN_vkVoidFunction padding62[2];
+#endif /* defined(VK_EXT_mesh_shader) */
+#if defined(VK_EXT_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count))
+  PFN_vkCmdDrawMeshTasksIndirectCountEXT vkCmdDrawMeshTasksIndirectCountEXT;
+#else
+  PFN_vkVoidFunction padding63;
+#endif /* defined(VK_EXT_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count)) */
+#if defined(VK_EXT_metal_objects)
+  PFN_vkExportMetalObjectsEXT vkExportMetalObjectsEXT;
+#else
+  PFN_vkVoidFunction padding64;
+#endif /* defined(VK_EXT_metal_objects) */
+#if defined(VK_EXT_metal_surface)
+  PFN_vkCreateMetalSurfaceEXT vkCreateMetalSurfaceEXT;
+#else
+  PFN_vkVoidFunction padding65;
+#endif /* defined(VK_EXT_metal_surface) */
+#if defined(VK_EXT_multi_draw)
+  PFN_vkCmdDrawMultiEXT vkCmdDrawMultiEXT;
+  PFN_vkCmdDrawMultiIndexedEXT vkCmdDrawMultiIndexedEXT;
+#else
+  PFN_vkVoidFunction padding66[2];
+#endif /* defined(VK_EXT_multi_draw) */
+#if defined(VK_EXT_opacity_micromap)
+  PFN_vkBuildMicromapsEXT vkBuildMicromapsEXT;
+  PFN_vkCmdBuildMicromapsEXT vkCmdBuildMicromapsEXT;
+  PFN_vkCmdCopyMemoryToMicromapEXT vkCmdCopyMemoryToMicromapEXT;
+  PFN_vkCmdCopyMicromapEXT vkCmdCopyMicromapEXT;
+  PFN_vkCmdCopyMicromapToMemoryEXT vkCmdCopyMicromapToMemoryEXT;
+  PFN_vkCmdWriteMicromapsPropertiesEXT vkCmdWriteMicromapsPropertiesEXT;
+  PFN_vkCopyMemoryToMicromapEXT vkCopyMemoryToMicromapEXT;
+  PFN_vkCopyMicromapEXT vkCopyMicromapEXT;
+  PFN_vkCopyMicromapToMemoryEXT vkCopyMicromapToMemoryEXT;
+  PFN_vkCreateMicromapEXT vkCreateMicromapEXT;
+  PFN_vkDestroyMicromapEXT vkDestroyMicromapEXT;
+  PFN_vkGetDeviceMicromapCompatibilityEXT vkGetDeviceMicromapCompatibilityEXT;
+  PFN_vkGetMicromapBuildSizesEXT vkGetMicromapBuildSizesEXT;
+  PFN_vkWriteMicromapsPropertiesEXT vkWriteMicromapsPropertiesEXT;
+#else
+  PFN_vkVoidFunction padding67[14];
+#endif /* defined(VK_EXT_opacity_micromap) */
+#if defined(VK_EXT_pageable_device_local_memory)
+  PFN_vkSetDeviceMemoryPriorityEXT vkSetDeviceMemoryPriorityEXT;
+#else
+  PFN_vkVoidFunction padding68;
+#endif /* defined(VK_EXT_pageable_device_local_memory) */
+#if defined(VK_EXT_pipeline_properties)
+  PFN_vkGetPipelinePropertiesEXT vkGetPipelinePropertiesEXT;
+#else
+  PFN_vkVoidFunction padding69;
+#endif /* defined(VK_EXT_pipeline_properties) */
+#if defined(VK_EXT_present_timing)
+  PFN_vkGetPastPresentationTimingEXT vkGetPastPresentationTimingEXT;
+  PFN_vkGetSwapchainTimeDomainPropertiesEXT vkGetSwapchainTimeDomainPropertiesEXT;
+  PFN_vkGetSwapchainTimingPropertiesEXT vkGetSwapchainTimingPropertiesEXT;
+  PFN_vkSetSwapchainPresentTimingQueueSizeEXT vkSetSwapchainPresentTimingQueueSizeEXT;
+#else
+  PFN_vkVoidFunction padding70[4];
+#endif /* defined(VK_EXT_present_timing) */
+#if defined(VK_EXT_private_data)
+  PFN_vkCreatePrivateDataSlotEXT vkCreatePrivateDataSlotEXT;
+  PFN_vkDestroyPrivateDataSlotEXT vkDestroyPrivateDataSlotEXT;
+  PFN_vkGetPrivateDataEXT vkGetPrivateDataEXT;
+  PFN_vkSetPrivateDataEXT vkSetPrivateDataEXT;
+#else
+  PFN_vkVoidFunction padding71[4];
+#endif /* defined(VK_EXT_private_data) */
+#if defined(VK_EXT_sample_locations)
+  PFN_vkCmdSetSampleLocationsEXT vkCmdSetSampleLocationsEXT;
+  PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT vkGetPhysicalDeviceMultisamplePropertiesEXT;
+#else
+  PFN_vkVoidFunction padding72[2];
+#endif /* defined(VK_EXT_sample_locations) */
+#if defined(VK_EXT_shader_module_identifier)
+  PFN_vkGetShaderModuleCreateInfoIdentifierEXT vkGetShaderModuleCreateInfoIdentifierEXT;
+  PFN_vkGetShaderModuleIdentifierEXT vkGetShaderModuleIdentifierEXT;
+#else
+  PFN_vkVoidFunction padding73[2];
+#endif /* defined(VK_EXT_shader_module_identifier) */
+#if defined(VK_EXT_shader_object)
+  PFN_vkCmdBindShadersEXT vkCmdBindShadersEXT;
+  PFN_vkCreateShadersEXT vkCreateShadersEXT;
+  PFN_vkDestroyShaderEXT vkDestroyShaderEXT;
+  PFN_vkGetShaderBinaryDataEXT vkGetShaderBinaryDataEXT;
+#else
+  PFN_vkVoidFunction padding74[4];
+#endif /* defined(VK_EXT_shader_object) */
+#if defined(VK_EXT_swapchain_maintenance1)
+  PFN_vkReleaseSwapchainImagesEXT vkReleaseSwapchainImagesEXT;
+#else
+  PFN_vkVoidFunction padding75;
+#endif /* defined(VK_EXT_swapchain_maintenance1) */
+#if defined(VK_EXT_tooling_info)
+  PFN_vkGetPhysicalDeviceToolPropertiesEXT vkGetPhysicalDeviceToolPropertiesEXT;
+#else
+  PFN_vkVoidFunction padding76;
+#endif /* defined(VK_EXT_tooling_info) */
+#if defined(VK_EXT_transform_feedback)
+  PFN_vkCmdBeginQueryIndexedEXT vkCmdBeginQueryIndexedEXT;
+  PFN_vkCmdBeginTransformFeedbackEXT vkCmdBeginTransformFeedbackEXT;
+  PFN_vkCmdBindTransformFeedbackBuffersEXT vkCmdBindTransformFeedbackBuffersEXT;
+  PFN_vkCmdDrawIndirectByteCountEXT vkCmdDrawIndirectByteCountEXT;
+  PFN_vkCmdEndQueryIndexedEXT vkCmdEndQueryIndexedEXT;
+  PFN_vkCmdEndTransformFeedbackEXT vkCmdEndTransformFeedbackEXT;
+#else
+  PFN_vkVoidFunction padding77[6];
+#endif /* defined(VK_EXT_transform_feedback) */
+#if defined(VK_EXT_validation_cache)
+  PFN_vkCreateValidationCacheEXT vkCreateValidationCacheEXT;
+  PFN_vkDestroyValidationCacheEXT vkDestroyValidationCacheEXT;
+  PFN_vkGetValidationCacheDataEXT vkGetValidationCacheDataEXT;
+  PFN_vkMergeValidationCachesEXT vkMergeValidationCachesEXT;
+#else
+  PFN_vkVoidFunction padding78[4];
+#endif /* defined(VK_EXT_validation_cache) */
+#if defined(VK_FUCHSIA_buffer_collection)
+  PFN_vkCreateBufferCollectionFUCHSIA vkCreateBufferCollectionFUCHSIA;
+  PFN_vkDestroyBufferCollectionFUCHSIA vkDestroyBufferCollectionFUCHSIA;
+  PFN_vkGetBufferCollectionPropertiesFUCHSIA vkGetBufferCollectionPropertiesFUCHSIA;
+  PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA vkSetBufferCollectionBufferConstraintsFUCHSIA;
+  PFN_vkSetBufferCollectionImageConstraintsFUCHSIA vkSetBufferCollectionImageConstraintsFUCHSIA;
+#else
+  PFN_vkVoidFunction padding79[5];
+#endif /* defined(VK_FUCHSIA_buffer_collection) */
+#if defined(VK_FUCHSIA_external_memory)
+  PFN_vkGetMemoryZirconHandleFUCHSIA vkGetMemoryZirconHandleFUCHSIA;
+  PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA vkGetMemoryZirconHandlePropertiesFUCHSIA;
+#else
+  PFN_vkVoidFunction padding80[2];
+#endif /* defined(VK_FUCHSIA_external_memory) */
+#if defined(VK_FUCHSIA_external_semaphore)
+  PFN_vkGetSemaphoreZirconHandleFUCHSIA vkGetSemaphoreZirconHandleFUCHSIA;
+  PFN_vkImportSemaphoreZirconHandleFUCHSIA vkImportSemaphoreZirconHandleFUCHSIA;
+#else
+  PFN_vkVoidFunction padding81[2];
+#endif /* defined(VK_FUCHSIA_external_semaphore) */
+#if defined(VK_FUCHSIA_imagepipe_surface)
+  PFN_vkCreateImagePipeSurfaceFUCHSIA vkCreateImagePipeSurfaceFUCHSIA;
+#else
+  PFN_vkVoidFunction padding82;
+#endif /* defined(VK_FUCHSIA_imagepipe_surface) */
+#if defined(VK_GGP_stream_descriptor_surface)
+  PFN_vkCreateStreamDescriptorSurfaceGGP vkCreateStreamDescriptorSurfaceGGP;
+#else
+  PFN_vkVoidFunction padding83;
+#endif /* defined(VK_GGP_stream_descriptor_surface) */
+#if defined(VK_GOOGLE_display_timing)
+  PFN_vkGetPastPresentationTimingGOOGLE vkGetPastPresentationTimingGOOGLE;
+  PFN_vkGetRefreshCycleDurationGOOGLE vkGetRefreshCycleDurationGOOGLE;
+#else
+  PFN_vkVoidFunction padding84[2];
+#endif /* defined(VK_GOOGLE_display_timing) */
+#if defined(VK_HUAWEI_cluster_culling_shader)
+  PFN_vkCmdDrawClusterHUAWEI vkCmdDrawClusterHUAWEI;
+  PFN_vkCmdDrawClusterIndirectHUAWEI vkCmdDrawClusterIndirectHUAWEI;
+#else
+  PFN_vkVoidFunction padding85[2];
+#endif /* defined(VK_HUAWEI_cluster_culling_shader) */
+#if defined(VK_HUAWEI_invocation_mask)
+  PFN_vkCmdBindInvocationMaskHUAWEI vkCmdBindInvocationMaskHUAWEI;
+#else
+  PFN_vkVoidFunction padding86;
+#endif /* defined(VK_HUAWEI_invocation_mask) */
+#if defined(VK_HUAWEI_subpass_shading)
+  PFN_vkCmdSubpassShadingHUAWEI vkCmdSubpassShadingHUAWEI;
+  PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+#else
+  PFN_vkVoidFunction padding87[2];
+#endif /* defined(VK_HUAWEI_subpass_shading) */
+#if defined(VK_INTEL_performance_query)
+  PFN_vkAcquirePerformanceConfigurationINTEL vkAcquirePerformanceConfigurationINTEL;
+  PFN_vkCmdSetPerformanceMarkerINTEL vkCmdSetPerformanceMarkerINTEL;
+  PFN_vkCmdSetPerformanceOverrideINTEL vkCmdSetPerformanceOverrideINTEL;
+  PFN_vkCmdSetPerformanceStreamMarkerINTEL vkCmdSetPerformanceStreamMarkerINTEL;
+  PFN_vkGetPerformanceParameterINTEL vkGetPerformanceParameterINTEL;
+  PFN_vkInitializePerformanceApiINTEL vkInitializePerformanceApiINTEL;
+  PFN_vkQueueSetPerformanceConfigurationINTEL vkQueueSetPerformanceConfigurationINTEL;
+  PFN_vkReleasePerformanceConfigurationINTEL vkReleasePerformanceConfigurationINTEL;
+  PFN_vkUninitializePerformanceApiINTEL vkUninitializePerformanceApiINTEL;
+#else
+  PFN_vkVoidFunction padding88[9];
+#endif /* defined(VK_INTEL_performance_query) */
+#if defined(VK_KHR_acceleration_structure)
+  PFN_vkBuildAccelerationStructuresKHR vkBuildAccelerationStructuresKHR;
+  PFN_vkCmdBuildAccelerationStructuresIndirectKHR vkCmdBuildAccelerationStructuresIndirectKHR;
+  PFN_vkCmdBuildAccelerationStructuresKHR vkCmdBuildAccelerationStructuresKHR;
+  PFN_vkCmdCopyAccelerationStructureKHR vkCmdCopyAccelerationStructureKHR;
+  PFN_vkCmdCopyAccelerationStructureToMemoryKHR vkCmdCopyAccelerationStructureToMemoryKHR;
+  PFN_vkCmdCopyMemoryToAccelerationStructureKHR vkCmdCopyMemoryToAccelerationStructureKHR;
+  PFN_vkCmdWriteAccelerationStructuresPropertiesKHR vkCmdWriteAccelerationStructuresPropertiesKHR;
+  PFN_vkCopyAccelerationStructureKHR vkCopyAccelerationStructureKHR;
+  PFN_vkCopyAccelerationStructureToMemoryKHR vkCopyAccelerationStructureToMemoryKHR;
+  PFN_vkCopyMemoryToAccelerationStructureKHR vkCopyMemoryToAccelerationStructureKHR;
+  PFN_vkCreateAccelerationStructureKHR vkCreateAccelerationStructureKHR;
+  PFN_vkDestroyAccelerationStructureKHR vkDestroyAccelerationStructureKHR;
+  PFN_vkGetAccelerationStructureBuildSizesKHR vkGetAccelerationStructureBuildSizesKHR;
+  PFN_vkGetAccelerationStructureDeviceAddressKHR vkGetAccelerationStructureDeviceAddressKHR;
+  PFN_vkGetDeviceAccelerationStructureCompatibilityKHR vkGetDeviceAccelerationStructureCompatibilityKHR;
+  PFN_vkWriteAccelerationStructuresPropertiesKHR vkWriteAccelerationStructuresPropertiesKHR;
+#else
+  PFN_vkVoidFunction padding89[16];
+#endif /* defined(VK_KHR_acceleration_structure) */
+#if defined(VK_KHR_android_surface)
+  PFN_vkCreateAndroidSurfaceKHR vkCreateAndroidSurfaceKHR;
+#else
+  PFN_vkVoidFunction padding90;
+#endif /* defined(VK_KHR_android_surface) */
+#if defined(VK_KHR_bind_memory2)
+  PFN_vkBindBufferMemory2KHR vkBindBufferMemory2KHR;
+  PFN_vkBindImageMemory2KHR vkBindImageMemory2KHR;
+#else
+  PFN_vkVoidFunction padding91[2];
+#endif /* defined(VK_KHR_bind_memory2) */
+#if defined(VK_KHR_buffer_device_address)
+  PFN_vkGetBufferDeviceAddressKHR vkGetBufferDeviceAddressKHR;
+  PFN_vkGetBufferOpaqueCaptureAddressKHR vkGetBufferOpaqueCaptureAddressKHR;
+  PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR vkGetDeviceMemoryOpaqueCaptureAddressKHR;
+#else
+  PFN_vkVoidFunction padding92[3];
+#endif /* defined(VK_KHR_buffer_device_address) */
+#if defined(VK_KHR_calibrated_timestamps)
+  PFN_vkGetCalibratedTimestampsKHR vkGetCalibratedTimestampsKHR;
+  PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsKHR vkGetPhysicalDeviceCalibrateableTimeDomainsKHR;
+#else
+  PFN_vkVoidFunction padding93[2];
+#endif /* defined(VK_KHR_calibrated_timestamps) */
+#if defined(VK_KHR_cooperative_matrix)
+  PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR;
+#else
+  PFN_vkVoidFunction padding94;
+#endif /* defined(VK_KHR_cooperative_matrix) */
+#if defined(VK_KHR_copy_commands2)
+  PFN_vkCmdBlitImage2KHR vkCmdBlitImage2KHR;
+  PFN_vkCmdCopyBuffer2KHR vkCmdCopyBuffer2KHR;
+  PFN_vkCmdCopyBufferToImage2KHR vkCmdCopyBufferToImage2KHR;
+  PFN_vkCmdCopyImage2KHR vkCmdCopyImage2KHR;
+  PFN_vkCmdCopyImageToBuffer2KHR vkCmdCopyImageToBuffer2KHR;
+  PFN_vkCmdResolveImage2KHR vkCmdResolveImage2KHR;
+#else
+  PFN_vkVoidFunction padding95[6];
+#endif /* defined(VK_KHR_copy_commands2) */
+#if defined(VK_KHR_copy_memory_indirect)
+  PFN_vkCmdCopyMemoryIndirectKHR vkCmdCopyMemoryIndirectKHR;
+  PFN_vkCmdCopyMemoryToImageIndirectKHR vkCmdCopyMemoryToImageIndirectKHR;
+#else
+  PFN_vkVoidFunction padding96[2];
+#endif /* defined(VK_KHR_copy_memory_indirect) */
+#if defined(VK_KHR_create_renderpass2)
+  PFN_vkCmdBeginRenderPass2KHR vkCmdBeginRenderPass2KHR;
+  PFN_vkCmdEndRenderPass2KHR vkCmdEndRenderPass2KHR;
+  PFN_vkCmdNextSubpass2KHR vkCmdNextSubpass2KHR;
+  PFN_vkCreateRenderPass2KHR vkCreateRenderPass2KHR;
+#else
+  PFN_vkVoidFunction padding97[4];
+#endif /* defined(VK_KHR_create_renderpass2) */
+#if defined(VK_KHR_deferred_host_operations)
+  PFN_vkCreateDeferredOperationKHR vkCreateDeferredOperationKHR;
+  PFN_vkDeferredOperationJoinKHR vkDeferredOperationJoinKHR;
+  PFN_vkDestroyDeferredOperationKHR vkDestroyDeferredOperationKHR;
+  PFN_vkGetDeferredOperationMaxConcurrencyKHR vkGetDeferredOperationMaxConcurrencyKHR;
+  PFN_vkGetDeferredOperationResultKHR vkGetDeferredOperationResultKHR;
+#else
+  PFN_vkVoidFunction padding98[5];
+#endif /* defined(VK_KHR_deferred_host_operations) */
+#if defined(VK_KHR_descriptor_update_template)
+  PFN_vkCreateDescriptorUpdateTemplateKHR vkCreateDescriptorUpdateTemplateKHR;
+  PFN_vkDestroyDescriptorUpdateTemplateKHR vkDestroyDescriptorUpdateTemplateKHR;
+  PFN_vkUpdateDescriptorSetWithTemplateKHR vkUpdateDescriptorSetWithTemplateKHR;
+#else
+  PFN_vkVoidFunction padding99[3];
+#endif /* defined(VK_KHR_descriptor_update_template) */
+#if defined(VK_KHR_device_group)
+  PFN_vkCmdDispatchBaseKHR vkCmdDispatchBaseKHR;
+  PFN_vkCmdSetDeviceMaskKHR vkCmdSetDeviceMaskKHR;
+  PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR vkGetDeviceGroupPeerMemoryFeaturesKHR;
+#else
+  PFN_vkVoidFunction padding100[3];
+#endif /* defined(VK_KHR_device_group) */
+#if defined(VK_KHR_device_group_creation)
+  PFN_vkEnumeratePhysicalDeviceGroupsKHR vkEnumeratePhysicalDeviceGroupsKHR;
+#else
+  PFN_vkVoidFunction padding101;
+#endif /* defined(VK_KHR_device_group_creation) */
+#if defined(VK_KHR_display)
+  PFN_vkCreateDisplayModeKHR vkCreateDisplayModeKHR;
+  PFN_vkCreateDisplayPlaneSurfaceKHR vkCreateDisplayPlaneSurfaceKHR;
+  PFN_vkGetDisplayModePropertiesKHR vkGetDisplayModePropertiesKHR;
+  PFN_vkGetDisplayPlaneCapabilitiesKHR vkGetDisplayPlaneCapabilitiesKHR;
+  PFN_vkGetDisplayPlaneSupportedDisplaysKHR vkGetDisplayPlaneSupportedDisplaysKHR;
+  PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR vkGetPhysicalDeviceDisplayPlanePropertiesKHR;
+  PFN_vkGetPhysicalDeviceDisplayPropertiesKHR vkGetPhysicalDeviceDisplayPropertiesKHR;
+#else
+  PFN_vkVoidFunction padding102[7];
+#endif /* defined(VK_KHR_display) */
+#if defined(VK_KHR_display_swapchain)
+  PFN_vkCreateSharedSwapchainsKHR vkCreateSharedSwapchainsKHR;
+#else
+  PFN_vkVoidFunction padding103;
+#endif /* defined(VK_KHR_display_swapchain) */
+#if defined(VK_KHR_draw_indirect_count)
+  PFN_vkCmdDrawIndexedIndirectCountKHR vkCmdDrawIndexedIndirectCountKHR;
+  PFN_vkCmdDrawIndirectCountKHR vkCmdDrawIndirectCountKHR;
+#else
+  PFN_vkVoidFunction padding104[2];
+#endif /* defined(VK_KHR_draw_indirect_count) */
+#if defined(VK_KHR_dynamic_rendering)
+  PFN_vkCmdBeginRenderingKHR vkCmdBeginRenderingKHR;
+  PFN_vkCmdEndRenderingKHR vkCmdEndRenderingKHR;
+#else
+  PFN_vkVoidFunction padding105[2];
+#endif /* defined(VK_KHR_dynamic_rendering) */
+#if defined(VK_KHR_dynamic_rendering_local_read)
+  PFN_vkCmdSetRenderingAttachmentLocationsKHR vkCmdSetRenderingAttachmentLocationsKHR;
+  PFN_vkCmdSetRenderingInputAttachmentIndicesKHR vkCmdSetRenderingInputAttachmentIndicesKHR;
+#else
+  PFN_vkVoidFunction padding106[2];
+#endif /* defined(VK_KHR_dynamic_rendering_local_read) */
+#if defined(VK_KHR_external_fence_capabilities)
+  PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR vkGetPhysicalDeviceExternalFencePropertiesKHR;
+#else
+  PFN_vkVoidFunction padding107;
+#endif /* defined(VK_KHR_external_fence_capabilities) */
+#if defined(VK_KHR_external_fence_fd)
+  PFN_vkGetFenceFdKHR vkGetFenceFdKHR;
+  PFN_vkImportFenceFdKHR vkImportFenceFdKHR;
+#else
+  PFN_vkVoidFunction padding108[2];
+#endif /* defined(VK_KHR_external_fence_fd) */
+#if defined(VK_KHR_external_fence_win32)
+  PFN_vkGetFenceWin32HandleKHR vkGetFenceWin32HandleKHR;
+  PFN_vkImportFenceWin32HandleKHR vkImportFenceWin32HandleKHR;
+#else
+  PFN_vkVoidFunction padding109[2];
+#endif /* defined(VK_KHR_external_fence_win32) */
+#if defined(VK_KHR_external_memory_capabilities)
+  PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR vkGetPhysicalDeviceExternalBufferPropertiesKHR;
+#else
+  PFN_vkVoidFunction padding110;
+#endif /* defined(VK_KHR_external_memory_capabilities) */
+#if defined(VK_KHR_external_memory_fd)
+  PFN_vkGetMemoryFdKHR vkGetMemoryFdKHR;
+  PFN_vkGetMemoryFdPropertiesKHR vkGetMemoryFdPropertiesKHR;
+#else
+  PFN_vkVoidFunction padding111[2];
+#endif /* defined(VK_KHR_external_memory_fd) */
+#if defined(VK_KHR_external_memory_win32)
+  PFN_vkGetMemoryWin32HandleKHR vkGetMemoryWin32HandleKHR;
+  PFN_vkGetMemoryWin32HandlePropertiesKHR vkGetMemoryWin32HandlePropertiesKHR;
+#else
+  PFN_vkVoidFunction padding112[2];
+#endif /* defined(VK_KHR_external_memory_win32) */
+#if defined(VK_KHR_external_semaphore_capabilities)
+  PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR vkGetPhysicalDeviceExternalSemaphorePropertiesKHR;
+#else
+  PFN_vkVoidFunction padding113;
+#endif /* defined(VK_KHR_external_semaphore_capabilities) */
+#if defined(VK_KHR_external_semaphore_fd)
+  PFN_vkGetSemaphoreFdKHR vkGetSemaphoreFdKHR;
+  PFN_vkImportSemaphoreFdKHR vkImportSemaphoreFdKHR;
+#else
+  PFN_vkVoidFunction padding114[2];
+#endif /* defined(VK_KHR_external_semaphore_fd) */
+#if defined(VK_KHR_external_semaphore_win32)
+  PFN_vkGetSemaphoreWin32HandleKHR vkGetSemaphoreWin32HandleKHR;
+  PFN_vkImportSemaphoreWin32HandleKHR vkImportSemaphoreWin32HandleKHR;
+#else
+  PFN_vkVoidFunction padding115[2];
+#endif /* defined(VK_KHR_external_semaphore_win32) */
+#if defined(VK_KHR_fragment_shading_rate)
+  PFN_vkCmdSetFragmentShadingRateKHR vkCmdSetFragmentShadingRateKHR;
+  PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR vkGetPhysicalDeviceFragmentShadingRatesKHR;
+#else
+  PFN_vkVoidFunction padding116[2];
+#endif /* defined(VK_KHR_fragment_shading_rate) */
+#if defined(VK_KHR_get_display_properties2)
+  PFN_vkGetDisplayModeProperties2KHR vkGetDisplayModeProperties2KHR;
+  PFN_vkGetDisplayPlaneCapabilities2KHR vkGetDisplayPlaneCapabilities2KHR;
+  PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR vkGetPhysicalDeviceDisplayPlaneProperties2KHR;
+  PFN_vkGetPhysicalDeviceDisplayProperties2KHR vkGetPhysicalDeviceDisplayProperties2KHR;
+#else
+  PFN_vkVoidFunction padding117[4];
+#endif /* defined(VK_KHR_get_display_properties2) */
+#if defined(VK_KHR_get_memory_requirements2)
+  PFN_vkGetBufferMemoryRequirements2KHR vkGetBufferMemoryRequirements2KHR;
+  PFN_vkGetImageMemoryRequirements2KHR vkGetImageMemoryRequirements2KHR;
+  PFN_vkGetImageSparseMemoryRequirements2KHR vkGetImageSparseMemoryRequirements2KHR;
+#else
+  PFN_vkVoidFunction padding118[3];
+#endif /* defined(VK_KHR_get_memory_requirements2) */
+#if defined(VK_KHR_get_physical_device_properties2)
+  PFN_vkGetPhysicalDeviceFeatures2KHR vkGetPhysicalDeviceFeatures2KHR;
+  PFN_vkGetPhysicalDeviceFormatProperties2KHR vkGetPhysicalDeviceFormatProperties2KHR;
+  PFN_vkGetPhysicalDeviceImageFormatProperties2KHR vkGetPhysicalDeviceImageFormatProperties2KHR;
+  PFN_vkGetPhysicalDeviceMemoryProperties2KHR vkGetPhysicalDeviceMemoryProperties2KHR;
+  PFN_vkGetPhysicalDeviceProperties2KHR vkGetPhysicalDeviceProperties2KHR;
+  PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR vkGetPhysicalDeviceQueueFamilyProperties2KHR;
+  PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR vkGetPhysicalDeviceSparseImageFormatProperties2KHR;
+#else
+  PFN_vkVoidFunction padding119[7];
+#endif /* defined(VK_KHR_get_physical_device_properties2) */
+#if defined(VK_KHR_get_surface_capabilities2)
+  PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR vkGetPhysicalDeviceSurfaceCapabilities2KHR;
+  PFN_vkGetPhysicalDeviceSurfaceFormats2KHR vkGetPhysicalDeviceSurfaceFormats2KHR;
+#else
+  PFN_vkVoidFunction padding120[2];
+#endif /* defined(VK_KHR_get_surface_capabilities2) */
+#if defined(VK_KHR_line_rasterization)
+  PFN_vkCmdSetLineStippleKHR vkCmdSetLineStippleKHR;
+#else
+  PFN_vkVoidFunction padding121;
+#endif /* defined(VK_KHR_line_rasterization) */
+#if defined(VK_KHR_maintenance1)
+  PFN_vkTrimCommandPoolKHR vkTrimCommandPoolKHR;
+#else
+  PFN_vkVoidFunction padding122;
+#endif /* defined(VK_KHR_maintenance1) */
+#if defined(VK_KHR_maintenance10)
+  PFN_vkCmdEndRendering2KHR vkCmdEndRendering2KHR;
+#else
+  PFN_vkVoidFunction padding123;
+#endif /* defined(VK_KHR_maintenance10) */
+#if defined(VK_KHR_maintenance3)
+  PFN_vkGetDescriptorSetLayoutSupportKHR vkGetDescriptorSetLayoutSupportKHR;
+#else
+  PFN_vkVoidFunction padding124;
+#endif /* defined(VK_KHR_maintenance3) */
+#if defined(VK_KHR_maintenance4)
+  PFN_vkGetDeviceBufferMemoryRequirementsKHR vkGetDeviceBufferMemoryRequirementsKHR;
+  PFN_vkGetDeviceImageMemoryRequirementsKHR vkGetDeviceImageMemoryRequirementsKHR;
+  PFN_vkGetDeviceImageSparseMemoryRequirementsKHR vkGetDeviceImageSparseMemoryRequirementsKHR;
+#else
+  PFN_vkVoidFunction padding125[3];
+#endif /* defined(VK_KHR_maintenance4) */
+#if defined(VK_KHR_maintenance5)
+  PFN_vkCmdBindIndexBuffer2KHR vkCmdBindIndexBuffer2KHR;
+  PFN_vkGetDeviceImageSubresourceLayoutKHR vkGetDeviceImageSubresourceLayoutKHR;
+  PFN_vkGetImageSubresourceLayout2KHR vkGetImageSubresourceLayout2KHR;
+  PFN_vkGetRenderingAreaGranularityKHR vkGetRenderingAreaGranularityKHR;
+#else
+  PFN_vkVoidFunction padding126[4];
+#endif /* defined(VK_KHR_maintenance5) */
+#if defined(VK_KHR_maintenance6)
+  PFN_vkCmdBindDescriptorSets2KHR vkCmdBindDescriptorSets2KHR;
+  PFN_vkCmdPushConstants2KHR vkCmdPushConstants2KHR;
+#else
+  PFN_vkVoidFunction padding127[2];
+#endif /* defined(VK_KHR_maintenance6) */
+#if defined(VK_KHR_maintenance6) && defined(VK_KHR_push_descriptor)
+  PFN_vkCmdPushDescriptorSet2KHR vkCmdPushDescriptorSet2KHR;
+  PFN_vkCmdPushDescriptorSetWithTemplate2KHR vkCmdPushDescriptorSetWithTemplate2KHR;
+#else
+  PFN_vkVoidFunction padding128[2];
+#endif /* defined(VK_KHR_maintenance6) && defined(VK_KHR_push_descriptor) */
+#if defined(VK_KHR_maintenance6) && defined(VK_EXT_descriptor_buffer)
+  PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT vkCmdBindDescriptorBufferEmbeddedSamplers2EXT;
+  PFN_vkCmdSetDescriptorBufferOffsets2EXT vkCmdSetDescriptorBufferOffsets2EXT;
+#else
+  PFN_vkVoidFunction padding129[2];
+#endif /* defined(VK_KHR_maintenance6) && defined(VK_EXT_descriptor_buffer) */
+#if defined(VK_KHR_map_memory2)
+  PFN_vkMapMemory2KHR vkMapMemory2KHR;
+  PFN_vkUnmapMemory2KHR vkUnmapMemory2KHR;
+#else
+  PFN_vkVoidFunction padding130[2];
+#endif /* defined(VK_KHR_map_memory2) */
+#if defined(VK_KHR_performance_query)
+  PFN_vkAcquireProfilingLockKHR vkAcquireProfilingLockKHR;
+  PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+  PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+  PFN_vkReleaseProfilingLockKHR vkReleaseProfilingLockKHR;
+#else
+  PFN_vkVoidFunction padding131[4];
+#endif /* defined(VK_KHR_performance_query) */
+#if defined(VK_KHR_pipeline_binary)
+  PFN_vkCreatePipelineBinariesKHR vkCreatePipelineBinariesKHR;
+  PFN_vkDestroyPipelineBinaryKHR vkDestroyPipelineBinaryKHR;
+  PFN_vkGetPipelineBinaryDataKHR vkGetPipelineBinaryDataKHR;
+  PFN_vkGetPipelineKeyKHR vkGetPipelineKeyKHR;
+  PFN_vkReleaseCapturedPipelineDataKHR vkReleaseCapturedPipelineDataKHR;
+#else
+  PFN_vkVoidFunction padding132[5];
+#endif /* defined(VK_KHR_pipeline_binary) */
+#if defined(VK_KHR_pipeline_executable_properties)
+  PFN_vkGetPipelineExecutableInternalRepresentationsKHR vkGetPipelineExecutableInternalRepresentationsKHR;
+  PFN_vkGetPipelineExecutablePropertiesKHR vkGetPipelineExecutablePropertiesKHR;
+  PFN_vkGetPipelineExecutableStatisticsKHR vkGetPipelineExecutableStatisticsKHR;
+#else
+  PFN_vkVoidFunction padding133[3];
+#endif /* defined(VK_KHR_pipeline_executable_properties) */
+#if defined(VK_KHR_present_wait)
+  PFN_vkWaitForPresentKHR vkWaitForPresentKHR;
+#else
+  PFN_vkVoidFunction padding134;
+#endif /* defined(VK_KHR_present_wait) */
+#if defined(VK_KHR_present_wait2)
+  PFN_vkWaitForPresent2KHR vkWaitForPresent2KHR;
+#else
+  PFN_vkVoidFunction padding135;
+#endif /* defined(VK_KHR_present_wait2) */
+#if defined(VK_KHR_push_descriptor)
+  PFN_vkCmdPushDescriptorSetKHR vkCmdPushDescriptorSetKHR;
+#else
+  PFN_vkVoidFunction padding136;
+#endif /* defined(VK_KHR_push_descriptor) */
+#if defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline)
+  PFN_vkCmdTraceRaysIndirect2KHR vkCmdTraceRaysIndirect2KHR;
+#else
+  PFN_vkVoidFunction padding137;
+#endif /* defined(VK_KHR_ray_tracing_maintenance1) && defined(VK_KHR_ray_tracing_pipeline) */
+#if defined(VK_KHR_ray_tracing_pipeline)
+  PFN_vkCmdSetRayTracingPipelineStackSizeKHR vkCmdSetRayTracingPipelineStackSizeKHR;
+  PFN_vkCmdTraceRaysIndirectKHR vkCmdTraceRaysIndirectKHR;
+  PFN_vkCmdTraceRaysKHR vkCmdTraceRaysKHR;
+  PFN_vkCreateRayTracingPipelinesKHR vkCreateRayTracingPipelinesKHR;
+  PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR vkGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+  PFN_vkGetRayTracingShaderGroupHandlesKHR vkGetRayTracingShaderGroupHandlesKHR;
+  PFN_vkGetRayTracingShaderGroupStackSizeKHR vkGetRayTracingShaderGroupStackSizeKHR;
+#else
+  PFN_vkVoidFunction padding138[7];
+#endif /* defined(VK_KHR_ray_tracing_pipeline) */
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+  PFN_vkCreateSamplerYcbcrConversionKHR vkCreateSamplerYcbcrConversionKHR;
+  PFN_vkDestroySamplerYcbcrConversionKHR vkDestroySamplerYcbcrConversionKHR;
+#else
+  PFN_vkVoidFunction padding139[2];
+#endif /* defined(VK_KHR_sampler_ycbcr_conversion) */
+#if defined(VK_KHR_shared_presentable_image)
+  PFN_vkGetSwapchainStatusKHR vkGetSwapchainStatusKHR;
+#else
+  PFN_vkVoidFunction padding140;
+#endif /* defined(VK_KHR_shared_presentable_image) */
+#if defined(VK_KHR_surface)
+  PFN_vkDestroySurfaceKHR vkDestroySurfaceKHR;
+  PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR vkGetPhysicalDeviceSurfaceCapabilitiesKHR;
+  PFN_vkGetPhysicalDeviceSurfaceFormatsKHR vkGetPhysicalDeviceSurfaceFormatsKHR;
+  PFN_vkGetPhysicalDeviceSurfacePresentModesKHR vkGetPhysicalDeviceSurfacePresentModesKHR;
+  PFN_vkGetPhysicalDeviceSurfaceSupportKHR vkGetPhysicalDeviceSurfaceSupportKHR;
+#else
+  PFN_vkVoidFunction padding141[5];
+#endif /* defined(VK_KHR_surface) */
+#if defined(VK_KHR_swapchain)
+  PFN_vkAcquireNextImageKHR vkAcquireNextImageKHR;
+  PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR;
+  PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR;
+  PFN_vkGetSwapchainImagesKHR vkGetSwapchainImagesKHR;
+  PFN_vkQueuePresentKHR vkQueuePresentKHR;
+#else
+  PFN_vkVoidFunction padding142[5];
+#endif /* defined(VK_KHR_swapchain) */
+#if defined(VK_KHR_swapchain_maintenance1)
+  PFN_vkReleaseSwapchainImagesKHR vkReleaseSwapchainImagesKHR;
+#else
+  PFN_vkVoidFunction padding143;
+#endif /* defined(VK_KHR_swapchain_maintenance1) */
+#if defined(VK_KHR_synchronization2)
+  PFN_vkCmdPipelineBarrier2KHR vkCmdPipelineBarrier2KHR;
+  PFN_vkCmdResetEvent2KHR vkCmdResetEvent2KHR;
+  PFN_vkCmdSetEvent2KHR vkCmdSetEvent2KHR;
+  PFN_vkCmdWaitEvents2KHR vkCmdWaitEvents2KHR;
+  PFN_vkCmdWriteTimestamp2KHR vkCmdWriteTimestamp2KHR;
+  PFN_vkQueueSubmit2KHR vkQueueSubmit2KHR;
+#else
+  PFN_vkVoidFunction padding144[6];
+#endif /* defined(VK_KHR_synchronization2) */
+#if defined(VK_KHR_timeline_semaphore)
+  PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR;
+  PFN_vkSignalSemaphoreKHR vkSignalSemaphoreKHR;
+  PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR;
+#else
+  PFN_vkVoidFunction padding145[3];
+#endif /* defined(VK_KHR_timeline_semaphore) */
+#if defined(VK_KHR_video_decode_queue)
+  PFN_vkCmdDecodeVideoKHR vkCmdDecodeVideoKHR;
+#else
+  PFN_vkVoidFunction padding146;
+#endif /* defined(VK_KHR_video_decode_queue) */
+#if defined(VK_KHR_video_encode_queue)
+  PFN_vkCmdEncodeVideoKHR vkCmdEncodeVideoKHR;
+  PFN_vkGetEncodedVideoSessionParametersKHR vkGetEncodedVideoSessionParametersKHR;
+  PFN_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR;
+#else
+  PFN_vkVoidFunction padding147[3];
+#endif /* defined(VK_KHR_video_encode_queue) */
+#if defined(VK_KHR_video_queue)
+  PFN_vkBindVideoSessionMemoryKHR vkBindVideoSessionMemoryKHR;
+  PFN_vkCmdBeginVideoCodingKHR vkCmdBeginVideoCodingKHR;
+  PFN_vkCmdControlVideoCodingKHR vkCmdControlVideoCodingKHR;
+  PFN_vkCmdEndVideoCodingKHR vkCmdEndVideoCodingKHR;
+  PFN_vkCreateVideoSessionKHR vkCreateVideoSessionKHR;
+  PFN_vkCreateVideoSessionParametersKHR vkCreateVideoSessionParametersKHR;
+  PFN_vkDestroyVideoSessionKHR vkDestroyVideoSessionKHR;
+  PFN_vkDestroyVideoSessionParametersKHR vkDestroyVideoSessionParametersKHR;
+  PFN_vkGetPhysicalDeviceVideoCapabilitiesKHR vkGetPhysicalDeviceVideoCapabilitiesKHR;
+  PFN_vkGetPhysicalDeviceVideoFormatPropertiesKHR vkGetPhysicalDeviceVideoFormatPropertiesKHR;
+  PFN_vkGetVideoSessionMemoryRequirementsKHR vkGetVideoSessionMemoryRequirementsKHR;
+  PFN_vkUpdateVideoSessionParametersKHR vkUpdateVideoSessionParametersKHR;
+#else
+  PFN_vkVoidFunction padding148[12];
+#endif /* defined(VK_KHR_video_queue) */
+#if defined(VK_KHR_wayland_surface)
+  PFN_vkCreateWaylandSurfaceKHR vkCreateWaylandSurfaceKHR;
+  PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR vkGetPhysicalDeviceWaylandPresentationSupportKHR;
+#else
+  PFN_vkVoidFunction padding149[2];
+#endif /* defined(VK_KHR_wayland_surface) */
+#if defined(VK_KHR_win32_surface)
+  PFN_vkCreateWin32SurfaceKHR vkCreateWin32SurfaceKHR;
+  PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR vkGetPhysicalDeviceWin32PresentationSupportKHR;
+#else
+  PFN_vkVoidFunction padding150[2];
+#endif /* defined(VK_KHR_win32_surface) */
+#if defined(VK_KHR_xcb_surface)
+  PFN_vkCreateXcbSurfaceKHR vkCreateXcbSurfaceKHR;
+  PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR vkGetPhysicalDeviceXcbPresentationSupportKHR;
+#else
+  PFN_vkVoidFunction padding151[2];
+#endif /* defined(VK_KHR_xcb_surface) */
+#if defined(VK_KHR_xlib_surface)
+  PFN_vkCreateXlibSurfaceKHR vkCreateXlibSurfaceKHR;
+  PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR vkGetPhysicalDeviceXlibPresentationSupportKHR;
+#else
+  PFN_vkVoidFunction padding152[2];
+#endif /* defined(VK_KHR_xlib_surface) */
+#if defined(VK_MVK_ios_surface)
+  PFN_vkCreateIOSSurfaceMVK vkCreateIOSSurfaceMVK;
+#else
+  PFN_vkVoidFunction padding153;
+#endif /* defined(VK_MVK_ios_surface) */
+#if defined(VK_MVK_macos_surface)
+  PFN_vkCreateMacOSSurfaceMVK vkCreateMacOSSurfaceMVK;
+#else
+  PFN_vkVoidFunction padding154;
+#endif /* defined(VK_MVK_macos_surface) */
+#if defined(VK_NN_vi_surface)
+  PFN_vkCreateViSurfaceNN vkCreateViSurfaceNN;
+#else
+  PFN_vkVoidFunction padding155;
+#endif /* defined(VK_NN_vi_surface) */
+#if defined(VK_NVX_binary_import)
+  PFN_vkCmdCuLaunchKernelNVX vkCmdCuLaunchKernelNVX;
+  PFN_vkCreateCuFunctionNVX vkCreateCuFunctionNVX;
+  PFN_vkCreateCuModuleNVX vkCreateCuModuleNVX;
+  PFN_vkDestroyCuFunctionNVX vkDestroyCuFunctionNVX;
+  PFN_vkDestroyCuModuleNVX vkDestroyCuModuleNVX;
+#else
+  PFN_vkVoidFunction padding156[5];
+#endif /* defined(VK_NVX_binary_import) */
+#if defined(VK_NVX_image_view_handle)
+  PFN_vkGetDeviceCombinedImageSamplerIndexNVX vkGetDeviceCombinedImageSamplerIndexNVX;
+  PFN_vkGetImageViewAddressNVX vkGetImageViewAddressNVX;
+  PFN_vkGetImageViewHandle64NVX vkGetImageViewHandle64NVX;
+  PFN_vkGetImageViewHandleNVX vkGetImageViewHandleNVX;
+#else
+  PFN_vkVoidFunction padding157[4];
+#endif /* defined(VK_NVX_image_view_handle) */
+#if defined(VK_NV_acquire_winrt_display)
+  PFN_vkAcquireWinrtDisplayNV vkAcquireWinrtDisplayNV;
+  PFN_vkGetWinrtDisplayNV vkGetWinrtDisplayNV;
+#else
+  PFN_vkVoidFunction padding158[2];
+#endif /* defined(VK_NV_acquire_winrt_display) */
+#if defined(VK_NV_clip_space_w_scaling)
+  PFN_vkCmdSetViewportWScalingNV vkCmdSetViewportWScalingNV;
+#else
+  PFN_vkVoidFunction padding159;
+#endif /* defined(VK_NV_clip_space_w_scaling) */
+#if defined(VK_NV_cluster_acceleration_structure)
+  PFN_vkCmdBuildClusterAccelerationStructureIndirectNV vkCmdBuildClusterAccelerationStructureIndirectNV;
+  PFN_vkGetClusterAccelerationStructureBuildSizesNV vkGetClusterAccelerationStructureBuildSizesNV;
+#else
+  PFN_vkVoidFunction padding160[2];
+#endif /* defined(VK_NV_cluster_acceleration_structure) */
+#if defined(VK_NV_compute_occupancy_priority)
+  PFN_vkCmdSetComputeOccupancyPriorityNV vkCmdSetComputeOccupancyPriorityNV;
+#else
+  PFN_vkVoidFunction padding161;
+#endif /* defined(VK_NV_compute_occupancy_priority) */
+#if defined(VK_NV_cooperative_matrix)
+  PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV vkGetPhysicalDeviceCooperativeMatrixPropertiesNV;
+#else
+  PFN_vkVoidFunction padding162;
+#endif /* defined(VK_NV_cooperative_matrix) */
+#if defined(VK_NV_cooperative_matrix2)
+  PFN_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV;
+#else
+  PFN_vkVoidFunction padding163;
+#endif /* defined(VK_NV_cooperative_matrix2) */
+#if defined(VK_NV_cooperative_vector)
+  PFN_vkCmdConvertCooperativeVectorMatrixNV vkCmdConvertCooperativeVectorMatrixNV;
+  PFN_vkConvertCooperativeVectorMatrixNV vkConvertCooperativeVectorMatrixNV;
+  PFN_vkGetPhysicalDeviceCooperativeVectorPropertiesNV vkGetPhysicalDeviceCooperativeVectorPropertiesNV;
+#else
+  PFN_vkVoidFunction padding164[3];
+#endif /* defined(VK_NV_cooperative_vector) */
+#if defined(VK_NV_copy_memory_indirect)
+  PFN_vkCmdCopyMemoryIndirectNV vkCmdCopyMemoryIndirectNV;
+  PFN_vkCmdCopyMemoryToImageIndirectNV vkCmdCopyMemoryToImageIndirectNV;
+#else
+  PFN_vkVoidFunction padding165[2];
+#endif /* defined(VK_NV_copy_memory_indirect) */
+#if defined(VK_NV_coverage_reduction_mode)
+  PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+#else
+  PFN_vkVoidFunction padding166;
+#endif /* defined(VK_NV_coverage_reduction_mode) */
+#if defined(VK_NV_cuda_kernel_launch)
+  PFN_vkCmdCudaLaunchKernelNV vkCmdCudaLaunchKernelNV;
+  PFN_vkCreateCudaFunctionNV vkCreateCudaFunctionNV;
+  PFN_vkCreateCudaModuleNV vkCreateCudaModuleNV;
+  PFN_vkDestroyCudaFunctionNV vkDestroyCudaFunctionNV;
+  PFN_vkDestroyCudaModuleNV vkDestroyCudaModuleNV;
+  PFN_vkGetCudaModuleCacheNV vkGetCudaModuleCacheNV;
+#else
+  PFN_vkVoidFunction padding167[6];
+#endif /* defined(VK_NV_cuda_kernel_launch) */
+#if defined(VK_NV_device_diagnostic_checkpoints)
+  PFN_vkCmdSetCheckpointNV vkCmdSetCheckpointNV;
+  PFN_vkGetQueueCheckpointDataNV vkGetQueueCheckpointDataNV;
+#else
+  PFN_vkVoidFunction padding168[2];
+#endif /* defined(VK_NV_device_diagnostic_checkpoints) */
+#if defined(VK_NV_device_diagnostic_checkpoints) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2))
+  PFN_vkGetQueueCheckpointData2NV vkGetQueueCheckpointData2NV;
+#else
+  PFN_vkVoidFunction padding169;
+#endif /* defined(VK_NV_device_diagnostic_checkpoints) && (defined(VK_VERSION_1_3) || defined(VK_KHR_synchronization2)) */
+#if defined(VK_NV_device_generated_commands)
+  PFN_vkCmdBindPipelineShaderGroupNV vkCmdBindPipelineShaderGroupNV;
+  PFN_vkCmdExecuteGeneratedCommandsNV vkCmdExecuteGeneratedCommandsNV;
+  PFN_vkCmdPreprocessGeneratedCommandsNV vkCmdPreprocessGeneratedCommandsNV;
+  PFN_vkCreateIndirectCommandsLayoutNV vkCreateIndirectCommandsLayoutNV;
+  PFN_vkDestroyIndirectCommandsLayoutNV vkDestroyIndirectCommandsLayoutNV;
+  PFN_vkGetGeneratedCommandsMemoryRequirementsNV vkGetGeneratedCommandsMemoryRequirementsNV;
+#else
+  PFN_vkVoidFunction padding170[6];
+#endif /* defined(VK_NV_device_generated_commands) */
+#if defined(VK_NV_device_generated_commands_compute)
+  PFN_vkCmdUpdatePipelineIndirectBufferNV vkCmdUpdatePipelineIndirectBufferNV;
+  PFN_vkGetPipelineIndirectDeviceAddressNV vkGetPipelineIndirectDeviceAddressNV;
+  PFN_vkGetPipelineIndirectMemoryRequirementsNV vkGetPipelineIndirectMemoryRequirementsNV;
+#else
+  PFN_vkVoidFunction padding171[3];
+#endif /* defined(VK_NV_device_generated_commands_compute) */
+#if defined(VK_NV_external_compute_queue)
+  PFN_vkCreateExternalComputeQueueNV vkCreateExternalComputeQueueNV;
+  PFN_vkDestroyExternalComputeQueueNV vkDestroyExternalComputeQueueNV;
+  PFN_vkGetExternalComputeQueueDataNV vkGetExternalComputeQueueDataNV;
+#else
+  PFN_vkVoidFunction padding172[3];
+#endif /* defined(VK_NV_external_compute_queue) */
+#if defined(VK_NV_external_memory_capabilities)
+  PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV vkGetPhysicalDeviceExternalImageFormatPropertiesNV;
+#else
+  PFN_vkVoidFunction padding173;
+#endif /* defined(VK_NV_external_memory_capabilities) */
+#if defined(VK_NV_external_memory_rdma)
+  PFN_vkGetMemoryRemoteAddressNV vkGetMemoryRemoteAddressNV;
+#else
+  PFN_vkVoidFunction padding174;
+#endif /* defined(VK_NV_external_memory_rdma) */
+#if defined(VK_NV_external_memory_win32)
+  PFN_vkGetMemoryWin32HandleNV vkGetMemoryWin32HandleNV;
+#else
+  PFN_vkVoidFunction padding175;
+#endif /* defined(VK_NV_external_memory_win32) */
+#if defined(VK_NV_fragment_shading_rate_enums)
+  PFN_vkCmdSetFragmentShadingRateEnumNV vkCmdSetFragmentShadingRateEnumNV;
+#else
+  PFN_vkVoidFunction padding176;
+#endif /* defined(VK_NV_fragment_shading_rate_enums) */
+#if defined(VK_NV_low_latency2)
+  PFN_vkGetLatencyTimingsNV vkGetLatencyTimingsNV;
+  PFN_vkLatencySleepNV vkLatencySleepNV;
+  PFN_vkQueueNotifyOutOfBandNV vkQueueNotifyOutOfBandNV;
+  PFN_vkSetLatencyMarkerNV vkSetLatencyMarkerNV;
+  PFN_vkSetLatencySleepModeNV vkSetLatencySleepModeNV;
+#else
+  PFN_vkVoidFunction padding177[5];
+#endif /* defined(VK_NV_low_latency2) */
+#if defined(VK_NV_memory_decompression)
+  PFN_vkCmdDecompressMemoryIndirectCountNV vkCmdDecompressMemoryIndirectCountNV;
+  PFN_vkCmdDecompressMemoryNV vkCmdDecompressMemoryNV;
+#else
+  PFN_vkVoidFunction padding178[2];
+#endif /* defined(VK_NV_memory_decompression) */
+#if defined(VK_NV_mesh_shader)
+  PFN_vkCmdDrawMeshTasksIndirectNV vkCmdDrawMeshTasksIndirectNV;
+  PFN_vkCmdDrawMeshTasksNV vkCmdDrawMeshTasksNV;
+#else
+  PFN_vkVoidFunction padding179[2];
+#endif /* defined(VK_NV_mesh_shader) */
+#if defined(VK_NV_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count))
+  PFN_vkCmdDrawMeshTasksIndirectCountNV vkCmdDrawMeshTasksIndirectCountNV;
+#else
+  PFN_vkVoidFunction padding180;
+#endif /* defined(VK_NV_mesh_shader) && (defined(VK_VERSION_1_2) || defined(VK_KHR_draw_indirect_count) || defined(VK_AMD_draw_indirect_count)) */
+#if defined(VK_NV_optical_flow)
+  PFN_vkBindOpticalFlowSessionImageNV vkBindOpticalFlowSessionImageNV;
+  PFN_vkCmdOpticalFlowExecuteNV vkCmdOpticalFlowExecuteNV;
+  PFN_vkCreateOpticalFlowSessionNV vkCreateOpticalFlowSessionNV;
+  PFN_vkDestroyOpticalFlowSessionNV vkDestroyOpticalFlowSessionNV;
+  PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV vkGetPhysicalDeviceOpticalFlowImageFormatsNV;
+#else
+  PFN_vkVoidFunction padding181[5];
+#endif /* defined(VK_NV_optical_flow) */
+#if defined(VK_NV_partitioned_acceleration_structure)
+  PFN_vkCmdBuildPartitionedAccelerationStructuresNV vkCmdBuildPartitionedAccelerationStructuresNV;
+  PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV vkGetPartitionedAccelerationStructuresBuildSizesNV;
+#else
+  PFN_vkVoidFunction padding182[2];
+#endif /* defined(VK_NV_partitioned_acceleration_structure) */
+#if defined(VK_NV_ray_tracing)
+  PFN_vkBindAccelerationStructureMemoryNV vkBindAccelerationStructureMemoryNV;
+  PFN_vkCmdBuildAccelerationStructureNV vkCmdBuildAccelerationStructureNV;
+  PFN_vkCmdCopyAccelerationStructureNV vkCmdCopyAccelerationStructureNV;
+  PFN_vkCmdTraceRaysNV vkCmdTraceRaysNV;
+  PFN_vkCmdWriteAccelerationStructuresPropertiesNV vkCmdWriteAccelerationStructuresPropertiesNV;
+  PFN_vkCompileDeferredNV vkCompileDeferredNV;
+  PFN_vkCreateAccelerationStructureNV vkCreateAccelerationStructureNV;
+  PFN_vkCreateRayTracingPipelinesNV vkCreateRayTracingPipelinesNV;
+  PFN_vkDestroyAccelerationStructureNV vkDestroyAccelerationStructureNV;
+  PFN_vkGetAccelerationStructureHandleNV vkGetAccelerationStructureHandleNV;
+  PFN_vkGetAccelerationStructureMemoryRequirementsNV vkGetAccelerationStructureMemoryRequirementsNV;
+  PFN_vkGetRayTracingShaderGroupHandlesNV vkGetRayTracingShaderGroupHandlesNV;
+#else
+  PFN_vkVoidFunction padding183[12];
+#endif /* defined(VK_NV_ray_tracing) */
+#if defined(VK_NV_scissor_exclusive) && VK_NV_SCISSOR_EXCLUSIVE_SPEC_VERSION >= 2
+  PFN_vkCmdSetExclusiveScissorEnableNV vkCmdSetExclusiveScissorEnableNV;
+#else
+  PFN_vkVoidFunction padding184;
+#endif /* defined(VK_NV_scissor_exclusive) && VK_NV_SCISSOR_EXCLUSIVE_SPEC_VERSION >= 2 */
+#if defined(VK_NV_scissor_exclusive)
+  PFN_vkCmdSetExclusiveScissorNV vkCmdSetExclusiveScissorNV;
+#else
+  PFN_vkVoidFunction padding185;
+#endif /* defined(VK_NV_scissor_exclusive) */
+#if defined(VK_NV_shading_rate_image)
+  PFN_vkCmdBindShadingRateImageNV vkCmdBindShadingRateImageNV;
+  PFN_vkCmdSetCoarseSampleOrderNV vkCmdSetCoarseSampleOrderNV;
+  PFN_vkCmdSetViewportShadingRatePaletteNV vkCmdSetViewportShadingRatePaletteNV;
+#else
+  PFN_vkVoidFunction padding186[3];
+#endif /* defined(VK_NV_shading_rate_image) */
+#if defined(VK_OHOS_external_memory)
+  PFN_vkGetMemoryNativeBufferOHOS vkGetMemoryNativeBufferOHOS;
+  PFN_vkGetNativeBufferPropertiesOHOS vkGetNativeBufferPropertiesOHOS;
+#else
+  PFN_vkVoidFunction padding187[2];
+#endif /* defined(VK_OHOS_external_memory) */
+#if defined(VK_OHOS_surface)
+  PFN_vkCreateSurfaceOHOS vkCreateSurfaceOHOS;
+#else
+  PFN_vkVoidFunction padding188;
+#endif /* defined(VK_OHOS_surface) */
+#if defined(VK_QCOM_tile_memory_heap)
+  PFN_vkCmdBindTileMemoryQCOM vkCmdBindTileMemoryQCOM;
+#else
+  PFN_vkVoidFunction padding189;
+#endif /* defined(VK_QCOM_tile_memory_heap) */
+#if defined(VK_QCOM_tile_properties)
+  PFN_vkGetDynamicRenderingTilePropertiesQCOM vkGetDynamicRenderingTilePropertiesQCOM;
+  PFN_vkGetFramebufferTilePropertiesQCOM vkGetFramebufferTilePropertiesQCOM;
+#else
+  PFN_vkVoidFunction padding190[2];
+#endif /* defined(VK_QCOM_tile_properties) */
+#if defined(VK_QCOM_tile_shading)
+  PFN_vkCmdBeginPerTileExecutionQCOM vkCmdBeginPerTileExecutionQCOM;
+  PFN_vkCmdDispatchTileQCOM vkCmdDispatchTileQCOM;
+  PFN_vkCmdEndPerTileExecutionQCOM vkCmdEndPerTileExecutionQCOM;
+#else
+  PFN_vkVoidFunction padding191[3];
+#endif /* defined(VK_QCOM_tile_shading) */
+#if defined(VK_QNX_external_memory_screen_buffer)
+  PFN_vkGetScreenBufferPropertiesQNX vkGetScreenBufferPropertiesQNX;
+#else
+  PFN_vkVoidFunction padding192;
+#endif /* defined(VK_QNX_external_memory_screen_buffer) */
+#if defined(VK_QNX_screen_surface)
+  PFN_vkCreateScreenSurfaceQNX vkCreateScreenSurfaceQNX;
+  PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX vkGetPhysicalDeviceScreenPresentationSupportQNX;
+#else
+  PFN_vkVoidFunction padding193[2];
+#endif /* defined(VK_QNX_screen_surface) */
+#if defined(VK_SEC_ubm_surface)
+  PFN_vkCreateUbmSurfaceSEC vkCreateUbmSurfaceSEC;
+  PFN_vkGetPhysicalDeviceUbmPresentationSupportSEC vkGetPhysicalDeviceUbmPresentationSupportSEC;
+#else
+  PFN_vkVoidFunction padding194[2];
+#endif /* defined(VK_SEC_ubm_surface) */
+#if defined(VK_VALVE_descriptor_set_host_mapping)
+  PFN_vkGetDescriptorSetHostMappingVALVE vkGetDescriptorSetHostMappingVALVE;
+  PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE vkGetDescriptorSetLayoutHostMappingInfoVALVE;
+#else
+  PFN_vkVoidFunction padding195[2];
+#endif /* defined(VK_VALVE_descriptor_set_host_mapping) */
+#if (defined(VK_EXT_depth_clamp_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clamp_control))
+  PFN_vkCmdSetDepthClampRangeEXT vkCmdSetDepthClampRangeEXT;
+#else
+  PFN_vkVoidFunction padding196;
+#endif /* (defined(VK_EXT_depth_clamp_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clamp_control)) */
+#if (defined(VK_EXT_extended_dynamic_state)) || (defined(VK_EXT_shader_object))
+  PFN_vkCmdBindVertexBuffers2EXT vkCmdBindVertexBuffers2EXT;
+  PFN_vkCmdSetCullModeEXT vkCmdSetCullModeEXT;
+  PFN_vkCmdSetDepthBoundsTestEnableEXT vkCmdSetDepthBoundsTestEnableEXT;
+  PFN_vkCmdSetDepthCompareOpEXT vkCmdSetDepthCompareOpEXT;
+  PFN_vkCmdSetDepthTestEnableEXT vkCmdSetDepthTestEnableEXT;
+  PFN_vkCmdSetDepthWriteEnableEXT vkCmdSetDepthWriteEnableEXT;
+  PFN_vkCmdSetFrontFaceEXT vkCmdSetFrontFaceEXT;
+  PFN_vkCmdSetPrimitiveTopologyEXT vkCmdSetPrimitiveTopologyEXT;
+  PFN_vkCmdSetScissorWithCountEXT vkCmdSetScissorWithCountEXT;
+  PFN_vkCmdSetStencilOpEXT vkCmdSetStencilOpEXT;
+  PFN_vkCmdSetStencilTestEnableEXT vkCmdSetStencilTestEnableEXT;
+  PFN_vkCmdSetViewportWithCountEXT vkCmdSetViewportWithCountEXT;
+#else
+  PFN_vkVoidFunction padding197[12];
+#endif /* (defined(VK_EXT_extended_dynamic_state)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state2)) || (defined(VK_EXT_shader_object))
+  PFN_vkCmdSetDepthBiasEnableEXT vkCmdSetDepthBiasEnableEXT;
+  PFN_vkCmdSetLogicOpEXT vkCmdSetLogicOpEXT;
+  PFN_vkCmdSetPatchControlPointsEXT vkCmdSetPatchControlPointsEXT;
+  PFN_vkCmdSetPrimitiveRestartEnableEXT vkCmdSetPrimitiveRestartEnableEXT;
+  PFN_vkCmdSetRasterizerDiscardEnableEXT vkCmdSetRasterizerDiscardEnableEXT;
+#else
+  PFN_vkVoidFunction padding198[5];
+#endif /* (defined(VK_EXT_extended_dynamic_state2)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3)) || (defined(VK_EXT_shader_object))
+  PFN_vkCmdSetAlphaToCoverageEnableEXT vkCmdSetAlphaToCoverageEnableEXT;
+  PFN_vkCmdSetAlphaToOneEnableEXT vkCmdSetAlphaToOneEnableEXT;
+  PFN_vkCmdSetColorBlendEnableEXT vkCmdSetColorBlendEnableEXT;
+  PFN_vkCmdSetColorBlendEquationEXT vkCmdSetColorBlendEquationEXT;
+  PFN_vkCmdSetColorWriteMaskEXT vkCmdSetColorWriteMaskEXT;
+  PFN_vkCmdSetDepthClampEnableEXT vkCmdSetDepthClampEnableEXT;
+  PFN_vkCmdSetLogicOpEnableEXT vkCmdSetLogicOpEnableEXT;
+  PFN_vkCmdSetPolygonModeEXT vkCmdSetPolygonModeEXT;
+  PFN_vkCmdSetRasterizationSamplesEXT vkCmdSetRasterizationSamplesEXT;
+  PFN_vkCmdSetSampleMaskEXT vkCmdSetSampleMaskEXT;
+#else
+  PFN_vkVoidFunction padding199[10];
+#endif /* (defined(VK_EXT_extended_dynamic_state3)) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && (defined(VK_KHR_maintenance2) || defined(VK_VERSION_1_1))) || (defined(VK_EXT_shader_object))
+  PFN_vkCmdSetTessellationDomainOriginEXT vkCmdSetTessellationDomainOriginEXT;
+#else
+  PFN_vkVoidFunction padding200;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && (defined(VK_KHR_maintenance2) || defined(VK_VERSION_1_1))) || (defined(VK_EXT_shader_object)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_transform_feedback)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_transform_feedback))
+  PFN_vkCmdSetRasterizationStreamEXT vkCmdSetRasterizationStreamEXT;
+#else
+  PFN_vkVoidFunction padding201;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_transform_feedback)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_transform_feedback)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_conservative_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_conservative_rasterization))
+  PFN_vkCmdSetConservativeRasterizationModeEXT vkCmdSetConservativeRasterizationModeEXT;
+  PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT vkCmdSetExtraPrimitiveOverestimationSizeEXT;
+#else
+  PFN_vkVoidFunction padding202[2];
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_conservative_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_conservative_rasterization)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_enable)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_enable))
+  PFN_vkCmdSetDepthClipEnableEXT vkCmdSetDepthClipEnableEXT;
+#else
+  PFN_vkVoidFunction padding203;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_enable)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_enable)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_sample_locations)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_sample_locations))
+  PFN_vkCmdSetSampleLocationsEnableEXT vkCmdSetSampleLocationsEnableEXT;
+#else
+  PFN_vkVoidFunction padding204;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_sample_locations)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_sample_locations)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_blend_operation_advanced)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_blend_operation_advanced))
+  PFN_vkCmdSetColorBlendAdvancedEXT vkCmdSetColorBlendAdvancedEXT;
+#else
+  PFN_vkVoidFunction padding205;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_blend_operation_advanced)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_blend_operation_advanced)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_provoking_vertex)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_provoking_vertex))
+  PFN_vkCmdSetProvokingVertexModeEXT vkCmdSetProvokingVertexModeEXT;
+#else
+  PFN_vkVoidFunction padding206;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_provoking_vertex)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_provoking_vertex)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_line_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_line_rasterization))
+  PFN_vkCmdSetLineRasterizationModeEXT vkCmdSetLineRasterizationModeEXT;
+  PFN_vkCmdSetLineStippleEnableEXT vkCmdSetLineStippleEnableEXT;
+#else
+  PFN_vkVoidFunction padding207[2];
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_line_rasterization)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_line_rasterization)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_control))
+  PFN_vkCmdSetDepthClipNegativeOneToOneEXT vkCmdSetDepthClipNegativeOneToOneEXT;
+#else
+  PFN_vkVoidFunction padding208;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_EXT_depth_clip_control)) || (defined(VK_EXT_shader_object) && defined(VK_EXT_depth_clip_control)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_clip_space_w_scaling)) || (defined(VK_EXT_shader_object) && defined(VK_NV_clip_space_w_scaling))
+  PFN_vkCmdSetViewportWScalingEnableNV vkCmdSetViewportWScalingEnableNV;
+#else
+  PFN_vkVoidFunction padding209;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_clip_space_w_scaling)) || (defined(VK_EXT_shader_object) && defined(VK_NV_clip_space_w_scaling)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_viewport_swizzle)) || (defined(VK_EXT_shader_object) && defined(VK_NV_viewport_swizzle))
+  PFN_vkCmdSetViewportSwizzleNV vkCmdSetViewportSwizzleNV;
+#else
+  PFN_vkVoidFunction padding210;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_viewport_swizzle)) || (defined(VK_EXT_shader_object) && defined(VK_NV_viewport_swizzle)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_fragment_coverage_to_color)) || (defined(VK_EXT_shader_object) && defined(VK_NV_fragment_coverage_to_color))
+  PFN_vkCmdSetCoverageToColorEnableNV vkCmdSetCoverageToColorEnableNV;
+  PFN_vkCmdSetCoverageToColorLocationNV vkCmdSetCoverageToColorLocationNV;
+#else
+  PFN_vkVoidFunction padding211[2];
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_fragment_coverage_to_color)) || (defined(VK_EXT_shader_object) && defined(VK_NV_fragment_coverage_to_color)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) || (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples))
+  PFN_vkCmdSetCoverageModulationModeNV vkCmdSetCoverageModulationModeNV;
+  PFN_vkCmdSetCoverageModulationTableEnableNV vkCmdSetCoverageModulationTableEnableNV;
+  PFN_vkCmdSetCoverageModulationTableNV vkCmdSetCoverageModulationTableNV;
+#else
+  PFN_vkVoidFunction padding212[3];
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_framebuffer_mixed_samples)) || (defined(VK_EXT_shader_object) && defined(VK_NV_framebuffer_mixed_samples)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_shading_rate_image)) || (defined(VK_EXT_shader_object) && defined(VK_NV_shading_rate_image))
+  PFN_vkCmdSetShadingRateImageEnableNV vkCmdSetShadingRateImageEnableNV;
+#else
+  PFN_vkVoidFunction padding213;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_shading_rate_image)) || (defined(VK_EXT_shader_object) && defined(VK_NV_shading_rate_image)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_representative_fragment_test)) || (defined(VK_EXT_shader_object) && defined(VK_NV_representative_fragment_test))
+  PFN_vkCmdSetRepresentativeFragmentTestEnableNV vkCmdSetRepresentativeFragmentTestEnableNV;
+#else
+  PFN_vkVoidFunction padding214;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_representative_fragment_test)) || (defined(VK_EXT_shader_object) && defined(VK_NV_representative_fragment_test)) */
+#if (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_coverage_reduction_mode)) || (defined(VK_EXT_shader_object) && defined(VK_NV_coverage_reduction_mode))
+  PFN_vkCmdSetCoverageReductionModeNV vkCmdSetCoverageReductionModeNV;
+#else
+  PFN_vkVoidFunction padding215;
+#endif /* (defined(VK_EXT_extended_dynamic_state3) && defined(VK_NV_coverage_reduction_mode)) || (defined(VK_EXT_shader_object) && defined(VK_NV_coverage_reduction_mode)) */
+#if (defined(VK_EXT_host_image_copy)) || (defined(VK_EXT_image_compression_control))
+  PFN_vkGetImageSubresourceLayout2EXT vkGetImageSubresourceLayout2EXT;
+#else
+  PFN_vkVoidFunction padding216;
+#endif /* (defined(VK_EXT_host_image_copy)) || (defined(VK_EXT_image_compression_control)) */
+#if (defined(VK_EXT_shader_object)) || (defined(VK_EXT_vertex_input_dynamic_state))
+  PFN_vkCmdSetVertexInputEXT vkCmdSetVertexInputEXT;
+#else
+  PFN_vkVoidFunction padding217;
+#endif /* (defined(VK_EXT_shader_object)) || (defined(VK_EXT_vertex_input_dynamic_state)) */
+#if (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && (defined(VK_VERSION_1_1) || defined(VK_KHR_descriptor_update_template)))
+  PFN_vkCmdPushDescriptorSetWithTemplateKHR vkCmdPushDescriptorSetWithTemplateKHR;
+#else
+  PFN_vkVoidFunction padding218;
+#endif /* (defined(VK_KHR_descriptor_update_template) && defined(VK_KHR_push_descriptor)) || (defined(VK_KHR_push_descriptor) && (defined(VK_VERSION_1_1) || defined(VK_KHR_descriptor_update_template))) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+  PFN_vkGetDeviceGroupPresentCapabilitiesKHR vkGetDeviceGroupPresentCapabilitiesKHR;
+  PFN_vkGetDeviceGroupSurfacePresentModesKHR vkGetDeviceGroupSurfacePresentModesKHR;
+  PFN_vkGetPhysicalDevicePresentRectanglesKHR vkGetPhysicalDevicePresentRectanglesKHR;
+#else
+  PFN_vkVoidFunction padding219[3];
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_surface)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+#if (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1))
+  PFN_vkAcquireNextImage2KHR vkAcquireNextImage2KHR;
+#else
+  PFN_vkVoidFunction padding220;
+#endif /* (defined(VK_KHR_device_group) && defined(VK_KHR_swapchain)) || (defined(VK_KHR_swapchain) && defined(VK_VERSION_1_1)) */
+  /* VOLK_CPP_GENERATE_EXPORT_FUNCTION_POINTERS */
+} VolkCppTable;
+
+typedef struct VolkCppExport {
+  uint32_t structSize;      /* sizeof(VolkCppExport) of the exporter */
+  uint32_t exportVersion;   /* VOLK_CPP_EXPORT_VERSION of the exporter */
+  uint32_t headerVersion;   /* VOLK_CPP_HEADER_VERSION of the exporter */
+  uint32_t vkHeaderVersion; /* VK_HEADER_VERSION of the exporter */
+  uint32_t loadedMask;      /* VOLK_CPP_EXPORT_*_BIT */
+  const VolkCppTable* table;
+  PFN_vkGetInstanceProcAddr getInstanceProcAddr;
+  VkInstance instance;
+  VkDevice device;
+} VolkCppExport;
+
+/**
+ * Return the exporter's table if its layout matches the one this module was built with, NULL otherwise. Without a
+ * table, function pointers must be loaded through getInstanceProcAddr and the exported instance and device.
+ */
+static inline const VolkCppTable* volkCppGetTable(const VolkCppExport* pExport) {
+  if (!pExport || pExport->structSize < sizeof(VolkCppExport) || pExport->exportVersion < VOLK_CPP_EXPORT_VERSION ||
+      !pExport->table || pExport->table->structSize != sizeof(VolkCppTable) ||
+      pExport->table->headerVersion != VOLK_CPP_HEADER_VERSION) {
+    return NULL;
+  }
+  return pExport->table;
+}
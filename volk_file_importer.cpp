@@ -0,0 +1,261 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_file_importer.hpp"
+
+#if defined(VK_BASE_VERSION_1_3)
+
+#include "volk_mapped_file.hpp"
+
+#include <algorithm>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace {
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) noexcept {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+VolkFileImporter::VolkFileImporter(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device,
+                                   VolkUploadQueue& stagedQueue, bool writable /* = false */) noexcept
+  : volk_(volk)
+  , device_(device)
+  , stagedQueue_(stagedQueue)
+  , writable_(writable) {
+  volk_.vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties_);
+
+#if defined(VK_EXT_external_memory_host) && !defined(_WIN32)
+  auto getPhysicalDeviceProperties2 = volk.vkGetPhysicalDeviceProperties2;
+#if defined(VK_KHR_get_physical_device_properties2)
+  if (!getPhysicalDeviceProperties2) {
+    getPhysicalDeviceProperties2 = volk.vkGetPhysicalDeviceProperties2KHR;
+  }
+#endif
+  if (!getPhysicalDeviceProperties2 || !volk.vkGetMemoryHostPointerPropertiesEXT) {
+    return;
+  }
+
+  VkPhysicalDeviceExternalMemoryHostPropertiesEXT hostProperties = {};
+  hostProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+  VkPhysicalDeviceProperties2 properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties.pNext = &hostProperties;
+  getPhysicalDeviceProperties2(physicalDevice, &properties);
+  if (hostProperties.minImportedHostPointerAlignment != 0) {
+    importAlignment_ = std::max<VkDeviceSize>(hostProperties.minImportedHostPointerAlignment,
+                                              static_cast<VkDeviceSize>(sysconf(_SC_PAGESIZE)));
+  }
+#endif
+}
+
+VkResult VolkFileImporter::getStatus() noexcept {
+  return stagedQueue_.getStatus();
+}
+
+bool VolkFileImporter::isImportAvailable() const noexcept {
+  return importAlignment_ != 0;
+}
+
+VolkFileImporter::Stats VolkFileImporter::getStats() noexcept {
+  std::lock_guard lock(mutex_);
+  return stats_;
+}
+
+uint32_t VolkFileImporter::findMemoryType(uint32_t memoryTypeBits, VkMemoryPropertyFlags preferred) const noexcept {
+  uint32_t fallback = VK_MAX_MEMORY_TYPES;
+  for (uint32_t i = 0; i < memoryProperties_.memoryTypeCount; ++i) {
+    if (!(memoryTypeBits & (1u << i))) {
+      continue;
+    }
+    if ((memoryProperties_.memoryTypes[i].propertyFlags & preferred) == preferred) {
+      return i;
+    }
+    fallback = std::min(fallback, i);
+  }
+  return fallback;
+}
+
+VkResult VolkFileImporter::load(const char* path, VkBufferUsageFlags usage, Buffer* pBuffer) noexcept {
+  *pBuffer = Buffer();
+  if (isImportAvailable()) {
+    auto const result = import(path, usage, *pBuffer);
+    if (result == VK_SUCCESS) {
+      std::lock_guard lock(mutex_);
+      ++stats_.importedFiles;
+      stats_.importedBytes += pBuffer->size;
+      return VK_SUCCESS;
+    }
+    unload(*pBuffer);
+    if (result == VK_ERROR_INITIALIZATION_FAILED) {
+      return result;
+    }
+    std::lock_guard lock(mutex_);
+    ++stats_.importFailures;
+  }
+
+  auto const result = stage(path, usage, *pBuffer);
+  if (result != VK_SUCCESS) {
+    unload(*pBuffer);
+    return result;
+  }
+  std::lock_guard lock(mutex_);
+  ++stats_.stagedFiles;
+  stats_.stagedBytes += pBuffer->size;
+  return VK_SUCCESS;
+}
+
+VkResult VolkFileImporter::import(const char* path, VkBufferUsageFlags usage, Buffer& buffer) noexcept {
+#if defined(VK_EXT_external_memory_host) && !defined(_WIN32)
+  // VK_ERROR_INITIALIZATION_FAILED stands for file errors, which the staged path would hit as well.
+  auto fd = ::open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  struct stat st = {};
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    ::close(fd);
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  buffer.size = static_cast<VkDeviceSize>(st.st_size);
+  auto const importSize = alignUp(buffer.size, importAlignment_);
+  auto const fileMappingSize = alignUp(buffer.size, static_cast<uint64_t>(sysconf(_SC_PAGESIZE)));
+
+  // Reserve enough address space to place the file at an aligned address; the file mapping replaces the start of the
+  // aligned block and the anonymous pages behind it pad the import to importAlignment_.
+  auto const protection = PROT_READ | (writable_ ? PROT_WRITE : 0);
+  buffer.mappingSize = static_cast<size_t>(importSize + importAlignment_);
+  auto* reservation = mmap(nullptr, buffer.mappingSize, protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (reservation == MAP_FAILED) {
+    ::close(fd);
+    buffer.mappingSize = 0;
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  buffer.mapping = reservation;
+  auto* aligned = reinterpret_cast<void*>(alignUp(reinterpret_cast<uintptr_t>(reservation), importAlignment_));
+  auto* file = mmap(aligned, static_cast<size_t>(fileMappingSize), protection, MAP_PRIVATE | MAP_FIXED, fd, 0);
+  ::close(fd);
+  if (file == MAP_FAILED) {
+    return VK_ERROR_OUT_OF_HOST_MEMORY;
+  }
+
+  VkMemoryHostPointerPropertiesEXT pointerProperties = {};
+  pointerProperties.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+  auto result = volk_.vkGetMemoryHostPointerPropertiesEXT(
+    device_, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT, aligned, &pointerProperties);
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+
+  VkExternalMemoryBufferCreateInfo externalCreateInfo = {};
+  externalCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+  externalCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+  VkBufferCreateInfo bufferCreateInfo = {};
+  bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  bufferCreateInfo.pNext = &externalCreateInfo;
+  bufferCreateInfo.size = buffer.size;
+  bufferCreateInfo.usage = usage;
+  bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  result = volk_.vkCreateBuffer(device_, &bufferCreateInfo, nullptr, &buffer.buffer);
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+
+  VkMemoryRequirements requirements = {};
+  volk_.vkGetBufferMemoryRequirements(device_, buffer.buffer, &requirements);
+  auto const memoryTypeIndex = findMemoryType(requirements.memoryTypeBits & pointerProperties.memoryTypeBits, 0);
+  if (memoryTypeIndex == VK_MAX_MEMORY_TYPES || requirements.size > importSize ||
+      importAlignment_ % requirements.alignment != 0) {
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+  }
+
+  VkImportMemoryHostPointerInfoEXT importInfo = {};
+  importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+  importInfo.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+  importInfo.pHostPointer = aligned;
+  VkMemoryAllocateInfo allocateInfo = {};
+  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.pNext = &importInfo;
+  allocateInfo.allocationSize = importSize;
+  allocateInfo.memoryTypeIndex = memoryTypeIndex;
+  result = volk_.vkAllocateMemory(device_, &allocateInfo, nullptr, &buffer.memory);
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+  result = volk_.vkBindBufferMemory(device_, buffer.buffer, buffer.memory, 0);
+  buffer.imported = result == VK_SUCCESS;
+  return result;
+#else
+  (void)path;
+  (void)usage;
+  (void)buffer;
+  return VK_ERROR_FEATURE_NOT_PRESENT;
+#endif
+}
+
+VkResult VolkFileImporter::stage(const char* path, VkBufferUsageFlags usage, Buffer& buffer) noexcept {
+  VolkMappedFile file;
+  if (!file.open(path)) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  buffer.size = file.getSize();
+
+  VkBufferCreateInfo bufferCreateInfo = {};
+  bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  bufferCreateInfo.size = buffer.size;
+  bufferCreateInfo.usage = usage | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+  bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  auto result = volk_.vkCreateBuffer(device_, &bufferCreateInfo, nullptr, &buffer.buffer);
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+
+  VkMemoryRequirements requirements = {};
+  volk_.vkGetBufferMemoryRequirements(device_, buffer.buffer, &requirements);
+  VkMemoryAllocateInfo allocateInfo = {};
+  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.allocationSize = requirements.size;
+  allocateInfo.memoryTypeIndex = findMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+  if (allocateInfo.memoryTypeIndex == VK_MAX_MEMORY_TYPES) {
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+  }
+  result = volk_.vkAllocateMemory(device_, &allocateInfo, nullptr, &buffer.memory);
+  if (result == VK_SUCCESS) {
+    result = volk_.vkBindBufferMemory(device_, buffer.buffer, buffer.memory, 0);
+  }
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+
+  // The upload queue splits the file into chunks of half its ring, copying straight from the mapping, so the
+  // resident staging memory stays bounded by the ring size.
+  buffer.value = stagedQueue_.uploadBuffer(buffer.buffer, 0, file.getData(), buffer.size);
+  if (buffer.value == 0) {
+    result = stagedQueue_.getStatus();
+    return result != VK_SUCCESS ? result : VK_ERROR_OUT_OF_DEVICE_MEMORY;
+  }
+  (void)stagedQueue_.flush();
+  return VK_SUCCESS;
+}
+
+void VolkFileImporter::unload(Buffer& buffer) noexcept {
+  if (buffer.buffer != VK_NULL_HANDLE) {
+    volk_.vkDestroyBuffer(device_, buffer.buffer, nullptr);
+  }
+  if (buffer.memory != VK_NULL_HANDLE) {
+    volk_.vkFreeMemory(device_, buffer.memory, nullptr);
+  }
+#if !defined(_WIN32)
+  if (buffer.mapping) {
+    munmap(buffer.mapping, buffer.mappingSize);
+  }
+#endif
+  buffer = Buffer();
+}
+
+#endif
@@ -0,0 +1,85 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_upload_queue.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#if defined(VK_BASE_VERSION_1_3)
+
+/**
+ * Loads files into VkBuffers, importing a memory mapping of the file with VK_EXT_external_memory_host where possible.
+ *
+ * The file is mapped at an address aligned to minImportedHostPointerAlignment, the mapping is imported as
+ * VkDeviceMemory through VkImportMemoryHostPointerInfoEXT and bound to a buffer, so the device reads the page cache
+ * directly and no staging copy is made. The tail of the last aligned block past the end of the file is zero-filled.
+ * Import needs a POSIX system.
+ *
+ * If the extension is missing or the driver refuses the import, the buffer is allocated from device local memory and
+ * the file is streamed into it through the VolkUploadQueue; the upload queue's ownership transfer rules apply.
+ */
+class VolkFileImporter final {
+public:
+  struct Buffer {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize size = 0;   // file size
+    uint64_t value = 0;      // upload queue semaphore value of a staged load, 0 if imported
+    bool imported = false;
+    void* mapping = nullptr; // imported mapping, released by unload()
+    size_t mappingSize = 0;
+  };
+
+  struct Stats {
+    uint64_t importedFiles = 0;
+    uint64_t importedBytes = 0;
+    uint64_t stagedFiles = 0;
+    uint64_t stagedBytes = 0;
+    uint64_t importFailures = 0; // imports refused by the driver
+  };
+
+  /**
+   * Volk must have device function pointers loaded for the given device. If writable is false the mapping is
+   * read-only, which keeps the pages shared with the page cache but requires the driver to accept read-only host
+   * pointers. Device writes to a writable mapping are never written back to the file.
+   */
+  VolkFileImporter(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device, VolkUploadQueue& stagedQueue,
+                   bool writable = false) noexcept;
+  VolkFileImporter(const VolkFileImporter&) = delete;
+  VolkFileImporter& operator=(const VolkFileImporter&) = delete;
+
+  [[nodiscard]] VkResult getStatus() noexcept;
+  [[nodiscard]] bool isImportAvailable() const noexcept;
+  [[nodiscard]] Stats getStats() noexcept;
+
+  /**
+   * Load the file at path into a new buffer with the given usage. A staged load returns once the last chunk is
+   * submitted; the buffer must not be used before pBuffer->value is signaled.
+   */
+  [[nodiscard]] VkResult load(const char* path, VkBufferUsageFlags usage, Buffer* pBuffer) noexcept;
+
+  /**
+   * Destroy the buffer and release its memory and mapping. The device must be done with the buffer.
+   */
+  void unload(Buffer& buffer) noexcept;
+
+private:
+  [[nodiscard]] VkResult import(const char* path, VkBufferUsageFlags usage, Buffer& buffer) noexcept;
+  [[nodiscard]] VkResult stage(const char* path, VkBufferUsageFlags usage, Buffer& buffer) noexcept;
+  [[nodiscard]] uint32_t findMemoryType(uint32_t memoryTypeBits, VkMemoryPropertyFlags preferred) const noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VolkUploadQueue& stagedQueue_;
+  VkPhysicalDeviceMemoryProperties memoryProperties_ = {};
+  VkDeviceSize importAlignment_ = 0; // 0 if import isn't available
+  bool writable_ = false;
+
+  std::mutex mutex_;
+  Stats stats_;
+};
+
+#endif
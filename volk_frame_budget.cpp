@@ -0,0 +1,85 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_frame_budget.hpp"
+
+#include <algorithm>
+#include <vector>
+
+VolkFrameBudget::VolkFrameBudget(Volk& volk) noexcept
+  : volk_(volk)
+  , frames_(new Frame[kFrameCount]())
+  , slots_([this](uint32_t threadSlot) { retire(threadSlot); }) {}
+
+#if defined(VK_KHR_swapchain)
+VkResult VolkFrameBudget::vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) noexcept {
+  auto result = call(Category::Submission, volk_.vkQueuePresentKHR, queue, pPresentInfo);
+  markFrame();
+  return result;
+}
+#endif
+
+void VolkFrameBudget::markFrame() noexcept {
+  std::lock_guard lock(mutex_);
+  auto& frame = frames_[frameIndex_.load(std::memory_order_relaxed) % kFrameCount];
+  for (uint32_t thread = 0; thread <= kRetiredRow; ++thread) {
+    for (uint32_t category = 0; category < kCategoryCount; ++category) {
+      frame[thread][category] = current_[thread][category].exchange(0, std::memory_order_relaxed);
+    }
+  }
+  frameIndex_.fetch_add(1, std::memory_order_release);
+}
+
+VolkFrameBudget::Stats VolkFrameBudget::getStats(Category category,
+                                                 uint32_t threadSlot /* = kAllThreads */) const noexcept {
+  auto const c = static_cast<uint32_t>(category);
+  std::vector<uint64_t> values;
+  {
+    std::lock_guard lock(mutex_);
+    auto const count = static_cast<uint32_t>(std::min<uint64_t>(frameIndex_.load(std::memory_order_relaxed), kFrameCount));
+    values.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+      auto const& frame = frames_[i];
+      uint64_t value = 0;
+      if (threadSlot == kAllThreads) {
+        for (uint32_t thread = 0; thread <= kRetiredRow; ++thread) {
+          value += frame[thread][c];
+        }
+      } else if (threadSlot < kMaxThreads) {
+        value = frame[threadSlot][c];
+      }
+      values.push_back(value);
+    }
+  }
+
+  Stats stats;
+  stats.frameCount = static_cast<uint32_t>(values.size());
+  if (values.empty()) {
+    return stats;
+  }
+  std::sort(values.begin(), values.end());
+  auto percentile = [&values](size_t p) { return values[(values.size() - 1) * p / 100]; };
+  stats.p50Nanoseconds = percentile(50);
+  stats.p99Nanoseconds = percentile(99);
+  stats.maxNanoseconds = values.back();
+  return stats;
+}
+
+std::thread::id VolkFrameBudget::getSlotThread(uint32_t threadSlot) const noexcept {
+  return slots_.getOwner(threadSlot);
+}
+
+uint64_t VolkFrameBudget::getFrameIndex() const noexcept {
+  return frameIndex_.load(std::memory_order_acquire);
+}
+
+void VolkFrameBudget::add(Category category, std::chrono::steady_clock::duration duration) noexcept {
+  auto const nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+  current_[slots_.acquire()][static_cast<uint32_t>(category)].fetch_add(static_cast<uint64_t>(nanoseconds),
+                                                                         std::memory_order_relaxed);
+}
+
+void VolkFrameBudget::retire(uint32_t threadSlot) noexcept {
+  for (uint32_t category = 0; category < kCategoryCount; ++category) {
+    current_[kRetiredRow][category].fetch_add(current_[threadSlot][category].exchange(0, std::memory_order_relaxed),
+                                              std::memory_order_relaxed);
+  }
+}
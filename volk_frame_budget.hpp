@@ -0,0 +1,124 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_thread_slots.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * Per-frame driver CPU time, split by thread and by category.
+ *
+ * Calls made through call() (or timed with a Scope) are accumulated per thread for the current frame; markFrame(),
+ * or presenting through vkQueuePresentKHR() of this class, closes the frame and stores it in a ring of the last
+ * kFrameCount frames. Percentiles over that window can be polled from any thread.
+ *
+ * Recording threads don't lock; up to kMaxThreads - 1 threads get their own slot, further threads share one. The
+ * slot of a thread which exits is freed, and its time in the current frame still counts towards the all-thread total.
+ */
+class VolkFrameBudget final {
+public:
+  enum class Category : uint32_t {
+    Recording = 0,        // vkCmd*, vkBegin/EndCommandBuffer
+    Submission = 1,       // vkQueueSubmit*, vkQueuePresentKHR
+    Synchronization = 2,  // waits on fences, semaphores and idle
+    ResourceCreation = 3, // vkCreate*, vkAllocate*, vkDestroy*, vkFree*
+    Other = 4,
+  };
+  static constexpr uint32_t kCategoryCount = 5;
+  static constexpr uint32_t kMaxThreads = 16;
+  static constexpr uint32_t kFrameCount = 128;
+  static constexpr uint32_t kAllThreads = ~0U;
+
+  struct Stats {
+    uint64_t p50Nanoseconds = 0;
+    uint64_t p99Nanoseconds = 0;
+    uint64_t maxNanoseconds = 0;
+    uint32_t frameCount = 0; // frames in the window the statistics were computed from
+  };
+
+  /**
+   * Adds the time between construction and destruction to the calling thread's category in the current frame.
+   */
+  class Scope final {
+  public:
+    Scope(VolkFrameBudget& budget, Category category) noexcept
+      : budget_(budget), category_(category), start_(std::chrono::steady_clock::now()) {}
+    ~Scope() noexcept {
+      budget_.add(category_, std::chrono::steady_clock::now() - start_);
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    VolkFrameBudget& budget_;
+    Category category_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  /**
+   * Volk must have device function pointers loaded for vkQueuePresentKHR() to be used.
+   */
+  explicit VolkFrameBudget(Volk& volk) noexcept;
+  VolkFrameBudget(const VolkFrameBudget&) = delete;
+  VolkFrameBudget& operator=(const VolkFrameBudget&) = delete;
+
+  /**
+   * Call a Vulkan function pointer and account its duration, e.g. call(Category::Recording, volk.vkCmdDraw, ...).
+   */
+  template <typename Function, typename... Args>
+  decltype(auto) call(Category category, Function function, Args... args) noexcept {
+    Scope scope(*this, category);
+    return function(args...);
+  }
+
+#if defined(VK_KHR_swapchain)
+  /**
+   * Forwards to Volk::vkQueuePresentKHR, accounts it as submission and closes the frame.
+   */
+  VkResult vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) noexcept;
+#endif
+
+  /**
+   * Close the current frame. Time recorded concurrently with this call may go to either frame.
+   */
+  void markFrame() noexcept;
+
+  /**
+   * Percentiles of per-frame time of the category over the window, for one thread slot or summed over all threads.
+   */
+  [[nodiscard]] Stats getStats(Category category, uint32_t threadSlot = kAllThreads) const noexcept;
+
+  /**
+   * Thread which owns the slot, see VolkThreadSlots::getOwner.
+   */
+  [[nodiscard]] std::thread::id getSlotThread(uint32_t threadSlot) const noexcept;
+
+  /**
+   * Number of frames closed since construction.
+   */
+  [[nodiscard]] uint64_t getFrameIndex() const noexcept;
+
+private:
+  // The last row holds the time of threads which exited during the frame.
+  static constexpr uint32_t kRetiredRow = kMaxThreads;
+  using Frame = uint64_t[kMaxThreads + 1][kCategoryCount];
+
+  void add(Category category, std::chrono::steady_clock::duration duration) noexcept;
+  void retire(uint32_t threadSlot) noexcept;
+
+  Volk& volk_;
+  std::atomic<uint64_t> current_[kMaxThreads + 1][kCategoryCount] = {};
+
+  mutable std::mutex mutex_;
+  std::unique_ptr<Frame[]> frames_;
+  std::atomic<uint64_t> frameIndex_ = 0;
+
+  // Declared last so that exiting threads stop retiring slots before the counters are destroyed.
+  VolkThreadSlots<kMaxThreads> slots_;
+};
@@ -0,0 +1,229 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_gpu_waiter.hpp"
+
+#if defined(VK_BASE_VERSION_1_2)
+
+#include <algorithm>
+#include <utility>
+
+VolkGpuWaiter::Awaitable::Awaitable(VolkGpuWaiter& waiter, VkSemaphore semaphore, uint64_t value,
+                                    VkFence fence) noexcept
+  : waiter_(waiter)
+  , semaphore_(semaphore)
+  , value_(value)
+  , fence_(fence) {}
+
+bool VolkGpuWaiter::Awaitable::await_ready() noexcept {
+  if (waiter_.status_ != VK_SUCCESS) {
+    result_ = waiter_.status_;
+    return true;
+  }
+  auto const deviceStatus = waiter_.deviceStatus_.load(std::memory_order_acquire);
+  if (deviceStatus != VK_SUCCESS) {
+    result_ = deviceStatus;
+    return true;
+  }
+  result_ = waiter_.poll(*this);
+  return result_ != VK_NOT_READY;
+}
+
+bool VolkGpuWaiter::Awaitable::await_suspend(std::coroutine_handle<> handle) noexcept {
+  handle_ = handle;
+  return waiter_.add(this);
+}
+
+VkResult VolkGpuWaiter::Awaitable::await_resume() const noexcept {
+  return result_;
+}
+
+VolkGpuWaiter::VolkGpuWaiter(Volk& volk, VkDevice device, Executor executor /* = {} */) noexcept
+  : volk_(volk)
+  , device_(device)
+  , executor_(std::move(executor))
+  , getSemaphoreCounterValue_(volk.vkGetSemaphoreCounterValue)
+  , waitSemaphores_(volk.vkWaitSemaphores)
+  , signalSemaphore_(volk.vkSignalSemaphore) {
+#if defined(VK_KHR_timeline_semaphore)
+  if (!getSemaphoreCounterValue_ || !waitSemaphores_ || !signalSemaphore_) {
+    getSemaphoreCounterValue_ = volk.vkGetSemaphoreCounterValueKHR;
+    waitSemaphores_ = volk.vkWaitSemaphoresKHR;
+    signalSemaphore_ = volk.vkSignalSemaphoreKHR;
+  }
+#endif
+  if (!getSemaphoreCounterValue_ || !waitSemaphores_ || !signalSemaphore_) {
+    status_ = VK_ERROR_EXTENSION_NOT_PRESENT;
+    return;
+  }
+
+  VkSemaphoreTypeCreateInfo typeCreateInfo = {};
+  typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+  typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+  VkSemaphoreCreateInfo createInfo = {};
+  createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  createInfo.pNext = &typeCreateInfo;
+  status_ = volk_.vkCreateSemaphore(device_, &createInfo, nullptr, &wakeSemaphore_);
+  if (status_ != VK_SUCCESS) {
+    return;
+  }
+
+  thread_ = std::thread([this] { run(); });
+}
+
+VolkGpuWaiter::~VolkGpuWaiter() noexcept {
+  if (thread_.joinable()) {
+    {
+      std::lock_guard lock(mutex_);
+      stop_ = true;
+      wake();
+    }
+    thread_.join();
+  }
+  if (wakeSemaphore_ != VK_NULL_HANDLE) {
+    volk_.vkDestroySemaphore(device_, wakeSemaphore_, nullptr);
+  }
+}
+
+VkResult VolkGpuWaiter::getStatus() const noexcept {
+  return status_;
+}
+
+VolkGpuWaiter::Awaitable VolkGpuWaiter::wait(VkSemaphore timelineSemaphore, uint64_t value) noexcept {
+  return Awaitable(*this, timelineSemaphore, value, VK_NULL_HANDLE);
+}
+
+VolkGpuWaiter::Awaitable VolkGpuWaiter::wait(VkFence fence) noexcept {
+  return Awaitable(*this, VK_NULL_HANDLE, 0, fence);
+}
+
+VkResult VolkGpuWaiter::poll(const Awaitable& awaitable) noexcept {
+  if (awaitable.fence_ != VK_NULL_HANDLE) {
+    return volk_.vkGetFenceStatus(device_, awaitable.fence_);
+  }
+  uint64_t value = 0;
+  auto const result = getSemaphoreCounterValue_(device_, awaitable.semaphore_, &value);
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+  return value >= awaitable.value_ ? VK_SUCCESS : VK_NOT_READY;
+}
+
+bool VolkGpuWaiter::add(Awaitable* awaitable) noexcept {
+  std::lock_guard lock(mutex_);
+  auto const deviceStatus = deviceStatus_.load(std::memory_order_relaxed);
+  if (stop_ || deviceStatus != VK_SUCCESS) {
+    awaitable->result_ = stop_ ? VK_NOT_READY : deviceStatus;
+    return false;
+  }
+  incoming_.push_back(awaitable);
+  wake();
+  return true;
+}
+
+void VolkGpuWaiter::wake() noexcept {
+  // Called with mutex_ locked: host signals must be strictly increasing.
+  VkSemaphoreSignalInfo signalInfo = {};
+  signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+  signalInfo.semaphore = wakeSemaphore_;
+  signalInfo.value = ++wakeValue_;
+  (void)signalSemaphore_(device_, &signalInfo);
+}
+
+void VolkGpuWaiter::fail(std::vector<Awaitable*>& waits, VkResult result) noexcept {
+  // Nothing is queued once deviceStatus_ is set, so the waits taken here are the last ones.
+  {
+    std::lock_guard lock(mutex_);
+    deviceStatus_.store(result, std::memory_order_release);
+    waits.insert(waits.end(), incoming_.begin(), incoming_.end());
+    incoming_.clear();
+  }
+  for (auto* awaitable : waits) {
+    if (awaitable) {
+      resume(awaitable, result);
+    }
+  }
+  waits.clear();
+}
+
+void VolkGpuWaiter::resume(Awaitable* awaitable, VkResult result) noexcept {
+  awaitable->result_ = result;
+  auto const handle = awaitable->handle_;
+  if (executor_) {
+    executor_(handle);
+  } else {
+    handle.resume();
+  }
+}
+
+void VolkGpuWaiter::run() noexcept {
+  std::vector<Awaitable*> waits;
+  std::vector<std::pair<VkSemaphore, uint64_t>> targets;
+  std::vector<VkSemaphore> semaphores;
+  std::vector<uint64_t> values;
+
+  for (;;) {
+    uint64_t wakeValue = 0;
+    (void)getSemaphoreCounterValue_(device_, wakeSemaphore_, &wakeValue);
+    bool stop = false;
+    {
+      std::lock_guard lock(mutex_);
+      waits.insert(waits.end(), incoming_.begin(), incoming_.end());
+      incoming_.clear();
+      stop = stop_;
+    }
+
+    // Resume completed waits; the pointers of resumed awaitables can't be touched afterwards.
+    bool fences = false;
+    bool lost = false;
+    targets.clear();
+    for (auto& awaitable : waits) {
+      auto const result = stop ? VK_NOT_READY : poll(*awaitable);
+      if (result == VK_ERROR_DEVICE_LOST) {
+        lost = true;
+        break;
+      }
+      if (stop || result != VK_NOT_READY) {
+        resume(std::exchange(awaitable, nullptr), result);
+        continue;
+      }
+      if (awaitable->fence_ != VK_NULL_HANDLE) {
+        fences = true;
+      } else {
+        targets.emplace_back(awaitable->semaphore_, awaitable->value_);
+      }
+    }
+    if (lost) {
+      fail(waits, VK_ERROR_DEVICE_LOST);
+      return;
+    }
+    waits.erase(std::remove(waits.begin(), waits.end(), nullptr), waits.end());
+    if (stop) {
+      return;
+    }
+
+    // One entry per semaphore, waiting for its smallest pending value.
+    std::sort(targets.begin(), targets.end());
+    semaphores.assign(1, wakeSemaphore_);
+    values.assign(1, wakeValue + 1);
+    for (size_t i = 0; i < targets.size(); ++i) {
+      if (i == 0 || targets[i].first != targets[i - 1].first) {
+        semaphores.push_back(targets[i].first);
+        values.push_back(targets[i].second);
+      }
+    }
+
+    VkSemaphoreWaitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.flags = VK_SEMAPHORE_WAIT_ANY_BIT;
+    waitInfo.semaphoreCount = static_cast<uint32_t>(semaphores.size());
+    waitInfo.pSemaphores = semaphores.data();
+    waitInfo.pValues = values.data();
+    auto const result = waitSemaphores_(device_, &waitInfo, fences ? kFencePollInterval : UINT64_MAX);
+    if (result != VK_SUCCESS && result != VK_TIMEOUT) {
+      // Device loss (or out of memory): every pending and later wait fails, and waiting again would only spin.
+      fail(waits, result);
+      return;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,107 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(VK_BASE_VERSION_1_2)
+
+/**
+ * co_await-able waits on timeline semaphores and fences of one device.
+ *
+ * A single waiter thread multiplexes all pending waits: it blocks in one vkWaitSemaphores call with
+ * VK_SEMAPHORE_WAIT_ANY_BIT on every awaited semaphore plus an internal wake semaphore, which is signaled from the host
+ * when a new wait is registered. Fences can't be waited on that way and are polled with vkGetFenceStatus every
+ * kFencePollInterval while any are pending.
+ *
+ * Resumed coroutines are handed to the executor, or resumed on the waiter thread if there is none. co_await returns
+ * VK_SUCCESS, the device error, or VK_NOT_READY if the waiter was destroyed first. Once the device is lost (or
+ * vkWaitSemaphores fails otherwise), every pending and later wait completes with that error without suspending, and
+ * the waiter thread exits.
+ *
+ *   VkResult result = co_await waiter.wait(timelineSemaphore, value);
+ */
+class VolkGpuWaiter final {
+public:
+  static constexpr uint64_t kFencePollInterval = 1000000; // ns
+
+  using Executor = std::function<void(std::coroutine_handle<>)>;
+
+  class Awaitable final {
+  public:
+    [[nodiscard]] bool await_ready() noexcept;
+    [[nodiscard]] bool await_suspend(std::coroutine_handle<> handle) noexcept;
+    [[nodiscard]] VkResult await_resume() const noexcept;
+
+  private:
+    friend class VolkGpuWaiter;
+
+    Awaitable(VolkGpuWaiter& waiter, VkSemaphore semaphore, uint64_t value, VkFence fence) noexcept;
+
+    VolkGpuWaiter& waiter_;
+    VkSemaphore semaphore_ = VK_NULL_HANDLE;
+    uint64_t value_ = 0;
+    VkFence fence_ = VK_NULL_HANDLE;
+    VkResult result_ = VK_NOT_READY;
+    std::coroutine_handle<> handle_;
+  };
+
+  /**
+   * Volk must have device function pointers loaded for the given device.
+   */
+  VolkGpuWaiter(Volk& volk, VkDevice device, Executor executor = {}) noexcept;
+  ~VolkGpuWaiter() noexcept;
+  VolkGpuWaiter(const VolkGpuWaiter&) = delete;
+  VolkGpuWaiter& operator=(const VolkGpuWaiter&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if timeline semaphores aren't available, or the error of the wake semaphore
+   * creation.
+   */
+  [[nodiscard]] VkResult getStatus() const noexcept;
+
+  /**
+   * Completes when the counter of timelineSemaphore reaches value.
+   */
+  [[nodiscard]] Awaitable wait(VkSemaphore timelineSemaphore, uint64_t value) noexcept;
+
+  /**
+   * Completes when fence is signaled.
+   */
+  [[nodiscard]] Awaitable wait(VkFence fence) noexcept;
+
+private:
+  // Returns VK_SUCCESS when complete, VK_NOT_READY when pending, or an error.
+  [[nodiscard]] VkResult poll(const Awaitable& awaitable) noexcept;
+  // Returns false, with the result of the awaitable set, if it completes without suspending.
+  [[nodiscard]] bool add(Awaitable* awaitable) noexcept;
+  void wake() noexcept;
+  void fail(std::vector<Awaitable*>& waits, VkResult result) noexcept;
+  void resume(Awaitable* awaitable, VkResult result) noexcept;
+  void run() noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  Executor executor_;
+  PFN_vkGetSemaphoreCounterValue getSemaphoreCounterValue_ = nullptr;
+  PFN_vkWaitSemaphores waitSemaphores_ = nullptr;
+  PFN_vkSignalSemaphore signalSemaphore_ = nullptr;
+  VkSemaphore wakeSemaphore_ = VK_NULL_HANDLE;
+  VkResult status_ = VK_SUCCESS;
+  std::atomic<VkResult> deviceStatus_ = VK_SUCCESS; // sticky error of a failed wait, e.g. VK_ERROR_DEVICE_LOST
+
+  std::mutex mutex_;
+  std::vector<Awaitable*> incoming_;
+  uint64_t wakeValue_ = 0;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+#endif
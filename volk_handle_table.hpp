@@ -0,0 +1,242 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+/**
+ * Fixed-capacity lock-free map from Vulkan handles to small trivially copyable values, used by volk-cpp helpers that
+ * track objects between their creation and destruction.
+ *
+ * Entries are keyed by the handle and a tag, such as the VkObjectType of the handle: non-dispatchable handles of
+ * different types may have the same value.
+ *
+ * Open addressing with linear probing; erased entries leave tombstones which are reused by later inserts. Once more
+ * than a quarter of the slots are tombstones, an erase which finds no other operation in flight rehashes the table in
+ * place; operations started meanwhile wait for it to finish. Inserting into a full table fails instead of growing. As
+ * with Vulkan itself, a handle must not be erased concurrently with other operations on the same handle.
+ */
+template <typename Value>
+class VolkHandleTable final {
+  static_assert(std::is_trivially_copyable_v<Value>, "VolkHandleTable values must be trivially copyable");
+
+public:
+  /**
+   * Capacity is rounded up to a power of two.
+   */
+  explicit VolkHandleTable(uint32_t capacity) noexcept
+    : mask_(std::bit_ceil(capacity < 2 ? 2U : capacity) - 1)
+    , slots_(new Slot[mask_ + 1]) {}
+  VolkHandleTable(const VolkHandleTable&) = delete;
+  VolkHandleTable& operator=(const VolkHandleTable&) = delete;
+
+  /**
+   * Returns false if the table is full.
+   */
+  template <typename Handle>
+  bool insert(Handle handle, Value const& value, uint32_t tag = 0) noexcept {
+    auto const key = toKey(handle);
+    Scope scope(*this);
+    for (uint64_t i = 0, index = hash(key, tag); i <= mask_; ++i, index = (index + 1) & mask_) {
+      auto& slot = slots_[index];
+      auto current = slot.key.load(std::memory_order_relaxed);
+      if ((current == kEmpty || current == kTombstone) &&
+          slot.key.compare_exchange_strong(current, kBusy, std::memory_order_acquire)) {
+        slot.tag.store(tag, std::memory_order_relaxed);
+        slot.value = value;
+        slot.key.store(key, std::memory_order_release);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        if (current == kTombstone) {
+          tombstones_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Removes the handle and returns its value; returns false if the handle isn't in the table.
+   */
+  template <typename Handle>
+  bool erase(Handle handle, Value* pValue = nullptr, uint32_t tag = 0) noexcept {
+    auto const key = toKey(handle);
+    bool rehash = false;
+    {
+      Scope scope(*this);
+      auto slot = findSlot(key, tag);
+      if (!slot) {
+        return false;
+      }
+      if (pValue) {
+        *pValue = slot->value;
+      }
+      auto expected = key;
+      if (!slot->key.compare_exchange_strong(expected, kTombstone, std::memory_order_acq_rel)) {
+        return false;
+      }
+      size_.fetch_sub(1, std::memory_order_relaxed);
+      rehash = tombstones_.fetch_add(1, std::memory_order_relaxed) + 1 > (mask_ + 1) / 4;
+    }
+    if (rehash) {
+      tryRehash();
+    }
+    return true;
+  }
+
+  template <typename Handle>
+  bool find(Handle handle, Value* pValue, uint32_t tag = 0) const noexcept {
+    Scope scope(*this);
+    auto slot = findSlot(toKey(handle), tag);
+    if (!slot) {
+      return false;
+    }
+    *pValue = slot->value;
+    return true;
+  }
+
+  /**
+   * Call function(handleKey, value) for every entry. Entries inserted or erased concurrently may be missed.
+   */
+  template <typename Function>
+  void forEach(Function&& function) const noexcept {
+    Scope scope(*this);
+    for (uint64_t i = 0; i <= mask_; ++i) {
+      auto const key = slots_[i].key.load(std::memory_order_acquire);
+      if (key != kEmpty && key != kTombstone && key != kBusy) {
+        function(key, slots_[i].value);
+      }
+    }
+  }
+
+  [[nodiscard]] uint32_t getSize() const noexcept {
+    return size_.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] uint32_t getCapacity() const noexcept {
+    return static_cast<uint32_t>(mask_ + 1);
+  }
+
+  [[nodiscard]] uint32_t getTombstoneCount() const noexcept {
+    return tombstones_.load(std::memory_order_relaxed);
+  }
+
+private:
+  // Null handles are never stored, so 0 can mark an empty slot; the other markers aren't valid handle values either.
+  static constexpr uint64_t kEmpty = 0;
+  static constexpr uint64_t kTombstone = ~0ULL;
+  static constexpr uint64_t kBusy = ~0ULL - 1;
+
+  // operations_ counts operations in flight; kRehashing is set while one erase rehashes the table.
+  static constexpr uint32_t kRehashing = 1U << 31;
+
+  struct Slot {
+    std::atomic<uint64_t> key = kEmpty;
+    std::atomic<uint32_t> tag = 0;
+    Value value = {};
+  };
+
+  template <typename Handle>
+  [[nodiscard]] static uint64_t toKey(Handle handle) noexcept {
+    if constexpr (std::is_pointer_v<Handle>) {
+      return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+    } else {
+      return static_cast<uint64_t>(handle);
+    }
+  }
+
+  [[nodiscard]] uint64_t hash(uint64_t key, uint32_t tag) const noexcept {
+    key ^= (uint64_t(tag) << 32 | tag) * 0x9e3779b97f4a7c15ULL;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return key & mask_;
+  }
+
+  class Scope final {
+  public:
+    explicit Scope(VolkHandleTable const& table) noexcept : operations_(table.operations_) {
+      auto current = operations_.load(std::memory_order_relaxed);
+      for (;;) {
+        if (current & kRehashing) {
+          std::this_thread::yield();
+          current = operations_.load(std::memory_order_relaxed);
+        } else if (operations_.compare_exchange_weak(current, current + 1, std::memory_order_acquire)) {
+          break;
+        }
+      }
+    }
+    ~Scope() noexcept {
+      operations_.fetch_sub(1, std::memory_order_release);
+    }
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    std::atomic<uint32_t>& operations_;
+  };
+
+  // Only starts if no other operation is in flight, so that the caller never waits; the next erase retries otherwise.
+  void tryRehash() noexcept {
+    uint32_t idle = 0;
+    if (!operations_.compare_exchange_strong(idle, kRehashing, std::memory_order_acquire)) {
+      return;
+    }
+
+    for (uint64_t i = 0; i <= mask_; ++i) {
+      if (slots_[i].key.load(std::memory_order_relaxed) == kTombstone) {
+        slots_[i].key.store(kEmpty, std::memory_order_relaxed);
+      }
+    }
+
+    // Removing tombstones may cut the probe sequence of an entry placed past them; move every such entry back to the
+    // first empty slot of its sequence. Each move shortens a probe sequence, so this terminates.
+    for (bool moved = true; moved;) {
+      moved = false;
+      for (uint64_t i = 0; i <= mask_; ++i) {
+        auto const key = slots_[i].key.load(std::memory_order_relaxed);
+        if (key == kEmpty) {
+          continue;
+        }
+        auto const tag = slots_[i].tag.load(std::memory_order_relaxed);
+        auto index = hash(key, tag);
+        while (index != i && slots_[index].key.load(std::memory_order_relaxed) != kEmpty) {
+          index = (index + 1) & mask_;
+        }
+        if (index != i) {
+          slots_[index].tag.store(tag, std::memory_order_relaxed);
+          slots_[index].value = slots_[i].value;
+          slots_[index].key.store(key, std::memory_order_relaxed);
+          slots_[i].key.store(kEmpty, std::memory_order_relaxed);
+          moved = true;
+        }
+      }
+    }
+
+    tombstones_.store(0, std::memory_order_relaxed);
+    operations_.store(0, std::memory_order_release);
+  }
+
+  [[nodiscard]] Slot* findSlot(uint64_t key, uint32_t tag) const noexcept {
+    for (uint64_t i = 0, index = hash(key, tag); i <= mask_; ++i, index = (index + 1) & mask_) {
+      auto const current = slots_[index].key.load(std::memory_order_acquire);
+      if (current == key && slots_[index].tag.load(std::memory_order_relaxed) == tag) {
+        return &slots_[index];
+      }
+      if (current == kEmpty) {
+        return nullptr;
+      }
+    }
+    return nullptr;
+  }
+
+  uint64_t mask_ = 0;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint32_t> size_ = 0;
+  std::atomic<uint32_t> tombstones_ = 0;
+  mutable std::atomic<uint32_t> operations_ = 0;
+};
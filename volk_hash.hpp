@@ -0,0 +1,62 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Small non-cryptographic 64-bit hasher used by volk-cpp caches to build stable keys.
+ *
+ * The result only depends on the hashed bytes, so keys are stable between runs and can be stored on disk.
+ */
+class VolkHasher final {
+public:
+  VolkHasher& add(void const* data, size_t size) noexcept {
+    auto bytes = static_cast<uint8_t const*>(data);
+    while (size >= sizeof(uint64_t)) {
+      uint64_t word;
+      memcpy(&word, bytes, sizeof(word));
+      mix(word);
+      bytes += sizeof(uint64_t);
+      size -= sizeof(uint64_t);
+    }
+    if (size > 0) {
+      uint64_t word = 0;
+      memcpy(&word, bytes, size);
+      mix(word ^ (uint64_t(size) << 56));
+    }
+    return *this;
+  }
+
+  VolkHasher& add(char const* str) noexcept {
+    return str ? add(str, strlen(str) + 1) : add(uint64_t(0));
+  }
+
+  template <typename T>
+  VolkHasher& add(T const& value) noexcept {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "use add(data, size) for aggregates");
+    uint64_t word = 0;
+    memcpy(&word, &value, sizeof(T));
+    mix(word);
+    return *this;
+  }
+
+  [[nodiscard]] uint64_t get() const noexcept {
+    uint64_t h = hash_;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+private:
+  void mix(uint64_t word) noexcept {
+    hash_ = (hash_ ^ word) * 0x100000001b3ULL;
+    hash_ ^= hash_ >> 29;
+  }
+
+  uint64_t hash_ = 0xcbf29ce484222325ULL;
+};
@@ -0,0 +1,232 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_host_allocator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace {
+
+constexpr size_t kMinBlockSize = 32;
+constexpr size_t kChunkSize = 64 * 1024;
+constexpr size_t kPoolAlignment = 16;
+
+void updatePeak(std::atomic<uint64_t>& peak, uint64_t value) noexcept {
+  auto current = peak.load(std::memory_order_relaxed);
+  while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+} // namespace
+
+VolkHostAllocator::VolkHostAllocator(Volk& volk, uint32_t pooledScopes /* = 0 */) noexcept
+  : volk_(volk)
+  , pooledScopes_(pooledScopes) {
+  callbacks_.pUserData = this;
+  callbacks_.pfnAllocation = &VolkHostAllocator::allocationFunction;
+  callbacks_.pfnReallocation = &VolkHostAllocator::reallocationFunction;
+  callbacks_.pfnFree = &VolkHostAllocator::freeFunction;
+  callbacks_.pfnInternalAllocation = &VolkHostAllocator::internalAllocationNotification;
+  callbacks_.pfnInternalFree = &VolkHostAllocator::internalFreeNotification;
+}
+
+VolkHostAllocator::~VolkHostAllocator() noexcept {
+  for (auto& shard : shards_) {
+    for (auto chunk : shard.chunks) {
+      ::operator delete(chunk, std::align_val_t(kPoolAlignment));
+    }
+  }
+}
+
+const VkAllocationCallbacks* VolkHostAllocator::getAllocationCallbacks() const noexcept {
+  return &callbacks_;
+}
+
+VolkHostAllocator::ScopeStats VolkHostAllocator::getStats(VkSystemAllocationScope scope) const noexcept {
+  ScopeStats stats;
+  if (static_cast<uint32_t>(scope) >= kScopeCount) {
+    return stats;
+  }
+  auto const& counters = scopes_[scope];
+  stats.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+  stats.reallocationCount = counters.reallocationCount.load(std::memory_order_relaxed);
+  stats.freeCount = counters.freeCount.load(std::memory_order_relaxed);
+  stats.pooledCount = counters.pooledCount.load(std::memory_order_relaxed);
+  stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+  stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+  stats.internalLiveBytes = counters.internalLiveBytes.load(std::memory_order_relaxed);
+  for (uint32_t i = 0; i < kSizeBuckets; ++i) {
+    stats.sizeHistogram[i] = counters.sizeHistogram[i].load(std::memory_order_relaxed);
+  }
+  return stats;
+}
+
+VkResult VolkHostAllocator::vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo,
+                                             const VkAllocationCallbacks* pAllocator,
+                                             VkInstance* pInstance) noexcept {
+  return volk_.vkCreateInstance(pCreateInfo, select(pAllocator), pInstance);
+}
+
+void VolkHostAllocator::vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) noexcept {
+  volk_.vkDestroyInstance(instance, select(pAllocator));
+}
+
+VkResult VolkHostAllocator::vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo,
+                                           const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) noexcept {
+  return volk_.vkCreateDevice(physicalDevice, pCreateInfo, select(pAllocator), pDevice);
+}
+
+void VolkHostAllocator::vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) noexcept {
+  volk_.vkDestroyDevice(device, select(pAllocator));
+}
+
+void* VolkHostAllocator::allocationFunction(void* pUserData, size_t size, size_t alignment,
+                                            VkSystemAllocationScope allocationScope) {
+  return static_cast<VolkHostAllocator*>(pUserData)->allocate(size, alignment, allocationScope);
+}
+
+void* VolkHostAllocator::reallocationFunction(void* pUserData, void* pOriginal, size_t size, size_t alignment,
+                                              VkSystemAllocationScope allocationScope) {
+  auto self = static_cast<VolkHostAllocator*>(pUserData);
+  if (!pOriginal) {
+    return self->allocate(size, alignment, allocationScope);
+  }
+  if (size == 0) {
+    self->release(pOriginal);
+    return nullptr;
+  }
+
+  // The original scope is kept for accounting; the new block may come from a different pool or the system heap.
+  auto const original = static_cast<Header*>(pOriginal) - 1;
+  auto const scope = static_cast<VkSystemAllocationScope>(original->scope);
+  auto result = self->allocate(size, alignment, scope);
+  if (!result) {
+    return nullptr;
+  }
+  memcpy(result, pOriginal, std::min<size_t>(size, original->size));
+  self->release(pOriginal);
+  self->scopes_[scope].reallocationCount.fetch_add(1, std::memory_order_relaxed);
+  return result;
+}
+
+void VolkHostAllocator::freeFunction(void* pUserData, void* pMemory) {
+  if (pMemory) {
+    static_cast<VolkHostAllocator*>(pUserData)->release(pMemory);
+  }
+}
+
+void VolkHostAllocator::internalAllocationNotification(void* pUserData, size_t size,
+                                                       VkInternalAllocationType allocationType,
+                                                       VkSystemAllocationScope allocationScope) {
+  (void)allocationType;
+  if (static_cast<uint32_t>(allocationScope) < kScopeCount) {
+    static_cast<VolkHostAllocator*>(pUserData)->scopes_[allocationScope].internalLiveBytes.fetch_add(
+      size, std::memory_order_relaxed);
+  }
+}
+
+void VolkHostAllocator::internalFreeNotification(void* pUserData, size_t size, VkInternalAllocationType allocationType,
+                                                 VkSystemAllocationScope allocationScope) {
+  (void)allocationType;
+  if (static_cast<uint32_t>(allocationScope) < kScopeCount) {
+    static_cast<VolkHostAllocator*>(pUserData)->scopes_[allocationScope].internalLiveBytes.fetch_sub(
+      size, std::memory_order_relaxed);
+  }
+}
+
+void* VolkHostAllocator::allocate(size_t size, size_t alignment, VkSystemAllocationScope scope) noexcept {
+  auto const scopeIndex = std::min<uint32_t>(static_cast<uint32_t>(scope), kScopeCount - 1);
+  alignment = std::max(alignment, alignof(Header));
+
+  uint8_t* pointer = nullptr;
+  uint32_t offset = sizeof(Header);
+  uint32_t sizeClass = kSizeClassCount;
+  uint32_t shard = 0;
+  auto const blockSize = std::bit_ceil(std::max(size + sizeof(Header), kMinBlockSize));
+  if ((pooledScopes_ & (1U << scopeIndex)) != 0 && alignment <= kPoolAlignment &&
+      blockSize <= (kMinBlockSize << (kSizeClassCount - 1))) {
+    sizeClass = static_cast<uint32_t>(std::countr_zero(blockSize / kMinBlockSize));
+    pointer = static_cast<uint8_t*>(allocateFromPool(sizeClass, shard));
+  }
+
+  if (!pointer) {
+    sizeClass = kSizeClassCount;
+    auto const raw = static_cast<uint8_t*>(std::malloc(size + sizeof(Header) + alignment));
+    if (!raw) {
+      return nullptr;
+    }
+    auto const address = reinterpret_cast<uintptr_t>(raw) + sizeof(Header);
+    offset = static_cast<uint32_t>(((address + alignment - 1) & ~(uintptr_t(alignment) - 1)) -
+                                   reinterpret_cast<uintptr_t>(raw));
+    pointer = raw;
+  }
+
+  auto const result = pointer + offset;
+  auto header = reinterpret_cast<Header*>(result) - 1;
+  header->size = size;
+  header->offset = offset;
+  header->sizeClass = static_cast<uint8_t>(sizeClass);
+  header->scope = static_cast<uint8_t>(scopeIndex);
+  header->shard = static_cast<uint8_t>(shard);
+  header->reserved = 0;
+
+  auto& counters = scopes_[scopeIndex];
+  counters.allocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (sizeClass < kSizeClassCount) {
+    counters.pooledCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  auto const bucket = std::min<uint32_t>(static_cast<uint32_t>(std::bit_width(size > 0 ? size - 1 : 0)),
+                                         kSizeBuckets - 1);
+  counters.sizeHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+  updatePeak(counters.peakBytes, counters.liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+  return result;
+}
+
+void VolkHostAllocator::release(void* pMemory) noexcept {
+  auto const header = static_cast<Header*>(pMemory) - 1;
+  auto& counters = scopes_[header->scope];
+  counters.freeCount.fetch_add(1, std::memory_order_relaxed);
+  counters.liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+
+  auto const block = static_cast<uint8_t*>(pMemory) - header->offset;
+  if (header->sizeClass >= kSizeClassCount) {
+    std::free(block);
+    return;
+  }
+
+  auto& shard = shards_[header->shard];
+  auto const sizeClass = header->sizeClass;
+  std::lock_guard lock(shard.mutex);
+  *reinterpret_cast<void**>(block) = shard.freeLists[sizeClass];
+  shard.freeLists[sizeClass] = block;
+}
+
+void* VolkHostAllocator::allocateFromPool(uint32_t sizeClass, uint32_t& shardIndex) noexcept {
+  shardIndex = slots_.acquire();
+  auto& shard = shards_[shardIndex];
+  std::lock_guard lock(shard.mutex);
+  auto& freeList = shard.freeLists[sizeClass];
+  if (!freeList) {
+    auto chunk = static_cast<uint8_t*>(::operator new(kChunkSize, std::align_val_t(kPoolAlignment), std::nothrow));
+    if (!chunk) {
+      return nullptr;
+    }
+    shard.chunks.push_back(chunk);
+    auto const blockSize = kMinBlockSize << sizeClass;
+    for (size_t offset = kChunkSize; offset >= blockSize; offset -= blockSize) {
+      auto block = chunk + offset - blockSize;
+      *reinterpret_cast<void**>(block) = freeList;
+      freeList = block;
+    }
+  }
+
+  auto block = freeList;
+  freeList = *reinterpret_cast<void**>(block);
+  return block;
+}
+
+const VkAllocationCallbacks* VolkHostAllocator::select(const VkAllocationCallbacks* pAllocator) const noexcept {
+  return pAllocator ? pAllocator : &callbacks_;
+}
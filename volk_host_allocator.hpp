@@ -0,0 +1,116 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_thread_slots.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * Instrumented VkAllocationCallbacks provider.
+ *
+ * Counts host allocations made by the driver per VkSystemAllocationScope (live and peak bytes, log2 size histogram,
+ * internal allocation notifications) and optionally serves small allocations of chosen scopes from size-class pools.
+ * Pools are sharded per thread, so threads recording in parallel don't contend on one heap lock; blocks are returned
+ * to the shard they came from. The shard of a thread which exits is handed, with its free blocks, to the next thread
+ * which needs one.
+ *
+ * vkCreateInstance/vkCreateDevice and the matching destroy functions of this class forward to Volk and pass
+ * getAllocationCallbacks() when no allocator is given. The allocator must outlive every object created with it.
+ */
+class VolkHostAllocator final {
+public:
+  static constexpr uint32_t kScopeCount = 5;     // VK_SYSTEM_ALLOCATION_SCOPE_COMMAND..INSTANCE
+  static constexpr uint32_t kSizeBuckets = 40;   // bucket i counts sizes in (2^(i-1), 2^i]
+  static constexpr uint32_t kSizeClassCount = 7; // pooled block sizes 32..2048 bytes including the block header
+  static constexpr uint32_t kMaxThreads = 16;
+
+  struct ScopeStats {
+    uint64_t allocationCount = 0;
+    uint64_t reallocationCount = 0;
+    uint64_t freeCount = 0;
+    uint64_t pooledCount = 0; // allocations served from the size-class pools
+    uint64_t liveBytes = 0;
+    uint64_t peakBytes = 0;
+    uint64_t internalLiveBytes = 0; // reported through internal allocation notifications
+    uint64_t sizeHistogram[kSizeBuckets] = {};
+  };
+
+  /**
+   * pooledScopes is a mask of (1 << VkSystemAllocationScope) bits whose small allocations are served from pools,
+   * e.g. COMMAND and OBJECT scope allocations which are made and released at a high rate.
+   */
+  explicit VolkHostAllocator(Volk& volk, uint32_t pooledScopes = 0) noexcept;
+  ~VolkHostAllocator() noexcept;
+  VolkHostAllocator(const VolkHostAllocator&) = delete;
+  VolkHostAllocator& operator=(const VolkHostAllocator&) = delete;
+
+  [[nodiscard]] const VkAllocationCallbacks* getAllocationCallbacks() const noexcept;
+
+  [[nodiscard]] ScopeStats getStats(VkSystemAllocationScope scope) const noexcept;
+
+  VkResult vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
+                            VkInstance* pInstance) noexcept;
+  void vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) noexcept;
+  VkResult vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo,
+                          const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) noexcept;
+  void vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) noexcept;
+
+private:
+  // Precedes every returned pointer.
+  struct alignas(16) Header {
+    uint64_t size;
+    uint32_t offset;    // from the start of the underlying block to the returned pointer
+    uint8_t sizeClass;  // kSizeClassCount for blocks allocated from the system heap
+    uint8_t scope;
+    uint8_t shard;
+    uint8_t reserved;
+  };
+  static_assert(sizeof(Header) == 16);
+
+  struct ScopeCounters {
+    std::atomic<uint64_t> allocationCount = 0;
+    std::atomic<uint64_t> reallocationCount = 0;
+    std::atomic<uint64_t> freeCount = 0;
+    std::atomic<uint64_t> pooledCount = 0;
+    std::atomic<uint64_t> liveBytes = 0;
+    std::atomic<uint64_t> peakBytes = 0;
+    std::atomic<uint64_t> internalLiveBytes = 0;
+    std::atomic<uint64_t> sizeHistogram[kSizeBuckets] = {};
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    void* freeLists[kSizeClassCount] = {};
+    std::vector<void*> chunks;
+  };
+
+  static void* VKAPI_PTR allocationFunction(void* pUserData, size_t size, size_t alignment,
+                                            VkSystemAllocationScope allocationScope);
+  static void* VKAPI_PTR reallocationFunction(void* pUserData, void* pOriginal, size_t size, size_t alignment,
+                                              VkSystemAllocationScope allocationScope);
+  static void VKAPI_PTR freeFunction(void* pUserData, void* pMemory);
+  static void VKAPI_PTR internalAllocationNotification(void* pUserData, size_t size,
+                                                       VkInternalAllocationType allocationType,
+                                                       VkSystemAllocationScope allocationScope);
+  static void VKAPI_PTR internalFreeNotification(void* pUserData, size_t size, VkInternalAllocationType allocationType,
+                                                 VkSystemAllocationScope allocationScope);
+
+  [[nodiscard]] void* allocate(size_t size, size_t alignment, VkSystemAllocationScope scope) noexcept;
+  void release(void* pMemory) noexcept;
+  [[nodiscard]] void* allocateFromPool(uint32_t sizeClass, uint32_t& shard) noexcept;
+  [[nodiscard]] const VkAllocationCallbacks* select(const VkAllocationCallbacks* pAllocator) const noexcept;
+
+  Volk& volk_;
+  uint32_t pooledScopes_ = 0;
+  VkAllocationCallbacks callbacks_ = {};
+  ScopeCounters scopes_[kScopeCount];
+  Shard shards_[kMaxThreads];
+
+  // Declared last so that exiting threads stop releasing slots before the shards are destroyed.
+  VolkThreadSlots<kMaxThreads> slots_;
+};
@@ -0,0 +1,166 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_image_uploader.hpp"
+
+#if defined(VK_BASE_VERSION_1_4)
+
+#include <algorithm>
+
+namespace {
+
+bool isSameRange(const VkImageSubresourceRange& lhs, const VkImageSubresourceRange& rhs) noexcept {
+  return lhs.aspectMask == rhs.aspectMask && lhs.baseMipLevel == rhs.baseMipLevel &&
+         lhs.levelCount == rhs.levelCount && lhs.baseArrayLayer == rhs.baseArrayLayer &&
+         lhs.layerCount == rhs.layerCount;
+}
+
+} // namespace
+
+VolkImageUploader::VolkImageUploader(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device,
+                                     VolkUploadQueue& stagedQueue, bool enableHostCopy /* = true */) noexcept
+  : volk_(volk)
+  , physicalDevice_(physicalDevice)
+  , device_(device)
+  , stagedQueue_(stagedQueue)
+  , copyMemoryToImage_(volk.vkCopyMemoryToImage)
+  , transitionImageLayout_(volk.vkTransitionImageLayout) {
+#if defined(VK_EXT_host_image_copy)
+  if (!copyMemoryToImage_ || !transitionImageLayout_) {
+    copyMemoryToImage_ = volk.vkCopyMemoryToImageEXT;
+    transitionImageLayout_ = volk.vkTransitionImageLayoutEXT;
+  }
+#endif
+  if (!enableHostCopy || !copyMemoryToImage_ || !transitionImageLayout_ || !volk.vkGetPhysicalDeviceProperties2 ||
+      !volk.vkGetPhysicalDeviceFormatProperties2) {
+    copyMemoryToImage_ = nullptr;
+    transitionImageLayout_ = nullptr;
+    return;
+  }
+
+  VkPhysicalDeviceHostImageCopyProperties hostImageCopyProperties = {};
+  hostImageCopyProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES;
+  VkPhysicalDeviceProperties2 properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties.pNext = &hostImageCopyProperties;
+  volk_.vkGetPhysicalDeviceProperties2(physicalDevice_, &properties);
+  dstLayouts_.resize(hostImageCopyProperties.copyDstLayoutCount);
+  hostImageCopyProperties.pCopyDstLayouts = dstLayouts_.data();
+  volk_.vkGetPhysicalDeviceProperties2(physicalDevice_, &properties);
+  dstLayouts_.resize(hostImageCopyProperties.copyDstLayoutCount);
+}
+
+VkResult VolkImageUploader::getStatus() noexcept {
+  return stagedQueue_.getStatus();
+}
+
+bool VolkImageUploader::isHostCopyAvailable() const noexcept {
+  return copyMemoryToImage_ != nullptr && !dstLayouts_.empty();
+}
+
+VolkImageUploader::Stats VolkImageUploader::getStats() noexcept {
+  std::lock_guard lock(mutex_);
+  return stats_;
+}
+
+bool VolkImageUploader::supportsHostCopy(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
+                                         VkImageLayout finalLayout) noexcept {
+  if (!isHostCopyAvailable() || !(usage & VK_IMAGE_USAGE_HOST_TRANSFER_BIT) ||
+      std::find(dstLayouts_.begin(), dstLayouts_.end(), finalLayout) == dstLayouts_.end()) {
+    return false;
+  }
+
+  auto const key = (static_cast<uint64_t>(format) << 32) | static_cast<uint32_t>(tiling);
+  std::lock_guard lock(mutex_);
+  auto it = formatFeatures_.find(key);
+  if (it == formatFeatures_.end()) {
+    VkFormatProperties3 formatProperties3 = {};
+    formatProperties3.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3;
+    VkFormatProperties2 formatProperties = {};
+    formatProperties.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
+    formatProperties.pNext = &formatProperties3;
+    volk_.vkGetPhysicalDeviceFormatProperties2(physicalDevice_, format, &formatProperties);
+    auto const features = tiling == VK_IMAGE_TILING_LINEAR ? formatProperties3.linearTilingFeatures
+                                                            : formatProperties3.optimalTilingFeatures;
+    it = formatFeatures_.emplace(key, features).first;
+  }
+  return (it->second & VK_FORMAT_FEATURE_2_HOST_IMAGE_TRANSFER_BIT) != 0;
+}
+
+VkResult VolkImageUploader::upload(VkImage dstImage, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
+                                   VkImageLayout finalLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions,
+                                   const void* pData, VkDeviceSize size, uint64_t* pValue) noexcept {
+  if (supportsHostCopy(format, tiling, usage, finalLayout)) {
+    auto const result = copyOnHost(dstImage, finalLayout, regionCount, pRegions, pData);
+    if (result == VK_SUCCESS) {
+      std::lock_guard lock(mutex_);
+      ++stats_.hostUploads;
+      stats_.hostBytes += size;
+      *pValue = 0;
+    }
+    return result;
+  }
+
+  auto const value = stagedQueue_.uploadImage(dstImage, finalLayout, regionCount, pRegions, pData, size);
+  if (value == 0) {
+    auto const result = stagedQueue_.getStatus();
+    return result != VK_SUCCESS ? result : VK_ERROR_OUT_OF_DEVICE_MEMORY;
+  }
+  std::lock_guard lock(mutex_);
+  ++stats_.stagedUploads;
+  stats_.stagedBytes += size;
+  *pValue = value;
+  return VK_SUCCESS;
+}
+
+VkResult VolkImageUploader::copyOnHost(VkImage dstImage, VkImageLayout finalLayout, uint32_t regionCount,
+                                       const VkBufferImageCopy* pRegions, const void* pData) noexcept {
+  if (regionCount == 0) {
+    return VK_SUCCESS;
+  }
+
+  // The image is written in its final layout, so a transition from UNDEFINED is the only one needed. Transitions
+  // cover the subresources of each region rather than their bounding range, which would also discard mips and layers
+  // the upload doesn't write; regions which only differ in their offset or extent share a transition.
+  std::vector<VkMemoryToImageCopy> regions(regionCount);
+  std::vector<VkHostImageLayoutTransitionInfo> transitions;
+  for (uint32_t i = 0; i < regionCount; ++i) {
+    auto const& region = pRegions[i];
+    auto& copy = regions[i];
+    copy.sType = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY;
+    copy.pHostPointer = static_cast<const uint8_t*>(pData) + region.bufferOffset;
+    copy.memoryRowLength = region.bufferRowLength;
+    copy.memoryImageHeight = region.bufferImageHeight;
+    copy.imageSubresource = region.imageSubresource;
+    copy.imageOffset = region.imageOffset;
+    copy.imageExtent = region.imageExtent;
+
+    auto const& subresource = region.imageSubresource;
+    VkHostImageLayoutTransitionInfo transition = {};
+    transition.sType = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO;
+    transition.image = dstImage;
+    transition.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    transition.newLayout = finalLayout;
+    transition.subresourceRange = {subresource.aspectMask, subresource.mipLevel, 1, subresource.baseArrayLayer,
+                                   subresource.layerCount};
+    auto const sameRange = [&transition](const VkHostImageLayoutTransitionInfo& other) {
+      return isSameRange(other.subresourceRange, transition.subresourceRange);
+    };
+    if (std::none_of(transitions.begin(), transitions.end(), sameRange)) {
+      transitions.push_back(transition);
+    }
+  }
+
+  auto result = transitionImageLayout_(device_, static_cast<uint32_t>(transitions.size()), transitions.data());
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+
+  VkCopyMemoryToImageInfo copyInfo = {};
+  copyInfo.sType = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO;
+  copyInfo.dstImage = dstImage;
+  copyInfo.dstImageLayout = finalLayout;
+  copyInfo.regionCount = regionCount;
+  copyInfo.pRegions = regions.data();
+  return copyMemoryToImage_(device_, &copyInfo);
+}
+
+#endif
@@ -0,0 +1,83 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_upload_queue.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(VK_BASE_VERSION_1_4)
+
+/**
+ * Texture uploads through host image copy (Vulkan 1.4 or VK_EXT_host_image_copy), falling back to a VolkUploadQueue.
+ *
+ * When the image was created with VK_IMAGE_USAGE_HOST_TRANSFER_BIT, its format supports
+ * VK_FORMAT_FEATURE_2_HOST_IMAGE_TRANSFER_BIT for the tiling it uses, and the final layout is a host copy destination
+ * layout of the device, the pixels are written by the CPU with vkCopyMemoryToImage, with no staging buffer and no
+ * queue submission. Otherwise the upload goes through the staged queue.
+ *
+ * Host copies are complete when upload() returns; the image may be used by any queue without an ownership transfer.
+ * The hostImageCopy feature must be enabled on the device for the host path to be taken.
+ */
+class VolkImageUploader final {
+public:
+  struct Stats {
+    uint64_t hostUploads = 0;
+    uint64_t hostBytes = 0;
+    uint64_t stagedUploads = 0;
+    uint64_t stagedBytes = 0;
+  };
+
+  /**
+   * Volk must have device function pointers loaded for the given device. The host path is disabled if
+   * enableHostCopy is false, e.g. when the hostImageCopy feature wasn't enabled.
+   */
+  VolkImageUploader(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device, VolkUploadQueue& stagedQueue,
+                    bool enableHostCopy = true) noexcept;
+  VolkImageUploader(const VolkImageUploader&) = delete;
+  VolkImageUploader& operator=(const VolkImageUploader&) = delete;
+
+  /**
+   * Returns the status of the staged queue; the uploader itself works without host image copy.
+   */
+  [[nodiscard]] VkResult getStatus() noexcept;
+  [[nodiscard]] bool isHostCopyAvailable() const noexcept;
+  [[nodiscard]] Stats getStats() noexcept;
+
+  /**
+   * Returns true if an image with the given format, tiling and usage can be uploaded into finalLayout by the host.
+   */
+  [[nodiscard]] bool supportsHostCopy(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
+                                      VkImageLayout finalLayout) noexcept;
+
+  /**
+   * Upload regions of dstImage, which ends up in finalLayout; the previous contents of the regions' subresources are
+   * discarded. Region buffer offsets are relative to pData. format, tiling and usage are those dstImage was created
+   * with. On success *pValue is 0 if the image was written by the host, or the staged queue's semaphore value which
+   * signals completion.
+   */
+  [[nodiscard]] VkResult upload(VkImage dstImage, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
+                                VkImageLayout finalLayout, uint32_t regionCount, const VkBufferImageCopy* pRegions,
+                                const void* pData, VkDeviceSize size, uint64_t* pValue) noexcept;
+
+private:
+  [[nodiscard]] VkResult copyOnHost(VkImage dstImage, VkImageLayout finalLayout, uint32_t regionCount,
+                                    const VkBufferImageCopy* pRegions, const void* pData) noexcept;
+
+  Volk& volk_;
+  VkPhysicalDevice physicalDevice_ = VK_NULL_HANDLE;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VolkUploadQueue& stagedQueue_;
+  PFN_vkCopyMemoryToImage copyMemoryToImage_ = nullptr;
+  PFN_vkTransitionImageLayout transitionImageLayout_ = nullptr;
+  std::vector<VkImageLayout> dstLayouts_;
+
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, VkFormatFeatureFlags2> formatFeatures_; // by format and tiling
+  Stats stats_;
+};
+
+#endif
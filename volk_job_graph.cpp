@@ -0,0 +1,304 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_job_graph.hpp"
+
+#if defined(VK_BASE_VERSION_1_3)
+
+#include <algorithm>
+
+VolkJobGraph::VolkJobGraph(Volk& volk, VkDevice device, VolkThreadPool& pool) noexcept
+  : volk_(volk)
+  , device_(device)
+  , pool_(pool)
+  , queueSubmit2_(volk.vkQueueSubmit2)
+  , getSemaphoreCounterValue_(volk.vkGetSemaphoreCounterValue)
+  , waitSemaphores_(volk.vkWaitSemaphores)
+  , signalSemaphore_(volk.vkSignalSemaphore) {
+#if defined(VK_KHR_synchronization2)
+  if (!queueSubmit2_) {
+    queueSubmit2_ = volk.vkQueueSubmit2KHR;
+  }
+#endif
+#if defined(VK_KHR_timeline_semaphore)
+  if (!getSemaphoreCounterValue_ || !waitSemaphores_ || !signalSemaphore_) {
+    getSemaphoreCounterValue_ = volk.vkGetSemaphoreCounterValueKHR;
+    waitSemaphores_ = volk.vkWaitSemaphoresKHR;
+    signalSemaphore_ = volk.vkSignalSemaphoreKHR;
+  }
+#endif
+  if (!queueSubmit2_ || !getSemaphoreCounterValue_ || !waitSemaphores_ || !signalSemaphore_) {
+    status_ = VK_ERROR_EXTENSION_NOT_PRESENT;
+    return;
+  }
+  status_ = createSemaphore(&wakeSemaphore_);
+}
+
+VolkJobGraph::~VolkJobGraph() noexcept {
+  for (auto const& queue : queues_) {
+    volk_.vkDestroySemaphore(device_, queue.semaphore, nullptr);
+  }
+  if (wakeSemaphore_ != VK_NULL_HANDLE) {
+    volk_.vkDestroySemaphore(device_, wakeSemaphore_, nullptr);
+  }
+}
+
+VkResult VolkJobGraph::getStatus() const noexcept {
+  return status_;
+}
+
+VkResult VolkJobGraph::createSemaphore(VkSemaphore* pSemaphore) noexcept {
+  VkSemaphoreTypeCreateInfo typeCreateInfo = {};
+  typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+  typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+  VkSemaphoreCreateInfo createInfo = {};
+  createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  createInfo.pNext = &typeCreateInfo;
+  return volk_.vkCreateSemaphore(device_, &createInfo, nullptr, pSemaphore);
+}
+
+uint32_t VolkJobGraph::addNode(Node&& node, uint32_t dependencyCount, const uint32_t* pDependencies) noexcept {
+  auto const index = static_cast<uint32_t>(nodes_.size());
+  node.dependencies.assign(pDependencies, pDependencies + dependencyCount);
+  std::sort(node.dependencies.begin(), node.dependencies.end());
+  node.dependencies.erase(std::unique(node.dependencies.begin(), node.dependencies.end()), node.dependencies.end());
+  if (!node.dependencies.empty() && node.dependencies.back() >= index) {
+    return kInvalidNode;
+  }
+  for (auto dependency : node.dependencies) {
+    nodes_[dependency].dependents.push_back(index);
+  }
+  nodes_.push_back(std::move(node));
+  return index;
+}
+
+uint32_t VolkJobGraph::addCpuNode(std::function<void()> task, uint32_t dependencyCount /* = 0 */,
+                                  const uint32_t* pDependencies /* = nullptr */) noexcept {
+  Node node;
+  node.task = std::move(task);
+  return addNode(std::move(node), dependencyCount, pDependencies);
+}
+
+uint32_t VolkJobGraph::addGpuNode(VkQueue queue, uint32_t commandBufferInfoCount,
+                                  const VkCommandBufferSubmitInfo* pCommandBufferInfos,
+                                  uint32_t dependencyCount /* = 0 */,
+                                  const uint32_t* pDependencies /* = nullptr */) noexcept {
+  if (status_ != VK_SUCCESS) {
+    return kInvalidNode;
+  }
+
+  Node node;
+  auto it = std::find_if(queues_.begin(), queues_.end(), [queue](const Queue& q) { return q.queue == queue; });
+  if (it == queues_.end()) {
+    Queue newQueue;
+    newQueue.queue = queue;
+    if (createSemaphore(&newQueue.semaphore) != VK_SUCCESS) {
+      return kInvalidNode;
+    }
+    queues_.push_back(std::move(newQueue));
+    it = queues_.end() - 1;
+  }
+  node.queue = static_cast<uint32_t>(it - queues_.begin());
+  node.commandBufferInfos.assign(pCommandBufferInfos, pCommandBufferInfos + commandBufferInfoCount);
+  return addNode(std::move(node), dependencyCount, pDependencies);
+}
+
+void VolkJobGraph::reset() noexcept {
+  nodes_.clear();
+}
+
+VkSemaphoreSubmitInfo VolkJobGraph::getSignal(uint32_t node) const noexcept {
+  VkSemaphoreSubmitInfo signal = {};
+  signal.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+  if (node < nodes_.size() && nodes_[node].queue != kInvalidNode) {
+    signal.semaphore = queues_[nodes_[node].queue].semaphore;
+    signal.value = nodes_[node].value;
+    signal.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+  }
+  return signal;
+}
+
+void VolkJobGraph::unblock(uint32_t node, bool gpuSubmitted) noexcept {
+  // A CPU node unblocks all its dependents when it finishes. A GPU node unblocks its GPU dependents when it is
+  // submitted and its CPU dependents when its semaphore value is reached.
+  bool const gpuProducer = nodes_[node].queue != kInvalidNode;
+  for (auto index : nodes_[node].dependents) {
+    auto& dependent = nodes_[index];
+    bool const gpuConsumer = dependent.queue != kInvalidNode;
+    if (gpuProducer && gpuConsumer != gpuSubmitted) {
+      continue;
+    }
+    if (--dependent.blockers == 0) {
+      (gpuConsumer ? readyGpu_ : readyCpu_).push_back(index);
+    }
+  }
+}
+
+VkResult VolkJobGraph::submitReady() noexcept {
+  // Dependents made ready by a submission are appended and land in the same vkQueueSubmit2 call if they share the
+  // queue. semaphoreInfos_ is reserved by execute(), so the pointers stay valid.
+  semaphoreInfos_.clear();
+  for (size_t i = 0; i < readyGpu_.size(); ++i) {
+    auto const index = readyGpu_[i];
+    auto& node = nodes_[index];
+    auto& queue = queues_[node.queue];
+
+    auto const waitBegin = semaphoreInfos_.size();
+    for (auto dependency : node.dependencies) {
+      auto const& producer = nodes_[dependency];
+      if (producer.queue == kInvalidNode) {
+        continue;
+      }
+      VkSemaphoreSubmitInfo wait = {};
+      wait.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+      wait.semaphore = queues_[producer.queue].semaphore;
+      wait.value = producer.value;
+      wait.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+      semaphoreInfos_.push_back(wait);
+    }
+    auto const waitCount = semaphoreInfos_.size() - waitBegin;
+
+    node.value = ++queue.value;
+    VkSemaphoreSubmitInfo signal = {};
+    signal.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+    signal.semaphore = queue.semaphore;
+    signal.value = node.value;
+    signal.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    semaphoreInfos_.push_back(signal);
+
+    VkSubmitInfo2 submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+    submitInfo.waitSemaphoreInfoCount = static_cast<uint32_t>(waitCount);
+    submitInfo.pWaitSemaphoreInfos = semaphoreInfos_.data() + waitBegin;
+    submitInfo.commandBufferInfoCount = static_cast<uint32_t>(node.commandBufferInfos.size());
+    submitInfo.pCommandBufferInfos = node.commandBufferInfos.data();
+    submitInfo.signalSemaphoreInfoCount = 1;
+    submitInfo.pSignalSemaphoreInfos = &semaphoreInfos_.back();
+    queue.submitInfos.push_back(submitInfo);
+
+    queue.running.push_back(index);
+    unblock(index, true);
+  }
+  readyGpu_.clear();
+
+  VkResult result = VK_SUCCESS;
+  for (auto& queue : queues_) {
+    if (!queue.submitInfos.empty() && result == VK_SUCCESS) {
+      result = queueSubmit2_(queue.queue, static_cast<uint32_t>(queue.submitInfos.size()), queue.submitInfos.data(),
+                             VK_NULL_HANDLE);
+    }
+    queue.submitInfos.clear();
+  }
+  return result;
+}
+
+void VolkJobGraph::runReady() noexcept {
+  for (auto index : readyCpu_) {
+    pool_.submit([this, index] {
+      nodes_[index].task();
+
+      std::lock_guard lock(mutex_);
+      finished_.push_back(index);
+      VkSemaphoreSignalInfo signalInfo = {};
+      signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO;
+      signalInfo.semaphore = wakeSemaphore_;
+      signalInfo.value = ++wakeValue_;
+      (void)signalSemaphore_(device_, &signalInfo);
+    });
+  }
+}
+
+VkResult VolkJobGraph::execute() noexcept {
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  readyGpu_.clear();
+  readyCpu_.clear();
+  size_t semaphoreInfoCount = 0;
+  for (uint32_t i = 0; i < nodes_.size(); ++i) {
+    auto& node = nodes_[i];
+    node.blockers = static_cast<uint32_t>(node.dependencies.size());
+    node.value = 0;
+    semaphoreInfoCount += node.dependencies.size() + 1;
+    if (node.blockers == 0) {
+      (node.queue != kInvalidNode ? readyGpu_ : readyCpu_).push_back(i);
+    }
+  }
+  semaphoreInfos_.reserve(semaphoreInfoCount);
+  for (auto& queue : queues_) {
+    queue.running.clear();
+    queue.done = 0;
+  }
+
+  VkResult result = VK_SUCCESS;
+  size_t doneCount = 0;
+  uint32_t cpuRunning = 0;
+  std::vector<uint32_t> finished;
+  std::vector<VkSemaphore> semaphores;
+  std::vector<uint64_t> values;
+  for (;;) {
+    // Read before collecting finished CPU nodes, so that a node finishing afterwards ends the wait below.
+    uint64_t wakeValue = 0;
+    (void)getSemaphoreCounterValue_(device_, wakeSemaphore_, &wakeValue);
+    {
+      std::lock_guard lock(mutex_);
+      finished.swap(finished_);
+    }
+    for (auto index : finished) {
+      ++doneCount;
+      --cpuRunning;
+      unblock(index, false);
+    }
+    finished.clear();
+
+    for (auto& queue : queues_) {
+      if (queue.done == queue.running.size() || result != VK_SUCCESS) {
+        continue;
+      }
+      uint64_t value = 0;
+      result = getSemaphoreCounterValue_(device_, queue.semaphore, &value);
+      while (result == VK_SUCCESS && queue.done < queue.running.size() &&
+             nodes_[queue.running[queue.done]].value <= value) {
+        auto const index = queue.running[queue.done++];
+        ++doneCount;
+        unblock(index, false);
+      }
+    }
+
+    if (result == VK_SUCCESS) {
+      result = submitReady();
+    }
+    if (result == VK_SUCCESS) {
+      cpuRunning += static_cast<uint32_t>(readyCpu_.size());
+      runReady();
+    }
+    readyCpu_.clear();
+
+    if (result != VK_SUCCESS && cpuRunning == 0) {
+      return result;
+    }
+    if (doneCount == nodes_.size()) {
+      return VK_SUCCESS;
+    }
+
+    semaphores.assign(1, wakeSemaphore_);
+    values.assign(1, wakeValue + 1);
+    for (auto const& queue : queues_) {
+      if (result == VK_SUCCESS && queue.done < queue.running.size()) {
+        semaphores.push_back(queue.semaphore);
+        values.push_back(nodes_[queue.running[queue.done]].value);
+      }
+    }
+    VkSemaphoreWaitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.flags = VK_SEMAPHORE_WAIT_ANY_BIT;
+    waitInfo.semaphoreCount = static_cast<uint32_t>(semaphores.size());
+    waitInfo.pSemaphores = semaphores.data();
+    waitInfo.pValues = values.data();
+    auto const waitResult = waitSemaphores_(device_, &waitInfo, UINT64_MAX);
+    if (waitResult != VK_SUCCESS && result == VK_SUCCESS) {
+      result = waitResult;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,124 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_thread_pool.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#if defined(VK_BASE_VERSION_1_3)
+
+/**
+ * DAG of CPU tasks and GPU submissions connected by timeline semaphores.
+ *
+ * Every queue used by the graph gets a timeline semaphore; a GPU node signals the next value of its queue's semaphore
+ * and waits on the values of the GPU nodes it depends on, so GPU-to-GPU edges never return to the host: a GPU node is
+ * submitted as soon as its GPU dependencies are submitted and its CPU dependencies have finished. CPU nodes run on a
+ * VolkThreadPool once their CPU dependencies have finished and the semaphore values of their GPU dependencies have been
+ * reached.
+ *
+ * execute() drives the graph from the calling thread, which blocks in vkWaitSemaphores (on the queue semaphores and an
+ * internal semaphore signaled by finishing CPU nodes) whenever nothing is ready. The graph owns the external
+ * synchronization of its queues during execute(). Nodes can only depend on nodes added before them.
+ */
+class VolkJobGraph final {
+public:
+  static constexpr uint32_t kInvalidNode = ~0u;
+
+  /**
+   * Volk must have device function pointers loaded for the given device.
+   */
+  VolkJobGraph(Volk& volk, VkDevice device, VolkThreadPool& pool) noexcept;
+  ~VolkJobGraph() noexcept;
+  VolkJobGraph(const VolkJobGraph&) = delete;
+  VolkJobGraph& operator=(const VolkJobGraph&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if timeline semaphores or vkQueueSubmit2 aren't available, or the error of
+   * semaphore creation.
+   */
+  [[nodiscard]] VkResult getStatus() const noexcept;
+
+  /**
+   * Returns the node index, or kInvalidNode if a dependency isn't an existing node.
+   */
+  uint32_t addCpuNode(std::function<void()> task, uint32_t dependencyCount = 0,
+                      const uint32_t* pDependencies = nullptr) noexcept;
+
+  /**
+   * The command buffers are copied; they must be executable when the node is submitted. Waits and signals happen at
+   * VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT.
+   */
+  uint32_t addGpuNode(VkQueue queue, uint32_t commandBufferInfoCount,
+                      const VkCommandBufferSubmitInfo* pCommandBufferInfos, uint32_t dependencyCount = 0,
+                      const uint32_t* pDependencies = nullptr) noexcept;
+
+  /**
+   * Run the graph and return when every node has finished, or the first submission or wait error after the CPU nodes
+   * already running have finished.
+   */
+  VkResult execute() noexcept;
+
+  /**
+   * Remove all nodes; the queue semaphores are kept.
+   */
+  void reset() noexcept;
+
+  /**
+   * Timeline semaphore and value signaled by a GPU node in the last execute(), e.g. to wait on its results elsewhere.
+   */
+  [[nodiscard]] VkSemaphoreSubmitInfo getSignal(uint32_t node) const noexcept;
+
+private:
+  struct Node {
+    std::function<void()> task;
+    uint32_t queue = kInvalidNode; // index into queues_ for GPU nodes
+    std::vector<VkCommandBufferSubmitInfo> commandBufferInfos;
+    std::vector<uint32_t> dependencies;
+    std::vector<uint32_t> dependents;
+    // Per execution
+    uint32_t blockers = 0;
+    uint64_t value = 0;
+  };
+
+  struct Queue {
+    VkQueue queue = VK_NULL_HANDLE;
+    VkSemaphore semaphore = VK_NULL_HANDLE;
+    uint64_t value = 0;            // last value submitted for signaling
+    std::vector<uint32_t> running; // submitted GPU nodes in signal order
+    size_t done = 0;               // prefix of running which has completed
+    std::vector<VkSubmitInfo2> submitInfos;
+  };
+
+  [[nodiscard]] uint32_t addNode(Node&& node, uint32_t dependencyCount, const uint32_t* pDependencies) noexcept;
+  [[nodiscard]] VkResult createSemaphore(VkSemaphore* pSemaphore) noexcept;
+  void unblock(uint32_t node, bool gpuSubmitted) noexcept;
+  [[nodiscard]] VkResult submitReady() noexcept;
+  void runReady() noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VolkThreadPool& pool_;
+  PFN_vkQueueSubmit2 queueSubmit2_ = nullptr;
+  PFN_vkGetSemaphoreCounterValue getSemaphoreCounterValue_ = nullptr;
+  PFN_vkWaitSemaphores waitSemaphores_ = nullptr;
+  PFN_vkSignalSemaphore signalSemaphore_ = nullptr;
+  VkResult status_ = VK_SUCCESS;
+
+  std::vector<Node> nodes_;
+  std::vector<Queue> queues_;
+  std::vector<uint32_t> readyGpu_;
+  std::vector<uint32_t> readyCpu_;
+  std::vector<VkSemaphoreSubmitInfo> semaphoreInfos_;
+
+  // Shared with the pool workers running CPU nodes.
+  std::mutex mutex_;
+  std::vector<uint32_t> finished_;
+  VkSemaphore wakeSemaphore_ = VK_NULL_HANDLE;
+  uint64_t wakeValue_ = 0;
+};
+
+#endif
@@ -0,0 +1,95 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_mapped_file.hpp"
+
+#ifdef _WIN32
+  #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+VolkMappedFile::VolkMappedFile(const char* path) noexcept {
+  (void)open(path);
+}
+
+VolkMappedFile::~VolkMappedFile() noexcept {
+  close();
+}
+
+bool VolkMappedFile::open(const char* path) noexcept {
+  close();
+#if defined(_WIN32)
+  auto file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
+                          nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER size = {};
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+    mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  }
+  CloseHandle(file);
+  if (!mapping_) {
+    return false;
+  }
+  data_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+  if (!data_) {
+    CloseHandle(mapping_);
+    mapping_ = nullptr;
+    return false;
+  }
+  size_ = static_cast<size_t>(size.QuadPart);
+#else
+  auto fd = ::open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st = {};
+  void* data = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  // The mapping keeps the file referenced.
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  // Uploads read the whole file front to back.
+  (void)madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+  data_ = data;
+  size_ = static_cast<size_t>(st.st_size);
+#endif
+  return true;
+}
+
+void VolkMappedFile::close() noexcept {
+  if (!data_) {
+    return;
+  }
+#if defined(_WIN32)
+  UnmapViewOfFile(data_);
+  CloseHandle(mapping_);
+  mapping_ = nullptr;
+#else
+  munmap(const_cast<void*>(data_), size_);
+#endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
+bool VolkMappedFile::isOpen() const noexcept {
+  return data_ != nullptr;
+}
+
+const void* VolkMappedFile::getData() const noexcept {
+  return data_;
+}
+
+size_t VolkMappedFile::getSize() const noexcept {
+  return size_;
+}
@@ -0,0 +1,36 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Read-only memory mapping of a whole file, for feeding file contents to uploads without reading them into a
+ * separate buffer first. The mapping starts at a page boundary.
+ */
+class VolkMappedFile final {
+public:
+  VolkMappedFile() noexcept = default;
+  explicit VolkMappedFile(const char* path) noexcept;
+  ~VolkMappedFile() noexcept;
+  VolkMappedFile(const VolkMappedFile&) = delete;
+  VolkMappedFile& operator=(const VolkMappedFile&) = delete;
+
+  /**
+   * Map the file, unmapping the previous one. Returns false if the file can't be opened or mapped; empty files
+   * can't be mapped.
+   */
+  bool open(const char* path) noexcept;
+  void close() noexcept;
+
+  [[nodiscard]] bool isOpen() const noexcept;
+  [[nodiscard]] const void* getData() const noexcept;
+  [[nodiscard]] size_t getSize() const noexcept;
+
+private:
+  const void* data_ = nullptr;
+  size_t size_ = 0;
+#if defined(_WIN32)
+  void* mapping_ = nullptr;
+#endif
+};
@@ -0,0 +1,271 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_mapping_cache.hpp"
+
+#include <algorithm>
+
+namespace {
+
+#if defined(VK_BASE_VERSION_1_4)
+using MemoryMapInfo = VkMemoryMapInfo;
+using MemoryUnmapInfo = VkMemoryUnmapInfo;
+constexpr auto kMemoryMapInfoType = VK_STRUCTURE_TYPE_MEMORY_MAP_INFO;
+constexpr auto kMemoryUnmapInfoType = VK_STRUCTURE_TYPE_MEMORY_UNMAP_INFO;
+#elif defined(VK_KHR_map_memory2)
+using MemoryMapInfo = VkMemoryMapInfoKHR;
+using MemoryUnmapInfo = VkMemoryUnmapInfoKHR;
+constexpr auto kMemoryMapInfoType = VK_STRUCTURE_TYPE_MEMORY_MAP_INFO_KHR;
+constexpr auto kMemoryUnmapInfoType = VK_STRUCTURE_TYPE_MEMORY_UNMAP_INFO_KHR;
+#endif
+
+} // namespace
+
+VolkMappingCache::VolkMappingCache(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device) noexcept
+  : volk_(volk)
+  , device_(device) {
+  VkPhysicalDeviceProperties properties = {};
+  volk_.vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+  atomSize_ = std::max<VkDeviceSize>(properties.limits.nonCoherentAtomSize, 1);
+  volk_.vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties_);
+
+#if defined(VK_BASE_VERSION_1_4)
+  mapMemory2_ = volk.vkMapMemory2;
+  unmapMemory2_ = volk.vkUnmapMemory2;
+#endif
+#if defined(VK_KHR_map_memory2)
+  if (!mapMemory2_ || !unmapMemory2_) {
+    mapMemory2_ = volk.vkMapMemory2KHR;
+    unmapMemory2_ = volk.vkUnmapMemory2KHR;
+  }
+#endif
+}
+
+VolkMappingCache::~VolkMappingCache() noexcept {
+  for (auto const& [memory, mapping] : mappings_) {
+    if (mapping.data) {
+      unmapDriver(memory);
+    }
+  }
+}
+
+VolkMappingCache::Stats VolkMappingCache::getStats() noexcept {
+  std::lock_guard lock(mutex_);
+  return stats_;
+}
+
+VkResult VolkMappingCache::vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                            const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) noexcept {
+  auto const result = volk_.vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+  if (result == VK_SUCCESS && pAllocateInfo->memoryTypeIndex < memoryProperties_.memoryTypeCount) {
+    auto const flags = memoryProperties_.memoryTypes[pAllocateInfo->memoryTypeIndex].propertyFlags;
+    if (flags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+      Mapping mapping;
+      mapping.size = pAllocateInfo->allocationSize;
+      mapping.coherent = (flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+      std::lock_guard lock(mutex_);
+      mappings_[*pMemory] = mapping;
+    }
+  }
+  return result;
+}
+
+void VolkMappingCache::vkFreeMemory(VkDevice device, VkDeviceMemory memory,
+                                    const VkAllocationCallbacks* pAllocator) noexcept {
+  if (memory != VK_NULL_HANDLE) {
+    std::lock_guard lock(mutex_);
+    auto it = mappings_.find(memory);
+    if (it != mappings_.end()) {
+      if (it->second.data) {
+        unmapDriver(memory);
+      }
+      mappings_.erase(it);
+    }
+    ranges_.erase(std::remove_if(ranges_.begin(), ranges_.end(),
+                                 [memory](auto const& range) { return range.memory == memory; }),
+                  ranges_.end());
+  }
+  volk_.vkFreeMemory(device, memory, pAllocator);
+}
+
+VkResult VolkMappingCache::vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                       VkMemoryMapFlags flags, void** ppData) noexcept {
+  if (flags != 0) {
+    return volk_.vkMapMemory(device, memory, offset, size, flags, ppData);
+  }
+  return map(memory, offset, ppData);
+}
+
+void VolkMappingCache::vkUnmapMemory(VkDevice device, VkDeviceMemory memory) noexcept {
+  if (!unmap(memory)) {
+    volk_.vkUnmapMemory(device, memory);
+  }
+}
+
+#if defined(VK_BASE_VERSION_1_4)
+VkResult VolkMappingCache::vkMapMemory2(VkDevice device, const VkMemoryMapInfo* pMemoryMapInfo,
+                                        void** ppData) noexcept {
+  if (pMemoryMapInfo->flags != 0 || pMemoryMapInfo->pNext) {
+    return volk_.vkMapMemory2(device, pMemoryMapInfo, ppData);
+  }
+  return map(pMemoryMapInfo->memory, pMemoryMapInfo->offset, ppData);
+}
+
+VkResult VolkMappingCache::vkUnmapMemory2(VkDevice device, const VkMemoryUnmapInfo* pMemoryUnmapInfo) noexcept {
+  if (pMemoryUnmapInfo->flags != 0 || pMemoryUnmapInfo->pNext) {
+    forget(pMemoryUnmapInfo->memory);
+    return volk_.vkUnmapMemory2(device, pMemoryUnmapInfo);
+  }
+  if (!unmap(pMemoryUnmapInfo->memory)) {
+    return volk_.vkUnmapMemory2(device, pMemoryUnmapInfo);
+  }
+  return VK_SUCCESS;
+}
+#endif
+
+#if defined(VK_KHR_map_memory2)
+VkResult VolkMappingCache::vkMapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR* pMemoryMapInfo,
+                                           void** ppData) noexcept {
+  if (pMemoryMapInfo->flags != 0 || pMemoryMapInfo->pNext) {
+    return volk_.vkMapMemory2KHR(device, pMemoryMapInfo, ppData);
+  }
+  return map(pMemoryMapInfo->memory, pMemoryMapInfo->offset, ppData);
+}
+
+VkResult VolkMappingCache::vkUnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo) noexcept {
+  if (pMemoryUnmapInfo->flags != 0 || pMemoryUnmapInfo->pNext) {
+    forget(pMemoryUnmapInfo->memory);
+    return volk_.vkUnmapMemory2KHR(device, pMemoryUnmapInfo);
+  }
+  if (!unmap(pMemoryUnmapInfo->memory)) {
+    return volk_.vkUnmapMemory2KHR(device, pMemoryUnmapInfo);
+  }
+  return VK_SUCCESS;
+}
+#endif
+
+VkResult VolkMappingCache::map(VkDeviceMemory memory, VkDeviceSize offset, void** ppData) noexcept {
+  std::lock_guard lock(mutex_);
+  auto& mapping = mappings_[memory];
+  if (mapping.data) {
+    ++stats_.cachedMaps;
+    *ppData = mapping.data + offset;
+    return VK_SUCCESS;
+  }
+
+  void* data = nullptr;
+  VkResult result = VK_SUCCESS;
+#if defined(VK_BASE_VERSION_1_4) || defined(VK_KHR_map_memory2)
+  if (mapMemory2_) {
+    MemoryMapInfo mapInfo = {};
+    mapInfo.sType = kMemoryMapInfoType;
+    mapInfo.memory = memory;
+    mapInfo.size = VK_WHOLE_SIZE;
+    result = mapMemory2_(device_, &mapInfo, &data);
+  } else
+#endif
+  {
+    result = volk_.vkMapMemory(device_, memory, 0, VK_WHOLE_SIZE, 0, &data);
+  }
+  if (result != VK_SUCCESS) {
+    return result;
+  }
+
+  ++stats_.driverMaps;
+  mapping.data = static_cast<uint8_t*>(data);
+  *ppData = mapping.data + offset;
+  return VK_SUCCESS;
+}
+
+bool VolkMappingCache::unmap(VkDeviceMemory memory) noexcept {
+  std::lock_guard lock(mutex_);
+  auto it = mappings_.find(memory);
+  return it != mappings_.end() && it->second.data;
+}
+
+void VolkMappingCache::forget(VkDeviceMemory memory) noexcept {
+  // Unmap calls with flags (e.g. VK_MEMORY_UNMAP_RESERVE_BIT_EXT) or a pNext chain go to the driver, which unmaps the
+  // memory even if the cache mapped it; the next map call maps it again.
+  std::lock_guard lock(mutex_);
+  auto it = mappings_.find(memory);
+  if (it != mappings_.end()) {
+    it->second.data = nullptr;
+  }
+}
+
+void VolkMappingCache::unmapDriver(VkDeviceMemory memory) noexcept {
+#if defined(VK_BASE_VERSION_1_4) || defined(VK_KHR_map_memory2)
+  if (unmapMemory2_) {
+    MemoryUnmapInfo unmapInfo = {};
+    unmapInfo.sType = kMemoryUnmapInfoType;
+    unmapInfo.memory = memory;
+    (void)unmapMemory2_(device_, &unmapInfo);
+    return;
+  }
+#endif
+  volk_.vkUnmapMemory(device_, memory);
+}
+
+void VolkMappingCache::flush(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size) noexcept {
+  std::lock_guard lock(mutex_);
+  auto it = mappings_.find(memory);
+  if (it != mappings_.end() && it->second.coherent) {
+    return;
+  }
+
+  VkMappedMemoryRange range = {};
+  range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+  range.memory = memory;
+  range.offset = offset;
+  range.size = size;
+  ranges_.push_back(range);
+}
+
+VkResult VolkMappingCache::flushRanges() noexcept {
+  std::lock_guard lock(mutex_);
+  if (ranges_.empty()) {
+    return VK_SUCCESS;
+  }
+
+  // Round to whole atoms; a range reaching the end of the allocation becomes VK_WHOLE_SIZE, which is exempt from the
+  // atom size rule. The end of ranges of memory of unknown size isn't rounded up, as it could then pass the end of the
+  // allocation. Then merge overlapping and adjacent ranges of the same memory.
+  for (auto& range : ranges_) {
+    auto it = mappings_.find(range.memory);
+    auto const allocationSize = it != mappings_.end() ? it->second.size : VK_WHOLE_SIZE;
+    auto const begin = range.offset / atomSize_ * atomSize_;
+    auto end = VK_WHOLE_SIZE;
+    if (range.size != VK_WHOLE_SIZE) {
+      end = range.offset + range.size;
+      if (allocationSize != VK_WHOLE_SIZE) {
+        end = (end + atomSize_ - 1) / atomSize_ * atomSize_;
+      }
+    }
+    range.offset = begin;
+    range.size = end == VK_WHOLE_SIZE || (allocationSize != VK_WHOLE_SIZE && end >= allocationSize)
+                   ? VK_WHOLE_SIZE
+                   : end - begin;
+  }
+  std::sort(ranges_.begin(), ranges_.end(), [](auto const& a, auto const& b) {
+    return a.memory != b.memory ? a.memory < b.memory : a.offset < b.offset;
+  });
+  size_t count = 0;
+  for (auto const& range : ranges_) {
+    auto& last = ranges_[count == 0 ? 0 : count - 1];
+    if (count != 0 && last.memory == range.memory &&
+        (last.size == VK_WHOLE_SIZE || last.offset + last.size >= range.offset)) {
+      if (last.size != VK_WHOLE_SIZE) {
+        last.size = range.size == VK_WHOLE_SIZE ? VK_WHOLE_SIZE
+                                                : std::max(last.offset + last.size, range.offset + range.size) -
+                                                    last.offset;
+      }
+      continue;
+    }
+    ranges_[count++] = range;
+  }
+  ranges_.resize(count);
+
+  ++stats_.flushCalls;
+  stats_.flushedRanges += count;
+  auto const result = volk_.vkFlushMappedMemoryRanges(device_, static_cast<uint32_t>(count), ranges_.data());
+  ranges_.clear();
+  return result;
+}
@@ -0,0 +1,99 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Persistent mappings of device memory.
+ *
+ * Memory is mapped whole on the first map call, with vkMapMemory2 when available, and the mapping is kept until the
+ * memory is freed through this class: later map calls return a pointer into the cached mapping and unmap calls are
+ * dropped. Map calls with flags or a pNext chain (e.g. placed mappings) bypass the cache; unmap calls with flags or a
+ * pNext chain are passed to the driver and drop the cached mapping.
+ *
+ * Writes to non-coherent memory are announced with flush() and issued by flushRanges() as one
+ * vkFlushMappedMemoryRanges call, with ranges rounded to nonCoherentAtomSize and merged. Memory allocated through this
+ * class is known to be coherent or not; other memory is treated as non-coherent. Its size isn't known either, so only
+ * the start of its ranges is rounded: their end must be a multiple of nonCoherentAtomSize or the end of the memory.
+ *
+ * Memory still mapped when the cache is destroyed is unmapped, so it must not have been freed behind its back.
+ */
+class VolkMappingCache final {
+public:
+  struct Stats {
+    uint64_t driverMaps = 0;    // memory objects mapped by the driver
+    uint64_t cachedMaps = 0;    // map calls served from the cache
+    uint64_t flushCalls = 0;    // vkFlushMappedMemoryRanges calls
+    uint64_t flushedRanges = 0; // ranges after merging
+  };
+
+  /**
+   * Volk must have device function pointers loaded for the given device.
+   */
+  VolkMappingCache(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device) noexcept;
+  ~VolkMappingCache() noexcept;
+  VolkMappingCache(const VolkMappingCache&) = delete;
+  VolkMappingCache& operator=(const VolkMappingCache&) = delete;
+
+  [[nodiscard]] Stats getStats() noexcept;
+
+  VkResult vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                            const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) noexcept;
+  void vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) noexcept;
+  VkResult vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                       VkMemoryMapFlags flags, void** ppData) noexcept;
+  void vkUnmapMemory(VkDevice device, VkDeviceMemory memory) noexcept;
+#if defined(VK_BASE_VERSION_1_4)
+  VkResult vkMapMemory2(VkDevice device, const VkMemoryMapInfo* pMemoryMapInfo, void** ppData) noexcept;
+  VkResult vkUnmapMemory2(VkDevice device, const VkMemoryUnmapInfo* pMemoryUnmapInfo) noexcept;
+#endif
+#if defined(VK_KHR_map_memory2)
+  VkResult vkMapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR* pMemoryMapInfo, void** ppData) noexcept;
+  VkResult vkUnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR* pMemoryUnmapInfo) noexcept;
+#endif
+
+  /**
+   * Record that the host wrote [offset, offset + size) of memory; size may be VK_WHOLE_SIZE. Ignored for coherent
+   * memory.
+   */
+  void flush(VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size) noexcept;
+
+  /**
+   * Flush all recorded ranges with one vkFlushMappedMemoryRanges call, typically once per frame before submitting.
+   */
+  VkResult flushRanges() noexcept;
+
+private:
+  struct Mapping {
+    uint8_t* data = nullptr;
+    VkDeviceSize size = VK_WHOLE_SIZE; // allocation size, VK_WHOLE_SIZE if the memory wasn't allocated here
+    bool coherent = false;
+  };
+
+  [[nodiscard]] VkResult map(VkDeviceMemory memory, VkDeviceSize offset, void** ppData) noexcept;
+  [[nodiscard]] bool unmap(VkDeviceMemory memory) noexcept;
+  void forget(VkDeviceMemory memory) noexcept;
+  void unmapDriver(VkDeviceMemory memory) noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VkDeviceSize atomSize_ = 1;
+  VkPhysicalDeviceMemoryProperties memoryProperties_ = {};
+#if defined(VK_BASE_VERSION_1_4)
+  PFN_vkMapMemory2 mapMemory2_ = nullptr;
+  PFN_vkUnmapMemory2 unmapMemory2_ = nullptr;
+#elif defined(VK_KHR_map_memory2)
+  PFN_vkMapMemory2KHR mapMemory2_ = nullptr;
+  PFN_vkUnmapMemory2KHR unmapMemory2_ = nullptr;
+#endif
+
+  std::mutex mutex_;
+  std::unordered_map<VkDeviceMemory, Mapping> mappings_;
+  std::vector<VkMappedMemoryRange> ranges_;
+  Stats stats_;
+};
@@ -0,0 +1,194 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_memory_telemetry.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+
+namespace {
+
+void updatePeak(std::atomic<uint64_t>& peak, uint64_t value) noexcept {
+  auto current = peak.load(std::memory_order_relaxed);
+  while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+uint32_t bucket(uint64_t value, uint32_t bucketCount) noexcept {
+  return std::min(static_cast<uint32_t>(std::bit_width(value)), bucketCount - 1);
+}
+
+} // namespace
+
+VolkMemoryTelemetry::VolkMemoryTelemetry(Volk& volk, VkPhysicalDevice physicalDevice, bool memoryBudgetEnabled,
+                                         uint32_t capacity /* = 16384 */) noexcept
+  : volk_(volk)
+  , physicalDevice_(physicalDevice)
+  , memoryBudgetEnabled_(memoryBudgetEnabled)
+  , allocations_(capacity)
+  , lastSnapshotAt_(now()) {
+  volk_.vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
+}
+
+VkResult VolkMemoryTelemetry::vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                               const VkAllocationCallbacks* pAllocator,
+                                               VkDeviceMemory* pMemory) noexcept {
+  auto result = volk_.vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+  auto const typeIndex = pAllocateInfo->memoryTypeIndex;
+  if (typeIndex >= VK_MAX_MEMORY_TYPES) {
+    return result;
+  }
+
+  auto& type = types_[typeIndex];
+  if (result != VK_SUCCESS) {
+    type.failedCount.fetch_add(1, std::memory_order_relaxed);
+    return result;
+  }
+
+  auto const size = pAllocateInfo->allocationSize;
+  type.allocationCount.fetch_add(1, std::memory_order_relaxed);
+  type.sizeHistogram[bucket(size > 0 ? size - 1 : 0, kSizeBuckets)].fetch_add(1, std::memory_order_relaxed);
+  if (!allocations_.insert(*pMemory, Allocation{typeIndex, size, now()})) {
+    untracked_.fetch_add(1, std::memory_order_relaxed);
+    return result;
+  }
+
+  type.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+  updatePeak(type.peakBytes, type.liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+  auto& heap = heaps_[memoryProperties_.memoryTypes[typeIndex].heapIndex];
+  updatePeak(heap.peakBytes, heap.liveBytes.fetch_add(size, std::memory_order_relaxed) + size);
+  return result;
+}
+
+void VolkMemoryTelemetry::vkFreeMemory(VkDevice device, VkDeviceMemory memory,
+                                       const VkAllocationCallbacks* pAllocator) noexcept {
+  // Forget the allocation before the driver frees it: once freed, the handle may be returned by a concurrent
+  // vkAllocateMemory, whose entry must not collide with (or be erased as) the old one.
+  Allocation allocation;
+  bool const tracked = memory != VK_NULL_HANDLE && allocations_.erase(memory, &allocation);
+  volk_.vkFreeMemory(device, memory, pAllocator);
+  if (!tracked) {
+    return;
+  }
+
+  auto& type = types_[allocation.memoryTypeIndex];
+  type.freeCount.fetch_add(1, std::memory_order_relaxed);
+  type.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+  type.liveBytes.fetch_sub(allocation.size, std::memory_order_relaxed);
+  heaps_[memoryProperties_.memoryTypes[allocation.memoryTypeIndex].heapIndex].liveBytes.fetch_sub(
+    allocation.size, std::memory_order_relaxed);
+
+  auto const lifetime = static_cast<uint64_t>(std::max<int64_t>(now() - allocation.allocatedAt, 0));
+  type.lifetimeHistogram[bucket(lifetime, kLifetimeBuckets)].fetch_add(1, std::memory_order_relaxed);
+}
+
+VkResult VolkMemoryTelemetry::vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset,
+                                          VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) noexcept {
+  countMap(memory);
+  return volk_.vkMapMemory(device, memory, offset, size, flags, ppData);
+}
+
+#if defined(VK_BASE_VERSION_1_4)
+VkResult VolkMemoryTelemetry::vkMapMemory2(VkDevice device, const VkMemoryMapInfo* pMemoryMapInfo,
+                                           void** ppData) noexcept {
+  countMap(pMemoryMapInfo->memory);
+  return volk_.vkMapMemory2(device, pMemoryMapInfo, ppData);
+}
+#endif
+
+#if defined(VK_KHR_map_memory2)
+VkResult VolkMemoryTelemetry::vkMapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR* pMemoryMapInfo,
+                                              void** ppData) noexcept {
+  countMap(pMemoryMapInfo->memory);
+  return volk_.vkMapMemory2KHR(device, pMemoryMapInfo, ppData);
+}
+#endif
+
+void VolkMemoryTelemetry::getSnapshot(Snapshot* pSnapshot) noexcept {
+  auto& snapshot = *pSnapshot;
+  snapshot.memoryTypeCount = memoryProperties_.memoryTypeCount;
+  snapshot.memoryHeapCount = memoryProperties_.memoryHeapCount;
+
+  uint64_t allocationCount = 0;
+  uint64_t freeCount = 0;
+  for (uint32_t i = 0; i < memoryProperties_.memoryTypeCount; ++i) {
+    auto const& counters = types_[i];
+    auto& stats = snapshot.types[i];
+    stats.heapIndex = memoryProperties_.memoryTypes[i].heapIndex;
+    stats.propertyFlags = memoryProperties_.memoryTypes[i].propertyFlags;
+    stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+    stats.allocationCount = counters.allocationCount.load(std::memory_order_relaxed);
+    stats.freeCount = counters.freeCount.load(std::memory_order_relaxed);
+    stats.failedCount = counters.failedCount.load(std::memory_order_relaxed);
+    stats.mapCount = counters.mapCount.load(std::memory_order_relaxed);
+    for (uint32_t b = 0; b < kSizeBuckets; ++b) {
+      stats.sizeHistogram[b] = counters.sizeHistogram[b].load(std::memory_order_relaxed);
+    }
+    for (uint32_t b = 0; b < kLifetimeBuckets; ++b) {
+      stats.lifetimeHistogram[b] = counters.lifetimeHistogram[b].load(std::memory_order_relaxed);
+    }
+    allocationCount += stats.allocationCount;
+    freeCount += stats.freeCount;
+  }
+
+  VkDeviceSize heapBudget[VK_MAX_MEMORY_HEAPS] = {};
+  VkDeviceSize heapUsage[VK_MAX_MEMORY_HEAPS] = {};
+#if defined(VK_BASE_VERSION_1_1) && defined(VK_EXT_memory_budget)
+  auto getProperties2 = volk_.vkGetPhysicalDeviceMemoryProperties2;
+#if defined(VK_KHR_get_physical_device_properties2)
+  if (!getProperties2) {
+    getProperties2 = volk_.vkGetPhysicalDeviceMemoryProperties2KHR;
+  }
+#endif
+  if (memoryBudgetEnabled_ && getProperties2) {
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget = {};
+    budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    VkPhysicalDeviceMemoryProperties2 properties = {};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    properties.pNext = &budget;
+    getProperties2(physicalDevice_, &properties);
+    std::copy(std::begin(budget.heapBudget), std::end(budget.heapBudget), heapBudget);
+    std::copy(std::begin(budget.heapUsage), std::end(budget.heapUsage), heapUsage);
+  }
+#endif
+
+  for (uint32_t i = 0; i < memoryProperties_.memoryHeapCount; ++i) {
+    auto& stats = snapshot.heaps[i];
+    stats.size = memoryProperties_.memoryHeaps[i].size;
+    stats.flags = memoryProperties_.memoryHeaps[i].flags;
+    stats.liveBytes = heaps_[i].liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = heaps_[i].peakBytes.load(std::memory_order_relaxed);
+    stats.budget = heapBudget[i];
+    stats.usage = heapUsage[i];
+  }
+
+  std::lock_guard lock(snapshotMutex_);
+  auto const time = now();
+  auto const seconds = static_cast<double>(time - lastSnapshotAt_) / 1e6;
+  snapshot.allocationsPerSecond = 0.0;
+  snapshot.freesPerSecond = 0.0;
+  if (seconds > 0.0) {
+    snapshot.allocationsPerSecond = static_cast<double>(allocationCount - lastAllocationCount_) / seconds;
+    snapshot.freesPerSecond = static_cast<double>(freeCount - lastFreeCount_) / seconds;
+  }
+  lastSnapshotAt_ = time;
+  lastAllocationCount_ = allocationCount;
+  lastFreeCount_ = freeCount;
+}
+
+uint64_t VolkMemoryTelemetry::getUntrackedCount() const noexcept {
+  return untracked_.load(std::memory_order_relaxed);
+}
+
+void VolkMemoryTelemetry::countMap(VkDeviceMemory memory) noexcept {
+  Allocation allocation;
+  if (allocations_.find(memory, &allocation)) {
+    types_[allocation.memoryTypeIndex].mapCount.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+int64_t VolkMemoryTelemetry::now() noexcept {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
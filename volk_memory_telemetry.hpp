@@ -0,0 +1,127 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_handle_table.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * Device memory churn telemetry: live and peak bytes, allocation size and lifetime histograms and allocation rate
+ * per memory type and heap, cross-referenced with VK_EXT_memory_budget numbers.
+ *
+ * Memory calls that should be tracked go through the forwarding methods of this class. All counters are fixed-size
+ * relaxed atomics; allocations are tracked in a lock-free VolkHandleTable, and allocations which don't fit into it
+ * are counted in getUntrackedCount() and left out of live bytes and lifetimes.
+ */
+class VolkMemoryTelemetry final {
+public:
+  static constexpr uint32_t kSizeBuckets = 48;     // bucket i counts sizes in (2^(i-1), 2^i]
+  static constexpr uint32_t kLifetimeBuckets = 40; // bucket i counts lifetimes in [2^(i-1), 2^i) microseconds
+
+  struct TypeStats {
+    uint32_t heapIndex = 0;
+    VkMemoryPropertyFlags propertyFlags = 0;
+    uint64_t liveBytes = 0;
+    uint64_t peakBytes = 0;
+    uint64_t liveAllocations = 0;
+    uint64_t allocationCount = 0;
+    uint64_t freeCount = 0;
+    uint64_t failedCount = 0;
+    uint64_t mapCount = 0;
+    uint64_t sizeHistogram[kSizeBuckets] = {};
+    uint64_t lifetimeHistogram[kLifetimeBuckets] = {};
+  };
+
+  struct HeapStats {
+    VkDeviceSize size = 0;
+    VkMemoryHeapFlags flags = 0;
+    uint64_t liveBytes = 0;
+    uint64_t peakBytes = 0;
+    VkDeviceSize budget = 0; // from VK_EXT_memory_budget, 0 if not available
+    VkDeviceSize usage = 0;  // from VK_EXT_memory_budget, 0 if not available
+  };
+
+  struct Snapshot {
+    uint32_t memoryTypeCount = 0;
+    uint32_t memoryHeapCount = 0;
+    TypeStats types[VK_MAX_MEMORY_TYPES];
+    HeapStats heaps[VK_MAX_MEMORY_HEAPS];
+    double allocationsPerSecond = 0.0; // since the previous snapshot
+    double freesPerSecond = 0.0;       // since the previous snapshot
+  };
+
+  /**
+   * Volk must have instance and device function pointers loaded. memoryBudgetEnabled tells whether VK_EXT_memory_budget
+   * is enabled on the device; capacity is the number of allocations that can be tracked at once.
+   */
+  VolkMemoryTelemetry(Volk& volk, VkPhysicalDevice physicalDevice, bool memoryBudgetEnabled,
+                      uint32_t capacity = 16384) noexcept;
+  VolkMemoryTelemetry(const VolkMemoryTelemetry&) = delete;
+  VolkMemoryTelemetry& operator=(const VolkMemoryTelemetry&) = delete;
+
+  VkResult vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                            const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) noexcept;
+  void vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) noexcept;
+  VkResult vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                       VkMemoryMapFlags flags, void** ppData) noexcept;
+#if defined(VK_BASE_VERSION_1_4)
+  VkResult vkMapMemory2(VkDevice device, const VkMemoryMapInfo* pMemoryMapInfo, void** ppData) noexcept;
+#endif
+#if defined(VK_KHR_map_memory2)
+  VkResult vkMapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR* pMemoryMapInfo, void** ppData) noexcept;
+#endif
+
+  /**
+   * Read all counters and, if enabled, the current memory budget. Counters are read one by one, so a snapshot taken
+   * concurrently with allocations may be slightly inconsistent.
+   */
+  void getSnapshot(Snapshot* pSnapshot) noexcept;
+
+  [[nodiscard]] uint64_t getUntrackedCount() const noexcept;
+
+private:
+  struct Allocation {
+    uint32_t memoryTypeIndex = 0;
+    VkDeviceSize size = 0;
+    int64_t allocatedAt = 0; // steady clock, microseconds
+  };
+
+  struct TypeCounters {
+    std::atomic<uint64_t> liveBytes = 0;
+    std::atomic<uint64_t> peakBytes = 0;
+    std::atomic<uint64_t> liveAllocations = 0;
+    std::atomic<uint64_t> allocationCount = 0;
+    std::atomic<uint64_t> freeCount = 0;
+    std::atomic<uint64_t> failedCount = 0;
+    std::atomic<uint64_t> mapCount = 0;
+    std::atomic<uint64_t> sizeHistogram[kSizeBuckets] = {};
+    std::atomic<uint64_t> lifetimeHistogram[kLifetimeBuckets] = {};
+  };
+
+  struct HeapCounters {
+    std::atomic<uint64_t> liveBytes = 0;
+    std::atomic<uint64_t> peakBytes = 0;
+  };
+
+  void countMap(VkDeviceMemory memory) noexcept;
+  [[nodiscard]] static int64_t now() noexcept;
+
+  Volk& volk_;
+  VkPhysicalDevice physicalDevice_ = VK_NULL_HANDLE;
+  bool memoryBudgetEnabled_ = false;
+  VkPhysicalDeviceMemoryProperties memoryProperties_ = {};
+
+  VolkHandleTable<Allocation> allocations_;
+  TypeCounters types_[VK_MAX_MEMORY_TYPES];
+  HeapCounters heaps_[VK_MAX_MEMORY_HEAPS];
+  std::atomic<uint64_t> untracked_ = 0;
+
+  std::mutex snapshotMutex_;
+  int64_t lastSnapshotAt_ = 0;
+  uint64_t lastAllocationCount_ = 0;
+  uint64_t lastFreeCount_ = 0;
+};
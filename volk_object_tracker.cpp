@@ -0,0 +1,589 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_object_tracker.hpp"
+
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+template <typename Handle>
+uint64_t getHandleValue(Handle handle) noexcept {
+  if constexpr (std::is_pointer_v<Handle>) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+  } else {
+    return static_cast<uint64_t>(handle);
+  }
+}
+
+} // namespace
+
+VolkObjectTracker::VolkObjectTracker(Volk& volk, uint32_t capacity /* = 65536 */,
+                                     LeakCallback leakCallback /* = {} */) noexcept
+  : volk_(volk)
+  , leakCallback_(std::move(leakCallback))
+  , handles_(capacity)
+  , children_(capacity) {}
+
+VolkObjectTracker::~VolkObjectTracker() {
+  children_.forEach([](uint64_t, Children* children) { delete children; });
+}
+
+VolkObjectTracker::TypeStats VolkObjectTracker::getStats(VkObjectType objectType) const noexcept {
+  auto const& counters = types_[getTypeIndex(objectType)];
+  TypeStats stats;
+  stats.created = counters.created.load(std::memory_order_relaxed);
+  stats.destroyed = counters.destroyed.load(std::memory_order_relaxed);
+  stats.live = counters.live.load(std::memory_order_relaxed);
+  stats.highWater = counters.highWater.load(std::memory_order_relaxed);
+  stats.leaked = counters.leaked.load(std::memory_order_relaxed);
+  return stats;
+}
+
+uint64_t VolkObjectTracker::getUntrackedCount() const noexcept {
+  return untracked_.load(std::memory_order_relaxed);
+}
+
+// Handles are untracked before they are destroyed: once the driver has destroyed an object, another thread may get
+// the same handle value for a new one.
+#define VOLK_CPP_DEFINE_TRACKED_CREATE(Type, ObjectType, Create, CreateInfo) \
+  VkResult VolkObjectTracker::Create(VkDevice device, const CreateInfo* pCreateInfo, \
+                                     const VkAllocationCallbacks* pAllocator, Type* pObject) noexcept { \
+    auto result = volk_.Create(device, pCreateInfo, pAllocator, pObject); \
+    if (result == VK_SUCCESS) { \
+      track(device, ObjectType, getHandleValue(*pObject)); \
+    } \
+    return result; \
+  }
+#define VOLK_CPP_DEFINE_TRACKED_DESTROY(Type, ObjectType, Destroy) \
+  void VolkObjectTracker::Destroy(VkDevice device, Type object, const VkAllocationCallbacks* pAllocator) noexcept { \
+    if (object != VK_NULL_HANDLE) { \
+      untrack(ObjectType, getHandleValue(object)); \
+    } \
+    volk_.Destroy(device, object, pAllocator); \
+  }
+
+/* VOLK_CPP_GENERATE_TRACKED_DEFINITIONS */
+#if defined(VK_BASE_VERSION_1_0)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkDeviceMemory, VK_OBJECT_TYPE_DEVICE_MEMORY, vkAllocateMemory, VkMemoryAllocateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkBuffer, VK_OBJECT_TYPE_BUFFER, vkCreateBuffer, VkBufferCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkCommandPool, VK_OBJECT_TYPE_COMMAND_POOL, vkCreateCommandPool, VkCommandPoolCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkFence, VK_OBJECT_TYPE_FENCE, vkCreateFence, VkFenceCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkImage, VK_OBJECT_TYPE_IMAGE, vkCreateImage, VkImageCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkImageView, VK_OBJECT_TYPE_IMAGE_VIEW, vkCreateImageView, VkImageViewCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkQueryPool, VK_OBJECT_TYPE_QUERY_POOL, vkCreateQueryPool, VkQueryPoolCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkSemaphore, VK_OBJECT_TYPE_SEMAPHORE, vkCreateSemaphore, VkSemaphoreCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkBuffer, VK_OBJECT_TYPE_BUFFER, vkDestroyBuffer)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkCommandPool, VK_OBJECT_TYPE_COMMAND_POOL, vkDestroyCommandPool)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkFence, VK_OBJECT_TYPE_FENCE, vkDestroyFence)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkImage, VK_OBJECT_TYPE_IMAGE, vkDestroyImage)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkImageView, VK_OBJECT_TYPE_IMAGE_VIEW, vkDestroyImageView)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkQueryPool, VK_OBJECT_TYPE_QUERY_POOL, vkDestroyQueryPool)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkSemaphore, VK_OBJECT_TYPE_SEMAPHORE, vkDestroySemaphore)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkDeviceMemory, VK_OBJECT_TYPE_DEVICE_MEMORY, vkFreeMemory)
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkBufferView, VK_OBJECT_TYPE_BUFFER_VIEW, vkCreateBufferView, VkBufferViewCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkDescriptorPool, VK_OBJECT_TYPE_DESCRIPTOR_POOL, vkCreateDescriptorPool,
+                               VkDescriptorPoolCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkDescriptorSetLayout, VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT, vkCreateDescriptorSetLayout,
+                               VkDescriptorSetLayoutCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkEvent, VK_OBJECT_TYPE_EVENT, vkCreateEvent, VkEventCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkPipelineCache, VK_OBJECT_TYPE_PIPELINE_CACHE, vkCreatePipelineCache,
+                               VkPipelineCacheCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkPipelineLayout, VK_OBJECT_TYPE_PIPELINE_LAYOUT, vkCreatePipelineLayout,
+                               VkPipelineLayoutCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkSampler, VK_OBJECT_TYPE_SAMPLER, vkCreateSampler, VkSamplerCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkShaderModule, VK_OBJECT_TYPE_SHADER_MODULE, vkCreateShaderModule,
+                               VkShaderModuleCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkBufferView, VK_OBJECT_TYPE_BUFFER_VIEW, vkDestroyBufferView)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkDescriptorPool, VK_OBJECT_TYPE_DESCRIPTOR_POOL, vkDestroyDescriptorPool)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkDescriptorSetLayout, VK_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT,
+                                vkDestroyDescriptorSetLayout)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkEvent, VK_OBJECT_TYPE_EVENT, vkDestroyEvent)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkPipeline, VK_OBJECT_TYPE_PIPELINE, vkDestroyPipeline)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkPipelineCache, VK_OBJECT_TYPE_PIPELINE_CACHE, vkDestroyPipelineCache)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkPipelineLayout, VK_OBJECT_TYPE_PIPELINE_LAYOUT, vkDestroyPipelineLayout)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkSampler, VK_OBJECT_TYPE_SAMPLER, vkDestroySampler)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkShaderModule, VK_OBJECT_TYPE_SHADER_MODULE, vkDestroyShaderModule)
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkFramebuffer, VK_OBJECT_TYPE_FRAMEBUFFER, vkCreateFramebuffer, VkFramebufferCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkRenderPass, VK_OBJECT_TYPE_RENDER_PASS, vkCreateRenderPass, VkRenderPassCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkFramebuffer, VK_OBJECT_TYPE_FRAMEBUFFER, vkDestroyFramebuffer)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkRenderPass, VK_OBJECT_TYPE_RENDER_PASS, vkDestroyRenderPass)
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkDescriptorUpdateTemplate, VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE,
+                               vkCreateDescriptorUpdateTemplate, VkDescriptorUpdateTemplateCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkSamplerYcbcrConversion, VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION,
+                               vkCreateSamplerYcbcrConversion, VkSamplerYcbcrConversionCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkDescriptorUpdateTemplate, VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE,
+                                vkDestroyDescriptorUpdateTemplate)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkSamplerYcbcrConversion, VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION,
+                                vkDestroySamplerYcbcrConversion)
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkRenderPass, VK_OBJECT_TYPE_RENDER_PASS, vkCreateRenderPass2, VkRenderPassCreateInfo2)
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkPrivateDataSlot, VK_OBJECT_TYPE_PRIVATE_DATA_SLOT, vkCreatePrivateDataSlot,
+                               VkPrivateDataSlotCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkPrivateDataSlot, VK_OBJECT_TYPE_PRIVATE_DATA_SLOT, vkDestroyPrivateDataSlot)
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_ARM_data_graph)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkDataGraphPipelineSessionARM, VK_OBJECT_TYPE_DATA_GRAPH_PIPELINE_SESSION_ARM,
+                               vkCreateDataGraphPipelineSessionARM, VkDataGraphPipelineSessionCreateInfoARM)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkDataGraphPipelineSessionARM, VK_OBJECT_TYPE_DATA_GRAPH_PIPELINE_SESSION_ARM,
+                                vkDestroyDataGraphPipelineSessionARM)
+#endif /* defined(VK_ARM_data_graph) */
+#if defined(VK_ARM_tensors)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkTensorARM, VK_OBJECT_TYPE_TENSOR_ARM, vkCreateTensorARM, VkTensorCreateInfoARM)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkTensorViewARM, VK_OBJECT_TYPE_TENSOR_VIEW_ARM, vkCreateTensorViewARM,
+                               VkTensorViewCreateInfoARM)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkTensorARM, VK_OBJECT_TYPE_TENSOR_ARM, vkDestroyTensorARM)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkTensorViewARM, VK_OBJECT_TYPE_TENSOR_VIEW_ARM, vkDestroyTensorViewARM)
+#endif /* defined(VK_ARM_tensors) */
+#if defined(VK_EXT_device_generated_commands)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkIndirectCommandsLayoutEXT, VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_EXT,
+                               vkCreateIndirectCommandsLayoutEXT, VkIndirectCommandsLayoutCreateInfoEXT)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkIndirectExecutionSetEXT, VK_OBJECT_TYPE_INDIRECT_EXECUTION_SET_EXT,
+                               vkCreateIndirectExecutionSetEXT, VkIndirectExecutionSetCreateInfoEXT)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkIndirectCommandsLayoutEXT, VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_EXT,
+                                vkDestroyIndirectCommandsLayoutEXT)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkIndirectExecutionSetEXT, VK_OBJECT_TYPE_INDIRECT_EXECUTION_SET_EXT,
+                                vkDestroyIndirectExecutionSetEXT)
+#endif /* defined(VK_EXT_device_generated_commands) */
+#if defined(VK_EXT_opacity_micromap)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkMicromapEXT, VK_OBJECT_TYPE_MICROMAP_EXT, vkCreateMicromapEXT, VkMicromapCreateInfoEXT)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkMicromapEXT, VK_OBJECT_TYPE_MICROMAP_EXT, vkDestroyMicromapEXT)
+#endif /* defined(VK_EXT_opacity_micromap) */
+#if defined(VK_EXT_private_data)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkPrivateDataSlot, VK_OBJECT_TYPE_PRIVATE_DATA_SLOT, vkCreatePrivateDataSlotEXT,
+                               VkPrivateDataSlotCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkPrivateDataSlot, VK_OBJECT_TYPE_PRIVATE_DATA_SLOT, vkDestroyPrivateDataSlotEXT)
+#endif /* defined(VK_EXT_private_data) */
+#if defined(VK_EXT_shader_object)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkShaderEXT, VK_OBJECT_TYPE_SHADER_EXT, vkDestroyShaderEXT)
+#endif /* defined(VK_EXT_shader_object) */
+#if defined(VK_EXT_validation_cache)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkValidationCacheEXT, VK_OBJECT_TYPE_VALIDATION_CACHE_EXT, vkCreateValidationCacheEXT,
+                               VkValidationCacheCreateInfoEXT)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkValidationCacheEXT, VK_OBJECT_TYPE_VALIDATION_CACHE_EXT, vkDestroyValidationCacheEXT)
+#endif /* defined(VK_EXT_validation_cache) */
+#if defined(VK_FUCHSIA_buffer_collection)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkBufferCollectionFUCHSIA, VK_OBJECT_TYPE_BUFFER_COLLECTION_FUCHSIA,
+                               vkCreateBufferCollectionFUCHSIA, VkBufferCollectionCreateInfoFUCHSIA)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkBufferCollectionFUCHSIA, VK_OBJECT_TYPE_BUFFER_COLLECTION_FUCHSIA,
+                                vkDestroyBufferCollectionFUCHSIA)
+#endif /* defined(VK_FUCHSIA_buffer_collection) */
+#if defined(VK_KHR_acceleration_structure)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkAccelerationStructureKHR, VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR,
+                               vkCreateAccelerationStructureKHR, VkAccelerationStructureCreateInfoKHR)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkAccelerationStructureKHR, VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR,
+                                vkDestroyAccelerationStructureKHR)
+#endif /* defined(VK_KHR_acceleration_structure) */
+#if defined(VK_KHR_create_renderpass2)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkRenderPass, VK_OBJECT_TYPE_RENDER_PASS, vkCreateRenderPass2KHR,
+                               VkRenderPassCreateInfo2)
+#endif /* defined(VK_KHR_create_renderpass2) */
+#if defined(VK_KHR_deferred_host_operations)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkDeferredOperationKHR, VK_OBJECT_TYPE_DEFERRED_OPERATION_KHR,
+                                vkDestroyDeferredOperationKHR)
+#endif /* defined(VK_KHR_deferred_host_operations) */
+#if defined(VK_KHR_descriptor_update_template)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkDescriptorUpdateTemplate, VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE,
+                               vkCreateDescriptorUpdateTemplateKHR, VkDescriptorUpdateTemplateCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkDescriptorUpdateTemplate, VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE,
+                                vkDestroyDescriptorUpdateTemplateKHR)
+#endif /* defined(VK_KHR_descriptor_update_template) */
+#if defined(VK_KHR_pipeline_binary)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkPipelineBinaryKHR, VK_OBJECT_TYPE_PIPELINE_BINARY_KHR, vkDestroyPipelineBinaryKHR)
+#endif /* defined(VK_KHR_pipeline_binary) */
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkSamplerYcbcrConversion, VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION,
+                               vkCreateSamplerYcbcrConversionKHR, VkSamplerYcbcrConversionCreateInfo)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkSamplerYcbcrConversion, VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION,
+                                vkDestroySamplerYcbcrConversionKHR)
+#endif /* defined(VK_KHR_sampler_ycbcr_conversion) */
+#if defined(VK_KHR_swapchain)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkSwapchainKHR, VK_OBJECT_TYPE_SWAPCHAIN_KHR, vkCreateSwapchainKHR,
+                               VkSwapchainCreateInfoKHR)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkSwapchainKHR, VK_OBJECT_TYPE_SWAPCHAIN_KHR, vkDestroySwapchainKHR)
+#endif /* defined(VK_KHR_swapchain) */
+#if defined(VK_KHR_video_queue)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkVideoSessionKHR, VK_OBJECT_TYPE_VIDEO_SESSION_KHR, vkCreateVideoSessionKHR,
+                               VkVideoSessionCreateInfoKHR)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkVideoSessionParametersKHR, VK_OBJECT_TYPE_VIDEO_SESSION_PARAMETERS_KHR,
+                               vkCreateVideoSessionParametersKHR, VkVideoSessionParametersCreateInfoKHR)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkVideoSessionKHR, VK_OBJECT_TYPE_VIDEO_SESSION_KHR, vkDestroyVideoSessionKHR)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkVideoSessionParametersKHR, VK_OBJECT_TYPE_VIDEO_SESSION_PARAMETERS_KHR,
+                                vkDestroyVideoSessionParametersKHR)
+#endif /* defined(VK_KHR_video_queue) */
+#if defined(VK_NVX_binary_import)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkCuFunctionNVX, VK_OBJECT_TYPE_CU_FUNCTION_NVX, vkCreateCuFunctionNVX,
+                               VkCuFunctionCreateInfoNVX)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkCuModuleNVX, VK_OBJECT_TYPE_CU_MODULE_NVX, vkCreateCuModuleNVX,
+                               VkCuModuleCreateInfoNVX)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkCuFunctionNVX, VK_OBJECT_TYPE_CU_FUNCTION_NVX, vkDestroyCuFunctionNVX)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkCuModuleNVX, VK_OBJECT_TYPE_CU_MODULE_NVX, vkDestroyCuModuleNVX)
+#endif /* defined(VK_NVX_binary_import) */
+#if defined(VK_NV_cuda_kernel_launch)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkCudaFunctionNV, VK_OBJECT_TYPE_CUDA_FUNCTION_NV, vkCreateCudaFunctionNV,
+                               VkCudaFunctionCreateInfoNV)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkCudaModuleNV, VK_OBJECT_TYPE_CUDA_MODULE_NV, vkCreateCudaModuleNV,
+                               VkCudaModuleCreateInfoNV)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkCudaFunctionNV, VK_OBJECT_TYPE_CUDA_FUNCTION_NV, vkDestroyCudaFunctionNV)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkCudaModuleNV, VK_OBJECT_TYPE_CUDA_MODULE_NV, vkDestroyCudaModuleNV)
+#endif /* defined(VK_NV_cuda_kernel_launch) */
+#if defined(VK_NV_device_generated_commands)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkIndirectCommandsLayoutNV, VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_NV,
+                               vkCreateIndirectCommandsLayoutNV, VkIndirectCommandsLayoutCreateInfoNV)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkIndirectCommandsLayoutNV, VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_NV,
+                                vkDestroyIndirectCommandsLayoutNV)
+#endif /* defined(VK_NV_device_generated_commands) */
+#if defined(VK_NV_external_compute_queue)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkExternalComputeQueueNV, VK_OBJECT_TYPE_EXTERNAL_COMPUTE_QUEUE_NV,
+                               vkCreateExternalComputeQueueNV, VkExternalComputeQueueCreateInfoNV)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkExternalComputeQueueNV, VK_OBJECT_TYPE_EXTERNAL_COMPUTE_QUEUE_NV,
+                                vkDestroyExternalComputeQueueNV)
+#endif /* defined(VK_NV_external_compute_queue) */
+#if defined(VK_NV_optical_flow)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkOpticalFlowSessionNV, VK_OBJECT_TYPE_OPTICAL_FLOW_SESSION_NV,
+                               vkCreateOpticalFlowSessionNV, VkOpticalFlowSessionCreateInfoNV)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkOpticalFlowSessionNV, VK_OBJECT_TYPE_OPTICAL_FLOW_SESSION_NV,
+                                vkDestroyOpticalFlowSessionNV)
+#endif /* defined(VK_NV_optical_flow) */
+#if defined(VK_NV_ray_tracing)
+VOLK_CPP_DEFINE_TRACKED_CREATE(VkAccelerationStructureNV, VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_NV,
+                               vkCreateAccelerationStructureNV, VkAccelerationStructureCreateInfoNV)
+VOLK_CPP_DEFINE_TRACKED_DESTROY(VkAccelerationStructureNV, VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_NV,
+                                vkDestroyAccelerationStructureNV)
+#endif /* defined(VK_NV_ray_tracing) */
+/* VOLK_CPP_GENERATE_TRACKED_DEFINITIONS */
+
+#undef VOLK_CPP_DEFINE_TRACKED_CREATE
+#undef VOLK_CPP_DEFINE_TRACKED_DESTROY
+
+#if defined(VK_BASE_VERSION_1_0)
+VkResult VolkObjectTracker::vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                                     VkCommandBuffer* pCommandBuffers) noexcept {
+  auto result = volk_.vkAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+  if (result == VK_SUCCESS) {
+    auto const pool = getHandleValue(pAllocateInfo->commandPool);
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+      track(device, VK_OBJECT_TYPE_COMMAND_BUFFER, getHandleValue(pCommandBuffers[i]));
+      addChild(VK_OBJECT_TYPE_COMMAND_BUFFER, pool, getHandleValue(pCommandBuffers[i]));
+    }
+  }
+  return result;
+}
+
+void VolkObjectTracker::vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                                             const VkCommandBuffer* pCommandBuffers) noexcept {
+  for (uint32_t i = 0; i < commandBufferCount; ++i) {
+    if (pCommandBuffers[i] != VK_NULL_HANDLE) {
+      removeChild(VK_OBJECT_TYPE_COMMAND_BUFFER, getHandleValue(commandPool), getHandleValue(pCommandBuffers[i]));
+      untrack(VK_OBJECT_TYPE_COMMAND_BUFFER, getHandleValue(pCommandBuffers[i]));
+    }
+  }
+  volk_.vkFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+void VolkObjectTracker::vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) noexcept {
+  std::vector<std::pair<uint64_t, Entry>> leaks;
+  handles_.forEach([device, &leaks](uint64_t handle, Entry const& entry) {
+    if (entry.device == device) {
+      leaks.emplace_back(handle, entry);
+    }
+  });
+
+  for (auto const& [handle, entry] : leaks) {
+    if (!handles_.erase(handle, nullptr, entry.objectType)) {
+      continue;
+    }
+    if (entry.objectType == VK_OBJECT_TYPE_COMMAND_POOL || entry.objectType == VK_OBJECT_TYPE_DESCRIPTOR_POOL) {
+      // The children are reported on their own; only the index goes away with the pool.
+      Children* children = nullptr;
+      auto const childType = entry.objectType == VK_OBJECT_TYPE_COMMAND_POOL ? VK_OBJECT_TYPE_COMMAND_BUFFER
+                                                                             : VK_OBJECT_TYPE_DESCRIPTOR_SET;
+      if (children_.erase(handle, &children, childType)) {
+        delete children;
+      }
+    }
+    auto& counters = types_[getTypeIndex(entry.objectType)];
+    counters.live.fetch_sub(1, std::memory_order_relaxed);
+    counters.leaked.fetch_add(1, std::memory_order_relaxed);
+    if (leakCallback_) {
+      leakCallback_(device, entry.objectType, handle);
+    }
+  }
+
+  volk_.vkDestroyDevice(device, pAllocator);
+}
+#endif /* defined(VK_BASE_VERSION_1_0) */
+
+#if defined(VK_COMPUTE_VERSION_1_0)
+VkResult VolkObjectTracker::vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo,
+                                                     VkDescriptorSet* pDescriptorSets) noexcept {
+  auto result = volk_.vkAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+  if (result == VK_SUCCESS) {
+    auto const pool = getHandleValue(pAllocateInfo->descriptorPool);
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
+      track(device, VK_OBJECT_TYPE_DESCRIPTOR_SET, getHandleValue(pDescriptorSets[i]));
+      addChild(VK_OBJECT_TYPE_DESCRIPTOR_SET, pool, getHandleValue(pDescriptorSets[i]));
+    }
+  }
+  return result;
+}
+
+VkResult VolkObjectTracker::vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool,
+                                                 uint32_t descriptorSetCount,
+                                                 const VkDescriptorSet* pDescriptorSets) noexcept {
+  for (uint32_t i = 0; i < descriptorSetCount; ++i) {
+    if (pDescriptorSets[i] != VK_NULL_HANDLE) {
+      removeChild(VK_OBJECT_TYPE_DESCRIPTOR_SET, getHandleValue(descriptorPool), getHandleValue(pDescriptorSets[i]));
+      untrack(VK_OBJECT_TYPE_DESCRIPTOR_SET, getHandleValue(pDescriptorSets[i]));
+    }
+  }
+  return volk_.vkFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+
+VkResult VolkObjectTracker::vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                                  VkDescriptorPoolResetFlags flags) noexcept {
+  untrackChildren(VK_OBJECT_TYPE_DESCRIPTOR_SET, getHandleValue(descriptorPool));
+  return volk_.vkResetDescriptorPool(device, descriptorPool, flags);
+}
+
+VkResult VolkObjectTracker::vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                     uint32_t createInfoCount,
+                                                     const VkComputePipelineCreateInfo* pCreateInfos,
+                                                     const VkAllocationCallbacks* pAllocator,
+                                                     VkPipeline* pPipelines) noexcept {
+  auto result = volk_.vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                               pPipelines);
+  // Pipelines which failed are set to VK_NULL_HANDLE, the others are valid even if the result is an error.
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    if (pPipelines[i] != VK_NULL_HANDLE) {
+      track(device, VK_OBJECT_TYPE_PIPELINE, getHandleValue(pPipelines[i]));
+    }
+  }
+  return result;
+}
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+
+#if defined(VK_GRAPHICS_VERSION_1_0)
+VkResult VolkObjectTracker::vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                      uint32_t createInfoCount,
+                                                      const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                                      const VkAllocationCallbacks* pAllocator,
+                                                      VkPipeline* pPipelines) noexcept {
+  auto result = volk_.vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                                pPipelines);
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    if (pPipelines[i] != VK_NULL_HANDLE) {
+      track(device, VK_OBJECT_TYPE_PIPELINE, getHandleValue(pPipelines[i]));
+    }
+  }
+  return result;
+}
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+
+#if defined(VK_EXT_shader_object)
+VkResult VolkObjectTracker::vkCreateShadersEXT(VkDevice device, uint32_t createInfoCount,
+                                               const VkShaderCreateInfoEXT* pCreateInfos,
+                                               const VkAllocationCallbacks* pAllocator,
+                                               VkShaderEXT* pShaders) noexcept {
+  auto result = volk_.vkCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders);
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    if (pShaders[i] != VK_NULL_HANDLE) {
+      track(device, VK_OBJECT_TYPE_SHADER_EXT, getHandleValue(pShaders[i]));
+    }
+  }
+  return result;
+}
+#endif
+
+void VolkObjectTracker::track(VkDevice device, VkObjectType objectType, uint64_t handle) noexcept {
+  auto& counters = types_[getTypeIndex(objectType)];
+  counters.created.fetch_add(1, std::memory_order_relaxed);
+  auto const live = counters.live.fetch_add(1, std::memory_order_relaxed) + 1;
+  auto highWater = counters.highWater.load(std::memory_order_relaxed);
+  while (highWater < live && !counters.highWater.compare_exchange_weak(highWater, live, std::memory_order_relaxed)) {
+  }
+
+  if (!handles_.insert(handle, Entry{objectType, device}, objectType)) {
+    untracked_.fetch_add(1, std::memory_order_relaxed);
+    counters.liveUntracked.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+void VolkObjectTracker::untrack(VkObjectType objectType, uint64_t handle) noexcept {
+  auto& counters = types_[getTypeIndex(objectType)];
+  bool live = handles_.erase(handle, nullptr, objectType);
+  if (!live) {
+    // Handles which didn't fit into the table can't be told apart from unknown ones; count them down until none left.
+    auto liveUntracked = counters.liveUntracked.load(std::memory_order_relaxed);
+    while (liveUntracked > 0 && !counters.liveUntracked.compare_exchange_weak(liveUntracked, liveUntracked - 1,
+                                                                              std::memory_order_relaxed)) {
+    }
+    live = liveUntracked > 0;
+  }
+  if (live) {
+    counters.destroyed.fetch_add(1, std::memory_order_relaxed);
+    counters.live.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Destroying a pool frees everything allocated from it.
+  if (objectType == VK_OBJECT_TYPE_COMMAND_POOL) {
+    untrackChildren(VK_OBJECT_TYPE_COMMAND_BUFFER, handle);
+  } else if (objectType == VK_OBJECT_TYPE_DESCRIPTOR_POOL) {
+    untrackChildren(VK_OBJECT_TYPE_DESCRIPTOR_SET, handle);
+  }
+}
+
+void VolkObjectTracker::addChild(VkObjectType childType, uint64_t parent, uint64_t child) noexcept {
+  Children* children = nullptr;
+  if (!children_.find(parent, &children, childType)) {
+    children = new Children;
+    if (!children_.insert(parent, children, childType)) {
+      // The index is full: the child is still tracked, but only freeing it releases it.
+      delete children;
+      return;
+    }
+  }
+  children->handles.insert(child);
+}
+
+void VolkObjectTracker::removeChild(VkObjectType childType, uint64_t parent, uint64_t child) noexcept {
+  Children* children = nullptr;
+  if (children_.find(parent, &children, childType)) {
+    children->handles.erase(child);
+  }
+}
+
+void VolkObjectTracker::untrackChildren(VkObjectType childType, uint64_t parent) noexcept {
+  Children* children = nullptr;
+  if (!children_.erase(parent, &children, childType)) {
+    return;
+  }
+  for (auto child : children->handles) {
+    untrack(childType, child);
+  }
+  delete children;
+}
+
+uint32_t VolkObjectTracker::getTypeIndex(VkObjectType objectType) noexcept {
+  if (static_cast<uint32_t>(objectType) <= VK_OBJECT_TYPE_COMMAND_POOL) {
+    return static_cast<uint32_t>(objectType);
+  }
+  switch (objectType) {
+  /* VOLK_CPP_GENERATE_TRACKED_TYPES */
+#if defined(VK_COMPUTE_VERSION_1_1) || defined(VK_KHR_descriptor_update_template)
+  case VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 1;
+#endif
+#if defined(VK_COMPUTE_VERSION_1_1) || defined(VK_KHR_sampler_ycbcr_conversion)
+  case VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 2;
+#endif
+#if defined(VK_BASE_VERSION_1_3) || defined(VK_EXT_private_data)
+  case VK_OBJECT_TYPE_PRIVATE_DATA_SLOT:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 3;
+#endif
+#if defined(VK_ARM_data_graph)
+  case VK_OBJECT_TYPE_DATA_GRAPH_PIPELINE_SESSION_ARM:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 4;
+#endif
+#if defined(VK_ARM_tensors)
+  case VK_OBJECT_TYPE_TENSOR_ARM:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 5;
+#endif
+#if defined(VK_ARM_tensors)
+  case VK_OBJECT_TYPE_TENSOR_VIEW_ARM:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 6;
+#endif
+#if defined(VK_EXT_device_generated_commands)
+  case VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_EXT:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 7;
+#endif
+#if defined(VK_EXT_device_generated_commands)
+  case VK_OBJECT_TYPE_INDIRECT_EXECUTION_SET_EXT:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 8;
+#endif
+#if defined(VK_EXT_opacity_micromap)
+  case VK_OBJECT_TYPE_MICROMAP_EXT:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 9;
+#endif
+#if defined(VK_EXT_shader_object)
+  case VK_OBJECT_TYPE_SHADER_EXT:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 10;
+#endif
+#if defined(VK_EXT_validation_cache)
+  case VK_OBJECT_TYPE_VALIDATION_CACHE_EXT:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 11;
+#endif
+#if defined(VK_FUCHSIA_buffer_collection)
+  case VK_OBJECT_TYPE_BUFFER_COLLECTION_FUCHSIA:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 12;
+#endif
+#if defined(VK_KHR_acceleration_structure)
+  case VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_KHR:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 13;
+#endif
+#if defined(VK_KHR_deferred_host_operations)
+  case VK_OBJECT_TYPE_DEFERRED_OPERATION_KHR:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 14;
+#endif
+#if defined(VK_KHR_pipeline_binary)
+  case VK_OBJECT_TYPE_PIPELINE_BINARY_KHR:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 15;
+#endif
+#if defined(VK_KHR_swapchain)
+  case VK_OBJECT_TYPE_SWAPCHAIN_KHR:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 16;
+#endif
+#if defined(VK_KHR_video_queue)
+  case VK_OBJECT_TYPE_VIDEO_SESSION_KHR:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 17;
+#endif
+#if defined(VK_KHR_video_queue)
+  case VK_OBJECT_TYPE_VIDEO_SESSION_PARAMETERS_KHR:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 18;
+#endif
+#if defined(VK_NVX_binary_import)
+  case VK_OBJECT_TYPE_CU_FUNCTION_NVX:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 19;
+#endif
+#if defined(VK_NVX_binary_import)
+  case VK_OBJECT_TYPE_CU_MODULE_NVX:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 20;
+#endif
+#if defined(VK_NV_cuda_kernel_launch)
+  case VK_OBJECT_TYPE_CUDA_FUNCTION_NV:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 21;
+#endif
+#if defined(VK_NV_cuda_kernel_launch)
+  case VK_OBJECT_TYPE_CUDA_MODULE_NV:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 22;
+#endif
+#if defined(VK_NV_device_generated_commands)
+  case VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_NV:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 23;
+#endif
+#if defined(VK_NV_external_compute_queue)
+  case VK_OBJECT_TYPE_EXTERNAL_COMPUTE_QUEUE_NV:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 24;
+#endif
+#if defined(VK_NV_optical_flow)
+  case VK_OBJECT_TYPE_OPTICAL_FLOW_SESSION_NV:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 25;
+#endif
+#if defined(VK_NV_ray_tracing)
+  case VK_OBJECT_TYPE_ACCELERATION_STRUCTURE_NV:
+    return VK_OBJECT_TYPE_COMMAND_POOL + 26;
+#endif
+  /* VOLK_CPP_GENERATE_TRACKED_TYPES */
+  default:
+    return kTypeCount - 1;
+  }
+}
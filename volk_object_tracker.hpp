@@ -0,0 +1,291 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_handle_table.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+
+/**
+ * Object lifetime and leak tracker.
+ *
+ * Creation and destruction calls that should be tracked go through the forwarding methods of this class. Live counts,
+ * high-water marks and totals are kept per VkObjectType in relaxed atomics, and live handles are kept in a lock-free
+ * VolkHandleTable, keyed by object type and handle, so that outstanding handles can be reported when their device is
+ * destroyed. The forwarding methods for single-object create/destroy pairs are generated from the registry; batched
+ * creation and pool allocations are hand-written. Command buffers and descriptor sets are also indexed by their pool in
+ * a second handle table, so that releasing them with the pool costs as much as the number of children. Destroying a
+ * handle that isn't live leaves the counters unchanged.
+ */
+class VolkObjectTracker final {
+public:
+  /* VOLK_CPP_GENERATE_TRACKED_TYPE_COUNT */
+  static constexpr uint32_t kTypeCount = 53;
+  /* VOLK_CPP_GENERATE_TRACKED_TYPE_COUNT */
+
+  struct TypeStats {
+    uint64_t created = 0;
+    uint64_t destroyed = 0;
+    uint64_t live = 0;
+    uint64_t highWater = 0;
+    uint64_t leaked = 0; // still alive when their device was destroyed
+  };
+
+  /**
+   * Called from vkDestroyDevice() for every handle of that device which hasn't been destroyed.
+   */
+  using LeakCallback = std::function<void(VkDevice device, VkObjectType objectType, uint64_t handle)>;
+
+  /**
+   * Volk must have device function pointers loaded. capacity is the number of handles that can be tracked at once;
+   * handles beyond it are still counted but can't be reported as leaks.
+   */
+  explicit VolkObjectTracker(Volk& volk, uint32_t capacity = 65536, LeakCallback leakCallback = {}) noexcept;
+  VolkObjectTracker(const VolkObjectTracker&) = delete;
+  VolkObjectTracker& operator=(const VolkObjectTracker&) = delete;
+  ~VolkObjectTracker();
+
+  [[nodiscard]] TypeStats getStats(VkObjectType objectType) const noexcept;
+  [[nodiscard]] uint64_t getUntrackedCount() const noexcept;
+
+#define VOLK_CPP_DECLARE_TRACKED_CREATE(Type, Create, CreateInfo) \
+  VkResult Create(VkDevice device, const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, \
+                  Type* pObject) noexcept;
+#define VOLK_CPP_DECLARE_TRACKED_DESTROY(Type, Destroy) \
+  void Destroy(VkDevice device, Type object, const VkAllocationCallbacks* pAllocator) noexcept;
+
+  /* VOLK_CPP_GENERATE_TRACKED_DECLARATIONS */
+#if defined(VK_BASE_VERSION_1_0)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkDeviceMemory, vkAllocateMemory, VkMemoryAllocateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkBuffer, vkCreateBuffer, VkBufferCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkCommandPool, vkCreateCommandPool, VkCommandPoolCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkFence, vkCreateFence, VkFenceCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkImage, vkCreateImage, VkImageCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkImageView, vkCreateImageView, VkImageViewCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkQueryPool, vkCreateQueryPool, VkQueryPoolCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkSemaphore, vkCreateSemaphore, VkSemaphoreCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkBuffer, vkDestroyBuffer)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkCommandPool, vkDestroyCommandPool)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkFence, vkDestroyFence)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkImage, vkDestroyImage)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkImageView, vkDestroyImageView)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkQueryPool, vkDestroyQueryPool)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkSemaphore, vkDestroySemaphore)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkDeviceMemory, vkFreeMemory)
+#endif /* defined(VK_BASE_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_0)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkBufferView, vkCreateBufferView, VkBufferViewCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkDescriptorPool, vkCreateDescriptorPool, VkDescriptorPoolCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkDescriptorSetLayout, vkCreateDescriptorSetLayout, VkDescriptorSetLayoutCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkEvent, vkCreateEvent, VkEventCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkPipelineCache, vkCreatePipelineCache, VkPipelineCacheCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkPipelineLayout, vkCreatePipelineLayout, VkPipelineLayoutCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkSampler, vkCreateSampler, VkSamplerCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkShaderModule, vkCreateShaderModule, VkShaderModuleCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkBufferView, vkDestroyBufferView)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkDescriptorPool, vkDestroyDescriptorPool)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkDescriptorSetLayout, vkDestroyDescriptorSetLayout)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkEvent, vkDestroyEvent)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkPipeline, vkDestroyPipeline)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkPipelineCache, vkDestroyPipelineCache)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkPipelineLayout, vkDestroyPipelineLayout)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkSampler, vkDestroySampler)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkShaderModule, vkDestroyShaderModule)
+#endif /* defined(VK_COMPUTE_VERSION_1_0) */
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkFramebuffer, vkCreateFramebuffer, VkFramebufferCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkRenderPass, vkCreateRenderPass, VkRenderPassCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkFramebuffer, vkDestroyFramebuffer)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkRenderPass, vkDestroyRenderPass)
+#endif /* defined(VK_GRAPHICS_VERSION_1_0) */
+#if defined(VK_COMPUTE_VERSION_1_1)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkDescriptorUpdateTemplate, vkCreateDescriptorUpdateTemplate,
+                                  VkDescriptorUpdateTemplateCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkSamplerYcbcrConversion, vkCreateSamplerYcbcrConversion,
+                                  VkSamplerYcbcrConversionCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkDescriptorUpdateTemplate, vkDestroyDescriptorUpdateTemplate)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkSamplerYcbcrConversion, vkDestroySamplerYcbcrConversion)
+#endif /* defined(VK_COMPUTE_VERSION_1_1) */
+#if defined(VK_GRAPHICS_VERSION_1_2)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkRenderPass, vkCreateRenderPass2, VkRenderPassCreateInfo2)
+#endif /* defined(VK_GRAPHICS_VERSION_1_2) */
+#if defined(VK_BASE_VERSION_1_3)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkPrivateDataSlot, vkCreatePrivateDataSlot, VkPrivateDataSlotCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkPrivateDataSlot, vkDestroyPrivateDataSlot)
+#endif /* defined(VK_BASE_VERSION_1_3) */
+#if defined(VK_ARM_data_graph)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkDataGraphPipelineSessionARM, vkCreateDataGraphPipelineSessionARM,
+                                  VkDataGraphPipelineSessionCreateInfoARM)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkDataGraphPipelineSessionARM, vkDestroyDataGraphPipelineSessionARM)
+#endif /* defined(VK_ARM_data_graph) */
+#if defined(VK_ARM_tensors)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkTensorARM, vkCreateTensorARM, VkTensorCreateInfoARM)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkTensorViewARM, vkCreateTensorViewARM, VkTensorViewCreateInfoARM)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkTensorARM, vkDestroyTensorARM)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkTensorViewARM, vkDestroyTensorViewARM)
+#endif /* defined(VK_ARM_tensors) */
+#if defined(VK_EXT_device_generated_commands)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkIndirectCommandsLayoutEXT, vkCreateIndirectCommandsLayoutEXT,
+                                  VkIndirectCommandsLayoutCreateInfoEXT)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkIndirectExecutionSetEXT, vkCreateIndirectExecutionSetEXT,
+                                  VkIndirectExecutionSetCreateInfoEXT)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkIndirectCommandsLayoutEXT, vkDestroyIndirectCommandsLayoutEXT)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkIndirectExecutionSetEXT, vkDestroyIndirectExecutionSetEXT)
+#endif /* defined(VK_EXT_device_generated_commands) */
+#if defined(VK_EXT_opacity_micromap)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkMicromapEXT, vkCreateMicromapEXT, VkMicromapCreateInfoEXT)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkMicromapEXT, vkDestroyMicromapEXT)
+#endif /* defined(VK_EXT_opacity_micromap) */
+#if defined(VK_EXT_private_data)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkPrivateDataSlot, vkCreatePrivateDataSlotEXT, VkPrivateDataSlotCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkPrivateDataSlot, vkDestroyPrivateDataSlotEXT)
+#endif /* defined(VK_EXT_private_data) */
+#if defined(VK_EXT_shader_object)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkShaderEXT, vkDestroyShaderEXT)
+#endif /* defined(VK_EXT_shader_object) */
+#if defined(VK_EXT_validation_cache)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkValidationCacheEXT, vkCreateValidationCacheEXT, VkValidationCacheCreateInfoEXT)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkValidationCacheEXT, vkDestroyValidationCacheEXT)
+#endif /* defined(VK_EXT_validation_cache) */
+#if defined(VK_FUCHSIA_buffer_collection)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkBufferCollectionFUCHSIA, vkCreateBufferCollectionFUCHSIA,
+                                  VkBufferCollectionCreateInfoFUCHSIA)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkBufferCollectionFUCHSIA, vkDestroyBufferCollectionFUCHSIA)
+#endif /* defined(VK_FUCHSIA_buffer_collection) */
+#if defined(VK_KHR_acceleration_structure)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkAccelerationStructureKHR, vkCreateAccelerationStructureKHR,
+                                  VkAccelerationStructureCreateInfoKHR)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkAccelerationStructureKHR, vkDestroyAccelerationStructureKHR)
+#endif /* defined(VK_KHR_acceleration_structure) */
+#if defined(VK_KHR_create_renderpass2)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkRenderPass, vkCreateRenderPass2KHR, VkRenderPassCreateInfo2)
+#endif /* defined(VK_KHR_create_renderpass2) */
+#if defined(VK_KHR_deferred_host_operations)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkDeferredOperationKHR, vkDestroyDeferredOperationKHR)
+#endif /* defined(VK_KHR_deferred_host_operations) */
+#if defined(VK_KHR_descriptor_update_template)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkDescriptorUpdateTemplate, vkCreateDescriptorUpdateTemplateKHR,
+                                  VkDescriptorUpdateTemplateCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkDescriptorUpdateTemplate, vkDestroyDescriptorUpdateTemplateKHR)
+#endif /* defined(VK_KHR_descriptor_update_template) */
+#if defined(VK_KHR_pipeline_binary)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkPipelineBinaryKHR, vkDestroyPipelineBinaryKHR)
+#endif /* defined(VK_KHR_pipeline_binary) */
+#if defined(VK_KHR_sampler_ycbcr_conversion)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkSamplerYcbcrConversion, vkCreateSamplerYcbcrConversionKHR,
+                                  VkSamplerYcbcrConversionCreateInfo)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkSamplerYcbcrConversion, vkDestroySamplerYcbcrConversionKHR)
+#endif /* defined(VK_KHR_sampler_ycbcr_conversion) */
+#if defined(VK_KHR_swapchain)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkSwapchainKHR, vkCreateSwapchainKHR, VkSwapchainCreateInfoKHR)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkSwapchainKHR, vkDestroySwapchainKHR)
+#endif /* defined(VK_KHR_swapchain) */
+#if defined(VK_KHR_video_queue)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkVideoSessionKHR, vkCreateVideoSessionKHR, VkVideoSessionCreateInfoKHR)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkVideoSessionParametersKHR, vkCreateVideoSessionParametersKHR,
+                                  VkVideoSessionParametersCreateInfoKHR)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkVideoSessionKHR, vkDestroyVideoSessionKHR)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkVideoSessionParametersKHR, vkDestroyVideoSessionParametersKHR)
+#endif /* defined(VK_KHR_video_queue) */
+#if defined(VK_NVX_binary_import)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkCuFunctionNVX, vkCreateCuFunctionNVX, VkCuFunctionCreateInfoNVX)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkCuModuleNVX, vkCreateCuModuleNVX, VkCuModuleCreateInfoNVX)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkCuFunctionNVX, vkDestroyCuFunctionNVX)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkCuModuleNVX, vkDestroyCuModuleNVX)
+#endif /* defined(VK_NVX_binary_import) */
+#if defined(VK_NV_cuda_kernel_launch)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkCudaFunctionNV, vkCreateCudaFunctionNV, VkCudaFunctionCreateInfoNV)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkCudaModuleNV, vkCreateCudaModuleNV, VkCudaModuleCreateInfoNV)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkCudaFunctionNV, vkDestroyCudaFunctionNV)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkCudaModuleNV, vkDestroyCudaModuleNV)
+#endif /* defined(VK_NV_cuda_kernel_launch) */
+#if defined(VK_NV_device_generated_commands)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkIndirectCommandsLayoutNV, vkCreateIndirectCommandsLayoutNV,
+                                  VkIndirectCommandsLayoutCreateInfoNV)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkIndirectCommandsLayoutNV, vkDestroyIndirectCommandsLayoutNV)
+#endif /* defined(VK_NV_device_generated_commands) */
+#if defined(VK_NV_external_compute_queue)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkExternalComputeQueueNV, vkCreateExternalComputeQueueNV,
+                                  VkExternalComputeQueueCreateInfoNV)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkExternalComputeQueueNV, vkDestroyExternalComputeQueueNV)
+#endif /* defined(VK_NV_external_compute_queue) */
+#if defined(VK_NV_optical_flow)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkOpticalFlowSessionNV, vkCreateOpticalFlowSessionNV,
+                                  VkOpticalFlowSessionCreateInfoNV)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkOpticalFlowSessionNV, vkDestroyOpticalFlowSessionNV)
+#endif /* defined(VK_NV_optical_flow) */
+#if defined(VK_NV_ray_tracing)
+  VOLK_CPP_DECLARE_TRACKED_CREATE(VkAccelerationStructureNV, vkCreateAccelerationStructureNV,
+                                  VkAccelerationStructureCreateInfoNV)
+  VOLK_CPP_DECLARE_TRACKED_DESTROY(VkAccelerationStructureNV, vkDestroyAccelerationStructureNV)
+#endif /* defined(VK_NV_ray_tracing) */
+  /* VOLK_CPP_GENERATE_TRACKED_DECLARATIONS */
+
+#undef VOLK_CPP_DECLARE_TRACKED_CREATE
+#undef VOLK_CPP_DECLARE_TRACKED_DESTROY
+
+#if defined(VK_BASE_VERSION_1_0)
+  VkResult vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
+                                    VkCommandBuffer* pCommandBuffers) noexcept;
+  void vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
+                            const VkCommandBuffer* pCommandBuffers) noexcept;
+  void vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) noexcept;
+#endif
+#if defined(VK_COMPUTE_VERSION_1_0)
+  VkResult vkAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo,
+                                    VkDescriptorSet* pDescriptorSets) noexcept;
+  VkResult vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
+                                const VkDescriptorSet* pDescriptorSets) noexcept;
+  VkResult vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
+                                 VkDescriptorPoolResetFlags flags) noexcept;
+  VkResult vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                    const VkComputePipelineCreateInfo* pCreateInfos,
+                                    const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) noexcept;
+#endif
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  VkResult vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                     const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                     const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) noexcept;
+#endif
+#if defined(VK_EXT_shader_object)
+  VkResult vkCreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos,
+                              const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders) noexcept;
+#endif
+
+private:
+  struct Entry {
+    VkObjectType objectType = VK_OBJECT_TYPE_UNKNOWN;
+    VkDevice device = VK_NULL_HANDLE;
+  };
+
+  struct TypeCounters {
+    std::atomic<uint64_t> created = 0;
+    std::atomic<uint64_t> destroyed = 0;
+    std::atomic<uint64_t> live = 0;
+    std::atomic<uint64_t> highWater = 0;
+    std::atomic<uint64_t> leaked = 0;
+    std::atomic<uint64_t> liveUntracked = 0; // live objects which didn't fit into the handle table
+  };
+
+  // Children of one pool; pools are externally synchronized, so only the pool's owner touches the set.
+  struct Children {
+    std::unordered_set<uint64_t> handles;
+  };
+
+  void track(VkDevice device, VkObjectType objectType, uint64_t handle) noexcept;
+  void untrack(VkObjectType objectType, uint64_t handle) noexcept;
+  void addChild(VkObjectType childType, uint64_t parent, uint64_t child) noexcept;
+  void removeChild(VkObjectType childType, uint64_t parent, uint64_t child) noexcept;
+  void untrackChildren(VkObjectType childType, uint64_t parent) noexcept;
+  [[nodiscard]] static uint32_t getTypeIndex(VkObjectType objectType) noexcept;
+
+  Volk& volk_;
+  LeakCallback leakCallback_;
+  VolkHandleTable<Entry> handles_;
+  TypeCounters types_[kTypeCount];
+  std::atomic<uint64_t> untracked_ = 0;
+  VolkHandleTable<Children*> children_; // keyed by pool handle and child type
+};
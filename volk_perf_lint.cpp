@@ -0,0 +1,170 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_perf_lint.hpp"
+
+VolkPerfLint::VolkPerfLint(Volk& volk, bool captureCallSites /* = true */) noexcept
+  : volk_(volk)
+  , captureCallSites_(captureCallSites) {}
+
+VkResult VolkPerfLint::vkQueueWaitIdle(VkQueue queue, std::source_location location) noexcept {
+  if (inFrameLoop()) {
+    report(Pattern::WaitIdle, location);
+  }
+  return volk_.vkQueueWaitIdle(queue);
+}
+
+VkResult VolkPerfLint::vkDeviceWaitIdle(VkDevice device, std::source_location location) noexcept {
+  if (inFrameLoop()) {
+    report(Pattern::WaitIdle, location);
+  }
+  return volk_.vkDeviceWaitIdle(device);
+}
+
+VkResult VolkPerfLint::vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                        const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
+                                        std::source_location location) noexcept {
+  if (inFrameLoop()) {
+    report(Pattern::AllocateMemoryInFrame, location);
+  }
+  return volk_.vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+}
+
+VkResult VolkPerfLint::vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                 uint32_t createInfoCount,
+                                                 const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                                 const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
+                                                 std::source_location location) noexcept {
+  if (onRenderThread()) {
+    report(Pattern::PipelineCreationOnRenderThread, location);
+  }
+  return volk_.vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                         pPipelines);
+}
+
+VkResult VolkPerfLint::vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                uint32_t createInfoCount,
+                                                const VkComputePipelineCreateInfo* pCreateInfos,
+                                                const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
+                                                std::source_location location) noexcept {
+  if (onRenderThread()) {
+    report(Pattern::PipelineCreationOnRenderThread, location);
+  }
+  return volk_.vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
+                                        pPipelines);
+}
+
+void VolkPerfLint::vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
+                                          const VkWriteDescriptorSet* pDescriptorWrites,
+                                          uint32_t descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies,
+                                          std::source_location location) noexcept {
+  if (descriptorWriteCount == 1 && descriptorCopyCount == 0) {
+    report(Pattern::SingleDescriptorWrite, location);
+  }
+  volk_.vkUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount,
+                               pDescriptorCopies);
+}
+
+void VolkPerfLint::vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                                        VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                                        uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                                        uint32_t bufferMemoryBarrierCount,
+                                        const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                                        uint32_t imageMemoryBarrierCount,
+                                        const VkImageMemoryBarrier* pImageMemoryBarriers,
+                                        std::source_location location) noexcept {
+  checkBarriers(memoryBarrierCount + bufferMemoryBarrierCount + imageMemoryBarrierCount, location);
+  volk_.vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount,
+                             pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers,
+                             imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+#if defined(VK_BASE_VERSION_1_3)
+void VolkPerfLint::vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo,
+                                         std::source_location location) noexcept {
+  checkBarriers(pDependencyInfo->memoryBarrierCount + pDependencyInfo->bufferMemoryBarrierCount +
+                  pDependencyInfo->imageMemoryBarrierCount,
+                location);
+  volk_.vkCmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+}
+#endif
+
+#if defined(VK_KHR_synchronization2)
+void VolkPerfLint::vkCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo,
+                                            std::source_location location) noexcept {
+  checkBarriers(pDependencyInfo->memoryBarrierCount + pDependencyInfo->bufferMemoryBarrierCount +
+                  pDependencyInfo->imageMemoryBarrierCount,
+                location);
+  volk_.vkCmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+}
+#endif
+
+#if defined(VK_KHR_swapchain)
+VkResult VolkPerfLint::vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) noexcept {
+  auto result = volk_.vkQueuePresentKHR(queue, pPresentInfo);
+  markFrame();
+  if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+    // The swapchain is about to be recreated, typically after waiting for the device.
+    leaveFrameLoop();
+  }
+  return result;
+}
+#endif
+
+void VolkPerfLint::markFrame() noexcept {
+  renderThread_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  frameCount_.fetch_add(1, std::memory_order_relaxed);
+  inFrameLoop_.store(true, std::memory_order_relaxed);
+}
+
+void VolkPerfLint::leaveFrameLoop() noexcept {
+  inFrameLoop_.store(false, std::memory_order_relaxed);
+}
+
+VolkPerfLint::Report VolkPerfLint::getReport(Pattern pattern) const noexcept {
+  auto const& counter = counters_[static_cast<uint32_t>(pattern)];
+  Report report;
+  report.count = counter.count.load(std::memory_order_relaxed);
+  report.file = counter.file.load(std::memory_order_relaxed);
+  report.line = counter.line.load(std::memory_order_relaxed);
+
+  auto const frames = frameCount_.load(std::memory_order_relaxed) - countedFrames_.load(std::memory_order_relaxed);
+  if (frames > 0) {
+    report.perFrame = static_cast<double>(report.count) / static_cast<double>(frames);
+  }
+  return report;
+}
+
+uint64_t VolkPerfLint::getFrameCount() const noexcept {
+  return frameCount_.load(std::memory_order_relaxed);
+}
+
+void VolkPerfLint::reset() noexcept {
+  for (auto& counter : counters_) {
+    counter.count.store(0, std::memory_order_relaxed);
+    counter.file.store(nullptr, std::memory_order_relaxed);
+    counter.line.store(0, std::memory_order_relaxed);
+  }
+  countedFrames_.store(frameCount_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void VolkPerfLint::report(Pattern pattern, std::source_location const& location) noexcept {
+  auto& counter = counters_[static_cast<uint32_t>(pattern)];
+  counter.count.fetch_add(1, std::memory_order_relaxed);
+  if (captureCallSites_) {
+    counter.file.store(location.file_name(), std::memory_order_relaxed);
+    counter.line.store(location.line(), std::memory_order_relaxed);
+  }
+}
+
+void VolkPerfLint::checkBarriers(uint32_t barrierCount, std::source_location const& location) noexcept {
+  if (barrierCount == 1) {
+    report(Pattern::SingleBarrier, location);
+  }
+}
+
+bool VolkPerfLint::inFrameLoop() const noexcept {
+  return inFrameLoop_.load(std::memory_order_relaxed);
+}
+
+bool VolkPerfLint::onRenderThread() const noexcept {
+  return renderThread_.load(std::memory_order_relaxed) == std::this_thread::get_id();
+}
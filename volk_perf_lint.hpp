@@ -0,0 +1,123 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <source_location>
+#include <thread>
+
+/**
+ * Cheap detector of common CPU-side Vulkan performance mistakes, meant to stay enabled in production builds.
+ *
+ * Calls that should be checked go through the forwarding methods of this class instead of the Volk function pointers;
+ * each method has the signature of the Vulkan function plus a defaulted call site argument. Every detected pattern
+ * bumps a relaxed atomic counter and optionally records the last call site. Frame-loop patterns are only counted
+ * between markFrame() (or vkQueuePresentKHR()) and leaveFrameLoop(), so waits at shutdown or around swapchain
+ * recreation aren't reported; a present returning VK_ERROR_OUT_OF_DATE_KHR leaves the frame loop as well. The render
+ * thread is the thread that marks frames.
+ */
+class VolkPerfLint final {
+public:
+  enum class Pattern : uint32_t {
+    WaitIdle = 0,                       // vkQueueWaitIdle/vkDeviceWaitIdle inside the frame loop
+    AllocateMemoryInFrame = 1,          // vkAllocateMemory inside the frame loop
+    PipelineCreationOnRenderThread = 2, // vkCreate*Pipelines on the thread that marks frames
+    SingleDescriptorWrite = 3,          // vkUpdateDescriptorSets with a single write and no copies
+    SingleBarrier = 4,                  // pipeline barrier with a single memory, buffer or image barrier
+  };
+  static constexpr uint32_t kPatternCount = 5;
+
+  struct Report {
+    uint64_t count = 0;
+    double perFrame = 0.0;      // count divided by the number of marked frames
+    const char* file = nullptr; // last call site, if call sites are captured
+    uint32_t line = 0;
+  };
+
+  /**
+   * Volk must have device function pointers loaded. Capturing call sites costs two relaxed stores per detection.
+   */
+  explicit VolkPerfLint(Volk& volk, bool captureCallSites = true) noexcept;
+  VolkPerfLint(const VolkPerfLint&) = delete;
+  VolkPerfLint& operator=(const VolkPerfLint&) = delete;
+
+  VkResult vkQueueWaitIdle(VkQueue queue,
+                           std::source_location location = std::source_location::current()) noexcept;
+  VkResult vkDeviceWaitIdle(VkDevice device,
+                            std::source_location location = std::source_location::current()) noexcept;
+  VkResult vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                            const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory,
+                            std::source_location location = std::source_location::current()) noexcept;
+  VkResult vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                     const VkGraphicsPipelineCreateInfo* pCreateInfos,
+                                     const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
+                                     std::source_location location = std::source_location::current()) noexcept;
+  VkResult vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                    const VkComputePipelineCreateInfo* pCreateInfos,
+                                    const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
+                                    std::source_location location = std::source_location::current()) noexcept;
+  void vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
+                              const VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount,
+                              const VkCopyDescriptorSet* pDescriptorCopies,
+                              std::source_location location = std::source_location::current()) noexcept;
+  void vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask,
+                            VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
+                            uint32_t memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers,
+                            uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers,
+                            uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers,
+                            std::source_location location = std::source_location::current()) noexcept;
+#if defined(VK_BASE_VERSION_1_3)
+  void vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo* pDependencyInfo,
+                             std::source_location location = std::source_location::current()) noexcept;
+#endif
+#if defined(VK_KHR_synchronization2)
+  void vkCmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfoKHR* pDependencyInfo,
+                                std::source_location location = std::source_location::current()) noexcept;
+#endif
+#if defined(VK_KHR_swapchain)
+  /**
+   * Forwards to Volk::vkQueuePresentKHR and marks the frame.
+   */
+  VkResult vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) noexcept;
+#endif
+
+  /**
+   * Mark the end of a frame on the render thread; frame-loop patterns are counted from now on.
+   */
+  void markFrame() noexcept;
+
+  /**
+   * Stop counting frame-loop patterns until the next markFrame(), e.g. before shutdown or swapchain recreation.
+   */
+  void leaveFrameLoop() noexcept;
+
+  [[nodiscard]] Report getReport(Pattern pattern) const noexcept;
+  [[nodiscard]] uint64_t getFrameCount() const noexcept;
+
+  /**
+   * Reset all counters and call sites; the render thread and frame loop state are kept.
+   */
+  void reset() noexcept;
+
+private:
+  struct Counter {
+    std::atomic<uint64_t> count = 0;
+    std::atomic<const char*> file = nullptr;
+    std::atomic<uint32_t> line = 0;
+  };
+
+  void report(Pattern pattern, std::source_location const& location) noexcept;
+  void checkBarriers(uint32_t barrierCount, std::source_location const& location) noexcept;
+  [[nodiscard]] bool inFrameLoop() const noexcept;
+  [[nodiscard]] bool onRenderThread() const noexcept;
+
+  Volk& volk_;
+  bool captureCallSites_ = true;
+  Counter counters_[kPatternCount];
+  std::atomic<uint64_t> frameCount_ = 0;
+  std::atomic<uint64_t> countedFrames_ = 0;
+  std::atomic<bool> inFrameLoop_ = false;
+  std::atomic<std::thread::id> renderThread_ = {};
+};
@@ -0,0 +1,404 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_pipeline_compiler.hpp"
+#include "volk_hash.hpp"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint64_t kUniqueKeyBit = VolkPipelineCompiler::kUniqueKeyBit;
+
+// Serialized key of a create info. The bytes are kept next to the job so that requests whose hashes match are only
+// deduplicated if their create infos really are identical.
+class KeyWriter final {
+public:
+  KeyWriter& add(void const* data, size_t size) noexcept {
+    auto bytes = static_cast<uint8_t const*>(data);
+    bytes_.insert(bytes_.end(), bytes, bytes + size);
+    return *this;
+  }
+
+  KeyWriter& add(char const* str) noexcept {
+    return str ? add(str, strlen(str) + 1) : add(uint64_t(0));
+  }
+
+  template <typename T>
+  KeyWriter& add(T const& value) noexcept {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "use add(data, size) for aggregates");
+    return add(static_cast<void const*>(&value), sizeof(T));
+  }
+
+  [[nodiscard]] uint64_t getHash() const noexcept {
+    return VolkHasher().add(bytes_.data(), bytes_.size()).get() & ~kUniqueKeyBit;
+  }
+
+  [[nodiscard]] std::vector<uint8_t> takeBytes() noexcept {
+    return std::move(bytes_);
+  }
+
+private:
+  std::vector<uint8_t> bytes_;
+};
+
+// Serialization of create infos: field by field to stay clear of padding bytes. Returns false if a structure can't be
+// serialized (unknown pNext), in which case the request isn't deduplicated.
+
+bool writeSpecialization(KeyWriter& writer, const VkSpecializationInfo* info) noexcept {
+  if (!info) {
+    writer.add(uint32_t(0));
+    return true;
+  }
+  writer.add(info->mapEntryCount);
+  for (uint32_t i = 0; i < info->mapEntryCount; ++i) {
+    writer.add(info->pMapEntries[i].constantID).add(info->pMapEntries[i].offset).add(info->pMapEntries[i].size);
+  }
+  writer.add(info->dataSize).add(info->pData, info->dataSize);
+  return true;
+}
+
+bool writeStage(KeyWriter& writer, const VkPipelineShaderStageCreateInfo& stage) noexcept {
+  if (stage.pNext) {
+    return false;
+  }
+  writer.add(stage.flags).add(stage.stage).add(stage.module).add(stage.pName);
+  return writeSpecialization(writer, stage.pSpecializationInfo);
+}
+
+bool writeRenderingInfo(KeyWriter& writer, const void* pNext) noexcept {
+#if defined(VK_VERSION_1_3)
+  auto base = static_cast<const VkBaseInStructure*>(pNext);
+  if (base && base->sType == VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO && !base->pNext) {
+    auto info = static_cast<const VkPipelineRenderingCreateInfo*>(pNext);
+    writer.add(info->viewMask)
+      .add(info->colorAttachmentCount)
+      .add(info->pColorAttachmentFormats, info->colorAttachmentCount * sizeof(VkFormat))
+      .add(info->depthAttachmentFormat)
+      .add(info->stencilAttachmentFormat);
+    return true;
+  }
+#endif
+  return pNext == nullptr;
+}
+
+template <typename T>
+bool writeState(KeyWriter& writer, const T* state) noexcept {
+  writer.add(state != nullptr);
+  return !state || !state->pNext;
+}
+
+bool writeCreateInfo(KeyWriter& writer, const VkGraphicsPipelineCreateInfo& info) noexcept {
+  writer.add(uint32_t(VK_PIPELINE_BIND_POINT_GRAPHICS)).add(info.flags).add(info.stageCount);
+  if (!writeRenderingInfo(writer, info.pNext)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < info.stageCount; ++i) {
+    if (!writeStage(writer, info.pStages[i])) {
+      return false;
+    }
+  }
+
+  if (!writeState(writer, info.pVertexInputState) || !writeState(writer, info.pInputAssemblyState) ||
+      !writeState(writer, info.pTessellationState) || !writeState(writer, info.pViewportState) ||
+      !writeState(writer, info.pRasterizationState) || !writeState(writer, info.pMultisampleState) ||
+      !writeState(writer, info.pDepthStencilState) || !writeState(writer, info.pColorBlendState) ||
+      !writeState(writer, info.pDynamicState)) {
+    return false;
+  }
+
+  if (auto s = info.pVertexInputState) {
+    writer.add(s->flags)
+      .add(s->vertexBindingDescriptionCount)
+      .add(s->pVertexBindingDescriptions, s->vertexBindingDescriptionCount * sizeof(VkVertexInputBindingDescription))
+      .add(s->vertexAttributeDescriptionCount)
+      .add(s->pVertexAttributeDescriptions,
+           s->vertexAttributeDescriptionCount * sizeof(VkVertexInputAttributeDescription));
+  }
+  if (auto s = info.pInputAssemblyState) {
+    writer.add(s->flags).add(s->topology).add(s->primitiveRestartEnable);
+  }
+  if (auto s = info.pTessellationState) {
+    writer.add(s->flags).add(s->patchControlPoints);
+  }
+  if (auto s = info.pViewportState) {
+    writer.add(s->flags).add(s->viewportCount).add(s->scissorCount);
+    if (s->pViewports) {
+      writer.add(s->pViewports, s->viewportCount * sizeof(VkViewport));
+    }
+    if (s->pScissors) {
+      writer.add(s->pScissors, s->scissorCount * sizeof(VkRect2D));
+    }
+  }
+  if (auto s = info.pRasterizationState) {
+    writer.add(s->flags)
+      .add(s->depthClampEnable)
+      .add(s->rasterizerDiscardEnable)
+      .add(s->polygonMode)
+      .add(s->cullMode)
+      .add(s->frontFace)
+      .add(s->depthBiasEnable)
+      .add(s->depthBiasConstantFactor)
+      .add(s->depthBiasClamp)
+      .add(s->depthBiasSlopeFactor)
+      .add(s->lineWidth);
+  }
+  if (auto s = info.pMultisampleState) {
+    writer.add(s->flags)
+      .add(s->rasterizationSamples)
+      .add(s->sampleShadingEnable)
+      .add(s->minSampleShading)
+      .add(s->alphaToCoverageEnable)
+      .add(s->alphaToOneEnable)
+      .add(s->pSampleMask != nullptr);
+    if (s->pSampleMask) {
+      writer.add(s->pSampleMask, (uint32_t(s->rasterizationSamples) + 31) / 32 * sizeof(VkSampleMask));
+    }
+  }
+  if (auto s = info.pDepthStencilState) {
+    writer.add(s->flags)
+      .add(s->depthTestEnable)
+      .add(s->depthWriteEnable)
+      .add(s->depthCompareOp)
+      .add(s->depthBoundsTestEnable)
+      .add(s->stencilTestEnable)
+      .add(&s->front, sizeof(VkStencilOpState))
+      .add(&s->back, sizeof(VkStencilOpState))
+      .add(s->minDepthBounds)
+      .add(s->maxDepthBounds);
+  }
+  if (auto s = info.pColorBlendState) {
+    writer.add(s->flags)
+      .add(s->logicOpEnable)
+      .add(s->logicOp)
+      .add(s->attachmentCount)
+      .add(s->pAttachments, s->attachmentCount * sizeof(VkPipelineColorBlendAttachmentState))
+      .add(s->blendConstants, sizeof(s->blendConstants));
+  }
+  if (auto s = info.pDynamicState) {
+    writer.add(s->flags)
+      .add(s->dynamicStateCount)
+      .add(s->pDynamicStates, s->dynamicStateCount * sizeof(VkDynamicState));
+  }
+
+  writer.add(info.layout)
+    .add(info.renderPass)
+    .add(info.subpass)
+    .add(info.basePipelineHandle)
+    .add(info.basePipelineIndex);
+  return true;
+}
+
+bool writeCreateInfo(KeyWriter& writer, const VkComputePipelineCreateInfo& info) noexcept {
+  writer.add(uint32_t(VK_PIPELINE_BIND_POINT_COMPUTE)).add(info.flags);
+  if (info.pNext || !writeStage(writer, info.stage)) {
+    return false;
+  }
+  writer.add(info.layout).add(info.basePipelineHandle).add(info.basePipelineIndex);
+  return true;
+}
+
+template <typename T>
+uint64_t computeKey(const T& createInfo, std::vector<uint8_t>& keyBytes) noexcept {
+  KeyWriter writer;
+  if (!writeCreateInfo(writer, createInfo)) {
+    return 0;
+  }
+  uint64_t key = writer.getHash();
+  keyBytes = writer.takeBytes();
+  return key;
+}
+
+} // namespace
+
+VolkPipelineCompiler::VolkPipelineCompiler(Volk& volk, VkDevice device, uint32_t threadCount /* = 0 */,
+                                           const void* pInitialCacheData /* = nullptr */,
+                                           size_t initialCacheDataSize /* = 0 */) noexcept
+  : volk_(volk), device_(device), pool_(threadCount) {
+  VkPipelineCacheCreateInfo cacheInfo = {};
+  cacheInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+  cacheInfo.initialDataSize = pInitialCacheData ? initialCacheDataSize : 0;
+  cacheInfo.pInitialData = pInitialCacheData;
+  status_ = volk_.vkCreatePipelineCache(device_, &cacheInfo, nullptr, &pipelineCache_);
+}
+
+VolkPipelineCompiler::~VolkPipelineCompiler() noexcept {
+  {
+    std::lock_guard lock(mutex_);
+    for (auto const& [key, job] : jobs_) {
+      auto expected = State::Queued;
+      if (job->state.compare_exchange_strong(expected, State::Cancelled)) {
+        job->promise.set_value(VolkPipelineResult{});
+        --pending_;
+      }
+    }
+  }
+  wait();
+
+  for (auto pipeline : pipelines_) {
+    volk_.vkDestroyPipeline(device_, pipeline, nullptr);
+  }
+  if (pipelineCache_ != VK_NULL_HANDLE) {
+    volk_.vkDestroyPipelineCache(device_, pipelineCache_, nullptr);
+  }
+}
+
+VkResult VolkPipelineCompiler::getStatus() noexcept {
+  return status_;
+}
+
+VolkPipelineCompiler::Request VolkPipelineCompiler::compile(const VkGraphicsPipelineCreateInfo& createInfo,
+                                                            Priority priority, uint64_t key /* = 0 */) noexcept {
+  auto job = std::make_shared<Job>();
+  job->graphics = true;
+  job->graphicsInfo = &createInfo;
+  if (key & kUniqueKeyBit) {
+    return makeFailedRequest(key, VK_ERROR_INITIALIZATION_FAILED);
+  }
+  if (key == 0) {
+    key = computeKey(createInfo, job->keyBytes);
+  }
+  return enqueue(key, std::move(job), priority);
+}
+
+VolkPipelineCompiler::Request VolkPipelineCompiler::compile(const VkComputePipelineCreateInfo& createInfo,
+                                                            Priority priority, uint64_t key /* = 0 */) noexcept {
+  auto job = std::make_shared<Job>();
+  job->graphics = false;
+  job->computeInfo = &createInfo;
+  if (key & kUniqueKeyBit) {
+    return makeFailedRequest(key, VK_ERROR_INITIALIZATION_FAILED);
+  }
+  if (key == 0) {
+    key = computeKey(createInfo, job->keyBytes);
+  }
+  return enqueue(key, std::move(job), priority);
+}
+
+bool VolkPipelineCompiler::cancel(uint64_t key) noexcept {
+  std::lock_guard lock(mutex_);
+  auto it = jobs_.find(key);
+  if (it == jobs_.end()) {
+    return false;
+  }
+  auto expected = State::Queued;
+  if (!it->second->state.compare_exchange_strong(expected, State::Cancelled)) {
+    return false;
+  }
+  it->second->promise.set_value(VolkPipelineResult{});
+  jobs_.erase(it);
+  if (--pending_ == 0) {
+    idle_.notify_all();
+  }
+  return true;
+}
+
+void VolkPipelineCompiler::wait() noexcept {
+  std::unique_lock lock(mutex_);
+  idle_.wait(lock, [this] { return pending_ == 0; });
+}
+
+VkPipelineCache VolkPipelineCompiler::getPipelineCache() noexcept {
+  return pipelineCache_;
+}
+
+VkResult VolkPipelineCompiler::getPipelineCacheData(size_t* pDataSize, void* pData) noexcept {
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+  return volk_.vkGetPipelineCacheData(device_, pipelineCache_, pDataSize, pData);
+}
+
+VolkPipelineCompiler::Request VolkPipelineCompiler::makeFailedRequest(uint64_t key, VkResult result) noexcept {
+  std::promise<VolkPipelineResult> failed;
+  failed.set_value(VolkPipelineResult{result, VK_NULL_HANDLE});
+  return Request{key, failed.get_future().share()};
+}
+
+VolkPipelineCompiler::Request VolkPipelineCompiler::enqueue(uint64_t key, std::shared_ptr<Job> job,
+                                                            Priority priority) noexcept {
+  auto poolPriority = priority == Priority::Visible ? VolkThreadPool::Priority::High : VolkThreadPool::Priority::Low;
+
+  std::shared_ptr<Job> queued;
+  {
+    std::lock_guard lock(mutex_);
+    if (status_ != VK_SUCCESS) {
+      return makeFailedRequest(key, status_);
+    }
+
+    if (key != 0) {
+      auto done = done_.find(key);
+      if (done != done_.end()) {
+        if (done->second.keyBytes == job->keyBytes) {
+          return Request{key, done->second.future};
+        }
+        key = 0; // hash collision
+      }
+    }
+
+    auto it = key != 0 ? jobs_.find(key) : jobs_.end();
+    if (it != jobs_.end() && it->second->keyBytes != job->keyBytes) {
+      key = 0; // hash collision
+      it = jobs_.end();
+    }
+    if (key == 0) {
+      key = kUniqueKeyBit | nextUniqueKey_++;
+    }
+
+    if (it != jobs_.end()) {
+      // Already requested: share the result, and bump a prefetch job which is now needed.
+      auto& existing = it->second;
+      if (existing->state.load() == State::Queued && poolPriority < existing->priority) {
+        existing->priority = poolPriority;
+        queued = existing;
+      }
+      if (!queued) {
+        return Request{key, existing->future};
+      }
+    } else {
+      job->key = key;
+      job->priority = poolPriority;
+      job->future = job->promise.get_future().share();
+      jobs_.emplace(key, job);
+      ++pending_;
+      queued = std::move(job);
+    }
+  }
+
+  pool_.submit([this, queued] { execute(queued); }, poolPriority);
+  return Request{key, queued->future};
+}
+
+void VolkPipelineCompiler::execute(std::shared_ptr<Job> const& job) noexcept {
+  auto expected = State::Queued;
+  if (!job->state.compare_exchange_strong(expected, State::Running)) {
+    return;
+  }
+
+  VolkPipelineResult result;
+  if (job->graphics) {
+    result.result =
+      volk_.vkCreateGraphicsPipelines(device_, pipelineCache_, 1, job->graphicsInfo, nullptr, &result.pipeline);
+  } else {
+    result.result =
+      volk_.vkCreateComputePipelines(device_, pipelineCache_, 1, job->computeInfo, nullptr, &result.pipeline);
+  }
+  job->state = State::Done;
+
+  std::lock_guard lock(mutex_);
+  if (result.pipeline != VK_NULL_HANDLE) {
+    pipelines_.push_back(result.pipeline);
+  }
+  job->promise.set_value(result);
+
+  // The job is evicted once done: callers hold its future, and later identical requests are served from done_.
+  // Failed compilations aren't remembered so that they can be retried.
+  auto it = jobs_.find(job->key);
+  if (it != jobs_.end() && it->second == job) {
+    jobs_.erase(it);
+  }
+  if (result.result == VK_SUCCESS && !(job->key & kUniqueKeyBit)) {
+    done_.insert_or_assign(job->key, Done{job->future, std::move(job->keyBytes)});
+  }
+  if (--pending_ == 0) {
+    idle_.notify_all();
+  }
+}
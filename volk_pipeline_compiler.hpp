@@ -0,0 +1,137 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_thread_pool.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct VolkPipelineResult {
+  VkResult result = VK_NOT_READY;
+  VkPipeline pipeline = VK_NULL_HANDLE;
+};
+
+/**
+ * Background pipeline compilation on a VolkThreadPool.
+ *
+ * Identical create infos are compiled once: requests are keyed by a hash of the create info (or by an application
+ * key) and share the same future. Serialized create infos are compared on a hash match, so colliding requests are
+ * compiled separately. Jobs are evicted when they finish; only the futures of successfully compiled pipelines are
+ * kept to serve later identical requests. Visible pipelines are compiled before prefetched ones, and requests which
+ * haven't started yet can be cancelled. All pipelines go through one internally synchronized VkPipelineCache.
+ *
+ * The compiler owns the pipelines it creates and destroys them in its destructor.
+ *
+ * A create info and everything it points to must stay alive until the request's future is ready.
+ */
+class VolkPipelineCompiler final {
+public:
+  enum class Priority : uint32_t {
+    Visible = 0,  // needed for the current frame
+    Prefetch = 1, // speculative, compiled when nothing visible is pending
+  };
+
+  struct Request {
+    uint64_t key = 0;
+    std::shared_future<VolkPipelineResult> future;
+  };
+
+  // Set in the keys of requests which aren't deduplicated; application keys must not have it.
+  static constexpr uint64_t kUniqueKeyBit = 1ULL << 63;
+
+  /**
+   * Volk must have device function pointers loaded for the given device. The pipeline cache is created from the
+   * optional initial data.
+   */
+  VolkPipelineCompiler(Volk& volk, VkDevice device, uint32_t threadCount = 0,
+                       const void* pInitialCacheData = nullptr, size_t initialCacheDataSize = 0) noexcept;
+  ~VolkPipelineCompiler() noexcept;
+  VolkPipelineCompiler(const VolkPipelineCompiler&) = delete;
+  VolkPipelineCompiler& operator=(const VolkPipelineCompiler&) = delete;
+
+  /**
+   * Returns VK_SUCCESS on success, or the error of pipeline cache creation.
+   */
+  [[nodiscard]] VkResult getStatus() noexcept;
+
+  /**
+   * Queue a pipeline for compilation. If key is 0 it is computed from the create info; create infos with pNext
+   * structures the compiler doesn't know are never deduplicated unless an explicit key is given. Explicit keys with
+   * kUniqueKeyBit set are rejected: the request's future is ready with VK_ERROR_INITIALIZATION_FAILED.
+   */
+  [[nodiscard]] Request compile(const VkGraphicsPipelineCreateInfo& createInfo, Priority priority,
+                                uint64_t key = 0) noexcept;
+  [[nodiscard]] Request compile(const VkComputePipelineCreateInfo& createInfo, Priority priority,
+                                uint64_t key = 0) noexcept;
+
+  /**
+   * Cancel a request which hasn't started compiling yet; its future becomes ready with VK_NOT_READY.
+   * Returns false if the request is unknown, already compiling or done.
+   */
+  bool cancel(uint64_t key) noexcept;
+
+  /**
+   * Block until every queued request has finished.
+   */
+  void wait() noexcept;
+
+  [[nodiscard]] VkPipelineCache getPipelineCache() noexcept;
+
+  /**
+   * Same contract as vkGetPipelineCacheData for the shared pipeline cache.
+   */
+  [[nodiscard]] VkResult getPipelineCacheData(size_t* pDataSize, void* pData) noexcept;
+
+private:
+  enum class State : uint32_t {
+    Queued,
+    Running,
+    Done,
+    Cancelled,
+  };
+
+  struct Job {
+    std::atomic<State> state = State::Queued;
+    uint64_t key = 0;
+    std::vector<uint8_t> keyBytes;
+    bool graphics = true;
+    const VkGraphicsPipelineCreateInfo* graphicsInfo = nullptr;
+    const VkComputePipelineCreateInfo* computeInfo = nullptr;
+    std::promise<VolkPipelineResult> promise;
+    std::shared_future<VolkPipelineResult> future;
+    VolkThreadPool::Priority priority = VolkThreadPool::Priority::Low;
+  };
+
+  struct Done {
+    std::shared_future<VolkPipelineResult> future;
+    std::vector<uint8_t> keyBytes;
+  };
+
+  [[nodiscard]] static Request makeFailedRequest(uint64_t key, VkResult result) noexcept;
+  [[nodiscard]] Request enqueue(uint64_t key, std::shared_ptr<Job> job, Priority priority) noexcept;
+  void execute(std::shared_ptr<Job> const& job) noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VkPipelineCache pipelineCache_ = VK_NULL_HANDLE;
+  VkResult status_ = VK_SUCCESS;
+
+  std::mutex mutex_;
+  std::condition_variable idle_;
+  std::unordered_map<uint64_t, std::shared_ptr<Job>> jobs_;
+  std::unordered_map<uint64_t, Done> done_;
+  std::vector<VkPipeline> pipelines_;
+  uint64_t nextUniqueKey_ = 1;
+  uint64_t pending_ = 0;
+
+  // Declared last so that it is destroyed first: tasks of cancelled jobs still run and touch the jobs.
+  VolkThreadPool pool_;
+};
@@ -0,0 +1,176 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_residency_manager.hpp"
+
+#if defined(VK_BASE_VERSION_1_1)
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+constexpr float kLevelPriorities[VolkResidencyManager::kLevelCount] = {1.0f, 0.75f, 0.5f, 0.25f, 0.0f};
+
+uint32_t getLevel(uint64_t age) noexcept {
+  auto const it = std::lower_bound(std::begin(VolkResidencyManager::kLevelAges),
+                                   std::end(VolkResidencyManager::kLevelAges), age);
+  return static_cast<uint32_t>(it - std::begin(VolkResidencyManager::kLevelAges));
+}
+
+} // namespace
+
+VolkResidencyManager::VolkResidencyManager(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device,
+                                           bool memoryBudgetEnabled, float pressureThreshold /* = 0.9f */) noexcept
+  : volk_(volk)
+  , device_(device)
+  , physicalDevice_(physicalDevice)
+  , memoryBudgetEnabled_(memoryBudgetEnabled)
+  , pressureThreshold_(pressureThreshold) {
+  volk_.vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProperties_);
+  std::lock_guard lock(mutex_);
+  updateBudgets();
+}
+
+VkResult VolkResidencyManager::getStatus() const noexcept {
+#if defined(VK_EXT_pageable_device_local_memory)
+  if (volk_.vkSetDeviceMemoryPriorityEXT) {
+    return VK_SUCCESS;
+  }
+#endif
+  return VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+VkResult VolkResidencyManager::vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                                                const VkAllocationCallbacks* pAllocator,
+                                                VkDeviceMemory* pMemory) noexcept {
+  auto const result = volk_.vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+  if (result == VK_SUCCESS && pAllocateInfo->memoryTypeIndex < memoryProperties_.memoryTypeCount) {
+    Allocation allocation;
+    allocation.heapIndex = memoryProperties_.memoryTypes[pAllocateInfo->memoryTypeIndex].heapIndex;
+    allocation.size = pAllocateInfo->allocationSize;
+    std::lock_guard lock(mutex_);
+    // A new allocation is about to be filled and used, so it starts out hot.
+    allocation.lastUse = frame_;
+    allocations_[*pMemory] = allocation;
+    // Usage is estimated until the next budget refresh, so hasHeadroom() sees allocations made during the frame.
+    auto& heap = heaps_[allocation.heapIndex];
+    heap.trackedBytes += allocation.size;
+    heap.usage += allocation.size;
+  }
+  return result;
+}
+
+void VolkResidencyManager::vkFreeMemory(VkDevice device, VkDeviceMemory memory,
+                                        const VkAllocationCallbacks* pAllocator) noexcept {
+  if (memory != VK_NULL_HANDLE) {
+    std::lock_guard lock(mutex_);
+    auto it = allocations_.find(memory);
+    if (it != allocations_.end()) {
+      auto& heap = heaps_[it->second.heapIndex];
+      heap.trackedBytes -= it->second.size;
+      heap.usage -= std::min(heap.usage, it->second.size);
+      if (it->second.level == kLevelCount - 1) {
+        heap.coldBytes -= it->second.size;
+      }
+      allocations_.erase(it);
+    }
+  }
+  volk_.vkFreeMemory(device, memory, pAllocator);
+}
+
+void VolkResidencyManager::use(uint32_t memoryCount, const VkDeviceMemory* pMemories) noexcept {
+  std::lock_guard lock(mutex_);
+  for (uint32_t i = 0; i < memoryCount; ++i) {
+    auto it = allocations_.find(pMemories[i]);
+    if (it != allocations_.end()) {
+      it->second.lastUse = frame_;
+    }
+  }
+}
+
+void VolkResidencyManager::beginFrame() noexcept {
+  std::lock_guard lock(mutex_);
+  ++frame_;
+  updateBudgets();
+
+  for (auto& [memory, allocation] : allocations_) {
+    auto const level = getLevel(frame_ - allocation.lastUse);
+    if (level == allocation.level) {
+      continue;
+    }
+    auto& heap = heaps_[allocation.heapIndex];
+    if (allocation.level == kLevelCount - 1) {
+      heap.coldBytes -= allocation.size;
+    }
+    if (level == kLevelCount - 1) {
+      heap.coldBytes += allocation.size;
+    }
+    allocation.level = level;
+#if defined(VK_EXT_pageable_device_local_memory)
+    if (volk_.vkSetDeviceMemoryPriorityEXT) {
+      volk_.vkSetDeviceMemoryPriorityEXT(device_, memory, kLevelPriorities[level]);
+      ++stats_.priorityChanges;
+    }
+#endif
+  }
+}
+
+void VolkResidencyManager::updateBudgets() noexcept {
+  VkDeviceSize heapBudget[VK_MAX_MEMORY_HEAPS] = {};
+  VkDeviceSize heapUsage[VK_MAX_MEMORY_HEAPS] = {};
+  bool budgetValid = false;
+#if defined(VK_EXT_memory_budget)
+  auto getProperties2 = volk_.vkGetPhysicalDeviceMemoryProperties2;
+#if defined(VK_KHR_get_physical_device_properties2)
+  if (!getProperties2) {
+    getProperties2 = volk_.vkGetPhysicalDeviceMemoryProperties2KHR;
+  }
+#endif
+  if (memoryBudgetEnabled_ && getProperties2) {
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budget = {};
+    budget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+    VkPhysicalDeviceMemoryProperties2 properties = {};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    properties.pNext = &budget;
+    getProperties2(physicalDevice_, &properties);
+    std::copy(std::begin(budget.heapBudget), std::end(budget.heapBudget), heapBudget);
+    std::copy(std::begin(budget.heapUsage), std::end(budget.heapUsage), heapUsage);
+    budgetValid = true;
+  }
+#endif
+
+  for (uint32_t i = 0; i < memoryProperties_.memoryHeapCount; ++i) {
+    auto& heap = heaps_[i];
+    heap.budget = budgetValid ? heapBudget[i] : memoryProperties_.memoryHeaps[i].size;
+    heap.usage = budgetValid ? heapUsage[i] : heap.trackedBytes;
+    heap.pressure = heap.budget != 0 ? static_cast<float>(heap.usage) / static_cast<float>(heap.budget) : 0.0f;
+    if (heap.usage > heap.budget) {
+      ++heap.overBudgetFrames;
+    }
+  }
+}
+
+bool VolkResidencyManager::hasHeadroom(uint32_t memoryTypeIndex, VkDeviceSize size) noexcept {
+  if (memoryTypeIndex >= memoryProperties_.memoryTypeCount) {
+    return false;
+  }
+  std::lock_guard lock(mutex_);
+  auto const& heap = heaps_[memoryProperties_.memoryTypes[memoryTypeIndex].heapIndex];
+  auto const limit = static_cast<VkDeviceSize>(static_cast<double>(heap.budget) * pressureThreshold_);
+  if (heap.usage + size <= limit) {
+    return true;
+  }
+  ++stats_.throttled;
+  return false;
+}
+
+VolkResidencyManager::HeapStats VolkResidencyManager::getHeapStats(uint32_t heapIndex) noexcept {
+  std::lock_guard lock(mutex_);
+  return heapIndex < memoryProperties_.memoryHeapCount ? heaps_[heapIndex] : HeapStats();
+}
+
+VolkResidencyManager::Stats VolkResidencyManager::getStats() noexcept {
+  std::lock_guard lock(mutex_);
+  return stats_;
+}
+
+#endif
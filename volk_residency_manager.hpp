@@ -0,0 +1,109 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(VK_BASE_VERSION_1_1)
+
+/**
+ * Device memory residency hints under oversubscription.
+ *
+ * Allocations made through this class are ranked by the frame they were last used in, as reported with use(), and
+ * beginFrame() maps their age to a few priority levels with vkSetDeviceMemoryPriorityEXT
+ * (VK_EXT_pageable_device_local_memory): recently used memory stays resident, and the driver pages out cold memory
+ * first. Priorities only change when an allocation moves to another level, so the driver isn't called for every
+ * allocation every frame.
+ *
+ * With VK_EXT_memory_budget, beginFrame() also refreshes the per-heap budgets. hasHeadroom() lets streaming code hold
+ * back uploads and allocations while a heap is above the pressure threshold; getHeapStats() reports the pressure and
+ * how much memory is cold enough to be evicted.
+ */
+class VolkResidencyManager final {
+public:
+  // Frames since the last use up to which an allocation keeps each priority level; older ones get the lowest level.
+  static constexpr uint32_t kLevelAges[] = {1, 4, 16, 64};
+  static constexpr uint32_t kLevelCount = 5;
+
+  struct HeapStats {
+    VkDeviceSize budget = 0;     // from VK_EXT_memory_budget, heap size if not available
+    VkDeviceSize usage = 0;      // from VK_EXT_memory_budget, tracked bytes if not available
+    VkDeviceSize trackedBytes = 0;
+    VkDeviceSize coldBytes = 0;  // tracked bytes at the lowest priority, paged out first
+    float pressure = 0.0f;       // usage / budget
+    uint64_t overBudgetFrames = 0;
+  };
+
+  struct Stats {
+    uint64_t priorityChanges = 0; // vkSetDeviceMemoryPriorityEXT calls
+    uint64_t throttled = 0;       // hasHeadroom() calls which returned false
+  };
+
+  /**
+   * Volk must have instance and device function pointers loaded. memoryBudgetEnabled tells whether
+   * VK_EXT_memory_budget is enabled on the device. A heap is under pressure when its usage exceeds pressureThreshold
+   * of its budget.
+   */
+  VolkResidencyManager(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device, bool memoryBudgetEnabled,
+                       float pressureThreshold = 0.9f) noexcept;
+  VolkResidencyManager(const VolkResidencyManager&) = delete;
+  VolkResidencyManager& operator=(const VolkResidencyManager&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if vkSetDeviceMemoryPriorityEXT isn't available; budgets and statistics
+   * still work.
+   */
+  [[nodiscard]] VkResult getStatus() const noexcept;
+
+  VkResult vkAllocateMemory(VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo,
+                            const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) noexcept;
+  void vkFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) noexcept;
+
+  /**
+   * Mark memory as used by the current frame; unknown memory is ignored.
+   */
+  void use(uint32_t memoryCount, const VkDeviceMemory* pMemories) noexcept;
+
+  /**
+   * Start a new frame: refresh the budgets and update the priorities of allocations whose level changed.
+   */
+  void beginFrame() noexcept;
+
+  /**
+   * Returns false if allocating or uploading size more bytes of the given memory type would push its heap above the
+   * pressure threshold.
+   */
+  [[nodiscard]] bool hasHeadroom(uint32_t memoryTypeIndex, VkDeviceSize size) noexcept;
+
+  [[nodiscard]] HeapStats getHeapStats(uint32_t heapIndex) noexcept;
+  [[nodiscard]] Stats getStats() noexcept;
+
+private:
+  struct Allocation {
+    uint32_t heapIndex = 0;
+    uint32_t level = kLevelCount; // kLevelCount until the first priority is set
+    VkDeviceSize size = 0;
+    uint64_t lastUse = 0;
+  };
+
+  void updateBudgets() noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VkPhysicalDevice physicalDevice_ = VK_NULL_HANDLE;
+  VkPhysicalDeviceMemoryProperties memoryProperties_ = {};
+  bool memoryBudgetEnabled_ = false;
+  float pressureThreshold_ = 0.9f;
+
+  std::mutex mutex_;
+  std::unordered_map<VkDeviceMemory, Allocation> allocations_;
+  HeapStats heaps_[VK_MAX_MEMORY_HEAPS];
+  uint64_t frame_ = 0;
+  Stats stats_;
+};
+
+#endif
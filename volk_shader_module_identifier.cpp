@@ -0,0 +1,304 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_shader_module_identifier.hpp"
+
+#if defined(VK_EXT_shader_module_identifier)
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+constexpr uint32_t kIdentifiersMagic = 0x444d534bu; // "KSMD"
+constexpr uint32_t kIdentifiersFormatVersion = 1;
+
+struct IdentifiersHeader {
+  uint32_t magic;
+  uint32_t formatVersion;
+  uint32_t entryCount;
+  uint32_t reserved;
+  uint8_t algorithmUUID[VK_UUID_SIZE];
+};
+
+struct SerializedIdentifier {
+  uint64_t key;
+  uint32_t size;
+  uint8_t data[VK_MAX_SHADER_MODULE_IDENTIFIER_SIZE_EXT];
+};
+
+} // namespace
+
+VolkShaderModuleIdentifierCache::VolkShaderModuleIdentifierCache(Volk& volk, VkPhysicalDevice physicalDevice,
+                                                                 VkDevice device) noexcept
+  : volk_(volk), device_(device) {
+  if (!volk_.vkGetShaderModuleIdentifierEXT || !volk_.vkGetPhysicalDeviceProperties2) {
+    status_ = VK_ERROR_EXTENSION_NOT_PRESENT;
+    return;
+  }
+
+  VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT identifierProperties = {};
+  identifierProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_PROPERTIES_EXT;
+  VkPhysicalDeviceProperties2 properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties.pNext = &identifierProperties;
+  volk_.vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+
+  memcpy(algorithmUUID_, identifierProperties.shaderModuleIdentifierAlgorithmUUID, VK_UUID_SIZE);
+}
+
+VkResult VolkShaderModuleIdentifierCache::getStatus() noexcept {
+  return status_;
+}
+
+VkResult VolkShaderModuleIdentifierCache::createGraphicsPipeline(VkPipelineCache pipelineCache,
+                                                                 const VkGraphicsPipelineCreateInfo& createInfo,
+                                                                 const uint64_t* pStageKeys, const SpirvLoader& loader,
+                                                                 const VkAllocationCallbacks* pAllocator,
+                                                                 VkPipeline* pPipeline) noexcept {
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  std::vector<VkPipelineShaderStageCreateInfo> stages(createInfo.pStages, createInfo.pStages + createInfo.stageCount);
+  return createPipeline(createInfo.stageCount, stages.data(), pStageKeys, loader, pAllocator,
+                        [&](VkPipelineCreateFlags flags) {
+    VkGraphicsPipelineCreateInfo info = createInfo;
+    info.flags |= flags;
+    info.pStages = stages.data();
+    return volk_.vkCreateGraphicsPipelines(device_, pipelineCache, 1, &info, pAllocator, pPipeline);
+  });
+}
+
+VkResult VolkShaderModuleIdentifierCache::createComputePipeline(VkPipelineCache pipelineCache,
+                                                                const VkComputePipelineCreateInfo& createInfo,
+                                                                uint64_t stageKey, const SpirvLoader& loader,
+                                                                const VkAllocationCallbacks* pAllocator,
+                                                                VkPipeline* pPipeline) noexcept {
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  VkPipelineShaderStageCreateInfo stage = createInfo.stage;
+  return createPipeline(1, &stage, &stageKey, loader, pAllocator, [&](VkPipelineCreateFlags flags) {
+    VkComputePipelineCreateInfo info = createInfo;
+    info.flags |= flags;
+    info.stage = stage;
+    return volk_.vkCreateComputePipelines(device_, pipelineCache, 1, &info, pAllocator, pPipeline);
+  });
+}
+
+template <typename Create>
+VkResult VolkShaderModuleIdentifierCache::createPipeline(uint32_t stageCount, VkPipelineShaderStageCreateInfo* stages,
+                                                         const uint64_t* keys, const SpirvLoader& loader,
+                                                         const VkAllocationCallbacks* pAllocator,
+                                                         Create&& create) noexcept {
+  std::vector<Identifier> ids(stageCount);
+  bool anyKeyed = false;
+  bool allKnown = true;
+  {
+    std::lock_guard lock(mutex_);
+    for (uint32_t i = 0; i < stageCount; ++i) {
+      if (keys[i] == 0) {
+        continue;
+      }
+      anyKeyed = true;
+      auto it = identifiers_.find(keys[i]);
+      if (it != identifiers_.end()) {
+        ids[i] = it->second;
+      } else {
+        allKnown = false;
+      }
+    }
+  }
+
+  if (!anyKeyed) {
+    return create(0);
+  }
+
+  // Fast path: identifiers only, no SPIR-V. Succeeds if the pipeline is found in the pipeline cache.
+  if (allKnown) {
+    std::vector<VkPipelineShaderStageCreateInfo> original(stages, stages + stageCount);
+    std::vector<VkPipelineShaderStageModuleIdentifierCreateInfoEXT> identifierInfos(stageCount);
+    for (uint32_t i = 0; i < stageCount; ++i) {
+      if (keys[i] == 0) {
+        continue;
+      }
+      identifierInfos[i].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT;
+      identifierInfos[i].pNext = stages[i].pNext;
+      identifierInfos[i].identifierSize = ids[i].size;
+      identifierInfos[i].pIdentifier = ids[i].data;
+      stages[i].pNext = &identifierInfos[i];
+      stages[i].module = VK_NULL_HANDLE;
+    }
+
+    VkResult result = create(VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT);
+    if (result != VK_PIPELINE_COMPILE_REQUIRED) {
+      if (result == VK_SUCCESS) {
+        std::lock_guard lock(mutex_);
+        ++hits_;
+      }
+      return result;
+    }
+    std::copy(original.begin(), original.end(), stages);
+  }
+
+  // Slow path: load SPIR-V, create the modules and record their identifiers for the next run.
+  std::vector<VkShaderModule> modules(stageCount, VK_NULL_HANDLE);
+  std::vector<uint32_t> code;
+  VkResult result = VK_SUCCESS;
+  for (uint32_t i = 0; i < stageCount && result == VK_SUCCESS; ++i) {
+    if (keys[i] == 0) {
+      continue;
+    }
+    code.clear();
+    if (!loader || !loader(keys[i], code)) {
+      result = VK_ERROR_INITIALIZATION_FAILED;
+      break;
+    }
+    VkShaderModuleCreateInfo moduleInfo = {};
+    moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    moduleInfo.codeSize = code.size() * sizeof(uint32_t);
+    moduleInfo.pCode = code.data();
+    result = volk_.vkCreateShaderModule(device_, &moduleInfo, pAllocator, &modules[i]);
+    stages[i].module = modules[i];
+  }
+
+  if (result == VK_SUCCESS) {
+    result = create(0);
+  }
+
+  if (result == VK_SUCCESS) {
+    for (uint32_t i = 0; i < stageCount; ++i) {
+      if (keys[i] == 0) {
+        continue;
+      }
+      VkShaderModuleIdentifierEXT identifier = {};
+      identifier.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_IDENTIFIER_EXT;
+      volk_.vkGetShaderModuleIdentifierEXT(device_, modules[i], &identifier);
+      ids[i].size = identifier.identifierSize < VK_MAX_SHADER_MODULE_IDENTIFIER_SIZE_EXT
+        ? identifier.identifierSize : VK_MAX_SHADER_MODULE_IDENTIFIER_SIZE_EXT;
+      memcpy(ids[i].data, identifier.identifier, ids[i].size);
+    }
+
+    std::lock_guard lock(mutex_);
+    for (uint32_t i = 0; i < stageCount; ++i) {
+      if (keys[i] != 0 && ids[i].size > 0) {
+        identifiers_[keys[i]] = ids[i];
+      }
+    }
+    ++misses_;
+  }
+
+  for (auto module : modules) {
+    if (module != VK_NULL_HANDLE) {
+      volk_.vkDestroyShaderModule(device_, module, pAllocator);
+    }
+  }
+  return result;
+}
+
+void VolkShaderModuleIdentifierCache::registerCode(uint64_t key, const uint32_t* pCode, size_t codeSize) noexcept {
+  if (status_ != VK_SUCCESS || key == 0 || !volk_.vkGetShaderModuleCreateInfoIdentifierEXT) {
+    return;
+  }
+
+  VkShaderModuleCreateInfo moduleInfo = {};
+  moduleInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+  moduleInfo.codeSize = codeSize;
+  moduleInfo.pCode = pCode;
+  VkShaderModuleIdentifierEXT identifier = {};
+  identifier.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_IDENTIFIER_EXT;
+  volk_.vkGetShaderModuleCreateInfoIdentifierEXT(device_, &moduleInfo, &identifier);
+  if (identifier.identifierSize == 0 || identifier.identifierSize > VK_MAX_SHADER_MODULE_IDENTIFIER_SIZE_EXT) {
+    return;
+  }
+
+  std::lock_guard lock(mutex_);
+  Identifier& entry = identifiers_[key];
+  entry.size = identifier.identifierSize;
+  memcpy(entry.data, identifier.identifier, entry.size);
+}
+
+VkResult VolkShaderModuleIdentifierCache::getData(size_t* pDataSize, void* pData) noexcept {
+  std::lock_guard lock(mutex_);
+
+  if (!pData) {
+    *pDataSize = sizeof(IdentifiersHeader) + identifiers_.size() * sizeof(SerializedIdentifier);
+    return VK_SUCCESS;
+  }
+
+  if (*pDataSize < sizeof(IdentifiersHeader)) {
+    *pDataSize = 0;
+    return VK_INCOMPLETE;
+  }
+
+  auto out = static_cast<uint8_t*>(pData);
+  size_t offset = sizeof(IdentifiersHeader);
+  uint32_t entryCount = 0;
+  VkResult result = VK_SUCCESS;
+  for (auto const& [key, identifier] : identifiers_) {
+    if (offset + sizeof(SerializedIdentifier) > *pDataSize) {
+      result = VK_INCOMPLETE;
+      break;
+    }
+    SerializedIdentifier entry;
+    memset(&entry, 0, sizeof(entry));
+    entry.key = key;
+    entry.size = identifier.size;
+    memcpy(entry.data, identifier.data, identifier.size);
+    memcpy(out + offset, &entry, sizeof(entry));
+    offset += sizeof(entry);
+    ++entryCount;
+  }
+
+  IdentifiersHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = kIdentifiersMagic;
+  header.formatVersion = kIdentifiersFormatVersion;
+  header.entryCount = entryCount;
+  memcpy(header.algorithmUUID, algorithmUUID_, VK_UUID_SIZE);
+  memcpy(out, &header, sizeof(header));
+
+  *pDataSize = offset;
+  return result;
+}
+
+VkResult VolkShaderModuleIdentifierCache::loadData(const void* pData, size_t dataSize) noexcept {
+  auto in = static_cast<uint8_t const*>(pData);
+  IdentifiersHeader header;
+  if (!pData || dataSize < sizeof(header)) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  memcpy(&header, in, sizeof(header));
+  if (header.magic != kIdentifiersMagic || header.formatVersion != kIdentifiersFormatVersion ||
+      (dataSize - sizeof(header)) / sizeof(SerializedIdentifier) < header.entryCount) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  if (memcmp(header.algorithmUUID, algorithmUUID_, VK_UUID_SIZE) != 0) {
+    return VK_ERROR_INCOMPATIBLE_DRIVER;
+  }
+
+  std::lock_guard lock(mutex_);
+  for (uint32_t i = 0; i < header.entryCount; ++i) {
+    SerializedIdentifier entry;
+    memcpy(&entry, in + sizeof(header) + i * sizeof(entry), sizeof(entry));
+    if (entry.key == 0 || entry.size == 0 || entry.size > VK_MAX_SHADER_MODULE_IDENTIFIER_SIZE_EXT) {
+      continue;
+    }
+    Identifier& identifier = identifiers_[entry.key];
+    identifier.size = entry.size;
+    memcpy(identifier.data, entry.data, entry.size);
+  }
+  return VK_SUCCESS;
+}
+
+uint64_t VolkShaderModuleIdentifierCache::getHitCount() noexcept {
+  std::lock_guard lock(mutex_);
+  return hits_;
+}
+
+uint64_t VolkShaderModuleIdentifierCache::getMissCount() noexcept {
+  std::lock_guard lock(mutex_);
+  return misses_;
+}
+
+#endif /* defined(VK_EXT_shader_module_identifier) */
@@ -0,0 +1,113 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#if defined(VK_EXT_shader_module_identifier)
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Pipeline creation fast path based on VK_EXT_shader_module_identifier.
+ *
+ * Shader stages are referred to by application keys (e.g. a hash of the SPIR-V file path). Once a pipeline has been
+ * created for a key, the module identifier is recorded, and the next creation is first attempted with the identifier
+ * only and VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT, so that a pipeline cache hit needs no SPIR-V at
+ * all. The SPIR-V loader is called only when the driver reports VK_PIPELINE_COMPILE_REQUIRED.
+ *
+ * The recorded identifiers are meant to be stored next to the pipeline cache data (see getData()/loadData()); they
+ * are tied to the device's shaderModuleIdentifierAlgorithmUUID.
+ *
+ * Requires the shaderModuleIdentifier and pipelineCreationCacheControl features. All methods are thread-safe.
+ */
+class VolkShaderModuleIdentifierCache final {
+public:
+  /**
+   * Loads SPIR-V code for a key; returns false if the code can't be provided.
+   */
+  using SpirvLoader = std::function<bool(uint64_t key, std::vector<uint32_t>& code)>;
+
+  /**
+   * Volk must have instance and device function pointers loaded for the given physical device and device.
+   */
+  VolkShaderModuleIdentifierCache(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device) noexcept;
+  VolkShaderModuleIdentifierCache(const VolkShaderModuleIdentifierCache&) = delete;
+  VolkShaderModuleIdentifierCache& operator=(const VolkShaderModuleIdentifierCache&) = delete;
+
+  /**
+   * Returns VK_SUCCESS on success and VK_ERROR_EXTENSION_NOT_PRESENT if VK_EXT_shader_module_identifier isn't loaded.
+   */
+  [[nodiscard]] VkResult getStatus() noexcept;
+
+  /**
+   * Create a graphics pipeline. pStageKeys has createInfo.stageCount elements; stages with a non-zero key must have
+   * a VK_NULL_HANDLE module and get their code from the identifier or from the loader. Stages with a zero key are
+   * passed through unchanged.
+   */
+  [[nodiscard]] VkResult createGraphicsPipeline(VkPipelineCache pipelineCache,
+                                                const VkGraphicsPipelineCreateInfo& createInfo,
+                                                const uint64_t* pStageKeys, const SpirvLoader& loader,
+                                                const VkAllocationCallbacks* pAllocator,
+                                                VkPipeline* pPipeline) noexcept;
+
+  /**
+   * Create a compute pipeline, see createGraphicsPipeline().
+   */
+  [[nodiscard]] VkResult createComputePipeline(VkPipelineCache pipelineCache,
+                                               const VkComputePipelineCreateInfo& createInfo, uint64_t stageKey,
+                                               const SpirvLoader& loader,
+                                               const VkAllocationCallbacks* pAllocator, VkPipeline* pPipeline) noexcept;
+
+  /**
+   * Record the identifier of SPIR-V code for a key without creating a module or a pipeline
+   * (uses vkGetShaderModuleCreateInfoIdentifierEXT).
+   */
+  void registerCode(uint64_t key, const uint32_t* pCode, size_t codeSize) noexcept;
+
+  /**
+   * Serialize the identifiers, following vkGetPipelineCacheData conventions.
+   */
+  [[nodiscard]] VkResult getData(size_t* pDataSize, void* pData) noexcept;
+
+  /**
+   * Merge previously serialized identifiers.
+   *
+   * Returns VK_ERROR_INCOMPATIBLE_DRIVER if the identifier algorithm differs (nothing is loaded then),
+   * VK_ERROR_INITIALIZATION_FAILED if the data is malformed.
+   */
+  [[nodiscard]] VkResult loadData(const void* pData, size_t dataSize) noexcept;
+
+  /**
+   * Number of pipelines created without loading SPIR-V, and number of pipelines that needed it.
+   */
+  [[nodiscard]] uint64_t getHitCount() noexcept;
+  [[nodiscard]] uint64_t getMissCount() noexcept;
+
+private:
+  struct Identifier {
+    uint32_t size = 0;
+    uint8_t data[VK_MAX_SHADER_MODULE_IDENTIFIER_SIZE_EXT] = {};
+  };
+
+  template <typename Create>
+  [[nodiscard]] VkResult createPipeline(uint32_t stageCount, VkPipelineShaderStageCreateInfo* stages,
+                                        const uint64_t* keys, const SpirvLoader& loader,
+                                        const VkAllocationCallbacks* pAllocator, Create&& create) noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VkResult status_ = VK_SUCCESS;
+  uint8_t algorithmUUID_[VK_UUID_SIZE] = {};
+
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, Identifier> identifiers_;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+};
+
+#endif /* defined(VK_EXT_shader_module_identifier) */
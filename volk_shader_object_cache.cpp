@@ -0,0 +1,411 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_shader_object_cache.hpp"
+
+#if defined(VK_EXT_shader_object)
+
+#include "volk_hash.hpp"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint32_t kCacheMagic = 0x4f53564bu; // "KVSO"
+constexpr uint32_t kCacheFormatVersion = 2;
+
+struct CacheHeader {
+  uint32_t magic;
+  uint32_t formatVersion;
+  uint32_t binaryVersion;
+  uint32_t entryCount;
+  uint8_t binaryUUID[VK_UUID_SIZE];
+};
+
+struct EntryHeader {
+  uint64_t key;
+  uint64_t keySize;
+  uint64_t size;
+};
+
+size_t alignEntrySize(size_t size) noexcept {
+  return (size + 7) & ~size_t(7);
+}
+
+// Serialized key of a shader. The hash selects the entry and the bytes are compared on lookup, so that a hash
+// collision can't hand out the binary of another shader.
+class KeyWriter final {
+public:
+  KeyWriter& add(void const* data, size_t size) noexcept {
+    auto bytes = static_cast<uint8_t const*>(data);
+    bytes_.insert(bytes_.end(), bytes, bytes + size);
+    return *this;
+  }
+
+  KeyWriter& add(char const* str) noexcept {
+    return str ? add(str, strlen(str) + 1) : add(uint64_t(0));
+  }
+
+  template <typename T>
+  KeyWriter& add(T const& value) noexcept {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "use add(data, size) for aggregates");
+    return add(static_cast<void const*>(&value), sizeof(T));
+  }
+
+  [[nodiscard]] std::vector<uint8_t> takeBytes() noexcept {
+    return std::move(bytes_);
+  }
+
+private:
+  std::vector<uint8_t> bytes_;
+};
+
+uint64_t hashKey(const std::vector<uint8_t>& keyBytes) noexcept {
+  uint64_t key = VolkHasher().add(keyBytes.data(), keyBytes.size()).get();
+  return key != 0 ? key : 1;
+}
+
+} // namespace
+
+VolkShaderObjectCache::VolkShaderObjectCache(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device) noexcept
+  : volk_(volk), device_(device) {
+  if (!volk_.vkCreateShadersEXT || !volk_.vkGetShaderBinaryDataEXT || !volk_.vkDestroyShaderEXT ||
+      !volk_.vkGetPhysicalDeviceProperties2) {
+    status_ = VK_ERROR_EXTENSION_NOT_PRESENT;
+    return;
+  }
+
+  VkPhysicalDeviceShaderObjectPropertiesEXT shaderObjectProperties = {};
+  shaderObjectProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_PROPERTIES_EXT;
+  VkPhysicalDeviceProperties2 properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties.pNext = &shaderObjectProperties;
+  volk_.vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+
+  memcpy(binaryUUID_, shaderObjectProperties.shaderBinaryUUID, VK_UUID_SIZE);
+  binaryVersion_ = shaderObjectProperties.shaderBinaryVersion;
+}
+
+VkResult VolkShaderObjectCache::getStatus() noexcept {
+  return status_;
+}
+
+VkResult VolkShaderObjectCache::createShaders(uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos,
+                                              const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders) noexcept {
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  std::vector<VkShaderCreateInfoEXT> infos(pCreateInfos, pCreateInfos + createInfoCount);
+  std::vector<uint64_t> keys(createInfoCount, 0);
+  std::vector<std::vector<uint8_t>> keyBytes(createInfoCount);
+  std::vector<std::shared_ptr<const Entry>> hits(createInfoCount);
+
+  // Linked stages are keyed by the whole group, and none of them is cached if one of them can't be.
+  bool linkedBypass = false;
+  KeyWriter linkedWriter;
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    bool const keyed = infos[i].codeType == VK_SHADER_CODE_TYPE_SPIRV_EXT && computeKey(infos[i], keyBytes[i]);
+    if (infos[i].flags & VK_SHADER_CREATE_LINK_STAGE_BIT_EXT) {
+      linkedBypass = linkedBypass || !keyed;
+      linkedWriter.add(uint64_t(keyBytes[i].size())).add(keyBytes[i].data(), keyBytes[i].size());
+    }
+    if (!keyed) {
+      keyBytes[i].clear();
+    }
+  }
+  auto const linkedBytes = linkedWriter.takeBytes();
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    if (infos[i].flags & VK_SHADER_CREATE_LINK_STAGE_BIT_EXT) {
+      if (linkedBypass) {
+        keyBytes[i].clear();
+      } else {
+        keyBytes[i].insert(keyBytes[i].end(), linkedBytes.begin(), linkedBytes.end());
+      }
+    }
+    keys[i] = keyBytes[i].empty() ? 0 : hashKey(keyBytes[i]);
+  }
+
+  bool anyHit = false;
+  bool linkedMiss = false;
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    if (keys[i] == 0) {
+      continue;
+    }
+    hits[i] = find(keys[i], keyBytes[i]);
+    anyHit = anyHit || hits[i];
+    linkedMiss = linkedMiss || (!hits[i] && (infos[i].flags & VK_SHADER_CREATE_LINK_STAGE_BIT_EXT));
+  }
+
+  // Linked stages must all be created from the same code type.
+  if (linkedMiss) {
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+      if (infos[i].flags & VK_SHADER_CREATE_LINK_STAGE_BIT_EXT) {
+        hits[i].reset();
+      }
+    }
+  }
+
+  VkResult result = VK_ERROR_UNKNOWN;
+  bool createdFromBinary = false;
+  if (anyHit) {
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+      if (hits[i]) {
+        infos[i].codeType = VK_SHADER_CODE_TYPE_BINARY_EXT;
+        infos[i].codeSize = hits[i]->size;
+        infos[i].pCode = hits[i]->code.data();
+      }
+    }
+
+    result = volk_.vkCreateShadersEXT(device_, createInfoCount, infos.data(), pAllocator, pShaders);
+    createdFromBinary = result == VK_SUCCESS;
+    if (!createdFromBinary) {
+      // The driver refused the binaries (e.g. it was updated in place): drop them and compile from SPIR-V.
+      for (uint32_t i = 0; i < createInfoCount; ++i) {
+        if (result >= 0 && pShaders[i] != VK_NULL_HANDLE) {
+          volk_.vkDestroyShaderEXT(device_, pShaders[i], pAllocator);
+        }
+        pShaders[i] = VK_NULL_HANDLE;
+        if (hits[i]) {
+          evict(keys[i]);
+          hits[i].reset();
+        }
+      }
+    }
+  }
+
+  if (!createdFromBinary) {
+    result = volk_.vkCreateShadersEXT(device_, createInfoCount, pCreateInfos, pAllocator, pShaders);
+    if (result != VK_SUCCESS) {
+      return result;
+    }
+  }
+
+  uint32_t hitCount = 0;
+  uint32_t missCount = 0;
+  for (uint32_t i = 0; i < createInfoCount; ++i) {
+    if (keys[i] == 0) {
+      continue;
+    }
+    if (hits[i]) {
+      ++hitCount;
+    } else {
+      ++missCount;
+      store(keys[i], std::move(keyBytes[i]), pShaders[i]);
+    }
+  }
+
+  std::lock_guard lock(mutex_);
+  hits_ += hitCount;
+  misses_ += missCount;
+  return result;
+}
+
+void VolkShaderObjectCache::registerSetLayout(VkDescriptorSetLayout setLayout,
+                                              const VkDescriptorSetLayoutCreateInfo& createInfo) noexcept {
+  KeyWriter writer;
+  writer.add(createInfo.flags).add(createInfo.bindingCount);
+  for (uint32_t i = 0; i < createInfo.bindingCount; ++i) {
+    auto const& binding = createInfo.pBindings[i];
+    writer.add(binding.binding)
+      .add(binding.descriptorType)
+      .add(binding.descriptorCount)
+      .add(binding.stageFlags)
+      .add(binding.pImmutableSamplers != nullptr);
+  }
+
+  std::lock_guard lock(mutex_);
+  setLayouts_.insert_or_assign(setLayout, writer.takeBytes());
+}
+
+void VolkShaderObjectCache::unregisterSetLayout(VkDescriptorSetLayout setLayout) noexcept {
+  std::lock_guard lock(mutex_);
+  setLayouts_.erase(setLayout);
+}
+
+VkResult VolkShaderObjectCache::getData(size_t* pDataSize, void* pData) noexcept {
+  std::lock_guard lock(mutex_);
+
+  if (!pData) {
+    size_t size = sizeof(CacheHeader);
+    for (auto const& [key, entry] : entries_) {
+      size += sizeof(EntryHeader) + alignEntrySize(entry->key.size()) + alignEntrySize(entry->size);
+    }
+    *pDataSize = size;
+    return VK_SUCCESS;
+  }
+
+  if (*pDataSize < sizeof(CacheHeader)) {
+    *pDataSize = 0;
+    return VK_INCOMPLETE;
+  }
+
+  auto out = static_cast<uint8_t*>(pData);
+  size_t offset = sizeof(CacheHeader);
+  uint32_t entryCount = 0;
+  VkResult result = VK_SUCCESS;
+  for (auto const& [key, entry] : entries_) {
+    size_t const keySize = alignEntrySize(entry->key.size());
+    size_t const entrySize = sizeof(EntryHeader) + keySize + alignEntrySize(entry->size);
+    if (offset + entrySize > *pDataSize) {
+      result = VK_INCOMPLETE;
+      break;
+    }
+    EntryHeader entryHeader = {key, entry->key.size(), entry->size};
+    memset(out + offset, 0, entrySize);
+    memcpy(out + offset, &entryHeader, sizeof(entryHeader));
+    memcpy(out + offset + sizeof(entryHeader), entry->key.data(), entry->key.size());
+    memcpy(out + offset + sizeof(entryHeader) + keySize, entry->code.data(), entry->size);
+    offset += entrySize;
+    ++entryCount;
+  }
+
+  CacheHeader header = {};
+  header.magic = kCacheMagic;
+  header.formatVersion = kCacheFormatVersion;
+  header.binaryVersion = binaryVersion_;
+  header.entryCount = entryCount;
+  memcpy(header.binaryUUID, binaryUUID_, VK_UUID_SIZE);
+  memcpy(out, &header, sizeof(header));
+
+  *pDataSize = offset;
+  return result;
+}
+
+VkResult VolkShaderObjectCache::loadData(const void* pData, size_t dataSize) noexcept {
+  auto in = static_cast<uint8_t const*>(pData);
+  CacheHeader header;
+  if (!pData || dataSize < sizeof(header)) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  memcpy(&header, in, sizeof(header));
+  if (header.magic != kCacheMagic || header.formatVersion != kCacheFormatVersion) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  if (header.binaryVersion != binaryVersion_ || memcmp(header.binaryUUID, binaryUUID_, VK_UUID_SIZE) != 0) {
+    return VK_ERROR_INCOMPATIBLE_DRIVER;
+  }
+
+  std::vector<std::pair<uint64_t, std::shared_ptr<const Entry>>> loaded;
+  loaded.reserve(header.entryCount);
+  size_t offset = sizeof(header);
+  for (uint32_t i = 0; i < header.entryCount; ++i) {
+    EntryHeader entryHeader;
+    if (dataSize - offset < sizeof(entryHeader)) {
+      return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    memcpy(&entryHeader, in + offset, sizeof(entryHeader));
+    offset += sizeof(entryHeader);
+    if (entryHeader.keySize > dataSize - offset) {
+      return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->key.assign(in + offset, in + offset + entryHeader.keySize);
+    offset += alignEntrySize(entry->key.size());
+    if (offset > dataSize || entryHeader.size > dataSize - offset) {
+      return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    entry->size = size_t(entryHeader.size);
+    entry->code.resize((entry->size + sizeof(Chunk) - 1) / sizeof(Chunk));
+    memcpy(entry->code.data(), in + offset, entry->size);
+    offset += alignEntrySize(entry->size);
+    if (offset > dataSize) {
+      return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    loaded.emplace_back(entryHeader.key, std::move(entry));
+  }
+
+  std::lock_guard lock(mutex_);
+  for (auto& [key, entry] : loaded) {
+    entries_.insert_or_assign(key, std::move(entry));
+  }
+  return VK_SUCCESS;
+}
+
+void VolkShaderObjectCache::clear() noexcept {
+  std::lock_guard lock(mutex_);
+  entries_.clear();
+}
+
+uint64_t VolkShaderObjectCache::getHitCount() noexcept {
+  std::lock_guard lock(mutex_);
+  return hits_;
+}
+
+uint64_t VolkShaderObjectCache::getMissCount() noexcept {
+  std::lock_guard lock(mutex_);
+  return misses_;
+}
+
+bool VolkShaderObjectCache::computeKey(const VkShaderCreateInfoEXT& info, std::vector<uint8_t>& keyBytes) noexcept {
+  // Extension structs aren't serialized, so shaders with a pNext chain bypass the cache.
+  if (info.pNext != nullptr) {
+    return false;
+  }
+
+  KeyWriter writer;
+  writer.add(info.codeSize)
+    .add(info.pCode, info.codeSize)
+    .add(info.flags)
+    .add(info.stage)
+    .add(info.nextStage)
+    .add(info.pName)
+    .add(info.setLayoutCount)
+    .add(info.pushConstantRangeCount);
+  if (info.setLayoutCount > 0) {
+    std::lock_guard lock(mutex_);
+    for (uint32_t i = 0; i < info.setLayoutCount; ++i) {
+      auto it = setLayouts_.find(info.pSetLayouts[i]);
+      if (it == setLayouts_.end()) {
+        return false;
+      }
+      writer.add(uint64_t(it->second.size())).add(it->second.data(), it->second.size());
+    }
+  }
+  for (uint32_t i = 0; i < info.pushConstantRangeCount; ++i) {
+    auto const& range = info.pPushConstantRanges[i];
+    writer.add(range.stageFlags).add(range.offset).add(range.size);
+  }
+  if (auto spec = info.pSpecializationInfo) {
+    writer.add(spec->mapEntryCount);
+    for (uint32_t i = 0; i < spec->mapEntryCount; ++i) {
+      writer.add(spec->pMapEntries[i].constantID).add(spec->pMapEntries[i].offset).add(spec->pMapEntries[i].size);
+    }
+    writer.add(spec->dataSize).add(spec->pData, spec->dataSize);
+  } else {
+    writer.add(uint32_t(0));
+  }
+  keyBytes = writer.takeBytes();
+  return true;
+}
+
+std::shared_ptr<const VolkShaderObjectCache::Entry> VolkShaderObjectCache::find(
+  uint64_t key, const std::vector<uint8_t>& keyBytes) noexcept {
+  std::lock_guard lock(mutex_);
+  auto it = entries_.find(key);
+  return it != entries_.end() && it->second->key == keyBytes ? it->second : nullptr;
+}
+
+void VolkShaderObjectCache::store(uint64_t key, std::vector<uint8_t> keyBytes, VkShaderEXT shader) noexcept {
+  size_t size = 0;
+  if (volk_.vkGetShaderBinaryDataEXT(device_, shader, &size, nullptr) != VK_SUCCESS || size == 0) {
+    return;
+  }
+
+  auto entry = std::make_shared<Entry>();
+  entry->code.resize((size + sizeof(Chunk) - 1) / sizeof(Chunk));
+  if (volk_.vkGetShaderBinaryDataEXT(device_, shader, &size, entry->code.data()) != VK_SUCCESS) {
+    return;
+  }
+  entry->size = size;
+  entry->key = std::move(keyBytes);
+
+  std::lock_guard lock(mutex_);
+  entries_.insert_or_assign(key, std::move(entry));
+}
+
+void VolkShaderObjectCache::evict(uint64_t key) noexcept {
+  std::lock_guard lock(mutex_);
+  entries_.erase(key);
+}
+
+#endif /* defined(VK_EXT_shader_object) */
@@ -0,0 +1,112 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#if defined(VK_EXT_shader_object)
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Cache of VK_EXT_shader_object binaries.
+ *
+ * Shaders created from SPIR-V are keyed by their code and creation parameters, and their binaries are retrieved with
+ * vkGetShaderBinaryDataEXT. Entries are found by a hash of the key and the whole key is compared on lookup. Stages created with VK_SHADER_CREATE_LINK_STAGE_BIT_EXT are keyed by the
+ * whole linked group. Descriptor set layout handles differ between runs, so layouts must be described with
+ * registerSetLayout() before shaders using them can be cached; shaders with unregistered layouts or a non-null pNext
+ * chain bypass the cache. On the next creation (or after loadData() on a warm start) the shaders are
+ * created from VK_SHADER_CODE_TYPE_BINARY_EXT code instead, which skips compilation entirely.
+ *
+ * Serialized data carries shaderBinaryUUID and shaderBinaryVersion of the device; data produced by another driver
+ * is rejected by loadData(). Binaries the driver refuses at creation time are evicted and recompiled from SPIR-V.
+ *
+ * All methods are thread-safe.
+ */
+class VolkShaderObjectCache final {
+public:
+  /**
+   * Volk must have instance and device function pointers loaded for the given physical device and device.
+   */
+  VolkShaderObjectCache(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device) noexcept;
+  VolkShaderObjectCache(const VolkShaderObjectCache&) = delete;
+  VolkShaderObjectCache& operator=(const VolkShaderObjectCache&) = delete;
+
+  /**
+   * Returns VK_SUCCESS on success and VK_ERROR_EXTENSION_NOT_PRESENT if VK_EXT_shader_object isn't loaded.
+   */
+  [[nodiscard]] VkResult getStatus() noexcept;
+
+  /**
+   * Same contract as vkCreateShadersEXT. SPIR-V create infos are served from the cache when possible;
+   * binary create infos are passed through unchanged.
+   */
+  [[nodiscard]] VkResult createShaders(uint32_t createInfoCount, const VkShaderCreateInfoEXT* pCreateInfos,
+                                       const VkAllocationCallbacks* pAllocator, VkShaderEXT* pShaders) noexcept;
+
+  /**
+   * Register the bindings of a descriptor set layout so that shaders using it can be keyed by its contents.
+   * Only binding numbers, types, counts, stage flags, the presence of immutable samplers and the layout flags take
+   * part in the key. The layout must be unregistered before it is destroyed.
+   */
+  void registerSetLayout(VkDescriptorSetLayout setLayout, const VkDescriptorSetLayoutCreateInfo& createInfo) noexcept;
+  void unregisterSetLayout(VkDescriptorSetLayout setLayout) noexcept;
+
+  /**
+   * Serialize the cache, following vkGetPipelineCacheData conventions: if pData is nullptr the required size is
+   * returned in pDataSize, otherwise at most *pDataSize bytes are written and VK_INCOMPLETE is returned if some
+   * entries didn't fit.
+   */
+  [[nodiscard]] VkResult getData(size_t* pDataSize, void* pData) noexcept;
+
+  /**
+   * Merge previously serialized data into the cache.
+   *
+   * Returns VK_ERROR_INCOMPATIBLE_DRIVER if the data was produced by a different driver (nothing is loaded then),
+   * VK_ERROR_INITIALIZATION_FAILED if the data is malformed.
+   */
+  [[nodiscard]] VkResult loadData(const void* pData, size_t dataSize) noexcept;
+
+  /**
+   * Remove all entries.
+   */
+  void clear() noexcept;
+
+  [[nodiscard]] uint64_t getHitCount() noexcept;
+  [[nodiscard]] uint64_t getMissCount() noexcept;
+
+private:
+  // VK_SHADER_CODE_TYPE_BINARY_EXT code must be 16-byte aligned.
+  struct alignas(16) Chunk {
+    uint8_t bytes[16];
+  };
+
+  struct Entry {
+    std::vector<uint8_t> key; // serialized creation parameters, compared on lookup
+    std::vector<Chunk> code;
+    size_t size = 0;
+  };
+
+  [[nodiscard]] bool computeKey(const VkShaderCreateInfoEXT& info, std::vector<uint8_t>& keyBytes) noexcept;
+  [[nodiscard]] std::shared_ptr<const Entry> find(uint64_t key, const std::vector<uint8_t>& keyBytes) noexcept;
+  void store(uint64_t key, std::vector<uint8_t> keyBytes, VkShaderEXT shader) noexcept;
+  void evict(uint64_t key) noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VkResult status_ = VK_SUCCESS;
+  uint8_t binaryUUID_[VK_UUID_SIZE] = {};
+  uint32_t binaryVersion_ = 0;
+
+  std::mutex mutex_;
+  std::unordered_map<uint64_t, std::shared_ptr<const Entry>> entries_;
+  std::unordered_map<VkDescriptorSetLayout, std::vector<uint8_t>> setLayouts_;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+};
+
+#endif /* defined(VK_EXT_shader_object) */
@@ -0,0 +1,478 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_shared_channel.hpp"
+
+#if defined(VK_BASE_VERSION_1_2) && defined(VK_KHR_external_memory_fd) && defined(VK_KHR_external_semaphore_fd) && \
+  !defined(_WIN32)
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr uint32_t kMagic = 0x766b7368; // 'vksh'
+constexpr uint32_t kVersion = 2;
+constexpr uint32_t kSemaphoreCount = 2;
+
+constexpr auto kMemoryHandleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+constexpr auto kSemaphoreHandleType = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT;
+
+void closeAll(int* fds, uint32_t count) noexcept {
+  for (uint32_t i = 0; i < count; ++i) {
+    if (fds[i] >= 0) {
+      ::close(fds[i]);
+      fds[i] = -1;
+    }
+  }
+}
+
+} // namespace
+
+// Sent as the message payload; the file descriptors of the buffers' memory, then of the ready and release semaphores,
+// travel as SCM_RIGHTS ancillary data. Opaque handles are only valid on the exporting device and driver, and must be
+// imported with the same allocation size and memory type.
+struct VolkSharedChannel::Message {
+  uint32_t magic = kMagic;
+  uint32_t version = kVersion;
+  uint8_t deviceUUID[VK_UUID_SIZE] = {};
+  uint8_t driverUUID[VK_UUID_SIZE] = {};
+  VkDeviceSize size = 0;
+  VkDeviceSize allocationSize = 0;
+  VkBufferUsageFlags usage = 0;
+  uint32_t memoryTypeIndex = 0;
+  uint32_t bufferCount = 0;
+  uint32_t dedicated = 0; // memory was allocated with VkMemoryDedicatedAllocateInfo
+};
+
+VolkSharedChannel::VolkSharedChannel(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device) noexcept
+  : volk_(volk)
+  , physicalDevice_(physicalDevice)
+  , device_(device)
+  , waitSemaphores_(volk.vkWaitSemaphores)
+  , getExternalBufferProperties_(volk.vkGetPhysicalDeviceExternalBufferProperties) {
+#if defined(VK_KHR_timeline_semaphore)
+  if (!waitSemaphores_) {
+    waitSemaphores_ = volk.vkWaitSemaphoresKHR;
+  }
+#endif
+#if defined(VK_KHR_external_memory_capabilities)
+  if (!getExternalBufferProperties_) {
+    getExternalBufferProperties_ = volk.vkGetPhysicalDeviceExternalBufferPropertiesKHR;
+  }
+#endif
+  volk_.vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties_);
+
+  VkPhysicalDeviceIDProperties idProperties = {};
+  idProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES;
+  VkPhysicalDeviceProperties2 properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+  properties.pNext = &idProperties;
+  if (volk_.vkGetPhysicalDeviceProperties2) {
+    volk_.vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+  }
+  std::memcpy(deviceUUID_, idProperties.deviceUUID, VK_UUID_SIZE);
+  std::memcpy(driverUUID_, idProperties.driverUUID, VK_UUID_SIZE);
+}
+
+VolkSharedChannel::~VolkSharedChannel() noexcept {
+  destroy();
+}
+
+VkResult VolkSharedChannel::getStatus() const noexcept {
+  return waitSemaphores_ && getExternalBufferProperties_ && volk_.vkGetMemoryFdKHR && volk_.vkGetSemaphoreFdKHR &&
+             volk_.vkImportSemaphoreFdKHR
+           ? VK_SUCCESS
+           : VK_ERROR_EXTENSION_NOT_PRESENT;
+}
+
+VkResult VolkSharedChannel::checkExternalMemory(VkExternalMemoryFeatureFlags required) noexcept {
+  VkPhysicalDeviceExternalBufferInfo bufferInfo = {};
+  bufferInfo.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO;
+  bufferInfo.usage = usage_;
+  bufferInfo.handleType = kMemoryHandleType;
+  VkExternalBufferProperties properties = {};
+  properties.sType = VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES;
+  getExternalBufferProperties_(physicalDevice_, &bufferInfo, &properties);
+  auto const features = properties.externalMemoryProperties.externalMemoryFeatures;
+  if ((features & required) != required) {
+    return VK_ERROR_FEATURE_NOT_PRESENT;
+  }
+  dedicated_ = dedicated_ || (features & VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT);
+  return VK_SUCCESS;
+}
+
+void VolkSharedChannel::destroy() noexcept {
+  for (uint32_t i = 0; i < bufferCount_; ++i) {
+    if (buffers_[i].buffer != VK_NULL_HANDLE) {
+      volk_.vkDestroyBuffer(device_, buffers_[i].buffer, nullptr);
+    }
+    if (buffers_[i].memory != VK_NULL_HANDLE) {
+      volk_.vkFreeMemory(device_, buffers_[i].memory, nullptr);
+    }
+    buffers_[i] = Buffer();
+  }
+  if (readySemaphore_ != VK_NULL_HANDLE) {
+    volk_.vkDestroySemaphore(device_, readySemaphore_, nullptr);
+  }
+  if (releaseSemaphore_ != VK_NULL_HANDLE) {
+    volk_.vkDestroySemaphore(device_, releaseSemaphore_, nullptr);
+  }
+  readySemaphore_ = VK_NULL_HANDLE;
+  releaseSemaphore_ = VK_NULL_HANDLE;
+  bufferCount_ = 0;
+  dedicated_ = false;
+}
+
+VkResult VolkSharedChannel::createSemaphore(bool exportable, VkSemaphore& semaphore) noexcept {
+  VkExportSemaphoreCreateInfo exportCreateInfo = {};
+  exportCreateInfo.sType = VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO;
+  exportCreateInfo.handleTypes = kSemaphoreHandleType;
+  VkSemaphoreTypeCreateInfo typeCreateInfo = {};
+  typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+  typeCreateInfo.pNext = exportable ? &exportCreateInfo : nullptr;
+  typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+  VkSemaphoreCreateInfo createInfo = {};
+  createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  createInfo.pNext = &typeCreateInfo;
+  return volk_.vkCreateSemaphore(device_, &createInfo, nullptr, &semaphore);
+}
+
+VkResult VolkSharedChannel::createBuffer(Buffer& buffer, VkMemoryRequirements& requirements) noexcept {
+  VkExternalMemoryBufferCreateInfo externalCreateInfo = {};
+  externalCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+  externalCreateInfo.handleTypes = kMemoryHandleType;
+  VkBufferCreateInfo createInfo = {};
+  createInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  createInfo.pNext = &externalCreateInfo;
+  createInfo.size = size_;
+  createInfo.usage = usage_;
+  createInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  auto const result = volk_.vkCreateBuffer(device_, &createInfo, nullptr, &buffer.buffer);
+  if (result == VK_SUCCESS) {
+    volk_.vkGetBufferMemoryRequirements(device_, buffer.buffer, &requirements);
+  }
+  return result;
+}
+
+VkResult VolkSharedChannel::createBuffers(uint32_t bufferCount, VkDeviceSize size, VkBufferUsageFlags usage) noexcept {
+  if (getStatus() != VK_SUCCESS) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+  if (bufferCount == 0 || bufferCount > kMaxBuffers) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  destroy();
+  size_ = size;
+  usage_ = usage;
+
+  auto result = checkExternalMemory(VK_EXTERNAL_MEMORY_FEATURE_EXPORTABLE_BIT);
+  if (result == VK_SUCCESS) {
+    result = createSemaphore(true, readySemaphore_);
+  }
+  if (result == VK_SUCCESS) {
+    result = createSemaphore(true, releaseSemaphore_);
+  }
+
+  for (bufferCount_ = 0; result == VK_SUCCESS && bufferCount_ < bufferCount;) {
+    auto& buffer = buffers_[bufferCount_++];
+    VkMemoryRequirements requirements = {};
+    result = createBuffer(buffer, requirements);
+    if (result != VK_SUCCESS) {
+      break;
+    }
+
+    // All buffers are created alike, so the first one picks the memory type and size for all of them.
+    if (bufferCount_ == 1) {
+      memoryTypeIndex_ = memoryProperties_.memoryTypeCount;
+      for (uint32_t i = memoryProperties_.memoryTypeCount; i-- > 0;) {
+        if ((requirements.memoryTypeBits & (1u << i)) &&
+            (memoryTypeIndex_ == memoryProperties_.memoryTypeCount ||
+             (memoryProperties_.memoryTypes[i].propertyFlags & VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT))) {
+          memoryTypeIndex_ = i;
+        }
+      }
+      if (memoryTypeIndex_ == memoryProperties_.memoryTypeCount) {
+        result = VK_ERROR_FEATURE_NOT_PRESENT;
+        break;
+      }
+      allocationSize_ = requirements.size;
+    }
+
+    VkMemoryDedicatedAllocateInfo dedicatedInfo = {};
+    dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    dedicatedInfo.buffer = buffer.buffer;
+    VkExportMemoryAllocateInfo exportInfo = {};
+    exportInfo.sType = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+    exportInfo.pNext = dedicated_ ? &dedicatedInfo : nullptr;
+    exportInfo.handleTypes = kMemoryHandleType;
+    VkMemoryAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.pNext = &exportInfo;
+    allocateInfo.allocationSize = allocationSize_;
+    allocateInfo.memoryTypeIndex = memoryTypeIndex_;
+    result = volk_.vkAllocateMemory(device_, &allocateInfo, nullptr, &buffer.memory);
+    if (result == VK_SUCCESS) {
+      result = volk_.vkBindBufferMemory(device_, buffer.buffer, buffer.memory, 0);
+    }
+  }
+
+  if (result != VK_SUCCESS) {
+    destroy();
+  }
+  return result;
+}
+
+VkResult VolkSharedChannel::send(int socket) noexcept {
+  if (bufferCount_ == 0) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+
+  int fds[kMaxBuffers + kSemaphoreCount];
+  std::memset(fds, -1, sizeof(fds));
+  auto const fdCount = bufferCount_ + kSemaphoreCount;
+  VkResult result = VK_SUCCESS;
+  for (uint32_t i = 0; i < bufferCount_ && result == VK_SUCCESS; ++i) {
+    VkMemoryGetFdInfoKHR getFdInfo = {};
+    getFdInfo.sType = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+    getFdInfo.memory = buffers_[i].memory;
+    getFdInfo.handleType = kMemoryHandleType;
+    result = volk_.vkGetMemoryFdKHR(device_, &getFdInfo, &fds[i]);
+  }
+  VkSemaphore const semaphores[kSemaphoreCount] = {readySemaphore_, releaseSemaphore_};
+  for (uint32_t i = 0; i < kSemaphoreCount && result == VK_SUCCESS; ++i) {
+    VkSemaphoreGetFdInfoKHR getFdInfo = {};
+    getFdInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR;
+    getFdInfo.semaphore = semaphores[i];
+    getFdInfo.handleType = kSemaphoreHandleType;
+    result = volk_.vkGetSemaphoreFdKHR(device_, &getFdInfo, &fds[bufferCount_ + i]);
+  }
+  if (result != VK_SUCCESS) {
+    closeAll(fds, fdCount);
+    return result;
+  }
+
+  Message message;
+  std::memcpy(message.deviceUUID, deviceUUID_, VK_UUID_SIZE);
+  std::memcpy(message.driverUUID, driverUUID_, VK_UUID_SIZE);
+  message.size = size_;
+  message.allocationSize = allocationSize_;
+  message.usage = usage_;
+  message.memoryTypeIndex = memoryTypeIndex_;
+  message.bufferCount = bufferCount_;
+  message.dedicated = dedicated_ ? 1 : 0;
+
+  iovec io = {};
+  io.iov_base = &message;
+  io.iov_len = sizeof(message);
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fds))] = {};
+  msghdr header = {};
+  header.msg_iov = &io;
+  header.msg_iovlen = 1;
+  header.msg_control = control;
+  header.msg_controllen = CMSG_SPACE(sizeof(int) * fdCount);
+  auto* cmsg = CMSG_FIRSTHDR(&header);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fdCount);
+  std::memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * fdCount);
+
+  // A consumer which went away must fail the send rather than kill the producer with SIGPIPE.
+#if defined(MSG_NOSIGNAL)
+  int const flags = MSG_NOSIGNAL;
+#else
+  int const flags = 0;
+#if defined(SO_NOSIGPIPE)
+  int const noSigPipe = 1;
+  (void)setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+#endif
+  ssize_t sent = -1;
+  do {
+    sent = sendmsg(socket, &header, flags);
+  } while (sent < 0 && errno == EINTR);
+  // The receiver holds its own references now; ours are no longer needed either way.
+  closeAll(fds, fdCount);
+  return sent == static_cast<ssize_t>(sizeof(message)) ? VK_SUCCESS : VK_ERROR_INITIALIZATION_FAILED;
+}
+
+VkResult VolkSharedChannel::receive(int socket) noexcept {
+  if (getStatus() != VK_SUCCESS) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+  destroy();
+
+  Message message;
+  iovec io = {};
+  io.iov_base = &message;
+  io.iov_len = sizeof(message);
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * (kMaxBuffers + kSemaphoreCount))] = {};
+  msghdr header = {};
+  header.msg_iov = &io;
+  header.msg_iovlen = 1;
+  header.msg_control = control;
+  header.msg_controllen = sizeof(control);
+
+#if defined(MSG_CMSG_CLOEXEC)
+  int const flags = MSG_CMSG_CLOEXEC | MSG_WAITALL;
+#else
+  int const flags = MSG_WAITALL;
+#endif
+  ssize_t received = -1;
+  do {
+    received = recvmsg(socket, &header, flags);
+  } while (received < 0 && errno == EINTR);
+  if (received < 0) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+
+  int fds[kMaxBuffers + kSemaphoreCount];
+  std::memset(fds, -1, sizeof(fds));
+  uint32_t fdCount = 0;
+  for (auto* cmsg = CMSG_FIRSTHDR(&header); cmsg; cmsg = CMSG_NXTHDR(&header, cmsg)) {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+      fdCount = static_cast<uint32_t>((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+      std::memcpy(fds, CMSG_DATA(cmsg), sizeof(int) * fdCount);
+    }
+  }
+#if !defined(MSG_CMSG_CLOEXEC)
+  // Without MSG_CMSG_CLOEXEC a fork() on another thread may still leak the fds before this point.
+  for (uint32_t i = 0; i < fdCount; ++i) {
+    (void)fcntl(fds[i], F_SETFD, fcntl(fds[i], F_GETFD) | FD_CLOEXEC);
+  }
+#endif
+
+  if (received != static_cast<ssize_t>(sizeof(message)) || (header.msg_flags & MSG_CTRUNC) ||
+      message.magic != kMagic || message.version != kVersion || message.bufferCount == 0 ||
+      message.bufferCount > kMaxBuffers || fdCount != message.bufferCount + kSemaphoreCount) {
+    closeAll(fds, fdCount);
+    return VK_ERROR_INVALID_EXTERNAL_HANDLE;
+  }
+  if (std::memcmp(message.deviceUUID, deviceUUID_, VK_UUID_SIZE) != 0 ||
+      std::memcmp(message.driverUUID, driverUUID_, VK_UUID_SIZE) != 0) {
+    closeAll(fds, fdCount);
+    return VK_ERROR_INCOMPATIBLE_DRIVER;
+  }
+
+  size_ = message.size;
+  usage_ = message.usage;
+  allocationSize_ = message.allocationSize;
+  memoryTypeIndex_ = message.memoryTypeIndex;
+  dedicated_ = message.dedicated != 0;
+  auto result = checkExternalMemory(VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT);
+  if (result != VK_SUCCESS) {
+    closeAll(fds, fdCount);
+    return result;
+  }
+
+  // A successful import transfers the ownership of the fd to the driver, so each fd is cleared once it is consumed.
+  VkSemaphore* semaphores[kSemaphoreCount] = {&readySemaphore_, &releaseSemaphore_};
+  for (uint32_t i = 0; i < kSemaphoreCount && result == VK_SUCCESS; ++i) {
+    result = createSemaphore(false, *semaphores[i]);
+    if (result != VK_SUCCESS) {
+      break;
+    }
+    VkImportSemaphoreFdInfoKHR importInfo = {};
+    importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR;
+    importInfo.semaphore = *semaphores[i];
+    importInfo.handleType = kSemaphoreHandleType;
+    importInfo.fd = fds[message.bufferCount + i];
+    result = volk_.vkImportSemaphoreFdKHR(device_, &importInfo);
+    if (result == VK_SUCCESS) {
+      fds[message.bufferCount + i] = -1;
+    }
+  }
+
+  for (bufferCount_ = 0; result == VK_SUCCESS && bufferCount_ < message.bufferCount;) {
+    auto const index = bufferCount_++;
+    auto& buffer = buffers_[index];
+    VkMemoryRequirements requirements = {};
+    result = createBuffer(buffer, requirements);
+    if (result != VK_SUCCESS) {
+      break;
+    }
+    if (requirements.size > allocationSize_ || !(requirements.memoryTypeBits & (1u << memoryTypeIndex_))) {
+      result = VK_ERROR_INVALID_EXTERNAL_HANDLE;
+      break;
+    }
+
+    // vkGetMemoryFdPropertiesKHR doesn't apply to opaque fds: the memory type and size come from the producer, and a
+    // dedicated allocation must be imported as one.
+    VkMemoryDedicatedAllocateInfo dedicatedInfo = {};
+    dedicatedInfo.sType = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+    dedicatedInfo.buffer = buffer.buffer;
+    VkImportMemoryFdInfoKHR importInfo = {};
+    importInfo.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR;
+    importInfo.pNext = dedicated_ ? &dedicatedInfo : nullptr;
+    importInfo.handleType = kMemoryHandleType;
+    importInfo.fd = fds[index];
+    VkMemoryAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocateInfo.pNext = &importInfo;
+    allocateInfo.allocationSize = allocationSize_;
+    allocateInfo.memoryTypeIndex = memoryTypeIndex_;
+    result = volk_.vkAllocateMemory(device_, &allocateInfo, nullptr, &buffer.memory);
+    if (result == VK_SUCCESS) {
+      fds[index] = -1;
+      result = volk_.vkBindBufferMemory(device_, buffer.buffer, buffer.memory, 0);
+    }
+  }
+
+  closeAll(fds, fdCount);
+  if (result != VK_SUCCESS) {
+    destroy();
+  }
+  return result;
+}
+
+uint32_t VolkSharedChannel::getBufferCount() const noexcept {
+  return bufferCount_;
+}
+
+VkDeviceSize VolkSharedChannel::getBufferSize() const noexcept {
+  return size_;
+}
+
+const VolkSharedChannel::Buffer& VolkSharedChannel::getBuffer(uint32_t index) const noexcept {
+  return buffers_[index];
+}
+
+uint32_t VolkSharedChannel::getBufferIndex(uint64_t frame) const noexcept {
+  return bufferCount_ != 0 ? static_cast<uint32_t>((frame - 1) % bufferCount_) : 0;
+}
+
+VkSemaphore VolkSharedChannel::getReadySemaphore() const noexcept {
+  return readySemaphore_;
+}
+
+VkSemaphore VolkSharedChannel::getReleaseSemaphore() const noexcept {
+  return releaseSemaphore_;
+}
+
+VkResult VolkSharedChannel::waitWritable(uint64_t frame, uint64_t timeout /* = UINT64_MAX */) noexcept {
+  // The buffer of frame N was last used by frame N - bufferCount.
+  if (frame <= bufferCount_) {
+    return VK_SUCCESS;
+  }
+  return wait(releaseSemaphore_, frame - bufferCount_, timeout);
+}
+
+VkResult VolkSharedChannel::waitReadable(uint64_t frame, uint64_t timeout /* = UINT64_MAX */) noexcept {
+  return wait(readySemaphore_, frame, timeout);
+}
+
+VkResult VolkSharedChannel::wait(VkSemaphore semaphore, uint64_t value, uint64_t timeout) noexcept {
+  if (!waitSemaphores_ || semaphore == VK_NULL_HANDLE) {
+    return VK_ERROR_INITIALIZATION_FAILED;
+  }
+  VkSemaphoreWaitInfo waitInfo = {};
+  waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+  waitInfo.semaphoreCount = 1;
+  waitInfo.pSemaphores = &semaphore;
+  waitInfo.pValues = &value;
+  return waitSemaphores_(device_, &waitInfo, timeout);
+}
+
+#endif
@@ -0,0 +1,116 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <cstdint>
+
+#if defined(VK_BASE_VERSION_1_2) && defined(VK_KHR_external_memory_fd) && defined(VK_KHR_external_semaphore_fd) && \
+  !defined(_WIN32)
+
+/**
+ * Buffers and timeline semaphores shared between two processes through opaque file descriptors.
+ *
+ * The producer creates the channel's buffers and semaphores with createBuffers() and passes them with send() over a
+ * connected Unix domain socket (e.g. from socketpair() before fork(), or accept()/connect()). The consumer, on the
+ * same physical device, imports them with receive(). Both processes then share the memory; frames move without copies:
+ *
+ *  - frame N (starting at 1) uses buffer getBufferIndex(N);
+ *  - the producer waits for waitWritable(N), writes the buffer and signals the ready semaphore with N;
+ *  - the consumer waits for waitReadable(N) (or waits on the ready semaphore in its submission), reads the buffer and
+ *    signals the release semaphore with N.
+ *
+ * Buffers use VK_SHARING_MODE_EXCLUSIVE and are only shared with VK_QUEUE_FAMILY_EXTERNAL ownership transfers, which
+ * are left to the application. Both processes need VK_KHR_external_memory_fd, VK_KHR_external_semaphore_fd and
+ * timeline semaphores.
+ */
+class VolkSharedChannel final {
+public:
+  static constexpr uint32_t kMaxBuffers = 8;
+
+  struct Buffer {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+  };
+
+  /**
+   * Volk must have device function pointers loaded for the given device.
+   */
+  VolkSharedChannel(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device) noexcept;
+  ~VolkSharedChannel() noexcept;
+  VolkSharedChannel(const VolkSharedChannel&) = delete;
+  VolkSharedChannel& operator=(const VolkSharedChannel&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if the fd, external memory capability or timeline semaphore functions are
+   * missing.
+   */
+  [[nodiscard]] VkResult getStatus() const noexcept;
+
+  /**
+   * Producer: create bufferCount exportable buffers of the given size and usage, and the ready and release
+   * semaphores. Returns VK_ERROR_FEATURE_NOT_PRESENT if such buffers can't be exported as opaque fds. Memory is
+   * allocated as dedicated allocations if the driver requires it.
+   */
+  [[nodiscard]] VkResult createBuffers(uint32_t bufferCount, VkDeviceSize size, VkBufferUsageFlags usage) noexcept;
+
+  /**
+   * Producer: export the buffers and semaphores and send them over the socket in one message.
+   */
+  [[nodiscard]] VkResult send(int socket) noexcept;
+
+  /**
+   * Consumer: receive a message sent by send() and import its buffers and semaphores. Returns
+   * VK_ERROR_INCOMPATIBLE_DRIVER if the producer runs on another device or driver, VK_ERROR_FEATURE_NOT_PRESENT if
+   * the buffers can't be imported. The received fds are close-on-exec.
+   */
+  [[nodiscard]] VkResult receive(int socket) noexcept;
+
+  [[nodiscard]] uint32_t getBufferCount() const noexcept;
+  [[nodiscard]] VkDeviceSize getBufferSize() const noexcept;
+  [[nodiscard]] const Buffer& getBuffer(uint32_t index) const noexcept;
+  [[nodiscard]] uint32_t getBufferIndex(uint64_t frame) const noexcept;
+  [[nodiscard]] VkSemaphore getReadySemaphore() const noexcept;
+  [[nodiscard]] VkSemaphore getReleaseSemaphore() const noexcept;
+
+  /**
+   * Producer: wait until the consumer has released the buffer of the given frame.
+   */
+  [[nodiscard]] VkResult waitWritable(uint64_t frame, uint64_t timeout = UINT64_MAX) noexcept;
+
+  /**
+   * Consumer: wait until the producer has signaled the given frame.
+   */
+  [[nodiscard]] VkResult waitReadable(uint64_t frame, uint64_t timeout = UINT64_MAX) noexcept;
+
+private:
+  struct Message;
+
+  // Fails unless opaque fd buffers of usage_ support the required features; sets dedicated_ if they must be dedicated.
+  [[nodiscard]] VkResult checkExternalMemory(VkExternalMemoryFeatureFlags required) noexcept;
+  [[nodiscard]] VkResult createSemaphore(bool exportable, VkSemaphore& semaphore) noexcept;
+  [[nodiscard]] VkResult createBuffer(Buffer& buffer, VkMemoryRequirements& requirements) noexcept;
+  [[nodiscard]] VkResult wait(VkSemaphore semaphore, uint64_t value, uint64_t timeout) noexcept;
+  void destroy() noexcept;
+
+  Volk& volk_;
+  VkPhysicalDevice physicalDevice_ = VK_NULL_HANDLE;
+  VkDevice device_ = VK_NULL_HANDLE;
+  PFN_vkWaitSemaphores waitSemaphores_ = nullptr;
+  PFN_vkGetPhysicalDeviceExternalBufferProperties getExternalBufferProperties_ = nullptr;
+  VkPhysicalDeviceMemoryProperties memoryProperties_ = {};
+  uint8_t deviceUUID_[VK_UUID_SIZE] = {};
+  uint8_t driverUUID_[VK_UUID_SIZE] = {};
+
+  VkDeviceSize size_ = 0;
+  VkDeviceSize allocationSize_ = 0;
+  VkBufferUsageFlags usage_ = 0;
+  uint32_t memoryTypeIndex_ = 0;
+  uint32_t bufferCount_ = 0;
+  bool dedicated_ = false;
+  Buffer buffers_[kMaxBuffers];
+  VkSemaphore readySemaphore_ = VK_NULL_HANDLE;
+  VkSemaphore releaseSemaphore_ = VK_NULL_HANDLE;
+};
+
+#endif
@@ -0,0 +1,224 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_state_filter.hpp"
+
+#if defined(VK_COMPUTE_VERSION_1_0)
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+// Bit range [first, first + count) of a 64-bit word, count <= 64.
+uint64_t bitRange(uint32_t first, uint32_t count) noexcept {
+  auto const bits = count >= 64 ? ~0ull : (1ull << count) - 1;
+  return bits << first;
+}
+} // namespace
+
+VolkStateFilter::VolkStateFilter(Volk& volk) noexcept : volk_(volk) {}
+
+VkResult VolkStateFilter::getStatus() const noexcept {
+  if (!volk_.vkBeginCommandBuffer || !volk_.vkCmdExecuteCommands || !volk_.vkCmdBindPipeline ||
+      !volk_.vkCmdBindDescriptorSets || !volk_.vkCmdPushConstants) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  if (!volk_.vkCmdSetViewport || !volk_.vkCmdSetScissor) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+#endif
+  return VK_SUCCESS;
+}
+
+void VolkStateFilter::invalidate() noexcept {
+  for (auto& bindPoint : bindPoints_) {
+    bindPoint = {};
+  }
+  viewportMask_ = 0;
+  scissorMask_ = 0;
+  pushConstantsLayout_ = VK_NULL_HANDLE;
+  pushConstantsStages_ = 0;
+  for (auto& mask : pushConstantsMask_) {
+    mask = 0;
+  }
+}
+
+const VolkStateFilter::Stats& VolkStateFilter::getStats() const noexcept {
+  return stats_;
+}
+
+void VolkStateFilter::resetStats() noexcept {
+  stats_ = {};
+}
+
+bool VolkStateFilter::track(VkCommandBuffer commandBuffer, Command command) noexcept {
+  ++stats_.calls[static_cast<uint32_t>(command)];
+  if (commandBuffer != commandBuffer_) {
+    commandBuffer_ = commandBuffer;
+    invalidate();
+    return false;
+  }
+  return true;
+}
+
+void VolkStateFilter::elide(Command command) noexcept {
+  ++stats_.elided[static_cast<uint32_t>(command)];
+}
+
+VkResult VolkStateFilter::vkBeginCommandBuffer(VkCommandBuffer commandBuffer,
+                                               const VkCommandBufferBeginInfo* pBeginInfo) noexcept {
+  commandBuffer_ = commandBuffer;
+  invalidate();
+  return volk_.vkBeginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+void VolkStateFilter::vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                                           const VkCommandBuffer* pCommandBuffers) noexcept {
+  // Secondary command buffers leave the primary's state undefined.
+  invalidate();
+  volk_.vkCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
+
+void VolkStateFilter::vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                        VkPipeline pipeline) noexcept {
+  auto const index = static_cast<uint32_t>(pipelineBindPoint);
+  auto const tracked = track(commandBuffer, Command::BindPipeline);
+  if (index < kBindPointCount) {
+    if (tracked && bindPoints_[index].pipeline == pipeline) {
+      elide(Command::BindPipeline);
+      return;
+    }
+    bindPoints_[index].pipeline = pipeline;
+  }
+  if (pipelineBindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+    // Static viewport and scissor state of the new pipeline overrides the dynamic one.
+    viewportMask_ = 0;
+    scissorMask_ = 0;
+  }
+  // Push constants become undefined if the new pipeline's layout isn't compatible with the one used to push them.
+  pushConstantsLayout_ = VK_NULL_HANDLE;
+  volk_.vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+
+void VolkStateFilter::vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                                              VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
+                                              const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount,
+                                              const uint32_t* pDynamicOffsets) noexcept {
+  auto const index = static_cast<uint32_t>(pipelineBindPoint);
+  auto const tracked = track(commandBuffer, Command::BindDescriptorSets);
+  if (index >= kBindPointCount) {
+    volk_.vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
+                                  pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    return;
+  }
+
+  auto& bindPoint = bindPoints_[index];
+  // Dynamic offsets aren't shadowed, and sets beyond kMaxDescriptorSets are always forwarded.
+  bool const shadowed = dynamicOffsetCount == 0 && firstSet + descriptorSetCount <= kMaxDescriptorSets;
+  if (tracked && shadowed && bindPoint.layout == layout) {
+    bool redundant = true;
+    for (uint32_t i = 0; i < descriptorSetCount && redundant; ++i) {
+      redundant = bindPoint.sets[firstSet + i] == pDescriptorSets[i];
+    }
+    if (redundant) {
+      elide(Command::BindDescriptorSets);
+      return;
+    }
+  }
+
+  if (bindPoint.layout != layout) {
+    // Binding with another layout may disturb the other sets.
+    for (auto& set : bindPoint.sets) {
+      set = VK_NULL_HANDLE;
+    }
+    bindPoint.layout = layout;
+  }
+  for (uint32_t i = 0; i < descriptorSetCount && firstSet + i < kMaxDescriptorSets; ++i) {
+    bindPoint.sets[firstSet + i] = shadowed ? pDescriptorSets[i] : VK_NULL_HANDLE;
+  }
+  volk_.vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount,
+                                pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+
+void VolkStateFilter::vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout,
+                                         VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size,
+                                         const void* pValues) noexcept {
+  auto const tracked = track(commandBuffer, Command::PushConstants);
+  if (offset + size > kMaxPushConstantsSize) {
+    pushConstantsLayout_ = VK_NULL_HANDLE;
+    volk_.vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+    return;
+  }
+
+  if (!tracked || layout != pushConstantsLayout_ || stageFlags != pushConstantsStages_) {
+    pushConstantsLayout_ = layout;
+    pushConstantsStages_ = stageFlags;
+    for (auto& mask : pushConstantsMask_) {
+      mask = 0;
+    }
+  }
+
+  bool written = true;
+  uint64_t ranges[kMaxPushConstantsSize / 64] = {};
+  for (uint32_t word = 0; word < kMaxPushConstantsSize / 64; ++word) {
+    auto const begin = std::max(offset, word * 64);
+    auto const end = std::min(offset + size, (word + 1) * 64);
+    if (begin < end) {
+      ranges[word] = bitRange(begin - word * 64, end - begin);
+      written = written && (pushConstantsMask_[word] & ranges[word]) == ranges[word];
+    }
+  }
+  if (written && std::memcmp(pushConstants_ + offset, pValues, size) == 0) {
+    elide(Command::PushConstants);
+    return;
+  }
+
+  for (uint32_t word = 0; word < kMaxPushConstantsSize / 64; ++word) {
+    pushConstantsMask_[word] |= ranges[word];
+  }
+  std::memcpy(pushConstants_ + offset, pValues, size);
+  volk_.vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+
+#if defined(VK_GRAPHICS_VERSION_1_0)
+void VolkStateFilter::vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                                       const VkViewport* pViewports) noexcept {
+  auto const tracked = track(commandBuffer, Command::SetViewport);
+  if (firstViewport + viewportCount > kMaxViewports) {
+    viewportMask_ = 0;
+    volk_.vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+    return;
+  }
+
+  auto const mask = static_cast<uint32_t>(bitRange(firstViewport, viewportCount));
+  if (tracked && (viewportMask_ & mask) == mask &&
+      std::memcmp(viewports_ + firstViewport, pViewports, sizeof(VkViewport) * viewportCount) == 0) {
+    elide(Command::SetViewport);
+    return;
+  }
+  viewportMask_ |= mask;
+  std::memcpy(viewports_ + firstViewport, pViewports, sizeof(VkViewport) * viewportCount);
+  volk_.vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+
+void VolkStateFilter::vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                                      const VkRect2D* pScissors) noexcept {
+  auto const tracked = track(commandBuffer, Command::SetScissor);
+  if (firstScissor + scissorCount > kMaxViewports) {
+    scissorMask_ = 0;
+    volk_.vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+    return;
+  }
+
+  auto const mask = static_cast<uint32_t>(bitRange(firstScissor, scissorCount));
+  if (tracked && (scissorMask_ & mask) == mask &&
+      std::memcmp(scissors_ + firstScissor, pScissors, sizeof(VkRect2D) * scissorCount) == 0) {
+    elide(Command::SetScissor);
+    return;
+  }
+  scissorMask_ |= mask;
+  std::memcpy(scissors_ + firstScissor, pScissors, sizeof(VkRect2D) * scissorCount);
+  volk_.vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+#endif
+
+#endif
@@ -0,0 +1,104 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <cstdint>
+
+#if defined(VK_COMPUTE_VERSION_1_0)
+
+/**
+ * Drops redundant state commands before they reach the driver: rebinding the bound pipeline or descriptor sets,
+ * setting the same viewports and scissors, and pushing unchanged push constant bytes.
+ *
+ * A filter shadows the state of the command buffer being recorded through it, so it is meant to be used by one thread
+ * for one command buffer at a time. The shadow state is reset by vkBeginCommandBuffer, by passing another command
+ * buffer and by vkCmdExecuteCommands. State changed by commands the filter doesn't see (e.g. shader objects or
+ * vkCmdPushDescriptorSet) must be followed by invalidate().
+ */
+class VolkStateFilter final {
+public:
+  static constexpr uint32_t kMaxDescriptorSets = 8;
+  static constexpr uint32_t kMaxViewports = 4;
+  static constexpr uint32_t kMaxPushConstantsSize = 128;
+
+  enum class Command : uint32_t {
+    BindPipeline,
+    BindDescriptorSets,
+    SetViewport,
+    SetScissor,
+    PushConstants,
+  };
+  static constexpr uint32_t kCommandCount = 5;
+
+  struct Stats {
+    uint64_t calls[kCommandCount] = {};
+    uint64_t elided[kCommandCount] = {};
+  };
+
+  /**
+   * Volk must have device function pointers loaded.
+   */
+  explicit VolkStateFilter(Volk& volk) noexcept;
+  VolkStateFilter(const VolkStateFilter&) = delete;
+  VolkStateFilter& operator=(const VolkStateFilter&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if any of the filtered commands isn't loaded.
+   */
+  [[nodiscard]] VkResult getStatus() const noexcept;
+
+  /**
+   * Forget all shadowed state; the next state command of each kind is always forwarded.
+   */
+  void invalidate() noexcept;
+
+  [[nodiscard]] const Stats& getStats() const noexcept;
+  void resetStats() noexcept;
+
+  VkResult vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) noexcept;
+  void vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
+                            const VkCommandBuffer* pCommandBuffers) noexcept;
+  void vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                         VkPipeline pipeline) noexcept;
+  void vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint,
+                               VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount,
+                               const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount,
+                               const uint32_t* pDynamicOffsets) noexcept;
+  void vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags,
+                          uint32_t offset, uint32_t size, const void* pValues) noexcept;
+#if defined(VK_GRAPHICS_VERSION_1_0)
+  void vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount,
+                        const VkViewport* pViewports) noexcept;
+  void vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount,
+                       const VkRect2D* pScissors) noexcept;
+#endif
+
+private:
+  // Graphics and compute; other bind points aren't shadowed.
+  static constexpr uint32_t kBindPointCount = 2;
+
+  struct BindPointState {
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    VkDescriptorSet sets[kMaxDescriptorSets] = {};
+  };
+
+  [[nodiscard]] bool track(VkCommandBuffer commandBuffer, Command command) noexcept;
+  void elide(Command command) noexcept;
+
+  Volk& volk_;
+  VkCommandBuffer commandBuffer_ = VK_NULL_HANDLE;
+  BindPointState bindPoints_[kBindPointCount];
+  uint32_t viewportMask_ = 0;
+  uint32_t scissorMask_ = 0;
+  VkViewport viewports_[kMaxViewports] = {};
+  VkRect2D scissors_[kMaxViewports] = {};
+  VkPipelineLayout pushConstantsLayout_ = VK_NULL_HANDLE;
+  VkShaderStageFlags pushConstantsStages_ = 0;
+  uint64_t pushConstantsMask_[kMaxPushConstantsSize / 64] = {}; // bytes written since the last reset
+  uint8_t pushConstants_[kMaxPushConstantsSize] = {};
+  Stats stats_;
+};
+
+#endif
@@ -0,0 +1,199 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_submit_queue.hpp"
+
+#if defined(VK_BASE_VERSION_1_3)
+
+#include <algorithm>
+
+VolkSubmitQueue::VolkSubmitQueue(Volk& volk, VkQueue queue, bool submitThread /* = false */) noexcept
+  : volk_(volk)
+  , queue_(queue)
+  , queueSubmit2_(volk.vkQueueSubmit2) {
+#if defined(VK_KHR_synchronization2)
+  if (!queueSubmit2_) {
+    queueSubmit2_ = volk.vkQueueSubmit2KHR;
+  }
+#endif
+  if (submitThread) {
+    thread_ = std::thread([this] { run(); });
+  }
+}
+
+VolkSubmitQueue::~VolkSubmitQueue() noexcept {
+  if (thread_.joinable()) {
+    {
+      std::lock_guard lock(threadMutex_);
+      stop_ = true;
+    }
+    wakeUp_.notify_one();
+    thread_.join();
+  }
+
+  for (auto* node : pending_) {
+    delete node;
+  }
+  auto* node = head_.exchange(nullptr);
+  while (node) {
+    auto* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+VkResult VolkSubmitQueue::getStatus() const noexcept {
+  if (!queueSubmit2_) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+  return threadStatus_.load();
+}
+
+VolkSubmitQueue::Stats VolkSubmitQueue::getStats() const noexcept {
+  std::lock_guard lock(queueMutex_);
+  return stats_;
+}
+
+uint64_t VolkSubmitQueue::enqueue(const VkSubmitInfo2& submitInfo, uint32_t dependencyCount /* = 0 */,
+                                  const uint64_t* pDependencies /* = nullptr */) noexcept {
+  auto* node = new Node();
+  node->ticket = nextTicket_.fetch_add(1);
+  node->submitInfo = submitInfo;
+  node->waitSemaphoreInfos.assign(submitInfo.pWaitSemaphoreInfos,
+                                  submitInfo.pWaitSemaphoreInfos + submitInfo.waitSemaphoreInfoCount);
+  node->commandBufferInfos.assign(submitInfo.pCommandBufferInfos,
+                                  submitInfo.pCommandBufferInfos + submitInfo.commandBufferInfoCount);
+  node->signalSemaphoreInfos.assign(submitInfo.pSignalSemaphoreInfos,
+                                    submitInfo.pSignalSemaphoreInfos + submitInfo.signalSemaphoreInfoCount);
+  node->submitInfo.pWaitSemaphoreInfos = node->waitSemaphoreInfos.data();
+  node->submitInfo.pCommandBufferInfos = node->commandBufferInfos.data();
+  node->submitInfo.pSignalSemaphoreInfos = node->signalSemaphoreInfos.data();
+  for (uint32_t i = 0; i < dependencyCount; ++i) {
+    if (pDependencies[i] != 0 && pDependencies[i] < node->ticket) {
+      node->dependencies.push_back(pDependencies[i]);
+    }
+  }
+
+  auto const ticket = node->ticket;
+  node->next = head_.load(std::memory_order_relaxed);
+  while (!head_.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+  return ticket;
+}
+
+VkResult VolkSubmitQueue::flush(VkFence fence /* = VK_NULL_HANDLE */) noexcept {
+  if (!queueSubmit2_) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+  if (thread_.joinable()) {
+    {
+      std::lock_guard lock(threadMutex_);
+      flushes_.push_back(fence);
+    }
+    wakeUp_.notify_one();
+    return VK_SUCCESS;
+  }
+
+  std::lock_guard lock(queueMutex_);
+  return submit(fence);
+}
+
+void VolkSubmitQueue::wait() noexcept {
+  std::unique_lock lock(threadMutex_);
+  idle_.wait(lock, [this] { return flushes_.empty() && !busy_; });
+}
+
+VkResult VolkSubmitQueue::submit(VkFence fence) noexcept {
+  if (!queueSubmit2_) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+
+  // The stack holds the newest batch first; append in enqueue order.
+  auto const first = pending_.size();
+  for (auto* node = head_.exchange(nullptr, std::memory_order_acquire); node; node = node->next) {
+    pending_.push_back(node);
+  }
+  std::reverse(pending_.begin() + static_cast<ptrdiff_t>(first), pending_.end());
+
+  // Repeat until no more batches become ready; a batch may depend on one placed earlier in the same call.
+  submitInfos_.clear();
+  placed_.clear();
+  bool progress = true;
+  while (progress) {
+    progress = false;
+    for (auto& node : pending_) {
+      if (!node || !std::all_of(node->dependencies.begin(), node->dependencies.end(), [this](uint64_t ticket) {
+            return isSubmitted(ticket) || placed_.count(ticket) != 0;
+          })) {
+        continue;
+      }
+      submitInfos_.push_back(node->submitInfo);
+      placed_.insert(node->ticket);
+      submitted_.push_back(node);
+      node = nullptr;
+      progress = true;
+    }
+  }
+  pending_.erase(std::remove(pending_.begin(), pending_.end(), nullptr), pending_.end());
+
+  VkResult result = VK_SUCCESS;
+  if (!submitInfos_.empty() || fence != VK_NULL_HANDLE) {
+    result = queueSubmit2_(queue_, static_cast<uint32_t>(submitInfos_.size()), submitInfos_.data(), fence);
+    ++stats_.driverCalls;
+  }
+
+  if (result != VK_SUCCESS) {
+    // Nothing was submitted: keep the batches pending in enqueue order so the next flush retries them.
+    pending_.insert(pending_.end(), submitted_.begin(), submitted_.end());
+    std::sort(pending_.begin(), pending_.end(), [](const Node* a, const Node* b) { return a->ticket < b->ticket; });
+    submitted_.clear();
+    return result;
+  }
+
+  stats_.batches += submitInfos_.size();
+  for (auto* node : submitted_) {
+    markSubmitted(node->ticket);
+    delete node;
+  }
+  submitted_.clear();
+  return result;
+}
+
+bool VolkSubmitQueue::isSubmitted(uint64_t ticket) const noexcept {
+  return ticket < submittedBelow_ || submittedAbove_.count(ticket) != 0;
+}
+
+void VolkSubmitQueue::markSubmitted(uint64_t ticket) noexcept {
+  submittedAbove_.insert(ticket);
+  while (submittedAbove_.erase(submittedBelow_) != 0) {
+    ++submittedBelow_;
+  }
+}
+
+void VolkSubmitQueue::run() noexcept {
+  std::vector<VkFence> fences;
+  for (;;) {
+    {
+      std::unique_lock lock(threadMutex_);
+      busy_ = false;
+      if (flushes_.empty()) {
+        idle_.notify_all();
+      }
+      wakeUp_.wait(lock, [this] { return stop_ || !flushes_.empty(); });
+      if (flushes_.empty()) {
+        return;
+      }
+      fences.swap(flushes_);
+      busy_ = true;
+    }
+
+    std::lock_guard lock(queueMutex_);
+    for (auto fence : fences) {
+      auto const result = submit(fence);
+      if (result != VK_SUCCESS) {
+        threadStatus_ = result;
+      }
+    }
+    fences.clear();
+  }
+}
+
+#endif
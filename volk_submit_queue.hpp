@@ -0,0 +1,125 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#if defined(VK_BASE_VERSION_1_3)
+
+/**
+ * Submission service for one VkQueue: producers on any thread enqueue VkSubmitInfo2 batches without locking, and
+ * flush() submits everything enqueued so far with a single vkQueueSubmit2 call.
+ *
+ * A batch may declare tickets of earlier batches it depends on; it is placed after them in the submission and held
+ * back until they have been submitted. Dependencies only order submissions: execution dependencies between batches
+ * still need semaphores.
+ *
+ * With a submit thread flush() only wakes the thread, so the caller never blocks in the driver, and errors are
+ * reported by getStatus(). The service externally synchronizes the queue: other queue operations must go through
+ * call(). Batches which were never flushed are discarded by the destructor.
+ */
+class VolkSubmitQueue final {
+public:
+  struct Stats {
+    uint64_t batches = 0;     // batches submitted
+    uint64_t driverCalls = 0; // vkQueueSubmit2 calls
+  };
+
+  /**
+   * Volk must have device function pointers loaded.
+   */
+  VolkSubmitQueue(Volk& volk, VkQueue queue, bool submitThread = false) noexcept;
+  ~VolkSubmitQueue() noexcept;
+  VolkSubmitQueue(const VolkSubmitQueue&) = delete;
+  VolkSubmitQueue& operator=(const VolkSubmitQueue&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if neither Vulkan 1.3 nor VK_KHR_synchronization2 is loaded, otherwise
+   * the error of the last failed submission on the submit thread, or VK_SUCCESS.
+   */
+  [[nodiscard]] VkResult getStatus() const noexcept;
+
+  /**
+   * Enqueue a batch; its arrays are copied, its pNext chain must stay alive until the batch is submitted. Returns a
+   * ticket which other batches can depend on. Dependencies on tickets which haven't been handed out yet are ignored.
+   * Can be called from any thread.
+   */
+  uint64_t enqueue(const VkSubmitInfo2& submitInfo, uint32_t dependencyCount = 0,
+                   const uint64_t* pDependencies = nullptr) noexcept;
+
+  /**
+   * Submit the enqueued batches whose dependencies have been submitted, signaling fence when they complete (the fence
+   * is signaled even if nothing was submitted). If vkQueueSubmit2 fails the batches stay enqueued and the next flush
+   * submits them again. With a submit thread this returns immediately.
+   */
+  VkResult flush(VkFence fence = VK_NULL_HANDLE) noexcept;
+
+  /**
+   * Submit the enqueued batches on the calling thread, then call a function pointer with the queue locked, e.g.
+   * call(volk.vkQueuePresentKHR, queue, &presentInfo).
+   */
+  template <typename Function, typename... Args>
+  decltype(auto) call(Function function, Args... args) noexcept {
+    std::lock_guard lock(queueMutex_);
+    (void)submit(VK_NULL_HANDLE);
+    return function(args...);
+  }
+
+  /**
+   * Block until the submit thread has processed all flushes requested so far.
+   */
+  void wait() noexcept;
+
+  [[nodiscard]] Stats getStats() const noexcept;
+
+private:
+  struct Node {
+    Node* next = nullptr;
+    uint64_t ticket = 0;
+    VkSubmitInfo2 submitInfo = {};
+    std::vector<VkSemaphoreSubmitInfo> waitSemaphoreInfos;
+    std::vector<VkCommandBufferSubmitInfo> commandBufferInfos;
+    std::vector<VkSemaphoreSubmitInfo> signalSemaphoreInfos;
+    std::vector<uint64_t> dependencies;
+  };
+
+  // Called with queueMutex_ locked.
+  [[nodiscard]] VkResult submit(VkFence fence) noexcept;
+  [[nodiscard]] bool isSubmitted(uint64_t ticket) const noexcept;
+  void markSubmitted(uint64_t ticket) noexcept;
+  void run() noexcept;
+
+  Volk& volk_;
+  VkQueue queue_ = VK_NULL_HANDLE;
+  PFN_vkQueueSubmit2 queueSubmit2_ = nullptr;
+
+  std::atomic<Node*> head_ = nullptr;
+  std::atomic<uint64_t> nextTicket_ = 1;
+
+  mutable std::mutex queueMutex_;
+  std::vector<Node*> pending_;
+  std::vector<Node*> submitted_;
+  std::vector<VkSubmitInfo2> submitInfos_;
+  std::unordered_set<uint64_t> placed_; // tickets placed in the current submission
+  uint64_t submittedBelow_ = 1; // every ticket below is submitted
+  std::unordered_set<uint64_t> submittedAbove_;
+  Stats stats_;
+
+  std::atomic<VkResult> threadStatus_ = VK_SUCCESS;
+  std::mutex threadMutex_;
+  std::condition_variable wakeUp_;
+  std::condition_variable idle_;
+  std::vector<VkFence> flushes_;
+  bool busy_ = false;
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+#endif
@@ -0,0 +1,216 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_sync_pool.hpp"
+
+namespace {
+
+// A thread's list longer than this gives half of its objects to the global list.
+constexpr size_t kMaxLocalObjects = 256;
+
+template <typename Handle>
+void moveHalf(std::vector<Handle>& from, std::vector<Handle>& to) noexcept {
+  auto const count = from.size() / 2;
+  to.insert(to.end(), from.end() - count, from.end());
+  from.resize(from.size() - count);
+}
+
+template <typename Handle>
+bool take(std::vector<Handle>& from, Handle& handle) noexcept {
+  if (from.empty()) {
+    return false;
+  }
+  handle = from.back();
+  from.pop_back();
+  return true;
+}
+
+} // namespace
+
+VolkSyncPool::VolkSyncPool(Volk& volk, VkDevice device) noexcept
+  : volk_(volk)
+  , device_(device) {}
+
+VolkSyncPool::~VolkSyncPool() noexcept {
+  auto destroy = [this](Lists& lists) {
+    for (auto fence : lists.fences) {
+      volk_.vkDestroyFence(device_, fence, nullptr);
+    }
+    for (auto fence : lists.dirtyFences) {
+      volk_.vkDestroyFence(device_, fence, nullptr);
+    }
+    for (auto semaphore : lists.semaphores) {
+      volk_.vkDestroySemaphore(device_, semaphore, nullptr);
+    }
+    for (auto event : lists.events) {
+      volk_.vkDestroyEvent(device_, event, nullptr);
+    }
+    for (auto event : lists.dirtyEvents) {
+      volk_.vkDestroyEvent(device_, event, nullptr);
+    }
+  };
+  for (auto& slot : threadSlots_) {
+    destroy(slot.lists);
+  }
+  destroy(global_);
+}
+
+VkFence VolkSyncPool::acquireFence() noexcept {
+  auto const index = slots_.acquire();
+  auto& slot = threadSlots_[index];
+  std::unique_lock lock(slot.mutex, std::defer_lock);
+  if (index == slots_.kSharedSlot) {
+    lock.lock();
+  }
+
+  VkFence fence = VK_NULL_HANDLE;
+  if (take(slot.lists.fences, fence)) {
+    return fence;
+  }
+  if (!slot.lists.dirtyFences.empty()) {
+    cleanFences(slot.lists);
+    if (take(slot.lists.fences, fence)) {
+      return fence;
+    }
+  }
+  {
+    std::lock_guard globalLock(globalMutex_);
+    if (!global_.dirtyFences.empty()) {
+      cleanFences(global_);
+    }
+    if (take(global_.fences, fence)) {
+      return fence;
+    }
+  }
+
+  VkFenceCreateInfo createInfo = {};
+  createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+  if (volk_.vkCreateFence(device_, &createInfo, nullptr, &fence) != VK_SUCCESS) {
+    return VK_NULL_HANDLE;
+  }
+  fencesCreated_.fetch_add(1, std::memory_order_relaxed);
+  return fence;
+}
+
+void VolkSyncPool::releaseFence(VkFence fence) noexcept {
+  release(&Lists::dirtyFences, fence);
+}
+
+VkSemaphore VolkSyncPool::acquireSemaphore() noexcept {
+  auto const index = slots_.acquire();
+  auto& slot = threadSlots_[index];
+  std::unique_lock lock(slot.mutex, std::defer_lock);
+  if (index == slots_.kSharedSlot) {
+    lock.lock();
+  }
+
+  VkSemaphore semaphore = VK_NULL_HANDLE;
+  if (take(slot.lists.semaphores, semaphore)) {
+    return semaphore;
+  }
+  {
+    std::lock_guard globalLock(globalMutex_);
+    if (take(global_.semaphores, semaphore)) {
+      return semaphore;
+    }
+  }
+
+  VkSemaphoreCreateInfo createInfo = {};
+  createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  if (volk_.vkCreateSemaphore(device_, &createInfo, nullptr, &semaphore) != VK_SUCCESS) {
+    return VK_NULL_HANDLE;
+  }
+  semaphoresCreated_.fetch_add(1, std::memory_order_relaxed);
+  return semaphore;
+}
+
+void VolkSyncPool::releaseSemaphore(VkSemaphore semaphore) noexcept {
+  release(&Lists::semaphores, semaphore);
+}
+
+VkEvent VolkSyncPool::acquireEvent() noexcept {
+  auto const index = slots_.acquire();
+  auto& slot = threadSlots_[index];
+  std::unique_lock lock(slot.mutex, std::defer_lock);
+  if (index == slots_.kSharedSlot) {
+    lock.lock();
+  }
+
+  VkEvent event = VK_NULL_HANDLE;
+  if (take(slot.lists.events, event)) {
+    return event;
+  }
+  if (!slot.lists.dirtyEvents.empty()) {
+    cleanEvents(slot.lists);
+    if (take(slot.lists.events, event)) {
+      return event;
+    }
+  }
+  {
+    std::lock_guard globalLock(globalMutex_);
+    if (!global_.dirtyEvents.empty()) {
+      cleanEvents(global_);
+    }
+    if (take(global_.events, event)) {
+      return event;
+    }
+  }
+
+  VkEventCreateInfo createInfo = {};
+  createInfo.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+  if (volk_.vkCreateEvent(device_, &createInfo, nullptr, &event) != VK_SUCCESS) {
+    return VK_NULL_HANDLE;
+  }
+  eventsCreated_.fetch_add(1, std::memory_order_relaxed);
+  return event;
+}
+
+void VolkSyncPool::releaseEvent(VkEvent event) noexcept {
+  release(&Lists::dirtyEvents, event);
+}
+
+VolkSyncPool::Stats VolkSyncPool::getStats() const noexcept {
+  Stats stats;
+  stats.fencesCreated = fencesCreated_.load(std::memory_order_relaxed);
+  stats.semaphoresCreated = semaphoresCreated_.load(std::memory_order_relaxed);
+  stats.eventsCreated = eventsCreated_.load(std::memory_order_relaxed);
+  stats.fenceResetBatches = fenceResetBatches_.load(std::memory_order_relaxed);
+  return stats;
+}
+
+template <typename Handle>
+void VolkSyncPool::release(std::vector<Handle> Lists::*list, Handle handle) noexcept {
+  if (handle == VK_NULL_HANDLE) {
+    return;
+  }
+
+  auto const index = slots_.acquire();
+  auto& slot = threadSlots_[index];
+  std::unique_lock lock(slot.mutex, std::defer_lock);
+  if (index == slots_.kSharedSlot) {
+    lock.lock();
+  }
+
+  auto& local = slot.lists.*list;
+  local.push_back(handle);
+  if (local.size() > kMaxLocalObjects) {
+    std::lock_guard globalLock(globalMutex_);
+    moveHalf(local, global_.*list);
+  }
+}
+
+void VolkSyncPool::cleanFences(Lists& lists) noexcept {
+  auto& dirty = lists.dirtyFences;
+  if (volk_.vkResetFences(device_, static_cast<uint32_t>(dirty.size()), dirty.data()) != VK_SUCCESS) {
+    return;
+  }
+  fenceResetBatches_.fetch_add(1, std::memory_order_relaxed);
+  lists.fences.insert(lists.fences.end(), dirty.begin(), dirty.end());
+  dirty.clear();
+}
+
+void VolkSyncPool::cleanEvents(Lists& lists) noexcept {
+  for (auto event : lists.dirtyEvents) {
+    volk_.vkResetEvent(device_, event);
+  }
+  lists.events.insert(lists.events.end(), lists.dirtyEvents.begin(), lists.dirtyEvents.end());
+  lists.dirtyEvents.clear();
+}
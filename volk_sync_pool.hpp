@@ -0,0 +1,90 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+#include "volk_thread_slots.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * Recycling pools of fences, binary semaphores and events for one device.
+ *
+ * Every thread has its own free lists, so acquire and release don't lock unless the thread falls into the shared
+ * slot (see VolkThreadSlots) or its lists run empty or grow too long, in which case objects move through a locked
+ * global list. Objects are created lazily. Released fences are reset in batches with one vkResetFences call when the
+ * thread runs out of clean fences; released events are reset at the same point.
+ *
+ * A released object must not be in use by the device: fences and events may be signaled, semaphores must have no
+ * pending signal or wait operation.
+ */
+class VolkSyncPool final {
+public:
+  static constexpr uint32_t kMaxThreads = 16;
+
+  struct Stats {
+    uint64_t fencesCreated = 0;
+    uint64_t semaphoresCreated = 0;
+    uint64_t eventsCreated = 0;
+    uint64_t fenceResetBatches = 0; // vkResetFences calls
+  };
+
+  /**
+   * Volk must have device function pointers loaded for the given device.
+   */
+  VolkSyncPool(Volk& volk, VkDevice device) noexcept;
+  ~VolkSyncPool() noexcept;
+  VolkSyncPool(const VolkSyncPool&) = delete;
+  VolkSyncPool& operator=(const VolkSyncPool&) = delete;
+
+  /**
+   * Return an unsignaled fence, or VK_NULL_HANDLE if a new fence couldn't be created.
+   */
+  [[nodiscard]] VkFence acquireFence() noexcept;
+  void releaseFence(VkFence fence) noexcept;
+
+  [[nodiscard]] VkSemaphore acquireSemaphore() noexcept;
+  void releaseSemaphore(VkSemaphore semaphore) noexcept;
+
+  /**
+   * Return an event in the unsignaled state, or VK_NULL_HANDLE if a new event couldn't be created.
+   */
+  [[nodiscard]] VkEvent acquireEvent() noexcept;
+  void releaseEvent(VkEvent event) noexcept;
+
+  [[nodiscard]] Stats getStats() const noexcept;
+
+private:
+  struct Lists {
+    std::vector<VkFence> fences;
+    std::vector<VkFence> dirtyFences;
+    std::vector<VkSemaphore> semaphores;
+    std::vector<VkEvent> events;
+    std::vector<VkEvent> dirtyEvents;
+  };
+
+  struct Slot {
+    std::mutex mutex; // only used for the shared slot
+    Lists lists;
+  };
+
+  template <typename Handle>
+  void release(std::vector<Handle> Lists::*list, Handle handle) noexcept;
+  void cleanFences(Lists& lists) noexcept;
+  void cleanEvents(Lists& lists) noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VolkThreadSlots<kMaxThreads> slots_;
+  Slot threadSlots_[kMaxThreads];
+
+  std::mutex globalMutex_;
+  Lists global_;
+
+  std::atomic<uint64_t> fencesCreated_ = 0;
+  std::atomic<uint64_t> semaphoresCreated_ = 0;
+  std::atomic<uint64_t> eventsCreated_ = 0;
+  std::atomic<uint64_t> fenceResetBatches_ = 0;
+};
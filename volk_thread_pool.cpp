@@ -0,0 +1,105 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_thread_pool.hpp"
+
+VolkThreadPool::VolkThreadPool(uint32_t threadCount /* = 0 */) noexcept {
+  if (threadCount == 0) {
+    threadCount = std::thread::hardware_concurrency();
+  }
+  if (threadCount == 0) {
+    threadCount = 1;
+  }
+  threadCount_ = threadCount;
+
+  workers_.reserve(threadCount);
+  for (uint32_t i = 0; i < threadCount; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  threads_.reserve(threadCount);
+  for (uint32_t i = 0; i < threadCount; ++i) {
+    threads_.emplace_back([this, i] { run(i); });
+  }
+}
+
+VolkThreadPool::~VolkThreadPool() noexcept {
+  {
+    std::lock_guard lock(sleepMutex_);
+    stop_ = true;
+  }
+  wakeUp_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void VolkThreadPool::submit(Task task, Priority priority /* = Priority::Normal */) noexcept {
+  uint32_t index = getCurrentWorker();
+  if (index == getThreadCount()) {
+    index = nextWorker_.fetch_add(1, std::memory_order_relaxed) % getThreadCount();
+  }
+
+  // Counted before the push so that the counter never goes below zero; an idle worker may spin until the task lands.
+  pending_.fetch_add(1);
+  {
+    std::lock_guard lock(workers_[index]->mutex);
+    workers_[index]->queues[static_cast<uint32_t>(priority)].push_back(std::move(task));
+  }
+
+  std::lock_guard lock(sleepMutex_);
+  wakeUp_.notify_one();
+}
+
+uint32_t VolkThreadPool::getThreadCount() const noexcept {
+  return threadCount_;
+}
+
+uint32_t VolkThreadPool::getCurrentWorker() const noexcept {
+  auto id = std::this_thread::get_id();
+  for (uint32_t i = 0; i < threadCount_; ++i) {
+    if (threads_[i].get_id() == id) {
+      return i;
+    }
+  }
+  return getThreadCount();
+}
+
+void VolkThreadPool::run(uint32_t index) noexcept {
+  Task task;
+  for (;;) {
+    if (pop(index, task)) {
+      task();
+      task = nullptr;
+      continue;
+    }
+
+    std::unique_lock lock(sleepMutex_);
+    wakeUp_.wait(lock, [this] { return stop_ || pending_.load() > 0; });
+    if (stop_ && pending_.load() == 0) {
+      return;
+    }
+  }
+}
+
+bool VolkThreadPool::pop(uint32_t index, Task& task) noexcept {
+  auto const count = getThreadCount();
+  for (uint32_t priority = 0; priority < kPriorityCount; ++priority) {
+    // Own queue first (oldest task), then steal from the back of the other workers' queues.
+    for (uint32_t i = 0; i < count; ++i) {
+      auto& worker = *workers_[(index + i) % count];
+      std::lock_guard lock(worker.mutex);
+      auto& queue = worker.queues[priority];
+      if (queue.empty()) {
+        continue;
+      }
+      if (i == 0) {
+        task = std::move(queue.front());
+        queue.pop_front();
+      } else {
+        task = std::move(queue.back());
+        queue.pop_back();
+      }
+      pending_.fetch_sub(1);
+      return true;
+    }
+  }
+  return false;
+}
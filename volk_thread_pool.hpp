@@ -0,0 +1,68 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Work-stealing thread pool with priority levels, used by volk-cpp helpers that run driver work in the background.
+ *
+ * Every worker owns a queue per priority. Tasks submitted from a worker go to its own queue, other tasks are
+ * distributed round-robin. An idle worker takes the highest priority task available, first from its own queue and
+ * then from the other workers' queues.
+ *
+ * The destructor runs all tasks that are still queued before joining the workers.
+ */
+class VolkThreadPool final {
+public:
+  enum class Priority : uint32_t {
+    High = 0,
+    Normal = 1,
+    Low = 2,
+  };
+  static constexpr uint32_t kPriorityCount = 3;
+
+  using Task = std::function<void()>;
+
+  /**
+   * Creates threadCount workers, or one per hardware thread if threadCount is 0.
+   */
+  explicit VolkThreadPool(uint32_t threadCount = 0) noexcept;
+  ~VolkThreadPool() noexcept;
+  VolkThreadPool(const VolkThreadPool&) = delete;
+  VolkThreadPool& operator=(const VolkThreadPool&) = delete;
+
+  void submit(Task task, Priority priority = Priority::Normal) noexcept;
+
+  [[nodiscard]] uint32_t getThreadCount() const noexcept;
+
+  /**
+   * Index of the calling worker thread, or getThreadCount() if the caller isn't a worker of this pool.
+   */
+  [[nodiscard]] uint32_t getCurrentWorker() const noexcept;
+
+private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> queues[kPriorityCount];
+  };
+
+  void run(uint32_t index) noexcept;
+  [[nodiscard]] bool pop(uint32_t index, Task& task) noexcept;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  uint32_t threadCount_ = 0;
+  std::atomic<uint32_t> nextWorker_ = 0;
+  std::atomic<uint64_t> pending_ = 0;
+  std::mutex sleepMutex_;
+  std::condition_variable wakeUp_;
+  bool stop_ = false;
+};
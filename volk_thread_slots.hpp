@@ -0,0 +1,180 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace volk_thread_slots_detail {
+
+using ReleaseFunction = void (*)(void* slots, uint32_t slot) noexcept;
+
+struct Entry {
+  uint64_t generation = 0;
+  uint32_t releasing = 0; // claims being released by exiting threads
+};
+
+// Live VolkThreadSlots objects and their generation, so that a claim of a destroyed object (or of a new object
+// allocated at the same address) is never released.
+struct Registry {
+  std::mutex mutex;
+  std::condition_variable released;
+  std::unordered_map<void*, Entry> entries;
+  uint64_t nextGeneration = 1;
+};
+
+inline Registry& getRegistry() noexcept {
+  static Registry registry;
+  return registry;
+}
+
+struct Claim {
+  void* slots;
+  uint64_t generation;
+  uint32_t slot;
+  ReleaseFunction release;
+};
+
+// Slots claimed by the calling thread; released when the thread exits.
+struct ThreadClaims {
+  std::vector<Claim> claims;
+
+  ~ThreadClaims() {
+    // Retire callbacks run without the registry lock, so that they may use other VolkThreadSlots objects; the
+    // releasing count keeps the destructor of the released object waiting until they return.
+    auto& registry = getRegistry();
+    std::vector<Claim> live;
+    {
+      std::lock_guard lock(registry.mutex);
+      for (auto const& claim : claims) {
+        auto it = registry.entries.find(claim.slots);
+        if (it != registry.entries.end() && it->second.generation == claim.generation) {
+          ++it->second.releasing;
+          live.push_back(claim);
+        }
+      }
+    }
+    for (auto const& claim : live) {
+      claim.release(claim.slots, claim.slot);
+      {
+        std::lock_guard lock(registry.mutex);
+        --registry.entries[claim.slots].releasing;
+      }
+      registry.released.notify_all();
+    }
+  }
+
+  // Drop claims of destroyed objects, so that long-lived threads don't accumulate them.
+  void prune() noexcept {
+    auto& registry = getRegistry();
+    std::lock_guard lock(registry.mutex);
+    std::erase_if(claims, [&registry](Claim const& claim) {
+      auto it = registry.entries.find(claim.slots);
+      return it == registry.entries.end() || it->second.generation != claim.generation;
+    });
+  }
+};
+
+inline ThreadClaims& getThreadClaims() noexcept {
+  thread_local ThreadClaims threadClaims;
+  return threadClaims;
+}
+
+} // namespace volk_thread_slots_detail
+
+/**
+ * Fixed set of per-thread slots for volk-cpp helpers that keep per-thread state without locks.
+ *
+ * A thread claims the first free slot the first time it asks for one and keeps it until it exits; its slot is then
+ * handed to the retire callback, which merges the per-slot state into an accumulator of retired threads, and becomes
+ * free for another thread. Threads which find no free slot share the last one, so state in that slot must tolerate
+ * concurrent access.
+ */
+template <uint32_t Count>
+class VolkThreadSlots final {
+  static_assert(Count >= 2, "VolkThreadSlots needs at least one owned and one shared slot");
+
+public:
+  static constexpr uint32_t kSlotCount = Count;
+  static constexpr uint32_t kSharedSlot = Count - 1;
+
+  /**
+   * Called on the exiting thread when it releases its slot, before the slot can be claimed again. The callback may
+   * run concurrently with acquire() of other threads and may use other VolkThreadSlots objects; the destructor waits
+   * for running callbacks, and none starts after it.
+   */
+  using RetireCallback = std::function<void(uint32_t slot)>;
+
+  explicit VolkThreadSlots(RetireCallback onRetire = {}) noexcept : onRetire_(std::move(onRetire)) {
+    auto& registry = volk_thread_slots_detail::getRegistry();
+    std::lock_guard lock(registry.mutex);
+    generation_ = registry.nextGeneration++;
+    registry.entries[this].generation = generation_;
+  }
+
+  ~VolkThreadSlots() noexcept {
+    auto& registry = volk_thread_slots_detail::getRegistry();
+    std::unique_lock lock(registry.mutex);
+    registry.released.wait(lock, [this, &registry] { return registry.entries[this].releasing == 0; });
+    registry.entries.erase(this);
+  }
+
+  VolkThreadSlots(const VolkThreadSlots&) = delete;
+  VolkThreadSlots& operator=(const VolkThreadSlots&) = delete;
+
+  [[nodiscard]] uint32_t acquire() noexcept {
+    auto& threadClaims = volk_thread_slots_detail::getThreadClaims();
+    for (auto const& claim : threadClaims.claims) {
+      if (claim.slots == this && claim.generation == generation_) {
+        return claim.slot;
+      }
+    }
+
+    auto const id = std::this_thread::get_id();
+    uint32_t slot = kSharedSlot;
+    for (uint32_t i = 0; i < kSharedSlot; ++i) {
+      auto owner = std::thread::id();
+      if (owners_[i].load(std::memory_order_relaxed) == owner &&
+          owners_[i].compare_exchange_strong(owner, id, std::memory_order_acq_rel)) {
+        slot = i;
+        break;
+      }
+    }
+
+    if (threadClaims.claims.size() >= kPruneThreshold) {
+      threadClaims.prune();
+    }
+    threadClaims.claims.push_back({this, generation_, slot, &VolkThreadSlots::release});
+    return slot;
+  }
+
+  /**
+   * Thread which owns the slot, or a default-constructed id for free slots and the shared slot.
+   */
+  [[nodiscard]] std::thread::id getOwner(uint32_t slot) const noexcept {
+    return slot < kSharedSlot ? owners_[slot].load(std::memory_order_acquire) : std::thread::id();
+  }
+
+private:
+  static constexpr size_t kPruneThreshold = 64;
+
+  static void release(void* slots, uint32_t slot) noexcept {
+    auto self = static_cast<VolkThreadSlots*>(slots);
+    if (slot == kSharedSlot) {
+      return;
+    }
+    if (self->onRetire_) {
+      self->onRetire_(slot);
+    }
+    self->owners_[slot].store(std::thread::id(), std::memory_order_release);
+  }
+
+  RetireCallback onRetire_;
+  uint64_t generation_ = 0;
+  std::atomic<std::thread::id> owners_[kSharedSlot] = {};
+};
@@ -0,0 +1,525 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#include "volk_upload_queue.hpp"
+
+#if defined(VK_BASE_VERSION_1_3)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+namespace {
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) noexcept {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+VkImageSubresourceRange getRange(const VkImageSubresourceLayers& subresource) noexcept {
+  return {subresource.aspectMask, subresource.mipLevel, 1, subresource.baseArrayLayer, subresource.layerCount};
+}
+
+bool isSameRange(const VkImageSubresourceRange& lhs, const VkImageSubresourceRange& rhs) noexcept {
+  return lhs.aspectMask == rhs.aspectMask && lhs.baseMipLevel == rhs.baseMipLevel &&
+         lhs.levelCount == rhs.levelCount && lhs.baseArrayLayer == rhs.baseArrayLayer &&
+         lhs.layerCount == rhs.layerCount;
+}
+
+} // namespace
+
+VolkUploadQueue::VolkUploadQueue(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device, VkQueue transferQueue,
+                                 uint32_t transferQueueFamilyIndex, uint32_t dstQueueFamilyIndex,
+                                 VkDeviceSize ringSize /* = kDefaultRingSize */,
+                                 HeadroomCallback hasHeadroom /* = {} */) noexcept
+  : volk_(volk)
+  , device_(device)
+  , queue_(transferQueue)
+  , transferQueueFamilyIndex_(transferQueueFamilyIndex)
+  , dstQueueFamilyIndex_(dstQueueFamilyIndex)
+  , queueSubmit2_(volk.vkQueueSubmit2)
+  , cmdPipelineBarrier2_(volk.vkCmdPipelineBarrier2)
+  , getSemaphoreCounterValue_(volk.vkGetSemaphoreCounterValue)
+  , waitSemaphores_(volk.vkWaitSemaphores)
+  , ringSize_(alignUp(ringSize, kAlignment))
+  , hasHeadroom_(std::move(hasHeadroom)) {
+#if defined(VK_KHR_synchronization2)
+  if (!queueSubmit2_ || !cmdPipelineBarrier2_) {
+    queueSubmit2_ = volk.vkQueueSubmit2KHR;
+    cmdPipelineBarrier2_ = volk.vkCmdPipelineBarrier2KHR;
+  }
+#endif
+#if defined(VK_KHR_timeline_semaphore)
+  if (!getSemaphoreCounterValue_ || !waitSemaphores_) {
+    getSemaphoreCounterValue_ = volk.vkGetSemaphoreCounterValueKHR;
+    waitSemaphores_ = volk.vkWaitSemaphoresKHR;
+  }
+#endif
+  if (!queueSubmit2_ || !cmdPipelineBarrier2_ || !getSemaphoreCounterValue_ || !waitSemaphores_) {
+    status_ = VK_ERROR_EXTENSION_NOT_PRESENT;
+    return;
+  }
+
+  VkBufferCreateInfo bufferCreateInfo = {};
+  bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  bufferCreateInfo.size = ringSize_;
+  bufferCreateInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+  bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  status_ = volk_.vkCreateBuffer(device_, &bufferCreateInfo, nullptr, &ring_);
+  if (status_ != VK_SUCCESS) {
+    return;
+  }
+
+  // A host visible and coherent memory type always exists for buffers.
+  VkMemoryRequirements requirements = {};
+  volk_.vkGetBufferMemoryRequirements(device_, ring_, &requirements);
+  VkPhysicalDeviceMemoryProperties memoryProperties = {};
+  volk_.vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+  VkMemoryPropertyFlags const required = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+  uint32_t memoryTypeIndex = memoryProperties.memoryTypeCount;
+  for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i) {
+    if ((requirements.memoryTypeBits & (1u << i)) &&
+        (memoryProperties.memoryTypes[i].propertyFlags & required) == required) {
+      memoryTypeIndex = i;
+      break;
+    }
+  }
+  if (memoryTypeIndex == memoryProperties.memoryTypeCount) {
+    status_ = VK_ERROR_FEATURE_NOT_PRESENT;
+    return;
+  }
+
+  VkMemoryAllocateInfo allocateInfo = {};
+  allocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+  allocateInfo.allocationSize = requirements.size;
+  allocateInfo.memoryTypeIndex = memoryTypeIndex;
+  status_ = volk_.vkAllocateMemory(device_, &allocateInfo, nullptr, &ringMemory_);
+  if (status_ == VK_SUCCESS) {
+    status_ = volk_.vkBindBufferMemory(device_, ring_, ringMemory_, 0);
+  }
+  if (status_ == VK_SUCCESS) {
+    void* data = nullptr;
+    status_ = volk_.vkMapMemory(device_, ringMemory_, 0, VK_WHOLE_SIZE, 0, &data);
+    ringData_ = static_cast<uint8_t*>(data);
+  }
+  if (status_ != VK_SUCCESS) {
+    return;
+  }
+
+  VkCommandPoolCreateInfo poolCreateInfo = {};
+  poolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+  poolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+  poolCreateInfo.queueFamilyIndex = transferQueueFamilyIndex_;
+  status_ = volk_.vkCreateCommandPool(device_, &poolCreateInfo, nullptr, &commandPool_);
+  if (status_ != VK_SUCCESS) {
+    return;
+  }
+
+  VkSemaphoreTypeCreateInfo typeCreateInfo = {};
+  typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+  typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+  VkSemaphoreCreateInfo semaphoreCreateInfo = {};
+  semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+  semaphoreCreateInfo.pNext = &typeCreateInfo;
+  status_ = volk_.vkCreateSemaphore(device_, &semaphoreCreateInfo, nullptr, &semaphore_);
+}
+
+VolkUploadQueue::~VolkUploadQueue() noexcept {
+  if (semaphore_ != VK_NULL_HANDLE) {
+    (void)wait(value_);
+    volk_.vkDestroySemaphore(device_, semaphore_, nullptr);
+  }
+  if (commandPool_ != VK_NULL_HANDLE) {
+    volk_.vkDestroyCommandPool(device_, commandPool_, nullptr);
+  }
+  if (ring_ != VK_NULL_HANDLE) {
+    volk_.vkDestroyBuffer(device_, ring_, nullptr);
+  }
+  if (ringMemory_ != VK_NULL_HANDLE) {
+    volk_.vkFreeMemory(device_, ringMemory_, nullptr);
+  }
+}
+
+VkResult VolkUploadQueue::getStatus() noexcept {
+  std::lock_guard lock(mutex_);
+  return status_;
+}
+
+VkSemaphore VolkUploadQueue::getSemaphore() const noexcept {
+  return semaphore_;
+}
+
+VolkUploadQueue::Stats VolkUploadQueue::getStats() noexcept {
+  std::lock_guard lock(mutex_);
+  return stats_;
+}
+
+bool VolkUploadQueue::isPending() const noexcept {
+  return !bufferCopies_.empty() || !imageCopies_.empty();
+}
+
+bool VolkUploadQueue::reserve(VkDeviceSize size, VkDeviceSize& offset) noexcept {
+  if (size > ringSize_) {
+    return false;
+  }
+  bool stalled = false;
+  bool throttled = false;
+  for (;;) {
+    auto position = alignUp(writePosition_, kAlignment);
+    if (position % ringSize_ + size > ringSize_) {
+      position = alignUp(position, ringSize_);
+    }
+    if (batches_.empty() && !isPending()) {
+      // The ring is idle: restart at the aligned position so that any size up to ringSize_ fits.
+      readPosition_ = pendingPosition_ = position;
+    }
+    // Without headroom, wait for a batch in flight to complete, as when the ring is full.
+    bool const inFlight = isPending() || !batches_.empty();
+    if (position + size - readPosition_ <= ringSize_) {
+      if (!hasHeadroom_ || !inFlight || hasHeadroom_(size)) {
+        writePosition_ = position + size;
+        offset = position % ringSize_;
+        return true;
+      }
+      if (!throttled) {
+        throttled = true;
+        ++stats_.throttles;
+      }
+    } else if (!stalled) {
+      stalled = true;
+      ++stats_.stalls;
+    }
+    if (isPending() && submit() != VK_SUCCESS) {
+      return false;
+    }
+    reclaim(true);
+    if (status_ != VK_SUCCESS) {
+      return false;
+    }
+  }
+}
+
+void VolkUploadQueue::reclaim(bool wait) noexcept {
+  uint64_t value = 0;
+  auto result = getSemaphoreCounterValue_(device_, semaphore_, &value);
+  if (result == VK_SUCCESS && wait && !batches_.empty() && batches_.front().value > value) {
+    VkSemaphoreWaitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &semaphore_;
+    waitInfo.pValues = &batches_.front().value;
+    result = waitSemaphores_(device_, &waitInfo, UINT64_MAX);
+    value = batches_.front().value;
+  }
+  if (result != VK_SUCCESS) {
+    status_ = result;
+    return;
+  }
+
+  while (!batches_.empty() && batches_.front().value <= value) {
+    readPosition_ = batches_.front().ringEnd;
+    freeCommandBuffers_.push_back(batches_.front().commandBuffer);
+    batches_.pop_front();
+  }
+}
+
+void VolkUploadQueue::flushIfFull() noexcept {
+  if (writePosition_ - pendingPosition_ >= ringSize_ / 2) {
+    (void)submit();
+  }
+}
+
+uint64_t VolkUploadQueue::uploadBuffer(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* pData,
+                                       VkDeviceSize size) noexcept {
+  std::lock_guard lock(mutex_);
+  if (status_ != VK_SUCCESS || size == 0) {
+    return 0;
+  }
+
+  auto const* data = static_cast<const uint8_t*>(pData);
+  auto const chunkSize = ringSize_ / 2;
+  for (VkDeviceSize done = 0; done < size;) {
+    auto const chunk = std::min(size - done, chunkSize);
+    VkDeviceSize offset = 0;
+    if (!reserve(chunk, offset)) {
+      return 0;
+    }
+    std::memcpy(ringData_ + offset, data + done, static_cast<size_t>(chunk));
+
+    BufferCopy copy;
+    copy.buffer = dstBuffer;
+    copy.region.srcOffset = offset;
+    copy.region.dstOffset = dstOffset + done;
+    copy.region.size = chunk;
+    bufferCopies_.push_back(copy);
+    stats_.bytes += chunk;
+    done += chunk;
+    if (done < size) {
+      flushIfFull();
+    }
+  }
+
+  auto const value = value_ + 1;
+  flushIfFull();
+  return value;
+}
+
+uint64_t VolkUploadQueue::uploadImage(VkImage dstImage, VkImageLayout finalLayout, uint32_t regionCount,
+                                      const VkBufferImageCopy* pRegions, const void* pData,
+                                      VkDeviceSize size) noexcept {
+  std::lock_guard lock(mutex_);
+  if (status_ != VK_SUCCESS || regionCount == 0) {
+    return 0;
+  }
+  // Each upload of an image transitions it from VK_IMAGE_LAYOUT_UNDEFINED and then to its final layout, so two
+  // uploads of the same image can't share a batch.
+  auto const pending = std::find_if(imageCopies_.begin(), imageCopies_.end(),
+                                    [dstImage](ImageCopy const& copy) { return copy.image == dstImage; });
+  if (pending != imageCopies_.end() && submit() != VK_SUCCESS) {
+    return 0;
+  }
+  VkDeviceSize offset = 0;
+  if (!reserve(size, offset)) {
+    return 0;
+  }
+  std::memcpy(ringData_ + offset, pData, static_cast<size_t>(size));
+
+  ImageCopy copy;
+  copy.image = dstImage;
+  copy.finalLayout = finalLayout;
+  copy.firstRegion = imageRegions_.size();
+  copy.regionCount = regionCount;
+  for (uint32_t i = 0; i < regionCount; ++i) {
+    auto region = pRegions[i];
+    region.bufferOffset += offset;
+    imageRegions_.push_back(region);
+  }
+  imageCopies_.push_back(copy);
+  stats_.bytes += size;
+
+  auto const value = value_ + 1;
+  flushIfFull();
+  return value;
+}
+
+uint64_t VolkUploadQueue::flush() noexcept {
+  std::lock_guard lock(mutex_);
+  if (status_ == VK_SUCCESS && isPending()) {
+    (void)submit();
+  }
+  return value_;
+}
+
+void VolkUploadQueue::addRangeBarriers(const ImageCopy& copy, VkImageMemoryBarrier2 barrier) noexcept {
+  // Regions which only differ in their offset or extent write the same subresources and share a barrier.
+  auto const first = imageBarriers_.size();
+  for (uint32_t i = 0; i < copy.regionCount; ++i) {
+    barrier.subresourceRange = getRange(imageRegions_[copy.firstRegion + i].imageSubresource);
+    auto const begin = imageBarriers_.begin() + static_cast<ptrdiff_t>(first);
+    if (std::none_of(begin, imageBarriers_.end(), [&barrier](VkImageMemoryBarrier2 const& other) {
+          return isSameRange(other.subresourceRange, barrier.subresourceRange);
+        })) {
+      imageBarriers_.push_back(barrier);
+    }
+  }
+}
+
+VkResult VolkUploadQueue::submit() noexcept {
+  reclaim(false);
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+  if (!freeCommandBuffers_.empty()) {
+    commandBuffer = freeCommandBuffers_.back();
+    freeCommandBuffers_.pop_back();
+    status_ = volk_.vkResetCommandBuffer(commandBuffer, 0);
+  } else {
+    VkCommandBufferAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocateInfo.commandPool = commandPool_;
+    allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocateInfo.commandBufferCount = 1;
+    status_ = volk_.vkAllocateCommandBuffers(device_, &allocateInfo, &commandBuffer);
+  }
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  VkCommandBufferBeginInfo beginInfo = {};
+  beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+  status_ = volk_.vkBeginCommandBuffer(commandBuffer, &beginInfo);
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  auto const value = value_ + 1;
+  bool const transfer = transferQueueFamilyIndex_ != dstQueueFamilyIndex_;
+  VkDependencyInfo dependencyInfo = {};
+  dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+
+  // Discard the previous contents of the uploaded subresources. Barriers cover the subresources of each region rather
+  // than their bounding range, which would also discard mips and layers the batch doesn't write.
+  imageBarriers_.clear();
+  for (auto const& copy : imageCopies_) {
+    VkImageMemoryBarrier2 barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = copy.image;
+    addRangeBarriers(copy, barrier);
+  }
+  if (!imageBarriers_.empty()) {
+    dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers_.size());
+    dependencyInfo.pImageMemoryBarriers = imageBarriers_.data();
+    cmdPipelineBarrier2_(commandBuffer, &dependencyInfo);
+  }
+
+  // Consecutive copies to the same buffer share one call.
+  std::vector<VkBufferCopy> regions;
+  for (size_t i = 0; i < bufferCopies_.size();) {
+    regions.clear();
+    auto const buffer = bufferCopies_[i].buffer;
+    for (; i < bufferCopies_.size() && bufferCopies_[i].buffer == buffer; ++i) {
+      regions.push_back(bufferCopies_[i].region);
+    }
+    volk_.vkCmdCopyBuffer(commandBuffer, ring_, buffer, static_cast<uint32_t>(regions.size()), regions.data());
+  }
+  for (auto const& copy : imageCopies_) {
+    volk_.vkCmdCopyBufferToImage(commandBuffer, ring_, copy.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                                 copy.regionCount, imageRegions_.data() + copy.firstRegion);
+  }
+
+  // Final layouts, and the release half of queue family ownership transfers. The semaphore signal makes the copies
+  // available, so buffers only need a barrier for the ownership transfer.
+  bufferBarriers_.clear();
+  if (transfer) {
+    for (auto const& copy : bufferCopies_) {
+      VkBufferMemoryBarrier2 barrier = {};
+      barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+      barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+      barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+      barrier.srcQueueFamilyIndex = transferQueueFamilyIndex_;
+      barrier.dstQueueFamilyIndex = dstQueueFamilyIndex_;
+      barrier.buffer = copy.buffer;
+      barrier.offset = copy.region.dstOffset;
+      barrier.size = copy.region.size;
+      bufferBarriers_.push_back(barrier);
+
+      barrier.srcStageMask = VK_PIPELINE_STAGE_2_NONE;
+      barrier.srcAccessMask = VK_ACCESS_2_NONE;
+      barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+      barrier.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+      bufferAcquires_.emplace_back(value, barrier);
+    }
+  }
+  imageBarriers_.clear();
+  for (auto const& copy : imageCopies_) {
+    VkImageMemoryBarrier2 barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = copy.finalLayout;
+    barrier.srcQueueFamilyIndex = transfer ? transferQueueFamilyIndex_ : VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = transfer ? dstQueueFamilyIndex_ : VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = copy.image;
+    auto const first = imageBarriers_.size();
+    addRangeBarriers(copy, barrier);
+
+    if (transfer) {
+      for (auto i = first; i < imageBarriers_.size(); ++i) {
+        auto acquire = imageBarriers_[i];
+        acquire.srcStageMask = VK_PIPELINE_STAGE_2_NONE;
+        acquire.srcAccessMask = VK_ACCESS_2_NONE;
+        acquire.dstStageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        acquire.dstAccessMask = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+        imageAcquires_.emplace_back(value, acquire);
+      }
+    }
+  }
+  if (!bufferBarriers_.empty() || !imageBarriers_.empty()) {
+    dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferBarriers_.size());
+    dependencyInfo.pBufferMemoryBarriers = bufferBarriers_.data();
+    dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers_.size());
+    dependencyInfo.pImageMemoryBarriers = imageBarriers_.data();
+    cmdPipelineBarrier2_(commandBuffer, &dependencyInfo);
+  }
+
+  status_ = volk_.vkEndCommandBuffer(commandBuffer);
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  VkCommandBufferSubmitInfo commandBufferInfo = {};
+  commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+  commandBufferInfo.commandBuffer = commandBuffer;
+  VkSemaphoreSubmitInfo signalInfo = {};
+  signalInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+  signalInfo.semaphore = semaphore_;
+  signalInfo.value = value;
+  signalInfo.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+  VkSubmitInfo2 submitInfo = {};
+  submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+  submitInfo.commandBufferInfoCount = 1;
+  submitInfo.pCommandBufferInfos = &commandBufferInfo;
+  submitInfo.signalSemaphoreInfoCount = 1;
+  submitInfo.pSignalSemaphoreInfos = &signalInfo;
+  status_ = queueSubmit2_(queue_, 1, &submitInfo, VK_NULL_HANDLE);
+  if (status_ != VK_SUCCESS) {
+    return status_;
+  }
+
+  value_ = value;
+  batches_.push_back({commandBuffer, value, writePosition_});
+  pendingPosition_ = writePosition_;
+  bufferCopies_.clear();
+  imageCopies_.clear();
+  imageRegions_.clear();
+  ++stats_.batches;
+  return VK_SUCCESS;
+}
+
+void VolkUploadQueue::recordAcquireBarriers(VkCommandBuffer commandBuffer, uint64_t value) noexcept {
+  std::lock_guard lock(mutex_);
+  bufferBarriers_.clear();
+  imageBarriers_.clear();
+  auto const take = [value](auto& acquires, auto& barriers) {
+    auto const end = std::partition(acquires.begin(), acquires.end(),
+                                    [value](auto const& acquire) { return acquire.first <= value; });
+    for (auto it = acquires.begin(); it != end; ++it) {
+      barriers.push_back(it->second);
+    }
+    acquires.erase(acquires.begin(), end);
+  };
+  take(bufferAcquires_, bufferBarriers_);
+  take(imageAcquires_, imageBarriers_);
+  if (bufferBarriers_.empty() && imageBarriers_.empty()) {
+    return;
+  }
+
+  VkDependencyInfo dependencyInfo = {};
+  dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+  dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferBarriers_.size());
+  dependencyInfo.pBufferMemoryBarriers = bufferBarriers_.data();
+  dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(imageBarriers_.size());
+  dependencyInfo.pImageMemoryBarriers = imageBarriers_.data();
+  cmdPipelineBarrier2_(commandBuffer, &dependencyInfo);
+}
+
+VkResult VolkUploadQueue::wait(uint64_t value, uint64_t timeout /* = UINT64_MAX */) noexcept {
+  if (!waitSemaphores_ || semaphore_ == VK_NULL_HANDLE) {
+    return VK_ERROR_EXTENSION_NOT_PRESENT;
+  }
+  VkSemaphoreWaitInfo waitInfo = {};
+  waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+  waitInfo.semaphoreCount = 1;
+  waitInfo.pSemaphores = &semaphore_;
+  waitInfo.pValues = &value;
+  return waitSemaphores_(device_, &waitInfo, timeout);
+}
+
+#endif
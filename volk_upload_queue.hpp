@@ -0,0 +1,166 @@
+/* This file is part of volk-cpp library; see volk.hpp for version/license details */
+#pragma once
+
+#include "volk.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(VK_BASE_VERSION_1_3)
+
+/**
+ * Upload service for a dedicated transfer queue, staging through a persistently mapped ring buffer.
+ *
+ * Uploads from any thread are copied into the ring and batched; flush() records the batch into one command buffer,
+ * submits it to the transfer queue and signals the next value of a timeline semaphore. Every upload returns the value
+ * signaled by the batch containing it. The ring is recycled as batches complete; when it is full, uploads flush and
+ * wait for the oldest batch. Batches are also flushed when they hold half the ring.
+ *
+ * If the transfer and destination queue families differ, the destination resources are released to the destination
+ * family at the end of the batch. The matching acquire barriers must be recorded on the destination queue with
+ * recordAcquireBarriers(), in a submission which waits for the batch's semaphore value. Resources must use
+ * VK_SHARING_MODE_EXCLUSIVE; the previous contents of uploaded image subresources are discarded.
+ *
+ * An optional headroom callback applies back-pressure from device memory budgets, e.g. through
+ * VolkResidencyManager::hasHeadroom(): while it returns false, uploads wait for the batches in flight to complete
+ * before staging more data. With nothing in flight waiting can't help, and uploads go ahead.
+ */
+class VolkUploadQueue final {
+public:
+  static constexpr VkDeviceSize kDefaultRingSize = 64ull << 20;
+  // Staging offsets are aligned to this, which covers the texel block sizes of power-of-two sized formats.
+  static constexpr VkDeviceSize kAlignment = 16;
+
+  struct Stats {
+    uint64_t bytes = 0;     // bytes uploaded
+    uint64_t batches = 0;   // batches submitted
+    uint64_t stalls = 0;    // uploads which waited for ring space
+    uint64_t throttles = 0; // uploads which waited because the headroom callback returned false
+  };
+
+  /**
+   * Returns whether size more bytes can be uploaded. Called with the queue locked, so it must not use the queue.
+   */
+  using HeadroomCallback = std::function<bool(VkDeviceSize size)>;
+
+  /**
+   * Volk must have device function pointers loaded for the given device. transferQueue belongs to
+   * transferQueueFamilyIndex; uploaded resources are used on dstQueueFamilyIndex.
+   */
+  VolkUploadQueue(Volk& volk, VkPhysicalDevice physicalDevice, VkDevice device, VkQueue transferQueue,
+                  uint32_t transferQueueFamilyIndex, uint32_t dstQueueFamilyIndex,
+                  VkDeviceSize ringSize = kDefaultRingSize, HeadroomCallback hasHeadroom = {}) noexcept;
+  ~VolkUploadQueue() noexcept;
+  VolkUploadQueue(const VolkUploadQueue&) = delete;
+  VolkUploadQueue& operator=(const VolkUploadQueue&) = delete;
+
+  /**
+   * Returns VK_ERROR_EXTENSION_NOT_PRESENT if timeline semaphores or synchronization2 aren't available, the error of
+   * creating the ring, command pool or semaphore, or the error of the last submission.
+   */
+  [[nodiscard]] VkResult getStatus() noexcept;
+
+  /**
+   * Upload size bytes to dstBuffer at dstOffset. Uploads larger than the ring are split. Returns the semaphore value
+   * which signals completion, or 0 on failure or if size is 0.
+   */
+  uint64_t uploadBuffer(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* pData, VkDeviceSize size) noexcept;
+
+  /**
+   * Upload regions of dstImage, which ends up in finalLayout. Region buffer offsets are relative to pData, and all
+   * regions of one call must fit in the ring. Regions must not cover partially overlapping layer ranges of one mip
+   * level. If dstImage already has a pending upload, that batch is submitted first. Returns the semaphore value which
+   * signals completion, or 0 on failure.
+   */
+  uint64_t uploadImage(VkImage dstImage, VkImageLayout finalLayout, uint32_t regionCount,
+                       const VkBufferImageCopy* pRegions, const void* pData, VkDeviceSize size) noexcept;
+
+  /**
+   * Submit the pending uploads. Returns the value signaled by the last submitted batch.
+   */
+  uint64_t flush() noexcept;
+
+  /**
+   * Record the acquire barriers of uploads completed by value into a command buffer of the destination queue family.
+   * Does nothing if the queue families are the same.
+   */
+  void recordAcquireBarriers(VkCommandBuffer commandBuffer, uint64_t value) noexcept;
+
+  /**
+   * Block until value is signaled.
+   */
+  VkResult wait(uint64_t value, uint64_t timeout = UINT64_MAX) noexcept;
+
+  [[nodiscard]] VkSemaphore getSemaphore() const noexcept;
+  [[nodiscard]] Stats getStats() noexcept;
+
+private:
+  struct BufferCopy {
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkBufferCopy region = {};
+  };
+
+  struct ImageCopy {
+    VkImage image = VK_NULL_HANDLE;
+    VkImageLayout finalLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    size_t firstRegion = 0;
+    uint32_t regionCount = 0;
+  };
+
+  struct Batch {
+    VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+    uint64_t value = 0;
+    uint64_t ringEnd = 0;
+  };
+
+  // Called with mutex_ locked.
+  [[nodiscard]] bool reserve(VkDeviceSize size, VkDeviceSize& offset) noexcept;
+  void reclaim(bool wait) noexcept;
+  [[nodiscard]] VkResult submit() noexcept;
+  [[nodiscard]] bool isPending() const noexcept;
+  void flushIfFull() noexcept;
+  // Append a copy of barrier to imageBarriers_ for each distinct subresource range of the regions of copy.
+  void addRangeBarriers(const ImageCopy& copy, VkImageMemoryBarrier2 barrier) noexcept;
+
+  Volk& volk_;
+  VkDevice device_ = VK_NULL_HANDLE;
+  VkQueue queue_ = VK_NULL_HANDLE;
+  uint32_t transferQueueFamilyIndex_ = 0;
+  uint32_t dstQueueFamilyIndex_ = 0;
+  PFN_vkQueueSubmit2 queueSubmit2_ = nullptr;
+  PFN_vkCmdPipelineBarrier2 cmdPipelineBarrier2_ = nullptr;
+  PFN_vkGetSemaphoreCounterValue getSemaphoreCounterValue_ = nullptr;
+  PFN_vkWaitSemaphores waitSemaphores_ = nullptr;
+  VkResult status_ = VK_SUCCESS;
+
+  VkBuffer ring_ = VK_NULL_HANDLE;
+  VkDeviceMemory ringMemory_ = VK_NULL_HANDLE;
+  uint8_t* ringData_ = nullptr;
+  VkDeviceSize ringSize_ = 0;
+  HeadroomCallback hasHeadroom_;
+  VkCommandPool commandPool_ = VK_NULL_HANDLE;
+  VkSemaphore semaphore_ = VK_NULL_HANDLE;
+
+  std::mutex mutex_;
+  // Positions grow monotonically; the ring offset is the position modulo ringSize_.
+  uint64_t writePosition_ = 0;
+  uint64_t readPosition_ = 0;
+  uint64_t pendingPosition_ = 0; // start of the data of pending uploads
+  uint64_t value_ = 0;           // last submitted value
+  std::vector<BufferCopy> bufferCopies_;
+  std::vector<ImageCopy> imageCopies_;
+  std::vector<VkBufferImageCopy> imageRegions_;
+  std::deque<Batch> batches_;
+  std::vector<VkCommandBuffer> freeCommandBuffers_;
+  std::vector<std::pair<uint64_t, VkBufferMemoryBarrier2>> bufferAcquires_;
+  std::vector<std::pair<uint64_t, VkImageMemoryBarrier2>> imageAcquires_;
+  std::vector<VkBufferMemoryBarrier2> bufferBarriers_;
+  std::vector<VkImageMemoryBarrier2> imageBarriers_;
+  Stats stats_;
+};
+
+#endif